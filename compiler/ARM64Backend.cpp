@@ -1,132 +1,203 @@
 #include "ARM64Backend.h"
+#include "Log.h"
 #include <iostream>
 #include <cctype>
+#include <cstdint>
+#include <utility>
 
-void ARM64Backend::gen_return(std::ostream &os, const std::string &src) const {
-    if (src.find('[') != std::string::npos) {
-        os << "    ldr w0, " << src << "\n";
-    } else {
-        os << "    mov w0, " << src << "\n";
+// Immédiat des add / sub / cmp : 12 bits non signés
+static bool isArithImmediate(int value) {
+    return value >= 0 && value <= 4095;
+}
+
+// Immédiat des and / orr / eor : motif répété tous les 2, 4... 32 bits,
+// dont l'élément est une suite de 1 contiguë éventuellement tournée
+static bool isLogicalImmediate(uint32_t value) {
+    if (value == 0 || value == 0xFFFFFFFFu)
+        return false;
+    for (unsigned size = 2; size <= 32; size *= 2) {
+        uint32_t mask = size == 32 ? 0xFFFFFFFFu : (1u << size) - 1;
+        uint32_t element = value & mask;
+        bool periodic = true;
+        for (unsigned shift = size; shift < 32 && periodic; shift += size)
+            periodic = ((value >> shift) & mask) == element;
+        if (!periodic)
+            continue;
+        // Une seule suite de 1 : exactement deux changements 0/1 en faisant le tour de l'élément
+        uint32_t rotated = ((element >> 1) | (element << (size - 1))) & mask;
+        int changes = 0;
+        for (uint32_t diff = element ^ rotated; diff != 0; diff &= diff - 1)
+            changes++;
+        return changes == 2;
     }
+    return false;
 }
 
+// mov accepte un immédiat movz / movn sur 16 bits ou un masque logique ;
+// sinon la constante est construite moitié par moitié
+static std::string loadImmediate(const std::string &reg, int value) {
+    uint32_t bits = (uint32_t)value;
+    if ((bits >> 16) == 0 || (bits & 0xFFFF) == 0 || (bits >> 16) == 0xFFFF || isLogicalImmediate(bits))
+        return "    mov " + reg + ", #" + std::to_string(value) + "\n";
+    return "    mov " + reg + ", #" + std::to_string(bits & 0xFFFF) + "\n"
+         + "    movk " + reg + ", #" + std::to_string(bits >> 16) + ", lsl #16\n";
+}
 
-void ARM64Backend::gen_mov(std::ostream &os, const std::string &dest, const std::string &src) const {
-    // Adjust dest if it’s x86-style or a plain offset
-    std::string adjusted_dest = dest;
-    if (dest.find("(%rbp)") != std::string::npos) {
-        adjusted_dest = "[x29, #" + dest.substr(0, dest.find("(%rbp)")) + "]";
-    } else if (dest.find('[') == std::string::npos) {
-        adjusted_dest = "[x29, #" + dest + "]";
+// dest = base - amount (registres 64 bits, sp accepté) : un immédiat de 12 bits,
+// éventuellement décalé de 12, par sub ; au-delà de 24 bits, amount passe par x17
+static void subtractFrom(AsmWriter &os, const std::string &dest, const std::string &base, int amount) {
+    if (amount >= (1 << 24)) {
+        os << "    mov x17, #" << (amount & 0xFFFF) << "\n";
+        os << "    movk x17, #" << (amount >> 16) << ", lsl #16\n";
+        os << "    sub " << dest << ", " << base << ", x17\n";
+        return;
+    }
+    std::string from = base;
+    if (amount >> 12) {
+        os << "    sub " << dest << ", " << from << ", #" << (amount >> 12) << ", lsl #12\n";
+        from = dest;
     }
+    if ((amount & 0xFFF) || from == base)
+        os << "    sub " << dest << ", " << from << ", #" << (amount & 0xFFF) << "\n";
+}
 
-    if (isdigit(src[0]) || (src[0] == '-' && isdigit(src[1]))) {
-        os << "    mov w0, #" << src << "\n";
-        os << "    str w0, " << adjusted_dest << "\n";
+void ARM64Backend::gen_return(AsmWriter &os, const Operand &src) const {
+    if (src.isRegister()) {
+        if (src.reg != "w0")
+            os << "    mov w0, " << src.reg << "\n";
     } else {
-        // Adjust src if it’s x86-style or a plain offset
-        std::string adjusted_src = src;
-        if (src.find("(%rbp)") != std::string::npos) {
-            adjusted_src = "[x29, #" + src.substr(0, src.find("(%rbp)")) + "]";
-        } else if (src.find('[') == std::string::npos) {
-            adjusted_src = "[x29, #" + src + "]";
-        }
-        os << "    ldr w0, " << adjusted_src << "\n";
-        os << "    str w0, " << adjusted_dest << "\n";
+        loadOperand(os, src, "w0");
+    }
+}
+
+
+void ARM64Backend::gen_mov(AsmWriter &os, const Operand &dest, const Operand &src) const {
+    if (src.isImmediate()) {
+        std::string reg = defOperand(dest);
+        os << loadImmediate(reg, src.value);
+        storeResult(os, reg, dest);
+    } else {
+        gen_copy(os, dest, src);
+    }
+}
+
+// Les opérandes déjà en registre (allocation -O1) sont utilisés directement ;
+// les autres sont chargés dans w0 / w1 et le résultat est stocké si dest est en mémoire.
+void ARM64Backend::gen_binop(AsmWriter &os, const std::string &instr, const Operand &dest,
+                             const Operand &src1, const Operand &src2) const {
+    std::string a = useOperand(os, src1, "w0");
+    std::string b = useOperand(os, src2, "w1");
+    std::string d = defOperand(dest);
+    os << "    " << instr << " " << d << ", " << a << ", " << b << "\n";
+    storeResult(os, d, dest);
+}
+
+// add / sub avec un immédiat de 12 bits ; un immédiat négatif passe par
+// l'instruction inverse (add w0, w0, #-5 -> sub w0, w0, #5)
+bool ARM64Backend::gen_arith_imm(AsmWriter &os, const std::string &instr, const std::string &inverse,
+                                 const Operand &dest, const Operand &src, const Operand &imm) const {
+    if (!imm.isImmediate())
+        return false;
+    int value = imm.value;
+    std::string op = instr;
+    if (!isArithImmediate(value)) {
+        if (value >= 0 || value < -4095)
+            return false;
+        op = inverse;
+        value = -value;
     }
+    std::string a = useOperand(os, src, "w0");
+    std::string d = defOperand(dest);
+    os << "    " << op << " " << d << ", " << a << ", #" << value << "\n";
+    storeResult(os, d, dest);
+    return true;
 }
 
-void ARM64Backend::gen_add(std::ostream &os, const std::string &dest,
-                           const std::string &src1, const std::string &src2) const {
-    os << "    ldr w0, " << src1 << "\n";     // Load src1 to w0
-    os << "    ldr w1, " << src2 << "\n";     // Load src2 to w1
-    os << "    add w0, w0, w1\n";            // Add w1 to w0
-    os << "    str w0, " << dest << "\n";     // Store result to dest
+// and / orr / eor avec un masque logique encodable, dans un ordre ou l'autre
+void ARM64Backend::gen_logical(AsmWriter &os, const std::string &instr, const Operand &dest,
+                               const Operand &src1, const Operand &src2) const {
+    const Operand *reg = &src1, *imm = &src2;
+    if (reg->isImmediate() && !imm->isImmediate())
+        std::swap(reg, imm);
+    if (!imm->isImmediate() || !isLogicalImmediate((uint32_t)imm->value)) {
+        gen_binop(os, instr, dest, src1, src2);
+        return;
+    }
+    std::string a = useOperand(os, *reg, "w0");
+    std::string d = defOperand(dest);
+    os << "    " << instr << " " << d << ", " << a << ", #" << imm->value << "\n";
+    storeResult(os, d, dest);
 }
 
-void ARM64Backend::gen_sub(std::ostream &os, const std::string &dest,
-                           const std::string &src1, const std::string &src2) const {
-    os << "    ldr w0, " << src1 << "\n";     // Load src1 to w0
-    os << "    ldr w1, " << src2 << "\n";     // Load src2 to w1
-    os << "    sub w0, w0, w1\n";            // Subtract w1 from w0
-    os << "    str w0, " << dest << "\n";     // Store result to dest
+void ARM64Backend::gen_add(AsmWriter &os, const Operand &dest,
+                           const Operand &src1, const Operand &src2) const {
+    if (!gen_arith_imm(os, "add", "sub", dest, src1, src2) && !gen_arith_imm(os, "add", "sub", dest, src2, src1))
+        gen_binop(os, "add", dest, src1, src2);
 }
 
-void ARM64Backend::gen_mul(std::ostream &os, const std::string &dest,
-                           const std::string &src1, const std::string &src2) const {
-    os << "    ldr w0, " << src1 << "\n";     // Load src1 to w0
-    os << "    ldr w1, " << src2 << "\n";     // Load src2 to w1
-    os << "    mul w0, w0, w1\n";            // Multiply w0 by w1
-    os << "    str w0, " << dest << "\n";     // Store result to dest
+void ARM64Backend::gen_sub(AsmWriter &os, const Operand &dest,
+                           const Operand &src1, const Operand &src2) const {
+    if (!gen_arith_imm(os, "sub", "add", dest, src1, src2))
+        gen_binop(os, "sub", dest, src1, src2);
 }
 
-void ARM64Backend::gen_div(std::ostream &os, const std::string &dest,
-                           const std::string &src1, const std::string &src2) const {
-    os << "    ldr w0, " << src1 << "\n";     // Load src1 to w0 (dividend)
-    os << "    ldr w1, " << src2 << "\n";     // Load src2 to w1 (divisor)
-    os << "    sdiv w0, w0, w1\n";           // Signed divide w0 by w1
-    os << "    str w0, " << dest << "\n";     // Store quotient to dest
+void ARM64Backend::gen_mul(AsmWriter &os, const Operand &dest,
+                           const Operand &src1, const Operand &src2) const {
+    gen_binop(os, "mul", dest, src1, src2);
 }
 
-void ARM64Backend::gen_mod(std::ostream &os, const std::string &dest,
-                           const std::string &src1, const std::string &src2) const {
-    os << "    ldr w0, " << src1 << "\n";     // Load src1 to w0 (dividend)
-    os << "    ldr w1, " << src2 << "\n";     // Load src2 to w1 (divisor)
-    os << "    sdiv w2, w0, w1\n";           // Signed divide w0 by w1, quotient in w2
-    os << "    msub w0, w2, w1, w0\n";       // w0 = w0 - (w2 * w1), remainder in w0
-    os << "    str w0, " << dest << "\n";     // Store remainder to dest
+void ARM64Backend::gen_div(AsmWriter &os, const Operand &dest,
+                           const Operand &src1, const Operand &src2) const {
+    gen_binop(os, "sdiv", dest, src1, src2);  // Signed divide
 }
 
-void ARM64Backend::gen_not(std::ostream &os, const std::string &dest,
-                           const std::string &src) const {
-    os << "    ldr w0, " << src << "\n";      // Load src to w0
-    os << "    cmp w0, #0\n";                // Compare with 0
-    os << "    cset w0, eq\n";               // Set w0 to 1 if equal (src == 0), else 0
-    os << "    str w0, " << dest << "\n";     // Store result to dest
+void ARM64Backend::gen_mod(AsmWriter &os, const Operand &dest,
+                           const Operand &src1, const Operand &src2) const {
+    std::string a = useOperand(os, src1, "w0");   // dividend
+    std::string b = useOperand(os, src2, "w1");   // divisor
+    std::string d = defOperand(dest);
+    os << "    sdiv w2, " << a << ", " << b << "\n";                    // quotient in w2
+    os << "    msub " << d << ", w2, " << b << ", " << a << "\n";       // a - (w2 * b)
+    storeResult(os, d, dest);
 }
 
-void ARM64Backend::gen_egal(std::ostream &os, const std::string &dest,
-                            const std::string &src1, const std::string &src2) const {
-    os << "    ldr w0, " << src1 << "\n";     // Load src1 to w0
-    os << "    ldr w1, " << src2 << "\n";     // Load src2 to w1
-    os << "    cmp w0, w1\n";                // Compare w0 and w1
-    os << "    cset w0, eq\n";               // Set w0 to 1 if equal, else 0
-    os << "    str w0, " << dest << "\n";     // Store result to dest
+void ARM64Backend::gen_not(AsmWriter &os, const Operand &dest,
+                           const Operand &src) const {
+    std::string a = useOperand(os, src, "w0");
+    std::string d = defOperand(dest);
+    os << "    cmp " << a << ", #0\n";                 // Compare with 0
+    os << "    cset " << d << ", eq\n";                // 1 if src == 0, else 0
+    storeResult(os, d, dest);
 }
 
-void ARM64Backend::gen_notegal(std::ostream &os, const std::string &dest,
-                               const std::string &src1, const std::string &src2) const {
-    os << "    ldr w0, " << src1 << "\n";     // Load src1 to w0
-    os << "    ldr w1, " << src2 << "\n";     // Load src2 to w1
-    os << "    cmp w0, w1\n";                // Compare w0 and w1
-    os << "    cset w0, ne\n";               // Set w0 to 1 if not equal, else 0
-    os << "    str w0, " << dest << "\n";     // Store result to dest
+void ARM64Backend::gen_egal(AsmWriter &os, const Operand &dest,
+                            const Operand &src1, const Operand &src2) const {
+    gen_comp(os, dest, src1, src2, "==");
 }
 
-void ARM64Backend::gen_xor(std::ostream &os, const std::string &dest,
-                           const std::string &src1, const std::string &src2) const {
-    std::cerr << "[gen_xor] dest = " << dest << ", src1 = " << src1 << ", src2 = " << src2 << "\n";
-    os << "    ldr w0, " << src1 << "\n";     // Load src1 to w0
-    os << "    ldr w1, " << src2 << "\n";     // Load src2 to w1
-    os << "    eor w0, w0, w1\n";            // XOR w0 with w1
-    os << "    str w0, " << dest << "\n";     // Store result to dest
+void ARM64Backend::gen_notegal(AsmWriter &os, const Operand &dest,
+                               const Operand &src1, const Operand &src2) const {
+    gen_comp(os, dest, src1, src2, "!=");
 }
 
-void ARM64Backend::gen_or(std::ostream &os, const std::string &dest,
-                          const std::string &src1, const std::string &src2) const {
-    std::cerr << "[gen_or] dest = " << dest << ", src1 = " << src1 << ", src2 = " << src2 << "\n";
-    os << "    ldr w0, " << src1 << "\n";     // Load src1 to w0
-    os << "    ldr w1, " << src2 << "\n";     // Load src2 to w1
-    os << "    orr w0, w0, w1\n";            // OR w0 with w1
-    os << "    str w0, " << dest << "\n";     // Store result to dest
+void ARM64Backend::gen_xor(AsmWriter &os, const Operand &dest,
+                           const Operand &src1, const Operand &src2) const {
+    LOG_TRACE("gen_xor: dest = " << dest << ", src1 = " << src1 << ", src2 = " << src2);
+    gen_logical(os, "eor", dest, src1, src2);
 }
 
-void ARM64Backend::gen_call(std::ostream &os, const std::string &func) const {
+void ARM64Backend::gen_or(AsmWriter &os, const Operand &dest,
+                          const Operand &src1, const Operand &src2) const {
+    LOG_TRACE("gen_or: dest = " << dest << ", src1 = " << src1 << ", src2 = " << src2);
+    gen_logical(os, "orr", dest, src1, src2);
+}
+
+void ARM64Backend::gen_call(AsmWriter &os, const std::string &func) const {
     os << "    bl _" << func << "\n";  // NOTE: underscore before function
 }
 
 
-void ARM64Backend::gen_prologue(std::ostream &os, std::string &name, int stackSize) const {
+void ARM64Backend::gen_prologue(AsmWriter &os, std::string &name, int stackSize) const {
     os << ".globl _" << name << "\n";
     os << "_" << name << ":\n";
 
@@ -137,51 +208,56 @@ void ARM64Backend::gen_prologue(std::ostream &os, std::string &name, int stackSi
     // Allocate space for local variables (aligned)
     int aligned = ((stackSize + 15) / 16) * 16;
     if (aligned > 0) {
-        os << "    sub sp, sp, #" << aligned << "\n";
+        subtractFrom(os, "sp", "sp", aligned);
     }
 }
 
-void ARM64Backend::gen_epilogue(std::ostream &os) const {
+void ARM64Backend::gen_epilogue(AsmWriter &os) const {
     os << "    mov sp, x29\n";  // Restore sp before popping
     os << "    ldp x29, x30, [sp], #16\n";
     os << "    ret\n";
 }
 
 
-void ARM64Backend::gen_copy(std::ostream &os, const std::string &dest, const std::string &src) const {
-    bool srcIsMem = src.find('[') != std::string::npos;
-    bool destIsMem = dest.find('[') != std::string::npos;
-
-    bool srcIsReg = src[0] == 'x' || src[0] == 'w';
-    bool destIsReg = dest[0] == 'x' || dest[0] == 'w';
+void ARM64Backend::gen_copy(AsmWriter &os, const Operand &dest, const Operand &src) const {
+    if (src == dest)
+        return;
 
-    if (srcIsMem && destIsMem) {
-        os << "    ldr w0, " << src << "\n";
-        os << "    str w0, " << dest << "\n";
-    }
-    else if (srcIsMem && destIsReg) {
-        os << "    ldr " << dest << ", " << src << "\n";
-    }
-    else if (srcIsReg && destIsMem) {
-        os << "    str " << src << ", " << dest << "\n";
-    }
-    else if (srcIsReg && destIsReg) {
-        os << "    mov " << dest << ", " << src << "\n";
-    }
-    else {
-        // fallback sécurisé
-        os << "    ldr w0, " << src << "\n";
-        os << "    str w0, " << dest << "\n";
+    if (dest.isRegister()) {
+        if (src.isRegister())
+            os << "    mov " << dest.reg << ", " << src.reg << "\n";
+        else
+            loadOperand(os, src, dest.reg);
+    } else {
+        std::string reg = useOperand(os, src, "w0");
+        std::string address = frameAddress(os, dest.value);
+        os << "    str " << reg << ", " << address << "\n";
     }
 }
 
 
 
-void ARM64Backend::gen_and(std::ostream &os, const std::string &dest, const std::string &src1, const std::string &src2) const {
-    os << loadOperand(src1, "w0");
-    os << loadOperand(src2, "w1");
-    os << "    and w0, w0, w1\n";            // AND w0 with w1
-    os << "    str w0, " << dest << "\n";     // Store result to dest
+void ARM64Backend::gen_and(AsmWriter &os, const Operand &dest, const Operand &src1, const Operand &src2) const {
+    gen_logical(os, "and", dest, src1, src2);
+}
+
+void ARM64Backend::gen_save_reg(AsmWriter &os, const std::string &reg, int offset) const {
+    std::string address = frameAddress(os, offset);
+    os << "    str x" << reg.substr(1) << ", " << address << "\n";
+}
+
+void ARM64Backend::gen_restore_reg(AsmWriter &os, const std::string &reg, int offset) const {
+    std::string address = frameAddress(os, offset);
+    os << "    ldr x" << reg.substr(1) << ", " << address << "\n";
+}
+
+// w0-w7 (arguments), w8, w16-w18 (réservés) et w0-w2 (registres de travail) ne sont jamais alloués.
+std::vector<std::string> ARM64Backend::getCalleeSavedRegisters() const {
+    return {"w19", "w20", "w21", "w22", "w23", "w24", "w25", "w26", "w27", "w28"};
+}
+
+std::vector<std::string> ARM64Backend::getCallerSavedRegisters() const {
+    return {"w9", "w10", "w11", "w12", "w13", "w14", "w15"};
 }
 
 std::string ARM64Backend::getTempPrefix() const {
@@ -192,32 +268,51 @@ std::string ARM64Backend::getArchitecture() const {
     return "arm64";
 }
 
-std::string ARM64Backend::adjustMemOperand(const std::string &op) const {
-    if (op.find("(%rbp)") != std::string::npos)
-        return "[x29, #" + op.substr(0, op.find("(%rbp)")) + "]";
-    if (op.find('[') == std::string::npos)
-        return "[x29, #" + op + "]";
-    return op;
+// ldr / str avec un offset négatif sont assemblés en ldur / stur : offset
+// de -256 à 255. Plus loin, l'adresse est calculée dans x16, jamais alloué
+std::string ARM64Backend::frameAddress(AsmWriter &os, int offset) {
+    if (offset >= -256 && offset <= 255)
+        return "[x29, #" + std::to_string(offset) + "]";
+    subtractFrom(os, "x16", "x29", -offset);
+    return "[x16]";
 }
 
-std::string ARM64Backend::loadOperand(const std::string &operand, const std::string &targetReg) const {
-    // Vérifie si l'opérande est un immédiat en détectant le caractère '#' en première position.
-    if (!operand.empty() && operand[0] == '#') {
-        // Si c'est un immédiat, on génère une instruction mov.
-        return "    mov " + targetReg + ", " + operand + "\n";
+void ARM64Backend::loadOperand(AsmWriter &os, const Operand &operand, const std::string &targetReg) const {
+    if (operand.isImmediate()) {
+        os << loadImmediate(targetReg, operand.value);
+        return;
     }
-    // Sinon, on suppose que l'opérande est déjà au format mémoire (ex. "[x29, #...]" ou similaire)
-    return "    ldr " + targetReg + ", " + operand + "\n";
+    // Sinon, l'opérande est une case de pile
+    std::string address = frameAddress(os, operand.value);
+    os << "    ldr " << targetReg << ", " << address << "\n";
 }
 
-// void ARM64Backend::gen_gt(std::ostream &os, const std::string &dest, const std::string &src1, const std::string &src2) const {
+std::string ARM64Backend::useOperand(AsmWriter &os, const Operand &operand, const std::string &scratch) const {
+    if (operand.isRegister())
+        return operand.reg;
+    loadOperand(os, operand, scratch);
+    return scratch;
+}
+
+std::string ARM64Backend::defOperand(const Operand &dest) const {
+    return dest.isRegister() ? dest.reg : "w0";
+}
+
+void ARM64Backend::storeResult(AsmWriter &os, const std::string &reg, const Operand &dest) const {
+    if (dest.isRegister())
+        return;
+    std::string address = frameAddress(os, dest.value);
+    os << "    str " << reg << ", " << address << "\n";     // Store result to dest
+}
+
+// void ARM64Backend::gen_gt(AsmWriter &os, const std::string &dest, const std::string &src1, const std::string &src2) const {
 //     os << "    ldr w0, " << src1 << "\n";
 //     os << "    ldr w1, " << src2 << "\n";
 //     os << "    cmp w0, w1\n";
 //     os << "    cset w0, gt\n"; // w0 = 1 si src1 > src2
 //     os << "    str w0, " << dest << "\n";
 // }
-// void ARM64Backend::gen_ge(std::ostream &os, const std::string &dest, const std::string &src1, const std::string &src2) const {
+// void ARM64Backend::gen_ge(AsmWriter &os, const std::string &dest, const std::string &src1, const std::string &src2) const {
 //     os << "    ldr w0, " << src1 << "\n";
 //     os << "    ldr w1, " << src2 << "\n";
 //     os << "    cmp w0, w1\n";
@@ -225,27 +320,49 @@ std::string ARM64Backend::loadOperand(const std::string &operand, const std::str
 //     os << "    str w0, " << dest << "\n";
 // }
 
-void ARM64Backend::gen_comp(std::ostream &os, const std::string &dest,
-                             const std::string &src1, const std::string &src2,
+void ARM64Backend::gen_comp(AsmWriter &os, const Operand &dest,
+                             const Operand &src1, const Operand &src2,
                              const std::string &op) const {
-    os << "    ldr w0, " << src1 << "\n";  // Charger src1 dans w0
-    os << "    ldr w1, " << src2 << "\n";  // Charger src2 dans w1
-    os << "    cmp w0, w1\n";              // Comparaison
-
+    std::string cond;
     if (op == ">")
-        os << "    cset w0, gt\n"; // w0 = 1 si w0 > w1
+        cond = "gt";
     else if (op == "<")
-        os << "    cset w0, lt\n"; // w0 = 1 si w0 < w1
+        cond = "lt";
     else if (op == ">=")
-        os << "    cset w0, ge\n"; // w0 = 1 si w0 >= w1
+        cond = "ge";
     else if (op == "<=")
-        os << "    cset w0, le\n"; // w0 = 1 si w0 <= w1
+        cond = "le";
+    else if (op == "==")
+        cond = "eq";
+    else if (op == "!=")
+        cond = "ne";
     else {
         os << "    ; opérateur de comparaison non supporté: " << op << "\n";
         return;
     }
 
-    os << "    str w0, " << dest << "\n";  // Stocker le résultat dans dest
+    // Immédiat à gauche : opérandes échangés, condition retournée
+    const Operand *lhs = &src1, *rhs = &src2;
+    if (lhs->isImmediate() && !rhs->isImmediate()) {
+        std::swap(lhs, rhs);
+        if (cond == "gt") cond = "lt";
+        else if (cond == "lt") cond = "gt";
+        else if (cond == "ge") cond = "le";
+        else if (cond == "le") cond = "ge";
+    }
+
+    std::string a = useOperand(os, *lhs, "w0");
+    std::string d = defOperand(dest);
+    if (rhs->isImmediate() && isArithImmediate(rhs->value)) {
+        os << "    cmp " << a << ", #" << rhs->value << "\n";
+    } else if (rhs->isImmediate() && rhs->value < 0 && rhs->value >= -4095) {  // cmp a, #-5 -> cmn a, #5
+        os << "    cmn " << a << ", #" << -rhs->value << "\n";
+    } else {
+        std::string b = useOperand(os, *rhs, "w1");
+        os << "    cmp " << a << ", " << b << "\n";          // Comparaison
+    }
+    os << "    cset " << d << ", " << cond << "\n";      // d = 1 si la condition est vraie
+    storeResult(os, d, dest);
 }
 
 std::string makeLocalLabel(const std::string &label) {
@@ -258,20 +375,19 @@ std::string makeLocalLabel(const std::string &label) {
 
 
 // Génère un saut inconditionnel vers le label cible.
-void ARM64Backend::gen_jump(std::ostream &os, const std::string &target) const {
+void ARM64Backend::gen_jump(AsmWriter &os, const std::string &target) const {
     os << "    b " << target << "\n";
 }
 
-void ARM64Backend::gen_branch(std::ostream &os, const std::string &cond, const std::string &label_then, const std::string &label_else) const {
+void ARM64Backend::gen_branch(AsmWriter &os, const Operand &cond, const std::string &label_then, const std::string &label_else) const {
     // On suppose que 'cond' est déjà dans un registre (par exemple, x0).
     // On émet la branche conditionnelle en utilisant les labels locaux.
     os << "    cbz x0, " << label_else << "\n";
     os << "    b " << label_then << "\n";
 }
 
-void ARM64Backend::gen_jump_cond(std::ostream &os, const std::string &cond, const std::string &labelTrue, const std::string &labelFalse) const {
-    os << "    ldr w0, " << cond << "\n";
-    os << "    cbnz w0, " << labelTrue << "\n";
+void ARM64Backend::gen_jump_cond(AsmWriter &os, const Operand &cond, const std::string &labelTrue, const std::string &labelFalse) const {
+    std::string reg = useOperand(os, cond, "w0");
+    os << "    cbnz " << reg << ", " << labelTrue << "\n";
     os << "    b " << labelFalse << "\n";
 }
-
@@ -0,0 +1,228 @@
+#include "AST.h"
+
+#include <any>
+
+#include "generated/ifccBaseVisitor.h"
+
+AST::Children AST::children(NodeId n) const
+{
+    const NodeId *first = childIds.data() + firstChild[n];
+    return Children{first, first + childCounts[n]};
+}
+
+size_t AST::paramCount(NodeId function) const
+{
+    size_t count = 0;
+    for (NodeId c : children(function))
+    {
+        if (kinds[c] != NodeKind::Param)
+            break;
+        count++;
+    }
+    return count;
+}
+
+size_t AST::bytesUsed() const
+{
+    size_t bytes = kinds.capacity() * sizeof(NodeKind) + ops.capacity() + values.capacity() * sizeof(int)
+                   + (firstChild.capacity() + childCounts.capacity() + childIds.capacity() + roots.capacity()) * sizeof(uint32_t);
+    for (const std::string &name : names)
+        bytes += sizeof(std::string) + name.capacity();
+    return bytes;
+}
+
+int AST::intern(const std::string &name)
+{
+    auto it = nameIds.find(name);
+    if (it != nameIds.end())
+        return it->second;
+    int id = names.size();
+    names.push_back(name);
+    nameIds.emplace(name, id);
+    return id;
+}
+
+NodeId AST::add(NodeKind kind, int op, int value, const NodeId *nodeChildren, size_t count)
+{
+    NodeId n = kinds.size();
+    kinds.push_back(kind);
+    ops.push_back((uint8_t)op);
+    values.push_back(value);
+    firstChild.push_back(childIds.size());
+    childCounts.push_back(count);
+    childIds.insert(childIds.end(), nodeChildren, nodeChildren + count);
+    return n;
+}
+
+void AST::clear()
+{
+    kinds.clear();
+    ops.clear();
+    values.clear();
+    firstChild.clear();
+    childCounts.clear();
+    childIds.clear();
+    roots.clear();
+    names.clear();
+    nameIds.clear();
+}
+
+/*---------------------------------------------------
+ * ASTBuilder : parcours unique de l'arbre ifccParser
+ *
+ * Chaque visit renvoie le NodeId du nœud créé ; les enfants sont
+ * créés avant leur parent et empilés dans `pending`, d'où le parent
+ * les recopie d'un bloc dans l'AST (pas de vecteur par nœud).
+ * Les parenthèses et les nœuds inst disparaissent, une déclaration
+ * "int a, b;" devient une suite de Decl.
+ *---------------------------------------------------*/
+class ASTBuilder : public ifccBaseVisitor {
+public:
+    explicit ASTBuilder(AST &ast) : ast(ast) {}
+
+    NodeId node(antlr4::tree::ParseTree *ctx) { return std::any_cast<NodeId>(ctx->accept(this)); }
+
+    antlrcpp::Any visitProg(ifccParser::ProgContext *ctx) override
+    {
+        size_t mark = pending.size();
+        if (ctx->decl_params())
+            for (auto param : ctx->decl_params()->param())
+                pending.push_back(ast.add(NodeKind::Param, 0, ast.intern(param->ID()->getText())));
+        // Les decl nues (ID sans 'int') du corps de la fonction n'ont
+        // jamais été analysées ni générées : seules les inst sont gardées
+        for (auto inst : ctx->inst())
+            lowerInst(inst);
+        bool isVoid = ctx->type()->getText() == "void";
+        return finish(NodeKind::Function, isVoid ? 1 : 0, ast.intern(ctx->ID()->getText()), mark);
+    }
+
+    antlrcpp::Any visitBlock(ifccParser::BlockContext *ctx) override
+    {
+        size_t mark = pending.size();
+        for (auto child : ctx->children)
+        {
+            if (auto decl = dynamic_cast<ifccParser::DeclContext *>(child))
+                pending.push_back(node(decl));
+            else if (auto inst = dynamic_cast<ifccParser::InstContext *>(child))
+                lowerInst(inst);
+        }
+        return finish(NodeKind::Block, 0, 0, mark);
+    }
+
+    antlrcpp::Any visitDecl(ifccParser::DeclContext *ctx) override
+    {
+        int name = ast.intern(ctx->ID()->getText());
+        if (ctx->expr() == nullptr)
+            return ast.add(NodeKind::Decl, 0, name);
+        return unary(NodeKind::Decl, 0, name, ctx->expr());
+    }
+
+    antlrcpp::Any visitAssign(ifccParser::AssignContext *ctx) override { return assign(0, ctx->ID(), ctx->expr()); }
+    antlrcpp::Any visitPlusAssign(ifccParser::PlusAssignContext *ctx) override { return assign(ifccParser::PLUS, ctx->ID(), ctx->expr()); }
+    antlrcpp::Any visitMinusAssign(ifccParser::MinusAssignContext *ctx) override { return assign(ifccParser::MINUS, ctx->ID(), ctx->expr()); }
+    antlrcpp::Any visitMulAssign(ifccParser::MulAssignContext *ctx) override { return assign(ifccParser::MUL, ctx->ID(), ctx->expr()); }
+    antlrcpp::Any visitDivAssign(ifccParser::DivAssignContext *ctx) override { return assign(ifccParser::DIV, ctx->ID(), ctx->expr()); }
+
+    antlrcpp::Any visitReturn_stmt(ifccParser::Return_stmtContext *ctx) override
+    {
+        if (ctx->expr() == nullptr)
+            return ast.add(NodeKind::Return, 0, 0);
+        return unary(NodeKind::Return, 0, 0, ctx->expr());
+    }
+
+    antlrcpp::Any visitIf_stmt(ifccParser::If_stmtContext *ctx) override
+    {
+        size_t mark = pending.size();
+        pending.push_back(node(ctx->expr()));
+        for (auto block : ctx->block())
+            pending.push_back(node(block));
+        return finish(NodeKind::If, 0, 0, mark);
+    }
+
+    antlrcpp::Any visitWhile_stmt(ifccParser::While_stmtContext *ctx) override
+    {
+        size_t mark = pending.size();
+        pending.push_back(node(ctx->expr()));
+        pending.push_back(node(ctx->block()));
+        return finish(NodeKind::While, 0, 0, mark);
+    }
+
+    antlrcpp::Any visitFunction_call(ifccParser::Function_callContext *ctx) override
+    {
+        size_t mark = pending.size();
+        for (auto expr : ctx->expr())
+            pending.push_back(node(expr));
+        return finish(NodeKind::Call, 0, ast.intern(ctx->ID()->getText()), mark);
+    }
+
+    antlrcpp::Any visitMulDivExpr(ifccParser::MulDivExprContext *ctx) override { return binary(NodeKind::Binary, ctx->op->getType(), ctx); }
+    antlrcpp::Any visitAddSubExpr(ifccParser::AddSubExprContext *ctx) override { return binary(NodeKind::Binary, ctx->op->getType(), ctx); }
+    antlrcpp::Any visitCompExpr(ifccParser::CompExprContext *ctx) override { return binary(NodeKind::Binary, ctx->op->getType(), ctx); }
+    antlrcpp::Any visitEgalExpr(ifccParser::EgalExprContext *ctx) override { return binary(NodeKind::Binary, ctx->op->getType(), ctx); }
+    antlrcpp::Any visitEtLogExpr(ifccParser::EtLogExprContext *ctx) override { return binary(NodeKind::Binary, ifccParser::BAND, ctx); }
+    antlrcpp::Any visitOuExcExpr(ifccParser::OuExcExprContext *ctx) override { return binary(NodeKind::Binary, ifccParser::BXOR, ctx); }
+    antlrcpp::Any visitOuIncExpr(ifccParser::OuIncExprContext *ctx) override { return binary(NodeKind::Binary, ifccParser::BOR, ctx); }
+    antlrcpp::Any visitEtParExpr(ifccParser::EtParExprContext *ctx) override { return binary(NodeKind::And, 0, ctx); }
+    antlrcpp::Any visitOuParExpr(ifccParser::OuParExprContext *ctx) override { return binary(NodeKind::Or, 0, ctx); }
+
+    antlrcpp::Any visitMoinsExpr(ifccParser::MoinsExprContext *ctx) override { return unary(NodeKind::Neg, 0, 0, ctx->expr()); }
+    antlrcpp::Any visitNotExpr(ifccParser::NotExprContext *ctx) override { return unary(NodeKind::Not, 0, 0, ctx->expr()); }
+    antlrcpp::Any visitParExpr(ifccParser::ParExprContext *ctx) override { return node(ctx->expr()); }
+    antlrcpp::Any visitFuncCallExpr(ifccParser::FuncCallExprContext *ctx) override { return node(ctx->function_call()); }
+    antlrcpp::Any visitIdExpr(ifccParser::IdExprContext *ctx) override { return ast.add(NodeKind::Var, 0, ast.intern(ctx->ID()->getText())); }
+    antlrcpp::Any visitConstExpr(ifccParser::ConstExprContext *ctx) override { return ast.add(NodeKind::Const, 0, std::stoi(ctx->CONST()->getText())); }
+    antlrcpp::Any visitCharExpr(ifccParser::CharExprContext *ctx) override { return ast.add(NodeKind::Const, 0, (int)ctx->CHAR()->getText()[1]); }
+
+private:
+    AST &ast;
+    std::vector<NodeId> pending;    // enfants déjà créés, pas encore rattachés à leur parent
+
+    // Crée le nœud dont les enfants sont pending[mark..] et les dépile
+    NodeId finish(NodeKind kind, int op, int value, size_t mark)
+    {
+        NodeId n = ast.add(kind, op, value, pending.data() + mark, pending.size() - mark);
+        pending.resize(mark);
+        return n;
+    }
+
+    // Une inst donne un nœud, sauf "int a, b = 1;" qui donne un Decl par variable
+    void lowerInst(ifccParser::InstContext *inst)
+    {
+        if (auto declaration = inst->declaration())
+        {
+            for (auto decl : declaration->decl())
+                pending.push_back(node(decl));
+            return;
+        }
+        pending.push_back(node(inst->children[0]));
+    }
+
+    NodeId unary(NodeKind kind, int op, int value, antlr4::tree::ParseTree *expr)
+    {
+        NodeId operand = node(expr);
+        return ast.add(kind, op, value, &operand, 1);
+    }
+
+    NodeId assign(int op, antlr4::tree::TerminalNode *id, ifccParser::ExprContext *expr)
+    {
+        return unary(NodeKind::Assign, op, ast.intern(id->getText()), expr);
+    }
+
+    // Les alternatives binaires de expr ont toutes deux enfants expr, dans l'ordre
+    template <typename Context>
+    NodeId binary(NodeKind kind, size_t op, Context *ctx)
+    {
+        NodeId operands[2];
+        operands[0] = node(ctx->expr(0));
+        operands[1] = node(ctx->expr(1));
+        return ast.add(kind, op, 0, operands, 2);
+    }
+};
+
+void buildAST(ifccParser::AxiomContext *axiom, AST &ast)
+{
+    ast.clear();
+    ASTBuilder builder(ast);
+    for (auto prog : axiom->prog())
+        ast.addFunction(builder.node(prog));
+}
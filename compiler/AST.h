@@ -0,0 +1,98 @@
+#ifndef AST_H
+#define AST_H
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "generated/ifccParser.h"
+
+/*---------------------------------------------------
+ * AST : arbre syntaxique abstrait compact d'un programme
+ *
+ * Construit une seule fois, depuis l'arbre ifccParser (buildAST,
+ * l'arbre est libéré aussitôt après) ou directement par le parser
+ * de FastFrontend : l'analyse sémantique, la génération de l'IR
+ * et la clé du cache ne lisent que l'AST.
+ *
+ * Un nœud est un indice dans des tableaux contigus (genre,
+ * opérateur, valeur, premier enfant, nombre d'enfants) ; les
+ * enfants d'un nœud sont consécutifs dans `childIds`. Les
+ * identifiants sont internés : une variable ou une fonction est
+ * un entier, son texte n'est lu qu'au besoin (table des symboles,
+ * messages) et jamais recopié depuis les tokens.
+ *---------------------------------------------------*/
+enum class NodeKind : uint8_t {
+    Function,   // value = nom, op = 1 si void ; enfants : Param..., puis instructions du corps
+    Param,      // value = nom
+    Block,      // enfants : instructions (nouveau scope)
+    Decl,       // value = nom ; enfant optionnel : valeur initiale
+    Assign,     // value = nom, op = 0 pour '=', PLUS/MINUS/MUL/DIV pour '+='... ; enfant : expr
+    Return,     // enfant optionnel : expr
+    If,         // enfants : condition, then, else optionnel
+    While,      // enfants : condition, corps
+    Call,       // value = nom de la fonction ; enfants : arguments
+    Binary,     // op = type du token (ifccParser::PLUS...) ; enfants : gauche, droite
+    And,        // && paresseux ; enfants : gauche, droite
+    Or,         // || paresseux ; enfants : gauche, droite
+    Neg,        // - unaire ; enfant : expr
+    Not,        // ! ; enfant : expr
+    Var,        // value = nom
+    Const,      // value = valeur (constante entière ou caractère)
+};
+
+typedef uint32_t NodeId;
+
+class AST {
+public:
+    // Enfants d'un nœud, parcourables par for (NodeId c : ast.children(n))
+    struct Children {
+        const NodeId *first;
+        const NodeId *last;
+        const NodeId *begin() const { return first; }
+        const NodeId *end() const { return last; }
+        size_t size() const { return last - first; }
+        NodeId operator[](size_t i) const { return first[i]; }
+    };
+
+    NodeKind kind(NodeId n) const { return kinds[n]; }
+    int op(NodeId n) const { return ops[n]; }
+    int value(NodeId n) const { return values[n]; }
+    Children children(NodeId n) const;
+    NodeId child(NodeId n, size_t i) const { return childIds[firstChild[n] + i]; }
+    size_t childCount(NodeId n) const { return childCounts[n]; }
+
+    // Nom interné d'un nœud Function, Param, Decl, Assign, Call ou Var
+    const std::string &name(NodeId n) const { return names[values[n]]; }
+
+    // Fonctions du programme, dans l'ordre du source
+    const std::vector<NodeId> &functions() const { return roots; }
+    size_t paramCount(NodeId function) const;
+
+    size_t nodeCount() const { return kinds.size(); }
+    size_t bytesUsed() const;
+
+    // Construction (buildAST)
+    int intern(const std::string &name);
+    NodeId add(NodeKind kind, int op, int value, const NodeId *nodeChildren = nullptr, size_t count = 0);
+    void addFunction(NodeId function) { roots.push_back(function); }
+    void clear();
+
+private:
+    std::vector<NodeKind> kinds;
+    std::vector<uint8_t> ops;
+    std::vector<int> values;
+    std::vector<uint32_t> firstChild;
+    std::vector<uint32_t> childCounts;
+    std::vector<NodeId> childIds;
+    std::vector<NodeId> roots;
+
+    std::vector<std::string> names;                 // identifiant interné -> texte
+    std::unordered_map<std::string, int> nameIds;   // texte -> identifiant interné
+};
+
+// Abaisse l'arbre ifccParser en AST ; l'AST ne référence plus l'arbre ni ses tokens
+void buildAST(ifccParser::AxiomContext *axiom, AST &ast);
+
+#endif
@@ -0,0 +1,43 @@
+#include "Arena.h"
+#include <cstdint>
+#include <cstdlib>
+
+bool Arena::perObjectNew = false;
+
+Arena::~Arena()
+{
+    // Destruction dans l'ordre inverse de construction
+    for (auto it = dtors.rbegin(); it != dtors.rend(); ++it)
+        it->second(it->first);
+    for (char *chunk : chunks)
+        std::free(chunk);
+    for (void *p : separate)
+        ::operator delete(p);
+}
+
+void *Arena::allocate(size_t size, size_t align)
+{
+    if (perObjectNew)
+    {
+        void *p = ::operator new(size);
+        separate.push_back(p);
+        return p;
+    }
+    size_t pad = (align - reinterpret_cast<uintptr_t>(cur) % align) % align;
+    if (cur == nullptr || pad + size > left)
+    {
+        // Nouveau bloc ; un objet plus gros que CHUNK_SIZE a son propre bloc
+        size_t chunkSize = size + align > CHUNK_SIZE ? size + align : CHUNK_SIZE;
+        cur = static_cast<char *>(std::malloc(chunkSize));
+        if (cur == nullptr)
+            throw std::bad_alloc();
+        chunks.push_back(cur);
+        left = chunkSize;
+        pad = (align - reinterpret_cast<uintptr_t>(cur) % align) % align;
+    }
+    void *p = cur + pad;
+    cur += pad + size;
+    left -= pad + size;
+    used += size;
+    return p;
+}
@@ -0,0 +1,58 @@
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/*---------------------------------------------------
+ * Arena : allocateur par régions pour une fonction
+ *
+ * Les objets (BasicBlock, IRInstr, Scope) sont placés les uns
+ * après les autres dans de grands blocs mémoire. Rien n'est
+ * libéré individuellement : le destructeur de l'arène appelle
+ * les destructeurs des objets puis rend tous les blocs d'un coup.
+ *---------------------------------------------------*/
+class Arena {
+public:
+    Arena() = default;
+    Arena(const Arena &) = delete;
+    Arena &operator=(const Arena &) = delete;
+    ~Arena();
+
+    template <typename T, typename... Args>
+    T *make(Args &&...args)
+    {
+        T *obj = new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+        if (!std::is_trivially_destructible<T>::value)
+            dtors.push_back({obj, [](void *p) { static_cast<T *>(p)->~T(); }});
+        objects++;
+        return obj;
+    }
+
+    void *allocate(size_t size, size_t align);
+
+    // Référence du benchmark d'allocation (bench/AllocBench.cpp) : chaque
+    // objet reçoit son propre operator new, comme avant l'arène
+    static bool perObjectNew;
+
+    // Statistiques (benchmark d'allocation)
+    size_t objectCount() const { return objects; }
+    size_t chunkCount() const { return chunks.size(); }
+    size_t bytesUsed() const { return used; }
+
+private:
+    static const size_t CHUNK_SIZE = 64 * 1024;
+
+    std::vector<char *> chunks;
+    char *cur = nullptr;
+    size_t left = 0;
+    size_t objects = 0;
+    size_t used = 0;
+    std::vector<std::pair<void *, void (*)(void *)>> dtors;
+    std::vector<void *> separate;   // objets alloués un par un (perObjectNew)
+};
+
+#endif
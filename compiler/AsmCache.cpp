@@ -0,0 +1,174 @@
+#include "AsmCache.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+#include "Log.h"
+
+namespace fs = std::filesystem;
+
+/*--- CacheKey ---*/
+
+void CacheKey::mix(const void *data, size_t size)
+{
+    const unsigned char *bytes = static_cast<const unsigned char *>(data);
+    for (size_t i = 0; i < size; i++)
+    {
+        hash ^= bytes[i];
+        hash *= 0x100000001b3ULL;
+    }
+}
+
+void CacheKey::add(const std::string &s)
+{
+    mix(s.data(), s.size());
+    mix("\0", 1);
+}
+
+void CacheKey::add(long long n)
+{
+    mix(&n, sizeof(n));
+    mix("\0", 1);
+}
+
+std::string CacheKey::hex() const
+{
+    char buf[17];
+    std::snprintf(buf, sizeof(buf), "%016llx", (unsigned long long)hash);
+    return buf;
+}
+
+/*--- AsmCache ---*/
+
+AsmCache::AsmCache(const std::string &directory, uint64_t maxBytes)
+    : directory(directory), maxBytes(maxBytes)
+{
+    std::error_code ec;
+    fs::create_directories(directory, ec);
+    for (const auto &entry : fs::directory_iterator(directory, ec))
+        if (entry.is_regular_file(ec) && entry.path().extension() == ".s")
+            totalBytes += entry.file_size(ec);
+}
+
+std::string AsmCache::pathOf(const CacheKey &key) const
+{
+    return (fs::path(directory) / (key.hex() + ".s")).string();
+}
+
+bool AsmCache::lookup(const CacheKey &key, CacheEntry &entry)
+{
+    std::string path = pathOf(key);
+    std::ifstream in(path, std::ios::binary);
+    std::string text;
+    if (in.good())
+    {
+        std::stringstream content;
+        content << in.rdbuf();
+        text = content.str();
+    }
+    // Entrée absente ou tronquée (autre format) : compte comme un échec
+    size_t header = text.find('\n');
+    size_t size = header == std::string::npos ? 0 : std::strtoull(text.c_str(), nullptr, 10);
+    if (header == std::string::npos || size > text.size() - header - 1)
+    {
+        misses++;
+        return false;
+    }
+    entry.diagnostics = text.substr(header + 1, size);
+    entry.asmText = text.substr(header + 1 + size);
+
+    // Horodatage LRU : l'entrée redevient la plus récente
+    std::error_code ec;
+    fs::last_write_time(path, fs::file_time_type::clock::now(), ec);
+    hits++;
+    LOG_DEBUG("cache hit " << key.hex());
+    return true;
+}
+
+void AsmCache::store(const CacheKey &key, const CacheEntry &entry)
+{
+    // Écriture dans un fichier temporaire puis renommage : un autre processus
+    // ne lit jamais une entrée à moitié écrite. Le nom du temporaire est
+    // propre au processus et au thread qui écrit
+    std::string path = pathOf(key);
+    std::ostringstream tmp;
+    tmp << path << ".tmp." << getpid() << "." << std::this_thread::get_id();
+    std::string header = std::to_string(entry.diagnostics.size()) + "\n";
+    {
+        std::ofstream out(tmp.str(), std::ios::binary);
+        out << header << entry.diagnostics << entry.asmText;
+        if (!out.good())
+            return;
+    }
+    uint64_t written = header.size() + entry.diagnostics.size() + entry.asmText.size();
+
+    // Une entrée remplacée (même clé) sort du total
+    std::lock_guard<std::mutex> lock(mutex);
+    std::error_code ec;
+    uint64_t replaced = fs::file_size(path, ec);
+    if (ec)
+        replaced = 0;
+    fs::rename(tmp.str(), path, ec);
+    if (ec)
+    {
+        fs::remove(tmp.str(), ec);
+        return;
+    }
+    stores++;
+
+    totalBytes += written;
+    totalBytes -= std::min(replaced, totalBytes);
+    if (totalBytes > maxBytes)
+        evict();
+}
+
+// Supprime les entrées les moins récemment utilisées jusqu'à repasser sous maxBytes.
+// Appelée sous le mutex ; recompte la taille depuis le disque (autres processus).
+void AsmCache::evict()
+{
+    struct Entry {
+        fs::path path;
+        fs::file_time_type time;
+        uint64_t size;
+    };
+    std::vector<Entry> entries;
+    std::error_code ec;
+    totalBytes = 0;
+    for (const auto &entry : fs::directory_iterator(directory, ec))
+    {
+        if (!entry.is_regular_file(ec) || entry.path().extension() != ".s")
+            continue;
+        Entry e{entry.path(), entry.last_write_time(ec), entry.file_size(ec)};
+        totalBytes += e.size;
+        entries.push_back(e);
+    }
+    std::sort(entries.begin(), entries.end(),
+              [](const Entry &a, const Entry &b) { return a.time < b.time; });
+
+    for (const Entry &e : entries)
+    {
+        if (totalBytes <= maxBytes)
+            break;
+        if (fs::remove(e.path, ec))
+        {
+            totalBytes -= e.size;
+            evictions++;
+        }
+    }
+}
+
+std::string AsmCache::report() const
+{
+    std::ostringstream out;
+    out << "cache: " << hits << " hits, " << misses << " misses, "
+        << stores << " stores, " << evictions << " evictions";
+    return out.str();
+}
@@ -0,0 +1,72 @@
+#ifndef ASMCACHE_H
+#define ASMCACHE_H
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+/*---------------------------------------------------
+ * CacheKey : empreinte FNV-1a 64 bits des entrées d'une fonction
+ * (tokens, signatures appelées, backend, options).
+ * Chaque champ est suivi d'un séparateur pour que "ab","c"
+ * et "a","bc" donnent des clés différentes.
+ *---------------------------------------------------*/
+class CacheKey {
+public:
+    void add(const std::string &s);
+    void add(long long n);
+    uint64_t value() const { return hash; }
+    std::string hex() const;
+
+private:
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    void mix(const void *data, size_t size);
+};
+
+// Entrée du cache : assembleur d'une fonction compilée sans erreur et
+// avertissements émis pendant sa compilation, réaffichés à chaque succès
+struct CacheEntry {
+    std::string diagnostics;
+    std::string asmText;
+};
+
+/*---------------------------------------------------
+ * AsmCache : cache sur disque de l'assembleur par fonction
+ *
+ * Une entrée est un fichier <clé>.s dans le répertoire du cache :
+ * taille des diagnostics sur la première ligne, diagnostics, puis
+ * assembleur.
+ * La date de modification sert d'horodatage LRU : elle est mise à
+ * jour à chaque succès, et les entrées les plus anciennes sont
+ * supprimées quand la taille totale dépasse maxBytes.
+ * Utilisable depuis plusieurs threads (-j, mode serveur).
+ *---------------------------------------------------*/
+class AsmCache {
+public:
+    AsmCache(const std::string &directory, uint64_t maxBytes);
+
+    // true et l'entrée dans entry si la clé est présente
+    bool lookup(const CacheKey &key, CacheEntry &entry);
+    void store(const CacheKey &key, const CacheEntry &entry);
+
+    // Compteurs, sous la forme "cache: N hits, N misses, ..."
+    std::string report() const;
+
+private:
+    std::string directory;
+    uint64_t maxBytes;
+
+    std::mutex mutex;           // protège totalBytes et l'éviction
+    uint64_t totalBytes = 0;
+
+    std::atomic<long> hits{0};
+    std::atomic<long> misses{0};
+    std::atomic<long> stores{0};
+    std::atomic<long> evictions{0};
+
+    std::string pathOf(const CacheKey &key) const;
+    void evict();
+};
+
+#endif
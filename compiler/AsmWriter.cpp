@@ -0,0 +1,9 @@
+#include "AsmWriter.h"
+
+void AsmWriter::flush()
+{
+    if (sink == nullptr || buf.empty())
+        return;
+    sink->write(buf.data(), buf.size());
+    buf.clear();
+}
@@ -0,0 +1,71 @@
+#ifndef ASMWRITER_H
+#define ASMWRITER_H
+
+#include <charconv>
+#include <cstring>
+#include <ostream>
+#include <string>
+
+/*---------------------------------------------------
+ * AsmWriter : tampon de sortie pour l'assembleur
+ *
+ * Les backends écrivent beaucoup de petits morceaux ; ils sont
+ * accumulés dans un grand tampon contigu, et les entiers sont
+ * formatés avec std::to_chars (pas de locale, pas d'allocation).
+ *
+ * - AsmWriter(sink) : le tampon est écrit d'un bloc dans sink
+ *   quand il est plein et à la destruction (ou par flush()).
+ * - AsmWriter()     : tampon en mémoire, lu par str() (mode -j, cache).
+ *---------------------------------------------------*/
+class AsmWriter {
+public:
+    static const size_t CAPACITY = 1 << 16;
+
+    AsmWriter() : sink(nullptr) {}
+    explicit AsmWriter(std::ostream &sink) : sink(&sink) { buf.reserve(CAPACITY); }
+    AsmWriter(const AsmWriter &) = delete;
+    AsmWriter &operator=(const AsmWriter &) = delete;
+    ~AsmWriter() { flush(); }
+
+    AsmWriter &operator<<(const std::string &s) { append(s.data(), s.size()); return *this; }
+    AsmWriter &operator<<(const char *s) { append(s, std::strlen(s)); return *this; }
+    AsmWriter &operator<<(char c) { append(&c, 1); return *this; }
+    AsmWriter &operator<<(int n) { return integer(n); }
+    AsmWriter &operator<<(long n) { return integer(n); }
+    AsmWriter &operator<<(long long n) { return integer(n); }
+
+    // Écrit le tampon dans le sink (sans effet en mode mémoire)
+    void flush();
+
+    // Contenu du tampon en mode mémoire
+    const std::string &str() const { return buf; }
+
+private:
+    std::string buf;
+    std::ostream *sink;
+
+    void append(const char *data, size_t size)
+    {
+        if (sink != nullptr && buf.size() + size > CAPACITY)
+        {
+            flush();
+            if (size > CAPACITY)
+            {
+                sink->write(data, size);
+                return;
+            }
+        }
+        buf.append(data, size);
+    }
+
+    template <typename T>
+    AsmWriter &integer(T n)
+    {
+        char digits[24];
+        auto res = std::to_chars(digits, digits + sizeof(digits), n);
+        append(digits, res.ptr - digits);
+        return *this;
+    }
+};
+
+#endif
@@ -1,12 +1,13 @@
+#include "BackendInitializr.h"
 #include "ARM64Backend.h"
 #include "X86Backend.h"
 
-// Définition du pointeur global en tant que const CodeGenBackend*
-const CodeGenBackend* codegenBackend = nullptr;
-
-static X86Backend backendInstance;
-
-__attribute__((constructor))
-static void initBackend() {
-    codegenBackend = &backendInstance;
+// Chaque compilation possède son propre backend (voir CompilationContext)
+std::unique_ptr<CodeGenBackend> createBackend(const std::string &target)
+{
+    if (target == "x86")
+        return std::make_unique<X86Backend>();
+    if (target == "arm64")
+        return std::make_unique<ARM64Backend>();
+    return nullptr;
 }
@@ -0,0 +1,11 @@
+#ifndef BACKENDINITIALIZR_H
+#define BACKENDINITIALIZR_H
+
+#include <memory>
+#include <string>
+#include "CodeGenBackend.h"
+
+// Crée le backend de la cible demandée ("x86" ou "arm64"), nullptr si inconnue
+std::unique_ptr<CodeGenBackend> createBackend(const std::string &target);
+
+#endif
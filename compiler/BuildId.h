@@ -0,0 +1,12 @@
+#ifndef BUILDID_H
+#define BUILDID_H
+
+/*---------------------------------------------------
+ * Identifiant de la build d'ifcc : empreinte (cksum) de toutes
+ * les sources du compilateur, écrite dans build/BuildId.cpp par
+ * le Makefile. Il entre dans la clé du cache d'assembleur : une
+ * autre version d'ifcc ne relit jamais les entrées de celle-ci.
+ *---------------------------------------------------*/
+extern const char *const ifccBuildId;
+
+#endif
@@ -1,8 +1,48 @@
 #ifndef CODEGENBACKEND_H
 #define CODEGENBACKEND_H
 
+#include "AsmWriter.h"
 #include <ostream>
 #include <string>
+#include <vector>
+
+/**
+ * Opérande d'une instruction tel que le CFG le transmet au backend
+ * (cf. CFG::operand) : registre physique, case de pile repérée par son
+ * offset relatif au frame pointer, ou immédiat. Le backend choisit la
+ * forme de l'instruction sur le genre et n'analyse jamais de texte.
+ */
+struct Operand {
+    enum Kind { Register, Stack, Immediate };
+
+    Kind kind;
+    std::string reg;    // nom du registre ("%ebx", "w19"), pour Register
+    int value;          // offset (Stack) ou valeur (Immediate)
+
+    static Operand registerOf(const std::string &name) { return Operand{Register, name, 0}; }
+    static Operand stack(int offset) { return Operand{Stack, std::string(), offset}; }
+    static Operand immediate(int value) { return Operand{Immediate, std::string(), value}; }
+
+    bool isRegister() const { return kind == Register; }
+    bool isStack() const { return kind == Stack; }
+    bool isImmediate() const { return kind == Immediate; }
+
+    bool operator==(const Operand &other) const
+    {
+        return kind == other.kind && (kind == Register ? reg == other.reg : value == other.value);
+    }
+    bool operator!=(const Operand &other) const { return !(*this == other); }
+};
+
+// Pour les traces : "w19", "[fp-8]", "#5"
+inline std::ostream &operator<<(std::ostream &os, const Operand &op)
+{
+    if (op.isRegister())
+        return os << op.reg;
+    if (op.isStack())
+        return os << "[fp" << (op.value < 0 ? "" : "+") << op.value << "]";
+    return os << "#" << op.value;
+}
 
 /**
  * Interface abstraite pour la génération d'assembleur spécifique à une architecture.
@@ -13,27 +53,38 @@ public:
     virtual ~CodeGenBackend() {}
 
 
-    virtual void gen_prologue(std::ostream &os, std::string &name, int stackSize) const = 0;
-    virtual void gen_epilogue(std::ostream &os) const = 0;
-    virtual void gen_return(std::ostream &os, const std::string &src) const = 0;
-    virtual void gen_mov(std::ostream &os, const std::string &dest, const std::string &src) const = 0;
-    virtual void gen_copy(std::ostream &os, const std::string &dest, const std::string &src) const = 0;
-    virtual void gen_add(std::ostream &os, const std::string &dest, const std::string &src1, const std::string &src2) const = 0;
-    virtual void gen_sub(std::ostream &os, const std::string &dest, const std::string &src1, const std::string &src2) const = 0;
-    virtual void gen_mul(std::ostream &os, const std::string &dest, const std::string &src1, const std::string &src2) const = 0;
-    virtual void gen_div(std::ostream &os, const std::string &dest, const std::string &src1, const std::string &src2) const = 0;
-    virtual void gen_mod(std::ostream &os, const std::string &dest, const std::string &src1, const std::string &src2) const = 0;
-    virtual void gen_call(std::ostream &os, const std::string &func) const = 0;
-    virtual void gen_or(std::ostream &os, const std::string &dest, const std::string &src1, const std::string &src2) const = 0;
-    virtual void gen_xor(std::ostream &os, const std::string &dest, const std::string &src1, const std::string &src2) const = 0;
-    virtual void gen_not(std::ostream &os, const std::string &dest, const std::string &src) const = 0;
-    virtual void gen_egal(std::ostream &os, const std::string &dest, const std::string &src1, const std::string &src2) const = 0;
-    virtual void gen_notegal(std::ostream &os, const std::string &dest, const std::string &src1, const std::string &src2) const = 0;
-    virtual void gen_and(std::ostream &os, const std::string &dest, const std::string &src1, const std::string &src2) const = 0;
-    virtual void gen_branch(std::ostream &os, const std::string &cond, const std::string &thenLabel, const std::string &elseLabel) const = 0;
-    virtual void gen_comp(std::ostream &os, const std::string &dest, const std::string &src1, const std::string &src2, const std::string &op) const = 0;
+    virtual void gen_prologue(AsmWriter &os, std::string &name, int stackSize) const = 0;
+    virtual void gen_epilogue(AsmWriter &os) const = 0;
+    virtual void gen_return(AsmWriter &os, const Operand &src) const = 0;
+    virtual void gen_mov(AsmWriter &os, const Operand &dest, const Operand &src) const = 0;
+    virtual void gen_copy(AsmWriter &os, const Operand &dest, const Operand &src) const = 0;
+    virtual void gen_add(AsmWriter &os, const Operand &dest, const Operand &src1, const Operand &src2) const = 0;
+    virtual void gen_sub(AsmWriter &os, const Operand &dest, const Operand &src1, const Operand &src2) const = 0;
+    virtual void gen_mul(AsmWriter &os, const Operand &dest, const Operand &src1, const Operand &src2) const = 0;
+    virtual void gen_div(AsmWriter &os, const Operand &dest, const Operand &src1, const Operand &src2) const = 0;
+    virtual void gen_mod(AsmWriter &os, const Operand &dest, const Operand &src1, const Operand &src2) const = 0;
+    virtual void gen_call(AsmWriter &os, const std::string &func) const = 0;
+    virtual void gen_or(AsmWriter &os, const Operand &dest, const Operand &src1, const Operand &src2) const = 0;
+    virtual void gen_xor(AsmWriter &os, const Operand &dest, const Operand &src1, const Operand &src2) const = 0;
+    virtual void gen_not(AsmWriter &os, const Operand &dest, const Operand &src) const = 0;
+    virtual void gen_egal(AsmWriter &os, const Operand &dest, const Operand &src1, const Operand &src2) const = 0;
+    virtual void gen_notegal(AsmWriter &os, const Operand &dest, const Operand &src1, const Operand &src2) const = 0;
+    virtual void gen_and(AsmWriter &os, const Operand &dest, const Operand &src1, const Operand &src2) const = 0;
+    virtual void gen_branch(AsmWriter &os, const Operand &cond, const std::string &thenLabel, const std::string &elseLabel) const = 0;
+    virtual void gen_jump(AsmWriter &os, const std::string &target) const = 0;
+    virtual void gen_jump_cond(AsmWriter &os, const Operand &cond, const std::string &labelTrue, const std::string &labelFalse) const = 0;
+    virtual void gen_comp(AsmWriter &os, const Operand &dest, const Operand &src1, const Operand &src2, const std::string &op) const = 0;
+
+    // Sauvegarde / restauration d'un registre callee-saved dans la pile (offset relatif au frame pointer)
+    virtual void gen_save_reg(AsmWriter &os, const std::string &reg, int offset) const = 0;
+    virtual void gen_restore_reg(AsmWriter &os, const std::string &reg, int offset) const = 0;
+
+    // Registres disponibles pour l'allocateur de registres
+    virtual std::vector<std::string> getCalleeSavedRegisters() const = 0;
+    virtual std::vector<std::string> getCallerSavedRegisters() const = 0;
 
     virtual std::string getTempPrefix() const = 0;
+
     virtual std::string getArchitecture() const = 0;    
 };
 
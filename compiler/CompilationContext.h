@@ -0,0 +1,30 @@
+#ifndef COMPILATIONCONTEXT_H
+#define COMPILATIONCONTEXT_H
+
+#include <map>
+#include <memory>
+#include <ostream>
+#include <string>
+#include "CodeGenBackend.h"
+#include "SymbolTableVisitor.h"
+
+class AsmCache;
+
+/*---------------------------------------------------
+ * CompilationContext : état partagé d'une compilation
+ *
+ * Le backend, le niveau d'optimisation et la table des fonctions
+ * sont construits une fois, avant la génération, puis seulement
+ * lus par chaque fonction (éventuellement depuis plusieurs
+ * threads avec -j).
+ *---------------------------------------------------*/
+struct CompilationContext {
+    std::unique_ptr<CodeGenBackend> backend;
+    std::string target;                                       // nom du backend ("x86", "arm64")
+    int optLevel = 0;
+    std::map<std::string, FunctionSignature> functionTable;   // signatures de toutes les fonctions
+    AsmCache *cache = nullptr;                                // cache d'assembleur par fonction (optionnel)
+    std::ostream *diagnostics = nullptr;                      // [WARNING] / [ERROR] des fonctions
+};
+
+#endif
@@ -0,0 +1,19 @@
+#ifndef COMPILEERROR_H
+#define COMPILEERROR_H
+
+#include <stdexcept>
+#include <string>
+
+/*---------------------------------------------------
+ * CompileError : erreur fatale pendant la compilation
+ *
+ * Levée à la place d'un exit(1) pour que le mode batch et le
+ * serveur puissent continuer avec le fichier ou la requête
+ * suivante. main.cpp l'affiche sous la forme "[ERROR] message".
+ *---------------------------------------------------*/
+class CompileError : public std::runtime_error {
+public:
+    explicit CompileError(const std::string &message) : std::runtime_error(message) {}
+};
+
+#endif
@@ -0,0 +1,329 @@
+#include "ConstantPropagation.h"
+
+#include <algorithm>
+#include <climits>
+
+#include "DominatorTree.h"
+#include "IR.h"
+#include "IRInstr.h"
+
+// Arête vers le bloc d'entrée, qui n'a pas de prédécesseur
+static const int ENTRY = -1;
+
+ConstantPropagation::ConstantPropagation(CFG &cfg) : cfg(cfg) {}
+
+void ConstantPropagation::run()
+{
+    const std::vector<BasicBlock *> &bbs = cfg.get_bbs();
+    if (bbs.empty())
+        return;
+    for (size_t i = 0; i < bbs.size(); i++)
+        blockId[bbs[i]] = (int)i;
+
+    collectUses();
+    propagate();
+    rewrite();
+    removeUnusedConstants();
+}
+
+void ConstantPropagation::collectUses()
+{
+    const VRegTable &vregs = cfg.get_stv().vregs;
+    size_t vregCount = vregs.size();
+    values.assign(vregCount, Value{});
+    uses.assign(vregCount, {});
+    testedBy.assign(vregCount, {});
+    for (int id = 0; id < vregs.size(); id++)
+    {
+        if (!vregs.isImmediate(id))
+            continue;
+        values[id].state = Value::Constant;
+        values[id].constant = vregs.immediateValue(id);
+    }
+
+    const std::vector<BasicBlock *> &bbs = cfg.get_bbs();
+    for (size_t b = 0; b < bbs.size(); b++)
+    {
+        for (IRInstr *instr : bbs[b]->instrs)
+            for (int use : instr->getUses())
+                uses[use].push_back(Use{instr, (int)b});
+        if (bbs[b]->test_var != VRegTable::NONE)
+            testedBy[bbs[b]->test_var].push_back((int)b);
+    }
+}
+
+bool ConstantPropagation::isExecutable(int from, int to) const
+{
+    return executable.count(std::make_pair(from, to)) != 0;
+}
+
+// Les valeurs ne font que descendre (indéterminée, constante, variable) :
+// chaque registre repasse au plus deux fois dans la liste de travail
+void ConstantPropagation::setValue(int vreg, Value value)
+{
+    Value &old = values[vreg];
+    if (old.state == value.state && (value.state != Value::Constant || old.constant == value.constant))
+        return;
+    old = value;
+    ssaWork.push_back(vreg);
+}
+
+void ConstantPropagation::propagate()
+{
+    const std::vector<BasicBlock *> &bbs = cfg.get_bbs();
+    visited.assign(bbs.size(), 0);
+    flowWork.emplace_back(ENTRY, 0);
+
+    while (!flowWork.empty() || !ssaWork.empty())
+    {
+        if (!flowWork.empty())
+        {
+            std::pair<int, int> edge = flowWork.back();
+            flowWork.pop_back();
+            if (!executable.insert(edge).second)
+                continue;
+
+            int b = edge.second;
+            // Les phi tiennent compte de la nouvelle arête ; le reste du bloc
+            // n'est évalué qu'à la première arrivée
+            for (IRInstr *instr : bbs[b]->instrs)
+                if (instr->opcode() == IROpcode::Phi)
+                    visitPhi(instr, b);
+            if (visited[b])
+                continue;
+            visited[b] = 1;
+            for (IRInstr *instr : bbs[b]->instrs)
+                if (instr->opcode() != IROpcode::Phi)
+                    visitInstr(instr);
+            visitExits(b);
+            continue;
+        }
+
+        int vreg = ssaWork.back();
+        ssaWork.pop_back();
+        for (const Use &use : uses[vreg])
+        {
+            if (!visited[use.block])
+                continue;
+            if (use.instr->opcode() == IROpcode::Phi)
+                visitPhi(use.instr, use.block);
+            else
+                visitInstr(use.instr);
+        }
+        for (int b : testedBy[vreg])
+            if (visited[b])
+                visitExits(b);
+    }
+}
+
+// Rencontre des sources arrivant par une arête exécutable
+void ConstantPropagation::visitPhi(IRInstr *instr, int block)
+{
+    IRPhi *phi = static_cast<IRPhi *>(instr);
+    Value result;
+    for (size_t i = 0; i < phi->getPreds().size(); i++)
+    {
+        if (!isExecutable(blockId[phi->getPreds()[i]], block))
+            continue;
+        const Value &source = values[phi->getSource(i)];
+        if (source.state == Value::Undefined)
+            continue;
+        if (source.state == Value::Varying
+            || (result.state == Value::Constant && result.constant != source.constant))
+        {
+            result.state = Value::Varying;
+            break;
+        }
+        result = source;
+    }
+    setValue(phi->getParams()[0], result);
+}
+
+void ConstantPropagation::visitInstr(IRInstr *instr)
+{
+    for (int def : instr->getDefs())
+        setValue(def, evaluate(instr));
+}
+
+void ConstantPropagation::visitExits(int block)
+{
+    BasicBlock *bb = cfg.get_bbs()[block];
+    if (bb->exit_true != nullptr && bb->exit_false != nullptr && bb->exit_true != bb->exit_false)
+    {
+        const Value &test = values[bb->test_var];
+        if (test.state == Value::Undefined)
+            return;
+        if (test.state == Value::Constant)
+        {
+            flowWork.emplace_back(block, blockId[test.constant != 0 ? bb->exit_true : bb->exit_false]);
+            return;
+        }
+    }
+    for (BasicBlock *succ : DominatorTree::successors(bb))
+        flowWork.emplace_back(block, blockId[succ]);
+}
+
+// Arithmétique 32 bits modulo 2^32, comme addl / subl / imull
+static int wrap(long long value)
+{
+    return (int)(unsigned)value;
+}
+
+ConstantPropagation::Value ConstantPropagation::evaluate(const IRInstr *instr) const
+{
+    Value result;
+    const std::vector<int> &p = instr->getParams();
+    switch (instr->opcode())
+    {
+    case IROpcode::LdConst:
+        result.state = Value::Constant;
+        result.constant = static_cast<const IRLdConst *>(instr)->getValue();
+        return result;
+    case IROpcode::Copy:
+        return values[p[1]];
+    case IROpcode::Not:
+        if (values[p[1]].state != Value::Constant)
+            return values[p[1]];
+        result.state = Value::Constant;
+        result.constant = values[p[1]].constant == 0;
+        return result;
+    case IROpcode::Add: case IROpcode::Sub: case IROpcode::Mul:
+    case IROpcode::Div: case IROpcode::Mod:
+    case IROpcode::And: case IROpcode::Or: case IROpcode::Xor:
+    case IROpcode::Egal: case IROpcode::NotEgal: case IROpcode::Comp:
+    case IROpcode::AndPar: case IROpcode::OrPar:
+        break;
+    default:
+        // Appel, getchar, paramètre : valeur connue seulement à l'exécution
+        result.state = Value::Varying;
+        return result;
+    }
+
+    const Value &left = values[p[1]], &right = values[p[2]];
+    if (left.state == Value::Varying || right.state == Value::Varying)
+    {
+        result.state = Value::Varying;
+        return result;
+    }
+    if (left.state == Value::Undefined || right.state == Value::Undefined)
+        return result;
+
+    int a = left.constant, b = right.constant;
+    result.state = Value::Constant;
+    switch (instr->opcode())
+    {
+    case IROpcode::Add:     result.constant = wrap((long long)a + b); break;
+    case IROpcode::Sub:     result.constant = wrap((long long)a - b); break;
+    case IROpcode::Mul:     result.constant = wrap((long long)a * b); break;
+    case IROpcode::Div:
+    case IROpcode::Mod:
+        // Laissée à l'exécution : le programme doit faillir au même endroit
+        if (b == 0 || (a == INT_MIN && b == -1))
+            result.state = Value::Varying;
+        else
+            result.constant = instr->opcode() == IROpcode::Div ? a / b : a % b;
+        break;
+    case IROpcode::And:     result.constant = a & b; break;
+    case IROpcode::Or:      result.constant = a | b; break;
+    case IROpcode::Xor:     result.constant = a ^ b; break;
+    case IROpcode::Egal:    result.constant = a == b; break;
+    case IROpcode::NotEgal: result.constant = a != b; break;
+    case IROpcode::AndPar:  result.constant = a != 0 && b != 0; break;
+    case IROpcode::OrPar:   result.constant = a != 0 || b != 0; break;
+    case IROpcode::Comp:
+    {
+        const std::string &op = static_cast<const IRComp *>(instr)->getOp();
+        if (op == "<")
+            result.constant = a < b;
+        else if (op == ">")
+            result.constant = a > b;
+        else if (op == "<=")
+            result.constant = a <= b;
+        else
+            result.constant = a >= b;
+        break;
+    }
+    default:
+        break;
+    }
+    return result;
+}
+
+void ConstantPropagation::rewrite()
+{
+    const std::vector<BasicBlock *> &bbs = cfg.get_bbs();
+    for (size_t b = 0; b < bbs.size(); b++)
+    {
+        if (!visited[b])
+            continue;
+        BasicBlock *bb = bbs[b];
+
+        // Phi constants remplacés par des IRLdConst placés après les phi restants ;
+        // ailleurs, un registre constant lu devient un opérande immédiat
+        std::vector<IRInstr *> phis, constants, rest;
+        for (IRInstr *instr : bb->instrs)
+        {
+            std::vector<int> defs = instr->getDefs();
+            bool folded = defs.size() == 1 && !instr->isCall()
+                          && instr->opcode() != IROpcode::LdConst
+                          && values[defs[0]].state == Value::Constant;
+            IRInstr *replacement = instr;
+            if (folded)
+                replacement = cfg.new_instr<IRLdConst>(bb, defs[0], values[defs[0]].constant);
+            else
+                for (int use : instr->getUses())
+                    if (values[use].state == Value::Constant)
+                        instr->replaceUse(use, cfg.immediate(values[use].constant));
+            if (instr->opcode() == IROpcode::Phi)
+                (folded ? constants : phis).push_back(replacement);
+            else
+                rest.push_back(replacement);
+        }
+        bb->instrs = phis;
+        bb->instrs.insert(bb->instrs.end(), constants.begin(), constants.end());
+        bb->instrs.insert(bb->instrs.end(), rest.begin(), rest.end());
+
+        // Saut conditionnel sur une constante : seule l'arête exécutable reste
+        if (bb->exit_true == nullptr || bb->exit_false == nullptr || bb->exit_true == bb->exit_false)
+            continue;
+        const Value &test = values[bb->test_var];
+        if (test.state != Value::Constant)
+            continue;
+        BasicBlock *taken = test.constant != 0 ? bb->exit_true : bb->exit_false;
+        BasicBlock *dropped = test.constant != 0 ? bb->exit_false : bb->exit_true;
+        bb->exit_true = taken;
+        bb->exit_false = nullptr;
+        bb->test_var = VRegTable::NONE;
+        for (IRInstr *instr : dropped->instrs)
+        {
+            if (instr->opcode() != IROpcode::Phi)
+                break;
+            IRPhi *phi = static_cast<IRPhi *>(instr);
+            for (size_t i = phi->getPreds().size(); i-- > 0;)
+                if (phi->getPreds()[i] == bb)
+                    phi->removeIncoming(i);
+        }
+    }
+}
+
+// Les opérandes repliés ne sont plus lus : leurs IRLdConst disparaissent
+void ConstantPropagation::removeUnusedConstants()
+{
+    std::vector<int> useCount(cfg.get_stv().vregs.size(), 0);
+    for (BasicBlock *bb : cfg.get_bbs())
+    {
+        for (IRInstr *instr : bb->instrs)
+            for (int use : instr->getUses())
+                useCount[use]++;
+        if (bb->test_var != VRegTable::NONE)
+            useCount[bb->test_var]++;
+    }
+
+    for (BasicBlock *bb : cfg.get_bbs())
+    {
+        auto unused = [&](IRInstr *instr) {
+            return instr->opcode() == IROpcode::LdConst && useCount[instr->getParams()[0]] == 0;
+        };
+        bb->instrs.erase(std::remove_if(bb->instrs.begin(), bb->instrs.end(), unused), bb->instrs.end());
+    }
+}
@@ -0,0 +1,70 @@
+#ifndef CONSTANTPROPAGATION_H
+#define CONSTANTPROPAGATION_H
+
+#include <set>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+class CFG;
+class BasicBlock;
+class IRInstr;
+
+/*---------------------------------------------------
+ * ConstantPropagation : propagation de constantes
+ * conditionnelle creuse (SCCP, Wegman et Zadeck), -O2
+ *
+ * Travaille sur la forme SSA. Chaque registre virtuel vaut
+ * « indéterminé », une constante ou « variable » ; seuls les
+ * blocs atteints par une arête exécutable sont évalués, si bien
+ * qu'une constante franchit un if dont une branche ne s'exécute
+ * jamais. Ensuite :
+ *  - une instruction dont le résultat est constant devient un
+ *    IRLdConst, un registre constant lu devient un immédiat ;
+ *  - un saut conditionnel sur une constante devient un saut
+ *    simple, les phi perdent la source de l'arête retirée ;
+ *  - les IRLdConst qui ne sont plus lus sont supprimés.
+ * Une division par zéro n'est jamais évaluée à la compilation.
+ *---------------------------------------------------*/
+class ConstantPropagation {
+public:
+    explicit ConstantPropagation(CFG &cfg);
+
+    void run();
+
+private:
+    // Valeur d'un registre virtuel dans le treillis
+    struct Value {
+        enum State { Undefined, Constant, Varying } state = Undefined;
+        int constant = 0;
+    };
+    // Instruction qui lit un registre, avec le numéro de son bloc
+    struct Use {
+        IRInstr *instr;
+        int block;
+    };
+
+    CFG &cfg;
+    std::unordered_map<const BasicBlock *, int> blockId;
+    std::vector<Value> values;
+    std::vector<std::vector<Use>> uses;
+    std::vector<std::vector<int>> testedBy;     // blocs dont test_var est ce registre
+    std::vector<char> visited;                  // bloc déjà évalué
+    std::set<std::pair<int, int>> executable;   // arêtes (prédécesseur, successeur)
+    std::vector<std::pair<int, int>> flowWork;
+    std::vector<int> ssaWork;
+
+    void collectUses();
+    void propagate();
+    void rewrite();
+    void removeUnusedConstants();
+
+    bool isExecutable(int from, int to) const;
+    void setValue(int vreg, Value value);
+    void visitPhi(IRInstr *instr, int block);
+    void visitInstr(IRInstr *instr);
+    void visitExits(int block);
+    Value evaluate(const IRInstr *instr) const;
+};
+
+#endif
@@ -0,0 +1,136 @@
+#include "CopyPropagation.h"
+
+#include <algorithm>
+#include <unordered_map>
+
+#include "IR.h"
+#include "IRInstr.h"
+
+CopyPropagation::CopyPropagation(CFG &cfg) : cfg(cfg) {}
+
+void CopyPropagation::run()
+{
+    countOperands();
+    for (BasicBlock *bb : cfg.get_bbs())
+    {
+        coalesce(bb);
+        propagate(bb);
+    }
+}
+
+void CopyPropagation::countOperands()
+{
+    size_t vregCount = cfg.get_stv().vregs.size();
+    defCount.assign(vregCount, 0);
+    useCount.assign(vregCount, 0);
+    for (BasicBlock *bb : cfg.get_bbs())
+    {
+        for (IRInstr *instr : bb->instrs)
+        {
+            for (int def : instr->getDefs())
+                defCount[def]++;
+            for (int use : instr->getUses())
+                useCount[use]++;
+        }
+        if (bb->test_var != VRegTable::NONE)
+            useCount[bb->test_var]++;
+    }
+}
+
+// « t = expr ; ... ; x = copy t » devient « x = expr ; ... »
+void CopyPropagation::coalesce(BasicBlock *bb)
+{
+    std::vector<IRInstr *> &instrs = bb->instrs;
+    std::unordered_map<int, size_t> definedAt;   // registre -> indice de sa définition dans le bloc
+    std::vector<char> removed(instrs.size(), 0);
+
+    for (size_t j = 0; j < instrs.size(); j++)
+    {
+        IRInstr *copy = instrs[j];
+        if (copy->opcode() == IROpcode::Copy)
+        {
+            int dest = copy->getParams()[0], source = copy->getParams()[1];
+            auto def = definedAt.find(source);
+            if (source != dest && def != definedAt.end()
+                && defCount[source] == 1 && useCount[source] == 1
+                && instrs[def->second]->getDefs().size() == 1)
+            {
+                // x ne doit être ni lu ni écrit entre la définition de t et la copie
+                bool free = true;
+                for (size_t k = def->second + 1; k < j && free; k++)
+                {
+                    if (removed[k])
+                        continue;
+                    std::vector<int> uses = instrs[k]->getUses(), defs = instrs[k]->getDefs();
+                    free = std::find(uses.begin(), uses.end(), dest) == uses.end()
+                           && std::find(defs.begin(), defs.end(), dest) == defs.end();
+                }
+                if (free)
+                {
+                    size_t i = def->second;
+                    instrs[i]->replaceDef(source, dest);
+                    removed[j] = 1;
+                    defCount[source]--;
+                    useCount[source]--;
+                    definedAt.erase(def);
+                    definedAt[dest] = i;
+                    continue;
+                }
+            }
+        }
+        for (int d : copy->getDefs())
+            definedAt[d] = j;
+    }
+
+    size_t kept = 0;
+    for (size_t j = 0; j < instrs.size(); j++)
+        if (!removed[j])
+            instrs[kept++] = instrs[j];
+    instrs.resize(kept);
+}
+
+void CopyPropagation::propagate(BasicBlock *bb)
+{
+    const VRegTable &vregs = cfg.get_stv().vregs;
+    std::unordered_map<int, int> copyOf;                  // x -> y après « x = copy y »
+    std::unordered_map<int, std::vector<int>> copiedTo;   // y -> les x qui le recopient
+
+    // Un registre réécrit n'est plus l'original ni la copie de personne
+    auto kill = [&](int vreg) {
+        copyOf.erase(vreg);
+        auto it = copiedTo.find(vreg);
+        if (it == copiedTo.end())
+            return;
+        for (int x : it->second)
+        {
+            auto c = copyOf.find(x);
+            if (c != copyOf.end() && c->second == vreg)
+                copyOf.erase(c);
+        }
+        copiedTo.erase(it);
+    };
+
+    for (IRInstr *instr : bb->instrs)
+    {
+        for (int use : instr->getUses())
+        {
+            auto c = copyOf.find(use);
+            if (c != copyOf.end())
+                instr->replaceUse(use, c->second);
+        }
+        for (int def : instr->getDefs())
+            kill(def);
+        if (instr->opcode() != IROpcode::Copy)
+            continue;
+        int dest = instr->getParams()[0], source = instr->getParams()[1];
+        if (dest == source)
+            continue;
+        copyOf[dest] = source;
+        copiedTo[source].push_back(dest);
+    }
+
+    // test_var n'est jamais un immédiat : seul un registre le remplace
+    auto c = copyOf.find(bb->test_var);
+    if (bb->test_var != VRegTable::NONE && c != copyOf.end() && !vregs.isImmediate(c->second))
+        bb->test_var = c->second;
+}
@@ -0,0 +1,41 @@
+#ifndef COPYPROPAGATION_H
+#define COPYPROPAGATION_H
+
+#include <vector>
+
+class CFG;
+class BasicBlock;
+
+/*---------------------------------------------------
+ * CopyPropagation : fusion des temporaires et propagation
+ * des copies (-O1 et -O2, avant DeadCodeElimination)
+ *
+ * Une affectation est abaissée en « t = expr ; x = copy t ».
+ *  - Fusion : quand t n'a qu'une définition et une seule lecture,
+ *    cette copie placée plus loin dans le même bloc, et que x
+ *    n'est ni lu ni écrit entre les deux, l'instruction écrit
+ *    directement x et la copie disparaît.
+ *  - Propagation : après « x = copy y », les lectures de x dans
+ *    la suite du bloc lisent y (registre ou immédiat), jusqu'à
+ *    ce que x ou y soit réécrit. La copie devenue inutile est
+ *    retirée par DeadCodeElimination.
+ * Les générateurs lisent toutes les sources avant d'écrire la
+ * destination : « x = x + 1 » est donc correct.
+ *---------------------------------------------------*/
+class CopyPropagation {
+public:
+    explicit CopyPropagation(CFG &cfg);
+
+    void run();
+
+private:
+    CFG &cfg;
+    std::vector<int> defCount;
+    std::vector<int> useCount;
+
+    void countOperands();
+    void coalesce(BasicBlock *bb);
+    void propagate(BasicBlock *bb);
+};
+
+#endif
@@ -0,0 +1,183 @@
+#include "DeadCodeElimination.h"
+
+#include <set>
+
+#include "IR.h"
+#include "IRInstr.h"
+#include "Liveness.h"
+
+DeadCodeElimination::DeadCodeElimination(CFG &cfg) : cfg(cfg) {}
+
+void DeadCodeElimination::run()
+{
+    if (cfg.get_bbs().empty())
+        return;
+    cfg.remove_dead_exits();
+    do
+    {
+        removeUnreachable();
+        while (removeDeadInstrs())
+            ;
+    } while (skipEmptyBlocks());
+    fallThrough();
+}
+
+// Parcours depuis le bloc d'entrée ; l'ordre des blocs restants est conservé,
+// un bloc à continuation (exit_false seul) reste donc suivi de sa cible
+void DeadCodeElimination::removeUnreachable()
+{
+    const std::vector<BasicBlock *> &bbs = cfg.get_bbs();
+    std::set<BasicBlock *> reached = {bbs[0]};
+    std::vector<BasicBlock *> work = {bbs[0]};
+    while (!work.empty())
+    {
+        BasicBlock *bb = work.back();
+        work.pop_back();
+        for (BasicBlock *succ : Liveness::successors(bb))
+            if (reached.insert(succ).second)
+                work.push_back(succ);
+    }
+    if (reached.size() == bbs.size())
+        return;
+
+    std::vector<BasicBlock *> kept;
+    for (BasicBlock *bb : bbs)
+        if (reached.count(bb) != 0)
+            kept.push_back(bb);
+    cfg.set_bbs(std::move(kept));
+}
+
+bool DeadCodeElimination::hasSideEffect(const IRInstr *instr) const
+{
+    switch (instr->opcode())
+    {
+    case IROpcode::Return: case IROpcode::Call: case IROpcode::PutChar:
+    case IROpcode::GetChar: case IROpcode::Branch: case IROpcode::MovReg:
+    case IROpcode::Phi:
+        return true;
+    case IROpcode::ParamLoad:
+        // Garde l'erreur « trop de paramètres » de l'émission, quel que soit -O
+        return true;
+    case IROpcode::Div:
+    case IROpcode::Mod:
+    {
+        // Une division qui peut faillir doit rester : le programme plante au même endroit
+        const VRegTable &vregs = cfg.get_stv().vregs;
+        int divisor = instr->getParams()[2];
+        return !vregs.isImmediate(divisor) || vregs.immediateValue(divisor) == 0
+               || vregs.immediateValue(divisor) == -1;
+    }
+    default:
+        return false;
+    }
+}
+
+// Parcours arrière de chaque bloc depuis ses registres vivants en sortie
+bool DeadCodeElimination::removeDeadInstrs()
+{
+    Liveness liveness(cfg);
+    liveness.compute();
+
+    bool changed = false;
+    for (BasicBlock *bb : cfg.get_bbs())
+    {
+        std::set<int> live = liveness.live_out(bb);
+        if (bb->exit_true != nullptr && bb->exit_false != nullptr && bb->test_var != VRegTable::NONE)
+            live.insert(bb->test_var);
+
+        std::vector<IRInstr *> kept;
+        for (auto it = bb->instrs.rbegin(); it != bb->instrs.rend(); ++it)
+        {
+            IRInstr *instr = *it;
+            std::vector<int> defs = instr->getDefs();
+            bool needed = hasSideEffect(instr);
+            for (int def : defs)
+                needed = needed || live.count(def) != 0;
+            if (!needed)
+            {
+                changed = true;
+                continue;
+            }
+            for (int def : defs)
+                live.erase(def);
+            for (int use : instr->getUses())
+                live.insert(use);
+            kept.push_back(instr);
+        }
+        bb->instrs.assign(kept.rbegin(), kept.rend());
+    }
+    return changed;
+}
+
+// Successeur unique d'un bloc, nullptr s'il en a deux ou aucun
+BasicBlock *DeadCodeElimination::successor(const BasicBlock *bb) const
+{
+    if (bb->exit_true != nullptr && (bb->exit_false == nullptr || bb->exit_false == bb->exit_true))
+        return bb->exit_true;
+    if (bb->exit_true == nullptr)
+        return bb->exit_false;
+    return nullptr;
+}
+
+// Premier bloc non vide atteint depuis bb en traversant des blocs vides ;
+// bb lui-même sur une boucle de blocs vides (while (1) {})
+BasicBlock *DeadCodeElimination::forward(BasicBlock *bb) const
+{
+    const std::vector<BasicBlock *> &bbs = cfg.get_bbs();
+    BasicBlock *target = bb;
+    for (size_t steps = 0; steps < bbs.size(); steps++)
+    {
+        if (target == bbs[0] || !target->instrs.empty() || successor(target) == nullptr)
+            return target;
+        target = successor(target);
+    }
+    return bb;
+}
+
+bool DeadCodeElimination::skipEmptyBlocks()
+{
+    bool changed = false;
+    for (BasicBlock *bb : cfg.get_bbs())
+    {
+        bool fallsThrough = bb->exit_true == nullptr && bb->exit_false != nullptr;
+        if (bb->exit_true != nullptr && forward(bb->exit_true) != bb->exit_true)
+        {
+            bb->exit_true = forward(bb->exit_true);
+            changed = true;
+        }
+        if (bb->exit_false != nullptr && forward(bb->exit_false) != bb->exit_false)
+        {
+            bb->exit_false = forward(bb->exit_false);
+            changed = true;
+            // La nouvelle cible ne suit plus forcément le bloc : saut explicite
+            if (fallsThrough)
+            {
+                bb->exit_true = bb->exit_false;
+                bb->exit_false = nullptr;
+            }
+        }
+        // Les deux branches mènent au même bloc : le test n'est plus lu
+        if (bb->exit_true != nullptr && bb->exit_true == bb->exit_false)
+        {
+            bb->exit_false = nullptr;
+            bb->test_var = VRegTable::NONE;
+            changed = true;
+        }
+    }
+    return changed;
+}
+
+// Un saut simple vers le bloc suivant devient une continuation, sans jmp
+void DeadCodeElimination::fallThrough()
+{
+    const std::vector<BasicBlock *> &bbs = cfg.get_bbs();
+    for (size_t i = 0; i + 1 < bbs.size(); i++)
+    {
+        BasicBlock *bb = bbs[i];
+        if (bb->exit_true == bbs[i + 1] && bb->exit_false == nullptr)
+        {
+            bb->exit_false = bb->exit_true;
+            bb->exit_true = nullptr;
+        }
+    }
+}
@@ -0,0 +1,48 @@
+#ifndef DEADCODEELIMINATION_H
+#define DEADCODEELIMINATION_H
+
+class CFG;
+class BasicBlock;
+class IRInstr;
+
+/*---------------------------------------------------
+ * DeadCodeElimination : code mort et blocs inatteignables
+ * (-O1 et -O2, avant l'allocation de registres)
+ *
+ *  - un bloc s'arrête à son premier return ;
+ *  - les blocs que l'on n'atteint pas depuis l'entrée (code après
+ *    un return, branche d'un if sur une constante) sont retirés
+ *    de CFG::bbs ;
+ *  - une instruction sans effet de bord dont aucun résultat
+ *    n'est vivant après elle (Liveness) est supprimée : temporaire
+ *    d'une expression inutilisée, « int x; » aussitôt affecté...
+ *    jusqu'au point fixe, une suppression pouvant en rendre
+ *    d'autres possibles ;
+ *  - un bloc vide qui ne fait que passer à un autre (else absent,
+ *    branche vidée) est court-circuité par ses prédécesseurs ;
+ *  - un saut simple vers le bloc qui suit devient une continuation
+ *    (exit_false seul), sans jmp émis.
+ * Les appels, putchar / getchar, les lectures de paramètres et
+ * les divisions qui peuvent faillir (diviseur qui n'est pas un
+ * immédiat non nul, différent de -1) sont toujours gardés.
+ *---------------------------------------------------*/
+class DeadCodeElimination {
+public:
+    explicit DeadCodeElimination(CFG &cfg);
+
+    void run();
+
+private:
+    CFG &cfg;
+
+    void removeUnreachable();
+    bool removeDeadInstrs();
+    bool skipEmptyBlocks();
+    void fallThrough();
+
+    bool hasSideEffect(const IRInstr *instr) const;
+    BasicBlock *successor(const BasicBlock *bb) const;
+    BasicBlock *forward(BasicBlock *bb) const;
+};
+
+#endif
@@ -0,0 +1,209 @@
+#include "DominatorTree.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "IR.h"
+
+static const std::vector<BasicBlock *> NO_BLOCKS;
+
+DominatorTree::DominatorTree(CFG &cfg) : cfg(cfg) {}
+
+std::vector<BasicBlock *> DominatorTree::successors(BasicBlock *bb)
+{
+    std::vector<BasicBlock *> succs;
+    if (bb->exit_true != nullptr)
+        succs.push_back(bb->exit_true);
+    if (bb->exit_false != nullptr && bb->exit_false != bb->exit_true)
+        succs.push_back(bb->exit_false);
+    return succs;
+}
+
+void DominatorTree::compute()
+{
+    computeOrder();
+    computeIdoms();
+    computeFrontiers();
+    numberTree();
+}
+
+int DominatorTree::indexOf(const BasicBlock *bb) const
+{
+    auto it = number.find(bb);
+    return it == number.end() ? -1 : it->second;
+}
+
+// Parcours en profondeur itératif depuis l'entrée : ordre postfixe inverse
+void DominatorTree::computeOrder()
+{
+    number.clear();
+    rpo.clear();
+    const std::vector<BasicBlock *> &bbs = cfg.get_bbs();
+    if (bbs.empty())
+        return;
+
+    std::vector<BasicBlock *> post;
+    std::vector<std::pair<BasicBlock *, std::vector<BasicBlock *>>> stack;
+    number[bbs[0]] = -1;   // marqué vu, numéroté plus bas
+    stack.emplace_back(bbs[0], successors(bbs[0]));
+    while (!stack.empty())
+    {
+        std::vector<BasicBlock *> &pending = stack.back().second;
+        if (pending.empty())
+        {
+            post.push_back(stack.back().first);
+            stack.pop_back();
+            continue;
+        }
+        // Successeurs dans l'ordre exit_true, exit_false
+        BasicBlock *next = pending.front();
+        pending.erase(pending.begin());
+        if (number.count(next) == 0)
+        {
+            number[next] = -1;
+            stack.emplace_back(next, successors(next));
+        }
+    }
+
+    rpo.assign(post.rbegin(), post.rend());
+    for (size_t i = 0; i < rpo.size(); i++)
+        number[rpo[i]] = (int)i;
+
+    preds.assign(rpo.size(), {});
+    for (BasicBlock *bb : rpo)
+        for (BasicBlock *succ : successors(bb))
+            preds[number[succ]].push_back(bb);
+}
+
+void DominatorTree::computeIdoms()
+{
+    size_t n = rpo.size();
+    idoms.assign(n, -1);
+    if (n == 0)
+        return;
+    idoms[0] = 0;
+
+    // Plus proche ancêtre commun : dans l'ordre postfixe inverse, un
+    // dominateur a toujours un rang plus petit que les blocs qu'il domine
+    auto intersect = [&](int a, int b) {
+        while (a != b)
+        {
+            while (a > b)
+                a = idoms[a];
+            while (b > a)
+                b = idoms[b];
+        }
+        return a;
+    };
+
+    bool changed = true;
+    while (changed)
+    {
+        changed = false;
+        for (size_t i = 1; i < n; i++)
+        {
+            int newIdom = -1;
+            for (BasicBlock *pred : preds[i])
+            {
+                int p = number[pred];
+                if (idoms[p] == -1)
+                    continue;   // pas encore traité
+                newIdom = newIdom == -1 ? p : intersect(p, newIdom);
+            }
+            if (idoms[i] != newIdom)
+            {
+                idoms[i] = newIdom;
+                changed = true;
+            }
+        }
+    }
+
+    kids.assign(n, {});
+    for (size_t i = 1; i < n; i++)
+        kids[idoms[i]].push_back(rpo[i]);
+}
+
+void DominatorTree::computeFrontiers()
+{
+    df.assign(rpo.size(), {});
+    for (size_t b = 0; b < rpo.size(); b++)
+    {
+        if (preds[b].size() < 2)
+            continue;
+        for (BasicBlock *pred : preds[b])
+        {
+            for (int runner = number[pred]; runner != idoms[b]; runner = idoms[runner])
+            {
+                if (!df[runner].empty() && df[runner].back() == rpo[b])
+                    break;  // déjà atteint par un autre prédécesseur
+                df[runner].push_back(rpo[b]);
+            }
+        }
+    }
+}
+
+// Numérotation préfixe / postfixe de l'arbre : dominates() en temps constant
+void DominatorTree::numberTree()
+{
+    preorder.assign(rpo.size(), 0);
+    postorder.assign(rpo.size(), 0);
+    if (rpo.empty())
+        return;
+    int pre = 0, post = 0;
+    std::vector<std::pair<int, size_t>> stack;
+    preorder[0] = pre++;
+    stack.emplace_back(0, 0);
+    while (!stack.empty())
+    {
+        int node = stack.back().first;
+        size_t &child = stack.back().second;
+        if (child == kids[node].size())
+        {
+            postorder[node] = post++;
+            stack.pop_back();
+            continue;
+        }
+        int next = number[kids[node][child++]];
+        preorder[next] = pre++;
+        stack.emplace_back(next, 0);
+    }
+}
+
+bool DominatorTree::reachable(const BasicBlock *bb) const
+{
+    return indexOf(bb) != -1;
+}
+
+BasicBlock *DominatorTree::idom(const BasicBlock *bb) const
+{
+    int i = indexOf(bb);
+    if (i <= 0)
+        return nullptr;
+    return rpo[idoms[i]];
+}
+
+bool DominatorTree::dominates(const BasicBlock *a, const BasicBlock *b) const
+{
+    int i = indexOf(a), j = indexOf(b);
+    if (i == -1 || j == -1)
+        return false;
+    return preorder[i] <= preorder[j] && postorder[j] <= postorder[i];
+}
+
+const std::vector<BasicBlock *> &DominatorTree::children(const BasicBlock *bb) const
+{
+    int i = indexOf(bb);
+    return i == -1 ? NO_BLOCKS : kids[i];
+}
+
+const std::vector<BasicBlock *> &DominatorTree::frontier(const BasicBlock *bb) const
+{
+    int i = indexOf(bb);
+    return i == -1 ? NO_BLOCKS : df[i];
+}
+
+const std::vector<BasicBlock *> &DominatorTree::predecessors(const BasicBlock *bb) const
+{
+    int i = indexOf(bb);
+    return i == -1 ? NO_BLOCKS : preds[i];
+}
@@ -0,0 +1,58 @@
+#ifndef DOMINATORTREE_H
+#define DOMINATORTREE_H
+
+#include <unordered_map>
+#include <vector>
+
+class CFG;
+class BasicBlock;
+
+/*---------------------------------------------------
+ * DominatorTree : dominateurs et frontières de dominance
+ *
+ * Calculés sur les blocs du CFG atteignables depuis le bloc
+ * d'entrée (le premier), en suivant exit_true / exit_false.
+ * Dominateurs immédiats par l'algorithme itératif de Cooper,
+ * Harvey et Kennedy sur l'ordre postfixe inverse ; frontières
+ * par remontée depuis les prédécesseurs de chaque point de
+ * jonction. Un bloc inatteignable n'a ni dominateur, ni fils,
+ * ni frontière.
+ *---------------------------------------------------*/
+class DominatorTree {
+public:
+    explicit DominatorTree(CFG &cfg);
+
+    void compute();
+
+    bool reachable(const BasicBlock *bb) const;
+    // nullptr pour le bloc d'entrée et les blocs inatteignables
+    BasicBlock *idom(const BasicBlock *bb) const;
+    // Vrai si a domine b (a == b compris)
+    bool dominates(const BasicBlock *a, const BasicBlock *b) const;
+
+    const std::vector<BasicBlock *> &children(const BasicBlock *bb) const;
+    const std::vector<BasicBlock *> &frontier(const BasicBlock *bb) const;
+    // Prédécesseurs atteignables
+    const std::vector<BasicBlock *> &predecessors(const BasicBlock *bb) const;
+    // Blocs atteignables en ordre postfixe inverse (l'entrée en premier)
+    const std::vector<BasicBlock *> &reversePostorder() const { return rpo; }
+
+    // Successeurs distincts d'un bloc (exit_true puis exit_false)
+    static std::vector<BasicBlock *> successors(BasicBlock *bb);
+
+private:
+    CFG &cfg;
+    std::unordered_map<const BasicBlock *, int> number;    // rang dans rpo
+    std::vector<BasicBlock *> rpo;
+    std::vector<int> idoms;
+    std::vector<int> preorder, postorder;                   // numérotation de l'arbre
+    std::vector<std::vector<BasicBlock *>> preds, kids, df;
+
+    int indexOf(const BasicBlock *bb) const;
+    void computeOrder();
+    void computeIdoms();
+    void computeFrontiers();
+    void numberTree();
+};
+
+#endif
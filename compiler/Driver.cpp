@@ -0,0 +1,409 @@
+#include "Driver.h"
+
+#include <atomic>
+#include <exception>
+#include <iostream>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include "SymbolTableVisitor.h"
+#include "IRGenVisitor.h"
+#include "BackendInitializr.h"
+#include "AsmCache.h"
+#include "BuildId.h"
+#include "AsmWriter.h"
+#include "CompilationContext.h"
+#include "CompileError.h"
+#include "Log.h"
+#include "FastFrontend.h"
+#include "MappedCharStream.h"
+#include "X86Assembler.h"
+#include "ElfWriter.h"
+#include "Jit.h"
+#include "IRInterpreter.h"
+#include "SSABuilder.h"
+#include "ConstantPropagation.h"
+#include "SSADestructor.h"
+#include "CopyPropagation.h"
+#include "DeadCodeElimination.h"
+
+using namespace antlr4;
+
+std::unique_ptr<Frontend> createFrontend(const std::string &kind)
+{
+    if (kind == "antlr")
+        return std::make_unique<AntlrFrontend>();
+    if (kind == "fast")
+        return std::make_unique<FastFrontend>();
+    return nullptr;
+}
+
+bool AntlrFrontend::parseToAST(const std::string &source, AST &ast)
+{
+    ifccParser::AxiomContext *axiom = parse(source);
+    if (axiom == nullptr)
+        return false;
+    buildAST(axiom, ast);
+    releaseTree();
+    return true;
+}
+
+bool AntlrFrontend::parseToAST(MappedCharStream &source, AST &ast)
+{
+    ifccParser::AxiomContext *axiom = parse(source);
+    if (axiom == nullptr)
+        return false;
+    buildAST(axiom, ast);
+    releaseTree();
+    return true;
+}
+
+// Compteurs communs à tous les AntlrFrontend du processus (batch, serveur)
+static std::atomic<long> parseCount(0);
+static std::atomic<long> llFallbackCount(0);
+
+void StreamErrorListener::syntaxError(Recognizer *, Token *, size_t line, size_t charPositionInLine,
+                                      const std::string &msg, std::exception_ptr)
+{
+    *out << "line " << line << ":" << charPositionInLine << " " << msg << "\n";
+}
+
+AntlrFrontend::AntlrFrontend(Prediction prediction)
+    : lexer(&input), tokens(&lexer), parser(&tokens), prediction(prediction),
+      bail(std::make_shared<BailErrorStrategy>()), recover(std::make_shared<DefaultErrorStrategy>())
+{
+    lexer.removeErrorListeners();
+    lexer.addErrorListener(&errors);
+}
+
+long AntlrFrontend::parses()
+{
+    return parseCount;
+}
+
+long AntlrFrontend::llFallbacks()
+{
+    return llFallbackCount;
+}
+
+ifccParser::AxiomContext *AntlrFrontend::parse(const std::string &source)
+{
+    input.load(source, false);
+    return parseStream(input);
+}
+
+ifccParser::AxiomContext *AntlrFrontend::parse(MappedCharStream &source)
+{
+    return parseStream(source);
+}
+
+void AntlrFrontend::releaseTree()
+{
+    parser.reset();                // libère l'arbre
+    tokens.setTokenSource(&lexer); // et les tokens
+}
+
+ifccParser::AxiomContext *AntlrFrontend::parseStream(CharStream &stream)
+{
+    errors.out = diagnostics;
+    lexer.setInputStream(&stream);  // réinitialise le lexer
+    tokens.setTokenSource(&lexer);  // vide les tokens du fichier précédent
+    parser.setTokenStream(&tokens); // réinitialise le parser et libère l'arbre précédent
+
+    tokens.fill();
+    parseCount++;
+
+    auto interpreter = parser.getInterpreter<atn::ParserATNSimulator>();
+    if (prediction == SLL_THEN_LL)
+    {
+        // 1er passage : prédiction SLL, sans contexte complet, abandon à la première erreur.
+        // Suffit pour tout programme correct sauf ambiguïté que seul LL sait trancher.
+        interpreter->setPredictionMode(atn::PredictionMode::SLL);
+        parser.setErrorHandler(bail);
+        parser.removeErrorListeners();
+        try
+        {
+            return parser.axiom();
+        }
+        catch (ParseCancellationException &)
+        {
+            llFallbackCount++;
+            LOG_DEBUG("SLL parse failed, retrying in LL mode");
+        }
+        parser.reset(); // rembobine les tokens
+    }
+
+    // 2e passage (ou LL_ONLY) : LL complet avec rapport et reprise des erreurs
+    interpreter->setPredictionMode(atn::PredictionMode::LL);
+    parser.removeErrorListeners();
+    parser.addErrorListener(&errors);
+    parser.setErrorHandler(recover);
+    ifccParser::AxiomContext *axiom = parser.axiom();
+    if (parser.getNumberOfSyntaxErrors() != 0)
+        return nullptr;
+    return axiom;
+}
+
+// Ajoute à la clé les nœuds de la fonction en préordre (genre, opérateur,
+// valeur ou nom, nombre d'enfants) et la signature de chaque fonction appelée
+static void hashNode(const AST &ast, NodeId node, const CompilationContext &context, CacheKey &key)
+{
+    NodeKind kind = ast.kind(node);
+    key.add((long long)kind);
+    key.add((long long)ast.op(node));
+    switch (kind)
+    {
+    case NodeKind::Function:
+    case NodeKind::Param:
+    case NodeKind::Decl:
+    case NodeKind::Assign:
+    case NodeKind::Var:
+        key.add(ast.name(node));
+        break;
+    case NodeKind::Call:
+    {
+        key.add(ast.name(node));
+        auto it = context.functionTable.find(ast.name(node));
+        if (it != context.functionTable.end())
+        {
+            key.add(it->second.returnType);
+            for (const auto &param : it->second.paramsTypes)
+                key.add(param);
+        }
+        break;
+    }
+    case NodeKind::Const:
+        key.add((long long)ast.value(node));
+        break;
+    default:
+        break;
+    }
+    key.add((long long)ast.childCount(node));
+    for (NodeId child : ast.children(node))
+        hashNode(ast, child, context, key);
+}
+
+static CacheKey functionKey(const AST &ast, NodeId function, const CompilationContext &context)
+{
+    CacheKey key;
+    key.add("ifcc-asm-v3");
+    key.add(ifccBuildId);   // une autre build d'ifcc peut émettre un autre assembleur
+    key.add(context.target);
+    key.add((long long)context.optLevel);
+    hashNode(ast, function, context, key);
+    return key;
+}
+
+// IR d'une fonction : le CFG référence la table des symboles (et son arène)
+struct FunctionIR {
+    SymbolTableVisitor stv;
+    DefFonction defFunc;
+    CFG cfg;
+
+    FunctionIR(const std::string &name, const CodeGenBackend *backend)
+        : defFunc(name, {}), cfg(&defFunc, stv, backend) {}
+};
+
+// Analyse sémantique et génération de l'IR ; false si la fonction a des erreurs.
+// Un seul parcours de l'AST : les vérifications sémantiques sont faites
+// par IRGenVisitor au fur et à mesure qu'il génère l'IR.
+// -O2 : l'IR passe en forme SSA, où s'insèrent les optimisations sur les
+// valeurs, puis en sort avant l'allocation de registres et l'émission.
+// -O1 et plus : les copies sont propagées et les temporaires fusionnés avec
+// leur variable, puis le code mort et les blocs inatteignables sont retirés.
+static bool generateIR(const AST &ast, NodeId function, const CompilationContext &context, FunctionIR &ir)
+{
+    ir.cfg.optLevel = context.optLevel;
+    IRGenVisitor cgv;
+    cgv.cfg = &ir.cfg;
+    cgv.functionTable = &context.functionTable;
+    cgv.visitFunction(ast, function);
+    if (ir.stv.error != 0)
+        return false;
+
+    if (context.optLevel >= 2)
+    {
+        if (SSABuilder(ir.cfg).run())
+            ConstantPropagation(ir.cfg).run();
+        SSADestructor(ir.cfg).run();
+    }
+    if (context.optLevel >= 1)
+    {
+        CopyPropagation(ir.cfg).run();
+        DeadCodeElimination(ir.cfg).run();
+    }
+    return true;
+}
+
+// Analyse sémantique, génération de l'IR et émission de l'assembleur d'une fonction ;
+// ses avertissements sont écrits dans diagnostics.
+// Ne lit que le contexte : peut s'exécuter en parallèle pour plusieurs fonctions.
+static void compileFunction(const AST &ast, NodeId function, const CompilationContext &context,
+                            AsmWriter &out, std::ostream &diagnostics)
+{
+    const std::string &fname = ast.name(function);
+
+    CacheKey key;
+    if (context.cache != nullptr)
+    {
+        key = functionKey(ast, function, context);
+        CacheEntry cached;
+        if (context.cache->lookup(key, cached))
+        {
+            // Pas d'IR à générer : les avertissements de la compilation
+            // qui a rempli l'entrée sont réaffichés
+            diagnostics << cached.diagnostics;
+            LOG_INFO("Function: " << fname << " (cached)");
+            out << cached.asmText;
+            return;
+        }
+    }
+
+    FunctionIR ir(fname, context.backend.get());
+    if (context.cache == nullptr)
+    {
+        ir.stv.diagnostics = &diagnostics;
+        if (!generateIR(ast, function, context, ir))
+            return;
+        LOG_INFO("Function: " << fname);
+        // ir.stv.print_symbol_table();
+        // ir.cfg.current_bb->print_instrs();
+        ir.cfg.gen_asm(out);
+        return;
+    }
+
+    // Les diagnostics sont gardés pour l'entrée, puis affichés comme sans cache
+    CacheEntry entry;
+    std::ostringstream captured;
+    ir.stv.diagnostics = &captured;
+    bool ok;
+    try
+    {
+        ok = generateIR(ast, function, context, ir);
+    }
+    catch (const CompileError &)
+    {
+        diagnostics << captured.str();
+        throw;
+    }
+    entry.diagnostics = captured.str();
+    diagnostics << entry.diagnostics;
+    if (!ok)
+        return;
+
+    LOG_INFO("Function: " << fname);
+    AsmWriter assembly;
+    ir.cfg.gen_asm(assembly);
+    entry.asmText = assembly.str();
+    context.cache->store(key, entry);
+    out << entry.asmText;
+}
+
+// Contexte de compilation : backend et signatures de toutes les fonctions,
+// construits avant la génération puis partagés en lecture seule
+static void initContext(const AST &ast, const CompileOptions &options, CompilationContext &context)
+{
+    context.target = options.target;
+    context.backend = createBackend(context.target);
+    context.optLevel = options.optLevel;
+    context.cache = options.cache;
+    context.diagnostics = options.diagnostics != nullptr ? options.diagnostics : &std::cerr;
+    for (NodeId function : ast.functions())
+        context.functionTable[ast.name(function)] = SymbolTableVisitor::signatureOf(ast, function);
+    context.functionTable["putchar"] = FunctionSignature{"int", {"int"}};
+    context.functionTable["getchar"] = FunctionSignature{"int", {}};
+}
+
+void compileProgram(const AST &ast, const CompileOptions &options, std::ostream &out)
+{
+    CompilationContext context;
+    initContext(ast, options, context);
+
+    const std::vector<NodeId> &functions = ast.functions();
+    if (options.jobs == 1 || functions.size() <= 1)
+    {
+        AsmWriter writer(out);
+        for (NodeId function : functions)
+            compileFunction(ast, function, context, writer, *context.diagnostics);
+        return;
+    }
+
+    // -j N : chaque fonction est compilée dans son propre tampon par un thread,
+    // puis les tampons sont écrits dans l'ordre du source (sortie identique au mode série,
+    // avertissements compris)
+    // Une CompileError est conservée et relancée après les fonctions qui la précèdent.
+    std::vector<AsmWriter> buffers(functions.size());
+    std::vector<std::ostringstream> diagnostics(functions.size());
+    std::vector<std::exception_ptr> errors(functions.size());
+    std::atomic<size_t> next(0);
+    std::vector<std::thread> workers;
+    for (int t = 0; t < options.jobs && t < (int)functions.size(); t++)
+    {
+        workers.emplace_back([&]() {
+            for (size_t i = next++; i < functions.size(); i = next++)
+            {
+                try
+                {
+                    compileFunction(ast, functions[i], context, buffers[i], diagnostics[i]);
+                }
+                catch (const CompileError &)
+                {
+                    errors[i] = std::current_exception();
+                }
+            }
+        });
+    }
+    for (auto &worker : workers)
+        worker.join();
+
+    AsmWriter writer(out);
+    for (size_t i = 0; i < functions.size(); i++)
+    {
+        *context.diagnostics << diagnostics[i].str();
+        if (errors[i])
+            std::rethrow_exception(errors[i]);
+        writer << buffers[i].str();
+    }
+}
+
+void compileObject(const AST &ast, const CompileOptions &options, std::ostream &out)
+{
+    std::ostringstream assembly;
+    compileProgram(ast, options, assembly);
+    X86Assembler assembler;
+    assembler.assemble(assembly.str());
+    writeElfObject(assembler, out);
+}
+
+int runProgram(const AST &ast, const CompileOptions &options)
+{
+    std::ostringstream assembly;
+    compileProgram(ast, options, assembly);
+    X86Assembler assembler;
+    assembler.assemble(assembly.str());
+    JitProgram program(assembler);
+    return program.runMain();
+}
+
+int interpretProgram(const AST &ast, const CompileOptions &options, std::ostream *profile)
+{
+    CompilationContext context;
+    initContext(ast, options, context);
+
+    // Tous les CFG restent en vie : un appel peut viser n'importe quelle fonction
+    std::vector<std::unique_ptr<FunctionIR>> program;
+    IRInterpreter interpreter;
+    for (NodeId function : ast.functions())
+    {
+        program.push_back(std::make_unique<FunctionIR>(ast.name(function), context.backend.get()));
+        program.back()->stv.diagnostics = context.diagnostics;
+        if (!generateIR(ast, function, context, *program.back()))
+            throw CompileError("--interpret: function '" + ast.name(function) + "' has errors");
+        interpreter.addFunction(program.back()->cfg);
+    }
+    int result = interpreter.runMain();
+    if (profile != nullptr)
+        interpreter.report(*profile);
+    return result;
+}
@@ -0,0 +1,122 @@
+#ifndef DRIVER_H
+#define DRIVER_H
+
+#include <iostream>
+#include <memory>
+#include <ostream>
+#include <string>
+
+#include "antlr4-runtime.h"
+#include "generated/ifccLexer.h"
+#include "generated/ifccParser.h"
+#include "AST.h"
+
+class AsmCache;
+class MappedCharStream;
+
+/*---------------------------------------------------
+ * Frontend : source -> AST
+ *
+ * Deux implémentations produisent le même AST, donc le même IR :
+ * AntlrFrontend (défaut) abaisse l'arbre ifccParser avec buildAST,
+ * FastFrontend (--frontend=fast, lexer et parser écrits à la main,
+ * voir FastFrontend.h) écrit directement les nœuds de l'AST.
+ *---------------------------------------------------*/
+class Frontend {
+public:
+    virtual ~Frontend() {}
+
+    // Analyse et construction de l'AST ; false en cas d'erreur de syntaxe
+    virtual bool parseToAST(const std::string &source, AST &ast) = 0;
+    // Sans copie : la projection doit survivre à l'appel
+    virtual bool parseToAST(MappedCharStream &source, AST &ast) = 0;
+
+    std::ostream *diagnostics = &std::cerr;  // erreurs de syntaxe ("line L:C ...")
+};
+
+// "antlr" ou "fast" ; nullptr si le nom est inconnu
+std::unique_ptr<Frontend> createFrontend(const std::string &kind);
+
+// Erreurs ANTLR au format de ConsoleErrorListener, écrites dans out
+class StreamErrorListener : public antlr4::BaseErrorListener {
+public:
+    std::ostream *out = &std::cerr;
+
+    void syntaxError(antlr4::Recognizer *recognizer, antlr4::Token *offendingSymbol, size_t line,
+                     size_t charPositionInLine, const std::string &msg, std::exception_ptr e) override;
+};
+
+/*---------------------------------------------------
+ * AntlrFrontend : lexer et parser ANTLR réutilisables
+ *
+ * Un même AntlrFrontend enchaîne les fichiers sans être recréé :
+ * l'ATN n'est désérialisé qu'une fois par processus et le cache
+ * DFA reste chaud d'un fichier à l'autre. Un Frontend par thread.
+ *
+ * Par défaut l'analyse se fait en deux temps : prédiction SLL
+ * avec BailErrorStrategy, puis LL complet seulement si SLL échoue
+ * (erreur de syntaxe réelle ou ambiguïté que SLL ne tranche pas).
+ *---------------------------------------------------*/
+class AntlrFrontend : public Frontend {
+public:
+    enum Prediction { SLL_THEN_LL, LL_ONLY };
+
+    explicit AntlrFrontend(Prediction prediction = SLL_THEN_LL);
+
+    // parseToAST : parse() puis buildAST, l'arbre est libéré aussitôt
+    bool parseToAST(const std::string &source, AST &ast) override;
+    bool parseToAST(MappedCharStream &source, AST &ast) override;
+
+    // Arbre ifccParser, nullptr en cas d'erreur de syntaxe ; libéré au parse() suivant ou par releaseTree()
+    ifccParser::AxiomContext *parse(const std::string &source);
+    // Sans copie : la projection doit survivre à l'arbre renvoyé
+    ifccParser::AxiomContext *parse(MappedCharStream &source);
+    // Libère l'arbre (et les tokens) du dernier parse()
+    void releaseTree();
+
+    // Nombre d'analyses et de reprises en LL, tous AntlrFrontend confondus
+    static long parses();
+    static long llFallbacks();
+
+private:
+    antlr4::ANTLRInputStream input;
+    ifccLexer lexer;
+    antlr4::CommonTokenStream tokens;
+    ifccParser parser;
+    Prediction prediction;
+    std::shared_ptr<antlr4::ANTLRErrorStrategy> bail;
+    std::shared_ptr<antlr4::ANTLRErrorStrategy> recover;
+    StreamErrorListener errors;
+
+    ifccParser::AxiomContext *parseStream(antlr4::CharStream &stream);
+};
+
+// Options d'une compilation
+struct CompileOptions {
+    int optLevel = 0;
+    int jobs = 1;            // threads pour les fonctions d'un même fichier
+    AsmCache *cache = nullptr; // --cache DIR : assembleur des fonctions inchangées réutilisé
+    std::string frontend = "antlr"; // --frontend=fast : lexer et parser écrits à la main
+    bool object = false;     // -c : objet ELF (.o) au lieu de l'assembleur (.s)
+    std::string target = "x86"; // --target=arm64 : assembleur AArch64 (voir BackendInitializr.h)
+    std::ostream *diagnostics = nullptr; // avertissements et erreurs des fonctions ; std::cerr si nul
+};
+
+// Compile l'AST d'un programme ; l'assembleur est écrit dans out.
+// Lève CompileError sur une erreur fatale (la sortie contient alors les fonctions précédentes).
+void compileProgram(const AST &ast, const CompileOptions &options, std::ostream &out);
+
+// -c : comme compileProgram, puis l'assembleur est encodé par X86Assembler
+// et écrit dans out sous forme d'objet relocatable ELF64 (voir ElfWriter.h)
+void compileObject(const AST &ast, const CompileOptions &options, std::ostream &out);
+
+// --run : compile, encode et exécute le programme en mémoire (voir Jit.h) ;
+// renvoie la valeur de retour de son main
+int runProgram(const AST &ast, const CompileOptions &options);
+
+// --interpret : génère l'IR de toutes les fonctions et l'exécute sans
+// assembleur (voir IRInterpreter.h) ; renvoie la valeur de retour de main.
+// Si profile n'est pas nul, les compteurs dynamiques y sont écrits.
+int interpretProgram(const AST &ast, const CompileOptions &options, std::ostream *profile);
+
+#endif
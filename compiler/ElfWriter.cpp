@@ -0,0 +1,191 @@
+#include "ElfWriter.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace {
+
+// Constantes de la spécification ELF64 (System V ABI, supplément x86-64)
+const uint16_t ET_REL = 1;
+const uint16_t EM_X86_64 = 62;
+const uint32_t SHT_PROGBITS = 1, SHT_SYMTAB = 2, SHT_STRTAB = 3, SHT_RELA = 4;
+const uint64_t SHF_ALLOC = 0x2, SHF_EXECINSTR = 0x4, SHF_INFO_LINK = 0x40;
+const uint8_t STB_LOCAL = 0, STB_GLOBAL = 1;
+const uint8_t STT_NOTYPE = 0, STT_FUNC = 2, STT_SECTION = 3;
+const uint32_t R_X86_64_PLT32 = 4;
+
+const size_t EHDR_SIZE = 64, SHDR_SIZE = 64, SYM_SIZE = 24, RELA_SIZE = 24;
+
+enum Section { NONE, TEXT, RELA_TEXT, SYMTAB, STRTAB, SHSTRTAB, NOTE_GNU_STACK, SECTION_COUNT };
+
+// Tampon petit-boutiste
+struct Bytes {
+    std::vector<uint8_t> data;
+
+    void u8(uint8_t v) { data.push_back(v); }
+    void u16(uint16_t v) { put(v, 2); }
+    void u32(uint32_t v) { put(v, 4); }
+    void u64(uint64_t v) { put(v, 8); }
+    void put(uint64_t v, int size)
+    {
+        for (int i = 0; i < size; i++)
+            data.push_back((uint8_t)(v >> (8 * i)));
+    }
+    void align(size_t alignment)
+    {
+        while (data.size() % alignment != 0)
+            data.push_back(0);
+    }
+};
+
+// Table de chaînes : "\0nom1\0nom2\0..."
+struct StringTable {
+    std::string data = std::string(1, '\0');
+
+    uint32_t add(const std::string &s)
+    {
+        uint32_t offset = data.size();
+        data += s;
+        data += '\0';
+        return offset;
+    }
+};
+
+struct SectionHeader {
+    uint32_t name = 0, type = 0;
+    uint64_t flags = 0, offset = 0, size = 0;
+    uint32_t link = 0, info = 0;
+    uint64_t align = 1, entsize = 0;
+};
+
+} // namespace
+
+void writeElfObject(const X86Assembler &assembler, std::ostream &out)
+{
+    const std::vector<X86Assembler::Symbol> &symbols = assembler.symbols();
+
+    // Table des symboles : nul, section .text, locaux, puis globaux (exigé par ELF)
+    StringTable strtab;
+    Bytes symtab;
+    std::vector<uint32_t> elfIndex(symbols.size());
+    symtab.data.resize(SYM_SIZE, 0);
+    auto symbol = [&](uint32_t name, uint8_t bind, uint8_t type, uint16_t section, uint64_t value) {
+        symtab.u32(name);
+        symtab.u8(bind << 4 | type);
+        symtab.u8(0);   // visibilité par défaut
+        symtab.u16(section);
+        symtab.u64(value);
+        symtab.u64(0);  // taille inconnue, comme gas sans .size
+    };
+    symbol(0, STB_LOCAL, STT_SECTION, TEXT, 0);
+    uint32_t count = 2;
+    for (int pass = 0; pass < 2; pass++)
+    {
+        bool globals = pass == 1;
+        for (size_t i = 0; i < symbols.size(); i++)
+        {
+            const X86Assembler::Symbol &s = symbols[i];
+            // Un symbole non défini est forcément externe
+            bool global = s.global || !s.defined;
+            if (global != globals)
+                continue;
+            elfIndex[i] = count++;
+            symbol(strtab.add(s.name), global ? STB_GLOBAL : STB_LOCAL,
+                   s.defined ? STT_FUNC : STT_NOTYPE, s.defined ? TEXT : 0, s.offset);
+        }
+    }
+    uint32_t firstGlobal = 2;
+    for (const X86Assembler::Symbol &s : symbols)
+        if (s.defined && !s.global)
+            firstGlobal++;
+
+    Bytes rela;
+    for (const X86Assembler::Relocation &r : assembler.relocations())
+    {
+        rela.u64(r.offset);
+        rela.u64((uint64_t)elfIndex[r.symbol] << 32 | R_X86_64_PLT32);
+        rela.u64((uint64_t)r.addend);
+    }
+
+    StringTable shstrtab;
+    SectionHeader headers[SECTION_COUNT];
+    headers[TEXT].name = shstrtab.add(".text");
+    headers[RELA_TEXT].name = shstrtab.add(".rela.text");
+    headers[SYMTAB].name = shstrtab.add(".symtab");
+    headers[STRTAB].name = shstrtab.add(".strtab");
+    headers[SHSTRTAB].name = shstrtab.add(".shstrtab");
+    headers[NOTE_GNU_STACK].name = shstrtab.add(".note.GNU-stack");
+
+    // Contenu des sections, à la suite de l'en-tête
+    Bytes file;
+    file.data.resize(EHDR_SIZE, 0);
+    auto place = [&](Section section, const uint8_t *data, size_t size, size_t alignment) {
+        file.align(alignment);
+        headers[section].offset = file.data.size();
+        headers[section].size = size;
+        headers[section].align = alignment;
+        file.data.insert(file.data.end(), data, data + size);
+    };
+    const std::vector<uint8_t> &code = assembler.code();
+    place(TEXT, code.data(), code.size(), 16);
+    place(RELA_TEXT, rela.data.data(), rela.data.size(), 8);
+    place(SYMTAB, symtab.data.data(), symtab.data.size(), 8);
+    place(STRTAB, (const uint8_t *)strtab.data.data(), strtab.data.size(), 1);
+    place(SHSTRTAB, (const uint8_t *)shstrtab.data.data(), shstrtab.data.size(), 1);
+    place(NOTE_GNU_STACK, nullptr, 0, 1);
+
+    headers[TEXT].type = SHT_PROGBITS;
+    headers[TEXT].flags = SHF_ALLOC | SHF_EXECINSTR;
+    headers[RELA_TEXT].type = SHT_RELA;
+    headers[RELA_TEXT].flags = SHF_INFO_LINK;
+    headers[RELA_TEXT].link = SYMTAB;
+    headers[RELA_TEXT].info = TEXT;
+    headers[RELA_TEXT].entsize = RELA_SIZE;
+    headers[SYMTAB].type = SHT_SYMTAB;
+    headers[SYMTAB].link = STRTAB;
+    headers[SYMTAB].info = firstGlobal;
+    headers[SYMTAB].entsize = SYM_SIZE;
+    headers[STRTAB].type = SHT_STRTAB;
+    headers[SHSTRTAB].type = SHT_STRTAB;
+    headers[NOTE_GNU_STACK].type = SHT_PROGBITS;
+    headers[NONE].align = 0;
+
+    file.align(8);
+    uint64_t shoff = file.data.size();
+    for (const SectionHeader &h : headers)
+    {
+        file.u32(h.name);
+        file.u32(h.type);
+        file.u64(h.flags);
+        file.u64(0);    // sh_addr : objet relocatable
+        file.u64(h.offset);
+        file.u64(h.size);
+        file.u32(h.link);
+        file.u32(h.info);
+        file.u64(h.align);
+        file.u64(h.entsize);
+    }
+
+    // En-tête ELF, écrit en dernier dans l'espace réservé
+    Bytes ehdr;
+    const uint8_t ident[16] = {0x7F, 'E', 'L', 'F', 2 /* 64 bits */, 1 /* petit-boutiste */, 1 /* EV_CURRENT */};
+    ehdr.data.assign(ident, ident + 16);
+    ehdr.u16(ET_REL);
+    ehdr.u16(EM_X86_64);
+    ehdr.u32(1);        // e_version
+    ehdr.u64(0);        // e_entry
+    ehdr.u64(0);        // e_phoff
+    ehdr.u64(shoff);
+    ehdr.u32(0);        // e_flags
+    ehdr.u16(EHDR_SIZE);
+    ehdr.u16(0);        // e_phentsize
+    ehdr.u16(0);        // e_phnum
+    ehdr.u16(SHDR_SIZE);
+    ehdr.u16(SECTION_COUNT);
+    ehdr.u16(SHSTRTAB);
+    std::copy(ehdr.data.begin(), ehdr.data.end(), file.data.begin());
+
+    out.write((const char *)file.data.data(), file.data.size());
+}
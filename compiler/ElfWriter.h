@@ -0,0 +1,21 @@
+#ifndef ELFWRITER_H
+#define ELFWRITER_H
+
+#include <ostream>
+
+#include "X86Assembler.h"
+
+/*---------------------------------------------------
+ * ElfWriter : objet relocatable ELF64 x86-64 (mode -c)
+ *
+ * Sections : .text (code de X86Assembler), .rela.text (un
+ * R_X86_64_PLT32 par call), .symtab/.strtab (fonctions .globl
+ * définies, symboles appelés mais non définis comme putchar et
+ * getchar), .shstrtab et une .note.GNU-stack vide (pile non
+ * exécutable, comme avec gas). L'objet se lie avec ld ou gcc.
+ * L'encodage est écrit champ par champ en petit-boutiste, sans
+ * dépendre de <elf.h>.
+ *---------------------------------------------------*/
+void writeElfObject(const X86Assembler &assembler, std::ostream &out);
+
+#endif
@@ -0,0 +1,588 @@
+#include "FastFrontend.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+#include "MappedCharStream.h"
+
+using namespace antlr4;
+
+/*--- Lexer ---*/
+
+// Types des littéraux : ANTLR les numérote T__0, T__1... dans l'ordre de leur
+// première apparition dans les règles du parser de ifcc.g4 ('return' et les
+// opérateurs nommés ont leur propre règle lexicale)
+static const size_t LPAREN = ifccParser::T__0;
+static const size_t RPAREN = ifccParser::T__1;
+static const size_t LBRACE = ifccParser::T__2;
+static const size_t RBRACE = ifccParser::T__3;
+static const size_t COMMA = ifccParser::T__4;
+static const size_t INT = ifccParser::T__5;
+static const size_t SEMI = ifccParser::T__6;
+static const size_t ASSIGN = ifccParser::T__7;
+static const size_t PLUS_ASSIGN = ifccParser::T__8;
+static const size_t MINUS_ASSIGN = ifccParser::T__9;
+static const size_t MUL_ASSIGN = ifccParser::T__10;
+static const size_t DIV_ASSIGN = ifccParser::T__11;
+static const size_t IF = ifccParser::T__12;
+static const size_t ELSE = ifccParser::T__13;
+static const size_t WHILE = ifccParser::T__14;
+static const size_t VOID = ifccParser::T__15;
+static const size_t NOT = ifccParser::T__16;
+static const size_t AND = ifccParser::T__17;
+static const size_t OR = ifccParser::T__18;
+
+static bool isLetter(char c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+}
+
+static bool isDigit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+static size_t keywordType(const char *word, size_t length)
+{
+    struct Keyword {
+        const char *text;
+        size_t type;
+    };
+    static const Keyword keywords[] = {
+        {"int", INT}, {"void", VOID}, {"if", IF}, {"else", ELSE}, {"while", WHILE}, {"return", ifccParser::RETURN},
+    };
+    for (const Keyword &k : keywords)
+        if (std::strlen(k.text) == length && std::memcmp(k.text, word, length) == 0)
+            return k.type;
+    return ifccParser::ID;
+}
+
+// Opérateurs et ponctuation, le plus long d'abord ; 0 si c ne commence aucun token
+static size_t punctuationType(char c, char next, size_t &length)
+{
+    length = 2;
+    switch (c)
+    {
+    case '+': if (next == '=') return PLUS_ASSIGN; length = 1; return ifccParser::PLUS;
+    case '-': if (next == '=') return MINUS_ASSIGN; length = 1; return ifccParser::MINUS;
+    case '*': if (next == '=') return MUL_ASSIGN; length = 1; return ifccParser::MUL;
+    case '/': if (next == '=') return DIV_ASSIGN; length = 1; return ifccParser::DIV;
+    case '<': if (next == '=') return ifccParser::LE; length = 1; return ifccParser::LT;
+    case '>': if (next == '=') return ifccParser::GE; length = 1; return ifccParser::GT;
+    case '=': if (next == '=') return ifccParser::EQ; length = 1; return ASSIGN;
+    case '!': if (next == '=') return ifccParser::NE; length = 1; return NOT;
+    case '&': if (next == '&') return AND; length = 1; return ifccParser::BAND;
+    case '|': if (next == '|') return OR; length = 1; return ifccParser::BOR;
+    }
+    length = 1;
+    switch (c)
+    {
+    case '%': return ifccParser::MOD;
+    case '^': return ifccParser::BXOR;
+    case '(': return LPAREN;
+    case ')': return RPAREN;
+    case '{': return LBRACE;
+    case '}': return RBRACE;
+    case ',': return COMMA;
+    case ';': return SEMI;
+    }
+    return 0;
+}
+
+// Découpe le source en tokens visibles, terminés par EOF. Comme le lexer ANTLR,
+// un caractère non reconnu est signalé (dans diagnostics) puis ignoré sans faire échouer l'analyse.
+static void tokenize(const char *data, size_t size, std::vector<FastToken> &tokens, std::ostream &diagnostics)
+{
+    tokens.clear();
+    size_t i = 0, line = 1, column = 0;
+    auto advance = [&](size_t n) {
+        for (size_t end = i + n; i < end; i++)
+        {
+            if (data[i] == '\n')
+            {
+                line++;
+                column = 0;
+            }
+            else
+            {
+                column++;
+            }
+        }
+    };
+    auto emit = [&](size_t type, size_t length) {
+        tokens.push_back(FastToken{type, data + i, length, line, column});
+        advance(length);
+    };
+
+    while (i < size)
+    {
+        char c = data[i];
+        char next = i + 1 < size ? data[i + 1] : '\0';
+
+        if (c == ' ' || c == '\t' || c == '\r' || c == '\n')
+        {
+            advance(1);
+            continue;
+        }
+        // COMMENT et DIRECTIVE ; non terminés, ils ne sont pas reconnus
+        // et '/' redevient DIV (le '#' est une erreur)
+        if (c == '/' && next == '*')
+        {
+            const char *end = static_cast<const char *>(memmem(data + i + 2, size - i - 2, "*/", 2));
+            if (end != nullptr)
+            {
+                advance(end + 2 - (data + i));
+                continue;
+            }
+        }
+        if (c == '#')
+        {
+            const char *end = static_cast<const char *>(std::memchr(data + i + 1, '\n', size - i - 1));
+            if (end != nullptr)
+            {
+                advance(end + 1 - (data + i));
+                continue;
+            }
+        }
+        if (isDigit(c))
+        {
+            size_t n = 1;
+            while (i + n < size && isDigit(data[i + n]))
+                n++;
+            emit(ifccParser::CONST, n);
+            continue;
+        }
+        if (isLetter(c) || c == '_')
+        {
+            size_t n = 1;
+            while (i + n < size && (isLetter(data[i + n]) || isDigit(data[i + n]) || data[i + n] == '_'))
+                n++;
+            emit(keywordType(data + i, n), n);
+            continue;
+        }
+        if (c == '\'' && i + 2 < size && isLetter(data[i + 1]) && data[i + 2] == '\'')
+        {
+            emit(ifccParser::CHAR, 3);
+            continue;
+        }
+
+        size_t length;
+        size_t type = punctuationType(c, next, length);
+        if (type != 0)
+        {
+            emit(type, length);
+            continue;
+        }
+        diagnostics << "line " << line << ":" << column << " token recognition error at: '" << c << "'\n";
+        advance(1);
+    }
+
+    static const char eofText[] = "<EOF>";
+    tokens.push_back(FastToken{Token::EOF, eofText, sizeof(eofText) - 1, line, column});
+}
+
+/*--- Parser ---*/
+
+// Niveaux de priorité des opérateurs binaires, dans l'ordre des alternatives de expr
+// (la première alternative est la plus prioritaire) ; 0 si le token n'est pas binaire
+static int binaryPrecedence(size_t type)
+{
+    switch (type)
+    {
+    case ifccParser::MUL: case ifccParser::DIV: case ifccParser::MOD: return 9;
+    case ifccParser::PLUS: case ifccParser::MINUS: return 8;
+    case ifccParser::LT: case ifccParser::GT: case ifccParser::LE: case ifccParser::GE: return 7;
+    case ifccParser::EQ: case ifccParser::NE: return 6;
+    case ifccParser::BAND: return 5;
+    case ifccParser::BXOR: return 4;
+    case ifccParser::BOR: return 3;
+    }
+    if (type == AND)
+        return 2;
+    if (type == OR)
+        return 1;
+    return 0;
+}
+
+// Les opérandes de '-' et '!' ne contiennent aucun opérateur binaire
+static const int UNARY_PRECEDENCE = 10;
+
+/*---------------------------------------------------
+ * FastParser : une règle de ifcc.g4 par méthode
+ *
+ * Chaque méthode crée ses nœuds comme l'ASTBuilder de AST.cpp
+ * (enfants avant le parent, empilés dans `pending`, noms internés
+ * dans le même ordre) : les parenthèses et les inst ne donnent
+ * pas de nœud, "int a, b;" donne une suite de Decl.
+ *---------------------------------------------------*/
+class FastParser {
+public:
+    FastParser(FastFrontend &owner, AST &ast) : owner(owner), ast(ast) {}
+
+    void axiom();
+
+    // Abandon de l'analyse ; le message a déjà été affiché
+    struct SyntaxError {};
+
+private:
+    FastFrontend &owner;
+    AST &ast;
+    size_t pos = 0;
+    std::vector<NodeId> pending;    // enfants déjà créés, pas encore rattachés à leur parent
+
+    const FastToken &peek(size_t k = 0) const
+    {
+        return owner.tokens[std::min(pos + k, owner.tokens.size() - 1)];
+    }
+    size_t la(size_t k = 0) const { return peek(k).type; }
+
+    [[noreturn]] void error(const char *expecting)
+    {
+        const FastToken &t = peek();
+        *owner.diagnostics << "line " << t.line << ":" << t.column << " mismatched input '";
+        owner.diagnostics->write(t.text, t.length);
+        *owner.diagnostics << "' expecting " << expecting << "\n";
+        throw SyntaxError();
+    }
+
+    const FastToken &match(size_t type, const char *expecting)
+    {
+        if (la() != type)
+            error(expecting);
+        return owner.tokens[pos++];
+    }
+
+    std::string text(const FastToken &token) const { return std::string(token.text, token.length); }
+    int intern(const FastToken &token) { return ast.intern(text(token)); }
+
+    // Crée le nœud dont les enfants sont pending[mark..] et les dépile
+    NodeId finish(NodeKind kind, int op, int value, size_t mark)
+    {
+        NodeId n = ast.add(kind, op, value, pending.data() + mark, pending.size() - mark);
+        pending.resize(mark);
+        return n;
+    }
+
+    NodeId unary(NodeKind kind, int op, int value, NodeId operand)
+    {
+        return ast.add(kind, op, value, &operand, 1);
+    }
+
+    void prog();
+    void body(bool keepDecls);
+    NodeId block();
+    void inst();
+    NodeId decl();
+    NodeId assignment();
+    NodeId expr(int minPrecedence = 0);
+    NodeId primary();
+    NodeId function_call();
+};
+
+// axiom : prog* EOF
+void FastParser::axiom()
+{
+    while (la() != Token::EOF)
+        prog();
+    match(Token::EOF, "<EOF>");
+}
+
+// prog : type ID '(' decl_params ')' '{' (decl | inst)* '}'
+void FastParser::prog()
+{
+    bool isVoid = la() == VOID;
+    if (isVoid)
+        match(VOID, "'void'");
+    else
+        match(INT, "{'int', 'void'}");
+
+    const FastToken &name = match(ifccParser::ID, "ID");
+    match(LPAREN, "'('");
+
+    // decl_params : ( param (',' param)* )?   avec   param : 'int' ID
+    size_t mark = pending.size();
+    if (la() == INT)
+    {
+        do
+        {
+            if (pending.size() != mark)
+                match(COMMA, "','");
+            match(INT, "'int'");
+            pending.push_back(ast.add(NodeKind::Param, 0, intern(match(ifccParser::ID, "ID"))));
+        } while (la() == COMMA);
+    }
+
+    match(RPAREN, "')'");
+    match(LBRACE, "'{'");
+    // Les decl nues (ID sans 'int') du corps de la fonction n'ont
+    // jamais été analysées ni générées : seules les inst sont gardées
+    body(false);
+    match(RBRACE, "'}'");
+    ast.addFunction(finish(NodeKind::Function, isVoid ? 1 : 0, intern(name), mark));
+}
+
+// (decl | inst)* d'un corps de fonction ou d'un bloc ; les decl nues ne sont
+// rattachées au parent que si keepDecls (leurs nœuds restent inutilisés sinon)
+void FastParser::body(bool keepDecls)
+{
+    while (true)
+    {
+        size_t type = la();
+        if (type == INT || type == ifccParser::RETURN || type == IF || type == WHILE || type == LBRACE)
+        {
+            inst();
+        }
+        else if (type == ifccParser::ID)
+        {
+            size_t next = la(1);
+            if (next == LPAREN || next == PLUS_ASSIGN || next == MINUS_ASSIGN || next == MUL_ASSIGN || next == DIV_ASSIGN)
+            {
+                inst();
+            }
+            else if (next != ASSIGN)
+            {
+                NodeId d = decl(); // decl sans initialisation : ID seul
+                if (keepDecls)
+                    pending.push_back(d);
+            }
+            else
+            {
+                // ID '=' expr ';' est une affectation, ID '=' expr sans ';' une decl :
+                // l'expression est analysée une seule fois puis rattachée au bon nœud
+                int name = intern(peek());
+                pos += 2;
+                NodeId value = expr();
+                if (la() == SEMI)
+                {
+                    pos++;
+                    pending.push_back(unary(NodeKind::Assign, 0, name, value));
+                }
+                else if (keepDecls)
+                {
+                    pending.push_back(unary(NodeKind::Decl, 0, name, value));
+                }
+            }
+        }
+        else
+        {
+            return;
+        }
+    }
+}
+
+// block : '{' (decl | inst)* '}'
+NodeId FastParser::block()
+{
+    size_t mark = pending.size();
+    match(LBRACE, "'{'");
+    body(true);
+    match(RBRACE, "'}'");
+    return finish(NodeKind::Block, 0, 0, mark);
+}
+
+// Une inst empile un nœud, sauf une declaration qui empile un Decl par variable
+void FastParser::inst()
+{
+    size_t type = la();
+    if (type == INT)
+    {
+        // declaration : 'int' decl (',' decl)* ';'
+        match(INT, "'int'");
+        pending.push_back(decl());
+        while (la() == COMMA)
+        {
+            match(COMMA, "','");
+            pending.push_back(decl());
+        }
+        match(SEMI, "';'");
+    }
+    else if (type == ifccParser::ID && la(1) == LPAREN)
+    {
+        pending.push_back(function_call());
+        match(SEMI, "';'");
+    }
+    else if (type == ifccParser::ID)
+    {
+        pending.push_back(assignment());
+    }
+    else if (type == ifccParser::RETURN)
+    {
+        // return_stmt : 'return' expr? ';'
+        match(ifccParser::RETURN, "'return'");
+        NodeId ret = la() != SEMI ? unary(NodeKind::Return, 0, 0, expr()) : ast.add(NodeKind::Return, 0, 0);
+        match(SEMI, "';'");
+        pending.push_back(ret);
+    }
+    else if (type == IF)
+    {
+        // if_stmt : 'if' '(' expr ')' block ('else' block)?
+        size_t mark = pending.size();
+        match(IF, "'if'");
+        match(LPAREN, "'('");
+        pending.push_back(expr());
+        match(RPAREN, "')'");
+        pending.push_back(block());
+        if (la() == ELSE)
+        {
+            match(ELSE, "'else'");
+            pending.push_back(block());
+        }
+        pending.push_back(finish(NodeKind::If, 0, 0, mark));
+    }
+    else if (type == WHILE)
+    {
+        // while_stmt : 'while' '(' expr ')' block
+        size_t mark = pending.size();
+        match(WHILE, "'while'");
+        match(LPAREN, "'('");
+        pending.push_back(expr());
+        match(RPAREN, "')'");
+        pending.push_back(block());
+        pending.push_back(finish(NodeKind::While, 0, 0, mark));
+    }
+    else
+    {
+        pending.push_back(block());
+    }
+}
+
+// decl : ID ('=' expr)?
+NodeId FastParser::decl()
+{
+    int name = intern(match(ifccParser::ID, "ID"));
+    if (la() != ASSIGN)
+        return ast.add(NodeKind::Decl, 0, name);
+    match(ASSIGN, "'='");
+    return unary(NodeKind::Decl, 0, name, expr());
+}
+
+// assignment : ID ('=' | '+=' | '-=' | '*=' | '/=') expr ';'
+NodeId FastParser::assignment()
+{
+    size_t type = la(1);
+    int op;
+    if (type == ASSIGN)
+        op = 0;
+    else if (type == PLUS_ASSIGN)
+        op = ifccParser::PLUS;
+    else if (type == MINUS_ASSIGN)
+        op = ifccParser::MINUS;
+    else if (type == MUL_ASSIGN)
+        op = ifccParser::MUL;
+    else if (type == DIV_ASSIGN)
+        op = ifccParser::DIV;
+    else
+    {
+        pos++;
+        error("{'=', '+=', '-=', '*=', '/='}");
+    }
+    int name = intern(match(ifccParser::ID, "ID"));
+    match(type, "'='");
+    NodeId value = expr();
+    match(SEMI, "';'");
+    return unary(NodeKind::Assign, op, name, value);
+}
+
+// Opérateurs binaires par précédence (Pratt) : associatifs à gauche, l'opérande
+// droit n'accepte que des opérateurs strictement plus prioritaires
+NodeId FastParser::expr(int minPrecedence)
+{
+    NodeId left = primary();
+    while (true)
+    {
+        size_t type = la();
+        int precedence = binaryPrecedence(type);
+        if (precedence == 0 || precedence < minPrecedence)
+            return left;
+
+        pos++;
+        NodeId operands[2] = {left, expr(precedence + 1)};
+        if (type == AND)
+            left = ast.add(NodeKind::And, 0, 0, operands, 2);
+        else if (type == OR)
+            left = ast.add(NodeKind::Or, 0, 0, operands, 2);
+        else
+            left = ast.add(NodeKind::Binary, type, 0, operands, 2);
+    }
+}
+
+NodeId FastParser::primary()
+{
+    switch (la())
+    {
+    case ifccParser::MINUS:
+        pos++;
+        return unary(NodeKind::Neg, 0, 0, expr(UNARY_PRECEDENCE));
+    case ifccParser::ID:
+        if (la(1) == LPAREN)
+            return function_call();
+        return ast.add(NodeKind::Var, 0, intern(owner.tokens[pos++]));
+    case ifccParser::CONST:
+        return ast.add(NodeKind::Const, 0, std::stoi(text(owner.tokens[pos++])));
+    case ifccParser::CHAR:
+        return ast.add(NodeKind::Const, 0, (int)owner.tokens[pos++].text[1]);
+    }
+
+    if (la() == NOT)
+    {
+        pos++;
+        return unary(NodeKind::Not, 0, 0, expr(UNARY_PRECEDENCE));
+    }
+    if (la() == LPAREN)
+    {
+        pos++;
+        NodeId inner = expr();
+        match(RPAREN, "')'");
+        return inner;
+    }
+    error("expression");
+}
+
+// function_call : ID '(' (expr (',' expr)*)? ')'
+NodeId FastParser::function_call()
+{
+    size_t mark = pending.size();
+    const FastToken &name = match(ifccParser::ID, "ID");
+    match(LPAREN, "'('");
+    if (la() != RPAREN)
+    {
+        pending.push_back(expr());
+        while (la() == COMMA)
+        {
+            match(COMMA, "','");
+            pending.push_back(expr());
+        }
+    }
+    match(RPAREN, "')'");
+    return finish(NodeKind::Call, 0, intern(name), mark);
+}
+
+/*--- FastFrontend ---*/
+
+bool FastFrontend::parseBytes(const char *data, size_t size, AST &ast)
+{
+    ast.clear();
+    tokenize(data, size, tokens, *diagnostics);
+
+    FastParser parser(*this, ast);
+    try
+    {
+        parser.axiom();
+        return true;
+    }
+    catch (const FastParser::SyntaxError &)
+    {
+        return false;
+    }
+}
+
+bool FastFrontend::parseToAST(const std::string &source, AST &ast)
+{
+    return parseBytes(source.data(), source.size(), ast);
+}
+
+bool FastFrontend::parseToAST(MappedCharStream &source, AST &ast)
+{
+    return parseBytes(source.data(), source.length(), ast);
+}
@@ -0,0 +1,46 @@
+#ifndef FASTFRONTEND_H
+#define FASTFRONTEND_H
+
+#include <string>
+#include <vector>
+
+#include "Driver.h"
+
+// Token du lexer écrit à la main : le texte pointe dans le source analysé
+struct FastToken {
+    size_t type;        // ifccParser::ID, ifccParser::PLUS... ou antlr4::Token::EOF
+    const char *text;
+    size_t length;
+    size_t line;
+    size_t column;
+};
+
+/*---------------------------------------------------
+ * FastFrontend : lexer et parser écrits à la main (--frontend=fast)
+ *
+ * Reconnaît exactement le langage de ifcc.g4 : descente récursive
+ * pour les instructions, Pratt (précédence) pour expr, avec les
+ * mêmes niveaux de priorité que les alternatives de la règle
+ * récursive à gauche d'ANTLR.
+ *
+ * Le parser écrit directement les nœuds de l'AST, dans l'ordre où
+ * buildAST les crée depuis l'arbre ANTLR : aucun contexte ifccParser
+ * ni CommonToken n'est alloué, aucun ATN n'est désérialisé et il
+ * n'y a pas de prédiction adaptative. L'IR produit est identique.
+ *
+ * Le tableau de tokens est gardé d'un fichier à l'autre.
+ *---------------------------------------------------*/
+class FastFrontend : public Frontend {
+public:
+    bool parseToAST(const std::string &source, AST &ast) override;
+    bool parseToAST(MappedCharStream &source, AST &ast) override;
+
+private:
+    std::vector<FastToken> tokens;      // tokens visibles, EOF en dernier
+
+    bool parseBytes(const char *data, size_t size, AST &ast);
+
+    friend class FastParser;
+};
+
+#endif
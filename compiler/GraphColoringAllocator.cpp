@@ -0,0 +1,230 @@
+#include "GraphColoringAllocator.h"
+#include "Liveness.h"
+#include "IR.h"
+#include <algorithm>
+
+GraphColoringAllocator::GraphColoringAllocator(CFG &cfg,
+                                               const std::vector<std::string> &calleeSaved,
+                                               const std::vector<std::string> &callerSaved)
+    : cfg(cfg), calleeSaved(calleeSaved), callerSaved(callerSaved),
+      K((int)(calleeSaved.size() + callerSaved.size())) {}
+
+void GraphColoringAllocator::addNode(int v)
+{
+    adj[v];
+}
+
+void GraphColoringAllocator::addEdge(int a, int b)
+{
+    if (a == b)
+        return;
+    adj[a].insert(b);
+    adj[b].insert(a);
+}
+
+void GraphColoringAllocator::buildGraph()
+{
+    Liveness liveness(cfg);
+    liveness.compute();
+
+    for (auto bb : cfg.get_bbs())
+    {
+        std::set<int> live = liveness.live_out(bb);
+        if (bb->exit_true != nullptr && bb->exit_false != nullptr && bb->test_var != VRegTable::NONE)
+            live.insert(bb->test_var);
+        for (int v : live)
+            addNode(v);
+
+        // Parcours à rebours : live contient les variables vivantes après l'instruction courante
+        for (auto it = bb->instrs.rbegin(); it != bb->instrs.rend(); ++it)
+        {
+            IRInstr *instr = *it;
+            std::vector<int> defs = instr->getDefs();
+            std::vector<int> uses = instr->getUses();
+
+            // Pour une copie, la destination n'interfère pas avec la source : candidates au coalescing
+            int moveSrc = VRegTable::NONE;
+            if (dynamic_cast<IRCopy *>(instr) != nullptr && defs.size() == 1 && uses.size() == 1)
+            {
+                moveSrc = uses[0];
+                moves.push_back({defs[0], moveSrc});
+            }
+
+            for (int d : defs)
+            {
+                addNode(d);
+                for (int l : live)
+                    if (l != moveSrc)
+                        addEdge(d, l);
+            }
+
+            if (instr->isCall())
+                for (int l : live)
+                    if (std::find(defs.begin(), defs.end(), l) == defs.end())
+                        crossesCall.insert(l);
+
+            for (int d : defs)
+                live.erase(d);
+            for (int u : uses)
+            {
+                addNode(u);
+                live.insert(u);
+            }
+        }
+    }
+}
+
+int GraphColoringAllocator::find(int v)
+{
+    auto it = alias.find(v);
+    if (it == alias.end())
+        return v;
+    int root = find(it->second);
+    it->second = root;
+    return root;
+}
+
+// Critère de Briggs : le nœud fusionné a moins de k voisins de degré significatif (>= k)
+bool GraphColoringAllocator::canCoalesce(int a, int b)
+{
+    if (a == b || adj[a].count(b))
+        return false;
+    bool call = crossesCall.count(a) || crossesCall.count(b);
+    int k = call ? (int)calleeSaved.size() : K;
+
+    std::set<int> neighbours = adj[a];
+    neighbours.insert(adj[b].begin(), adj[b].end());
+    int significant = 0;
+    for (int n : neighbours)
+    {
+        int degree = (int)adj[n].size();
+        if (adj[n].count(a) && adj[n].count(b))
+            degree--; // les deux arêtes deviennent une seule après fusion
+        if (degree >= k)
+            significant++;
+    }
+    return significant < k;
+}
+
+void GraphColoringAllocator::coalesce()
+{
+    bool changed = true;
+    while (changed)
+    {
+        changed = false;
+        for (const auto &[dest, src] : moves)
+        {
+            int a = find(dest);
+            int b = find(src);
+            if (!canCoalesce(a, b))
+                continue;
+
+            // b est absorbé par a
+            for (int n : adj[b])
+            {
+                adj[n].erase(b);
+                addEdge(a, n);
+            }
+            adj.erase(b);
+            if (crossesCall.count(b))
+                crossesCall.insert(a);
+            alias[b] = a;
+            changed = true;
+        }
+    }
+}
+
+std::map<int, std::string> GraphColoringAllocator::color()
+{
+    auto kOf = [&](int n) {
+        return crossesCall.count(n) ? (int)calleeSaved.size() : K;
+    };
+
+    // Simplification : on retire en priorité les nœuds de degré < k ; sinon on choisit
+    // de façon optimiste le nœud de plus fort degré comme candidat au spill.
+    std::map<int, int> degree;
+    std::set<std::pair<int, int>> worklist; // (degré - k, nœud)
+    for (const auto &[n, neighbours] : adj)
+    {
+        degree[n] = (int)neighbours.size();
+        worklist.insert({degree[n] - kOf(n), n});
+    }
+
+    std::vector<int> stack;
+    std::set<int> removed;
+    while (!worklist.empty())
+    {
+        auto pick = worklist.begin();
+        if (pick->first >= 0)
+            pick = std::prev(worklist.end());
+        int n = pick->second;
+        worklist.erase(pick);
+        removed.insert(n);
+        stack.push_back(n);
+        for (int m : adj[n])
+        {
+            if (removed.count(m))
+                continue;
+            worklist.erase({degree[m] - kOf(m), m});
+            degree[m]--;
+            worklist.insert({degree[m] - kOf(m), m});
+        }
+    }
+
+    // Sélection
+    std::map<int, std::string> colors;
+    while (!stack.empty())
+    {
+        int n = stack.back();
+        stack.pop_back();
+
+        std::set<std::string> taken;
+        for (int m : adj[n])
+        {
+            auto c = colors.find(m);
+            if (c != colors.end())
+                taken.insert(c->second);
+        }
+
+        std::vector<std::string> candidates;
+        if (!crossesCall.count(n))
+            candidates = callerSaved;
+        candidates.insert(candidates.end(), calleeSaved.begin(), calleeSaved.end());
+        for (const auto &reg : candidates)
+        {
+            if (!taken.count(reg))
+            {
+                colors[n] = reg;
+                break;
+            }
+        }
+        // Pas de couleur disponible : n reste dans son emplacement en pile
+    }
+    return colors;
+}
+
+void GraphColoringAllocator::run()
+{
+    buildGraph();
+    std::set<int> variables;
+    for (const auto &[n, _] : adj)
+        variables.insert(n);
+
+    coalesce();
+    std::map<int, std::string> colors = color();
+
+    cfg.regAllocation.assign(cfg.get_stv().vregs.size(), "");
+    cfg.savedRegs.clear();
+    std::set<std::string> used;
+    for (int v : variables)
+    {
+        auto c = colors.find(find(v));
+        if (c == colors.end())
+            continue;
+        cfg.regAllocation[v] = c->second;
+        used.insert(c->second);
+    }
+    for (const auto &reg : calleeSaved)
+        if (used.count(reg))
+            cfg.savedRegs.push_back(reg);
+}
@@ -0,0 +1,52 @@
+#ifndef GRAPHCOLORINGALLOCATOR_H
+#define GRAPHCOLORINGALLOCATOR_H
+
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+class CFG;
+
+/*---------------------------------------------------
+ * GraphColoringAllocator : allocation de registres par
+ * coloriage du graphe d'interférence (Chaitin-Briggs).
+ *
+ * 1. construction du graphe d'interférence à partir de la liveness
+ * 2. coalescing conservatif (critère de Briggs) des IRCopy
+ * 3. simplification / sélection optimiste des couleurs
+ *
+ * Les variables vivantes à travers un appel ne peuvent recevoir
+ * qu'un registre callee-saved ; les autres préfèrent les
+ * caller-saved. Les variables non coloriées restent en pile.
+ *---------------------------------------------------*/
+class GraphColoringAllocator {
+public:
+    GraphColoringAllocator(CFG &cfg,
+                           const std::vector<std::string> &calleeSaved,
+                           const std::vector<std::string> &callerSaved);
+
+    // Remplit cfg.regAllocation et cfg.savedRegs
+    void run();
+
+private:
+    CFG &cfg;
+    std::vector<std::string> calleeSaved;
+    std::vector<std::string> callerSaved;
+    int K;
+
+    std::map<int, std::set<int>> adj;   // graphe d'interférence
+    std::set<int> crossesCall;                  // vivantes à travers un IRCall
+    std::vector<std::pair<int, int>> moves;  // (dest, src) des IRCopy
+    std::map<int, int> alias;                           // registre virtuel coalescé -> représentant
+
+    void addNode(int v);
+    void addEdge(int a, int b);
+    void buildGraph();
+    int find(int v);
+    bool canCoalesce(int a, int b);
+    void coalesce();
+    std::map<int, std::string> color();
+};
+
+#endif
@@ -1,5 +1,10 @@
 #include "IR.h"
+
+#include <algorithm>
+
 #include "IRInstr.h"
+#include "LinearScanAllocator.h"
+#include "GraphColoringAllocator.h"
 
 /**
  * DefFonction
@@ -22,7 +27,7 @@ void DefFonction::print(std::ostream &os) const
 BasicBlock::BasicBlock(CFG* cfg, std::string entry_label)
             : cfg(cfg), label(entry_label + "_" + cfg->ast->name), exit_true(nullptr), exit_false(nullptr) {}
 
-void BasicBlock::gen_asm(std::ostream &o)
+void BasicBlock::gen_asm(AsmWriter &o)
 {
     o << label << ":\n";
     for (auto &instr : instrs)
@@ -30,19 +35,16 @@ void BasicBlock::gen_asm(std::ostream &o)
         instr->gen_asm(o);
     } // ajouter les sauts
     if (exit_true != nullptr && exit_false != nullptr){
-        o << "    movl " << cfg->IR_reg_to_asm(test_var_name) << ", %eax\n";
-        o << "    cmpl $0, %eax\n";
-        o << "    jne " << exit_true->label << "\n";
-        o << "    jmp " << exit_false->label << "\n";
+        cfg->backend->gen_jump_cond(o, cfg->operand(test_var), exit_true->label, exit_false->label);
     } else if  (exit_true != nullptr && exit_false == nullptr) {
-        o << "    jmp " << exit_true->label << "\n";
+        cfg->backend->gen_jump(o, exit_true->label);
     } 
 }
 
 
-void BasicBlock::add_IRInstr(std::unique_ptr<IRInstr> instr)
+void BasicBlock::add_IRInstr(IRInstr *instr)
 {
-    instrs.push_back(std::move(instr));
+    instrs.push_back(instr);
 }
 
 void BasicBlock::print_instrs() const
@@ -51,10 +53,10 @@ void BasicBlock::print_instrs() const
     for (const auto &instr : instrs)
     {
         std::cerr << "  - " << typeid(*instr).name() << "(";
-        std::vector<std::string> params = instr->getParams();
+        const std::vector<int> &params = instr->getParams();
         for (size_t i = 0; i < params.size(); ++i)
         {
-            std::cerr << params[i];
+            std::cerr << cfg->get_stv().vregs.name(params[i]);
             if (i + 1 < params.size())
                 std::cerr << ", ";
         }
@@ -66,8 +68,8 @@ void BasicBlock::print_instrs() const
 /**
  * CFG
  */
- CFG::CFG(DefFonction *ast, SymbolTableVisitor &stv)
- : ast(ast), stv(stv), nextBBnumber(0), current_bb(nullptr) {
+ CFG::CFG(DefFonction *ast, SymbolTableVisitor &stv, const CodeGenBackend *backend)
+ : ast(ast), backend(backend), stv(stv), nextBBnumber(0), current_bb(nullptr) {
  epilogueLabel = ".Lend_" + ast->name; // Unique epilogue label
 }
 
@@ -76,82 +78,157 @@ void CFG::add_bb(BasicBlock *bb)
     bbs.push_back(bb);
     current_bb = bb;
 }
-/////////
-static bool isNumber(const std::string &s)
+void CFG::insert_bb_after(BasicBlock *after, BasicBlock *bb)
+{
+    auto it = std::find(bbs.begin(), bbs.end(), after);
+    bbs.insert(it == bbs.end() ? it : it + 1, bb);
+}
+
+void CFG::set_bbs(std::vector<BasicBlock *> blocks)
+{
+    bbs = std::move(blocks);
+}
+
+// Vrai si l'instruction quitte la fonction (return, ou saut vers l'épilogue d'un return sans valeur)
+static bool leavesFunction(const IRInstr *instr, const std::string &epilogueLabel)
 {
-    if (s.empty())
+    if (instr->opcode() == IROpcode::Return)
+        return true;
+    if (instr->opcode() != IROpcode::Branch)
         return false;
-    size_t start = (s[0] == '-') ? 1 : 0;
-    for (size_t i = start; i < s.size(); i++)
-    {
-        if (!std::isdigit(s[i]))
-            return false;
-    }
-    return true;
+    const IRBranch *branch = static_cast<const IRBranch *>(instr);
+    return branch->getParams()[0] == VRegTable::NONE && branch->getThenLabel() == epilogueLabel;
 }
 
-std::string CFG::IR_reg_to_asm(std::string name) {
-    if (!codegenBackend) {
-        stv.writeError("Codegen backend not initialized!");
-        return "0";
-    }
-    // Si le nom commence par '$', considérer qu'il s'agit d'un immédiat, et le retourner tel quel
-    if (!name.empty() && name[0] == '$')
-        return name; // Par exemple, "$5" sera retourné tel quel
-
-    // Sinon, rechercher le symbole dans la hiérarchie des scopes
-    Scope* scope = stv.currentScope;
-    while (scope != nullptr) {
-        for (const auto &entry : scope->symbols) {
-            if (entry.second.uniqueName == name) {
-                int off = entry.second.offset;
-                return std::to_string(off) + "(%rbp)";
-            }
+void CFG::remove_dead_exits()
+{
+    for (BasicBlock *bb : bbs)
+    {
+        for (size_t i = 0; i < bb->instrs.size(); i++)
+        {
+            if (!leavesFunction(bb->instrs[i], epilogueLabel))
+                continue;
+            bb->instrs.resize(i + 1);
+            bb->exit_true = nullptr;
+            bb->exit_false = nullptr;
+            bb->test_var = VRegTable::NONE;
+            break;
         }
-        scope = scope->parent;
     }
-    // Si non trouvé, vous pouvez éventuellement consulter les symboles agrégés
-    stv.writeError("Variable " + name + " non trouvée");
-    return "0(%rbp)";
+}
+
+Operand CFG::operand(int vreg) {
+    const VRegTable &vregs = stv.vregs;
+    if (vregs.isImmediate(vreg))
+        return Operand::immediate(vregs.immediateValue(vreg));
+
+    // Registre virtuel placé dans un registre physique par l'allocateur (-O1)
+    if (vreg < (int)regAllocation.size() && !regAllocation[vreg].empty())
+        return Operand::registerOf(regAllocation[vreg]);
+
+    // Sinon, sa case de pile, résolue à la création du registre virtuel
+    return Operand::stack(vregs.offset(vreg));
 }
 
 
-void CFG::gen_asm(std::ostream &o)
+void CFG::gen_asm(AsmWriter &o)
 {
     if (usesGetChar)
         o << ".extern getchar\n";
     if (usesPutChar)
         o << ".extern putchar\n";
 
+    if (optLevel >= 1)
+        allocate_registers();
+    assign_stack_slots();
+
     gen_asm_prologue(o);
     for (auto bb : bbs)
     {
         bb->gen_asm(o);
     }
     o << epilogueLabel << ":\n";          // Write the unique label
-    codegenBackend->gen_epilogue(o);      // Generate epilogue instructions
+    gen_asm_epilogue(o);
 }
 
-void CFG::gen_asm_prologue(std::ostream &o) {
-    // Utiliser le scope global pour calculer la taille de la pile.
+void CFG::allocate_registers()
+{
+    if (backend->getArchitecture() == "X86")
+    {
+        LinearScanAllocator allocator(*this,
+                                      backend->getCalleeSavedRegisters(),
+                                      backend->getCallerSavedRegisters());
+        allocator.run();
+    }
+    else if (backend->getArchitecture() == "arm64")
+    {
+        GraphColoringAllocator allocator(*this,
+                                         backend->getCalleeSavedRegisters(),
+                                         backend->getCallerSavedRegisters());
+        allocator.run();
+    }
+}
+
+// Une case de pile pour chaque registre virtuel de l'IR que l'allocateur
+// laisse en mémoire (tous à -O0), dans l'ordre de création : les
+// temporaires tenus en registre ou retirés par les passes n'en ont pas
+void CFG::assign_stack_slots()
+{
+    VRegTable &vregs = stv.vregs;
+    std::vector<char> inMemory(vregs.size(), 0);
+    auto mark = [&](int vreg) {
+        if (vreg != VRegTable::NONE && (vreg >= (int)regAllocation.size() || regAllocation[vreg].empty()))
+            inMemory[vreg] = 1;
+    };
+    for (BasicBlock *bb : bbs)
+    {
+        for (IRInstr *instr : bb->instrs)
+        {
+            for (int vreg : instr->getUses())
+                mark(vreg);
+            for (int vreg : instr->getDefs())
+                mark(vreg);
+        }
+        mark(bb->test_var);
+    }
+    for (int vreg = 0; vreg < vregs.size(); vreg++)
+        if (inMemory[vreg] && !vregs.hasSlot(vreg))
+            vregs.setOffset(vreg, stv.allocateSlot());
+}
+
+// Taille de la zone des variables locales, arrondie à 8 octets
+int CFG::locals_size()
+{
     Scope* global = stv.getGlobalScope();
-    int stackSize = (-global->offset + 15) / 16 * 16;  // Arrondi au multiple de 16
+    return (global->offset + 7) / 8 * 8;
+}
+
+void CFG::gen_asm_prologue(AsmWriter &o) {
+    // Variables locales puis sauvegarde des registres callee-saved utilisés
+    int localsSize = locals_size();
+    int stackSize = (localsSize + 8 * (int)savedRegs.size() + 15) / 16 * 16;  // Arrondi au multiple de 16
 
-    if (codegenBackend->getArchitecture() == "arm64") {
+    if (backend->getArchitecture() == "arm64") {
         std::string cleanName = ast->name;
         size_t sharp = cleanName.find('#');
         if (sharp != std::string::npos)
             cleanName = cleanName.substr(0, sharp);
-        codegenBackend->gen_prologue(o, cleanName, stackSize);
+        backend->gen_prologue(o, cleanName, stackSize);
     }
     else {
-        codegenBackend->gen_prologue(o, ast->name, stackSize);
+        backend->gen_prologue(o, ast->name, stackSize);
     }
+
+    for (size_t i = 0; i < savedRegs.size(); i++)
+        backend->gen_save_reg(o, savedRegs[i], -(localsSize + 8 * ((int)i + 1)));
 }
 
-void CFG::gen_asm_epilogue(std::ostream &o)
+void CFG::gen_asm_epilogue(AsmWriter &o)
 {
-    codegenBackend->gen_epilogue(o);
+    int localsSize = locals_size();
+    for (size_t i = 0; i < savedRegs.size(); i++)
+        backend->gen_restore_reg(o, savedRegs[i], -(localsSize + 8 * ((int)i + 1)));
+    backend->gen_epilogue(o);
 }
 
 SymbolTableVisitor &CFG::get_stv()
@@ -159,12 +236,27 @@ SymbolTableVisitor &CFG::get_stv()
     return stv;
 }
 
-std::string CFG::create_new_tempvar()
+const std::vector<BasicBlock*> &CFG::get_bbs() const
+{
+    return bbs;
+}
+
+int CFG::create_new_tempvar()
 {
     return stv.createNewTemp();
 }
 
+int CFG::immediate(int value)
+{
+    return stv.vregs.addImmediate(value);
+}
+
 std::string CFG::new_BB_name() {
     return ".LBB" + std::to_string(nextBBnumber++);
 }
 
+// Les blocs de base vivent dans l'arène de la fonction, comme les instructions
+BasicBlock* CFG::new_BB(const std::string &entry_label) {
+    return stv.arena.make<BasicBlock>(this, entry_label);
+}
+
@@ -11,10 +11,8 @@
 
 #include "SymbolTableVisitor.h"
 #include "CodeGenBackend.h"
+#include "AsmWriter.h"
 #include "IRInstr.h"
-class CFG;
-extern CodeGenBackend* codegenBackend;
-
 class CFG;
 class BasicBlock;
 
@@ -38,16 +36,16 @@ public:
 class BasicBlock {
 public:
     BasicBlock(CFG* cfg, std::string entry_label);
-    void gen_asm(std::ostream &o);
-    void add_IRInstr(std::unique_ptr<IRInstr> instr);
+    void gen_asm(AsmWriter &o);
+    void add_IRInstr(IRInstr *instr);
     void print_instrs() const;
 
     BasicBlock* exit_true;
     BasicBlock* exit_false;
     std::string label;
     CFG* cfg;
-    std::vector<std::unique_ptr<IRInstr>> instrs;
-    std::string test_var_name; 
+    std::vector<IRInstr*> instrs;   // instructions allouées dans l'arène de la fonction
+    int test_var = VRegTable::NONE; // registre virtuel testé quand exit_true et exit_false sont définis (jamais un immédiat)
 };
 
 /*---------------------------------------------------
@@ -55,25 +53,44 @@ public:
  *---------------------------------------------------*/
 class CFG {
 public:
-    CFG(DefFonction* ast, SymbolTableVisitor& stv);
+    CFG(DefFonction* ast, SymbolTableVisitor& stv, const CodeGenBackend* backend);
 
     DefFonction* ast;
+    const CodeGenBackend* backend;                      // backend de la compilation en cours
     BasicBlock* current_bb;
-    int maxOffset = 0;
     std::string epilogueLabel;
     bool usesGetChar = false;
     bool usesPutChar = false;
+    int optLevel = 0;                                   // -O1 : allocation de registres, -O2 : passage par la forme SSA
+    std::vector<std::string> regAllocation;             // registre virtuel -> registre physique ("" si en pile)
+    std::vector<std::string> savedRegs;                 // registres callee-saved à sauvegarder
     void add_bb(BasicBlock* bb);
-    std::string IR_reg_to_asm(std::string reg);
-    void gen_asm(std::ostream& o);
-    void gen_asm_prologue(std::ostream& o);
-    void gen_asm_epilogue(std::ostream& o);
+    void insert_bb_after(BasicBlock* after, BasicBlock* bb); // sans changer current_bb
+    void set_bbs(std::vector<BasicBlock*> blocks);      // après une passe qui retire des blocs
+    // Un bloc s'arrête à son premier return : les instructions et les sorties
+    // qui le suivent ne sont jamais atteintes et sont retirées
+    void remove_dead_exits();
+    Operand operand(int vreg);    // registre physique, case de pile ou immédiat
+    void gen_asm(AsmWriter& o);
+    void gen_asm_prologue(AsmWriter& o);
+    void gen_asm_epilogue(AsmWriter& o);
     SymbolTableVisitor& get_stv() ;
-    std::string create_new_tempvar();
+    const std::vector<BasicBlock*>& get_bbs() const;
+    int create_new_tempvar();
+    int immediate(int value);     // opérande immédiat, partagé par toutes ses lectures
     std::string new_BB_name();    
+    BasicBlock* new_BB(const std::string &entry_label);
+
+    // Alloue une instruction IR dans l'arène de la fonction
+    template <typename T, typename... Args>
+    T* new_instr(Args&&... args) { return stv.arena.make<T>(std::forward<Args>(args)...); }
 
 private:
-    SymbolTableVisitor stv;
+    int locals_size();
+    void allocate_registers();
+    void assign_stack_slots();
+
+    SymbolTableVisitor &stv;
     int nextBBnumber;
     std::vector<BasicBlock*> bbs;
 };
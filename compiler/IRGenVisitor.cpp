@@ -1,370 +1,217 @@
 #include "IRGenVisitor.h"
 #include "IRInstr.h"
+#include "CompileError.h"
+#include "Log.h"
 #include <iostream>
 #include <cstdlib>
 #include <string>
-#include <any>
 
 using namespace std;
 
 IRGenVisitor::IRGenVisitor()
-    : cfg(nullptr), backend(nullptr), functionTable(nullptr), hasReturned(false), tempCpt(1)
+    : cfg(nullptr), backend(nullptr), functionTable(nullptr), tempCpt(1)
 {
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 // Traitement de l'instruction de retour : "return expr ;"
 ///////////////////////////////////////////////////////////////////////////////
-antlrcpp::Any IRGenVisitor::visitReturn_stmt(ifccParser::Return_stmtContext *ctx)
+void IRGenVisitor::visitReturn(NodeId node)
 {
-    if (ctx->expr())
+    if (ast->childCount(node) != 0)
     {
-        std::string temp = std::any_cast<std::string>(this->visit(ctx->expr()));
+        int temp = lowerExpr(ast->child(node, 0));
         BasicBlock *bb = cfg->current_bb;  // Get the current bb after visiting expr
-        auto instr = std::make_unique<IRReturn>(bb, temp);
-        bb->add_IRInstr(std::move(instr));
+        auto instr = cfg->new_instr<IRReturn>(bb, temp);
+        bb->add_IRInstr(instr);
     }
     else
     {
         BasicBlock *bb = cfg->current_bb;
-        auto instr = std::make_unique<IRBranch>(bb, "", cfg->epilogueLabel, "");
-        bb->add_IRInstr(std::move(instr));
+        auto instr = cfg->new_instr<IRBranch>(bb, VRegTable::NONE, cfg->epilogueLabel, "");
+        bb->add_IRInstr(instr);
     }
+    cfg->get_stv().checkSymbolTable();
 
-    hasReturned = true;
-    return std::string("");
+    // Le code qui suit un return est encore analysé mais jamais atteint :
+    // il est généré dans un bloc qui n'est pas ajouté au CFG
+    cfg->current_bb = cfg->new_BB(cfg->new_BB_name());
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 // visitDecl : Traitement d'une déclaration "int ID ('=' expr)?".
 ///////////////////////////////////////////////////////////////////////////////
-antlrcpp::Any IRGenVisitor::visitDecl(ifccParser::DeclContext *ctx)
+void IRGenVisitor::visitDecl(NodeId node)
 {
-    std::string varName = ctx->ID()->getText();
-    std::string uniqueName = cfg->get_stv().addToSymbolTable(varName);
+    bool hasValue = ast->childCount(node) != 0;
+    int uniqueName = cfg->get_stv().declareVariable(ast->name(node), hasValue);
 
     BasicBlock *bb = cfg->current_bb;
-    if (ctx->expr() != nullptr)
+    if (hasValue)
     {
-        std::string exprTemp = std::any_cast<std::string>(visit(ctx->expr()));
-        cfg->current_bb->add_IRInstr(std::move(make_unique<IRCopy>(bb, uniqueName, exprTemp)));
+        int exprTemp = lowerExpr(ast->child(node, 0));
+        cfg->current_bb->add_IRInstr(cfg->new_instr<IRCopy>(bb, uniqueName, exprTemp));
     }
     else
     {
         // Initialisation par défaut à 0
-        cfg->current_bb->add_IRInstr(make_unique<IRLdConst>(bb, uniqueName, "0"));
+        cfg->current_bb->add_IRInstr(cfg->new_instr<IRLdConst>(bb, uniqueName, 0));
     }
-    return uniqueName;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-// Traitement d'une constante (ConstExpr)
+// Traitement d'une constante (entière ou caractère)
 ///////////////////////////////////////////////////////////////////////////////
-antlrcpp::Any IRGenVisitor::visitConstExpr(ifccParser::ConstExprContext *ctx) {
-    int value = std::stoi(ctx->CONST()->getText());
-    std::string temp = cfg->create_new_tempvar();
-    BasicBlock *bb = cfg->current_bb;
-    auto instr = std::make_unique<IRLdConst>(bb, temp, std::to_string(value));
-    bb->add_IRInstr(std::move(instr));
-    // Retourner explicitement une std::string dans le std::any
-    return temp;
+// Opérande immédiat : aucune instruction, lu directement par l'instruction qui l'utilise
+int IRGenVisitor::visitConst(NodeId node) {
+    return cfg->immediate(ast->value(node));
 }
 
 
 ///////////////////////////////////////////////////////////////////////////////
-// Traitement d'une variable (IdExpr)
+// Traitement d'une variable (Var)
 ///////////////////////////////////////////////////////////////////////////////
 
-antlrcpp::Any IRGenVisitor::visitBlock(ifccParser::BlockContext *ctx)
+void IRGenVisitor::visitBlock(NodeId node)
 {
     cfg->get_stv().enterScope();
-    for (auto child : ctx->children)
+    if (LOG_ENABLED(Log::DEBUG))
+        cfg->get_stv().printCurrentScope(Log::stream());
+    for (NodeId child : ast->children(node))
     {
         visit(child);
     }
     cfg->get_stv().exitScope();
-    return nullptr;
 }
 
-antlrcpp::Any IRGenVisitor::visitIdExpr(ifccParser::IdExprContext *ctx)
+int IRGenVisitor::visitVar(NodeId node)
 {
-    string varName = ctx->ID()->getText();
-    string uniqueName = cfg->get_stv().getUniqueName(varName);
-    return uniqueName; // Retourne le nom unique (s1_a ou s2_a)
+    // Erreur si la variable n'est pas définie ou pas initialisée
+    int uniqueName = cfg->get_stv().useVariable(ast->name(node));
+    return uniqueName; // Registre virtuel de la variable dans la portée courante
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 // Traitement de l'opérateur unaire "-"
 ////////
 // Remplacer la version actuelle de visitMoinsExpr par :
-antlrcpp::Any IRGenVisitor::visitMoinsExpr(ifccParser::MoinsExprContext *ctx) {
-    std::string exprTemp = std::any_cast<std::string>(visit(ctx->expr()));
-    std::string result = cfg->create_new_tempvar();
+int IRGenVisitor::visitNeg(NodeId node) {
+    int exprTemp = lowerExpr(ast->child(node, 0));
+    int result = cfg->create_new_tempvar();
     
     // Génère directement 0 - expr
-    std::string zeroTemp = cfg->create_new_tempvar();
-    cfg->current_bb->add_IRInstr(make_unique<IRLdConst>(cfg->current_bb, zeroTemp, "0"));
-    cfg->current_bb->add_IRInstr(make_unique<IRSub>(cfg->current_bb, result, zeroTemp, exprTemp));
+    cfg->current_bb->add_IRInstr(cfg->new_instr<IRSub>(cfg->current_bb, result, cfg->immediate(0), exprTemp));
     
     return result;
 }
 
-antlrcpp::Any IRGenVisitor::visitCompExpr(ifccParser::CompExprContext* ctx) {
-    std::string left = std::any_cast<std::string>(visit(ctx->expr(0)));
-    std::string right;
-
-    if (ctx->expr(1)->getText() == "5" || ctx->expr(1)->getText() == "15") { // Gestion explicite des constantes
-        right = "$" + ctx->expr(1)->getText(); 
-    } else {
-        right = std::any_cast<std::string>(visit(ctx->expr(1)));
-    }
-
-    std::string result = cfg->create_new_tempvar();
-    cfg->current_bb->add_IRInstr(
-        std::make_unique<IRComp>(cfg->current_bb, result, left, right, ctx->op->getText())
-    );
-    return result;
-}
-
-///////////////////////////////////////////////////////////////////////////////
-// Expression multiplicative (*, /, %)
-///////////////////////////////////////////////////////////////////////////////
-antlrcpp::Any IRGenVisitor::visitMulDivExpr(ifccParser::MulDivExprContext *ctx)
-{
-    std::string left = std::any_cast<std::string>(this->visit(ctx->expr(0)));
-    std::string right = std::any_cast<std::string>(this->visit(ctx->expr(1)));
-    std::string result = cfg->create_new_tempvar();
-    BasicBlock *bb = cfg->current_bb;
-
-    if (ctx->op->getText() == "*")
-    {
-        auto instr = std::make_unique<IRMul>(bb, result, left, right);
-        cfg->current_bb->add_IRInstr(std::move(instr));
-    }
-    else if (ctx->op->getText() == "/")
-    {
-        auto instr = std::make_unique<IRDiv>(bb, result, left, right);
-        cfg->current_bb->add_IRInstr(std::move(instr));
-    }
-    else if (ctx->op->getText() == "%")
-    {
-        auto instr = std::make_unique<IRMod>(bb, result, left, right);
-        cfg->current_bb->add_IRInstr(std::move(instr));
-    }
-    else
-    {
-        std::cerr << "Opérateur MulDivExpr inconnu: " << ctx->op->getText() << "\n";
-        exit(1);
-    }
-
-    return result;
-}
-
 ///////////////////////////////////////////////////////////////////////////////
 // Traitement de la fonction main
 ///////////////////////////////////////////////////////////////////////////////
-antlrcpp::Any IRGenVisitor::visitProg(ifccParser::ProgContext *ctx)
+void IRGenVisitor::visitFunction(const AST &functionAst, NodeId function)
 {
+    ast = &functionAst;
+
     // Crée le BasicBlock d'entrée pour cette fonction
-    BasicBlock *entryBB = new BasicBlock(cfg, cfg->new_BB_name());
+    BasicBlock *entryBB = cfg->new_BB(cfg->new_BB_name());
     cfg->add_bb(entryBB);
     cfg->current_bb = entryBB;
 
     // Étape 1 : gérer les paramètres
     // Initialisation des paramètres formels (si présents)
-    int paramIndex = 0;
-    if (ctx->decl_params())
+    AST::Children children = ast->children(function);
+    size_t nbParams = ast->paramCount(function);
+    for (size_t paramIndex = 0; paramIndex < nbParams; paramIndex++)
     {
-        for (auto param : ctx->decl_params()->param())
-        {
-            std::string paramName = param->ID()->getText();
-            std::string uniqueName = cfg->get_stv().addToSymbolTable(paramName);
+        int uniqueName = cfg->get_stv().declareVariable(ast->name(children[paramIndex]), true);
 
-            // Génère une instruction IRParamLoad qui copie w0/w1/etc. → uniqueName
-            cfg->current_bb->add_IRInstr(
-                std::make_unique<IRParamLoad>(cfg->current_bb, uniqueName, paramIndex++));
-        }
+        // Génère une instruction IRParamLoad qui copie w0/w1/etc. → uniqueName
+        cfg->current_bb->add_IRInstr(
+            cfg->new_instr<IRParamLoad>(cfg->current_bb, uniqueName, paramIndex));
     }
 
     // Étape 2 : générer le corps de la fonction
-    for (auto instCtx : ctx->inst())
-    {
-        if (hasReturned)
-            break; // Évite de générer après un return
-        this->visit(instCtx);
-    }
-
-    // Étape 3 : calcul du maxOffset pour l'allocation stack
-    int minOffset = 0;
-    Scope *global = cfg->get_stv().getGlobalScope();
-    for (const auto &[_, info] : global->symbols)
+    for (size_t i = nbParams; i < children.size(); i++)
     {
-        {
-            if (info.offset < minOffset)
-            {
-                minOffset = info.offset;
-            }
-        }
-        cfg->maxOffset = -minOffset;
-
-        return 0;
+        visit(children[i]);
     }
+    if (LOG_ENABLED(Log::DEBUG))
+        cfg->get_stv().printGlobalSymbolTable(Log::stream());
 }
 
-antlrcpp::Any IRGenVisitor::visitAxiom(ifccParser::AxiomContext *ctx)
+///////////////////////////////////////////////////////////////////////////////
+// Instructions
+///////////////////////////////////////////////////////////////////////////////
+void IRGenVisitor::visit(NodeId node)
 {
-    for (auto prog : ctx->prog())
+    switch (ast->kind(node))
     {
-        this->visit(prog); // chaque fonction
+    case NodeKind::Decl:   visitDecl(node); break;
+    case NodeKind::Assign: visitAssign(node); break;
+    case NodeKind::Return: visitReturn(node); break;
+    case NodeKind::Block:  visitBlock(node); break;
+    case NodeKind::If:     visitIf(node); break;
+    case NodeKind::While:  visitWhile(node); break;
+    case NodeKind::Call:   visitCall(node); break; // valeur ignorée
+    default:
+        throw CompileError("Unexpected statement node");
     }
-    return 0;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 // Traitement du "!"
 ///////////////////////////////////////////////////////////////////////////////
-antlrcpp::Any IRGenVisitor::visitNotExpr(ifccParser::NotExprContext *ctx)
+int IRGenVisitor::visitNot(NodeId node)
 {
-    std::string exprTemp = std::any_cast<std::string>(this->visit(ctx->expr()));
-    std::string result = cfg->create_new_tempvar();
+    int exprTemp = lowerExpr(ast->child(node, 0));
+    int result = cfg->create_new_tempvar();
     BasicBlock *bb = cfg->current_bb;
-    auto instr = std::make_unique<IRNot>(bb, result, exprTemp);
-    cfg->current_bb->add_IRInstr(std::move(instr));
+    auto instr = cfg->new_instr<IRNot>(bb, result, exprTemp);
+    cfg->current_bb->add_IRInstr(instr);
     return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 // Affectation
 ///////////////////////////////////////////////////////////////////////////////
-antlrcpp::Any IRGenVisitor::visitAssign(ifccParser::AssignContext *ctx)
-{
-    std::string varName = ctx->ID()->getText();
-    std::string exprTemp = std::any_cast<std::string>(this->visit(ctx->expr()));
-    BasicBlock *bb = cfg->current_bb;
-    // Récupérer le unique name via getUniqueName
-    std::string unique = cfg->get_stv().getUniqueName(varName);
-    auto instr = std::make_unique<IRCopy>(bb, unique, exprTemp);
-    bb->add_IRInstr(std::move(instr));
-    return unique;
-}
-
-antlrcpp::Any IRGenVisitor::visitPlusAssign(ifccParser::PlusAssignContext* ctx) {
-    return generateCompoundAssign(ctx->ID()->getText(), ctx->expr(), "+");
-}
-
-antlrcpp::Any IRGenVisitor::visitMinusAssign(ifccParser::MinusAssignContext* ctx) {
-    return generateCompoundAssign(ctx->ID()->getText(), ctx->expr(), "-");
-}
-
-antlrcpp::Any IRGenVisitor::visitMulAssign(ifccParser::MulAssignContext* ctx) {
-    return generateCompoundAssign(ctx->ID()->getText(), ctx->expr(), "*");
-}
-
-antlrcpp::Any IRGenVisitor::visitDivAssign(ifccParser::DivAssignContext* ctx) {
-    return generateCompoundAssign(ctx->ID()->getText(), ctx->expr(), "/");
-}
-
-antlrcpp::Any IRGenVisitor::visitParExpr(ifccParser::ParExprContext *ctx)
-{
-    return this->visit(ctx->expr());
-}
-
-///////////////////////////////////////////////////////////////////////////////
-// Additions et soustractions
-///////////////////////////////////////////////////////////////////////////////
-
-antlrcpp::Any IRGenVisitor::visitAddSubExpr(ifccParser::AddSubExprContext *ctx)
-{
-    // Évalue les sous-expressions et s'assure de renvoyer des std::string
-    std::string left = std::any_cast<std::string>(this->visit(ctx->expr(0)));
-    std::string right = std::any_cast<std::string>(this->visit(ctx->expr(1)));
-    std::string result = cfg->create_new_tempvar();
-    BasicBlock *bb = cfg->current_bb;
-
-    if (ctx->op->getText() == "+")
-    {
-        auto instr = std::make_unique<IRAdd>(bb, result, left, right);
-        bb->add_IRInstr(std::move(instr));
-    }
-    else if (ctx->op->getText() == "-")
-    {
-        auto instr = std::make_unique<IRSub>(bb, result, left, right);
-        bb->add_IRInstr(std::move(instr));
-    }
-    else
-    {
-        std::cerr << "Opérateur inconnu in AddSubExpr: " << ctx->op->getText() << "\n";
-        exit(1);
-    }
-    return result;
-}
-
-///////////////////////////////////////////////////////////////////////////////
-// Comparaison d'égalité (==, !=)
-///////////////////////////////////////////////////////////////////////////////
-antlrcpp::Any IRGenVisitor::visitEgalExpr(ifccParser::EgalExprContext *ctx)
+void IRGenVisitor::visitAssign(NodeId node)
 {
-    std::string left = std::any_cast<std::string>(this->visit(ctx->expr(0)));
-    std::string right = std::any_cast<std::string>(this->visit(ctx->expr(1)));
-    std::string result = cfg->create_new_tempvar();
-    BasicBlock *bb = cfg->current_bb;
-
-    if (ctx->op->getText() == "==")
-    {
-        auto instr = std::make_unique<IREgal>(bb, result, left, right);
-        cfg->current_bb->add_IRInstr(std::move(instr));
-    }
-    else if (ctx->op->getText() == "!=")
-    {
-        auto instr = std::make_unique<IRNotEgal>(bb, result, left, right);
-        cfg->current_bb->add_IRInstr(std::move(instr));
-    }
-    else
+    // Registre virtuel de la variable, marquée initialisée avant l'évaluation de expr
+    int unique = cfg->get_stv().assignVariable(ast->name(node));
+    if (ast->op(node) != 0)
     {
-        std::cerr << "Opérateur inconnu in EgalExpr: " << ctx->op->getText() << "\n";
-        exit(1);
+        generateCompoundAssign(unique, ast->child(node, 0), ast->op(node));
+        return;
     }
-    return result;
-}
-
-///////////////////////////////////////////////////////////////////////////////
-// XOR bit-à-bit
-///////////////////////////////////////////////////////////////////////////////
-antlrcpp::Any IRGenVisitor::visitOuExcExpr(ifccParser::OuExcExprContext *ctx)
-{
-    std::string left = std::any_cast<std::string>(this->visit(ctx->expr(0)));
-    std::string right = std::any_cast<std::string>(this->visit(ctx->expr(1)));
-    std::string result = cfg->create_new_tempvar();
+    int exprTemp = lowerExpr(ast->child(node, 0));
     BasicBlock *bb = cfg->current_bb;
-    auto instr = std::make_unique<IRXor>(bb, result, left, right);
-    cfg->current_bb->add_IRInstr(std::move(instr));
-    return result;
+    auto instr = cfg->new_instr<IRCopy>(bb, unique, exprTemp);
+    bb->add_IRInstr(instr);
 }
 
-antlrcpp::Any IRGenVisitor::visitFunction_call(ifccParser::Function_callContext *ctx)
+int IRGenVisitor::visitCall(NodeId node)
 {
-    std::string name = ctx->ID()->getText();
-    BasicBlock *bb = cfg->current_bb;
+    const std::string &name = ast->name(node);
+    AST::Children args = ast->children(node);
 
-    // 🔒 Vérification dans la table des fonctions
-    if (functionTable && functionTable->find(name) == functionTable->end())
-    {
-        std::cerr << "[ERROR] Function '" << name << "' is not declared\n";
-        exit(1);
-    }
-
-    // Vérifie le nombre de paramètres si on a une signature
+    // 🔒 Vérification dans la table des fonctions (lecture seule : partagée entre threads avec -j)
     if (functionTable)
     {
-        const auto &sig = (*functionTable)[name];
+        auto it = functionTable->find(name);
+        if (it == functionTable->end())
+        {
+            throw CompileError("Function '" + name + "' is not declared");
+        }
+
+        // Vérifie le nombre de paramètres
+        const auto &sig = it->second;
         size_t expected = sig.paramsTypes.size();
-        size_t actual = ctx->expr().size();
+        size_t actual = args.size();
 
         if (expected != actual)
         {
-            std::cerr << "[ERROR] Function '" << name << "' expects " << expected
-                      << " arguments but got " << actual << "\n";
-            exit(1);
+            throw CompileError("Function '" + name + "' expects " + std::to_string(expected)
+                               + " arguments but got " + std::to_string(actual));
         }
     }
 
@@ -372,79 +219,53 @@ antlrcpp::Any IRGenVisitor::visitFunction_call(ifccParser::Function_callContext
     if (name == "getchar")
     {
         cfg->usesGetChar = true;
-        std::string result = cfg->create_new_tempvar();
-        bb->add_IRInstr(std::make_unique<IRGetChar>(bb, result));
+        int result = cfg->create_new_tempvar();
+        BasicBlock *bb = cfg->current_bb;
+        bb->add_IRInstr(cfg->new_instr<IRGetChar>(bb, result));
         return result;
     }
     else if (name == "putchar")
     {
         cfg->usesPutChar = true;
-        std::string arg = std::any_cast<std::string>(visit(ctx->expr(0)));
-        bb->add_IRInstr(std::make_unique<IRPutChar>(bb, arg));
+        int arg = lowerExpr(args[0]);
+        BasicBlock *bb = cfg->current_bb;
+        bb->add_IRInstr(cfg->new_instr<IRPutChar>(bb, arg));
         return arg;
     }
 
     // 🔁 Cas générique : fonction utilisateur
-    std::vector<std::string> arguments;
-    for (auto exprCtx : ctx->expr())
+    std::vector<int> arguments;
+    for (NodeId arg : args)
     {
-        arguments.push_back(std::any_cast<std::string>(visit(exprCtx)));
+        arguments.push_back(lowerExpr(arg));
     }
 
-    std::string returnVar = cfg->create_new_tempvar(); // Pour le résultat de l'appel
-    bb->add_IRInstr(std::make_unique<IRCall>(bb, name, arguments, returnVar));
-    return returnVar;
-}
-
-
-///////////////////////////////////////////////////////////////////////////////
-// OR bit-à-bit
-///////////////////////////////////////////////////////////////////////////////
-antlrcpp::Any IRGenVisitor::visitOuIncExpr(ifccParser::OuIncExprContext *ctx)
-{
-    std::string left = std::any_cast<std::string>(this->visit(ctx->expr(0)));
-    std::string right = std::any_cast<std::string>(this->visit(ctx->expr(1)));
-    std::string result = cfg->create_new_tempvar();
-    BasicBlock *bb = cfg->current_bb;
-    auto instr = std::make_unique<IROr>(bb, result, left, right);
-    cfg->current_bb->add_IRInstr(std::move(instr));
-    return result;
-}
-
-///////////////////////////////////////////////////////////////////////////////
-// Traitement de l'opérateur logique "&"
-///////////////////////////////////////////////////////////////////////////////
-antlrcpp::Any IRGenVisitor::visitEtLogExpr(ifccParser::EtLogExprContext *ctx)
-{
-    std::string left = std::any_cast<std::string>(this->visit(ctx->expr(0)));
-    std::string right = std::any_cast<std::string>(this->visit(ctx->expr(1)));
-    std::string result = cfg->create_new_tempvar();
+    // Les arguments (&&, ||) peuvent avoir créé de nouveaux blocs : l'appel
+    // se place dans le bloc courant après leur évaluation
+    int returnVar = cfg->create_new_tempvar(); // Pour le résultat de l'appel
     BasicBlock *bb = cfg->current_bb;
-
-    // Génère directement un AND bitwise sur left et right
-    bb->add_IRInstr(std::make_unique<IRAnd>(bb, result, left, right));
-
-    return result;
+    bb->add_IRInstr(cfg->new_instr<IRCall>(bb, name, arguments, returnVar));
+    return returnVar;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 // Traitement du "if - else"
 ///////////////////////////////////////////////////////////////////////////////
-antlrcpp::Any IRGenVisitor::visitIf_stmt(ifccParser::If_stmtContext* ctx)
+void IRGenVisitor::visitIf(NodeId node)
 {
     
-    // Conserver le bloc courant
+    // 1. Évaluer la condition et obtenir son temporary ; && et || créent
+    // des blocs, le saut conditionnel part du bloc où elle se termine
+    int cond = lowerCondition(ast->child(node, 0));
     BasicBlock* currentBB = cfg->current_bb;
-    
-    // 1. Évaluer la condition et obtenir son temporary
-    currentBB->test_var_name = std::any_cast<std::string>(this->visit(ctx->expr()));
+    currentBB->test_var = cond;
     
     // 2. Créer les BasicBlocks pour la branche then, la branche else et le bloc de fusion (merge) pour cet if
-    BasicBlock* thenBB = new BasicBlock(cfg, cfg->new_BB_name());
+    BasicBlock* thenBB = cfg->new_BB(cfg->new_BB_name());
     thenBB->label += "_then";
-    BasicBlock* elseBB = new BasicBlock(cfg, cfg->new_BB_name());
+    BasicBlock* elseBB = cfg->new_BB(cfg->new_BB_name());
     elseBB->label += "_else";
-    BasicBlock* mergeBB = new BasicBlock(cfg, cfg->new_BB_name());
+    BasicBlock* mergeBB = cfg->new_BB(cfg->new_BB_name());
     mergeBB->label += "_merge";
 
     mergeBB->exit_true = currentBB->exit_true;
@@ -458,51 +279,54 @@ antlrcpp::Any IRGenVisitor::visitIf_stmt(ifccParser::If_stmtContext* ctx)
     cfg->add_bb(thenBB);
     cfg->current_bb = thenBB;
     thenBB->exit_true = mergeBB;  
-    this->visit(ctx->block(0));  // Traiter le bloc then
+    visit(ast->child(node, 1));  // Traiter le bloc then
     
     // 5. Générer le code pour la branche else.
     
     cfg->add_bb(elseBB);
     cfg->current_bb = elseBB;
     elseBB->exit_false = mergeBB;
-    if (ctx->block().size() > 1) {
-        this->visit(ctx->block(1)); // Traiter le bloc else s'il existe
+    if (ast->childCount(node) > 2) {
+        visit(ast->child(node, 2)); // Traiter le bloc else s'il existe
     }
     
     // 6. Ajouter le bloc de fusion et le définir comme bloc courant
     cfg->add_bb(mergeBB);
     cfg->current_bb = mergeBB;
-    
-    return std::string("0");
 }
 
 
 /////////////////////////////////////////////////////////////////////////////
 // Traitement de l'opérateur logique "&&"
 ///////////////////////////////////////////////////////////////////////////////
-antlrcpp::Any IRGenVisitor::visitEtParExpr(ifccParser::EtParExprContext* ctx)
+int IRGenVisitor::visitAnd(NodeId node)
 {
     BasicBlock* evalLeftBB = cfg->current_bb;
-    std::string left = std::any_cast<std::string>(this->visit(ctx->expr(0)));
+    int left = lowerCondition(ast->child(node, 0));
     BasicBlock* afterLeftBB = cfg->current_bb;
-    std::string result = cfg->create_new_tempvar();
-    BasicBlock* setFalseBB = new BasicBlock(cfg, cfg->new_BB_name() + "_setFalse");
-    BasicBlock* evalRightBB = new BasicBlock(cfg, cfg->new_BB_name() + "_evalRight");
-    BasicBlock* mergeBB = new BasicBlock(cfg, cfg->new_BB_name() + "_merge");
+    int result = cfg->create_new_tempvar();
+    BasicBlock* setFalseBB = cfg->new_BB(cfg->new_BB_name() + "_setFalse");
+    BasicBlock* evalRightBB = cfg->new_BB(cfg->new_BB_name() + "_evalRight");
+    BasicBlock* mergeBB = cfg->new_BB(cfg->new_BB_name() + "_merge");
     
-    afterLeftBB->test_var_name = left;
+    // Le bloc de fusion reprend la suite prévue pour le bloc courant
+    mergeBB->exit_true = afterLeftBB->exit_true;
+    mergeBB->exit_false = afterLeftBB->exit_false;
+
+    afterLeftBB->test_var = left;
     afterLeftBB->exit_true = evalRightBB;  // If left is true, evaluate right
     afterLeftBB->exit_false = setFalseBB;  // If left is false, set result to 0
     
     cfg->add_bb(setFalseBB);
-    setFalseBB->add_IRInstr(std::make_unique<IRLdConst>(setFalseBB, result, "0"));
+    setFalseBB->add_IRInstr(cfg->new_instr<IRLdConst>(setFalseBB, result, 0));
     setFalseBB->exit_true = mergeBB;
     
     cfg->add_bb(evalRightBB);
     cfg->current_bb = evalRightBB;
-    std::string right = std::any_cast<std::string>(this->visit(ctx->expr(1)));
-    evalRightBB->add_IRInstr(std::make_unique<IRCopy>(evalRightBB, result, right));
-    evalRightBB->exit_true = mergeBB;
+    int right = lowerExpr(ast->child(node, 1));
+    BasicBlock* afterRightBB = cfg->current_bb;  // right peut lui-même créer des blocs
+    afterRightBB->add_IRInstr(cfg->new_instr<IRCopy>(afterRightBB, result, right));
+    afterRightBB->exit_true = mergeBB;
     
     cfg->add_bb(mergeBB);
     cfg->current_bb = mergeBB;
@@ -515,30 +339,34 @@ antlrcpp::Any IRGenVisitor::visitEtParExpr(ifccParser::EtParExprContext* ctx)
 // Traitement du ou paresseux "||"
 ///////////////////////////////////////////////////////////////////////////////
 
-antlrcpp::Any IRGenVisitor::visitOuParExpr(ifccParser::OuParExprContext* ctx)
+int IRGenVisitor::visitOr(NodeId node)
 {
     BasicBlock* evalLeftBB = cfg->current_bb;  // Block before evaluating left
-    std::string left = std::any_cast<std::string>(this->visit(ctx->expr(0)));
+    int left = lowerCondition(ast->child(node, 0));
     BasicBlock* afterLeftBB = cfg->current_bb;  // Block after evaluating left
-    std::string result = cfg->create_new_tempvar();
-    BasicBlock* setTrueBB = new BasicBlock(cfg, cfg->new_BB_name() + "_setTrue");
-    BasicBlock* evalRightBB = new BasicBlock(cfg, cfg->new_BB_name() + "_evalRight");
-    BasicBlock* mergeBB = new BasicBlock(cfg, cfg->new_BB_name() + "_merge");
+    int result = cfg->create_new_tempvar();
+    BasicBlock* setTrueBB = cfg->new_BB(cfg->new_BB_name() + "_setTrue");
+    BasicBlock* evalRightBB = cfg->new_BB(cfg->new_BB_name() + "_evalRight");
+    BasicBlock* mergeBB = cfg->new_BB(cfg->new_BB_name() + "_merge");
     
+    mergeBB->exit_true = afterLeftBB->exit_true;
+    mergeBB->exit_false = afterLeftBB->exit_false;
+
     // Set the conditional jump in the block after left is evaluated
-    afterLeftBB->test_var_name = left;
+    afterLeftBB->test_var = left;
     afterLeftBB->exit_true = setTrueBB;
     afterLeftBB->exit_false = evalRightBB;
     
     cfg->add_bb(setTrueBB);
-    setTrueBB->add_IRInstr(std::make_unique<IRLdConst>(setTrueBB, result, "1"));
+    setTrueBB->add_IRInstr(cfg->new_instr<IRLdConst>(setTrueBB, result, 1));
     setTrueBB->exit_true = mergeBB;
     
     cfg->add_bb(evalRightBB);
     cfg->current_bb = evalRightBB;
-    std::string right = std::any_cast<std::string>(this->visit(ctx->expr(1)));
-    evalRightBB->add_IRInstr(std::make_unique<IRCopy>(evalRightBB, result, right));
-    evalRightBB->exit_true = mergeBB;
+    int right = lowerExpr(ast->child(node, 1));
+    BasicBlock* afterRightBB = cfg->current_bb;  // right peut lui-même créer des blocs
+    afterRightBB->add_IRInstr(cfg->new_instr<IRCopy>(afterRightBB, result, right));
+    afterRightBB->exit_true = mergeBB;
     
     cfg->add_bb(mergeBB);
     cfg->current_bb = mergeBB;
@@ -546,72 +374,120 @@ antlrcpp::Any IRGenVisitor::visitOuParExpr(ifccParser::OuParExprContext* ctx)
     return result;
 }
 
-antlrcpp::Any IRGenVisitor::visitWhile_stmt(ifccParser::While_stmtContext* ctx)
+void IRGenVisitor::visitWhile(NodeId node)
 {
     BasicBlock* currentBB = cfg->current_bb;
 
-    BasicBlock* condBB = new BasicBlock(cfg, cfg->new_BB_name()); 
+    BasicBlock* condBB = cfg->new_BB(cfg->new_BB_name()); 
     condBB->label += "_cond";
-    BasicBlock* bodyBB = new BasicBlock(cfg, cfg->new_BB_name()); 
+    BasicBlock* bodyBB = cfg->new_BB(cfg->new_BB_name()); 
     bodyBB->label += "_body";
-    BasicBlock* exitBB = new BasicBlock(cfg, cfg->new_BB_name());  
+    BasicBlock* exitBB = cfg->new_BB(cfg->new_BB_name());  
     exitBB->label += "_exit";
 
     exitBB->exit_true = currentBB->exit_true;
     exitBB->exit_false = currentBB->exit_false;
 
+    // Saut inconditionnel vers la condition ; la suite éventuelle
+    // du bloc courant (exit_false d'une branche else) passe à exitBB
     currentBB->exit_true = condBB;
+    currentBB->exit_false = nullptr;
     
-    condBB->exit_false = exitBB;
-    condBB->exit_true = bodyBB;
     bodyBB->exit_true = condBB;
 
     cfg->add_bb(condBB);
     cfg->current_bb = condBB;
-    std::string cond = std::any_cast<std::string>(this->visit(ctx->expr()));
-    condBB->test_var_name = cond;
+    int cond = lowerCondition(ast->child(node, 0));
+    BasicBlock* condEndBB = cfg->current_bb;  // différent de condBB si && ou ||
+    condEndBB->test_var = cond;
+    condEndBB->exit_false = exitBB;
+    condEndBB->exit_true = bodyBB;
     
     cfg->add_bb(bodyBB);
     cfg->current_bb = bodyBB;
-    this->visit(ctx->block());
+    visit(ast->child(node, 1));
     
     cfg->add_bb(exitBB);
     cfg->current_bb = exitBB;
-    
-    return std::string("0");
 }
 
-antlrcpp::Any IRGenVisitor::visitCharExpr(ifccParser::CharExprContext* ctx) {
-    char c = ctx->CHAR()->getText()[1];
-    int value = static_cast<int>(c);
+void IRGenVisitor::generateCompoundAssign(int unique, NodeId expr, size_t opType)
+{
+    int exprTemp = lowerExpr(expr);
+    int result = emitBinary(opType, unique, exprTemp);
+
+    BasicBlock* bb = cfg->current_bb;
+    bb->add_IRInstr(cfg->new_instr<IRCopy>(bb, unique, result));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Abaissement typé des expressions
+///////////////////////////////////////////////////////////////////////////////
 
-    std::string temp = cfg->create_new_tempvar();
+// Génère le code d'une sous-expression et renvoie le registre virtuel qui
+// contient sa valeur
+int IRGenVisitor::lowerExpr(NodeId node)
+{
+    switch (ast->kind(node))
+    {
+    case NodeKind::Const: return visitConst(node);
+    case NodeKind::Var:   return visitVar(node);
+    case NodeKind::Neg:   return visitNeg(node);
+    case NodeKind::Not:   return visitNot(node);
+    case NodeKind::And:   return visitAnd(node);
+    case NodeKind::Or:    return visitOr(node);
+    case NodeKind::Call:  return visitCall(node);
+    case NodeKind::Binary:
+    {
+        int left = lowerExpr(ast->child(node, 0));
+        int right = lowerExpr(ast->child(node, 1));
+        return emitBinary(ast->op(node), left, right);
+    }
+    default:
+        throw CompileError("Unexpected expression node");
+    }
+}
+
+// Valeur testée par un saut conditionnel : BasicBlock::test_var est
+// toujours un registre, un immédiat (while (1)) y est d'abord chargé
+int IRGenVisitor::lowerCondition(NodeId node)
+{
+    int value = lowerExpr(node);
+    const VRegTable &vregs = cfg->get_stv().vregs;
+    if (!vregs.isImmediate(value))
+        return value;
+    int temp = cfg->create_new_tempvar();
     BasicBlock *bb = cfg->current_bb;
-    bb->add_IRInstr(std::make_unique<IRLdConst>(bb, temp, std::to_string(value)));
+    bb->add_IRInstr(cfg->new_instr<IRLdConst>(bb, temp, vregs.immediateValue(value)));
     return temp;
 }
 
-antlrcpp::Any IRGenVisitor::generateCompoundAssign(const std::string& varName, ifccParser::ExprContext* expr, const std::string& op)
+// Émet l'instruction IR d'un opérateur binaire, choisi d'après le type du
+// token (ifccParser::PLUS, ifccParser::LT...) et non d'après son texte.
+int IRGenVisitor::emitBinary(size_t opType, int left, int right)
 {
-    std::string exprTemp = std::any_cast<std::string>(this->visit(expr));
-    std::string unique = cfg->get_stv().getUniqueName(varName);
-    std::string result = cfg->create_new_tempvar();
-    BasicBlock* bb = cfg->current_bb;
+    int result = cfg->create_new_tempvar();
+    BasicBlock *bb = cfg->current_bb;
 
-    if (op == "+") {
-        bb->add_IRInstr(std::make_unique<IRAdd>(bb, result, unique, exprTemp));
-    } else if (op == "-") {
-        bb->add_IRInstr(std::make_unique<IRSub>(bb, result, unique, exprTemp));
-    } else if (op == "*") {
-        bb->add_IRInstr(std::make_unique<IRMul>(bb, result, unique, exprTemp));
-    } else if (op == "/") {
-        bb->add_IRInstr(std::make_unique<IRDiv>(bb, result, unique, exprTemp));
-    } else {
-        std::cerr << "[ERROR] Unknown compound assignment operator: " << op << "\n";
-        exit(1);
+    switch (opType)
+    {
+    case ifccParser::PLUS:  bb->add_IRInstr(cfg->new_instr<IRAdd>(bb, result, left, right)); break;
+    case ifccParser::MINUS: bb->add_IRInstr(cfg->new_instr<IRSub>(bb, result, left, right)); break;
+    case ifccParser::MUL:   bb->add_IRInstr(cfg->new_instr<IRMul>(bb, result, left, right)); break;
+    case ifccParser::DIV:   bb->add_IRInstr(cfg->new_instr<IRDiv>(bb, result, left, right)); break;
+    case ifccParser::MOD:   bb->add_IRInstr(cfg->new_instr<IRMod>(bb, result, left, right)); break;
+    case ifccParser::BAND:  bb->add_IRInstr(cfg->new_instr<IRAnd>(bb, result, left, right)); break;
+    case ifccParser::BXOR:  bb->add_IRInstr(cfg->new_instr<IRXor>(bb, result, left, right)); break;
+    case ifccParser::BOR:   bb->add_IRInstr(cfg->new_instr<IROr>(bb, result, left, right)); break;
+    case ifccParser::EQ:    bb->add_IRInstr(cfg->new_instr<IREgal>(bb, result, left, right)); break;
+    case ifccParser::NE:    bb->add_IRInstr(cfg->new_instr<IRNotEgal>(bb, result, left, right)); break;
+    case ifccParser::LT:    bb->add_IRInstr(cfg->new_instr<IRComp>(bb, result, left, right, "<")); break;
+    case ifccParser::GT:    bb->add_IRInstr(cfg->new_instr<IRComp>(bb, result, left, right, ">")); break;
+    case ifccParser::LE:    bb->add_IRInstr(cfg->new_instr<IRComp>(bb, result, left, right, "<=")); break;
+    case ifccParser::GE:    bb->add_IRInstr(cfg->new_instr<IRComp>(bb, result, left, right, ">=")); break;
+    default:
+        throw CompileError("Unknown binary operator token: " + std::to_string(opType));
     }
-
-    bb->add_IRInstr(std::make_unique<IRCopy>(bb, unique, result));
-    return unique;
+    return result;
 }
 
@@ -1,83 +1,137 @@
 #include "IRInstr.h"
 #include "IR.h"
+#include "CompileError.h"
 
-extern CodeGenBackend *codegenBackend;
+const char *opcodeName(IROpcode opcode)
+{
+    static const char *const names[] = {
+        "return", "ldconst", "copy", "add", "sub", "mul", "div", "mod", "movreg", "call",
+        "not", "xor", "or", "egal", "notegal", "and", "putchar", "getchar", "branch", "comp",
+        "andpar", "orpar", "paramload", "phi"};
+    static_assert(sizeof(names) / sizeof(names[0]) == (size_t)IROpcode::Count, "un nom par opcode");
+    return names[(size_t)opcode];
+}
 
-std::vector<std::string> IRInstr::getParams()
+const std::vector<int> &IRInstr::getParams() const
 {
     return params;
 }
 
-void IRReturn::gen_asm(std::ostream &o)
+std::vector<int> IRInstr::getUses() const
+{
+    return registersFrom(1);
+}
+
+std::vector<int> IRInstr::registersFrom(size_t first) const
+{
+    const VRegTable &vregs = bb->cfg->get_stv().vregs;
+    std::vector<int> regs;
+    for (size_t i = first; i < params.size(); i++)
+        if (params[i] != VRegTable::NONE && !vregs.isImmediate(params[i]))
+            regs.push_back(params[i]);
+    return regs;
+}
+
+std::vector<int> IRInstr::getDefs() const
+{
+    if (params.empty())
+        return {};
+    return {params[0]};
+}
+
+void IRInstr::replaceParams(size_t first, int from, int to)
+{
+    for (size_t i = first; i < params.size(); i++)
+        if (params[i] == from)
+            params[i] = to;
+}
+
+void IRInstr::replaceDef(int from, int to)
+{
+    if (!params.empty() && params[0] == from)
+        params[0] = to;
+}
+
+std::vector<int> IRCall::getDefs() const
+{
+    if (retVar == VRegTable::NONE)
+        return {};
+    return {retVar};
+}
+
+void IRCall::replaceDef(int from, int to)
 {
-    codegenBackend->gen_return(o, bb->cfg->IR_reg_to_asm(params[0]));
-    o << "    jmp " << bb->cfg->epilogueLabel << "\n"; // Jump to epilogue
+    if (retVar == from)
+        retVar = to;
 }
 
-void IRLdConst::gen_asm(std::ostream &o)
+void IRReturn::gen_asm(AsmWriter &o)
 {
-    codegenBackend->gen_mov(o, bb->cfg->IR_reg_to_asm(params[0]), params[1]);
-    // codegenBackend->gen_mov(o, params[0], params[1]);
+    bb->cfg->backend->gen_return(o, bb->cfg->operand(params[0]));
+    bb->cfg->backend->gen_jump(o, bb->cfg->epilogueLabel); // Jump to epilogue
+}
 
+void IRLdConst::gen_asm(AsmWriter &o)
+{
+    bb->cfg->backend->gen_mov(o, bb->cfg->operand(params[0]), Operand::immediate(value));
 }
 
-void IRCopy::gen_asm(std::ostream &o)
+void IRCopy::gen_asm(AsmWriter &o)
 {
-    codegenBackend->gen_copy(o,
-                             bb->cfg->IR_reg_to_asm(params[0]),
-                             bb->cfg->IR_reg_to_asm(params[1]));
+    bb->cfg->backend->gen_copy(o,
+                             bb->cfg->operand(params[0]),
+                             bb->cfg->operand(params[1]));
 }
 
-void IRAdd::gen_asm(std::ostream &o)
+void IRAdd::gen_asm(AsmWriter &o)
 {
-    codegenBackend->gen_add(o,
-                            bb->cfg->IR_reg_to_asm(params[0]),
-                            bb->cfg->IR_reg_to_asm(params[1]),
-                            bb->cfg->IR_reg_to_asm(params[2]));
+    bb->cfg->backend->gen_add(o,
+                            bb->cfg->operand(params[0]),
+                            bb->cfg->operand(params[1]),
+                            bb->cfg->operand(params[2]));
 }
 
-void IRSub::gen_asm(std::ostream &o)
+void IRSub::gen_asm(AsmWriter &o)
 {
-    codegenBackend->gen_sub(o,
-                            bb->cfg->IR_reg_to_asm(params[0]),
-                            bb->cfg->IR_reg_to_asm(params[1]),
-                            bb->cfg->IR_reg_to_asm(params[2]));
+    bb->cfg->backend->gen_sub(o,
+                            bb->cfg->operand(params[0]),
+                            bb->cfg->operand(params[1]),
+                            bb->cfg->operand(params[2]));
 }
 
-void IRMul::gen_asm(std::ostream &o)
+void IRMul::gen_asm(AsmWriter &o)
 {
-    codegenBackend->gen_mul(o,
-                            bb->cfg->IR_reg_to_asm(params[0]),
-                            bb->cfg->IR_reg_to_asm(params[1]),
-                            bb->cfg->IR_reg_to_asm(params[2]));
+    bb->cfg->backend->gen_mul(o,
+                            bb->cfg->operand(params[0]),
+                            bb->cfg->operand(params[1]),
+                            bb->cfg->operand(params[2]));
 }
 
-void IRDiv::gen_asm(std::ostream &o)
+void IRDiv::gen_asm(AsmWriter &o)
 {
-    codegenBackend->gen_div(o,
-                            bb->cfg->IR_reg_to_asm(params[0]),
-                            bb->cfg->IR_reg_to_asm(params[1]),
-                            bb->cfg->IR_reg_to_asm(params[2]));
+    bb->cfg->backend->gen_div(o,
+                            bb->cfg->operand(params[0]),
+                            bb->cfg->operand(params[1]),
+                            bb->cfg->operand(params[2]));
 }
 
-void IRMod::gen_asm(std::ostream &o)
+void IRMod::gen_asm(AsmWriter &o)
 {
-    codegenBackend->gen_mod(o,
-                            bb->cfg->IR_reg_to_asm(params[0]),
-                            bb->cfg->IR_reg_to_asm(params[1]),
-                            bb->cfg->IR_reg_to_asm(params[2]));
+    bb->cfg->backend->gen_mod(o,
+                            bb->cfg->operand(params[0]),
+                            bb->cfg->operand(params[1]),
+                            bb->cfg->operand(params[2]));
 }
 
-void IRMovReg::gen_asm(std::ostream &o)
+void IRMovReg::gen_asm(AsmWriter &o)
 {
-    // Pour IRMovReg, on déplace l'opérande src (après conversion) vers le registre dest
-    // Comme dest est déjà un registre (ex : "%edi"), on l'utilise tel quel.
-    o << "    movl " << bb->cfg->IR_reg_to_asm(params[1]) << ", " << params[0] << "\n";
+    // Pour IRMovReg, on déplace l'opérande src vers le registre dest (ex : "%edi")
+    bb->cfg->backend->gen_copy(o, Operand::registerOf(dest), bb->cfg->operand(params[0]));
 }
 
-void IRCall::gen_asm(std::ostream &o)
+void IRCall::gen_asm(AsmWriter &o)
 {
-    const bool isARM64 = codegenBackend->getArchitecture() == "arm64";
+    const bool isARM64 = bb->cfg->backend->getArchitecture() == "arm64";
 
     // Registres d'arguments selon l'ABI
     std::vector<std::string> argRegs;
@@ -90,86 +144,83 @@ void IRCall::gen_asm(std::ostream &o)
     for (size_t i = 0; i < params.size(); ++i)
     {
         if (i >= argRegs.size()) {
-            std::cerr << "[ERROR] Function call '" << funcName << "' with too many arguments (limit: "
-                      << argRegs.size() << ").\n";
-            exit(1);
+            throw CompileError("Function call '" + funcName + "' with too many arguments (limit: "
+                               + std::to_string(argRegs.size()) + ").");
         }
 
-        const std::string &src = bb->cfg->IR_reg_to_asm(params[i]);
-        const std::string &dest = argRegs[i];
-        codegenBackend->gen_copy(o, dest, src);
+        bb->cfg->backend->gen_copy(o, Operand::registerOf(argRegs[i]), bb->cfg->operand(params[i]));
     }
 
     // Appel de la fonction
-    codegenBackend->gen_call(o, funcName);
+    bb->cfg->backend->gen_call(o, funcName);
 
     // Récupération de retour
-    if (!retVar.empty())
+    if (retVar != VRegTable::NONE)
     {
         const std::string &retReg = isARM64 ? "w0" : "%eax";
-        codegenBackend->gen_copy(o, bb->cfg->IR_reg_to_asm(retVar), retReg);
+        bb->cfg->backend->gen_copy(o, bb->cfg->operand(retVar), Operand::registerOf(retReg));
     }
 }
 
 
-void IRNot::gen_asm(std::ostream &o)
+void IRNot::gen_asm(AsmWriter &o)
 {
-    codegenBackend->gen_not(o,
-                            bb->cfg->IR_reg_to_asm(params[0]),
-                            bb->cfg->IR_reg_to_asm(params[1]));
+    bb->cfg->backend->gen_not(o,
+                            bb->cfg->operand(params[0]),
+                            bb->cfg->operand(params[1]));
 }
 
-void IRXor::gen_asm(std::ostream &o)
+void IRXor::gen_asm(AsmWriter &o)
 {
-    codegenBackend->gen_xor(o,
-                            bb->cfg->IR_reg_to_asm(params[0]),
-                            bb->cfg->IR_reg_to_asm(params[1]),
-                            bb->cfg->IR_reg_to_asm(params[2]));
+    bb->cfg->backend->gen_xor(o,
+                            bb->cfg->operand(params[0]),
+                            bb->cfg->operand(params[1]),
+                            bb->cfg->operand(params[2]));
 }
 
-void IROr::gen_asm(std::ostream &o)
+void IROr::gen_asm(AsmWriter &o)
 {
-    codegenBackend->gen_or(o,
-                           bb->cfg->IR_reg_to_asm(params[0]),
-                           bb->cfg->IR_reg_to_asm(params[1]),
-                           bb->cfg->IR_reg_to_asm(params[2]));
+    bb->cfg->backend->gen_or(o,
+                           bb->cfg->operand(params[0]),
+                           bb->cfg->operand(params[1]),
+                           bb->cfg->operand(params[2]));
 }
 
-void IREgal::gen_asm(std::ostream &o)
+void IREgal::gen_asm(AsmWriter &o)
 {
-    codegenBackend->gen_egal(o,
-                             bb->cfg->IR_reg_to_asm(params[0]),
-                             bb->cfg->IR_reg_to_asm(params[1]),
-                             bb->cfg->IR_reg_to_asm(params[2]));
+    bb->cfg->backend->gen_egal(o,
+                             bb->cfg->operand(params[0]),
+                             bb->cfg->operand(params[1]),
+                             bb->cfg->operand(params[2]));
 }
 
-void IRNotEgal::gen_asm(std::ostream &o)
+void IRNotEgal::gen_asm(AsmWriter &o)
 {
-    codegenBackend->gen_notegal(o,
-                                bb->cfg->IR_reg_to_asm(params[0]),
-                                bb->cfg->IR_reg_to_asm(params[1]),
-                                bb->cfg->IR_reg_to_asm(params[2]));
+    bb->cfg->backend->gen_notegal(o,
+                                bb->cfg->operand(params[0]),
+                                bb->cfg->operand(params[1]),
+                                bb->cfg->operand(params[2]));
 }
 
-void IRAnd::gen_asm(std::ostream &o)
+void IRAnd::gen_asm(AsmWriter &o)
 {
-    codegenBackend->gen_and(o,
-                            bb->cfg->IR_reg_to_asm(params[0]),
-                            bb->cfg->IR_reg_to_asm(params[1]),
-                            bb->cfg->IR_reg_to_asm(params[2]));
+    bb->cfg->backend->gen_and(o,
+                            bb->cfg->operand(params[0]),
+                            bb->cfg->operand(params[1]),
+                            bb->cfg->operand(params[2]));
 }
 
-void IRComp::gen_asm(std::ostream &o) {
-    codegenBackend->gen_comp(o,
-        bb->cfg->IR_reg_to_asm(params[0]),
-        bb->cfg->IR_reg_to_asm(params[1]),
-        bb->cfg->IR_reg_to_asm(params[2]),
+void IRComp::gen_asm(AsmWriter &o) {
+    bb->cfg->backend->gen_comp(o,
+        bb->cfg->operand(params[0]),
+        bb->cfg->operand(params[1]),
+        bb->cfg->operand(params[2]),
         op);
 }
 
-void IRPutChar::gen_asm(std::ostream &o)
+void IRPutChar::gen_asm(AsmWriter &o)
 {
-    std::string architecture = codegenBackend->getArchitecture();
+    std::string architecture = bb->cfg->backend->getArchitecture();
     std::string reg = "";
 
     if (architecture == "arm64") {
@@ -179,19 +230,18 @@ void IRPutChar::gen_asm(std::ostream &o)
     }
 
     if (reg.empty()) {
-        std::cerr << "[ERROR] Architecture inconnue\n";
-        exit(-1);
+        throw CompileError("Architecture inconnue");
     }
 
-    codegenBackend->gen_copy(o, reg, bb->cfg->IR_reg_to_asm(params[0]));
-    codegenBackend->gen_call(o, "putchar");
+    bb->cfg->backend->gen_copy(o, Operand::registerOf(reg), bb->cfg->operand(params[0]));
+    bb->cfg->backend->gen_call(o, "putchar");
 }
 
-void IRGetChar::gen_asm(std::ostream &o)
+void IRGetChar::gen_asm(AsmWriter &o)
 {
-    codegenBackend->gen_call(o, "getchar");
+    bb->cfg->backend->gen_call(o, "getchar");
 
-    std::string architecture = codegenBackend->getArchitecture();
+    std::string architecture = bb->cfg->backend->getArchitecture();
     std::string reg = "";
 
     if (architecture == "arm64") {
@@ -201,34 +251,32 @@ void IRGetChar::gen_asm(std::ostream &o)
     }
 
     if (reg.empty()) {
-        std::cerr << "[ERROR] Architecture inconnue\n";
-        exit(-1);
+        throw CompileError("Architecture inconnue");
     }
 
-    codegenBackend->gen_copy(o, bb->cfg->IR_reg_to_asm(params[0]), reg);
+    bb->cfg->backend->gen_copy(o, bb->cfg->operand(params[0]), Operand::registerOf(reg));
 }
 
-void IRBranch::gen_asm(std::ostream &o)
+void IRBranch::gen_asm(AsmWriter &o)
 {
-    if (params[0].empty()) // Unconditional jump
+    if (params[0] == VRegTable::NONE) // Unconditional jump
     {
-        o << "    jmp " << params[1] << "\n";
+        bb->cfg->backend->gen_jump(o, thenLabel);
     }
     else
     {
-        codegenBackend->gen_branch(o,
-                                   bb->cfg->IR_reg_to_asm(params[0]),
-                                   params[1],
-                                   params[2]);
+        bb->cfg->backend->gen_branch(o,
+                                   bb->cfg->operand(params[0]),
+                                   thenLabel,
+                                   elseLabel);
     }
 }
 
-void IRParamLoad::gen_asm(std::ostream &o)
+void IRParamLoad::gen_asm(AsmWriter &o)
 {
-    const std::string &dest = bb->cfg->IR_reg_to_asm(params[0]);
-    int paramIndex = std::stoi(params[1]);
+    Operand dest = bb->cfg->operand(params[0]);
 
-    std::string architecture = codegenBackend->getArchitecture();
+    std::string architecture = bb->cfg->backend->getArchitecture();
 
     // Registres d’arguments standards
     std::string src;
@@ -238,15 +286,29 @@ void IRParamLoad::gen_asm(std::ostream &o)
         // Ordre x86-64 System V
         std::vector<std::string> argRegs = {"%edi", "%esi", "%edx", "%ecx", "%r8", "%r9"};
         if (paramIndex >= (int)argRegs.size()) {
-            std::cerr << "[ERROR] Too many parameters for x86 register ABI\n";
-            exit(1);
+            throw CompileError("Too many parameters for x86 register ABI");
         }
         src = argRegs[paramIndex];
     } else {
-        std::cerr << "[ERROR] Unknown architecture in IRParamLoad\n";
-        exit(1);
+        throw CompileError("Unknown architecture in IRParamLoad");
     }
 
-    codegenBackend->gen_copy(o, dest, src);
+    bb->cfg->backend->gen_copy(o, dest, Operand::registerOf(src));
 }
 
+void IRPhi::addIncoming(int src, BasicBlock *pred)
+{
+    params.push_back(src);
+    preds.push_back(pred);
+}
+
+void IRPhi::removeIncoming(size_t i)
+{
+    params.erase(params.begin() + i + 1);
+    preds.erase(preds.begin() + i);
+}
+
+void IRPhi::gen_asm(AsmWriter &)
+{
+    throw CompileError("phi instruction in " + bb->label + " reached code generation");
+}
@@ -4,23 +4,55 @@
 #include <vector>
 #include <string>
 #include <ostream>
+#include "AsmWriter.h"
 #include "CodeGenBackend.h"
+#include "VRegTable.h"
 
 class BasicBlock; // Déclaration anticipée de BasicBlock
 
+// Nature d'une instruction IR, une valeur par classe dérivée
+// (pour les passes qui parcourent l'IR sans dynamic_cast)
+enum class IROpcode
+{
+    Return, LdConst, Copy, Add, Sub, Mul, Div, Mod, MovReg, Call,
+    Not, Xor, Or, Egal, NotEgal, And, PutChar, GetChar, Branch, Comp,
+    AndPar, OrPar, ParamLoad, Phi,
+    Count   // nombre d'opcodes
+};
+
+// Nom court de l'opcode ("add", "call"...)
+const char *opcodeName(IROpcode opcode);
+
 // Classe de base pour les instructions IR.
 class IRInstr
 {
 public:
-    IRInstr(BasicBlock *bb_, const std::vector<std::string> &params_)
+    IRInstr(BasicBlock *bb_, const std::vector<int> &params_)
         : bb(bb_), params(params_) {}
     virtual ~IRInstr() = default;
-    virtual void gen_asm(std::ostream &o) = 0;
-    std::vector<std::string> getParams();
+    virtual void gen_asm(AsmWriter &o) = 0;
+    virtual IROpcode opcode() const = 0;
+    const std::vector<int> &getParams() const;
+
+    // Registres virtuels lus / écrits par l'instruction (pour l'analyse de durée de vie).
+    // Par défaut : params[0] est la destination, les suivants sont des sources.
+    // Une source peut être un immédiat (VRegTable::addImmediate) : il n'est
+    // pas compté parmi les registres lus.
+    virtual std::vector<int> getUses() const;
+    virtual std::vector<int> getDefs() const;
+    // Remplace le registre virtuel lu (resp. écrit) 'from' par 'to' (renommage SSA)
+    virtual void replaceUse(int from, int to) { replaceParams(1, from, to); }
+    virtual void replaceDef(int from, int to);
+    // Vrai si l'instruction appelle une fonction (registres caller-saved écrasés)
+    virtual bool isCall() const { return false; }
 
 protected:
     BasicBlock *bb;
-    std::vector<std::string> params;
+    std::vector<int> params;   // identifiants de registres virtuels (cf. VRegTable)
+
+    void replaceParams(size_t first, int from, int to);
+    // params[first..], sans les immédiats ni VRegTable::NONE
+    std::vector<int> registersFrom(size_t first) const;
 };
 
 // Classes dérivées :
@@ -28,65 +60,81 @@ protected:
 class IRReturn : public IRInstr
 {
 public:
-    IRReturn(BasicBlock *bb, const std::string &src)
+    IRReturn(BasicBlock *bb, int src)
         : IRInstr(bb, {src}) {}
-    void gen_asm(std::ostream &o) override;
+    void gen_asm(AsmWriter &o) override;
+    IROpcode opcode() const override { return IROpcode::Return; }
+    std::vector<int> getUses() const override { return registersFrom(0); }
+    std::vector<int> getDefs() const override { return {}; }
+    void replaceUse(int from, int to) override { replaceParams(0, from, to); }
+    void replaceDef(int, int) override {}
 };
 
 class IRLdConst : public IRInstr
 {
 public:
-    IRLdConst(BasicBlock *bb, const std::string &dest, const std::string &constant)
-        : IRInstr(bb, {dest, constant}) {}
-    void gen_asm(std::ostream &o) override;
+    IRLdConst(BasicBlock *bb, int dest, int value)
+        : IRInstr(bb, {dest}), value(value) {}
+    void gen_asm(AsmWriter &o) override;
+    IROpcode opcode() const override { return IROpcode::LdConst; }
+    int getValue() const { return value; }
+
+private:
+    int value;
 };
 
 class IRCopy : public IRInstr
 {
 public:
-    IRCopy(BasicBlock *bb, const std::string &dest, const std::string &src)
+    IRCopy(BasicBlock *bb, int dest, int src)
         : IRInstr(bb, {dest, src}) {}
-    void gen_asm(std::ostream &o) override;
+    void gen_asm(AsmWriter &o) override;
+    IROpcode opcode() const override { return IROpcode::Copy; }
 };
 
 class IRAdd : public IRInstr
 {
 public:
-    IRAdd(BasicBlock *bb, const std::string &dest, const std::string &src1, const std::string &src2)
+    IRAdd(BasicBlock *bb, int dest, int src1, int src2)
         : IRInstr(bb, {dest, src1, src2}) {}
-    void gen_asm(std::ostream &o) override;
+    void gen_asm(AsmWriter &o) override;
+    IROpcode opcode() const override { return IROpcode::Add; }
 };
 
 class IRSub : public IRInstr
 {
 public:
-    IRSub(BasicBlock *bb, const std::string &dest, const std::string &src1, const std::string &src2)
+    IRSub(BasicBlock *bb, int dest, int src1, int src2)
         : IRInstr(bb, {dest, src1, src2}) {}
-    void gen_asm(std::ostream &o) override;
+    void gen_asm(AsmWriter &o) override;
+    IROpcode opcode() const override { return IROpcode::Sub; }
 };
 
 class IRMul : public IRInstr
 {
 public:
-    IRMul(BasicBlock *bb, const std::string &dest, const std::string &src1, const std::string &src2)
+    IRMul(BasicBlock *bb, int dest, int src1, int src2)
         : IRInstr(bb, {dest, src1, src2}) {}
-    void gen_asm(std::ostream &o) override;
+    void gen_asm(AsmWriter &o) override;
+    IROpcode opcode() const override { return IROpcode::Mul; }
 };
 
 class IRDiv : public IRInstr
 {
 public:
-    IRDiv(BasicBlock *bb, const std::string &dest, const std::string &src1, const std::string &src2)
+    IRDiv(BasicBlock *bb, int dest, int src1, int src2)
         : IRInstr(bb, {dest, src1, src2}) {}
-    void gen_asm(std::ostream &o) override;
+    void gen_asm(AsmWriter &o) override;
+    IROpcode opcode() const override { return IROpcode::Div; }
 };
 
 class IRMod : public IRInstr
 {
 public:
-    IRMod(BasicBlock *bb, const std::string &dest, const std::string &src1, const std::string &src2)
+    IRMod(BasicBlock *bb, int dest, int src1, int src2)
         : IRInstr(bb, {dest, src1, src2}) {}
-    void gen_asm(std::ostream &o) override;
+    void gen_asm(AsmWriter &o) override;
+    IROpcode opcode() const override { return IROpcode::Mod; }
 };
 
 // Nouvelle instruction pour copier dans un registre (par exemple, pour mettre un argument dans %edi)
@@ -94,96 +142,140 @@ class IRMovReg : public IRInstr
 {
 public:
     // Ici, dest sera un registre (par exemple "%edi") et src est l'opérande à déplacer
-    IRMovReg(BasicBlock *bb, const std::string &dest, const std::string &src)
-        : IRInstr(bb, {dest, src}) {}
-    virtual void gen_asm(std::ostream &o) override;
+    IRMovReg(BasicBlock *bb, const std::string &dest, int src)
+        : IRInstr(bb, {src}), dest(dest) {}
+    virtual void gen_asm(AsmWriter &o) override;
+    IROpcode opcode() const override { return IROpcode::MovReg; }
+    std::vector<int> getUses() const override { return registersFrom(0); }
+    std::vector<int> getDefs() const override { return {}; }
+    void replaceUse(int from, int to) override { replaceParams(0, from, to); }
+    void replaceDef(int, int) override {}
+    const std::string &getDest() const { return dest; }
+
+private:
+    std::string dest;
 };
 
 class IRCall : public IRInstr
 {
 public:
     IRCall(BasicBlock *bb, const std::string &funcName,
-           const std::vector<std::string> &args,
-           const std::string &retVar = "")
+           const std::vector<int> &args,
+           int retVar = VRegTable::NONE)
         : IRInstr(bb, args), funcName(funcName), retVar(retVar) {}
 
-    void gen_asm(std::ostream &o) override;
+    void gen_asm(AsmWriter &o) override;
+    IROpcode opcode() const override { return IROpcode::Call; }
+    std::vector<int> getUses() const override { return registersFrom(0); }
+    std::vector<int> getDefs() const override;
+    void replaceUse(int from, int to) override { replaceParams(0, from, to); }
+    void replaceDef(int from, int to) override;
+    bool isCall() const override { return true; }
+    const std::string &getFuncName() const { return funcName; }
+    int getRetVar() const { return retVar; }
 
 private:
     std::string funcName;
-    std::string retVar; // nom de la variable pour stocker w0
+    int retVar; // registre virtuel recevant la valeur de retour (w0 / %eax)
 };
 
 class IRNot : public IRInstr
 {
 public:
-    IRNot(BasicBlock *bb, const std::string &dest, const std::string &src)
+    IRNot(BasicBlock *bb, int dest, int src)
         : IRInstr(bb, {dest, src}) {}
-    void gen_asm(std::ostream &o) override;
+    void gen_asm(AsmWriter &o) override;
+    IROpcode opcode() const override { return IROpcode::Not; }
 };
 
 class IRXor : public IRInstr
 {
 public:
-    IRXor(BasicBlock *bb, const std::string &dest, const std::string &src1, const std::string &src2)
+    IRXor(BasicBlock *bb, int dest, int src1, int src2)
         : IRInstr(bb, {dest, src1, src2}) {}
-    void gen_asm(std::ostream &o) override;
+    void gen_asm(AsmWriter &o) override;
+    IROpcode opcode() const override { return IROpcode::Xor; }
 };
 
 class IROr : public IRInstr
 {
 public:
-    IROr(BasicBlock *bb, const std::string &dest, const std::string &src1, const std::string &src2)
+    IROr(BasicBlock *bb, int dest, int src1, int src2)
         : IRInstr(bb, {dest, src1, src2}) {}
-    void gen_asm(std::ostream &o) override;
+    void gen_asm(AsmWriter &o) override;
+    IROpcode opcode() const override { return IROpcode::Or; }
 };
 
 class IREgal : public IRInstr
 {
 public:
-    IREgal(BasicBlock *bb, const std::string &dest, const std::string &src1, const std::string &src2)
+    IREgal(BasicBlock *bb, int dest, int src1, int src2)
         : IRInstr(bb, {dest, src1, src2}) {}
-    void gen_asm(std::ostream &o) override;
+    void gen_asm(AsmWriter &o) override;
+    IROpcode opcode() const override { return IROpcode::Egal; }
 };
 
 class IRNotEgal : public IRInstr
 {
 public:
-    IRNotEgal(BasicBlock *bb, const std::string &dest, const std::string &src1, const std::string &src2)
+    IRNotEgal(BasicBlock *bb, int dest, int src1, int src2)
         : IRInstr(bb, {dest, src1, src2}) {}
-    void gen_asm(std::ostream &o) override;
+    void gen_asm(AsmWriter &o) override;
+    IROpcode opcode() const override { return IROpcode::NotEgal; }
 };
 
 class IRAnd : public IRInstr
 {
 public:
-    IRAnd(BasicBlock *bb, const std::string &dest, const std::string &src1, const std::string &src2)
+    IRAnd(BasicBlock *bb, int dest, int src1, int src2)
         : IRInstr(bb, {dest, src1, src2}) {}
-    void gen_asm(std::ostream &o) override;
+    void gen_asm(AsmWriter &o) override;
+    IROpcode opcode() const override { return IROpcode::And; }
 };
 
 class IRPutChar : public IRInstr
 {
 public:
-    IRPutChar(BasicBlock *bb, const std::string &src)
+    IRPutChar(BasicBlock *bb, int src)
         : IRInstr(bb, {src}) {}
-    void gen_asm(std::ostream &o) override;
+    void gen_asm(AsmWriter &o) override;
+    IROpcode opcode() const override { return IROpcode::PutChar; }
+    std::vector<int> getUses() const override { return registersFrom(0); }
+    std::vector<int> getDefs() const override { return {}; }
+    void replaceUse(int from, int to) override { replaceParams(0, from, to); }
+    void replaceDef(int, int) override {}
+    bool isCall() const override { return true; }
 };
 
 class IRGetChar : public IRInstr
 {
 public:
-    IRGetChar(BasicBlock *bb, const std::string &dest)
+    IRGetChar(BasicBlock *bb, int dest)
         : IRInstr(bb, {dest}) {}
-    void gen_asm(std::ostream &o) override;
+    void gen_asm(AsmWriter &o) override;
+    IROpcode opcode() const override { return IROpcode::GetChar; }
+    std::vector<int> getUses() const override { return {}; }
+    bool isCall() const override { return true; }
 };
 
 class IRBranch : public IRInstr
 {
 public:
-    IRBranch(BasicBlock *bb, const std::string &cond, const std::string &thenLabel, const std::string &elseLabel)
-        : IRInstr(bb, {cond, thenLabel, elseLabel}) {}
-    void gen_asm(std::ostream &o) override;
+    // cond == VRegTable::NONE : saut inconditionnel vers thenLabel
+    IRBranch(BasicBlock *bb, int cond, const std::string &thenLabel, const std::string &elseLabel)
+        : IRInstr(bb, {cond}), thenLabel(thenLabel), elseLabel(elseLabel) {}
+    void gen_asm(AsmWriter &o) override;
+    IROpcode opcode() const override { return IROpcode::Branch; }
+    std::vector<int> getUses() const override { return registersFrom(0); }
+    std::vector<int> getDefs() const override { return {}; }
+    void replaceUse(int from, int to) override { replaceParams(0, from, to); }
+    void replaceDef(int, int) override {}
+    const std::string &getThenLabel() const { return thenLabel; }
+    const std::string &getElseLabel() const { return elseLabel; }
+
+private:
+    std::string thenLabel;
+    std::string elseLabel;
 };
 
 
@@ -191,9 +283,11 @@ class IRComp : public IRInstr
 {
 public:
     // Le constructeur prend en plus une chaîne 'op' qui représente l'opérateur ("<", ">", ">=", "<=")
-    IRComp(BasicBlock *bb, const std::string &dest, const std::string &src1, const std::string &src2, const std::string &op)
+    IRComp(BasicBlock *bb, int dest, int src1, int src2, const std::string &op)
         : IRInstr(bb, {dest, src1, src2}), op(op) {}
-    virtual void gen_asm(std::ostream &o) override;
+    virtual void gen_asm(AsmWriter &o) override;
+    IROpcode opcode() const override { return IROpcode::Comp; }
+    const std::string &getOp() const { return op; }
 
 private:
     std::string op;
@@ -202,29 +296,58 @@ private:
 class IRAndPar : public IRInstr
 {
 public:
-    IRAndPar(BasicBlock *bb, const std::string &dest, const std::string &src1, const std::string &src2)
+    IRAndPar(BasicBlock *bb, int dest, int src1, int src2)
         : IRInstr(bb, {dest, src1, src2}) {}
 
-    void gen_asm(std::ostream &o) override;
+    void gen_asm(AsmWriter &o) override;
+    IROpcode opcode() const override { return IROpcode::AndPar; }
 };
 
 class IROrPar : public IRInstr
 {
 public:
-    IROrPar(BasicBlock *bb, const std::string &dest, const std::string &src1, const std::string &src2)
+    IROrPar(BasicBlock *bb, int dest, int src1, int src2)
         : IRInstr(bb, {dest, src1, src2}) {}
 
-    void gen_asm(std::ostream &o) override;
+    void gen_asm(AsmWriter &o) override;
+    IROpcode opcode() const override { return IROpcode::OrPar; }
 };
 
 
 class IRParamLoad : public IRInstr
 {
 public:
-    IRParamLoad(BasicBlock *bb, const std::string &dest, int paramIndex)
-        : IRInstr(bb, {dest, std::to_string(paramIndex)}) {}
+    IRParamLoad(BasicBlock *bb, int dest, int paramIndex)
+        : IRInstr(bb, {dest}), paramIndex(paramIndex) {}
+
+    void gen_asm(AsmWriter &o) override;
+    IROpcode opcode() const override { return IROpcode::ParamLoad; }
+    int getParamIndex() const { return paramIndex; }
+
+private:
+    int paramIndex;
+};
 
-    void gen_asm(std::ostream &o) override;
+// Fonction phi de la forme SSA : dest reçoit la source associée au prédécesseur
+// par lequel le bloc a été atteint. Toujours en tête de bloc ; SSADestructor
+// les remplace par des copies avant l'émission.
+class IRPhi : public IRInstr
+{
+public:
+    IRPhi(BasicBlock *bb, int dest)
+        : IRInstr(bb, {dest}) {}
+    void gen_asm(AsmWriter &o) override;
+    IROpcode opcode() const override { return IROpcode::Phi; }
+
+    void addIncoming(int src, BasicBlock *pred);
+    void removeIncoming(size_t i);
+    const std::vector<BasicBlock *> &getPreds() const { return preds; }
+    // Source venant de preds[i] (params[i + 1])
+    int getSource(size_t i) const { return params[i + 1]; }
+    void setSource(size_t i, int src) { params[i + 1] = src; }
+
+private:
+    std::vector<BasicBlock *> preds;
 };
 
 #endif
@@ -0,0 +1,315 @@
+#include "IRInterpreter.h"
+
+#include <algorithm>
+#include <climits>
+#include <cstdio>
+#include <iomanip>
+
+#include "CompileError.h"
+
+// Au-delà, récursion sans fin probable (le code natif aurait épuisé sa pile)
+static const size_t MAX_DEPTH = 1000000;
+
+// Valeurs renvoyées par execute() quand l'instruction ne quitte pas le bloc,
+// ou quand elle vient d'empiler l'appel d'une fonction du programme
+static const int NO_JUMP = -2;
+static const int CALL = -3;
+
+// Arithmétique 32 bits modulo 2^32, comme addl / subl / imull
+static int wrap(long long value)
+{
+    return (int)(unsigned)value;
+}
+
+int IRInterpreter::blockIndex(const Function &function, const BasicBlock *bb) const
+{
+    if (bb == nullptr)
+        return EPILOGUE;
+    auto it = function.byLabel.find(bb->label);
+    if (it == function.byLabel.end() || function.blocks[it->second].bb != bb)
+        throw CompileError("--interpret: edge to a block outside the CFG of '" + function.cfg->ast->name + "'");
+    return it->second;
+}
+
+void IRInterpreter::addFunction(CFG &cfg)
+{
+    byName[cfg.ast->name] = functions.size();
+    functions.push_back(Function(&cfg));
+    Function &function = functions.back();
+
+    const std::vector<BasicBlock *> &bbs = cfg.get_bbs();
+    for (size_t i = 0; i < bbs.size(); i++)
+    {
+        function.blocks.push_back(Block{bbs[i]});
+        function.byLabel[bbs[i]->label] = (int)i;
+    }
+    function.byLabel[cfg.epilogueLabel] = EPILOGUE;
+
+    const VRegTable &vregs = cfg.get_stv().vregs;
+    function.initialRegs.assign(vregs.size(), 0);
+    for (int id = 0; id < vregs.size(); id++)
+        if (vregs.isImmediate(id))
+            function.initialRegs[id] = vregs.immediateValue(id);
+
+    // Successeurs résolus une fois : l'exécution ne manipule que des indices
+    for (Block &block : function.blocks)
+    {
+        block.exitTrue = blockIndex(function, block.bb->exit_true);
+        block.exitFalse = blockIndex(function, block.bb->exit_false);
+    }
+}
+
+int IRInterpreter::runMain()
+{
+    auto it = byName.find("main");
+    if (it == byName.end())
+        throw CompileError("--interpret: the program has no main function");
+    push(functions[it->second], {}, VRegTable::NONE);
+
+    while (true)
+    {
+        Frame &frame = stack.back();
+        if (frame.block == EPILOGUE)
+        {
+            int value = frame.result, retVar = frame.retVar;
+            stack.pop_back();
+            if (stack.empty())
+            {
+                std::fflush(stdout);    // putchar écrit dans le tampon de stdout du processus
+                return value;
+            }
+            if (retVar != VRegTable::NONE)
+                stack.back().regs[retVar] = value;
+            continue;
+        }
+
+        Block &block = frame.function->blocks[frame.block];
+        const std::vector<IRInstr *> &instrs = block.bb->instrs;
+        if (frame.next == 0)
+        {
+            block.count++;
+            frame.next = enterBlock(frame, block);
+        }
+        int target = NO_JUMP;
+        while (target == NO_JUMP && frame.next < instrs.size())
+            target = execute(frame, *instrs[frame.next++]);
+        if (target == CALL)
+            continue;   // frame n'est plus valide ; le bloc reprend à next au retour
+
+        // Fin du bloc, dans le même ordre de priorité que BasicBlock::gen_asm
+        frame.next = 0;
+        frame.previous = frame.block;
+        if (target != NO_JUMP)
+            frame.block = target;
+        else if (block.bb->exit_true != nullptr && block.bb->exit_false != nullptr)
+            frame.block = frame.regs[block.bb->test_var] != 0 ? block.exitTrue : block.exitFalse;
+        else if (block.bb->exit_true != nullptr)
+            frame.block = block.exitTrue;
+        else if (frame.block + 1 < (int)frame.function->blocks.size())
+            frame.block++;
+        else
+            frame.block = EPILOGUE;
+    }
+}
+
+void IRInterpreter::push(Function &function, std::vector<int> args, int retVar)
+{
+    if (stack.size() >= MAX_DEPTH)
+        throw CompileError("--interpret: call depth exceeds " + std::to_string(MAX_DEPTH));
+    Frame frame{&function, function.initialRegs, std::move(args), retVar};
+    if (function.blocks.empty())
+        frame.block = EPILOGUE;
+    stack.push_back(std::move(frame));
+}
+
+// Exécute les IRPhi en tête du bloc, en parallèle : toutes les sources sont
+// lues avant la première écriture. Renvoie l'indice de la première autre instruction.
+size_t IRInterpreter::enterBlock(Frame &frame, const Block &block)
+{
+    const std::vector<IRInstr *> &instrs = block.bb->instrs;
+    size_t count = 0;
+    while (count < instrs.size() && instrs[count]->opcode() == IROpcode::Phi)
+        count++;
+    if (count == 0)
+        return 0;
+    if (frame.previous == EPILOGUE)
+        throw CompileError("--interpret: phi in the entry block of '" + frame.function->cfg->ast->name + "'");
+
+    const BasicBlock *previous = frame.function->blocks[frame.previous].bb;
+    std::vector<int> values(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        const IRPhi *phi = static_cast<const IRPhi *>(instrs[i]);
+        size_t j = 0;
+        while (j < phi->getPreds().size() && phi->getPreds()[j] != previous)
+            j++;
+        if (j == phi->getPreds().size())
+            throw CompileError("--interpret: phi in " + block.bb->label + " has no source for " + previous->label);
+        values[i] = frame.regs[phi->getSource(j)];
+    }
+    for (size_t i = 0; i < count; i++)
+        frame.regs[instrs[i]->getParams()[0]] = values[i];
+    opcodeCounts[(size_t)IROpcode::Phi] += count;
+    return count;
+}
+
+// Exécute une instruction ; renvoie le bloc visé si elle quitte le bloc courant
+int IRInterpreter::execute(Frame &frame, const IRInstr &instr)
+{
+    std::vector<int> &regs = frame.regs;
+    const std::vector<int> &p = instr.getParams();
+    opcodeCounts[(size_t)instr.opcode()]++;
+    switch (instr.opcode())
+    {
+    case IROpcode::Return:
+        frame.result = regs[p[0]];
+        return EPILOGUE;
+    case IROpcode::LdConst:
+        regs[p[0]] = static_cast<const IRLdConst &>(instr).getValue();
+        break;
+    case IROpcode::Copy:
+        regs[p[0]] = regs[p[1]];
+        break;
+    case IROpcode::Add:
+        regs[p[0]] = wrap((long long)regs[p[1]] + regs[p[2]]);
+        break;
+    case IROpcode::Sub:
+        regs[p[0]] = wrap((long long)regs[p[1]] - regs[p[2]]);
+        break;
+    case IROpcode::Mul:
+        regs[p[0]] = wrap((long long)regs[p[1]] * regs[p[2]]);
+        break;
+    case IROpcode::Div:
+    case IROpcode::Mod:
+    {
+        int dividend = regs[p[1]], divisor = regs[p[2]];
+        if (divisor == 0 || (dividend == INT_MIN && divisor == -1))
+            throw CompileError("--interpret: division error in '" + frame.function->cfg->ast->name + "'");
+        regs[p[0]] = instr.opcode() == IROpcode::Div ? dividend / divisor : dividend % divisor;
+        break;
+    }
+    case IROpcode::MovReg:
+        // Registre physique : aucune instruction IR ne le relit, seul IRCall
+        // fixe ses arguments et l'interpréteur les passe directement
+        break;
+    case IROpcode::Call:
+    {
+        const IRCall &callInstr = static_cast<const IRCall &>(instr);
+        auto it = byName.find(callInstr.getFuncName());
+        if (it != byName.end())
+        {
+            std::vector<int> values(p.size());
+            for (size_t i = 0; i < p.size(); i++)
+                values[i] = regs[p[i]];
+            push(functions[it->second], std::move(values), callInstr.getRetVar());
+            return CALL;    // frame et regs invalidés par l'empilement
+        }
+        int value;
+        if (callInstr.getFuncName() == "putchar" && p.size() == 1)
+            value = std::putchar(regs[p[0]]);
+        else if (callInstr.getFuncName() == "getchar" && p.empty())
+            value = std::getchar();
+        else
+            throw CompileError("--interpret: undefined function '" + callInstr.getFuncName() + "'");
+        if (callInstr.getRetVar() != VRegTable::NONE)
+            regs[callInstr.getRetVar()] = value;
+        break;
+    }
+    case IROpcode::Not:
+        regs[p[0]] = regs[p[1]] == 0;
+        break;
+    case IROpcode::Xor:
+        regs[p[0]] = regs[p[1]] ^ regs[p[2]];
+        break;
+    case IROpcode::Or:
+        regs[p[0]] = regs[p[1]] | regs[p[2]];
+        break;
+    case IROpcode::Egal:
+        regs[p[0]] = regs[p[1]] == regs[p[2]];
+        break;
+    case IROpcode::NotEgal:
+        regs[p[0]] = regs[p[1]] != regs[p[2]];
+        break;
+    case IROpcode::And:
+        regs[p[0]] = regs[p[1]] & regs[p[2]];
+        break;
+    case IROpcode::PutChar:
+        std::putchar(regs[p[0]]);
+        break;
+    case IROpcode::GetChar:
+        regs[p[0]] = std::getchar();
+        break;
+    case IROpcode::Branch:
+    {
+        const IRBranch &branch = static_cast<const IRBranch &>(instr);
+        bool taken = p[0] == VRegTable::NONE || regs[p[0]] != 0;
+        const std::string &label = taken ? branch.getThenLabel() : branch.getElseLabel();
+        auto it = frame.function->byLabel.find(label);
+        if (it == frame.function->byLabel.end())
+            throw CompileError("--interpret: unknown label '" + label + "'");
+        return it->second;
+    }
+    case IROpcode::Comp:
+    {
+        const std::string &op = static_cast<const IRComp &>(instr).getOp();
+        int a = regs[p[1]], b = regs[p[2]];
+        if (op == "<")
+            regs[p[0]] = a < b;
+        else if (op == ">")
+            regs[p[0]] = a > b;
+        else if (op == "<=")
+            regs[p[0]] = a <= b;
+        else
+            regs[p[0]] = a >= b;
+        break;
+    }
+    case IROpcode::AndPar:
+        // Les deux opérandes sont déjà évalués : et logique sans court-circuit
+        regs[p[0]] = regs[p[1]] != 0 && regs[p[2]] != 0;
+        break;
+    case IROpcode::OrPar:
+        regs[p[0]] = regs[p[1]] != 0 || regs[p[2]] != 0;
+        break;
+    case IROpcode::ParamLoad:
+    {
+        size_t index = static_cast<const IRParamLoad &>(instr).getParamIndex();
+        regs[p[0]] = index < frame.args.size() ? frame.args[index] : 0;
+        break;
+    }
+    case IROpcode::Phi:
+        // Exécutés par enterBlock ; un phi après une autre instruction est une IR invalide
+        throw CompileError("--interpret: phi after the head of " + frame.function->blocks[frame.block].bb->label);
+    case IROpcode::Count:
+        break;
+    }
+    return NO_JUMP;
+}
+
+void IRInterpreter::report(std::ostream &os) const
+{
+    // Opcodes exécutés, du plus fréquent au moins fréquent
+    std::vector<size_t> order;
+    long total = 0;
+    for (size_t op = 0; op < (size_t)IROpcode::Count; op++)
+    {
+        total += opcodeCounts[op];
+        if (opcodeCounts[op] != 0)
+            order.push_back(op);
+    }
+    std::stable_sort(order.begin(), order.end(),
+                     [&](size_t a, size_t b) { return opcodeCounts[a] > opcodeCounts[b]; });
+    os << "IR instructions executed: " << total << "\n";
+    for (size_t op : order)
+        os << "  " << std::left << std::setw(12) << opcodeName((IROpcode)op)
+           << std::right << std::setw(12) << opcodeCounts[op] << "\n";
+
+    // Entrées dans chaque bloc, dans l'ordre du CFG (0 : jamais atteint)
+    os << "IR basic blocks entered:\n";
+    for (const Function &function : functions)
+    {
+        os << "  " << function.cfg->ast->name << ":\n";
+        for (const Block &block : function.blocks)
+            os << "    " << std::left << std::setw(24) << block.bb->label
+               << std::right << std::setw(12) << block.count << "\n";
+    }
+}
@@ -0,0 +1,84 @@
+#ifndef IRINTERPRETER_H
+#define IRINTERPRETER_H
+
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "IR.h"
+#include "IRInstr.h"
+
+/*---------------------------------------------------
+ * IRInterpreter : exécution directe de l'IR (--interpret)
+ *
+ * Les CFG des fonctions sont parcourus bloc par bloc, sans
+ * assembleur : chaque appel empile un Frame qui porte ses
+ * registres virtuels (entiers 32 bits), sur une pile explicite
+ * plutôt que celle du processus hôte. Un bloc se termine comme dans le code émis
+ * par BasicBlock::gen_asm (test_var choisit entre exit_true et
+ * exit_false, exit_true seul est un saut, sans sortie on continue
+ * sur le bloc suivant du CFG, après le dernier on atteint
+ * l'épilogue). Les IRPhi en tête de bloc (forme SSA) prennent
+ * ensemble la source du bloc précédent. Un opérande immédiat est
+ * un registre déjà chargé à l'entrée de l'appel. putchar et
+ * getchar sont ceux de la libc.
+ *
+ * Chaque instruction exécutée est comptée par opcode, chaque
+ * bloc à chacune de ses entrées : report() écrit ce profil.
+ * Une division par zéro ou un débordement de idiv lève
+ * CompileError au lieu du SIGFPE du code natif.
+ *---------------------------------------------------*/
+class IRInterpreter {
+public:
+    // Le CFG doit survivre à l'interpréteur
+    void addFunction(CFG &cfg);
+
+    // Appelle main() et renvoie sa valeur de retour
+    int runMain();
+
+    // Compteurs dynamiques par opcode puis par bloc, fonction par fonction
+    void report(std::ostream &os) const;
+
+private:
+    static const int EPILOGUE = -1;    // sortie de bloc vers l'épilogue
+
+    struct Block {
+        BasicBlock *bb;
+        int exitTrue = EPILOGUE;       // indices dans Function::blocks
+        int exitFalse = EPILOGUE;
+        long count = 0;
+    };
+    struct Function {
+        explicit Function(CFG *cfg) : cfg(cfg) {}
+
+        CFG *cfg;
+        std::vector<Block> blocks;
+        std::unordered_map<std::string, int> byLabel; // cibles des IRBranch
+        std::vector<int> initialRegs;   // registres d'un appel : 0, ou la valeur d'un immédiat
+    };
+
+    // Appel en cours d'exécution
+    struct Frame {
+        Function *function;
+        std::vector<int> regs;         // registres virtuels de la fonction
+        std::vector<int> args;         // valeurs lues par IRParamLoad
+        int retVar;                    // registre de l'appelant recevant le résultat
+        int block = 0;                 // bloc courant, EPILOGUE une fois terminé
+        int previous = EPILOGUE;       // bloc d'où l'on vient, pour les IRPhi
+        size_t next = 0;               // prochaine instruction du bloc
+        int result = 0;                // sans return, valeur indéfinie en C : 0 ici
+    };
+
+    std::vector<Function> functions;   // dans l'ordre du source
+    std::unordered_map<std::string, size_t> byName;
+    std::vector<Frame> stack;
+    long opcodeCounts[(size_t)IROpcode::Count] = {};
+
+    void push(Function &function, std::vector<int> args, int retVar);
+    int execute(Frame &frame, const IRInstr &instr);
+    size_t enterBlock(Frame &frame, const Block &block);
+    int blockIndex(const Function &function, const BasicBlock *bb) const;
+};
+
+#endif
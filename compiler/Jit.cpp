@@ -0,0 +1,119 @@
+#include "Jit.h"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "CompileError.h"
+
+// Fonctions de la bibliothèque que les programmes ifcc peuvent appeler
+static void *externalAddress(const std::string &name)
+{
+    if (name == "putchar")
+        return (void *)&putchar;
+    if (name == "getchar")
+        return (void *)&getchar;
+    return nullptr;
+}
+
+JitProgram::JitProgram(const X86Assembler &assembler)
+{
+#if !defined(__x86_64__)
+    throw CompileError("--run needs an x86-64 host");
+#else
+    const std::vector<uint8_t> &code = assembler.code();
+    const std::vector<X86Assembler::Symbol> &symbols = assembler.symbols();
+
+    // Un relais de 12 octets par symbole non défini, après le code
+    const size_t STUB_SIZE = 12;
+    std::vector<size_t> address(symbols.size());
+    size_t stubs = code.size();
+    for (size_t i = 0; i < symbols.size(); i++)
+    {
+        if (symbols[i].defined)
+            address[i] = symbols[i].offset;
+        else
+        {
+            address[i] = stubs;
+            stubs += STUB_SIZE;
+        }
+    }
+
+    size_t page = sysconf(_SC_PAGESIZE);
+    size = (stubs + page - 1) / page * page;
+    if (size == 0)
+        size = page;
+    void *pages = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (pages == MAP_FAILED)
+        throw CompileError("--run: cannot map memory for the program");
+    memory = (uint8_t *)pages;
+    try
+    {
+        link(assembler, address);
+    }
+    catch (...)
+    {
+        munmap(memory, size);
+        memory = nullptr;
+        throw;
+    }
+#endif
+}
+
+// Recopie du code, relais vers la libc et relocations, puis passage en exécutable
+void JitProgram::link(const X86Assembler &assembler, const std::vector<size_t> &address)
+{
+    const std::vector<uint8_t> &code = assembler.code();
+    const std::vector<X86Assembler::Symbol> &symbols = assembler.symbols();
+    std::memcpy(memory, code.data(), code.size());
+
+    for (size_t i = 0; i < symbols.size(); i++)
+    {
+        const X86Assembler::Symbol &symbol = symbols[i];
+        if (symbol.defined)
+        {
+            if (symbol.name == "main")
+                mainEntry = memory + symbol.offset;
+            continue;
+        }
+        void *target = externalAddress(symbol.name);
+        if (target == nullptr)
+            throw CompileError("--run: undefined function '" + symbol.name + "'");
+        uint8_t *stub = memory + address[i];
+        uint64_t absolute = (uint64_t)target;
+        stub[0] = 0x48;     // movabs $target, %rax
+        stub[1] = 0xB8;
+        std::memcpy(stub + 2, &absolute, 8);
+        stub[10] = 0xFF;    // jmp *%rax
+        stub[11] = 0xE0;
+    }
+    if (mainEntry == nullptr)
+        throw CompileError("--run: the program has no main function");
+
+    // R_X86_64_PLT32 : S + A - P, tout est dans les mêmes pages
+    for (const X86Assembler::Relocation &r : assembler.relocations())
+    {
+        int32_t value = (int32_t)((int64_t)address[r.symbol] + r.addend - (int64_t)r.offset);
+        std::memcpy(memory + r.offset, &value, 4);
+    }
+
+    if (mprotect(memory, size, PROT_READ | PROT_EXEC) != 0)
+        throw CompileError("--run: cannot make the program executable");
+}
+
+JitProgram::~JitProgram()
+{
+    if (memory != nullptr)
+        munmap(memory, size);
+}
+
+int JitProgram::runMain()
+{
+    int (*entry)() = (int (*)())mainEntry;
+    int result = entry();
+    std::fflush(stdout);    // putchar écrit dans le tampon de stdout du processus
+    return result;
+}
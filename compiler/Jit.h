@@ -0,0 +1,41 @@
+#ifndef JIT_H
+#define JIT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "X86Assembler.h"
+
+/*---------------------------------------------------
+ * JitProgram : exécution en mémoire d'un programme assemblé (--run)
+ *
+ * Le code de X86Assembler est recopié dans des pages mmap, suivi
+ * d'un relais par fonction externe (movabs $adresse, %rax ; jmp
+ * *%rax) : putchar et getchar de la libc peuvent être à plus de
+ * 2 Go du code, hors de portée d'un call rel32. Les relocations
+ * sont appliquées comme le ferait ld, puis les pages passent de
+ * lecture-écriture à lecture-exécution avant l'appel de main.
+ *
+ * Hôte x86-64 uniquement ; CompileError sinon, ou si un symbole
+ * appelé n'est ni défini dans le programme ni putchar/getchar.
+ *---------------------------------------------------*/
+class JitProgram {
+public:
+    explicit JitProgram(const X86Assembler &assembler);
+    ~JitProgram();
+    JitProgram(const JitProgram &) = delete;
+    JitProgram &operator=(const JitProgram &) = delete;
+
+    // Appelle main() du programme et renvoie sa valeur de retour
+    int runMain();
+
+private:
+    uint8_t *memory = nullptr;
+    size_t size = 0;
+    uint8_t *mainEntry = nullptr;
+
+    void link(const X86Assembler &assembler, const std::vector<size_t> &address);
+};
+
+#endif
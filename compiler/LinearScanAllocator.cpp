@@ -0,0 +1,160 @@
+#include "LinearScanAllocator.h"
+#include "Liveness.h"
+#include "IR.h"
+#include <algorithm>
+#include <set>
+
+LinearScanAllocator::LinearScanAllocator(CFG &cfg,
+                                         const std::vector<std::string> &calleeSaved,
+                                         const std::vector<std::string> &callerSaved)
+    : cfg(cfg), calleeSaved(calleeSaved), callerSaved(callerSaved) {}
+
+bool LinearScanAllocator::isCalleeSaved(const std::string &reg) const
+{
+    return std::find(calleeSaved.begin(), calleeSaved.end(), reg) != calleeSaved.end();
+}
+
+void LinearScanAllocator::extend(int vreg, int pos)
+{
+    if (vreg == VRegTable::NONE)
+        return;
+    Interval &it = intervals[vreg];
+    if (it.start < 0)
+    {
+        it.vreg = vreg;
+        it.start = it.end = pos;
+        return;
+    }
+    it.start = std::min(it.start, pos);
+    it.end = std::max(it.end, pos);
+}
+
+void LinearScanAllocator::buildIntervals()
+{
+    Liveness liveness(cfg);
+    liveness.compute();
+
+    // Numérotation : l'instruction k lit ses sources en 2k et écrit sa destination en 2k+1,
+    // ce qui permet à la destination de réutiliser le registre d'une source qui meurt.
+    int k = 0;
+    for (auto bb : cfg.get_bbs())
+    {
+        int from = 2 * k;
+        for (int v : liveness.live_in(bb))
+            extend(v, from);
+
+        for (auto &instr : bb->instrs)
+        {
+            for (int v : instr->getUses())
+                extend(v, 2 * k);
+            for (int v : instr->getDefs())
+                extend(v, 2 * k + 1);
+            if (instr->isCall())
+                callPositions.push_back(2 * k);
+            k++;
+        }
+
+        int to = 2 * k;
+        if (bb->exit_true != nullptr && bb->exit_false != nullptr)
+            extend(bb->test_var, to);
+        for (int v : liveness.live_out(bb))
+            extend(v, to);
+        k++;
+    }
+
+    // Un intervalle qui commence sur l'appel (live-in d'un bloc ouvert par un
+    // call, ou argument encore lu ensuite) et lui survit le traverse aussi
+    for (auto &[vreg, it] : intervals)
+    {
+        for (int pos : callPositions)
+        {
+            if (it.start <= pos && pos < it.end)
+            {
+                it.crossesCall = true;
+                break;
+            }
+        }
+    }
+}
+
+void LinearScanAllocator::run()
+{
+    buildIntervals();
+
+    std::vector<Interval *> order;
+    for (auto &[vreg, it] : intervals)
+        order.push_back(&it);
+    std::stable_sort(order.begin(), order.end(),
+                     [](const Interval *a, const Interval *b) { return a->start < b->start; });
+
+    std::set<std::string> freeRegs(callerSaved.begin(), callerSaved.end());
+    freeRegs.insert(calleeSaved.begin(), calleeSaved.end());
+    std::vector<Interval *> active;
+
+    for (Interval *cur : order)
+    {
+        // Libère les registres des intervalles terminés
+        for (auto it = active.begin(); it != active.end();)
+        {
+            if ((*it)->end < cur->start)
+            {
+                freeRegs.insert((*it)->reg);
+                it = active.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+
+        // Un intervalle qui traverse un appel doit survivre à celui-ci : callee-saved uniquement.
+        // Sinon on préfère les caller-saved, qui n'ont pas à être sauvegardés dans le prologue.
+        std::vector<std::string> candidates;
+        if (!cur->crossesCall)
+            candidates = callerSaved;
+        candidates.insert(candidates.end(), calleeSaved.begin(), calleeSaved.end());
+
+        for (const auto &reg : candidates)
+        {
+            if (freeRegs.count(reg))
+            {
+                cur->reg = reg;
+                freeRegs.erase(reg);
+                break;
+            }
+        }
+
+        if (cur->reg.empty())
+        {
+            // Pression de registres : on évince l'intervalle actif qui se termine le plus tard
+            Interval *victim = nullptr;
+            for (Interval *a : active)
+            {
+                if (cur->crossesCall && !isCalleeSaved(a->reg))
+                    continue;
+                if (victim == nullptr || a->end > victim->end)
+                    victim = a;
+            }
+            if (victim == nullptr || victim->end <= cur->end)
+                continue; // cur reste en pile
+            cur->reg = victim->reg;
+            victim->reg.clear();
+            active.erase(std::find(active.begin(), active.end(), victim));
+        }
+        active.push_back(cur);
+    }
+
+    cfg.regAllocation.assign(cfg.get_stv().vregs.size(), "");
+    cfg.savedRegs.clear();
+    std::set<std::string> used;
+    for (auto &[vreg, it] : intervals)
+    {
+        if (it.reg.empty())
+            continue;
+        cfg.regAllocation[vreg] = it.reg;
+        used.insert(it.reg);
+    }
+    for (const auto &reg : calleeSaved)
+        if (used.count(reg))
+            cfg.savedRegs.push_back(reg);
+}
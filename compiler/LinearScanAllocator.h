@@ -0,0 +1,48 @@
+#ifndef LINEARSCANALLOCATOR_H
+#define LINEARSCANALLOCATOR_H
+
+#include <map>
+#include <string>
+#include <vector>
+
+class CFG;
+
+/*---------------------------------------------------
+ * LinearScanAllocator : allocation de registres par
+ * balayage linéaire (Poletto & Sarkar) sur le CFG.
+ *
+ * Les instructions sont numérotées dans l'ordre d'émission
+ * des blocs ; chaque registre virtuel reçoit un intervalle [start, end]
+ * couvrant tous les points où il est vivant. Ceux qui restent
+ * sans registre (spill) gardent leur emplacement dans la pile.
+ *---------------------------------------------------*/
+class LinearScanAllocator {
+public:
+    LinearScanAllocator(CFG &cfg,
+                        const std::vector<std::string> &calleeSaved,
+                        const std::vector<std::string> &callerSaved);
+
+    // Remplit cfg.regAllocation et cfg.savedRegs
+    void run();
+
+private:
+    struct Interval {
+        int vreg = -1;
+        int start = -1;
+        int end = -1;
+        bool crossesCall = false;
+        std::string reg;
+    };
+
+    CFG &cfg;
+    std::vector<std::string> calleeSaved;
+    std::vector<std::string> callerSaved;
+    std::map<int, Interval> intervals;
+    std::vector<int> callPositions;
+
+    void buildIntervals();
+    void extend(int vreg, int pos);
+    bool isCalleeSaved(const std::string &reg) const;
+};
+
+#endif
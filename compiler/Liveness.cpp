@@ -0,0 +1,79 @@
+#include "Liveness.h"
+#include "IR.h"
+
+Liveness::Liveness(CFG &cfg) : cfg(cfg) {}
+
+std::vector<BasicBlock *> Liveness::successors(BasicBlock *bb)
+{
+    std::vector<BasicBlock *> succs;
+    if (bb->exit_true != nullptr)
+        succs.push_back(bb->exit_true);
+    if (bb->exit_false != nullptr && bb->exit_false != bb->exit_true)
+        succs.push_back(bb->exit_false);
+    return succs;
+}
+
+void Liveness::computeUseDef(BasicBlock *bb)
+{
+    std::set<int> &u = use[bb];
+    std::set<int> &d = def[bb];
+    for (auto &instr : bb->instrs)
+    {
+        for (int v : instr->getUses())
+            if (d.count(v) == 0)
+                u.insert(v);
+        for (int v : instr->getDefs())
+            d.insert(v);
+    }
+    // La variable de test est lue à la fin du bloc, après toutes les instructions
+    if (bb->exit_true != nullptr && bb->exit_false != nullptr && bb->test_var != VRegTable::NONE
+        && d.count(bb->test_var) == 0)
+        u.insert(bb->test_var);
+}
+
+void Liveness::compute()
+{
+    const std::vector<BasicBlock *> &bbs = cfg.get_bbs();
+    for (auto bb : bbs)
+    {
+        computeUseDef(bb);
+        in[bb];
+        out[bb];
+    }
+
+    // in(B) = use(B) U (out(B) - def(B)) ; out(B) = U in(S), S successeur de B
+    bool changed = true;
+    while (changed)
+    {
+        changed = false;
+        for (auto it = bbs.rbegin(); it != bbs.rend(); ++it)
+        {
+            BasicBlock *bb = *it;
+            std::set<int> newOut;
+            for (auto succ : successors(bb))
+                newOut.insert(in[succ].begin(), in[succ].end());
+
+            std::set<int> newIn = use[bb];
+            for (int v : newOut)
+                if (def[bb].count(v) == 0)
+                    newIn.insert(v);
+
+            if (newOut != out[bb] || newIn != in[bb])
+            {
+                out[bb] = std::move(newOut);
+                in[bb] = std::move(newIn);
+                changed = true;
+            }
+        }
+    }
+}
+
+const std::set<int> &Liveness::live_in(BasicBlock *bb) const
+{
+    return in.at(bb);
+}
+
+const std::set<int> &Liveness::live_out(BasicBlock *bb) const
+{
+    return out.at(bb);
+}
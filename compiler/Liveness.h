@@ -0,0 +1,41 @@
+#ifndef LIVENESS_H
+#define LIVENESS_H
+
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+class CFG;
+class BasicBlock;
+
+/*---------------------------------------------------
+ * Liveness : analyse de durée de vie des variables IR
+ *
+ * Calcule, pour chaque BasicBlock du CFG, l'ensemble des
+ * registres virtuels vivants en entrée (live_in) et en sortie
+ * (live_out), par itération jusqu'au point fixe.
+ *---------------------------------------------------*/
+class Liveness {
+public:
+    explicit Liveness(CFG &cfg);
+
+    void compute();
+
+    const std::set<int> &live_in(BasicBlock *bb) const;
+    const std::set<int> &live_out(BasicBlock *bb) const;
+
+    // Successeurs d'un bloc (exit_true / exit_false non nuls)
+    static std::vector<BasicBlock *> successors(BasicBlock *bb);
+
+private:
+    CFG &cfg;
+    std::map<BasicBlock *, std::set<int>> use;
+    std::map<BasicBlock *, std::set<int>> def;
+    std::map<BasicBlock *, std::set<int>> in;
+    std::map<BasicBlock *, std::set<int>> out;
+
+    void computeUseDef(BasicBlock *bb);
+};
+
+#endif
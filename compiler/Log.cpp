@@ -0,0 +1,34 @@
+#include "Log.h"
+#include <cstdlib>
+
+namespace Log {
+
+int level = NONE;
+
+void init(int verbosity)
+{
+    level = verbosity;
+    if (const char *env = std::getenv("IFCC_VERBOSE"))
+    {
+        int envLevel = std::atoi(env);
+        if (envLevel > level)
+            level = envLevel;
+    }
+}
+
+std::ostream &stream()
+{
+    return std::cerr;
+}
+
+const char *prefix(int lvl)
+{
+    switch (lvl)
+    {
+    case INFO:  return "[INFO] ";
+    case DEBUG: return "[DEBUG] ";
+    default:    return "[TRACE] ";
+    }
+}
+
+}
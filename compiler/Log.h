@@ -0,0 +1,47 @@
+#ifndef LOG_H
+#define LOG_H
+
+#include <iostream>
+
+/*---------------------------------------------------
+ * Log : traces de diagnostic par niveaux
+ *
+ * Désactivées par défaut ; activées par -v (info), -vv (debug),
+ * -vvv (trace) ou par la variable d'environnement IFCC_VERBOSE=N.
+ * Désactivées, elles ne coûtent qu'un test d'entier : le message
+ * n'est pas formaté. Compilé avec -DIFCC_NO_LOG (make RELEASE=1),
+ * chaque appel disparaît complètement.
+ *
+ *   LOG_DEBUG("Added variable: " << name << " in scope " << level);
+ *---------------------------------------------------*/
+namespace Log {
+
+enum Level { NONE = 0, INFO = 1, DEBUG = 2, TRACE = 3 };
+
+extern int level;
+
+// Niveau initial : max(IFCC_VERBOSE, verbosity demandée sur la ligne de commande)
+void init(int verbosity);
+
+std::ostream &stream();
+const char *prefix(int lvl);
+
+}
+
+#ifdef IFCC_NO_LOG
+#define LOG_ENABLED(lvl) false
+#define LOG_AT(lvl, msg) do { } while (0)
+#else
+#define LOG_ENABLED(lvl) (Log::level >= (lvl))
+#define LOG_AT(lvl, msg)                                               \
+    do {                                                               \
+        if (LOG_ENABLED(lvl))                                          \
+            Log::stream() << Log::prefix(lvl) << msg << "\n";          \
+    } while (0)
+#endif
+
+#define LOG_INFO(msg)  LOG_AT(Log::INFO, msg)
+#define LOG_DEBUG(msg) LOG_AT(Log::DEBUG, msg)
+#define LOG_TRACE(msg) LOG_AT(Log::TRACE, msg)
+
+#endif
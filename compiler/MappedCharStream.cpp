@@ -0,0 +1,105 @@
+#include "MappedCharStream.h"
+
+#include <algorithm>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+MappedCharStream::~MappedCharStream()
+{
+    unmap();
+}
+
+void MappedCharStream::unmap()
+{
+    if (bytes != nullptr)
+        munmap(const_cast<char *>(bytes), count);
+    bytes = nullptr;
+    count = 0;
+    p = 0;
+}
+
+bool MappedCharStream::open(const std::string &path)
+{
+    unmap();
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        return false;
+
+    struct stat st;
+    if (fstat(fd, &st) < 0 || !S_ISREG(st.st_mode))
+    {
+        close(fd);
+        return false;
+    }
+
+    // Un fichier vide ne peut pas être projeté : flux vide
+    if (st.st_size > 0)
+    {
+        void *mapping = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapping == MAP_FAILED)
+        {
+            close(fd);
+            return false;
+        }
+        madvise(mapping, st.st_size, MADV_SEQUENTIAL); // le lexer lit d'un bout à l'autre
+        bytes = static_cast<const char *>(mapping);
+        count = st.st_size;
+    }
+    close(fd); // la projection reste valide après fermeture
+    name = path;
+    return true;
+}
+
+void MappedCharStream::consume()
+{
+    if (p >= count)
+        throw antlr4::IllegalStateException("cannot consume EOF");
+    p++;
+}
+
+// Même convention que ANTLRInputStream : LA(1) est le caractère courant,
+// LA(-1) le précédent, EOF hors du flux
+size_t MappedCharStream::LA(ssize_t i)
+{
+    if (i == 0)
+        return 0;
+    if (i < 0)
+    {
+        i++;
+        if ((ssize_t)p + i - 1 < 0)
+            return IntStream::EOF;
+    }
+    size_t pos = p + i - 1;
+    if (pos >= count)
+        return IntStream::EOF;
+    return (unsigned char)bytes[pos];
+}
+
+void MappedCharStream::seek(size_t index)
+{
+    p = std::min(index, count);
+}
+
+std::string MappedCharStream::getSourceName() const
+{
+    return name.empty() ? IntStream::UNKNOWN_SOURCE_NAME : name;
+}
+
+std::string MappedCharStream::getText(const antlr4::misc::Interval &interval)
+{
+    if (interval.a < 0 || interval.b < 0)
+        return "";
+    size_t start = interval.a;
+    size_t stop = std::min((size_t)interval.b, count - 1);
+    if (count == 0 || start >= count || stop < start)
+        return "";
+    return std::string(bytes + start, stop - start + 1);
+}
+
+std::string MappedCharStream::toString() const
+{
+    return std::string(bytes, count);
+}
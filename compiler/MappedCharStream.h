@@ -0,0 +1,54 @@
+#ifndef MAPPEDCHARSTREAM_H
+#define MAPPEDCHARSTREAM_H
+
+#include <string>
+
+#include "antlr4-runtime.h"
+
+/*---------------------------------------------------
+ * MappedCharStream : flux de caractères ANTLR lu directement
+ * dans une projection mmap du fichier source
+ *
+ * La grammaire ifcc est en ASCII : chaque octet est servi tel
+ * quel au lexer, sans décodage UTF-8 ni copie du fichier (les
+ * octets non ASCII, par exemple dans les commentaires, restent
+ * des caractères isolés). La projection doit survivre à l'arbre
+ * syntaxique : les tokens y relisent leur texte.
+ *---------------------------------------------------*/
+class MappedCharStream : public antlr4::CharStream {
+public:
+    MappedCharStream() = default;
+    MappedCharStream(const MappedCharStream &) = delete;
+    MappedCharStream &operator=(const MappedCharStream &) = delete;
+    ~MappedCharStream() override;
+
+    // Projette le fichier ; false s'il ne peut pas être ouvert
+    bool open(const std::string &path);
+
+    const char *data() const { return bytes; }
+    size_t length() const { return count; }
+
+    // IntStream
+    void consume() override;
+    size_t LA(ssize_t i) override;
+    ssize_t mark() override { return -1; }
+    void release(ssize_t) override {}
+    size_t index() override { return p; }
+    void seek(size_t index) override;
+    size_t size() override { return count; }
+    std::string getSourceName() const override;
+
+    // CharStream
+    std::string getText(const antlr4::misc::Interval &interval) override;
+    std::string toString() const override;
+
+private:
+    const char *bytes = nullptr;
+    size_t count = 0;
+    size_t p = 0;       // position du prochain caractère
+    std::string name;
+
+    void unmap();
+};
+
+#endif
@@ -0,0 +1,174 @@
+#include "SSABuilder.h"
+
+#include <unordered_map>
+
+#include "IR.h"
+#include "IRInstr.h"
+
+SSABuilder::SSABuilder(CFG &cfg) : cfg(cfg), dom(cfg) {}
+
+bool SSABuilder::run()
+{
+    if (cfg.get_bbs().empty())
+        return false;
+    cfg.remove_dead_exits();
+    dom.compute();
+    // Un phi du bloc d'entrée n'aurait pas de valeur pour l'entrée dans la
+    // fonction ; IRGenVisitor ne crée jamais de saut vers ce bloc
+    if (!dom.predecessors(cfg.get_bbs()[0]).empty())
+        return false;
+
+    varCount = cfg.get_stv().vregs.size();
+    placePhis();
+    rename();
+    return true;
+}
+
+void SSABuilder::placePhis()
+{
+    const std::vector<BasicBlock *> &blocks = dom.reversePostorder();
+    std::unordered_map<const BasicBlock *, int> blockId;
+    for (size_t i = 0; i < blocks.size(); i++)
+        blockId[blocks[i]] = (int)i;
+
+    // Variables lues avant d'être définies dans un bloc, et blocs qui les définissent
+    std::vector<char> global(varCount, 0);
+    std::vector<std::vector<BasicBlock *>> defSites(varCount);
+    std::vector<int> definedIn(varCount, -1);
+    for (size_t b = 0; b < blocks.size(); b++)
+    {
+        for (IRInstr *instr : blocks[b]->instrs)
+        {
+            for (int use : instr->getUses())
+                if (definedIn[use] != (int)b)
+                    global[use] = 1;
+            for (int def : instr->getDefs())
+            {
+                if (definedIn[def] != (int)b)
+                    defSites[def].push_back(blocks[b]);
+                definedIn[def] = (int)b;
+            }
+        }
+        int test = blocks[b]->test_var;
+        if (test != VRegTable::NONE && definedIn[test] != (int)b)
+            global[test] = 1;
+    }
+
+    // Frontière de dominance itérée des définitions de chaque variable globale
+    std::vector<int> hasPhi(blocks.size(), -1);
+    std::vector<int> queued(blocks.size(), -1);
+    for (int var = 0; var < varCount; var++)
+    {
+        if (!global[var])
+            continue;
+        std::vector<BasicBlock *> worklist = defSites[var];
+        for (BasicBlock *bb : worklist)
+            queued[blockId[bb]] = var;
+        while (!worklist.empty())
+        {
+            BasicBlock *bb = worklist.back();
+            worklist.pop_back();
+            for (BasicBlock *join : dom.frontier(bb))
+            {
+                int j = blockId[join];
+                if (hasPhi[j] == var)
+                    continue;
+                hasPhi[j] = var;
+                // Sources provisoires : la variable elle-même, renommée depuis chaque prédécesseur
+                IRPhi *phi = cfg.new_instr<IRPhi>(join, var);
+                for (BasicBlock *pred : dom.predecessors(join))
+                    phi->addIncoming(var, pred);
+                join->instrs.insert(join->instrs.begin(), phi);
+                if (queued[j] != var)
+                {
+                    queued[j] = var;
+                    worklist.push_back(join);
+                }
+            }
+        }
+    }
+}
+
+// Nom SSA courant d'une variable
+int SSABuilder::current(int var)
+{
+    if (!stacks[var].empty())
+        return stacks[var].back();
+    if (undefined[var] == VRegTable::NONE)
+    {
+        BasicBlock *entry = cfg.get_bbs()[0];
+        undefined[var] = cfg.create_new_tempvar();
+        undefinedInits.push_back(cfg.new_instr<IRLdConst>(entry, undefined[var], 0));
+    }
+    return undefined[var];
+}
+
+void SSABuilder::renameBlock(BasicBlock *bb, std::vector<int> &pushed)
+{
+    for (IRInstr *instr : bb->instrs)
+    {
+        // Les sources d'un phi sont renommées depuis ses prédécesseurs
+        if (instr->opcode() != IROpcode::Phi)
+            for (int use : instr->getUses())
+                instr->replaceUse(use, current(use));
+        for (int def : instr->getDefs())
+        {
+            int name = cfg.create_new_tempvar();
+            instr->replaceDef(def, name);
+            stacks[def].push_back(name);
+            pushed.push_back(def);
+        }
+    }
+    if (bb->test_var != VRegTable::NONE)
+        bb->test_var = current(bb->test_var);
+
+    for (BasicBlock *succ : DominatorTree::successors(bb))
+    {
+        for (IRInstr *instr : succ->instrs)
+        {
+            if (instr->opcode() != IROpcode::Phi)
+                break;
+            IRPhi *phi = static_cast<IRPhi *>(instr);
+            const std::vector<BasicBlock *> &preds = phi->getPreds();
+            for (size_t i = 0; i < preds.size(); i++)
+                if (preds[i] == bb)
+                    phi->setSource(i, current(phi->getSource(i)));
+        }
+    }
+}
+
+// Parcours préfixe de l'arbre des dominateurs ; les noms empilés par un
+// bloc sont retirés quand on quitte son sous-arbre
+void SSABuilder::rename()
+{
+    stacks.assign(varCount, {});
+    undefined.assign(varCount, VRegTable::NONE);
+    undefinedInits.clear();
+
+    struct Visit {
+        BasicBlock *bb;
+        size_t child;
+        std::vector<int> pushed;
+    };
+    std::vector<Visit> visits;
+    BasicBlock *entry = cfg.get_bbs()[0];
+    visits.push_back(Visit{entry, 0, {}});
+    renameBlock(entry, visits.back().pushed);
+    while (!visits.empty())
+    {
+        Visit &visit = visits.back();
+        const std::vector<BasicBlock *> &children = dom.children(visit.bb);
+        if (visit.child < children.size())
+        {
+            BasicBlock *child = children[visit.child++];
+            visits.push_back(Visit{child, 0, {}});
+            renameBlock(child, visits.back().pushed);
+            continue;
+        }
+        for (int var : visit.pushed)
+            stacks[var].pop_back();
+        visits.pop_back();
+    }
+
+    entry->instrs.insert(entry->instrs.begin(), undefinedInits.begin(), undefinedInits.end());
+}
@@ -0,0 +1,49 @@
+#ifndef SSABUILDER_H
+#define SSABUILDER_H
+
+#include <vector>
+
+#include "DominatorTree.h"
+
+class CFG;
+class BasicBlock;
+class IRInstr;
+
+/*---------------------------------------------------
+ * SSABuilder : mise en forme SSA du CFG (mem2reg, -O2)
+ *
+ * Chaque registre virtuel (variable utilisateur ou temporaire,
+ * une case de pile à -O0) défini plusieurs fois devient une suite
+ * de valeurs définies une seule fois. Les IRPhi sont placés sur la
+ * frontière de dominance itérée des définitions, seulement pour
+ * les variables lues dans un autre bloc que celui qui les définit
+ * (SSA semi-élaguée), puis le renommage parcourt l'arbre des
+ * dominateurs. Une lecture sans définition qui l'atteint vaut 0,
+ * comme la pile remise à zéro de l'interpréteur.
+ *
+ * Les sorties d'un bloc terminé par un return ne sont jamais
+ * empruntées : elles sont retirées avant le calcul
+ * (CFG::remove_dead_exits).
+ *---------------------------------------------------*/
+class SSABuilder {
+public:
+    explicit SSABuilder(CFG &cfg);
+
+    // Faux si le CFG est laissé tel quel (pas de forme SSA)
+    bool run();
+
+private:
+    CFG &cfg;
+    DominatorTree dom;
+    int varCount = 0;                          // registres virtuels avant renommage
+    std::vector<std::vector<int>> stacks;      // pile des noms SSA de chaque variable
+    std::vector<int> undefined;                // valeur 0 d'une variable lue sans définition
+    std::vector<IRInstr *> undefinedInits;
+
+    void placePhis();
+    void rename();
+    void renameBlock(BasicBlock *bb, std::vector<int> &pushed);
+    int current(int var);
+};
+
+#endif
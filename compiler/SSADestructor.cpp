@@ -0,0 +1,103 @@
+#include "SSADestructor.h"
+
+#include "IR.h"
+#include "IRInstr.h"
+
+SSADestructor::SSADestructor(CFG &cfg) : cfg(cfg) {}
+
+void SSADestructor::run()
+{
+    // Copie de la liste : splitEdge insère des blocs dans le CFG
+    std::vector<BasicBlock *> blocks = cfg.get_bbs();
+    for (BasicBlock *bb : blocks)
+    {
+        size_t phiCount = 0;
+        while (phiCount < bb->instrs.size() && bb->instrs[phiCount]->opcode() == IROpcode::Phi)
+            phiCount++;
+        if (phiCount == 0)
+            continue;
+
+        // Copies parallèles (destination, source) de chaque arête entrante
+        std::vector<BasicBlock *> preds;
+        std::vector<std::vector<std::pair<int, int>>> copies;
+        for (size_t i = 0; i < phiCount; i++)
+        {
+            IRPhi *phi = static_cast<IRPhi *>(bb->instrs[i]);
+            int dest = phi->getParams()[0];
+            for (size_t j = 0; j < phi->getPreds().size(); j++)
+            {
+                size_t edge = 0;
+                while (edge < preds.size() && preds[edge] != phi->getPreds()[j])
+                    edge++;
+                if (edge == preds.size())
+                {
+                    preds.push_back(phi->getPreds()[j]);
+                    copies.emplace_back();
+                }
+                copies[edge].emplace_back(dest, phi->getSource(j));
+            }
+        }
+        bb->instrs.erase(bb->instrs.begin(), bb->instrs.begin() + phiCount);
+
+        for (size_t edge = 0; edge < preds.size(); edge++)
+        {
+            BasicBlock *pred = preds[edge];
+            bool conditional = pred->exit_true != nullptr && pred->exit_false != nullptr
+                               && pred->exit_true != pred->exit_false;
+            emitCopies(conditional ? splitEdge(pred, bb) : pred, copies[edge]);
+        }
+    }
+}
+
+// Bloc inséré sur l'arête pred -> succ, placé juste après pred : pred finit
+// par un saut conditionnel, aucun bloc ne tombait donc sur son successeur
+BasicBlock *SSADestructor::splitEdge(BasicBlock *pred, BasicBlock *succ)
+{
+    BasicBlock *edge = cfg.new_BB(cfg.new_BB_name());
+    edge->label += "_edge";
+    edge->exit_true = succ;
+    if (pred->exit_true == succ)
+        pred->exit_true = edge;
+    else
+        pred->exit_false = edge;
+    cfg.insert_bb_after(pred, edge);
+    return edge;
+}
+
+// Séquentialise des copies parallèles à la fin de bb
+void SSADestructor::emitCopies(BasicBlock *bb, std::vector<std::pair<int, int>> copies)
+{
+    // La destination de copies[i] est-elle encore lue par une autre copie ?
+    auto stillRead = [&](size_t i) {
+        for (size_t j = 0; j < copies.size(); j++)
+            if (j != i && copies[j].second == copies[i].first)
+                return true;
+        return false;
+    };
+
+    while (!copies.empty())
+    {
+        bool emitted = false;
+        for (size_t i = 0; i < copies.size() && !emitted; i++)
+        {
+            if (copies[i].first != copies[i].second)
+            {
+                if (stillRead(i))
+                    continue;
+                bb->add_IRInstr(cfg.new_instr<IRCopy>(bb, copies[i].first, copies[i].second));
+            }
+            copies.erase(copies.begin() + i);
+            emitted = true;
+        }
+        if (emitted)
+            continue;
+
+        // Seulement des cycles : la valeur d'une destination est mise de côté
+        int dest = copies[0].first;
+        int saved = cfg.create_new_tempvar();
+        bb->add_IRInstr(cfg.new_instr<IRCopy>(bb, saved, dest));
+        for (auto &copy : copies)
+            if (copy.second == dest)
+                copy.second = saved;
+    }
+}
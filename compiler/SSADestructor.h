@@ -0,0 +1,34 @@
+#ifndef SSADESTRUCTOR_H
+#define SSADESTRUCTOR_H
+
+#include <utility>
+#include <vector>
+
+class CFG;
+class BasicBlock;
+
+/*---------------------------------------------------
+ * SSADestructor : sortie de la forme SSA avant l'émission
+ *
+ * Les IRPhi d'un bloc sont des copies parallèles, une par arête
+ * entrante. Elles deviennent des IRCopy à la fin du prédécesseur,
+ * avant son saut ; si le prédécesseur se termine par un saut
+ * conditionnel, l'arête est critique et un bloc intermédiaire est
+ * inséré juste après lui dans le CFG. Les copies d'une même arête
+ * sont ordonnées pour qu'aucune source ne soit écrasée avant
+ * d'être lue, un cycle (échange) passant par un temporaire.
+ *---------------------------------------------------*/
+class SSADestructor {
+public:
+    explicit SSADestructor(CFG &cfg);
+
+    void run();
+
+private:
+    CFG &cfg;
+
+    BasicBlock *splitEdge(BasicBlock *pred, BasicBlock *succ);
+    void emitCopies(BasicBlock *bb, std::vector<std::pair<int, int>> copies);
+};
+
+#endif
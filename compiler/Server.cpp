@@ -0,0 +1,397 @@
+#include "Server.h"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <exception>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include <csignal>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "AsmCache.h"
+#include "CompileError.h"
+#include "Log.h"
+
+/*--- Entrées / sorties sur la socket ---*/
+
+static bool writeAll(int fd, const char *data, size_t size)
+{
+    while (size > 0)
+    {
+        ssize_t n = write(fd, data, size);
+        if (n <= 0)
+            return false;
+        data += n;
+        size -= n;
+    }
+    return true;
+}
+
+static bool readExact(int fd, std::string &out, size_t size)
+{
+    out.resize(size);
+    size_t done = 0;
+    while (done < size)
+    {
+        ssize_t n = read(fd, &out[done], size - done);
+        if (n <= 0)
+            return false;
+        done += n;
+    }
+    return true;
+}
+
+// Taille maximale d'une ligne d'en-tête ("COMPILE 2 123456\n", "OK 42 7\n"...)
+static const size_t MAX_HEADER_SIZE = 256;
+
+// Lit une ligne d'en-tête (sans le '\n'), octet par octet : les en-têtes sont courts.
+// Échoue aussi au-delà de MAX_HEADER_SIZE octets sans '\n' (line est alors plus longue).
+static bool readLine(int fd, std::string &line)
+{
+    line.clear();
+    char c;
+    while (line.size() <= MAX_HEADER_SIZE)
+    {
+        ssize_t n = read(fd, &c, 1);
+        if (n <= 0)
+            return false;
+        if (c == '\n')
+            return true;
+        line += c;
+    }
+    return false;
+}
+
+// Les diagnostics éventuels précèdent le contenu et sont annoncés par une seconde taille
+static bool sendMessage(int fd, const std::string &status, const std::string &payload,
+                        const std::string &diagnostics = "")
+{
+    std::string header = status + " " + std::to_string(payload.size());
+    if (!diagnostics.empty())
+        header += " " + std::to_string(diagnostics.size());
+    header += "\n";
+    return writeAll(fd, header.data(), header.size()) && writeAll(fd, diagnostics.data(), diagnostics.size())
+           && writeAll(fd, payload.data(), payload.size());
+}
+
+static int connectTo(const std::string &socketPath)
+{
+    sockaddr_un addr{};
+    if (socketPath.size() >= sizeof(addr.sun_path))
+    {
+        std::cerr << "error: socket path too long: " << socketPath << std::endl;
+        return -1;
+    }
+    addr.sun_family = AF_UNIX;
+    std::strcpy(addr.sun_path, socketPath.c_str());
+
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0 || connect(fd, (sockaddr *)&addr, sizeof(addr)) < 0)
+    {
+        std::cerr << "error: cannot connect to " << socketPath << ": " << std::strerror(errno) << std::endl;
+        if (fd >= 0)
+            close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+/*--- Statistiques du serveur ---*/
+
+// Les percentiles portent sur les WINDOW dernières requêtes : mémoire et
+// tri bornés quelle que soit la durée de vie du serveur
+class ServerStats {
+public:
+    static const size_t WINDOW = 4096;
+
+    void record(double ms, bool ok)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (latencies.size() < WINDOW)
+            latencies.push_back(ms);
+        else
+            latencies[requests % WINDOW] = ms;
+        requests++;
+        if (!ok)
+            failures++;
+    }
+
+    std::string report(const AsmCache *cache)
+    {
+        std::vector<double> sorted;
+        long total;
+        long failed;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            sorted = latencies;
+            total = requests;
+            failed = failures;
+        }
+        std::sort(sorted.begin(), sorted.end());
+        auto percentile = [&](double p) {
+            if (sorted.empty())
+                return 0.0;
+            size_t i = std::min(sorted.size() - 1, (size_t)(p * sorted.size()));
+            return sorted[i];
+        };
+
+        std::ostringstream out;
+        out << "requests: " << total << "\n";
+        out << "failed: " << failed << "\n";
+        out << "latency window: last " << sorted.size() << " requests\n";
+        out << "latency p50: " << percentile(0.50) << " ms\n";
+        out << "latency p90: " << percentile(0.90) << " ms\n";
+        out << "latency p99: " << percentile(0.99) << " ms\n";
+        out << "LL fallbacks: " << AntlrFrontend::llFallbacks() << "\n";
+        if (cache != nullptr)
+            out << cache->report() << "\n";
+        return out.str();
+    }
+
+private:
+    std::mutex mutex;
+    std::vector<double> latencies;  // tampon circulaire, au plus WINDOW valeurs
+    long requests = 0;
+    long failures = 0;
+};
+
+/*--- Serveur ---*/
+
+// Taille maximale d'un source envoyé par un client
+static const size_t MAX_SOURCE_SIZE = 64 << 20;
+
+// Nombre maximal de connexions servies en même temps
+static const int MAX_CONNECTIONS = 64;
+
+// Compte les connexions en cours : une fois MAX_CONNECTIONS atteint, la boucle
+// d'acceptation attend qu'une se termine (les clients patientent dans la file de listen)
+class ConnectionGate {
+public:
+    explicit ConnectionGate(int capacity) : available(capacity) {}
+
+    void acquire()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        released.wait(lock, [this] { return available > 0; });
+        available--;
+    }
+
+    void release()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        available++;
+        released.notify_one();
+    }
+
+private:
+    std::mutex mutex;
+    std::condition_variable released;
+    int available;
+};
+
+// Compile une requête ; renvoie false et le message d'erreur dans result en cas d'échec.
+// Les erreurs de syntaxe et les avertissements sont écrits dans options.diagnostics,
+// comme sur stderr en direct.
+static bool compileRequest(Frontend &frontend, const std::string &source, const CompileOptions &options, std::string &result)
+{
+    AST ast;
+    frontend.diagnostics = options.diagnostics;
+    bool parsed = frontend.parseToAST(source, ast);
+    frontend.diagnostics = &std::cerr;
+    if (!parsed)
+    {
+        result = "syntax error during parsing";
+        return false;
+    }
+    std::ostringstream assembly;
+    try
+    {
+        compileProgram(ast, options, assembly);
+    }
+    catch (const CompileError &e)
+    {
+        result = e.what();
+        return false;
+    }
+    result = assembly.str();
+    return true;
+}
+
+static void serveRequests(int fd, ServerStats &stats, const CompileOptions &defaults)
+{
+    std::unique_ptr<Frontend> frontend = createFrontend(defaults.frontend);
+    std::string line;
+    while (true)
+    {
+        if (!readLine(fd, line))
+        {
+            if (line.size() > MAX_HEADER_SIZE)
+                sendMessage(fd, "ERROR", "header too long (max " + std::to_string(MAX_HEADER_SIZE) + " bytes)");
+            break;
+        }
+        std::istringstream header(line);
+        std::string command;
+        header >> command;
+
+        if (command == "STATS")
+        {
+            if (!sendMessage(fd, "OK", stats.report(defaults.cache)))
+                break;
+            continue;
+        }
+
+        CompileOptions options = defaults;
+        size_t size = 0;
+        std::string source;
+        if (command != "COMPILE" || !(header >> options.optLevel >> size))
+        {
+            sendMessage(fd, "ERROR", "bad request: " + line);
+            break;
+        }
+        if (size > MAX_SOURCE_SIZE)
+        {
+            sendMessage(fd, "ERROR", "source too large: " + std::to_string(size) + " bytes (max "
+                                     + std::to_string(MAX_SOURCE_SIZE) + ")");
+            break;
+        }
+        if (!readExact(fd, source, size))
+            break;
+
+        auto start = std::chrono::steady_clock::now();
+        std::string result;
+        std::ostringstream diagnostics;
+        options.diagnostics = &diagnostics;
+        bool ok = compileRequest(*frontend, source, options, result);
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        stats.record(ms, ok);
+        LOG_INFO("request: " << (ok ? "ok" : "error") << ", " << ms << " ms");
+
+        if (!sendMessage(fd, ok ? "OK" : "ERROR", result, diagnostics.str()))
+            break;
+    }
+}
+
+// Une exception imprévue (mémoire épuisée...) ne ferme que sa connexion :
+// sortie d'un thread détaché, elle terminerait tout le serveur
+static void serveConnection(int fd, ServerStats &stats, const CompileOptions &defaults, ConnectionGate &gate)
+{
+    try
+    {
+        serveRequests(fd, stats, defaults);
+    }
+    catch (const std::exception &e)
+    {
+        LOG_INFO("connection closed on internal error: " << e.what());
+        sendMessage(fd, "ERROR", std::string("internal error: ") + e.what());
+    }
+    close(fd);
+    gate.release();
+}
+
+int runServer(const std::string &socketPath, const CompileOptions &defaults)
+{
+    sockaddr_un addr{};
+    if (socketPath.size() >= sizeof(addr.sun_path))
+    {
+        std::cerr << "error: socket path too long: " << socketPath << std::endl;
+        return 1;
+    }
+    addr.sun_family = AF_UNIX;
+    std::strcpy(addr.sun_path, socketPath.c_str());
+
+    int listenFd = socket(AF_UNIX, SOCK_STREAM, 0);
+    unlink(socketPath.c_str()); // socket laissée par un serveur précédent
+    if (listenFd < 0 || bind(listenFd, (sockaddr *)&addr, sizeof(addr)) < 0 || listen(listenFd, 64) < 0)
+    {
+        std::cerr << "error: cannot listen on " << socketPath << ": " << std::strerror(errno) << std::endl;
+        return 1;
+    }
+    signal(SIGPIPE, SIG_IGN); // un client qui se déconnecte ne doit pas tuer le serveur
+    LOG_INFO("listening on " << socketPath);
+
+    ServerStats stats;
+    ConnectionGate gate(MAX_CONNECTIONS);
+    while (true)
+    {
+        gate.acquire();
+        int fd = accept(listenFd, nullptr, nullptr);
+        if (fd < 0)
+        {
+            gate.release();
+            if (errno == EINTR)
+                continue;
+            std::cerr << "error: accept: " << std::strerror(errno) << std::endl;
+            close(listenFd);
+            return 1;
+        }
+        std::thread(serveConnection, fd, std::ref(stats), std::cref(defaults), std::ref(gate)).detach();
+    }
+}
+
+/*--- Clients ---*/
+
+// Envoie une requête et attend la réponse ; renvoie false si la connexion a échoué
+static bool exchange(int fd, const std::string &request, std::string &status, std::string &payload,
+                     std::string &diagnostics)
+{
+    std::string line;
+    size_t size = 0, diagnosticsSize = 0;
+    if (!writeAll(fd, request.data(), request.size()) || !readLine(fd, line))
+        return false;
+    std::istringstream header(line);
+    if (!(header >> status >> size))
+        return false;
+    header >> diagnosticsSize;
+    return readExact(fd, diagnostics, diagnosticsSize) && readExact(fd, payload, size);
+}
+
+int runClient(const std::string &socketPath, const std::string &source, const CompileOptions &options)
+{
+    int fd = connectTo(socketPath);
+    if (fd < 0)
+        return 1;
+
+    std::string request = "COMPILE " + std::to_string(options.optLevel) + " " + std::to_string(source.size()) + "\n" + source;
+    std::string status, payload, diagnostics;
+    bool connected = exchange(fd, request, status, payload, diagnostics);
+    close(fd);
+    if (!connected)
+    {
+        std::cerr << "error: connection to server lost" << std::endl;
+        return 1;
+    }
+    std::cerr << diagnostics;
+    if (status != "OK")
+    {
+        std::cerr << "[ERROR] " << payload << std::endl;
+        return 1;
+    }
+    std::cout << payload;
+    return 0;
+}
+
+int runStatsClient(const std::string &socketPath)
+{
+    int fd = connectTo(socketPath);
+    if (fd < 0)
+        return 1;
+
+    std::string status, payload, diagnostics;
+    bool connected = exchange(fd, "STATS\n", status, payload, diagnostics);
+    close(fd);
+    if (!connected)
+    {
+        std::cerr << "error: connection to server lost" << std::endl;
+        return 1;
+    }
+    std::cout << payload;
+    return 0;
+}
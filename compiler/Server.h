@@ -0,0 +1,38 @@
+#ifndef SERVER_H
+#define SERVER_H
+
+#include <string>
+
+#include "Driver.h"
+
+/*---------------------------------------------------
+ * Mode serveur : ifcc --server /chemin/socket
+ *
+ * Le processus reste vivant et écoute sur une socket Unix ;
+ * chaque connexion est servie par son propre thread (64 au plus en
+ * même temps, les suivantes attendent), qui garde
+ * un Frontend : le cache DFA d'ANTLR reste chaud entre les
+ * requêtes au lieu d'être reconstruit à chaque lancement.
+ *
+ * Protocole (une connexion peut enchaîner les requêtes) :
+ *   COMPILE <optLevel> <taille>\n<source>  -> OK <taille> [<tailleDiag>]\n[<diag>]<asm>
+ *                                          ou ERROR <taille> [<tailleDiag>]\n[<diag>]<message>
+ *   STATS\n                                -> OK <taille>\n<statistiques>
+ * <diag> : erreurs de syntaxe ("line L:C ...") et avertissements
+ * ([WARNING] ...) de la compilation, que le client réécrit sur sa
+ * sortie d'erreur comme une compilation directe.
+ * Un en-tête de plus de 256 octets ou un source de plus de 64 Mo est
+ * refusé et la connexion fermée.
+ *---------------------------------------------------*/
+
+// Boucle d'acceptation ; ne rend la main qu'en cas d'erreur de la socket.
+// defaults fournit le cache éventuel ; le niveau d'optimisation vient de chaque requête.
+int runServer(const std::string &socketPath, const CompileOptions &defaults);
+
+// Client léger : envoie un fichier au serveur et écrit l'assembleur sur la sortie standard
+int runClient(const std::string &socketPath, const std::string &source, const CompileOptions &options);
+
+// Client léger : affiche les statistiques du serveur
+int runStatsClient(const std::string &socketPath);
+
+#endif
@@ -1,15 +1,15 @@
 #include "SymbolTableVisitor.h"
 #include "IR.h"  // Pour INTSIZE et éventuelles dépendances
+#include "Log.h"
+#include "CompileError.h"
 #include <iostream>
 #include <cstdlib>
 
 SymbolTableVisitor::SymbolTableVisitor() {
-    currentScope = new Scope;
+    currentScope = arena.make<Scope>();
     currentScope->offset = INTSIZE;  // Par exemple, 4 octets
     currentScope->parent = nullptr;
     currentScope->level = 1;         // Scope global = niveau 1
-    functionTable = nullptr;
-    tempSuffixCounter = 1;
 }
 
 int SymbolTableVisitor::getScopeLevel(Scope* scope) const {
@@ -26,84 +26,93 @@ Scope* SymbolTableVisitor::getGlobalScope() const {
     return scope;
 }
 
-std::string SymbolTableVisitor::addToSymbolTable(const std::string &s) {
-    // Pour les temporaires dont le nom commence par '!'
-    if (!s.empty() && s[0] == '!') {
-        if (currentScope->symbols.find(s) != currentScope->symbols.end()) {
-            writeWarning(s + " is already defined in this scope");
-            return currentScope->symbols[s].uniqueName;
-        }
-        int varOffset = currentScope->offset;
-        currentScope->offset += INTSIZE;
-        SymbolTableStruct symbol;
-        symbol.offset = -varOffset;
-        symbol.uniqueName = s;
-        symbol.initialised = false;
-        symbol.used = false;
-        currentScope->symbols[s] = symbol;
-        std::cerr << "[DEBUG] Added temporary: " << s << "\n";
-        return s;
-    }
+int SymbolTableVisitor::addToSymbolTable(const std::string &s) {
     // Pour une variable utilisateur, la clé est le nom d'origine
     if (currentScope->symbols.find(s) != currentScope->symbols.end()) {
         writeWarning(s + " is already defined in this scope");
-        return currentScope->symbols[s].uniqueName;
+        return currentScope->symbols[s].vreg;
     }
     int level = getScopeLevel(currentScope);  // Par exemple, 1 pour global, 2 pour un bloc interne
-    std::string uniqueName = "s" + std::to_string(level) + "_" + s;
-    
-    int varOffset = currentScope->offset;
-    currentScope->offset += INTSIZE;
     
     SymbolTableStruct symbol;
-    symbol.offset = -varOffset;
-    symbol.uniqueName = uniqueName;
+    symbol.vreg = vregs.addVariable(s, level);
     symbol.initialised = false;
     symbol.used = false;
     
     currentScope->symbols[s] = symbol;
-    std::cerr << "[DEBUG] Added variable: " << s << " -> " << uniqueName << " in scope level " << level << "\n";
-    return uniqueName;
+    LOG_DEBUG("Added variable: " << s << " -> " << vregs.name(symbol.vreg) << " in scope level " << level);
+    return symbol.vreg;
 }
 
-std::string SymbolTableVisitor::getUniqueName(const std::string &s) const {
+int SymbolTableVisitor::getVReg(const std::string &s) const {
     Scope* scope = currentScope;
     while (scope != nullptr) {
         auto it = scope->symbols.find(s);
         if (it != scope->symbols.end()) {
-            std::cerr << "[DEBUG] getUniqueName: found \"" << s << "\" -> " 
-                      << it->second.uniqueName << " in scope level " << getScopeLevel(scope) << "\n";
-            return it->second.uniqueName;
+            LOG_TRACE("getVReg: found \"" << s << "\" -> " 
+                      << vregs.name(it->second.vreg) << " in scope level " << getScopeLevel(scope));
+            return it->second.vreg;
         }
         scope = scope->parent;
     }
     // Si non trouvé dans les scopes actifs, consulter aggregatedSymbols.
     auto itGlobal = aggregatedSymbols.find(s);
     if (itGlobal != aggregatedSymbols.end()) {
-        std::cerr << "[DEBUG] getUniqueName (from aggregated): found \"" << s << "\" -> " 
-                  << itGlobal->second.uniqueName << "\n";
-        return itGlobal->second.uniqueName;
+        LOG_TRACE("getVReg (from aggregated): found \"" << s << "\" -> " 
+                  << vregs.name(itGlobal->second.vreg));
+        return itGlobal->second.vreg;
+    }
+    throw CompileError("getVReg: \"" + s + "\" is not defined");
+}
+
+// Déclaration dans le scope courant ; l'initialisation est marquée avant
+// l'évaluation de la valeur initiale (comme pour "int a = a;")
+int SymbolTableVisitor::declareVariable(const std::string &s, bool initialised) {
+    int vreg = addToSymbolTable(s);
+    if (initialised)
+        currentScope->symbols[s].initialised = true;
+    return vreg;
+}
+
+int SymbolTableVisitor::useVariable(const std::string &s) {
+    for (Scope* scope = currentScope; scope != nullptr; scope = scope->parent) {
+        auto it = scope->symbols.find(s);
+        if (it != scope->symbols.end()) {
+            if (!it->second.initialised) {
+                fatalError(s + " is not initialised");
+            }
+            it->second.used = true;
+            return it->second.vreg;
+        }
+    }
+    fatalError(s + " is not defined");
+}
+
+int SymbolTableVisitor::assignVariable(const std::string &s) {
+    for (Scope* scope = currentScope; scope != nullptr; scope = scope->parent) {
+        auto it = scope->symbols.find(s);
+        if (it != scope->symbols.end()) {
+            it->second.initialised = true;
+            return it->second.vreg;
+        }
     }
-    std::cerr << "[ERROR] getUniqueName: \"" << s << "\" is not defined\n";
-    exit(EXIT_FAILURE);
-    return "";
+    fatalError(s + " is not defined");
+}
+
+// Les temporaires ne passent pas par les scopes : seul un identifiant de
+// registre virtuel leur est attribué (case de pile éventuelle : CFG::gen_asm).
+int SymbolTableVisitor::createNewTemp() {
+    return vregs.addTemp();
 }
-std::string SymbolTableVisitor::createNewTemp() {
+
+// Tous les emplacements de la fonction (variables de tous les scopes et
+// temporaires) sont pris sur le compteur du scope global, au moment où
+// CFG::gen_asm les attribue aux registres virtuels restés en mémoire.
+int SymbolTableVisitor::allocateSlot() {
     Scope* global = getGlobalScope();
-    std::string temp = "!tmp" + std::to_string(tempSuffixCounter++);
-    
-    // Ajouter au scope GLOBAL
     int varOffset = global->offset;
     global->offset += INTSIZE;
-    
-    SymbolTableStruct symbol;
-    symbol.offset = -varOffset;
-    symbol.uniqueName = temp;
-    symbol.initialised = true;
-    symbol.used = true;
-    
-    global->symbols[temp] = symbol; // Clé = uniqueName
-    return temp;
+    return -varOffset;
 }
 
 void SymbolTableVisitor::checkSymbolTable() {
@@ -117,134 +126,47 @@ void SymbolTableVisitor::checkSymbolTable() {
 
 void SymbolTableVisitor::writeWarning(const std::string &message) {
     warning++;
-    std::cerr << "[WARNING] " << message << "\n";
+    *diagnostics << "[WARNING] " << message << "\n";
 }
 
 void SymbolTableVisitor::writeError(const std::string &message) {
     error++;
-    std::cerr << "[ERROR] " << message << "\n";
+    *diagnostics << "[ERROR] " << message << "\n";
+}
+
+// Erreur qui interrompt la compilation de la fonction (voir CompileError)
+void SymbolTableVisitor::fatalError(const std::string &message) {
+    error++;
+    throw CompileError(message);
 }
 
 void SymbolTableVisitor::enterScope() {
-    Scope* newScope = new Scope;
+    Scope* newScope = arena.make<Scope>();
     newScope->parent = currentScope;
     newScope->offset = currentScope->offset;
     newScope->level = currentScope->level + 1;
     currentScope = newScope;
-    std::cerr << "[DEBUG] Enter new scope (level " << newScope->level << ")" << "\n";
+    LOG_DEBUG("Enter new scope (level " << newScope->level << ")");
 }
 
 void SymbolTableVisitor::exitScope() {
-    Scope* oldScope = currentScope;
-    currentScope = currentScope->parent;
-    delete oldScope; // Les symboles locaux sont supprimés
-}
-
-
-antlrcpp::Any SymbolTableVisitor::visitAssign(ifccParser::AssignContext *ctx) {
-    return checkAssign(ctx->ID()->getText(), ctx->expr());
-}
-
-antlrcpp::Any SymbolTableVisitor::visitMinusAssign(ifccParser::MinusAssignContext *ctx) {
-    return checkAssign(ctx->ID()->getText(), ctx->expr());
-}
-
-antlrcpp::Any SymbolTableVisitor::visitPlusAssign(ifccParser::PlusAssignContext *ctx) {
-    return checkAssign(ctx->ID()->getText(), ctx->expr());
+    currentScope = currentScope->parent; // Le scope quitté est libéré avec l'arène
 }
 
-antlrcpp::Any SymbolTableVisitor::visitMulAssign(ifccParser::MulAssignContext *ctx) {
-    return checkAssign(ctx->ID()->getText(), ctx->expr());
-}
 
-antlrcpp::Any SymbolTableVisitor::visitDivAssign(ifccParser::DivAssignContext *ctx) {
-    return checkAssign(ctx->ID()->getText(), ctx->expr());
-}
-
-
-antlrcpp::Any SymbolTableVisitor::visitProg(ifccParser::ProgContext *ctx) {
-    currentScope->offset = INTSIZE;  // Réinitialisation éventuelle du global
-    
-    std::string funcName = ctx->ID()->getText();
-    std::string returnType = ctx->type()->getText();
-    std::vector<std::string> params;
-
-    if (ctx->decl_params()) {
-        for (auto param : ctx->decl_params()->param()) {
-            std::string paramName = param->ID()->getText();
-            addToSymbolTable(paramName);
-            currentScope->symbols[paramName].initialised = true;
-            params.push_back("int");
-        }
-    }
-    
-    if (functionTable) {
-        (*functionTable)[funcName] = FunctionSignature{returnType, params};
-    }
-    
-    for (auto inst : ctx->inst()) {
-        visit(inst);
-    }
-    
-    printGlobalSymbolTable(std::cerr);
-    return 0;
-}
-
-antlrcpp::Any SymbolTableVisitor::visitReturn_stmt(ifccParser::Return_stmtContext *ctx) {
-    if (ctx->expr())
-        visit(ctx->expr());
-    checkSymbolTable();
-    return 0;
-}
-
-antlrcpp::Any SymbolTableVisitor::visitBlock(ifccParser::BlockContext *ctx) {
-    enterScope(); // Nouveau scope interne (niveau 2)
-    printCurrentScope(std::cerr);
-    for (auto child : ctx->children) {
-        this->visit(child);  // Génère l'IR dans le scope interne
-    }
-    // Ici, avant exitScope(), le code du bloc interne utilise les symboles du niveau 2 (par ex. s2_a)
-    exitScope();
-    return 0;
-}
-
-
-antlrcpp::Any SymbolTableVisitor::visitDecl(ifccParser::DeclContext *ctx) {
-    std::string varName = ctx->ID()->getText();
-    std::string unique = addToSymbolTable(varName); // Par exemple, "s1_a" ou "s2_a"
-    if (ctx->expr() != nullptr) {
-        currentScope->symbols[varName].initialised = true;  // Inscrit dans le scope courant (clé = nom original)
-        visit(ctx->expr());
-    }
-    return unique;
-}
-
-antlrcpp::Any SymbolTableVisitor::visitIdExpr(ifccParser::IdExprContext *ctx) {
-    std::string varName = ctx->ID()->getText();
-    Scope* scope = currentScope;
-    while (scope != nullptr) {
-        if (scope->symbols.find(varName) != scope->symbols.end()) {
-            SymbolTableStruct &info = scope->symbols[varName];
-            if (!info.initialised) {
-                writeError(varName + " is not initialised");
-                exit(EXIT_FAILURE);
-            }
-            info.used = true;
-            return info.uniqueName;  // Par exemple "s1_a" ou "s2_a"
-        }
-        scope = scope->parent;
-    }
-    writeError(varName + " is not defined");
-    exit(EXIT_FAILURE);
-    return "";
+// Signature d'une fonction, sans visiter son corps (collecte préalable des signatures)
+FunctionSignature SymbolTableVisitor::signatureOf(const AST &ast, NodeId function) {
+    FunctionSignature sig;
+    sig.returnType = ast.op(function) ? "void" : "int";
+    sig.paramsTypes.assign(ast.paramCount(function), "int");
+    return sig;
 }
 
 void SymbolTableVisitor::printCurrentScope(std::ostream &os) const {
     os << "==== Current Scope Symbol Table ====\n";
     for (const auto &entry : currentScope->symbols) {
         os << "  " << entry.first 
-           << " -> offset: " << entry.second.offset 
-           << ", unique name: " << entry.second.uniqueName << "\n";
+           << " -> unique name: " << vregs.name(entry.second.vreg) << "\n";
     }
     os << "====================================\n";
 }
@@ -254,34 +176,7 @@ void SymbolTableVisitor::printGlobalSymbolTable(std::ostream &os) const {
     os << "==== Global Symbol Table ====\n";
     for (const auto &entry : global->symbols) {
         os << "  " << entry.first 
-           << " -> offset: " << entry.second.offset 
-           << ", unique name: " << entry.second.uniqueName << "\n";
+           << " -> unique name: " << vregs.name(entry.second.vreg) << "\n";
     }
     os << "=============================\n";
 }
-
-antlrcpp::Any SymbolTableVisitor::checkAssign(const std::string &varName, ifccParser::ExprContext* exprCtx) {
-    Scope* scope = currentScope;
-    bool found = false;
-
-    while (scope != nullptr) {
-        if (scope->symbols.find(varName) != scope->symbols.end()) {
-            scope->symbols[varName].initialised = true;
-            found = true;
-            break;
-        }
-        scope = scope->parent;
-    }
-
-    if (!found) {
-        writeError(varName + " is not defined");
-        exit(EXIT_FAILURE);
-    }
-
-    if (exprCtx != nullptr) {
-        visit(exprCtx);
-    }
-
-    return 0;
-}
-
@@ -1,19 +1,19 @@
 
 #pragma once
 
-#include "generated/ifccBaseVisitor.h"  // Chemin vers vos fichiers générés par ANTLR
-#include "generated/ifccParser.h"
+#include "AST.h"
 #include <unordered_map>
 #include <string>
 #include <map>
 #include <iostream>
+#include "VRegTable.h"
+#include "Arena.h"
 
 // Structure représentant une entrée de la table des symboles
 struct SymbolTableStruct {
     bool initialised = false;
-    int offset;
     bool used = false;
-    std::string uniqueName; 
+    int vreg = VRegTable::NONE;   // registre virtuel associé dans l'IR
 };
 
 
@@ -30,14 +30,14 @@ struct FunctionSignature {
     std::vector<std::string> paramsTypes;
 };
 
-class SymbolTableVisitor : public ifccBaseVisitor {
+class SymbolTableVisitor {
 public:
     static const int INTSIZE = 4;
 
-    int tempSuffixCounter; 
-
+    Arena arena;      // arène de la fonction : scopes, puis blocs de base et instructions IR
     Scope* currentScope;
-    std::map<std::string, FunctionSignature>* functionTable;
+    VRegTable vregs;  // registres virtuels de la fonction (variables et temporaires)
+    std::ostream *diagnostics = &std::cerr;  // [WARNING] / [ERROR] de la fonction
 
     int error = 0;
     int warning = 0;
@@ -45,28 +45,24 @@ public:
 
     SymbolTableVisitor();
 
-    virtual antlrcpp::Any visitDecl(ifccParser::DeclContext *ctx) override;
+    static FunctionSignature signatureOf(const AST &ast, NodeId function);
 
-    virtual antlrcpp::Any visitAssign(ifccParser::AssignContext *ctx) override;
-    virtual antlrcpp::Any visitPlusAssign(ifccParser::PlusAssignContext *ctx) override;
-    virtual antlrcpp::Any visitMinusAssign(ifccParser::MinusAssignContext *ctx) override;
-    virtual antlrcpp::Any visitMulAssign(ifccParser::MulAssignContext *ctx) override;
-    virtual antlrcpp::Any visitDivAssign(ifccParser::DivAssignContext *ctx) override;
+    int addToSymbolTable(const std::string &s);
+    int getVReg(const std::string &s) const;
 
-    
-    virtual antlrcpp::Any visitIdExpr(ifccParser::IdExprContext *ctx) override;
-    virtual antlrcpp::Any visitReturn_stmt(ifccParser::Return_stmtContext *ctx) override;
-    virtual antlrcpp::Any visitProg(ifccParser::ProgContext *ctx) override;
-    virtual antlrcpp::Any visitBlock(ifccParser::BlockContext *ctx) override;
-
-    std::string addToSymbolTable(const std::string &s);
-    std::string getUniqueName(const std::string &s) const;
+    // Vérifications faites par IRGenVisitor pendant la génération de l'IR ;
+    // renvoient le registre virtuel
+    int declareVariable(const std::string &s, bool initialised);
+    int useVariable(const std::string &s);     // lecture : définie et initialisée
+    int assignVariable(const std::string &s);  // écriture : définie
     int getScopeLevel(Scope* scope) const;
-    std::string createNewTemp();
+    int createNewTemp();
+    int allocateSlot();
     void checkSymbolTable();
 
     void writeWarning(const std::string &message);
     void writeError(const std::string &message);
+    [[noreturn]] void fatalError(const std::string &message);
 
     void enterScope();
     void exitScope();
@@ -79,6 +75,4 @@ public:
 private:
     // Table pour conserver les symboles des scopes quittés
     std::unordered_map<std::string, SymbolTableStruct> aggregatedSymbols;
-
-    antlrcpp::Any checkAssign(const std::string &varName, ifccParser::ExprContext *exprCtx);
 };
\ No newline at end of file
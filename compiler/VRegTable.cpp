@@ -0,0 +1,37 @@
+#include "VRegTable.h"
+
+int VRegTable::addVariable(const std::string &name, int level)
+{
+    regs.push_back(Entry{level, 0, false, (int)variableNames.size()});
+    variableNames.push_back(name);
+    return (int)regs.size() - 1;
+}
+
+int VRegTable::addTemp()
+{
+    regs.push_back(Entry{0, 0, false, 0});
+    return (int)regs.size() - 1;
+}
+
+int VRegTable::addImmediate(int value)
+{
+    auto it = immediates.find(value);
+    if (it != immediates.end())
+        return it->second;
+    int id = (int)regs.size();
+    regs.push_back(Entry{0, 0, true, value});
+    immediates[value] = id;
+    return id;
+}
+
+std::string VRegTable::name(int id) const
+{
+    if (id == NONE)
+        return "";
+    const Entry &entry = regs[id];
+    if (entry.immediate)
+        return "$" + std::to_string(entry.value);
+    if (entry.level == 0)
+        return "!tmp" + std::to_string(id);
+    return "s" + std::to_string(entry.level) + "_" + variableNames[entry.value];
+}
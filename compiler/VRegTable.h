@@ -0,0 +1,57 @@
+#ifndef VREGTABLE_H
+#define VREGTABLE_H
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/*---------------------------------------------------
+ * VRegTable : table des registres virtuels d'une fonction
+ *
+ * Chaque opérande de l'IR (variable utilisateur ou temporaire)
+ * est désigné par un identifiant entier, indice dans cette table.
+ * Créer un registre virtuel ne fabrique aucune chaîne : le CFG
+ * le transmet aux backends comme un Operand (case de pile repérée
+ * par son offset), et son nom ("s2_a", "!tmp42") n'est construit
+ * que pour les traces et les affichages de débogage.
+ *
+ * Un registre virtuel naît sans case de pile : CFG::gen_asm n'en
+ * donne qu'à ceux que l'allocateur laisse en mémoire (tous à -O0).
+ * Les temporaires créés par les passes (renommage SSA, copies de
+ * la sortie de SSA) ne grossissent donc pas la pile.
+ *
+ * Un opérande peut aussi être un immédiat : il n'est jamais écrit,
+ * n'a ni case de pile ni registre physique, et arrive aux backends
+ * comme un Operand::Immediate portant sa valeur. Une entrée par valeur.
+ *---------------------------------------------------*/
+class VRegTable {
+public:
+    static constexpr int NONE = -1;   // absence d'opérande
+
+    // Variable utilisateur 'name' déclarée au niveau de scope 'level'
+    int addVariable(const std::string &name, int level);
+    int addTemp();
+    int addImmediate(int value);
+
+    bool hasSlot(int id) const { return regs[id].offset != 0; }
+    int offset(int id) const { return regs[id].offset; }
+    void setOffset(int id, int offset) { regs[id].offset = offset; }
+    bool isTemp(int id) const { return regs[id].level == 0 && !regs[id].immediate; }
+    bool isImmediate(int id) const { return regs[id].immediate; }
+    int immediateValue(int id) const { return regs[id].value; }
+    std::string name(int id) const;
+    int size() const { return (int)regs.size(); }
+
+private:
+    struct Entry {
+        int level;              // niveau du scope de déclaration, 0 pour un temporaire
+        int offset;             // emplacement dans la pile, relatif au frame pointer ; 0 si aucun
+        bool immediate;
+        int value;              // valeur d'un immédiat, indice dans variableNames d'une variable
+    };
+    std::vector<Entry> regs;
+    std::vector<std::string> variableNames;     // nom source des variables utilisateur
+    std::unordered_map<int, int> immediates;    // valeur -> identifiant
+};
+
+#endif
@@ -0,0 +1,409 @@
+#include "X86Assembler.h"
+
+#include <charconv>
+
+#include "CompileError.h"
+
+namespace {
+
+struct RegisterName {
+    const char *name;
+    int number;
+    int size;
+};
+
+const RegisterName REGISTERS[] = {
+    {"eax", 0, 4}, {"ecx", 1, 4}, {"edx", 2, 4}, {"ebx", 3, 4},
+    {"esp", 4, 4}, {"ebp", 5, 4}, {"esi", 6, 4}, {"edi", 7, 4},
+    {"r8d", 8, 4}, {"r9d", 9, 4}, {"r10d", 10, 4}, {"r11d", 11, 4},
+    {"r12d", 12, 4}, {"r13d", 13, 4}, {"r14d", 14, 4}, {"r15d", 15, 4},
+    {"rax", 0, 8}, {"rcx", 1, 8}, {"rdx", 2, 8}, {"rbx", 3, 8},
+    {"rsp", 4, 8}, {"rbp", 5, 8}, {"rsi", 6, 8}, {"rdi", 7, 8},
+    {"r8", 8, 8}, {"r9", 9, 8}, {"r10", 10, 8}, {"r11", 11, 8},
+    {"r12", 12, 8}, {"r13", 13, 8}, {"r14", 14, 8}, {"r15", 15, 8},
+    {"al", 0, 1}, {"cl", 1, 1}, {"dl", 2, 1}, {"bl", 3, 1},
+};
+
+// Codes de condition de jcc / setcc
+struct ConditionName {
+    const char *name;
+    uint8_t code;
+};
+
+const ConditionName CONDITIONS[] = {
+    {"e", 0x4}, {"z", 0x4}, {"ne", 0x5}, {"nz", 0x5},
+    {"b", 0x2}, {"ae", 0x3}, {"be", 0x6}, {"a", 0x7},
+    {"s", 0x8}, {"ns", 0x9},
+    {"l", 0xC}, {"ge", 0xD}, {"le", 0xE}, {"g", 0xF},
+};
+
+// Opérations arithmétiques à deux opérandes : extension de l'opcode 81/83 /ext
+struct AluName {
+    const char *name;
+    int ext;
+};
+
+const AluName ALU[] = {
+    {"add", 0}, {"or", 1}, {"and", 4}, {"sub", 5}, {"xor", 6}, {"cmp", 7},
+};
+
+std::string_view trim(std::string_view s)
+{
+    size_t first = s.find_first_not_of(" \t\r");
+    if (first == std::string_view::npos)
+        return {};
+    size_t last = s.find_last_not_of(" \t\r");
+    return s.substr(first, last - first + 1);
+}
+
+bool fitsInt8(int64_t v) { return v >= -128 && v <= 127; }
+
+int condition(std::string_view cc)
+{
+    for (const ConditionName &c : CONDITIONS)
+        if (cc == c.name)
+            return c.code;
+    return -1;
+}
+
+} // namespace
+
+uint32_t X86Assembler::symbolId(std::string_view name)
+{
+    std::string key(name);
+    auto it = symbolIds.find(key);
+    if (it != symbolIds.end())
+        return it->second;
+    uint32_t id = symbolList.size();
+    Symbol symbol;
+    symbol.name = key;
+    symbolList.push_back(symbol);
+    symbolIds.emplace(std::move(key), id);
+    return id;
+}
+
+void X86Assembler::unsupported(std::string_view what)
+{
+    throw CompileError("X86Assembler: unsupported " + std::string(what) + " at line " + std::to_string(lineNumber));
+}
+
+void X86Assembler::assemble(const std::string &source)
+{
+    std::string_view rest(source);
+    while (!rest.empty())
+    {
+        size_t eol = rest.find('\n');
+        std::string_view line = trim(rest.substr(0, eol));
+        rest = eol == std::string_view::npos ? std::string_view() : rest.substr(eol + 1);
+        lineNumber++;
+
+        if (line.empty() || line[0] == '#')
+            continue;
+        if (line.back() == ':')
+        {
+            defineLabel(line.substr(0, line.size() - 1));
+            continue;
+        }
+
+        size_t space = line.find_first_of(" \t");
+        std::string_view head = line.substr(0, space);
+        std::string_view operands = space == std::string_view::npos ? std::string_view() : trim(line.substr(space));
+        if (head == ".globl" || head == ".global")
+            symbolList[symbolId(operands)].global = true;
+        else if (head == ".extern" || head == ".text")
+            continue;   // les symboles non définis sont créés au premier call
+        else if (head[0] == '.')
+            unsupported("directive '" + std::string(head) + "'");
+        else
+            instruction(head, operands);
+    }
+
+    // Sauts vers des labels définis plus loin
+    for (const Fixup &fixup : fixups)
+    {
+        auto it = labels.find(fixup.label);
+        if (it == labels.end())
+        {
+            lineNumber = fixup.line;
+            unsupported("jump to unknown label '" + fixup.label + "'");
+        }
+        int64_t rel = (int64_t)it->second - (int64_t)(fixup.offset + 4);
+        for (int i = 0; i < 4; i++)
+            text[fixup.offset + i] = (uint8_t)(rel >> (8 * i));
+    }
+    fixups.clear();
+}
+
+void X86Assembler::defineLabel(std::string_view name)
+{
+    std::string key(name);
+    if (!labels.emplace(key, text.size()).second)
+        unsupported("duplicate label '" + key + "'");
+    // Les labels .L* restent locaux au fichier et n'entrent pas dans la table des symboles
+    if (key.compare(0, 2, ".L") == 0)
+        return;
+    Symbol &symbol = symbolList[symbolId(key)];
+    symbol.offset = text.size();
+    symbol.defined = true;
+}
+
+X86Assembler::Operand X86Assembler::operand(std::string_view s)
+{
+    Operand op;
+    if (s.empty())
+        unsupported("empty operand");
+    if (s[0] == '$')
+    {
+        op.kind = OperandKind::Immediate;
+        auto res = std::from_chars(s.data() + 1, s.data() + s.size(), op.value);
+        if (res.ec != std::errc() || res.ptr != s.data() + s.size())
+            unsupported("immediate '" + std::string(s) + "'");
+        return op;
+    }
+    if (s[0] == '%')
+    {
+        op.kind = OperandKind::Register;
+        for (const RegisterName &r : REGISTERS)
+        {
+            if (s.substr(1) == r.name)
+            {
+                op.reg = r.number;
+                op.size = r.size;
+                return op;
+            }
+        }
+        unsupported("register '" + std::string(s) + "'");
+    }
+    size_t paren = s.find('(');
+    if (paren != std::string_view::npos)
+    {
+        // disp(%base), sans index
+        op.kind = OperandKind::Memory;
+        if (paren > 0)
+        {
+            auto res = std::from_chars(s.data(), s.data() + paren, op.value);
+            if (res.ec != std::errc() || res.ptr != s.data() + paren)
+                unsupported("displacement '" + std::string(s) + "'");
+        }
+        if (s.back() != ')')
+            unsupported("memory operand '" + std::string(s) + "'");
+        Operand base = operand(s.substr(paren + 1, s.size() - paren - 2));
+        if (base.kind != OperandKind::Register || base.size != 8)
+            unsupported("memory operand '" + std::string(s) + "'");
+        op.reg = base.reg;
+        return op;
+    }
+    op.kind = OperandKind::Symbol;
+    op.name = s;
+    return op;
+}
+
+void X86Assembler::imm32(int64_t v)
+{
+    if (v < INT32_MIN || v > UINT32_MAX)
+        unsupported("32-bit immediate " + std::to_string(v));
+    for (int i = 0; i < 4; i++)
+        byte((uint8_t)(v >> (8 * i)));
+}
+
+// Préfixe REX : W pour les opérations 64 bits, R et B pour les registres r8-r15
+void X86Assembler::rex(bool wide, int reg, const Operand &rm)
+{
+    uint8_t prefix = 0x40;
+    if (wide)
+        prefix |= 0x08;
+    if (reg >= 8)
+        prefix |= 0x04;
+    if (rm.reg >= 8)
+        prefix |= 0x01;
+    if (prefix != 0x40)
+        byte(prefix);
+}
+
+void X86Assembler::modrm(int reg, const Operand &rm)
+{
+    if (rm.kind == OperandKind::Register)
+    {
+        byte(0xC0 | (reg & 7) << 3 | (rm.reg & 7));
+        return;
+    }
+    // [base + disp] : %rbp et %r13 n'ont pas de forme sans déplacement,
+    // %rsp et %r12 demandent un octet SIB
+    int base = rm.reg & 7;
+    int mod = (rm.value == 0 && base != 5) ? 0 : fitsInt8(rm.value) ? 1 : 2;
+    byte(mod << 6 | (reg & 7) << 3 | base);
+    if (base == 4)
+        byte(0x24);
+    if (mod == 1)
+        byte((uint8_t)rm.value);
+    else if (mod == 2)
+        imm32(rm.value);
+}
+
+void X86Assembler::encode(bool wide, std::initializer_list<uint8_t> opcode, int reg, const Operand &rm)
+{
+    if (rm.kind != OperandKind::Register && rm.kind != OperandKind::Memory)
+        unsupported("operand");
+    rex(wide, reg, rm);
+    for (uint8_t b : opcode)
+        byte(b);
+    modrm(reg, rm);
+}
+
+void X86Assembler::branch(std::initializer_list<uint8_t> opcode, std::string_view label)
+{
+    for (uint8_t b : opcode)
+        byte(b);
+    fixups.push_back({text.size(), std::string(label), lineNumber});
+    imm32(0);
+}
+
+void X86Assembler::instruction(std::string_view mnemonic, std::string_view operands)
+{
+    std::vector<Operand> ops;
+    while (!operands.empty())
+    {
+        size_t comma = operands.find(',');
+        ops.push_back(operand(trim(operands.substr(0, comma))));
+        operands = comma == std::string_view::npos ? std::string_view() : operands.substr(comma + 1);
+    }
+
+    // Taille des registres imposée par le suffixe (l : 32 bits, q : 64 bits)
+    auto sized = [&](int size) {
+        for (const Operand &op : ops)
+            if (op.kind == OperandKind::Register && op.size != size)
+                unsupported("operand size for '" + std::string(mnemonic) + "'");
+    };
+    auto arity = [&](size_t n) {
+        if (ops.size() != n)
+            unsupported("operand count for '" + std::string(mnemonic) + "'");
+    };
+
+    if (mnemonic == "ret") { arity(0); byte(0xC3); return; }
+    if (mnemonic == "cltd") { arity(0); byte(0x99); return; }
+    if (mnemonic == "cqto") { arity(0); byte(0x48); byte(0x99); return; }
+
+    if (mnemonic == "call")
+    {
+        arity(1);
+        if (ops[0].kind != OperandKind::Symbol)
+            unsupported("indirect call");
+        byte(0xE8);
+        relocationList.push_back({text.size(), symbolId(ops[0].name), -4});
+        imm32(0);
+        return;
+    }
+    if (mnemonic == "jmp")
+    {
+        arity(1);
+        branch({0xE9}, ops[0].name);
+        return;
+    }
+    if (mnemonic[0] == 'j' && condition(mnemonic.substr(1)) >= 0)
+    {
+        arity(1);
+        branch({0x0F, (uint8_t)(0x80 + condition(mnemonic.substr(1)))}, ops[0].name);
+        return;
+    }
+    if (mnemonic.substr(0, 3) == "set" && condition(mnemonic.substr(3)) >= 0)
+    {
+        arity(1);
+        sized(1);
+        encode(false, {0x0F, (uint8_t)(0x90 + condition(mnemonic.substr(3)))}, 0, ops[0]);
+        return;
+    }
+    if (mnemonic == "movzbl")
+    {
+        arity(2);
+        if (ops[1].kind != OperandKind::Register || ops[1].size != 4
+            || (ops[0].kind == OperandKind::Register && ops[0].size != 1))
+            unsupported("operands for 'movzbl'");
+        encode(false, {0x0F, 0xB6}, ops[1].reg, ops[0]);
+        return;
+    }
+    if (mnemonic == "pushq" || mnemonic == "popq")
+    {
+        arity(1);
+        sized(8);
+        if (ops[0].kind != OperandKind::Register)
+            unsupported("operand for '" + std::string(mnemonic) + "'");
+        if (ops[0].reg >= 8)
+            byte(0x41);
+        byte((mnemonic == "pushq" ? 0x50 : 0x58) + (ops[0].reg & 7));
+        return;
+    }
+
+    char suffix = mnemonic.back();
+    if (suffix != 'l' && suffix != 'q')
+        unsupported("instruction '" + std::string(mnemonic) + "'");
+    bool wide = suffix == 'q';
+    std::string_view base = mnemonic.substr(0, mnemonic.size() - 1);
+    sized(wide ? 8 : 4);
+
+    if (base == "mov")
+    {
+        arity(2);
+        const Operand &src = ops[0], &dst = ops[1];
+        if (src.kind == OperandKind::Immediate)
+        {
+            encode(wide, {0xC7}, 0, dst);
+            imm32(src.value);
+        }
+        else if (src.kind == OperandKind::Register)
+            encode(wide, {0x89}, src.reg, dst);
+        else if (dst.kind == OperandKind::Register)
+            encode(wide, {0x8B}, dst.reg, src);
+        else
+            unsupported("memory to memory 'mov'");
+        return;
+    }
+    for (const AluName &alu : ALU)
+    {
+        if (base != alu.name)
+            continue;
+        arity(2);
+        const Operand &src = ops[0], &dst = ops[1];
+        if (src.kind == OperandKind::Immediate)
+        {
+            encode(wide, {(uint8_t)(fitsInt8(src.value) ? 0x83 : 0x81)}, alu.ext, dst);
+            if (fitsInt8(src.value))
+                byte((uint8_t)src.value);
+            else
+                imm32(src.value);
+        }
+        else if (src.kind == OperandKind::Register)
+            encode(wide, {(uint8_t)(alu.ext * 8 + 1)}, src.reg, dst);
+        else if (dst.kind == OperandKind::Register)
+            encode(wide, {(uint8_t)(alu.ext * 8 + 3)}, dst.reg, src);
+        else
+            unsupported("memory to memory '" + std::string(mnemonic) + "'");
+        return;
+    }
+    if (base == "imul")
+    {
+        arity(2);
+        const Operand &src = ops[0], &dst = ops[1];
+        if (dst.kind != OperandKind::Register)
+            unsupported("destination for 'imul'");
+        if (src.kind == OperandKind::Immediate)
+        {
+            encode(wide, {(uint8_t)(fitsInt8(src.value) ? 0x6B : 0x69)}, dst.reg, dst);
+            if (fitsInt8(src.value))
+                byte((uint8_t)src.value);
+            else
+                imm32(src.value);
+        }
+        else
+            encode(wide, {0x0F, 0xAF}, dst.reg, src);
+        return;
+    }
+    // Opérations à un opérande du groupe F7 /ext
+    int ext = base == "not" ? 2 : base == "neg" ? 3 : base == "idiv" ? 7 : -1;
+    if (ext >= 0)
+    {
+        arity(1);
+        encode(wide, {0xF7}, ext, ops[0]);
+        return;
+    }
+    unsupported("instruction '" + std::string(mnemonic) + "'");
+}
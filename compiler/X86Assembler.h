@@ -0,0 +1,87 @@
+#ifndef X86ASSEMBLER_H
+#define X86ASSEMBLER_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/*---------------------------------------------------
+ * X86Assembler : encodage en code machine x86-64 de la sortie
+ * AT&T de X86Backend, sans passer par gas
+ *
+ * Ne reconnaît que les formes produites par le backend (mov, add,
+ * sub, imul, idiv, cmp, setcc, movzbl, push/pop, call, jmp/jcc...)
+ * avec des opérandes $imm, %reg ou disp(%reg) ; toute autre ligne
+ * lève une CompileError.
+ *
+ * Les sauts vers les labels du fichier sont résolus sur place
+ * (toujours en rel32). Chaque call produit une relocation
+ * R_X86_64_PLT32, comme avec gas, qu'elle vise une fonction du
+ * fichier ou putchar/getchar : ElfWriter les recopie dans le .o,
+ * le mode --run les résout en mémoire.
+ *---------------------------------------------------*/
+class X86Assembler {
+public:
+    struct Symbol {
+        std::string name;
+        uint64_t offset = 0;    // position dans .text si défini
+        bool defined = false;
+        bool global = false;    // .globl
+    };
+
+    struct Relocation {
+        uint64_t offset;        // position du champ rel32 dans .text
+        uint32_t symbol;        // indice dans symbols()
+        int64_t addend;
+    };
+
+    // Encode un fichier assembleur complet ; CompileError si une ligne n'est pas reconnue
+    void assemble(const std::string &text);
+
+    const std::vector<uint8_t> &code() const { return text; }
+    const std::vector<Symbol> &symbols() const { return symbolList; }
+    const std::vector<Relocation> &relocations() const { return relocationList; }
+
+private:
+    enum class OperandKind { Immediate, Register, Memory, Symbol };
+
+    struct Operand {
+        OperandKind kind;
+        int64_t value = 0;      // immédiat ou déplacement
+        int reg = 0;            // registre, ou base de l'adresse mémoire
+        int size = 0;           // taille du registre en octets
+        std::string_view name;  // label ou symbole
+    };
+
+    // Saut en attente de la position de son label (rel32 à corriger)
+    struct Fixup {
+        uint64_t offset;
+        std::string label;
+        int line;
+    };
+
+    std::vector<uint8_t> text;
+    std::vector<Symbol> symbolList;
+    std::vector<Relocation> relocationList;
+    std::unordered_map<std::string, uint32_t> symbolIds;
+    std::unordered_map<std::string, uint64_t> labels;   // labels locaux .L*
+    std::vector<Fixup> fixups;
+    int lineNumber = 0;
+
+    uint32_t symbolId(std::string_view name);
+    void defineLabel(std::string_view name);
+    void instruction(std::string_view mnemonic, std::string_view operands);
+    Operand operand(std::string_view s);
+    [[noreturn]] void unsupported(std::string_view what);
+
+    void byte(uint8_t b) { text.push_back(b); }
+    void imm32(int64_t v);
+    void rex(bool wide, int reg, const Operand &rm);
+    void modrm(int reg, const Operand &rm);
+    void encode(bool wide, std::initializer_list<uint8_t> opcode, int reg, const Operand &rm);
+    void branch(std::initializer_list<uint8_t> opcode, std::string_view label);
+};
+
+#endif
@@ -1,67 +1,93 @@
 #include "X86Backend.h"
+#include "Log.h"
 #include <iostream>
 #include <cctype>
 
-void X86Backend::gen_return(std::ostream &os, const std::string &src) const {
+// Opérande en syntaxe AT&T : "%ebx", "-8(%rbp)" ou "$5"
+static AsmWriter &operator<<(AsmWriter &os, const Operand &op) {
+    if (op.isRegister())
+        return os << op.reg;
+    if (op.isStack())
+        return os << op.value << "(%rbp)";
+    return os << '$' << op.value;
+}
+
+void X86Backend::gen_return(AsmWriter &os, const Operand &src) const {
     os << "    movl " << src << ", %eax\n";
 }
 
-void X86Backend::gen_mov(std::ostream &os, const std::string &dest, const std::string &src) const {
-    if (isdigit(src[0]) || (src[0] == '-' && isdigit(src[1]))) {
-        os << "    movl $" << src << ", " << dest << "\n";
+void X86Backend::gen_mov(AsmWriter &os, const Operand &dest, const Operand &src) const {
+    if (src.isImmediate()) {
+        os << "    movl " << src << ", " << dest << "\n";
     } else {
         os << "    movl " << src << ", %eax\n";
         os << "    movl %eax, " << dest << "\n";
     }
 }
 
-void X86Backend::gen_add(std::ostream &os, const std::string &dest,
-                         const std::string &src1, const std::string &src2) const {
+void X86Backend::gen_add(AsmWriter &os, const Operand &dest,
+                         const Operand &src1, const Operand &src2) const {
     os << "    movl " << src1 << ", %eax\n";
     os << "    addl " << src2 << ", %eax\n";
     os << "    movl %eax, " << dest << "\n";
 }
 
-void X86Backend::gen_sub(std::ostream &os, const std::string &dest,
-                         const std::string &src1, const std::string &src2) const {
+void X86Backend::gen_sub(AsmWriter &os, const Operand &dest,
+                         const Operand &src1, const Operand &src2) const {
     os << "    movl " << src1 << ", %eax\n";
     os << "    subl " << src2 << ", %eax\n";
     os << "    movl %eax, " << dest << "\n";
 }
 
-void X86Backend::gen_mul(std::ostream &os, const std::string &dest,
-                         const std::string &src1, const std::string &src2) const {
+void X86Backend::gen_mul(AsmWriter &os, const Operand &dest,
+                         const Operand &src1, const Operand &src2) const {
     os << "    movl " << src1 << ", %eax\n";
     os << "    imull " << src2 << ", %eax\n";
     os << "    movl %eax, " << dest << "\n";
 }
 
-void X86Backend::gen_div(std::ostream &os, const std::string &dest,
-                         const std::string &src1, const std::string &src2) const {
+// idivl n'a pas de forme immédiate : le diviseur passe par %ecx, qui ne
+// porte un argument que pendant la séquence d'appel d'IRCall
+static Operand divisor(AsmWriter &os, const Operand &src) {
+    if (!src.isImmediate())
+        return src;
+    os << "    movl " << src << ", %ecx\n";
+    return Operand::registerOf("%ecx");
+}
+
+void X86Backend::gen_div(AsmWriter &os, const Operand &dest,
+                         const Operand &src1, const Operand &src2) const {
+    Operand d = divisor(os, src2);
     os << "    movl " << src1 << ", %eax\n";
     os << "    cltd\n";
-    os << "    idivl " << src2 << "\n";
+    os << "    idivl " << d << "\n";
     os << "    movl %eax, " << dest << "\n";
 }
 
-void X86Backend::gen_mod(std::ostream &os, const std::string &dest,
-                         const std::string &src1, const std::string &src2) const {
+void X86Backend::gen_mod(AsmWriter &os, const Operand &dest,
+                         const Operand &src1, const Operand &src2) const {
+    Operand d = divisor(os, src2);
     os << "    movl " << src1 << ", %eax\n";
     os << "    cltd\n";
-    os << "    idivl " << src2 << "\n";
+    os << "    idivl " << d << "\n";
     os << "    movl %edx, " << dest << "\n";
 }
 
-void X86Backend::gen_not(std::ostream &os, const std::string &dest,
-                         const std::string &src) const {
-    os << "    cmpl $0, " << src << "\n";
+void X86Backend::gen_not(AsmWriter &os, const Operand &dest,
+                         const Operand &src) const {
+    if (src.isImmediate()) {
+        os << "    movl " << src << ", %eax\n";
+        os << "    cmpl $0, %eax\n";
+    } else {
+        os << "    cmpl $0, " << src << "\n";
+    }
     os << "    sete %al\n";
     os << "    movzbl %al, %eax\n";
     os << "    movl %eax, " << dest << "\n";
 }
 
-void X86Backend::gen_egal(std::ostream &os, const std::string &dest,
-                          const std::string &src1, const std::string &src2) const {
+void X86Backend::gen_egal(AsmWriter &os, const Operand &dest,
+                          const Operand &src1, const Operand &src2) const {
     os << "    movl " << src1 << ", %eax\n";
     os << "    cmpl " << src2 << ", %eax\n";
     os << "    sete %al\n";
@@ -69,8 +95,8 @@ void X86Backend::gen_egal(std::ostream &os, const std::string &dest,
     os << "    movl %eax, " << dest << "\n";
 }
 
-void X86Backend::gen_notegal(std::ostream &os, const std::string &dest,
-                             const std::string &src1, const std::string &src2) const {
+void X86Backend::gen_notegal(AsmWriter &os, const Operand &dest,
+                             const Operand &src1, const Operand &src2) const {
     os << "    movl " << src1 << ", %eax\n";
     os << "    cmpl " << src2 << ", %eax\n";
     os << "    setne %al\n";
@@ -78,27 +104,27 @@ void X86Backend::gen_notegal(std::ostream &os, const std::string &dest,
     os << "    movl %eax, " << dest << "\n";
 }
 
-void X86Backend::gen_xor(std::ostream &os, const std::string &dest,
-                         const std::string &src1, const std::string &src2) const {
-    std::cerr << "[gen_xor] dest = " << dest << ", src1 = " << src1 << ", src2 = " << src2 << "\n";
+void X86Backend::gen_xor(AsmWriter &os, const Operand &dest,
+                         const Operand &src1, const Operand &src2) const {
+    LOG_TRACE("gen_xor: dest = " << dest << ", src1 = " << src1 << ", src2 = " << src2);
     os << "    movl " << src1 << ", %eax\n";
     os << "    xorl " << src2 << ", %eax\n";
     os << "    movl %eax, " << dest << "\n";
 }
 
-void X86Backend::gen_or(std::ostream &os, const std::string &dest,
-                        const std::string &src1, const std::string &src2) const {
-    std::cerr << "[gen_or] dest = " << dest << ", src1 = " << src1 << ", src2 = " << src2 << "\n";
+void X86Backend::gen_or(AsmWriter &os, const Operand &dest,
+                        const Operand &src1, const Operand &src2) const {
+    LOG_TRACE("gen_or: dest = " << dest << ", src1 = " << src1 << ", src2 = " << src2);
     os << "    movl " << src1 << ", %eax\n";
     os << "    orl " << src2 << ", %eax\n";
     os << "    movl %eax, " << dest << "\n";
 }
 
-void X86Backend::gen_call(std::ostream &os, const std::string &func) const {
+void X86Backend::gen_call(AsmWriter &os, const std::string &func) const {
     os << "    call " << func << "\n";
 }
 
-void X86Backend::gen_prologue(std::ostream &os, std::string &name, int stackSize) const {
+void X86Backend::gen_prologue(AsmWriter &os, std::string &name, int stackSize) const {
     os << ".globl " << name << "\n";
     os << name << ":\n";
     os << "    pushq %rbp\n";
@@ -108,15 +134,17 @@ void X86Backend::gen_prologue(std::ostream &os, std::string &name, int stackSize
     }
 }
 
-void X86Backend::gen_epilogue(std::ostream &os) const {
+void X86Backend::gen_epilogue(AsmWriter &os) const {
     os << "    movq %rbp, %rsp\n";  // Restore %rsp
     os << "    popq %rbp\n";
     os << "    ret\n";
 }
 
-void X86Backend::gen_copy(std::ostream &os, const std::string &dest, const std::string &src) const {
-    bool srcIsReg = src[0] == '%';
-    bool destIsReg = dest[0] == '%';
+void X86Backend::gen_copy(AsmWriter &os, const Operand &dest, const Operand &src) const {
+    if (src == dest)
+        return;
+    bool srcIsReg = !src.isStack();  // movl $5 accepte aussi une destination mémoire
+    bool destIsReg = dest.isRegister();
 
     if (srcIsReg && destIsReg)
     {
@@ -137,16 +165,41 @@ void X86Backend::gen_copy(std::ostream &os, const std::string &dest, const std::
     }
 }
 
-void X86Backend::gen_and(std::ostream &os,
-    const std::string &dest,
-    const std::string &src1,
-    const std::string &src2) const {
+void X86Backend::gen_and(AsmWriter &os,
+    const Operand &dest,
+    const Operand &src1,
+    const Operand &src2) const {
     os << "    movl " << src1 << ", %eax\n";
     os << "    andl " << src2 << ", %eax\n";
     os << "    movl %eax, " << dest << "\n";
 }
 
 
+// "%ebx" -> "%rbx", "%r12d" -> "%r12" : la sauvegarde porte sur le registre 64 bits complet
+static std::string reg64(const std::string &reg) {
+    if (reg.size() > 2 && reg[1] == 'r')
+        return reg.substr(0, reg.size() - 1);
+    return "%r" + reg.substr(2);
+}
+
+void X86Backend::gen_save_reg(AsmWriter &os, const std::string &reg, int offset) const {
+    os << "    movq " << reg64(reg) << ", " << offset << "(%rbp)\n";
+}
+
+void X86Backend::gen_restore_reg(AsmWriter &os, const std::string &reg, int offset) const {
+    os << "    movq " << offset << "(%rbp), " << reg64(reg) << "\n";
+}
+
+// Les registres d'arguments (%edi, %esi, %edx, %ecx, %r8d, %r9d) et %eax/%edx,
+// utilisés comme registres de travail, ne sont jamais alloués.
+std::vector<std::string> X86Backend::getCalleeSavedRegisters() const {
+    return {"%ebx", "%r12d", "%r13d", "%r14d", "%r15d"};
+}
+
+std::vector<std::string> X86Backend::getCallerSavedRegisters() const {
+    return {"%r10d", "%r11d"};
+}
+
 std::string X86Backend::getTempPrefix() const {
     return "!tmp";
 }
@@ -155,8 +208,8 @@ std::string X86Backend::getArchitecture() const {
     return "X86";
 }
 
-void X86Backend::gen_comp(std::ostream &os, const std::string &dest,
-    const std::string &src1, const std::string &src2,
+void X86Backend::gen_comp(AsmWriter &os, const Operand &dest,
+    const Operand &src1, const Operand &src2,
     const std::string &op) const {
     // Charger src1 dans %eax pour éviter de comparer deux adresses mémoire.
     os << "    movl " << src1 << ", %eax\n";
@@ -177,6 +230,17 @@ void X86Backend::gen_comp(std::ostream &os, const std::string &dest,
         os << "    movl %eax, " << dest << "\n";
 }
 
-void X86Backend::gen_branch(std::ostream &os, const std::string &cond, const std::string &label_then, const std::string &label_else) const {
+void X86Backend::gen_branch(AsmWriter &os, const Operand &cond, const std::string &label_then, const std::string &label_else) const {
     std::cerr << "[X86Backend] gen_branch not implemented\n";
 }
+
+void X86Backend::gen_jump(AsmWriter &os, const std::string &target) const {
+    os << "    jmp " << target << "\n";
+}
+
+void X86Backend::gen_jump_cond(AsmWriter &os, const Operand &cond, const std::string &labelTrue, const std::string &labelFalse) const {
+    os << "    movl " << cond << ", %eax\n";
+    os << "    cmpl $0, %eax\n";
+    os << "    jne " << labelTrue << "\n";
+    os << "    jmp " << labelFalse << "\n";
+}
@@ -2,7 +2,7 @@
 #ifndef X86BACKEND_H
 #define X86BACKEND_H
 
-#include <ostream>
+#include "AsmWriter.h"
 #include <string>
 #include <vector>
 #include "CodeGenBackend.h"
@@ -13,25 +13,31 @@ class X86Backend  : public CodeGenBackend  {
 public:
 
     virtual ~X86Backend(){}
-    virtual void gen_return(std::ostream &os, const std::string &src) const override;
-    virtual void gen_mov(std::ostream &os, const std::string &dest, const std::string &src) const override;
-    virtual void gen_copy(std::ostream &os, const std::string &dest, const std::string &src) const override;
-    virtual void gen_add(std::ostream &os, const std::string &dest, const std::string &src1, const std::string &src2) const override;
-    virtual void gen_sub(std::ostream &os, const std::string &dest, const std::string &src1, const std::string &src2) const override;
-    virtual void gen_mul(std::ostream &os, const std::string &dest, const std::string &src1, const std::string &src2) const override;
-    virtual void gen_div(std::ostream &os, const std::string &dest, const std::string &src1, const std::string &src2) const override;
-    virtual void gen_mod(std::ostream &os, const std::string &dest, const std::string &src1, const std::string &src2) const override;
-    virtual void gen_call(std::ostream &os, const std::string &func) const override;
-    virtual void gen_or(std::ostream &os, const std::string &dest, const std::string &src1, const std::string &src2) const override;
-    virtual void gen_xor(std::ostream &os, const std::string &dest, const std::string &src1, const std::string &src2) const override;
-    virtual void gen_not(std::ostream &os, const std::string &dest, const std::string &src) const override;
-    virtual void gen_egal(std::ostream &os, const std::string &dest, const std::string &src1, const std::string &src2) const override;
-    virtual void gen_notegal(std::ostream &os, const std::string &dest, const std::string &src1, const std::string &src2) const override;
-    virtual void gen_prologue(std::ostream &os, std::string &name, int stackSize) const override;
-    virtual void gen_epilogue(std::ostream &os) const override;
-    virtual void gen_and(std::ostream &os, const std::string &dest, const std::string &src1, const std::string &src2) const override;
-    virtual void gen_branch(std::ostream &os, const std::string &cond, const std::string &label_then, const std::string &label_else) const;
-    virtual void gen_comp(std::ostream &os, const std::string &dest, const std::string &src1, const std::string &src2, const std::string &op) const override;
+    virtual void gen_return(AsmWriter &os, const Operand &src) const override;
+    virtual void gen_mov(AsmWriter &os, const Operand &dest, const Operand &src) const override;
+    virtual void gen_copy(AsmWriter &os, const Operand &dest, const Operand &src) const override;
+    virtual void gen_add(AsmWriter &os, const Operand &dest, const Operand &src1, const Operand &src2) const override;
+    virtual void gen_sub(AsmWriter &os, const Operand &dest, const Operand &src1, const Operand &src2) const override;
+    virtual void gen_mul(AsmWriter &os, const Operand &dest, const Operand &src1, const Operand &src2) const override;
+    virtual void gen_div(AsmWriter &os, const Operand &dest, const Operand &src1, const Operand &src2) const override;
+    virtual void gen_mod(AsmWriter &os, const Operand &dest, const Operand &src1, const Operand &src2) const override;
+    virtual void gen_call(AsmWriter &os, const std::string &func) const override;
+    virtual void gen_or(AsmWriter &os, const Operand &dest, const Operand &src1, const Operand &src2) const override;
+    virtual void gen_xor(AsmWriter &os, const Operand &dest, const Operand &src1, const Operand &src2) const override;
+    virtual void gen_not(AsmWriter &os, const Operand &dest, const Operand &src) const override;
+    virtual void gen_egal(AsmWriter &os, const Operand &dest, const Operand &src1, const Operand &src2) const override;
+    virtual void gen_notegal(AsmWriter &os, const Operand &dest, const Operand &src1, const Operand &src2) const override;
+    virtual void gen_prologue(AsmWriter &os, std::string &name, int stackSize) const override;
+    virtual void gen_epilogue(AsmWriter &os) const override;
+    virtual void gen_and(AsmWriter &os, const Operand &dest, const Operand &src1, const Operand &src2) const override;
+    virtual void gen_branch(AsmWriter &os, const Operand &cond, const std::string &label_then, const std::string &label_else) const;
+    virtual void gen_jump(AsmWriter &os, const std::string &target) const override;
+    virtual void gen_jump_cond(AsmWriter &os, const Operand &cond, const std::string &labelTrue, const std::string &labelFalse) const override;
+    virtual void gen_comp(AsmWriter &os, const Operand &dest, const Operand &src1, const Operand &src2, const std::string &op) const override;
+    virtual void gen_save_reg(AsmWriter &os, const std::string &reg, int offset) const override;
+    virtual void gen_restore_reg(AsmWriter &os, const std::string &reg, int offset) const override;
+    virtual std::vector<std::string> getCalleeSavedRegisters() const override;
+    virtual std::vector<std::string> getCallerSavedRegisters() const override;
     virtual std::string getTempPrefix() const override;
     virtual std::string getArchitecture() const override;
 };
@@ -0,0 +1,138 @@
+/*---------------------------------------------------
+ * AllocBench : benchmark des allocations du compilateur
+ *
+ * Génère un programme synthétique (nombreuses fonctions, blocs
+ * if/while imbriqués, variables locales) et le compile comme
+ * main.cpp deux fois : d'abord avec un operator new par scope,
+ * bloc et instruction (Arena::perObjectNew, comme avant l'arène),
+ * puis avec l'arène. Affiche côte à côte le nombre d'allocations
+ * sur le tas et le temps passé, puis le contenu des arènes.
+ *
+ * Usage : make bench  (ou ./ifcc-bench [nbFonctions] [nbInstrParFonction])
+ *---------------------------------------------------*/
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <sstream>
+
+#include "antlr4-runtime.h"
+#include "generated/ifccLexer.h"
+#include "generated/ifccParser.h"
+
+#include "AST.h"
+#include "SymbolTableVisitor.h"
+#include "IRGenVisitor.h"
+#include "BackendInitializr.h"
+#include "CompilationContext.h"
+#include "AsmWriter.h"
+
+using namespace antlr4;
+using namespace std;
+
+// Compteur global des appels à operator new
+static size_t heapAllocations = 0;
+
+void *operator new(size_t size)
+{
+    heapAllocations++;
+    if (void *p = malloc(size))
+        return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void *p) noexcept { free(p); }
+void operator delete(void *p, size_t) noexcept { free(p); }
+
+static string generateProgram(int nbFunctions, int nbInstrs)
+{
+    ostringstream src;
+    for (int f = 0; f < nbFunctions; f++)
+    {
+        src << "int f" << f << "(int a) {\n";
+        src << "    int s = a;\n";
+        for (int i = 0; i < nbInstrs; i++)
+        {
+            src << "    int v" << i << " = s * " << (i % 7 + 1) << " + a;\n";
+            if (i % 5 == 0)
+                src << "    if (v" << i << " > 3 && s < 100) { int t = v" << i << " - 1; s = s + t; } else { s = s - 1; }\n";
+            if (i % 11 == 0)
+                src << "    while (s > 1000) { s = s / 2; }\n";
+        }
+        src << "    return s;\n}\n";
+    }
+    src << "int main() {\n    return f0(1);\n}\n";
+    return src.str();
+}
+
+struct Run
+{
+    size_t heapAllocations = 0;
+    double ms = 0;
+    size_t arenaObjects = 0, arenaChunks = 0, arenaBytes = 0;
+};
+
+// On ne compte que la partie IR : analyse sémantique, génération et émission
+static Run compileFunctions(const AST &ast, CompilationContext &context, bool perObjectNew)
+{
+    Arena::perObjectNew = perObjectNew;
+    ostringstream asmSink;
+    AsmWriter asmOut(asmSink);
+    Run run;
+
+    size_t before = heapAllocations;
+    auto start = chrono::steady_clock::now();
+    for (NodeId function : ast.functions())
+    {
+        SymbolTableVisitor stv;
+        DefFonction defFunc(ast.name(function), {});
+        CFG cfg(&defFunc, stv, context.backend.get());
+        IRGenVisitor cgv;
+        cgv.cfg = &cfg;
+        cgv.functionTable = &context.functionTable;
+        cgv.visitFunction(ast, function);
+        cfg.gen_asm(asmOut);
+
+        run.arenaObjects += stv.arena.objectCount();
+        run.arenaChunks += stv.arena.chunkCount();
+        run.arenaBytes += stv.arena.bytesUsed();
+    }
+    run.ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    run.heapAllocations = heapAllocations - before;
+    Arena::perObjectNew = false;
+    return run;
+}
+
+int main(int argc, const char **argv)
+{
+    int nbFunctions = argc > 1 ? atoi(argv[1]) : 50;
+    int nbInstrs = argc > 2 ? atoi(argv[2]) : 200;
+
+    ANTLRInputStream input(generateProgram(nbFunctions, nbInstrs));
+    ifccLexer lexer(&input);
+    CommonTokenStream tokens(&lexer);
+    tokens.fill();
+    ifccParser parser(&tokens);
+    AST ast;
+    buildAST(parser.axiom(), ast);
+
+    CompilationContext context;
+    context.backend = createBackend("x86");
+    for (NodeId function : ast.functions())
+        context.functionTable[ast.name(function)] = SymbolTableVisitor::signatureOf(ast, function);
+    context.functionTable["putchar"] = FunctionSignature{"int", {"int"}};
+    context.functionTable["getchar"] = FunctionSignature{"int", {}};
+
+    Run separate = compileFunctions(ast, context, true);
+    Run arena = compileFunctions(ast, context, false);
+
+    cout << "functions          : " << nbFunctions << " x " << nbInstrs << " statements\n";
+    cout << "                     one new per object / arena\n";
+    cout << "heap allocations   : " << separate.heapAllocations << " / " << arena.heapAllocations
+         << " (-" << separate.heapAllocations - arena.heapAllocations << ")\n";
+    cout << "time               : " << separate.ms << " ms / " << arena.ms << " ms\n";
+    cout << "arena objects      : " << arena.arenaObjects << " (" << arena.arenaBytes << " bytes in "
+         << arena.arenaChunks << " chunks)\n";
+    cout << "AST                : " << ast.nodeCount() << " nodes (" << ast.bytesUsed() << " bytes)\n";
+    return 0;
+}
@@ -0,0 +1,114 @@
+/*---------------------------------------------------
+ * InputBench : lecture du source, copie contre mmap
+ *
+ * Génère un gros fichier C (100 Mo par défaut) puis le fait
+ * entièrement lexer, soit comme l'ancien main.cpp (ifstream ->
+ * stringstream -> string -> ANTLRInputStream, trois copies),
+ * soit à travers MappedCharStream (aucune copie). Chaque mode
+ * tourne dans son propre processus pour que le pic mémoire
+ * (ru_maxrss) soit mesuré séparément.
+ *
+ * Usage : make bench-input
+ *         ./ifcc-input-bench gen fichier.c [Mo]
+ *         ./ifcc-input-bench copy|mmap fichier.c
+ *---------------------------------------------------*/
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+#include <sys/resource.h>
+
+#include "antlr4-runtime.h"
+#include "generated/ifccLexer.h"
+
+#include "MappedCharStream.h"
+
+using namespace antlr4;
+using namespace std;
+
+// Fonctions synthétiques jusqu'à atteindre la taille demandée
+static int generate(const string &path, long megabytes)
+{
+    ofstream out(path);
+    if (!out.good())
+    {
+        cerr << "cannot write " << path << endl;
+        return 1;
+    }
+    long target = megabytes << 20;
+    long written = 0;
+    for (int f = 0; written < target; f++)
+    {
+        ostringstream fn;
+        fn << "/* fonction " << f << " */\n";
+        fn << "int f" << f << "(int a) {\n";
+        fn << "    int x = a * 3 + " << f % 97 << ";\n";
+        fn << "    while (x > 10) { x = x - (x / 4); }\n";
+        fn << "    if (x == 2) { x = x + 1; } else { x = x & 7; }\n";
+        fn << "    return x;\n";
+        fn << "}\n";
+        out << fn.str();
+        written += fn.str().size();
+    }
+    out << "int main() { return f0(5); }\n";
+    cerr << "generated " << path << " (" << (written >> 20) << " MB)" << endl;
+    return 0;
+}
+
+// Lexe tout le flux sans garder les tokens : seul le coût de l'entrée varie
+static size_t lexAll(CharStream &input)
+{
+    ifccLexer lexer(&input);
+    size_t tokens = 0;
+    while (lexer.nextToken()->getType() != Token::EOF)
+        tokens++;
+    return tokens;
+}
+
+int main(int argc, const char **argv)
+{
+    if (argc < 3)
+    {
+        cerr << "usage: ifcc-input-bench gen file.c [MB] | copy file.c | mmap file.c" << endl;
+        return 1;
+    }
+    string mode = argv[1];
+    string path = argv[2];
+    if (mode == "gen")
+        return generate(path, argc > 3 ? atol(argv[3]) : 100);
+
+    auto start = chrono::steady_clock::now();
+    size_t tokens = 0;
+    if (mode == "copy")
+    {
+        ifstream lecture(path);
+        stringstream in;
+        in << lecture.rdbuf();
+        ANTLRInputStream input(in.str());
+        tokens = lexAll(input);
+    }
+    else if (mode == "mmap")
+    {
+        MappedCharStream input;
+        if (!input.open(path))
+        {
+            cerr << "cannot map " << path << endl;
+            return 1;
+        }
+        tokens = lexAll(input);
+    }
+    else
+    {
+        cerr << "unknown mode: " << mode << endl;
+        return 1;
+    }
+    double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    cout << mode << ": " << tokens << " tokens, " << ms << " ms, peak RSS "
+         << usage.ru_maxrss / 1024 << " MB" << endl;
+    return 0;
+}
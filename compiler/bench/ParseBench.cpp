@@ -0,0 +1,161 @@
+/*---------------------------------------------------
+ * ParseBench : analyse LL seule contre SLL puis LL, et frontend fast
+ *
+ * Mesure le temps de construction de l'AST (parseToAST : analyse
+ * puis buildAST pour ANTLR, AST écrit directement par FastFrontend)
+ * avec les deux stratégies d'AntlrFrontend et avec FastFrontend
+ * (--frontend=fast) sur les fichiers donnés (le corpus de tests) puis
+ * sur des programmes générés aux expressions très longues, et affiche
+ * le nombre de reprises en LL. Les trois doivent accepter les mêmes
+ * fichiers.
+ *
+ * Usage : make bench-parse  (ou ./ifcc-parse-bench [fichiers.c...])
+ *
+ * Avec --check (make check-parse), rien n'est mesuré : pour chaque
+ * fichier, SLL puis LL doit accepter exactement ce qu'accepte LL seul,
+ * sans aucune reprise en LL sur un programme correct, et une erreur de
+ * syntaxe doit être signalée une seule fois, avec les mêmes messages
+ * qu'en LL seul. Le code de retour est non nul sinon.
+ *---------------------------------------------------*/
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "Driver.h"
+#include "FastFrontend.h"
+
+using namespace std;
+
+// Une fonction par ligne d'expressions ; chaque expression enchaîne tous les niveaux de priorité
+static string generate(int functions, int termsPerExpr)
+{
+    const char *ops[] = {"+", "-", "*", "/", "%", "<", ">", "<=", ">=", "==", "!=", "&", "^", "|"};
+    ostringstream out;
+    for (int f = 0; f < functions; f++)
+    {
+        out << "int f" << f << "(int a, int b) {\n    int x = ";
+        for (int t = 0; t < termsPerExpr; t++)
+        {
+            if (t > 0)
+                out << " " << ops[(t + f) % 14] << " ";
+            if (t % 7 == 3)
+                out << "(a - " << t << ")";
+            else
+                out << (t % 2 ? "a" : "b");
+        }
+        out << ";\n    return x;\n}\n";
+    }
+    out << "int main() { return f0(1, 2); }\n";
+    return out.str();
+}
+
+// Temps moyen d'un source -> AST, après une analyse de chauffe (cache DFA)
+static double timeParse(Frontend &frontend, const string &source, int repeat, bool &ok)
+{
+    AST ast;
+    ok = frontend.parseToAST(source, ast);
+    auto start = chrono::steady_clock::now();
+    for (int i = 0; i < repeat; i++)
+        frontend.parseToAST(source, ast);
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count() / repeat;
+}
+
+static void run(const string &name, const string &source, int repeat)
+{
+    AntlrFrontend ll(AntlrFrontend::LL_ONLY);
+    AntlrFrontend twoStage(AntlrFrontend::SLL_THEN_LL);
+    FastFrontend fast;
+    bool okLL, okTwoStage, okFast;
+    long fallbacksBefore = AntlrFrontend::llFallbacks();
+    double msLL = timeParse(ll, source, repeat, okLL);
+    double msTwoStage = timeParse(twoStage, source, repeat, okTwoStage);
+    long fallbacks = AntlrFrontend::llFallbacks() - fallbacksBefore;
+    double msFast = timeParse(fast, source, repeat, okFast);
+
+    cout << name << ": LL " << msLL << " ms, SLL+LL " << msTwoStage << " ms, fast " << msFast << " ms (x"
+         << msTwoStage / msFast << "), " << fallbacks << "/" << repeat + 1 << " fallback(s)";
+    if (okLL != okTwoStage || okFast != okTwoStage)
+        cout << " [DIFFERENT RESULT]";
+    cout << "\n";
+}
+
+static string readFile(const char *filename)
+{
+    ifstream lecture(filename);
+    stringstream in;
+    in << lecture.rdbuf();
+    return in.str();
+}
+
+// --check : une ligne par fichier en défaut ; renvoie le nombre de fichiers en défaut
+static int check(int argc, const char **argv)
+{
+    AntlrFrontend ll(AntlrFrontend::LL_ONLY);
+    AntlrFrontend twoStage(AntlrFrontend::SLL_THEN_LL);
+    int failures = 0;
+    for (int i = 2; i < argc; i++)
+    {
+        string source = readFile(argv[i]);
+        ostringstream messagesLL, messagesTwoStage;
+        ll.diagnostics = &messagesLL;
+        twoStage.diagnostics = &messagesTwoStage;
+        bool okLL = ll.parse(source) != nullptr;
+        long fallbacksBefore = AntlrFrontend::llFallbacks();
+        bool okTwoStage = twoStage.parse(source) != nullptr;
+        long fallbacks = AntlrFrontend::llFallbacks() - fallbacksBefore;
+
+        string problem;
+        if (okLL != okTwoStage)
+            problem = okLL ? "rejected by SLL+LL, accepted by LL" : "accepted by SLL+LL, rejected by LL";
+        else if (okLL && fallbacks != 0)
+            problem = "valid program parsed again in LL";
+        else if (!okLL && (messagesTwoStage.str().empty() || messagesTwoStage.str() != messagesLL.str()))
+            problem = "syntax error not reported exactly as in LL:\n" + messagesTwoStage.str();
+        if (!problem.empty())
+        {
+            cout << argv[i] << ": " << problem << "\n";
+            failures++;
+        }
+    }
+    cout << argc - 2 << " file(s), " << failures << " failed\n";
+    return failures;
+}
+
+int main(int argc, const char **argv)
+{
+    if (argc > 1 && string(argv[1]) == "--check")
+        return check(argc, argv) == 0 ? 0 : 1;
+
+    // Corpus : chaque fichier est analysé plusieurs fois, temps cumulés
+    double corpusLL = 0, corpusTwoStage = 0, corpusFast = 0;
+    long fallbacksBefore = AntlrFrontend::llFallbacks();
+    int files = 0, mismatches = 0;
+    {
+        AntlrFrontend ll(AntlrFrontend::LL_ONLY);
+        AntlrFrontend twoStage(AntlrFrontend::SLL_THEN_LL);
+        FastFrontend fast;
+        for (int i = 1; i < argc; i++)
+        {
+            string source = readFile(argv[i]);
+            bool okLL, okTwoStage, okFast;
+            corpusLL += timeParse(ll, source, 20, okLL);
+            corpusTwoStage += timeParse(twoStage, source, 20, okTwoStage);
+            corpusFast += timeParse(fast, source, 20, okFast);
+            if (okLL != okTwoStage || okFast != okTwoStage)
+                mismatches++;
+            files++;
+        }
+    }
+    if (files > 0)
+        cout << "corpus (" << files << " files): LL " << corpusLL << " ms, SLL+LL " << corpusTwoStage << " ms, fast " << corpusFast << " ms (x"
+             << corpusTwoStage / corpusFast << "), "
+             << AntlrFrontend::llFallbacks() - fallbacksBefore << " fallback(s), " << mismatches << " mismatch(es)\n";
+
+    run("generated 100 x 50 terms", generate(100, 50), 10);
+    run("generated 100 x 500 terms", generate(100, 500), 3);
+    run("generated 2000 x 200 terms", generate(2000, 200), 1);
+    return mismatches == 0 ? 0 : 1;
+}
@@ -37,14 +37,14 @@ type : 'int' | 'void' ;
 expr
     : '-' expr                           # MoinsExpr
     | '!' expr                           # NotExpr
-    | expr op=('*'|'/'|'%') expr         # MulDivExpr 
-    | expr op=('+'|'-') expr             # AddSubExpr
+    | expr op=(MUL|DIV|MOD) expr         # MulDivExpr 
+    | expr op=(PLUS|MINUS) expr          # AddSubExpr
     | '(' expr ')'                       # ParExpr
-    | expr op=('<'|'>'|'<='|'>=') expr     # CompExpr
-    | expr op=('=='|'!=') expr           # EgalExpr
-    | expr '&' expr                      # EtLogExpr
-    | expr '^' expr                      # OuExcExpr
-    | expr '|' expr                      # OuIncExpr
+    | expr op=(LT|GT|LE|GE) expr         # CompExpr
+    | expr op=(EQ|NE) expr               # EgalExpr
+    | expr BAND expr                     # EtLogExpr
+    | expr BXOR expr                     # OuExcExpr
+    | expr BOR expr                      # OuIncExpr
     | expr '&&' expr                     # EtParExpr
     | expr '||' expr                     # OuParExpr
     | function_call                      # FuncCallExpr 
@@ -56,6 +56,23 @@ expr
 function_call : ID '(' (expr (',' expr)*)? ')' ;
 
 RETURN : 'return' ;
+
+// Opérateurs nommés : l'IR est généré d'après le type du token (ifccParser::PLUS...)
+MUL : '*' ;
+DIV : '/' ;
+MOD : '%' ;
+PLUS : '+' ;
+MINUS : '-' ;
+LT : '<' ;
+GT : '>' ;
+LE : '<=' ;
+GE : '>=' ;
+EQ : '==' ;
+NE : '!=' ;
+BAND : '&' ;
+BXOR : '^' ;
+BOR : '|' ;
+
 CONST : [0-9]+ ;
 ID : [a-zA-Z_][a-zA-Z0-9_]* ;
 CHAR : '\'' [a-zA-Z] '\'' ;
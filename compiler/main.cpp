@@ -2,82 +2,303 @@
 #include <fstream>
 #include <sstream>
 #include <cstdlib>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <memory>
+#include <thread>
+#include <vector>
 
-#include "antlr4-runtime.h"
-#include "generated/ifccLexer.h"
-#include "generated/ifccParser.h"
-#include "generated/ifccBaseVisitor.h"
+#include "Driver.h"
+#include "AsmCache.h"
+#include "BackendInitializr.h"
+#include "CompileError.h"
+#include "Server.h"
+#include "Log.h"
+#include "MappedCharStream.h"
 
-#include "CodeGenVisitor.h"
-#include "SymbolTableVisitor.h"
-#include "IRGenVisitor.h"
-
-using namespace antlr4;
 using namespace std;
 
-int main(int argn, const char **argv)
+static bool readFile(const string &filename, string &content)
 {
+  ifstream lecture(filename);
+  if (!lecture.good())
+    return false;
   stringstream in;
-  if (argn == 2)
+  in << lecture.rdbuf();
+  content = in.str();
+  return true;
+}
+
+static double elapsedMs(chrono::steady_clock::time_point since)
+{
+  return chrono::duration<double, milli>(chrono::steady_clock::now() - since).count();
+}
+
+// Résultat de la compilation d'un fichier en mode batch
+struct FileResult {
+  bool ok = false;
+  double parseMs = 0;
+  double codegenMs = 0;
+};
+
+// Mode batch : ifcc a.c b.c ... -o outdir/
+// Les fichiers sont répartis entre les threads ; chaque thread garde son frontend,
+// les fonctions d'un fichier sont compilées en série.
+static int compileBatch(const vector<string> &files, const string &outdir, const CompileOptions &options)
+{
+  error_code ec;
+  filesystem::create_directories(outdir, ec);
+  if (ec)
   {
-    ifstream lecture(argv[1]);
-    if (!lecture.good())
+    cerr << "error: cannot create output directory: " << outdir << endl;
+    return 1;
+  }
+
+  CompileOptions perFile = options;
+  perFile.jobs = 1;
+
+  vector<FileResult> results(files.size());
+  atomic<size_t> next(0);
+  auto start = chrono::steady_clock::now();
+
+  auto worker = [&]() {
+    unique_ptr<Frontend> frontend = createFrontend(options.frontend);
+    for (size_t i = next++; i < files.size(); i = next++)
     {
-      cerr << "error: cannot read file: " << argv[1] << endl;
-      exit(1);
+      FileResult &res = results[i];
+      auto t0 = chrono::steady_clock::now();
+      MappedCharStream source;
+      if (!source.open(files[i]))
+      {
+        cerr << files[i] << ": error: cannot read file" << endl;
+        continue;
+      }
+      AST ast;
+      bool parsed = frontend->parseToAST(source, ast);
+      res.parseMs = elapsedMs(t0);
+      if (!parsed)
+      {
+        cerr << files[i] << ": error: syntax error during parsing" << endl;
+        continue;
+      }
+
+      auto t1 = chrono::steady_clock::now();
+      filesystem::path out = filesystem::path(outdir) / filesystem::path(files[i]).filename();
+      out.replace_extension(options.object ? ".o" : ".s");
+      ostringstream assembly;
+      try
+      {
+        if (options.object)
+          compileObject(ast, perFile, assembly);
+        else
+          compileProgram(ast, perFile, assembly);
+      }
+      catch (const CompileError &e)
+      {
+        cerr << files[i] << ": [ERROR] " << e.what() << endl;
+        res.codegenMs = elapsedMs(t1);
+        continue;
+      }
+      ofstream(out, ios::binary) << assembly.str();
+      res.codegenMs = elapsedMs(t1);
+      res.ok = true;
     }
-    in << lecture.rdbuf();
+  };
+
+  int nbThreads = min<int>(options.jobs, files.size());
+  vector<thread> workers;
+  for (int t = 1; t < nbThreads; t++)
+    workers.emplace_back(worker);
+  worker();
+  for (auto &w : workers)
+    w.join();
+
+  // Temps par fichier, dans l'ordre de la ligne de commande
+  int failures = 0;
+  for (size_t i = 0; i < files.size(); i++)
+  {
+    const FileResult &res = results[i];
+    if (!res.ok)
+      failures++;
+    cerr << files[i] << ": " << (res.ok ? "ok" : "FAILED") << ", parse " << res.parseMs
+         << " ms, codegen " << res.codegenMs << " ms\n";
   }
-  else
+  cerr << files.size() << " file(s), " << failures << " failed, " << elapsedMs(start) << " ms\n";
+  return failures == 0 ? 0 : 1;
+}
+
+int main(int argn, const char **argv)
+{
+  vector<string> files;
+  string outdir;
+  string serverSocket, clientSocket;
+  bool stats = false;
+  bool run = false;
+  bool interpret = false;
+  bool irCounts = false;
+  string cacheDir;
+  long cacheMaxMb = 64;
+  CompileOptions options;
+  int verbosity = 0;
+  bool badUsage = false;
+  for (int i = 1; i < argn; i++)
   {
-    cerr << "usage: ifcc path/to/file.c" << endl;
+    string arg = argv[i];
+    if (arg == "-O0" || arg == "-O1" || arg == "-O2")
+      options.optLevel = arg[2] - '0';
+    else if (arg == "-v" || arg == "-vv" || arg == "-vvv")
+      verbosity = arg.size() - 1;
+    else if (arg == "-j" && i + 1 < argn)
+      options.jobs = atoi(argv[++i]);
+    else if (arg.rfind("-j", 0) == 0 && arg.size() > 2)
+      options.jobs = atoi(arg.c_str() + 2);
+    else if (arg == "-c")
+      options.object = true;
+    else if (arg == "-o" && i + 1 < argn)
+      outdir = argv[++i];
+    else if (arg == "--server" && i + 1 < argn)
+      serverSocket = argv[++i];
+    else if (arg == "--client" && i + 1 < argn)
+      clientSocket = argv[++i];
+    else if (arg == "--stats")
+      stats = true;
+    else if (arg == "--run")
+      run = true;
+    else if (arg == "--interpret")
+      interpret = true;
+    else if (arg == "--ir-counts")
+      irCounts = true;
+    else if (arg == "--cache" && i + 1 < argn)
+      cacheDir = argv[++i];
+    else if (arg == "--cache-max" && i + 1 < argn)
+      cacheMaxMb = atol(argv[++i]);
+    else if (arg.rfind("--frontend=", 0) == 0)
+    {
+      options.frontend = arg.substr(11);
+      if (createFrontend(options.frontend) == nullptr)
+        badUsage = true;
+    }
+    else if (arg.rfind("--target=", 0) == 0)
+    {
+      options.target = arg.substr(9);
+      if (createBackend(options.target) == nullptr)
+        badUsage = true;
+    }
+    else if (arg[0] != '-')
+      files.push_back(arg);
+    else
+      badUsage = true;
+  }
+  if (!serverSocket.empty() || stats)
+  {
+    if (!files.empty() || (stats && clientSocket.empty()) || options.object)
+      badUsage = true;
+  }
+  else if (options.jobs < 1 || files.empty() || (files.size() > 1 && outdir.empty()))
+    badUsage = true;
+  else if (!clientSocket.empty() && (files.size() > 1 || options.object))
+    badUsage = true;
+  if ((run || interpret) && (files.size() != 1 || !outdir.empty() || !clientSocket.empty() || !serverSocket.empty() || options.object))
+    badUsage = true;
+  if ((run && interpret) || (irCounts && !interpret))
+    badUsage = true;
+  // X86Assembler n'encode que l'x86-64 ; un client compile pour la cible du serveur
+  if (options.target != "x86" && (options.object || run || !clientSocket.empty()))
+    badUsage = true;
+  if (badUsage)
+  {
+    cerr << "usage: ifcc [-O0|-O1|-O2] [-v|-vv|-vvv] [-j N] path/to/file.c" << endl;
+    cerr << "       ifcc [-O0|-O1|-O2] [-v|-vv|-vvv] [-j N] a.c b.c ... -o outdir/" << endl;
+    cerr << "       ifcc [-v|-vv|-vvv] --server path/to/socket" << endl;
+    cerr << "       ifcc [-O0|-O1|-O2] --client path/to/socket (path/to/file.c | --stats)" << endl;
+    cerr << "       cache: --cache dir/ [--cache-max MB]" << endl;
+    cerr << "       frontend: --frontend=antlr|fast (default antlr)" << endl;
+    cerr << "       target: --target=x86|arm64 (default x86; -c and --run need x86)" << endl;
+    cerr << "       object: -c (ELF x86-64 file.o, or outdir/*.o, instead of assembly)" << endl;
+    cerr << "       run: ifcc [-O0|-O1|-O2] --run path/to/file.c (exit status = main's result)" << endl;
+    cerr << "       interpret: ifcc --interpret [--ir-counts] path/to/file.c (IR executed directly, counts on stderr)" << endl;
     exit(1);
   }
+  Log::init(verbosity);
 
-  ANTLRInputStream input(in.str());
+  unique_ptr<AsmCache> cache;
+  if (!cacheDir.empty())
+  {
+    cache = make_unique<AsmCache>(cacheDir, (uint64_t)cacheMaxMb << 20);
+    options.cache = cache.get();
+  }
 
-  ifccLexer lexer(&input);
-  CommonTokenStream tokens(&lexer);
+  if (!serverSocket.empty())
+    return runServer(serverSocket, options);
+  if (stats)
+    return runStatsClient(clientSocket);
+  if (!outdir.empty())
+  {
+    int status = compileBatch(files, outdir, options);
+    LOG_INFO("parse: " << AntlrFrontend::parses() << " file(s), " << AntlrFrontend::llFallbacks() << " LL fallback(s)");
+    if (cache)
+      LOG_INFO(cache->report());
+    return status;
+  }
 
-  tokens.fill();
+  // Un seul fichier : assembleur sur la sortie standard (file.o avec -c)
+  if (!clientSocket.empty())
+  {
+    string source;
+    if (!readFile(files[0], source))
+    {
+      cerr << "error: cannot read file: " << files[0] << endl;
+      exit(1);
+    }
+    return runClient(clientSocket, source, options);
+  }
 
-  ifccParser parser(&tokens);
-  tree::ParseTree *tree = parser.axiom();
+  MappedCharStream source;
+  if (!source.open(files[0]))
+  {
+    cerr << "error: cannot read file: " << files[0] << endl;
+    exit(1);
+  }
 
-  if (parser.getNumberOfSyntaxErrors() != 0)
+  unique_ptr<Frontend> frontend = createFrontend(options.frontend);
+  AST ast;
+  if (!frontend->parseToAST(source, ast))
   {
     cerr << "error: syntax error during parsing" << endl;
     exit(1);
   }
 
-  ifccParser::AxiomContext *axiom = dynamic_cast<ifccParser::AxiomContext *>(tree);
-  std::map<std::string, FunctionSignature> functionTable;
-
-  for (auto prog : axiom->prog())
+  try
   {
-    std::string fname = prog->ID()->getText();
-
-    SymbolTableVisitor stv;
-    stv.functionTable = &functionTable;
-    stv.visit(prog);
-
-    if (stv.error == 0)
+    // --run : exécuté en mémoire, sans assembleur ni éditeur de liens
+    if (run)
+      return runProgram(ast, options);
+    // --interpret : l'IR est exécuté tel quel, sans backend
+    if (interpret)
+      return interpretProgram(ast, options, irCounts ? &cerr : nullptr);
+    if (options.object)
     {
-      DefFonction defFunc(fname, {}); // tu peux gérer les params plus tard
-      CFG cfg(&defFunc, stv);
-      IRGenVisitor cgv;
-      cgv.cfg = &cfg;
-      cgv.functionTable = stv.functionTable;
-      (*cgv.functionTable)["putchar"] = FunctionSignature{"int", {"int"}};
-      (*cgv.functionTable)["getchar"] = FunctionSignature{"int", {}};
-      cgv.visit(prog);
-
-      std::cerr << "Function: " << fname << "\n";
-      // stv.print_symbol_table();
-      // cfg.current_bb->print_instrs();
-      cfg.gen_asm(std::cout);
+      // Comme gcc -c : file.o dans le répertoire courant, écrit seulement si la compilation réussit
+      ostringstream object;
+      compileObject(ast, options, object);
+      string out = filesystem::path(files[0]).filename().replace_extension(".o").string();
+      ofstream file(out, ios::binary);
+      if (!(file << object.str()))
+      {
+        cerr << "error: cannot write file: " << out << endl;
+        exit(1);
+      }
     }
+    else
+      compileProgram(ast, options, std::cout);
   }
-
+  catch (const CompileError &e)
+  {
+    cerr << "[ERROR] " << e.what() << endl;
+    exit(1);
+  }
+  if (cache)
+    LOG_INFO(cache->report());
   return 0;
 }
@@ -24,7 +24,7 @@ def run_command(string, logfile=None, toscreen=False):
     
     process=subprocess.Popen(string,shell=True,
                              stderr=subprocess.STDOUT,stdout=subprocess.PIPE,
-                             text=True,bufsize=0)
+                             text=True,errors='replace',bufsize=0)
     if logfile:
         logfile=open(logfile,'w')
     
@@ -40,6 +40,83 @@ def run_command(string, logfile=None, toscreen=False):
         logfile.write(f'\nexit status: {process.returncode}\n')
     return process.returncode
 
+def run_ifcc(flags, name, ifcc=None):
+    """ compile input.c with ifcc (or with the `ifcc` executable given) and `flags`:
+        stdout goes to `name`.out, stderr to `name`.err. return the exit status"""
+    if ifcc is None:
+        ifcc=f'{pld_base_dir}/compiler/ifcc'
+    return run_command(f'{ifcc} {flags}input.c > {name}.out 2> {name}.err')
+
+def same_ifcc_output(variants):
+    """ compile input.c once per (name, flags, ifcc) in `variants` (ifcc=None for
+        our own ifcc). return the name of the first variant whose exit status,
+        stdout or stderr differs from the first one, or None if they all agree"""
+    ref_name, ref_flags, ref_ifcc = variants[0]
+    ref_status = run_ifcc(ref_flags, ref_name, ref_ifcc)
+    for name, flags, ifcc in variants[1:]:
+        if run_ifcc(flags, name, ifcc) != ref_status:
+            return name
+        for ext in ['.out', '.err']:
+            if open(ref_name+ext,'rb').read() != open(name+ext,'rb').read():
+                return name
+    return None
+
+def check_same_output(variants, what):
+    """ for each optimization level (-O0, -O1 and -O2, or only the one given by -O),
+        check with same_ifcc_output that the (name, flags, ifcc) `variants` agree.
+        print the verdict of the test-case; return True if they all agree"""
+    for level in optimize_levels():
+        flags=ifccflags if args.optimize is not None else ifccflags+f'-O{level} '
+        level_variants=[(f'ifcc-O{level}-{name}', flags+extra, ifcc) for name, extra, ifcc in variants]
+        diff=same_ifcc_output(level_variants)
+        if diff:
+            print(f"TEST FAIL ({what} at -O{level})")
+            if args.verbose:
+                ref=level_variants[0][0]
+                run_command(f'diff {ref}.out {diff}.out; diff {ref}.err {diff}.err',toscreen=True)
+            return False
+    print("TEST OK")
+    return True
+
+def optimize_levels():
+    """ -O0, -O1 and -O2, or only the level given by -O """
+    return [args.optimize] if args.optimize is not None else ['0','1','2']
+
+def asm_stats(flags, ifcc=None):
+    """ compile input.c with `flags` and count, in the x86 assembly, the mov
+        instructions (movl, movq, movzbl...) and the %rbp-relative memory
+        accesses; then count the IR instructions, and among them the copies,
+        executed by `--interpret --ir-counts`.
+        return (movs, rbp accesses, IR instructions, IR copies), or None if ifcc
+        rejects input.c"""
+    if run_ifcc(flags, 'stats', ifcc) != 0:
+        return None
+    movs=rbp=0
+    for line in open('stats.out'):
+        fields=line.split()
+        if not fields or fields[0].endswith(':') or fields[0].startswith('.'):
+            continue
+        if fields[0].startswith('mov'):
+            movs+=1
+        if '(%rbp)' in line:
+            rbp+=1
+    run_ifcc(flags+'--interpret --ir-counts ', 'stats-run', ifcc)
+    executed=copies=0
+    for line in open('stats-run.err'):
+        if line.startswith('IR instructions executed:'):
+            executed=int(line.split(':')[1])
+        fields=line.split()
+        if len(fields)==2 and fields[0]=='copy':
+            copies=int(fields[1])
+    return (movs, rbp, executed, copies)
+
+def format_stats(ref, ours):
+    """ "mov N, %rbp N, IR N, IR copies N", each count as "ref -> ours" when there is a ref """
+    names=['mov','%rbp','IR','IR copies']
+    if ref is None:
+        return ', '.join(f'{n} {o}' for n, o in zip(names, ours))
+    return ', '.join(f'{n} {r} -> {o}' for n, r, o in zip(names, ref, ours))
+
 def dumpfile(name,quiet=False):
     data=open(name,"rb").read().decode('utf-8',errors='ignore')
     if not quiet:
@@ -68,6 +145,15 @@ epilog="examples:\n\n"
     +'\n'
     +twf("python3 ifcc-test.py -o ./myprog path/to/some/source.c")+'\n'
     +twf("python3 ifcc-test.py -S -o truc.s truc.c")+'\n'
+    +twf("python3 ifcc-test.py -O 1 --target arm64 testfiles")+'\n'
+    +twf("python3 ifcc-test.py --check-jobs 8 testfiles")+'\n'
+    +twf("python3 ifcc-test.py --frontend fast testfiles")+'\n'
+    +twf("python3 ifcc-test.py --exec object testfiles")+'\n'
+    +twf("python3 ifcc-test.py --exec run testfiles")+'\n'
+    +twf("python3 ifcc-test.py --exec interpret testfiles")+'\n'
+    +twf("python3 ifcc-test.py --check-frontends testfiles")+'\n'
+    +twf("python3 ifcc-test.py --check-against /tmp/old/compiler/ifcc testfiles")+'\n'
+    +twf("python3 ifcc-test.py -O 1 --asm-stats --stats-ref /tmp/old/compiler/ifcc testfiles")+'\n'
     ,
 )
 
@@ -82,12 +168,55 @@ argparser.add_argument('-d','--debug',action="count",default=0,
 argparser.add_argument('-S',action = "store_true", help='single-file mode: compile from C to assembly, but do not assemble')
 argparser.add_argument('-c',action = "store_true", help='single-file mode: compile/assemble to machine code, but do not link')
 argparser.add_argument('-o','--output',metavar = 'OUTPUTNAME', help='single-file mode: write output to that file')
+argparser.add_argument('-O','--optimize',metavar = 'LEVEL', default=None, help='pass -O<LEVEL> to ifcc (e.g. -O 1 enables register allocation)')
+argparser.add_argument('--target',metavar = 'TARGET', choices=['x86','arm64'], default=None,
+                       help='pass --target=<TARGET> to ifcc. With arm64, multiple-files mode only checks that the assembly of valid programs is accepted by the assembler of --arm64-cc (nothing is run)')
+argparser.add_argument('--frontend',metavar = 'FRONTEND', choices=['antlr','fast'], default=None,
+                       help='pass --frontend=<FRONTEND> to ifcc (antlr or fast)')
+argparser.add_argument('--check-frontends',action = "store_true",
+                       help='instead of running the programs, check that `--frontend=fast` gives exactly the same output (assembly, messages, exit status) as `--frontend=antlr`, at -O0, -O1 and -O2 (or only at the level given by -O)')
+argparser.add_argument('--exec',metavar = 'MODE', choices=['asm','object','run','interpret'], default='asm',
+                       help='multiple-files mode: how the ifcc side is built and run. asm (default): assembly linked by gcc; object: `ifcc -c` ELF object linked by gcc; run: executed in memory by `ifcc --run`; interpret: IR executed by `ifcc --interpret`')
+argparser.add_argument('--check-jobs',metavar = 'N', type=int, default=None,
+                       help='instead of running the programs, check that `ifcc -jN` gives exactly the same output (assembly, messages, exit status) as `ifcc -j1`, at -O0, -O1 and -O2 (or only at the level given by -O)')
+argparser.add_argument('--check-against',metavar = 'IFCC', default=None,
+                       help='instead of running the programs, check that our ifcc gives exactly the same output (assembly, messages, exit status) as the executable IFCC, e.g. an ifcc built from an earlier revision in a `git worktree`, at -O0, -O1 and -O2 (or only at the level given by -O)')
+argparser.add_argument('--asm-stats',action = "store_true",
+                       help='instead of running the programs, print for each program accepted by ifcc the number of mov instructions and of %%rbp accesses in its x86 assembly, and the number of IR instructions and IR copies executed by `ifcc --interpret --ir-counts`, at -O0, -O1 and -O2 (or only at the level given by -O), then the totals')
+argparser.add_argument('--stats-ref',metavar = 'IFCC', default=None,
+                       help='with --asm-stats: also count with the executable IFCC, and print both counts as "IFCC -> ours"')
+argparser.add_argument('--arm64-cc',metavar = 'CMD', default='aarch64-linux-gnu-gcc',
+                       help='AArch64 compiler driver used to assemble with --target arm64 (default: aarch64-linux-gnu-gcc)')
 
 args=argparser.parse_args()
 
 if args.debug >=2:
     print('debug: command-line arguments '+str(args))
 
+ifccflags = f'-O{args.optimize} ' if args.optimize is not None else ''
+if args.target is not None:
+    ifccflags += f'--target={args.target} '
+arm64=args.target=='arm64'
+if args.exec != 'asm' and arm64:
+    print("error: option --exec "+args.exec+" needs --target x86")
+    exit(1)
+if args.frontend is not None:
+    if args.check_frontends:
+        print("error: options --frontend and --check-frontends are not compatible")
+        exit(1)
+    ifccflags += f'--frontend={args.frontend} '
+if args.asm_stats and arm64:
+    print("error: option --asm-stats needs --target x86")
+    exit(1)
+if args.stats_ref is not None and not args.asm_stats:
+    print("error: option --stats-ref needs --asm-stats")
+    exit(1)
+# the test-cases run in their own directory: other ifcc executables are given by absolute path
+if args.check_against is not None:
+    args.check_against=os.path.abspath(args.check_against)
+if args.stats_ref is not None:
+    args.stats_ref=os.path.abspath(args.stats_ref)
+
 orig_cwd=os.getcwd()
 if "ifcc-test-output" in orig_cwd:
     print('error: cannot run ifcc-test.py from within its own output directory')
@@ -114,6 +243,9 @@ if makestatus: # updates are needed
 ## single-file mode aka "let's act just like GCC (almost)"
 
 if args.S or args.c or args.output:
+    if arm64 and not args.S:
+        print("error: with --target arm64, only option -S is supported")
+        exit(1)
     if args.S and args.c:
         print("error: options -S and -c are not compatible")
         exit(1)
@@ -140,9 +272,9 @@ if args.S or args.c or args.output:
         if args.output[-2:] != ".s":
             print("error: output file name must end with '.s'")
             exit(1)
-        ifccstatus=run_command(f'{pld_base_dir}/compiler/ifcc {inputfilename} > {args.output}')
+        ifccstatus=run_command(f'{pld_base_dir}/compiler/ifcc {ifccflags}{inputfilename} > {args.output}')
         if ifccstatus: # let's show error messages on screen
-            exit(run_command(f'{pld_base_dir}/compiler/ifcc {inputfilename}',toscreen=True))
+            exit(run_command(f'{pld_base_dir}/compiler/ifcc {ifccflags}{inputfilename}',toscreen=True))
         else:
             exit(0)
 
@@ -151,9 +283,9 @@ if args.S or args.c or args.output:
             print("error: output file name must end with '.o'")
             exit(1)
         asmname=args.output[:-2]+".s"
-        ifccstatus=run_command(f'{pld_base_dir}/compiler/ifcc {inputfilename} > {asmname}')
+        ifccstatus=run_command(f'{pld_base_dir}/compiler/ifcc {ifccflags}{inputfilename} > {asmname}')
         if ifccstatus: # let's show error messages on screen
-            exit(run_command(f'{pld_base_dir}/compiler/ifcc {inputfilename}',toscreen=True))
+            exit(run_command(f'{pld_base_dir}/compiler/ifcc {ifccflags}{inputfilename}',toscreen=True))
         exit(run_command(f'gcc -c -o {args.output} {asmname}',toscreen=True))
         
     else: # produce an executable
@@ -161,9 +293,9 @@ if args.S or args.c or args.output:
             print("error: incorrect name for an executable: "+args.output)
             exit(1)
         asmname=args.output+".s"
-        ifccstatus=run_command(f'{pld_base_dir}/compiler/ifcc {inputfilename} > {asmname}')
+        ifccstatus=run_command(f'{pld_base_dir}/compiler/ifcc {ifccflags}{inputfilename} > {asmname}')
         if ifccstatus:
-            exit(run_command(f'{pld_base_dir}/compiler/ifcc {inputfilename}', toscreen=True))
+            exit(run_command(f'{pld_base_dir}/compiler/ifcc {ifccflags}{inputfilename}', toscreen=True))
         exit(run_command(f'gcc -o {args.output} {asmname}'))
 
     # we should never end up here
@@ -252,6 +384,10 @@ for j in jobs:
         unique_jobs.append(j)
 jobs=sorted(unique_jobs)
 
+if arm64 and shutil.which(args.arm64_cc.split()[0]) is None:
+    print("error: --target arm64 needs an AArch64 assembler: "+args.arm64_cc+" not found (see --arm64-cc)")
+    exit(1)
+
 # debug: after deduplication
 if args.debug:
     print("debug: list of test-cases after PREPARE step:"," ".join(jobs))
@@ -263,13 +399,46 @@ if args.debug:
 ##            otherwise, this is a fail.
 
 all_ok=True
+stats_totals={} # --asm-stats: level -> test-case -> (ref counts, our counts)
 
 for jobname in jobs:
     os.chdir(f'{pld_base_dir}/ifcc-test-output')
 
     print('TEST-CASE: '+jobname)
     os.chdir(jobname)
-    
+
+    if args.check_jobs is not None:
+        ## -jN must not change anything: same output, byte for byte, as -j1
+        if not check_same_output([('j1','-j1 ',None), (f'j{args.check_jobs}', f'-j{args.check_jobs} ',None)],
+                                 f'-j{args.check_jobs} output differs from -j1'):
+            all_ok=False
+        continue
+
+    if args.check_frontends:
+        ## both frontends build the same tree, hence the same assembly and messages
+        if not check_same_output([('antlr','--frontend=antlr ',None), ('fast','--frontend=fast ',None)],
+                                 '--frontend=fast output differs from --frontend=antlr'):
+            all_ok=False
+        continue
+
+    if args.check_against is not None:
+        ## a change that must not touch the generated code: same output, byte for byte, as the other ifcc
+        if not check_same_output([('ref','',args.check_against), ('ours','',None)],
+                                 f'output differs from {args.check_against}'):
+            all_ok=False
+        continue
+
+    if args.asm_stats:
+        for level in optimize_levels():
+            flags=ifccflags if args.optimize is not None else ifccflags+f'-O{level} '
+            ours=asm_stats(flags)
+            if ours is None:
+                continue
+            ref=asm_stats(flags, args.stats_ref) if args.stats_ref is not None else None
+            stats_totals.setdefault(level, {})[jobname]=(ref, ours)
+            print(f'-O{level}: '+format_stats(ref, ours))
+        continue
+
     ## Reference compiler = GCC
     gccstatus=run_command("gcc -S -o asm-gcc.s input.c", "gcc-compile.txt")
     if gccstatus == 0:
@@ -280,8 +449,38 @@ for jobname in jobs:
         if args.verbose >=2:
             dumpfile("gcc-execute.txt")
             
+    if args.exec in ['run','interpret']:
+        ## no executable: ifcc runs the program itself. its own messages go to
+        ## ifcc-compile.txt, so that ifcc-execute.txt only holds the program's output
+        ifccstatus=run_command(f'{pld_base_dir}/compiler/ifcc {ifccflags}--{args.exec} input.c 2> ifcc-compile.txt', 'ifcc-execute.txt')
+        if gccstatus != 0:
+            if ifccstatus != 0:
+                print("TEST OK")
+            else:
+                print("TEST FAIL (your compiler accepts an invalid program)")
+                all_ok=False
+            continue
+        if open("gcc-execute.txt").read() != open("ifcc-execute.txt").read():
+            print(f"TEST FAIL (different results at execution with --{args.exec})")
+            all_ok=False
+            if args.verbose:
+                dumpfile("ifcc-compile.txt")
+                print("GCC:")
+                dumpfile("gcc-execute.txt")
+                print("you:")
+                dumpfile("ifcc-execute.txt")
+            continue
+        print("TEST OK")
+        continue
+
     ## IFCC compiler
-    ifccstatus=run_command(f'{pld_base_dir}/compiler/ifcc input.c > asm-ifcc.s', 'ifcc-compile.txt')
+    if args.exec == 'object':
+        ## integrated assembler: `ifcc -c` writes input.o, gcc only links it
+        ifccoutput='input.o'
+        ifccstatus=run_command(f'{pld_base_dir}/compiler/ifcc {ifccflags}-c input.c', 'ifcc-compile.txt')
+    else:
+        ifccoutput='asm-ifcc.s'
+        ifccstatus=run_command(f'{pld_base_dir}/compiler/ifcc {ifccflags}input.c > asm-ifcc.s', 'ifcc-compile.txt')
     
     if gccstatus != 0 and ifccstatus != 0:
         ## ifcc correctly rejects invalid program -> test-case ok
@@ -297,17 +496,34 @@ for jobname in jobs:
         print("TEST FAIL (your compiler rejects a valid program)")
         all_ok=False
         if args.verbose:
-            dumpfile("asm-ifcc.s")       # stdout of ifcc
+            if args.exec == 'asm':
+                dumpfile("asm-ifcc.s")   # stdout of ifcc
             dumpfile("ifcc-compile.txt") # stderr of ifcc
         continue
+    elif arm64:
+        ## nothing to run on this host: the assembly of a valid program must at least assemble
+        asstatus=run_command(f'{args.arm64_cc} -c -o obj-ifcc.o asm-ifcc.s', "ifcc-assemble.txt")
+        if asstatus:
+            print("TEST FAIL (your compiler produces incorrect assembly)")
+            all_ok=False
+            if args.verbose:
+                dumpfile("asm-ifcc.s")
+                dumpfile("ifcc-assemble.txt")
+        else:
+            print("TEST OK")
+        continue
     else:
         ## ifcc accepts to compile valid program -> let's link it
-        ldstatus=run_command("gcc -o exe-ifcc asm-ifcc.s", "ifcc-link.txt")
+        ldstatus=run_command(f"gcc -o exe-ifcc {ifccoutput}", "ifcc-link.txt")
         if ldstatus:
-            print("TEST FAIL (your compiler produces incorrect assembly)")
+            if args.exec == 'object':
+                print("TEST FAIL (your compiler produces an incorrect object file)")
+            else:
+                print("TEST FAIL (your compiler produces incorrect assembly)")
             all_ok=False
             if args.verbose:
-                dumpfile("asm-ifcc.s")
+                if args.exec == 'asm':
+                    dumpfile("asm-ifcc.s")
                 dumpfile("ifcc-link.txt")
             continue
 
@@ -329,5 +545,15 @@ for jobname in jobs:
     ## last but not least
     print("TEST OK")
 
+if args.asm_stats:
+    for level, cases in stats_totals.items():
+        # with --stats-ref, only the programs accepted by both executables are summed
+        counted=[c for c in cases.values() if args.stats_ref is None or c[0] is not None]
+        ours=tuple(sum(c[1][i] for c in counted) for i in range(4))
+        ref=tuple(sum(c[0][i] for c in counted) for i in range(4)) if args.stats_ref is not None else None
+        print(f'TOTAL -O{level} ({len(counted)} programs): '+format_stats(ref, ours))
+
 if not (all_ok or args.verbose):
     print("Some test-cases failed. Run ifcc-test.py with option '--verbose' for more detailed feedback.")
+
+exit(0 if all_ok else 1)
@@ -0,0 +1,22 @@
+int add(int a, int b) {
+    return a + b;
+}
+
+int main() {
+    int a = 1;
+    int b = 2;
+    int c = 3;
+    int d = 4;
+    int e = 5;
+    int f = 6;
+    int g = 7;
+    int h = 8;
+    int i = 0;
+    while (i < 3) {
+        a = add(a, b) + c;
+        b = b * d - e;
+        c = c + f * g - h;
+        i = i + 1;
+    }
+    return a + b + c + d + e + f + g + h;
+}
@@ -0,0 +1,16671 @@
+/* ~50k registres virtuels dans une seule fonction (variables + temporaires) */
+int main() {
+    int v0 = 0;
+    int v1 = v0 + 1;
+    int v2 = v1 + 1;
+    int v3 = v2 + 1;
+    int v4 = v3 + 1;
+    int v5 = v4 + 1;
+    int v6 = v5 + 1;
+    int v7 = v6 + 1;
+    int v8 = v7 + 1;
+    int v9 = v8 + 1;
+    int v10 = v9 + 1;
+    int v11 = v10 + 1;
+    int v12 = v11 + 1;
+    int v13 = v12 + 1;
+    int v14 = v13 + 1;
+    int v15 = v14 + 1;
+    int v16 = v15 + 1;
+    int v17 = v16 + 1;
+    int v18 = v17 + 1;
+    int v19 = v18 + 1;
+    int v20 = v19 + 1;
+    int v21 = v20 + 1;
+    int v22 = v21 + 1;
+    int v23 = v22 + 1;
+    int v24 = v23 + 1;
+    int v25 = v24 + 1;
+    int v26 = v25 + 1;
+    int v27 = v26 + 1;
+    int v28 = v27 + 1;
+    int v29 = v28 + 1;
+    int v30 = v29 + 1;
+    int v31 = v30 + 1;
+    int v32 = v31 + 1;
+    int v33 = v32 + 1;
+    int v34 = v33 + 1;
+    int v35 = v34 + 1;
+    int v36 = v35 + 1;
+    int v37 = v36 + 1;
+    int v38 = v37 + 1;
+    int v39 = v38 + 1;
+    int v40 = v39 + 1;
+    int v41 = v40 + 1;
+    int v42 = v41 + 1;
+    int v43 = v42 + 1;
+    int v44 = v43 + 1;
+    int v45 = v44 + 1;
+    int v46 = v45 + 1;
+    int v47 = v46 + 1;
+    int v48 = v47 + 1;
+    int v49 = v48 + 1;
+    int v50 = v49 + 1;
+    int v51 = v50 + 1;
+    int v52 = v51 + 1;
+    int v53 = v52 + 1;
+    int v54 = v53 + 1;
+    int v55 = v54 + 1;
+    int v56 = v55 + 1;
+    int v57 = v56 + 1;
+    int v58 = v57 + 1;
+    int v59 = v58 + 1;
+    int v60 = v59 + 1;
+    int v61 = v60 + 1;
+    int v62 = v61 + 1;
+    int v63 = v62 + 1;
+    int v64 = v63 + 1;
+    int v65 = v64 + 1;
+    int v66 = v65 + 1;
+    int v67 = v66 + 1;
+    int v68 = v67 + 1;
+    int v69 = v68 + 1;
+    int v70 = v69 + 1;
+    int v71 = v70 + 1;
+    int v72 = v71 + 1;
+    int v73 = v72 + 1;
+    int v74 = v73 + 1;
+    int v75 = v74 + 1;
+    int v76 = v75 + 1;
+    int v77 = v76 + 1;
+    int v78 = v77 + 1;
+    int v79 = v78 + 1;
+    int v80 = v79 + 1;
+    int v81 = v80 + 1;
+    int v82 = v81 + 1;
+    int v83 = v82 + 1;
+    int v84 = v83 + 1;
+    int v85 = v84 + 1;
+    int v86 = v85 + 1;
+    int v87 = v86 + 1;
+    int v88 = v87 + 1;
+    int v89 = v88 + 1;
+    int v90 = v89 + 1;
+    int v91 = v90 + 1;
+    int v92 = v91 + 1;
+    int v93 = v92 + 1;
+    int v94 = v93 + 1;
+    int v95 = v94 + 1;
+    int v96 = v95 + 1;
+    int v97 = v96 + 1;
+    int v98 = v97 + 1;
+    int v99 = v98 + 1;
+    int v100 = v99 + 1;
+    int v101 = v100 + 1;
+    int v102 = v101 + 1;
+    int v103 = v102 + 1;
+    int v104 = v103 + 1;
+    int v105 = v104 + 1;
+    int v106 = v105 + 1;
+    int v107 = v106 + 1;
+    int v108 = v107 + 1;
+    int v109 = v108 + 1;
+    int v110 = v109 + 1;
+    int v111 = v110 + 1;
+    int v112 = v111 + 1;
+    int v113 = v112 + 1;
+    int v114 = v113 + 1;
+    int v115 = v114 + 1;
+    int v116 = v115 + 1;
+    int v117 = v116 + 1;
+    int v118 = v117 + 1;
+    int v119 = v118 + 1;
+    int v120 = v119 + 1;
+    int v121 = v120 + 1;
+    int v122 = v121 + 1;
+    int v123 = v122 + 1;
+    int v124 = v123 + 1;
+    int v125 = v124 + 1;
+    int v126 = v125 + 1;
+    int v127 = v126 + 1;
+    int v128 = v127 + 1;
+    int v129 = v128 + 1;
+    int v130 = v129 + 1;
+    int v131 = v130 + 1;
+    int v132 = v131 + 1;
+    int v133 = v132 + 1;
+    int v134 = v133 + 1;
+    int v135 = v134 + 1;
+    int v136 = v135 + 1;
+    int v137 = v136 + 1;
+    int v138 = v137 + 1;
+    int v139 = v138 + 1;
+    int v140 = v139 + 1;
+    int v141 = v140 + 1;
+    int v142 = v141 + 1;
+    int v143 = v142 + 1;
+    int v144 = v143 + 1;
+    int v145 = v144 + 1;
+    int v146 = v145 + 1;
+    int v147 = v146 + 1;
+    int v148 = v147 + 1;
+    int v149 = v148 + 1;
+    int v150 = v149 + 1;
+    int v151 = v150 + 1;
+    int v152 = v151 + 1;
+    int v153 = v152 + 1;
+    int v154 = v153 + 1;
+    int v155 = v154 + 1;
+    int v156 = v155 + 1;
+    int v157 = v156 + 1;
+    int v158 = v157 + 1;
+    int v159 = v158 + 1;
+    int v160 = v159 + 1;
+    int v161 = v160 + 1;
+    int v162 = v161 + 1;
+    int v163 = v162 + 1;
+    int v164 = v163 + 1;
+    int v165 = v164 + 1;
+    int v166 = v165 + 1;
+    int v167 = v166 + 1;
+    int v168 = v167 + 1;
+    int v169 = v168 + 1;
+    int v170 = v169 + 1;
+    int v171 = v170 + 1;
+    int v172 = v171 + 1;
+    int v173 = v172 + 1;
+    int v174 = v173 + 1;
+    int v175 = v174 + 1;
+    int v176 = v175 + 1;
+    int v177 = v176 + 1;
+    int v178 = v177 + 1;
+    int v179 = v178 + 1;
+    int v180 = v179 + 1;
+    int v181 = v180 + 1;
+    int v182 = v181 + 1;
+    int v183 = v182 + 1;
+    int v184 = v183 + 1;
+    int v185 = v184 + 1;
+    int v186 = v185 + 1;
+    int v187 = v186 + 1;
+    int v188 = v187 + 1;
+    int v189 = v188 + 1;
+    int v190 = v189 + 1;
+    int v191 = v190 + 1;
+    int v192 = v191 + 1;
+    int v193 = v192 + 1;
+    int v194 = v193 + 1;
+    int v195 = v194 + 1;
+    int v196 = v195 + 1;
+    int v197 = v196 + 1;
+    int v198 = v197 + 1;
+    int v199 = v198 + 1;
+    int v200 = v199 + 1;
+    int v201 = v200 + 1;
+    int v202 = v201 + 1;
+    int v203 = v202 + 1;
+    int v204 = v203 + 1;
+    int v205 = v204 + 1;
+    int v206 = v205 + 1;
+    int v207 = v206 + 1;
+    int v208 = v207 + 1;
+    int v209 = v208 + 1;
+    int v210 = v209 + 1;
+    int v211 = v210 + 1;
+    int v212 = v211 + 1;
+    int v213 = v212 + 1;
+    int v214 = v213 + 1;
+    int v215 = v214 + 1;
+    int v216 = v215 + 1;
+    int v217 = v216 + 1;
+    int v218 = v217 + 1;
+    int v219 = v218 + 1;
+    int v220 = v219 + 1;
+    int v221 = v220 + 1;
+    int v222 = v221 + 1;
+    int v223 = v222 + 1;
+    int v224 = v223 + 1;
+    int v225 = v224 + 1;
+    int v226 = v225 + 1;
+    int v227 = v226 + 1;
+    int v228 = v227 + 1;
+    int v229 = v228 + 1;
+    int v230 = v229 + 1;
+    int v231 = v230 + 1;
+    int v232 = v231 + 1;
+    int v233 = v232 + 1;
+    int v234 = v233 + 1;
+    int v235 = v234 + 1;
+    int v236 = v235 + 1;
+    int v237 = v236 + 1;
+    int v238 = v237 + 1;
+    int v239 = v238 + 1;
+    int v240 = v239 + 1;
+    int v241 = v240 + 1;
+    int v242 = v241 + 1;
+    int v243 = v242 + 1;
+    int v244 = v243 + 1;
+    int v245 = v244 + 1;
+    int v246 = v245 + 1;
+    int v247 = v246 + 1;
+    int v248 = v247 + 1;
+    int v249 = v248 + 1;
+    int v250 = v249 + 1;
+    int v251 = v250 + 1;
+    int v252 = v251 + 1;
+    int v253 = v252 + 1;
+    int v254 = v253 + 1;
+    int v255 = v254 + 1;
+    int v256 = v255 + 1;
+    int v257 = v256 + 1;
+    int v258 = v257 + 1;
+    int v259 = v258 + 1;
+    int v260 = v259 + 1;
+    int v261 = v260 + 1;
+    int v262 = v261 + 1;
+    int v263 = v262 + 1;
+    int v264 = v263 + 1;
+    int v265 = v264 + 1;
+    int v266 = v265 + 1;
+    int v267 = v266 + 1;
+    int v268 = v267 + 1;
+    int v269 = v268 + 1;
+    int v270 = v269 + 1;
+    int v271 = v270 + 1;
+    int v272 = v271 + 1;
+    int v273 = v272 + 1;
+    int v274 = v273 + 1;
+    int v275 = v274 + 1;
+    int v276 = v275 + 1;
+    int v277 = v276 + 1;
+    int v278 = v277 + 1;
+    int v279 = v278 + 1;
+    int v280 = v279 + 1;
+    int v281 = v280 + 1;
+    int v282 = v281 + 1;
+    int v283 = v282 + 1;
+    int v284 = v283 + 1;
+    int v285 = v284 + 1;
+    int v286 = v285 + 1;
+    int v287 = v286 + 1;
+    int v288 = v287 + 1;
+    int v289 = v288 + 1;
+    int v290 = v289 + 1;
+    int v291 = v290 + 1;
+    int v292 = v291 + 1;
+    int v293 = v292 + 1;
+    int v294 = v293 + 1;
+    int v295 = v294 + 1;
+    int v296 = v295 + 1;
+    int v297 = v296 + 1;
+    int v298 = v297 + 1;
+    int v299 = v298 + 1;
+    int v300 = v299 + 1;
+    int v301 = v300 + 1;
+    int v302 = v301 + 1;
+    int v303 = v302 + 1;
+    int v304 = v303 + 1;
+    int v305 = v304 + 1;
+    int v306 = v305 + 1;
+    int v307 = v306 + 1;
+    int v308 = v307 + 1;
+    int v309 = v308 + 1;
+    int v310 = v309 + 1;
+    int v311 = v310 + 1;
+    int v312 = v311 + 1;
+    int v313 = v312 + 1;
+    int v314 = v313 + 1;
+    int v315 = v314 + 1;
+    int v316 = v315 + 1;
+    int v317 = v316 + 1;
+    int v318 = v317 + 1;
+    int v319 = v318 + 1;
+    int v320 = v319 + 1;
+    int v321 = v320 + 1;
+    int v322 = v321 + 1;
+    int v323 = v322 + 1;
+    int v324 = v323 + 1;
+    int v325 = v324 + 1;
+    int v326 = v325 + 1;
+    int v327 = v326 + 1;
+    int v328 = v327 + 1;
+    int v329 = v328 + 1;
+    int v330 = v329 + 1;
+    int v331 = v330 + 1;
+    int v332 = v331 + 1;
+    int v333 = v332 + 1;
+    int v334 = v333 + 1;
+    int v335 = v334 + 1;
+    int v336 = v335 + 1;
+    int v337 = v336 + 1;
+    int v338 = v337 + 1;
+    int v339 = v338 + 1;
+    int v340 = v339 + 1;
+    int v341 = v340 + 1;
+    int v342 = v341 + 1;
+    int v343 = v342 + 1;
+    int v344 = v343 + 1;
+    int v345 = v344 + 1;
+    int v346 = v345 + 1;
+    int v347 = v346 + 1;
+    int v348 = v347 + 1;
+    int v349 = v348 + 1;
+    int v350 = v349 + 1;
+    int v351 = v350 + 1;
+    int v352 = v351 + 1;
+    int v353 = v352 + 1;
+    int v354 = v353 + 1;
+    int v355 = v354 + 1;
+    int v356 = v355 + 1;
+    int v357 = v356 + 1;
+    int v358 = v357 + 1;
+    int v359 = v358 + 1;
+    int v360 = v359 + 1;
+    int v361 = v360 + 1;
+    int v362 = v361 + 1;
+    int v363 = v362 + 1;
+    int v364 = v363 + 1;
+    int v365 = v364 + 1;
+    int v366 = v365 + 1;
+    int v367 = v366 + 1;
+    int v368 = v367 + 1;
+    int v369 = v368 + 1;
+    int v370 = v369 + 1;
+    int v371 = v370 + 1;
+    int v372 = v371 + 1;
+    int v373 = v372 + 1;
+    int v374 = v373 + 1;
+    int v375 = v374 + 1;
+    int v376 = v375 + 1;
+    int v377 = v376 + 1;
+    int v378 = v377 + 1;
+    int v379 = v378 + 1;
+    int v380 = v379 + 1;
+    int v381 = v380 + 1;
+    int v382 = v381 + 1;
+    int v383 = v382 + 1;
+    int v384 = v383 + 1;
+    int v385 = v384 + 1;
+    int v386 = v385 + 1;
+    int v387 = v386 + 1;
+    int v388 = v387 + 1;
+    int v389 = v388 + 1;
+    int v390 = v389 + 1;
+    int v391 = v390 + 1;
+    int v392 = v391 + 1;
+    int v393 = v392 + 1;
+    int v394 = v393 + 1;
+    int v395 = v394 + 1;
+    int v396 = v395 + 1;
+    int v397 = v396 + 1;
+    int v398 = v397 + 1;
+    int v399 = v398 + 1;
+    int v400 = v399 + 1;
+    int v401 = v400 + 1;
+    int v402 = v401 + 1;
+    int v403 = v402 + 1;
+    int v404 = v403 + 1;
+    int v405 = v404 + 1;
+    int v406 = v405 + 1;
+    int v407 = v406 + 1;
+    int v408 = v407 + 1;
+    int v409 = v408 + 1;
+    int v410 = v409 + 1;
+    int v411 = v410 + 1;
+    int v412 = v411 + 1;
+    int v413 = v412 + 1;
+    int v414 = v413 + 1;
+    int v415 = v414 + 1;
+    int v416 = v415 + 1;
+    int v417 = v416 + 1;
+    int v418 = v417 + 1;
+    int v419 = v418 + 1;
+    int v420 = v419 + 1;
+    int v421 = v420 + 1;
+    int v422 = v421 + 1;
+    int v423 = v422 + 1;
+    int v424 = v423 + 1;
+    int v425 = v424 + 1;
+    int v426 = v425 + 1;
+    int v427 = v426 + 1;
+    int v428 = v427 + 1;
+    int v429 = v428 + 1;
+    int v430 = v429 + 1;
+    int v431 = v430 + 1;
+    int v432 = v431 + 1;
+    int v433 = v432 + 1;
+    int v434 = v433 + 1;
+    int v435 = v434 + 1;
+    int v436 = v435 + 1;
+    int v437 = v436 + 1;
+    int v438 = v437 + 1;
+    int v439 = v438 + 1;
+    int v440 = v439 + 1;
+    int v441 = v440 + 1;
+    int v442 = v441 + 1;
+    int v443 = v442 + 1;
+    int v444 = v443 + 1;
+    int v445 = v444 + 1;
+    int v446 = v445 + 1;
+    int v447 = v446 + 1;
+    int v448 = v447 + 1;
+    int v449 = v448 + 1;
+    int v450 = v449 + 1;
+    int v451 = v450 + 1;
+    int v452 = v451 + 1;
+    int v453 = v452 + 1;
+    int v454 = v453 + 1;
+    int v455 = v454 + 1;
+    int v456 = v455 + 1;
+    int v457 = v456 + 1;
+    int v458 = v457 + 1;
+    int v459 = v458 + 1;
+    int v460 = v459 + 1;
+    int v461 = v460 + 1;
+    int v462 = v461 + 1;
+    int v463 = v462 + 1;
+    int v464 = v463 + 1;
+    int v465 = v464 + 1;
+    int v466 = v465 + 1;
+    int v467 = v466 + 1;
+    int v468 = v467 + 1;
+    int v469 = v468 + 1;
+    int v470 = v469 + 1;
+    int v471 = v470 + 1;
+    int v472 = v471 + 1;
+    int v473 = v472 + 1;
+    int v474 = v473 + 1;
+    int v475 = v474 + 1;
+    int v476 = v475 + 1;
+    int v477 = v476 + 1;
+    int v478 = v477 + 1;
+    int v479 = v478 + 1;
+    int v480 = v479 + 1;
+    int v481 = v480 + 1;
+    int v482 = v481 + 1;
+    int v483 = v482 + 1;
+    int v484 = v483 + 1;
+    int v485 = v484 + 1;
+    int v486 = v485 + 1;
+    int v487 = v486 + 1;
+    int v488 = v487 + 1;
+    int v489 = v488 + 1;
+    int v490 = v489 + 1;
+    int v491 = v490 + 1;
+    int v492 = v491 + 1;
+    int v493 = v492 + 1;
+    int v494 = v493 + 1;
+    int v495 = v494 + 1;
+    int v496 = v495 + 1;
+    int v497 = v496 + 1;
+    int v498 = v497 + 1;
+    int v499 = v498 + 1;
+    int v500 = v499 + 1;
+    int v501 = v500 + 1;
+    int v502 = v501 + 1;
+    int v503 = v502 + 1;
+    int v504 = v503 + 1;
+    int v505 = v504 + 1;
+    int v506 = v505 + 1;
+    int v507 = v506 + 1;
+    int v508 = v507 + 1;
+    int v509 = v508 + 1;
+    int v510 = v509 + 1;
+    int v511 = v510 + 1;
+    int v512 = v511 + 1;
+    int v513 = v512 + 1;
+    int v514 = v513 + 1;
+    int v515 = v514 + 1;
+    int v516 = v515 + 1;
+    int v517 = v516 + 1;
+    int v518 = v517 + 1;
+    int v519 = v518 + 1;
+    int v520 = v519 + 1;
+    int v521 = v520 + 1;
+    int v522 = v521 + 1;
+    int v523 = v522 + 1;
+    int v524 = v523 + 1;
+    int v525 = v524 + 1;
+    int v526 = v525 + 1;
+    int v527 = v526 + 1;
+    int v528 = v527 + 1;
+    int v529 = v528 + 1;
+    int v530 = v529 + 1;
+    int v531 = v530 + 1;
+    int v532 = v531 + 1;
+    int v533 = v532 + 1;
+    int v534 = v533 + 1;
+    int v535 = v534 + 1;
+    int v536 = v535 + 1;
+    int v537 = v536 + 1;
+    int v538 = v537 + 1;
+    int v539 = v538 + 1;
+    int v540 = v539 + 1;
+    int v541 = v540 + 1;
+    int v542 = v541 + 1;
+    int v543 = v542 + 1;
+    int v544 = v543 + 1;
+    int v545 = v544 + 1;
+    int v546 = v545 + 1;
+    int v547 = v546 + 1;
+    int v548 = v547 + 1;
+    int v549 = v548 + 1;
+    int v550 = v549 + 1;
+    int v551 = v550 + 1;
+    int v552 = v551 + 1;
+    int v553 = v552 + 1;
+    int v554 = v553 + 1;
+    int v555 = v554 + 1;
+    int v556 = v555 + 1;
+    int v557 = v556 + 1;
+    int v558 = v557 + 1;
+    int v559 = v558 + 1;
+    int v560 = v559 + 1;
+    int v561 = v560 + 1;
+    int v562 = v561 + 1;
+    int v563 = v562 + 1;
+    int v564 = v563 + 1;
+    int v565 = v564 + 1;
+    int v566 = v565 + 1;
+    int v567 = v566 + 1;
+    int v568 = v567 + 1;
+    int v569 = v568 + 1;
+    int v570 = v569 + 1;
+    int v571 = v570 + 1;
+    int v572 = v571 + 1;
+    int v573 = v572 + 1;
+    int v574 = v573 + 1;
+    int v575 = v574 + 1;
+    int v576 = v575 + 1;
+    int v577 = v576 + 1;
+    int v578 = v577 + 1;
+    int v579 = v578 + 1;
+    int v580 = v579 + 1;
+    int v581 = v580 + 1;
+    int v582 = v581 + 1;
+    int v583 = v582 + 1;
+    int v584 = v583 + 1;
+    int v585 = v584 + 1;
+    int v586 = v585 + 1;
+    int v587 = v586 + 1;
+    int v588 = v587 + 1;
+    int v589 = v588 + 1;
+    int v590 = v589 + 1;
+    int v591 = v590 + 1;
+    int v592 = v591 + 1;
+    int v593 = v592 + 1;
+    int v594 = v593 + 1;
+    int v595 = v594 + 1;
+    int v596 = v595 + 1;
+    int v597 = v596 + 1;
+    int v598 = v597 + 1;
+    int v599 = v598 + 1;
+    int v600 = v599 + 1;
+    int v601 = v600 + 1;
+    int v602 = v601 + 1;
+    int v603 = v602 + 1;
+    int v604 = v603 + 1;
+    int v605 = v604 + 1;
+    int v606 = v605 + 1;
+    int v607 = v606 + 1;
+    int v608 = v607 + 1;
+    int v609 = v608 + 1;
+    int v610 = v609 + 1;
+    int v611 = v610 + 1;
+    int v612 = v611 + 1;
+    int v613 = v612 + 1;
+    int v614 = v613 + 1;
+    int v615 = v614 + 1;
+    int v616 = v615 + 1;
+    int v617 = v616 + 1;
+    int v618 = v617 + 1;
+    int v619 = v618 + 1;
+    int v620 = v619 + 1;
+    int v621 = v620 + 1;
+    int v622 = v621 + 1;
+    int v623 = v622 + 1;
+    int v624 = v623 + 1;
+    int v625 = v624 + 1;
+    int v626 = v625 + 1;
+    int v627 = v626 + 1;
+    int v628 = v627 + 1;
+    int v629 = v628 + 1;
+    int v630 = v629 + 1;
+    int v631 = v630 + 1;
+    int v632 = v631 + 1;
+    int v633 = v632 + 1;
+    int v634 = v633 + 1;
+    int v635 = v634 + 1;
+    int v636 = v635 + 1;
+    int v637 = v636 + 1;
+    int v638 = v637 + 1;
+    int v639 = v638 + 1;
+    int v640 = v639 + 1;
+    int v641 = v640 + 1;
+    int v642 = v641 + 1;
+    int v643 = v642 + 1;
+    int v644 = v643 + 1;
+    int v645 = v644 + 1;
+    int v646 = v645 + 1;
+    int v647 = v646 + 1;
+    int v648 = v647 + 1;
+    int v649 = v648 + 1;
+    int v650 = v649 + 1;
+    int v651 = v650 + 1;
+    int v652 = v651 + 1;
+    int v653 = v652 + 1;
+    int v654 = v653 + 1;
+    int v655 = v654 + 1;
+    int v656 = v655 + 1;
+    int v657 = v656 + 1;
+    int v658 = v657 + 1;
+    int v659 = v658 + 1;
+    int v660 = v659 + 1;
+    int v661 = v660 + 1;
+    int v662 = v661 + 1;
+    int v663 = v662 + 1;
+    int v664 = v663 + 1;
+    int v665 = v664 + 1;
+    int v666 = v665 + 1;
+    int v667 = v666 + 1;
+    int v668 = v667 + 1;
+    int v669 = v668 + 1;
+    int v670 = v669 + 1;
+    int v671 = v670 + 1;
+    int v672 = v671 + 1;
+    int v673 = v672 + 1;
+    int v674 = v673 + 1;
+    int v675 = v674 + 1;
+    int v676 = v675 + 1;
+    int v677 = v676 + 1;
+    int v678 = v677 + 1;
+    int v679 = v678 + 1;
+    int v680 = v679 + 1;
+    int v681 = v680 + 1;
+    int v682 = v681 + 1;
+    int v683 = v682 + 1;
+    int v684 = v683 + 1;
+    int v685 = v684 + 1;
+    int v686 = v685 + 1;
+    int v687 = v686 + 1;
+    int v688 = v687 + 1;
+    int v689 = v688 + 1;
+    int v690 = v689 + 1;
+    int v691 = v690 + 1;
+    int v692 = v691 + 1;
+    int v693 = v692 + 1;
+    int v694 = v693 + 1;
+    int v695 = v694 + 1;
+    int v696 = v695 + 1;
+    int v697 = v696 + 1;
+    int v698 = v697 + 1;
+    int v699 = v698 + 1;
+    int v700 = v699 + 1;
+    int v701 = v700 + 1;
+    int v702 = v701 + 1;
+    int v703 = v702 + 1;
+    int v704 = v703 + 1;
+    int v705 = v704 + 1;
+    int v706 = v705 + 1;
+    int v707 = v706 + 1;
+    int v708 = v707 + 1;
+    int v709 = v708 + 1;
+    int v710 = v709 + 1;
+    int v711 = v710 + 1;
+    int v712 = v711 + 1;
+    int v713 = v712 + 1;
+    int v714 = v713 + 1;
+    int v715 = v714 + 1;
+    int v716 = v715 + 1;
+    int v717 = v716 + 1;
+    int v718 = v717 + 1;
+    int v719 = v718 + 1;
+    int v720 = v719 + 1;
+    int v721 = v720 + 1;
+    int v722 = v721 + 1;
+    int v723 = v722 + 1;
+    int v724 = v723 + 1;
+    int v725 = v724 + 1;
+    int v726 = v725 + 1;
+    int v727 = v726 + 1;
+    int v728 = v727 + 1;
+    int v729 = v728 + 1;
+    int v730 = v729 + 1;
+    int v731 = v730 + 1;
+    int v732 = v731 + 1;
+    int v733 = v732 + 1;
+    int v734 = v733 + 1;
+    int v735 = v734 + 1;
+    int v736 = v735 + 1;
+    int v737 = v736 + 1;
+    int v738 = v737 + 1;
+    int v739 = v738 + 1;
+    int v740 = v739 + 1;
+    int v741 = v740 + 1;
+    int v742 = v741 + 1;
+    int v743 = v742 + 1;
+    int v744 = v743 + 1;
+    int v745 = v744 + 1;
+    int v746 = v745 + 1;
+    int v747 = v746 + 1;
+    int v748 = v747 + 1;
+    int v749 = v748 + 1;
+    int v750 = v749 + 1;
+    int v751 = v750 + 1;
+    int v752 = v751 + 1;
+    int v753 = v752 + 1;
+    int v754 = v753 + 1;
+    int v755 = v754 + 1;
+    int v756 = v755 + 1;
+    int v757 = v756 + 1;
+    int v758 = v757 + 1;
+    int v759 = v758 + 1;
+    int v760 = v759 + 1;
+    int v761 = v760 + 1;
+    int v762 = v761 + 1;
+    int v763 = v762 + 1;
+    int v764 = v763 + 1;
+    int v765 = v764 + 1;
+    int v766 = v765 + 1;
+    int v767 = v766 + 1;
+    int v768 = v767 + 1;
+    int v769 = v768 + 1;
+    int v770 = v769 + 1;
+    int v771 = v770 + 1;
+    int v772 = v771 + 1;
+    int v773 = v772 + 1;
+    int v774 = v773 + 1;
+    int v775 = v774 + 1;
+    int v776 = v775 + 1;
+    int v777 = v776 + 1;
+    int v778 = v777 + 1;
+    int v779 = v778 + 1;
+    int v780 = v779 + 1;
+    int v781 = v780 + 1;
+    int v782 = v781 + 1;
+    int v783 = v782 + 1;
+    int v784 = v783 + 1;
+    int v785 = v784 + 1;
+    int v786 = v785 + 1;
+    int v787 = v786 + 1;
+    int v788 = v787 + 1;
+    int v789 = v788 + 1;
+    int v790 = v789 + 1;
+    int v791 = v790 + 1;
+    int v792 = v791 + 1;
+    int v793 = v792 + 1;
+    int v794 = v793 + 1;
+    int v795 = v794 + 1;
+    int v796 = v795 + 1;
+    int v797 = v796 + 1;
+    int v798 = v797 + 1;
+    int v799 = v798 + 1;
+    int v800 = v799 + 1;
+    int v801 = v800 + 1;
+    int v802 = v801 + 1;
+    int v803 = v802 + 1;
+    int v804 = v803 + 1;
+    int v805 = v804 + 1;
+    int v806 = v805 + 1;
+    int v807 = v806 + 1;
+    int v808 = v807 + 1;
+    int v809 = v808 + 1;
+    int v810 = v809 + 1;
+    int v811 = v810 + 1;
+    int v812 = v811 + 1;
+    int v813 = v812 + 1;
+    int v814 = v813 + 1;
+    int v815 = v814 + 1;
+    int v816 = v815 + 1;
+    int v817 = v816 + 1;
+    int v818 = v817 + 1;
+    int v819 = v818 + 1;
+    int v820 = v819 + 1;
+    int v821 = v820 + 1;
+    int v822 = v821 + 1;
+    int v823 = v822 + 1;
+    int v824 = v823 + 1;
+    int v825 = v824 + 1;
+    int v826 = v825 + 1;
+    int v827 = v826 + 1;
+    int v828 = v827 + 1;
+    int v829 = v828 + 1;
+    int v830 = v829 + 1;
+    int v831 = v830 + 1;
+    int v832 = v831 + 1;
+    int v833 = v832 + 1;
+    int v834 = v833 + 1;
+    int v835 = v834 + 1;
+    int v836 = v835 + 1;
+    int v837 = v836 + 1;
+    int v838 = v837 + 1;
+    int v839 = v838 + 1;
+    int v840 = v839 + 1;
+    int v841 = v840 + 1;
+    int v842 = v841 + 1;
+    int v843 = v842 + 1;
+    int v844 = v843 + 1;
+    int v845 = v844 + 1;
+    int v846 = v845 + 1;
+    int v847 = v846 + 1;
+    int v848 = v847 + 1;
+    int v849 = v848 + 1;
+    int v850 = v849 + 1;
+    int v851 = v850 + 1;
+    int v852 = v851 + 1;
+    int v853 = v852 + 1;
+    int v854 = v853 + 1;
+    int v855 = v854 + 1;
+    int v856 = v855 + 1;
+    int v857 = v856 + 1;
+    int v858 = v857 + 1;
+    int v859 = v858 + 1;
+    int v860 = v859 + 1;
+    int v861 = v860 + 1;
+    int v862 = v861 + 1;
+    int v863 = v862 + 1;
+    int v864 = v863 + 1;
+    int v865 = v864 + 1;
+    int v866 = v865 + 1;
+    int v867 = v866 + 1;
+    int v868 = v867 + 1;
+    int v869 = v868 + 1;
+    int v870 = v869 + 1;
+    int v871 = v870 + 1;
+    int v872 = v871 + 1;
+    int v873 = v872 + 1;
+    int v874 = v873 + 1;
+    int v875 = v874 + 1;
+    int v876 = v875 + 1;
+    int v877 = v876 + 1;
+    int v878 = v877 + 1;
+    int v879 = v878 + 1;
+    int v880 = v879 + 1;
+    int v881 = v880 + 1;
+    int v882 = v881 + 1;
+    int v883 = v882 + 1;
+    int v884 = v883 + 1;
+    int v885 = v884 + 1;
+    int v886 = v885 + 1;
+    int v887 = v886 + 1;
+    int v888 = v887 + 1;
+    int v889 = v888 + 1;
+    int v890 = v889 + 1;
+    int v891 = v890 + 1;
+    int v892 = v891 + 1;
+    int v893 = v892 + 1;
+    int v894 = v893 + 1;
+    int v895 = v894 + 1;
+    int v896 = v895 + 1;
+    int v897 = v896 + 1;
+    int v898 = v897 + 1;
+    int v899 = v898 + 1;
+    int v900 = v899 + 1;
+    int v901 = v900 + 1;
+    int v902 = v901 + 1;
+    int v903 = v902 + 1;
+    int v904 = v903 + 1;
+    int v905 = v904 + 1;
+    int v906 = v905 + 1;
+    int v907 = v906 + 1;
+    int v908 = v907 + 1;
+    int v909 = v908 + 1;
+    int v910 = v909 + 1;
+    int v911 = v910 + 1;
+    int v912 = v911 + 1;
+    int v913 = v912 + 1;
+    int v914 = v913 + 1;
+    int v915 = v914 + 1;
+    int v916 = v915 + 1;
+    int v917 = v916 + 1;
+    int v918 = v917 + 1;
+    int v919 = v918 + 1;
+    int v920 = v919 + 1;
+    int v921 = v920 + 1;
+    int v922 = v921 + 1;
+    int v923 = v922 + 1;
+    int v924 = v923 + 1;
+    int v925 = v924 + 1;
+    int v926 = v925 + 1;
+    int v927 = v926 + 1;
+    int v928 = v927 + 1;
+    int v929 = v928 + 1;
+    int v930 = v929 + 1;
+    int v931 = v930 + 1;
+    int v932 = v931 + 1;
+    int v933 = v932 + 1;
+    int v934 = v933 + 1;
+    int v935 = v934 + 1;
+    int v936 = v935 + 1;
+    int v937 = v936 + 1;
+    int v938 = v937 + 1;
+    int v939 = v938 + 1;
+    int v940 = v939 + 1;
+    int v941 = v940 + 1;
+    int v942 = v941 + 1;
+    int v943 = v942 + 1;
+    int v944 = v943 + 1;
+    int v945 = v944 + 1;
+    int v946 = v945 + 1;
+    int v947 = v946 + 1;
+    int v948 = v947 + 1;
+    int v949 = v948 + 1;
+    int v950 = v949 + 1;
+    int v951 = v950 + 1;
+    int v952 = v951 + 1;
+    int v953 = v952 + 1;
+    int v954 = v953 + 1;
+    int v955 = v954 + 1;
+    int v956 = v955 + 1;
+    int v957 = v956 + 1;
+    int v958 = v957 + 1;
+    int v959 = v958 + 1;
+    int v960 = v959 + 1;
+    int v961 = v960 + 1;
+    int v962 = v961 + 1;
+    int v963 = v962 + 1;
+    int v964 = v963 + 1;
+    int v965 = v964 + 1;
+    int v966 = v965 + 1;
+    int v967 = v966 + 1;
+    int v968 = v967 + 1;
+    int v969 = v968 + 1;
+    int v970 = v969 + 1;
+    int v971 = v970 + 1;
+    int v972 = v971 + 1;
+    int v973 = v972 + 1;
+    int v974 = v973 + 1;
+    int v975 = v974 + 1;
+    int v976 = v975 + 1;
+    int v977 = v976 + 1;
+    int v978 = v977 + 1;
+    int v979 = v978 + 1;
+    int v980 = v979 + 1;
+    int v981 = v980 + 1;
+    int v982 = v981 + 1;
+    int v983 = v982 + 1;
+    int v984 = v983 + 1;
+    int v985 = v984 + 1;
+    int v986 = v985 + 1;
+    int v987 = v986 + 1;
+    int v988 = v987 + 1;
+    int v989 = v988 + 1;
+    int v990 = v989 + 1;
+    int v991 = v990 + 1;
+    int v992 = v991 + 1;
+    int v993 = v992 + 1;
+    int v994 = v993 + 1;
+    int v995 = v994 + 1;
+    int v996 = v995 + 1;
+    int v997 = v996 + 1;
+    int v998 = v997 + 1;
+    int v999 = v998 + 1;
+    int v1000 = v999 + 1;
+    int v1001 = v1000 + 1;
+    int v1002 = v1001 + 1;
+    int v1003 = v1002 + 1;
+    int v1004 = v1003 + 1;
+    int v1005 = v1004 + 1;
+    int v1006 = v1005 + 1;
+    int v1007 = v1006 + 1;
+    int v1008 = v1007 + 1;
+    int v1009 = v1008 + 1;
+    int v1010 = v1009 + 1;
+    int v1011 = v1010 + 1;
+    int v1012 = v1011 + 1;
+    int v1013 = v1012 + 1;
+    int v1014 = v1013 + 1;
+    int v1015 = v1014 + 1;
+    int v1016 = v1015 + 1;
+    int v1017 = v1016 + 1;
+    int v1018 = v1017 + 1;
+    int v1019 = v1018 + 1;
+    int v1020 = v1019 + 1;
+    int v1021 = v1020 + 1;
+    int v1022 = v1021 + 1;
+    int v1023 = v1022 + 1;
+    int v1024 = v1023 + 1;
+    int v1025 = v1024 + 1;
+    int v1026 = v1025 + 1;
+    int v1027 = v1026 + 1;
+    int v1028 = v1027 + 1;
+    int v1029 = v1028 + 1;
+    int v1030 = v1029 + 1;
+    int v1031 = v1030 + 1;
+    int v1032 = v1031 + 1;
+    int v1033 = v1032 + 1;
+    int v1034 = v1033 + 1;
+    int v1035 = v1034 + 1;
+    int v1036 = v1035 + 1;
+    int v1037 = v1036 + 1;
+    int v1038 = v1037 + 1;
+    int v1039 = v1038 + 1;
+    int v1040 = v1039 + 1;
+    int v1041 = v1040 + 1;
+    int v1042 = v1041 + 1;
+    int v1043 = v1042 + 1;
+    int v1044 = v1043 + 1;
+    int v1045 = v1044 + 1;
+    int v1046 = v1045 + 1;
+    int v1047 = v1046 + 1;
+    int v1048 = v1047 + 1;
+    int v1049 = v1048 + 1;
+    int v1050 = v1049 + 1;
+    int v1051 = v1050 + 1;
+    int v1052 = v1051 + 1;
+    int v1053 = v1052 + 1;
+    int v1054 = v1053 + 1;
+    int v1055 = v1054 + 1;
+    int v1056 = v1055 + 1;
+    int v1057 = v1056 + 1;
+    int v1058 = v1057 + 1;
+    int v1059 = v1058 + 1;
+    int v1060 = v1059 + 1;
+    int v1061 = v1060 + 1;
+    int v1062 = v1061 + 1;
+    int v1063 = v1062 + 1;
+    int v1064 = v1063 + 1;
+    int v1065 = v1064 + 1;
+    int v1066 = v1065 + 1;
+    int v1067 = v1066 + 1;
+    int v1068 = v1067 + 1;
+    int v1069 = v1068 + 1;
+    int v1070 = v1069 + 1;
+    int v1071 = v1070 + 1;
+    int v1072 = v1071 + 1;
+    int v1073 = v1072 + 1;
+    int v1074 = v1073 + 1;
+    int v1075 = v1074 + 1;
+    int v1076 = v1075 + 1;
+    int v1077 = v1076 + 1;
+    int v1078 = v1077 + 1;
+    int v1079 = v1078 + 1;
+    int v1080 = v1079 + 1;
+    int v1081 = v1080 + 1;
+    int v1082 = v1081 + 1;
+    int v1083 = v1082 + 1;
+    int v1084 = v1083 + 1;
+    int v1085 = v1084 + 1;
+    int v1086 = v1085 + 1;
+    int v1087 = v1086 + 1;
+    int v1088 = v1087 + 1;
+    int v1089 = v1088 + 1;
+    int v1090 = v1089 + 1;
+    int v1091 = v1090 + 1;
+    int v1092 = v1091 + 1;
+    int v1093 = v1092 + 1;
+    int v1094 = v1093 + 1;
+    int v1095 = v1094 + 1;
+    int v1096 = v1095 + 1;
+    int v1097 = v1096 + 1;
+    int v1098 = v1097 + 1;
+    int v1099 = v1098 + 1;
+    int v1100 = v1099 + 1;
+    int v1101 = v1100 + 1;
+    int v1102 = v1101 + 1;
+    int v1103 = v1102 + 1;
+    int v1104 = v1103 + 1;
+    int v1105 = v1104 + 1;
+    int v1106 = v1105 + 1;
+    int v1107 = v1106 + 1;
+    int v1108 = v1107 + 1;
+    int v1109 = v1108 + 1;
+    int v1110 = v1109 + 1;
+    int v1111 = v1110 + 1;
+    int v1112 = v1111 + 1;
+    int v1113 = v1112 + 1;
+    int v1114 = v1113 + 1;
+    int v1115 = v1114 + 1;
+    int v1116 = v1115 + 1;
+    int v1117 = v1116 + 1;
+    int v1118 = v1117 + 1;
+    int v1119 = v1118 + 1;
+    int v1120 = v1119 + 1;
+    int v1121 = v1120 + 1;
+    int v1122 = v1121 + 1;
+    int v1123 = v1122 + 1;
+    int v1124 = v1123 + 1;
+    int v1125 = v1124 + 1;
+    int v1126 = v1125 + 1;
+    int v1127 = v1126 + 1;
+    int v1128 = v1127 + 1;
+    int v1129 = v1128 + 1;
+    int v1130 = v1129 + 1;
+    int v1131 = v1130 + 1;
+    int v1132 = v1131 + 1;
+    int v1133 = v1132 + 1;
+    int v1134 = v1133 + 1;
+    int v1135 = v1134 + 1;
+    int v1136 = v1135 + 1;
+    int v1137 = v1136 + 1;
+    int v1138 = v1137 + 1;
+    int v1139 = v1138 + 1;
+    int v1140 = v1139 + 1;
+    int v1141 = v1140 + 1;
+    int v1142 = v1141 + 1;
+    int v1143 = v1142 + 1;
+    int v1144 = v1143 + 1;
+    int v1145 = v1144 + 1;
+    int v1146 = v1145 + 1;
+    int v1147 = v1146 + 1;
+    int v1148 = v1147 + 1;
+    int v1149 = v1148 + 1;
+    int v1150 = v1149 + 1;
+    int v1151 = v1150 + 1;
+    int v1152 = v1151 + 1;
+    int v1153 = v1152 + 1;
+    int v1154 = v1153 + 1;
+    int v1155 = v1154 + 1;
+    int v1156 = v1155 + 1;
+    int v1157 = v1156 + 1;
+    int v1158 = v1157 + 1;
+    int v1159 = v1158 + 1;
+    int v1160 = v1159 + 1;
+    int v1161 = v1160 + 1;
+    int v1162 = v1161 + 1;
+    int v1163 = v1162 + 1;
+    int v1164 = v1163 + 1;
+    int v1165 = v1164 + 1;
+    int v1166 = v1165 + 1;
+    int v1167 = v1166 + 1;
+    int v1168 = v1167 + 1;
+    int v1169 = v1168 + 1;
+    int v1170 = v1169 + 1;
+    int v1171 = v1170 + 1;
+    int v1172 = v1171 + 1;
+    int v1173 = v1172 + 1;
+    int v1174 = v1173 + 1;
+    int v1175 = v1174 + 1;
+    int v1176 = v1175 + 1;
+    int v1177 = v1176 + 1;
+    int v1178 = v1177 + 1;
+    int v1179 = v1178 + 1;
+    int v1180 = v1179 + 1;
+    int v1181 = v1180 + 1;
+    int v1182 = v1181 + 1;
+    int v1183 = v1182 + 1;
+    int v1184 = v1183 + 1;
+    int v1185 = v1184 + 1;
+    int v1186 = v1185 + 1;
+    int v1187 = v1186 + 1;
+    int v1188 = v1187 + 1;
+    int v1189 = v1188 + 1;
+    int v1190 = v1189 + 1;
+    int v1191 = v1190 + 1;
+    int v1192 = v1191 + 1;
+    int v1193 = v1192 + 1;
+    int v1194 = v1193 + 1;
+    int v1195 = v1194 + 1;
+    int v1196 = v1195 + 1;
+    int v1197 = v1196 + 1;
+    int v1198 = v1197 + 1;
+    int v1199 = v1198 + 1;
+    int v1200 = v1199 + 1;
+    int v1201 = v1200 + 1;
+    int v1202 = v1201 + 1;
+    int v1203 = v1202 + 1;
+    int v1204 = v1203 + 1;
+    int v1205 = v1204 + 1;
+    int v1206 = v1205 + 1;
+    int v1207 = v1206 + 1;
+    int v1208 = v1207 + 1;
+    int v1209 = v1208 + 1;
+    int v1210 = v1209 + 1;
+    int v1211 = v1210 + 1;
+    int v1212 = v1211 + 1;
+    int v1213 = v1212 + 1;
+    int v1214 = v1213 + 1;
+    int v1215 = v1214 + 1;
+    int v1216 = v1215 + 1;
+    int v1217 = v1216 + 1;
+    int v1218 = v1217 + 1;
+    int v1219 = v1218 + 1;
+    int v1220 = v1219 + 1;
+    int v1221 = v1220 + 1;
+    int v1222 = v1221 + 1;
+    int v1223 = v1222 + 1;
+    int v1224 = v1223 + 1;
+    int v1225 = v1224 + 1;
+    int v1226 = v1225 + 1;
+    int v1227 = v1226 + 1;
+    int v1228 = v1227 + 1;
+    int v1229 = v1228 + 1;
+    int v1230 = v1229 + 1;
+    int v1231 = v1230 + 1;
+    int v1232 = v1231 + 1;
+    int v1233 = v1232 + 1;
+    int v1234 = v1233 + 1;
+    int v1235 = v1234 + 1;
+    int v1236 = v1235 + 1;
+    int v1237 = v1236 + 1;
+    int v1238 = v1237 + 1;
+    int v1239 = v1238 + 1;
+    int v1240 = v1239 + 1;
+    int v1241 = v1240 + 1;
+    int v1242 = v1241 + 1;
+    int v1243 = v1242 + 1;
+    int v1244 = v1243 + 1;
+    int v1245 = v1244 + 1;
+    int v1246 = v1245 + 1;
+    int v1247 = v1246 + 1;
+    int v1248 = v1247 + 1;
+    int v1249 = v1248 + 1;
+    int v1250 = v1249 + 1;
+    int v1251 = v1250 + 1;
+    int v1252 = v1251 + 1;
+    int v1253 = v1252 + 1;
+    int v1254 = v1253 + 1;
+    int v1255 = v1254 + 1;
+    int v1256 = v1255 + 1;
+    int v1257 = v1256 + 1;
+    int v1258 = v1257 + 1;
+    int v1259 = v1258 + 1;
+    int v1260 = v1259 + 1;
+    int v1261 = v1260 + 1;
+    int v1262 = v1261 + 1;
+    int v1263 = v1262 + 1;
+    int v1264 = v1263 + 1;
+    int v1265 = v1264 + 1;
+    int v1266 = v1265 + 1;
+    int v1267 = v1266 + 1;
+    int v1268 = v1267 + 1;
+    int v1269 = v1268 + 1;
+    int v1270 = v1269 + 1;
+    int v1271 = v1270 + 1;
+    int v1272 = v1271 + 1;
+    int v1273 = v1272 + 1;
+    int v1274 = v1273 + 1;
+    int v1275 = v1274 + 1;
+    int v1276 = v1275 + 1;
+    int v1277 = v1276 + 1;
+    int v1278 = v1277 + 1;
+    int v1279 = v1278 + 1;
+    int v1280 = v1279 + 1;
+    int v1281 = v1280 + 1;
+    int v1282 = v1281 + 1;
+    int v1283 = v1282 + 1;
+    int v1284 = v1283 + 1;
+    int v1285 = v1284 + 1;
+    int v1286 = v1285 + 1;
+    int v1287 = v1286 + 1;
+    int v1288 = v1287 + 1;
+    int v1289 = v1288 + 1;
+    int v1290 = v1289 + 1;
+    int v1291 = v1290 + 1;
+    int v1292 = v1291 + 1;
+    int v1293 = v1292 + 1;
+    int v1294 = v1293 + 1;
+    int v1295 = v1294 + 1;
+    int v1296 = v1295 + 1;
+    int v1297 = v1296 + 1;
+    int v1298 = v1297 + 1;
+    int v1299 = v1298 + 1;
+    int v1300 = v1299 + 1;
+    int v1301 = v1300 + 1;
+    int v1302 = v1301 + 1;
+    int v1303 = v1302 + 1;
+    int v1304 = v1303 + 1;
+    int v1305 = v1304 + 1;
+    int v1306 = v1305 + 1;
+    int v1307 = v1306 + 1;
+    int v1308 = v1307 + 1;
+    int v1309 = v1308 + 1;
+    int v1310 = v1309 + 1;
+    int v1311 = v1310 + 1;
+    int v1312 = v1311 + 1;
+    int v1313 = v1312 + 1;
+    int v1314 = v1313 + 1;
+    int v1315 = v1314 + 1;
+    int v1316 = v1315 + 1;
+    int v1317 = v1316 + 1;
+    int v1318 = v1317 + 1;
+    int v1319 = v1318 + 1;
+    int v1320 = v1319 + 1;
+    int v1321 = v1320 + 1;
+    int v1322 = v1321 + 1;
+    int v1323 = v1322 + 1;
+    int v1324 = v1323 + 1;
+    int v1325 = v1324 + 1;
+    int v1326 = v1325 + 1;
+    int v1327 = v1326 + 1;
+    int v1328 = v1327 + 1;
+    int v1329 = v1328 + 1;
+    int v1330 = v1329 + 1;
+    int v1331 = v1330 + 1;
+    int v1332 = v1331 + 1;
+    int v1333 = v1332 + 1;
+    int v1334 = v1333 + 1;
+    int v1335 = v1334 + 1;
+    int v1336 = v1335 + 1;
+    int v1337 = v1336 + 1;
+    int v1338 = v1337 + 1;
+    int v1339 = v1338 + 1;
+    int v1340 = v1339 + 1;
+    int v1341 = v1340 + 1;
+    int v1342 = v1341 + 1;
+    int v1343 = v1342 + 1;
+    int v1344 = v1343 + 1;
+    int v1345 = v1344 + 1;
+    int v1346 = v1345 + 1;
+    int v1347 = v1346 + 1;
+    int v1348 = v1347 + 1;
+    int v1349 = v1348 + 1;
+    int v1350 = v1349 + 1;
+    int v1351 = v1350 + 1;
+    int v1352 = v1351 + 1;
+    int v1353 = v1352 + 1;
+    int v1354 = v1353 + 1;
+    int v1355 = v1354 + 1;
+    int v1356 = v1355 + 1;
+    int v1357 = v1356 + 1;
+    int v1358 = v1357 + 1;
+    int v1359 = v1358 + 1;
+    int v1360 = v1359 + 1;
+    int v1361 = v1360 + 1;
+    int v1362 = v1361 + 1;
+    int v1363 = v1362 + 1;
+    int v1364 = v1363 + 1;
+    int v1365 = v1364 + 1;
+    int v1366 = v1365 + 1;
+    int v1367 = v1366 + 1;
+    int v1368 = v1367 + 1;
+    int v1369 = v1368 + 1;
+    int v1370 = v1369 + 1;
+    int v1371 = v1370 + 1;
+    int v1372 = v1371 + 1;
+    int v1373 = v1372 + 1;
+    int v1374 = v1373 + 1;
+    int v1375 = v1374 + 1;
+    int v1376 = v1375 + 1;
+    int v1377 = v1376 + 1;
+    int v1378 = v1377 + 1;
+    int v1379 = v1378 + 1;
+    int v1380 = v1379 + 1;
+    int v1381 = v1380 + 1;
+    int v1382 = v1381 + 1;
+    int v1383 = v1382 + 1;
+    int v1384 = v1383 + 1;
+    int v1385 = v1384 + 1;
+    int v1386 = v1385 + 1;
+    int v1387 = v1386 + 1;
+    int v1388 = v1387 + 1;
+    int v1389 = v1388 + 1;
+    int v1390 = v1389 + 1;
+    int v1391 = v1390 + 1;
+    int v1392 = v1391 + 1;
+    int v1393 = v1392 + 1;
+    int v1394 = v1393 + 1;
+    int v1395 = v1394 + 1;
+    int v1396 = v1395 + 1;
+    int v1397 = v1396 + 1;
+    int v1398 = v1397 + 1;
+    int v1399 = v1398 + 1;
+    int v1400 = v1399 + 1;
+    int v1401 = v1400 + 1;
+    int v1402 = v1401 + 1;
+    int v1403 = v1402 + 1;
+    int v1404 = v1403 + 1;
+    int v1405 = v1404 + 1;
+    int v1406 = v1405 + 1;
+    int v1407 = v1406 + 1;
+    int v1408 = v1407 + 1;
+    int v1409 = v1408 + 1;
+    int v1410 = v1409 + 1;
+    int v1411 = v1410 + 1;
+    int v1412 = v1411 + 1;
+    int v1413 = v1412 + 1;
+    int v1414 = v1413 + 1;
+    int v1415 = v1414 + 1;
+    int v1416 = v1415 + 1;
+    int v1417 = v1416 + 1;
+    int v1418 = v1417 + 1;
+    int v1419 = v1418 + 1;
+    int v1420 = v1419 + 1;
+    int v1421 = v1420 + 1;
+    int v1422 = v1421 + 1;
+    int v1423 = v1422 + 1;
+    int v1424 = v1423 + 1;
+    int v1425 = v1424 + 1;
+    int v1426 = v1425 + 1;
+    int v1427 = v1426 + 1;
+    int v1428 = v1427 + 1;
+    int v1429 = v1428 + 1;
+    int v1430 = v1429 + 1;
+    int v1431 = v1430 + 1;
+    int v1432 = v1431 + 1;
+    int v1433 = v1432 + 1;
+    int v1434 = v1433 + 1;
+    int v1435 = v1434 + 1;
+    int v1436 = v1435 + 1;
+    int v1437 = v1436 + 1;
+    int v1438 = v1437 + 1;
+    int v1439 = v1438 + 1;
+    int v1440 = v1439 + 1;
+    int v1441 = v1440 + 1;
+    int v1442 = v1441 + 1;
+    int v1443 = v1442 + 1;
+    int v1444 = v1443 + 1;
+    int v1445 = v1444 + 1;
+    int v1446 = v1445 + 1;
+    int v1447 = v1446 + 1;
+    int v1448 = v1447 + 1;
+    int v1449 = v1448 + 1;
+    int v1450 = v1449 + 1;
+    int v1451 = v1450 + 1;
+    int v1452 = v1451 + 1;
+    int v1453 = v1452 + 1;
+    int v1454 = v1453 + 1;
+    int v1455 = v1454 + 1;
+    int v1456 = v1455 + 1;
+    int v1457 = v1456 + 1;
+    int v1458 = v1457 + 1;
+    int v1459 = v1458 + 1;
+    int v1460 = v1459 + 1;
+    int v1461 = v1460 + 1;
+    int v1462 = v1461 + 1;
+    int v1463 = v1462 + 1;
+    int v1464 = v1463 + 1;
+    int v1465 = v1464 + 1;
+    int v1466 = v1465 + 1;
+    int v1467 = v1466 + 1;
+    int v1468 = v1467 + 1;
+    int v1469 = v1468 + 1;
+    int v1470 = v1469 + 1;
+    int v1471 = v1470 + 1;
+    int v1472 = v1471 + 1;
+    int v1473 = v1472 + 1;
+    int v1474 = v1473 + 1;
+    int v1475 = v1474 + 1;
+    int v1476 = v1475 + 1;
+    int v1477 = v1476 + 1;
+    int v1478 = v1477 + 1;
+    int v1479 = v1478 + 1;
+    int v1480 = v1479 + 1;
+    int v1481 = v1480 + 1;
+    int v1482 = v1481 + 1;
+    int v1483 = v1482 + 1;
+    int v1484 = v1483 + 1;
+    int v1485 = v1484 + 1;
+    int v1486 = v1485 + 1;
+    int v1487 = v1486 + 1;
+    int v1488 = v1487 + 1;
+    int v1489 = v1488 + 1;
+    int v1490 = v1489 + 1;
+    int v1491 = v1490 + 1;
+    int v1492 = v1491 + 1;
+    int v1493 = v1492 + 1;
+    int v1494 = v1493 + 1;
+    int v1495 = v1494 + 1;
+    int v1496 = v1495 + 1;
+    int v1497 = v1496 + 1;
+    int v1498 = v1497 + 1;
+    int v1499 = v1498 + 1;
+    int v1500 = v1499 + 1;
+    int v1501 = v1500 + 1;
+    int v1502 = v1501 + 1;
+    int v1503 = v1502 + 1;
+    int v1504 = v1503 + 1;
+    int v1505 = v1504 + 1;
+    int v1506 = v1505 + 1;
+    int v1507 = v1506 + 1;
+    int v1508 = v1507 + 1;
+    int v1509 = v1508 + 1;
+    int v1510 = v1509 + 1;
+    int v1511 = v1510 + 1;
+    int v1512 = v1511 + 1;
+    int v1513 = v1512 + 1;
+    int v1514 = v1513 + 1;
+    int v1515 = v1514 + 1;
+    int v1516 = v1515 + 1;
+    int v1517 = v1516 + 1;
+    int v1518 = v1517 + 1;
+    int v1519 = v1518 + 1;
+    int v1520 = v1519 + 1;
+    int v1521 = v1520 + 1;
+    int v1522 = v1521 + 1;
+    int v1523 = v1522 + 1;
+    int v1524 = v1523 + 1;
+    int v1525 = v1524 + 1;
+    int v1526 = v1525 + 1;
+    int v1527 = v1526 + 1;
+    int v1528 = v1527 + 1;
+    int v1529 = v1528 + 1;
+    int v1530 = v1529 + 1;
+    int v1531 = v1530 + 1;
+    int v1532 = v1531 + 1;
+    int v1533 = v1532 + 1;
+    int v1534 = v1533 + 1;
+    int v1535 = v1534 + 1;
+    int v1536 = v1535 + 1;
+    int v1537 = v1536 + 1;
+    int v1538 = v1537 + 1;
+    int v1539 = v1538 + 1;
+    int v1540 = v1539 + 1;
+    int v1541 = v1540 + 1;
+    int v1542 = v1541 + 1;
+    int v1543 = v1542 + 1;
+    int v1544 = v1543 + 1;
+    int v1545 = v1544 + 1;
+    int v1546 = v1545 + 1;
+    int v1547 = v1546 + 1;
+    int v1548 = v1547 + 1;
+    int v1549 = v1548 + 1;
+    int v1550 = v1549 + 1;
+    int v1551 = v1550 + 1;
+    int v1552 = v1551 + 1;
+    int v1553 = v1552 + 1;
+    int v1554 = v1553 + 1;
+    int v1555 = v1554 + 1;
+    int v1556 = v1555 + 1;
+    int v1557 = v1556 + 1;
+    int v1558 = v1557 + 1;
+    int v1559 = v1558 + 1;
+    int v1560 = v1559 + 1;
+    int v1561 = v1560 + 1;
+    int v1562 = v1561 + 1;
+    int v1563 = v1562 + 1;
+    int v1564 = v1563 + 1;
+    int v1565 = v1564 + 1;
+    int v1566 = v1565 + 1;
+    int v1567 = v1566 + 1;
+    int v1568 = v1567 + 1;
+    int v1569 = v1568 + 1;
+    int v1570 = v1569 + 1;
+    int v1571 = v1570 + 1;
+    int v1572 = v1571 + 1;
+    int v1573 = v1572 + 1;
+    int v1574 = v1573 + 1;
+    int v1575 = v1574 + 1;
+    int v1576 = v1575 + 1;
+    int v1577 = v1576 + 1;
+    int v1578 = v1577 + 1;
+    int v1579 = v1578 + 1;
+    int v1580 = v1579 + 1;
+    int v1581 = v1580 + 1;
+    int v1582 = v1581 + 1;
+    int v1583 = v1582 + 1;
+    int v1584 = v1583 + 1;
+    int v1585 = v1584 + 1;
+    int v1586 = v1585 + 1;
+    int v1587 = v1586 + 1;
+    int v1588 = v1587 + 1;
+    int v1589 = v1588 + 1;
+    int v1590 = v1589 + 1;
+    int v1591 = v1590 + 1;
+    int v1592 = v1591 + 1;
+    int v1593 = v1592 + 1;
+    int v1594 = v1593 + 1;
+    int v1595 = v1594 + 1;
+    int v1596 = v1595 + 1;
+    int v1597 = v1596 + 1;
+    int v1598 = v1597 + 1;
+    int v1599 = v1598 + 1;
+    int v1600 = v1599 + 1;
+    int v1601 = v1600 + 1;
+    int v1602 = v1601 + 1;
+    int v1603 = v1602 + 1;
+    int v1604 = v1603 + 1;
+    int v1605 = v1604 + 1;
+    int v1606 = v1605 + 1;
+    int v1607 = v1606 + 1;
+    int v1608 = v1607 + 1;
+    int v1609 = v1608 + 1;
+    int v1610 = v1609 + 1;
+    int v1611 = v1610 + 1;
+    int v1612 = v1611 + 1;
+    int v1613 = v1612 + 1;
+    int v1614 = v1613 + 1;
+    int v1615 = v1614 + 1;
+    int v1616 = v1615 + 1;
+    int v1617 = v1616 + 1;
+    int v1618 = v1617 + 1;
+    int v1619 = v1618 + 1;
+    int v1620 = v1619 + 1;
+    int v1621 = v1620 + 1;
+    int v1622 = v1621 + 1;
+    int v1623 = v1622 + 1;
+    int v1624 = v1623 + 1;
+    int v1625 = v1624 + 1;
+    int v1626 = v1625 + 1;
+    int v1627 = v1626 + 1;
+    int v1628 = v1627 + 1;
+    int v1629 = v1628 + 1;
+    int v1630 = v1629 + 1;
+    int v1631 = v1630 + 1;
+    int v1632 = v1631 + 1;
+    int v1633 = v1632 + 1;
+    int v1634 = v1633 + 1;
+    int v1635 = v1634 + 1;
+    int v1636 = v1635 + 1;
+    int v1637 = v1636 + 1;
+    int v1638 = v1637 + 1;
+    int v1639 = v1638 + 1;
+    int v1640 = v1639 + 1;
+    int v1641 = v1640 + 1;
+    int v1642 = v1641 + 1;
+    int v1643 = v1642 + 1;
+    int v1644 = v1643 + 1;
+    int v1645 = v1644 + 1;
+    int v1646 = v1645 + 1;
+    int v1647 = v1646 + 1;
+    int v1648 = v1647 + 1;
+    int v1649 = v1648 + 1;
+    int v1650 = v1649 + 1;
+    int v1651 = v1650 + 1;
+    int v1652 = v1651 + 1;
+    int v1653 = v1652 + 1;
+    int v1654 = v1653 + 1;
+    int v1655 = v1654 + 1;
+    int v1656 = v1655 + 1;
+    int v1657 = v1656 + 1;
+    int v1658 = v1657 + 1;
+    int v1659 = v1658 + 1;
+    int v1660 = v1659 + 1;
+    int v1661 = v1660 + 1;
+    int v1662 = v1661 + 1;
+    int v1663 = v1662 + 1;
+    int v1664 = v1663 + 1;
+    int v1665 = v1664 + 1;
+    int v1666 = v1665 + 1;
+    int v1667 = v1666 + 1;
+    int v1668 = v1667 + 1;
+    int v1669 = v1668 + 1;
+    int v1670 = v1669 + 1;
+    int v1671 = v1670 + 1;
+    int v1672 = v1671 + 1;
+    int v1673 = v1672 + 1;
+    int v1674 = v1673 + 1;
+    int v1675 = v1674 + 1;
+    int v1676 = v1675 + 1;
+    int v1677 = v1676 + 1;
+    int v1678 = v1677 + 1;
+    int v1679 = v1678 + 1;
+    int v1680 = v1679 + 1;
+    int v1681 = v1680 + 1;
+    int v1682 = v1681 + 1;
+    int v1683 = v1682 + 1;
+    int v1684 = v1683 + 1;
+    int v1685 = v1684 + 1;
+    int v1686 = v1685 + 1;
+    int v1687 = v1686 + 1;
+    int v1688 = v1687 + 1;
+    int v1689 = v1688 + 1;
+    int v1690 = v1689 + 1;
+    int v1691 = v1690 + 1;
+    int v1692 = v1691 + 1;
+    int v1693 = v1692 + 1;
+    int v1694 = v1693 + 1;
+    int v1695 = v1694 + 1;
+    int v1696 = v1695 + 1;
+    int v1697 = v1696 + 1;
+    int v1698 = v1697 + 1;
+    int v1699 = v1698 + 1;
+    int v1700 = v1699 + 1;
+    int v1701 = v1700 + 1;
+    int v1702 = v1701 + 1;
+    int v1703 = v1702 + 1;
+    int v1704 = v1703 + 1;
+    int v1705 = v1704 + 1;
+    int v1706 = v1705 + 1;
+    int v1707 = v1706 + 1;
+    int v1708 = v1707 + 1;
+    int v1709 = v1708 + 1;
+    int v1710 = v1709 + 1;
+    int v1711 = v1710 + 1;
+    int v1712 = v1711 + 1;
+    int v1713 = v1712 + 1;
+    int v1714 = v1713 + 1;
+    int v1715 = v1714 + 1;
+    int v1716 = v1715 + 1;
+    int v1717 = v1716 + 1;
+    int v1718 = v1717 + 1;
+    int v1719 = v1718 + 1;
+    int v1720 = v1719 + 1;
+    int v1721 = v1720 + 1;
+    int v1722 = v1721 + 1;
+    int v1723 = v1722 + 1;
+    int v1724 = v1723 + 1;
+    int v1725 = v1724 + 1;
+    int v1726 = v1725 + 1;
+    int v1727 = v1726 + 1;
+    int v1728 = v1727 + 1;
+    int v1729 = v1728 + 1;
+    int v1730 = v1729 + 1;
+    int v1731 = v1730 + 1;
+    int v1732 = v1731 + 1;
+    int v1733 = v1732 + 1;
+    int v1734 = v1733 + 1;
+    int v1735 = v1734 + 1;
+    int v1736 = v1735 + 1;
+    int v1737 = v1736 + 1;
+    int v1738 = v1737 + 1;
+    int v1739 = v1738 + 1;
+    int v1740 = v1739 + 1;
+    int v1741 = v1740 + 1;
+    int v1742 = v1741 + 1;
+    int v1743 = v1742 + 1;
+    int v1744 = v1743 + 1;
+    int v1745 = v1744 + 1;
+    int v1746 = v1745 + 1;
+    int v1747 = v1746 + 1;
+    int v1748 = v1747 + 1;
+    int v1749 = v1748 + 1;
+    int v1750 = v1749 + 1;
+    int v1751 = v1750 + 1;
+    int v1752 = v1751 + 1;
+    int v1753 = v1752 + 1;
+    int v1754 = v1753 + 1;
+    int v1755 = v1754 + 1;
+    int v1756 = v1755 + 1;
+    int v1757 = v1756 + 1;
+    int v1758 = v1757 + 1;
+    int v1759 = v1758 + 1;
+    int v1760 = v1759 + 1;
+    int v1761 = v1760 + 1;
+    int v1762 = v1761 + 1;
+    int v1763 = v1762 + 1;
+    int v1764 = v1763 + 1;
+    int v1765 = v1764 + 1;
+    int v1766 = v1765 + 1;
+    int v1767 = v1766 + 1;
+    int v1768 = v1767 + 1;
+    int v1769 = v1768 + 1;
+    int v1770 = v1769 + 1;
+    int v1771 = v1770 + 1;
+    int v1772 = v1771 + 1;
+    int v1773 = v1772 + 1;
+    int v1774 = v1773 + 1;
+    int v1775 = v1774 + 1;
+    int v1776 = v1775 + 1;
+    int v1777 = v1776 + 1;
+    int v1778 = v1777 + 1;
+    int v1779 = v1778 + 1;
+    int v1780 = v1779 + 1;
+    int v1781 = v1780 + 1;
+    int v1782 = v1781 + 1;
+    int v1783 = v1782 + 1;
+    int v1784 = v1783 + 1;
+    int v1785 = v1784 + 1;
+    int v1786 = v1785 + 1;
+    int v1787 = v1786 + 1;
+    int v1788 = v1787 + 1;
+    int v1789 = v1788 + 1;
+    int v1790 = v1789 + 1;
+    int v1791 = v1790 + 1;
+    int v1792 = v1791 + 1;
+    int v1793 = v1792 + 1;
+    int v1794 = v1793 + 1;
+    int v1795 = v1794 + 1;
+    int v1796 = v1795 + 1;
+    int v1797 = v1796 + 1;
+    int v1798 = v1797 + 1;
+    int v1799 = v1798 + 1;
+    int v1800 = v1799 + 1;
+    int v1801 = v1800 + 1;
+    int v1802 = v1801 + 1;
+    int v1803 = v1802 + 1;
+    int v1804 = v1803 + 1;
+    int v1805 = v1804 + 1;
+    int v1806 = v1805 + 1;
+    int v1807 = v1806 + 1;
+    int v1808 = v1807 + 1;
+    int v1809 = v1808 + 1;
+    int v1810 = v1809 + 1;
+    int v1811 = v1810 + 1;
+    int v1812 = v1811 + 1;
+    int v1813 = v1812 + 1;
+    int v1814 = v1813 + 1;
+    int v1815 = v1814 + 1;
+    int v1816 = v1815 + 1;
+    int v1817 = v1816 + 1;
+    int v1818 = v1817 + 1;
+    int v1819 = v1818 + 1;
+    int v1820 = v1819 + 1;
+    int v1821 = v1820 + 1;
+    int v1822 = v1821 + 1;
+    int v1823 = v1822 + 1;
+    int v1824 = v1823 + 1;
+    int v1825 = v1824 + 1;
+    int v1826 = v1825 + 1;
+    int v1827 = v1826 + 1;
+    int v1828 = v1827 + 1;
+    int v1829 = v1828 + 1;
+    int v1830 = v1829 + 1;
+    int v1831 = v1830 + 1;
+    int v1832 = v1831 + 1;
+    int v1833 = v1832 + 1;
+    int v1834 = v1833 + 1;
+    int v1835 = v1834 + 1;
+    int v1836 = v1835 + 1;
+    int v1837 = v1836 + 1;
+    int v1838 = v1837 + 1;
+    int v1839 = v1838 + 1;
+    int v1840 = v1839 + 1;
+    int v1841 = v1840 + 1;
+    int v1842 = v1841 + 1;
+    int v1843 = v1842 + 1;
+    int v1844 = v1843 + 1;
+    int v1845 = v1844 + 1;
+    int v1846 = v1845 + 1;
+    int v1847 = v1846 + 1;
+    int v1848 = v1847 + 1;
+    int v1849 = v1848 + 1;
+    int v1850 = v1849 + 1;
+    int v1851 = v1850 + 1;
+    int v1852 = v1851 + 1;
+    int v1853 = v1852 + 1;
+    int v1854 = v1853 + 1;
+    int v1855 = v1854 + 1;
+    int v1856 = v1855 + 1;
+    int v1857 = v1856 + 1;
+    int v1858 = v1857 + 1;
+    int v1859 = v1858 + 1;
+    int v1860 = v1859 + 1;
+    int v1861 = v1860 + 1;
+    int v1862 = v1861 + 1;
+    int v1863 = v1862 + 1;
+    int v1864 = v1863 + 1;
+    int v1865 = v1864 + 1;
+    int v1866 = v1865 + 1;
+    int v1867 = v1866 + 1;
+    int v1868 = v1867 + 1;
+    int v1869 = v1868 + 1;
+    int v1870 = v1869 + 1;
+    int v1871 = v1870 + 1;
+    int v1872 = v1871 + 1;
+    int v1873 = v1872 + 1;
+    int v1874 = v1873 + 1;
+    int v1875 = v1874 + 1;
+    int v1876 = v1875 + 1;
+    int v1877 = v1876 + 1;
+    int v1878 = v1877 + 1;
+    int v1879 = v1878 + 1;
+    int v1880 = v1879 + 1;
+    int v1881 = v1880 + 1;
+    int v1882 = v1881 + 1;
+    int v1883 = v1882 + 1;
+    int v1884 = v1883 + 1;
+    int v1885 = v1884 + 1;
+    int v1886 = v1885 + 1;
+    int v1887 = v1886 + 1;
+    int v1888 = v1887 + 1;
+    int v1889 = v1888 + 1;
+    int v1890 = v1889 + 1;
+    int v1891 = v1890 + 1;
+    int v1892 = v1891 + 1;
+    int v1893 = v1892 + 1;
+    int v1894 = v1893 + 1;
+    int v1895 = v1894 + 1;
+    int v1896 = v1895 + 1;
+    int v1897 = v1896 + 1;
+    int v1898 = v1897 + 1;
+    int v1899 = v1898 + 1;
+    int v1900 = v1899 + 1;
+    int v1901 = v1900 + 1;
+    int v1902 = v1901 + 1;
+    int v1903 = v1902 + 1;
+    int v1904 = v1903 + 1;
+    int v1905 = v1904 + 1;
+    int v1906 = v1905 + 1;
+    int v1907 = v1906 + 1;
+    int v1908 = v1907 + 1;
+    int v1909 = v1908 + 1;
+    int v1910 = v1909 + 1;
+    int v1911 = v1910 + 1;
+    int v1912 = v1911 + 1;
+    int v1913 = v1912 + 1;
+    int v1914 = v1913 + 1;
+    int v1915 = v1914 + 1;
+    int v1916 = v1915 + 1;
+    int v1917 = v1916 + 1;
+    int v1918 = v1917 + 1;
+    int v1919 = v1918 + 1;
+    int v1920 = v1919 + 1;
+    int v1921 = v1920 + 1;
+    int v1922 = v1921 + 1;
+    int v1923 = v1922 + 1;
+    int v1924 = v1923 + 1;
+    int v1925 = v1924 + 1;
+    int v1926 = v1925 + 1;
+    int v1927 = v1926 + 1;
+    int v1928 = v1927 + 1;
+    int v1929 = v1928 + 1;
+    int v1930 = v1929 + 1;
+    int v1931 = v1930 + 1;
+    int v1932 = v1931 + 1;
+    int v1933 = v1932 + 1;
+    int v1934 = v1933 + 1;
+    int v1935 = v1934 + 1;
+    int v1936 = v1935 + 1;
+    int v1937 = v1936 + 1;
+    int v1938 = v1937 + 1;
+    int v1939 = v1938 + 1;
+    int v1940 = v1939 + 1;
+    int v1941 = v1940 + 1;
+    int v1942 = v1941 + 1;
+    int v1943 = v1942 + 1;
+    int v1944 = v1943 + 1;
+    int v1945 = v1944 + 1;
+    int v1946 = v1945 + 1;
+    int v1947 = v1946 + 1;
+    int v1948 = v1947 + 1;
+    int v1949 = v1948 + 1;
+    int v1950 = v1949 + 1;
+    int v1951 = v1950 + 1;
+    int v1952 = v1951 + 1;
+    int v1953 = v1952 + 1;
+    int v1954 = v1953 + 1;
+    int v1955 = v1954 + 1;
+    int v1956 = v1955 + 1;
+    int v1957 = v1956 + 1;
+    int v1958 = v1957 + 1;
+    int v1959 = v1958 + 1;
+    int v1960 = v1959 + 1;
+    int v1961 = v1960 + 1;
+    int v1962 = v1961 + 1;
+    int v1963 = v1962 + 1;
+    int v1964 = v1963 + 1;
+    int v1965 = v1964 + 1;
+    int v1966 = v1965 + 1;
+    int v1967 = v1966 + 1;
+    int v1968 = v1967 + 1;
+    int v1969 = v1968 + 1;
+    int v1970 = v1969 + 1;
+    int v1971 = v1970 + 1;
+    int v1972 = v1971 + 1;
+    int v1973 = v1972 + 1;
+    int v1974 = v1973 + 1;
+    int v1975 = v1974 + 1;
+    int v1976 = v1975 + 1;
+    int v1977 = v1976 + 1;
+    int v1978 = v1977 + 1;
+    int v1979 = v1978 + 1;
+    int v1980 = v1979 + 1;
+    int v1981 = v1980 + 1;
+    int v1982 = v1981 + 1;
+    int v1983 = v1982 + 1;
+    int v1984 = v1983 + 1;
+    int v1985 = v1984 + 1;
+    int v1986 = v1985 + 1;
+    int v1987 = v1986 + 1;
+    int v1988 = v1987 + 1;
+    int v1989 = v1988 + 1;
+    int v1990 = v1989 + 1;
+    int v1991 = v1990 + 1;
+    int v1992 = v1991 + 1;
+    int v1993 = v1992 + 1;
+    int v1994 = v1993 + 1;
+    int v1995 = v1994 + 1;
+    int v1996 = v1995 + 1;
+    int v1997 = v1996 + 1;
+    int v1998 = v1997 + 1;
+    int v1999 = v1998 + 1;
+    int v2000 = v1999 + 1;
+    int v2001 = v2000 + 1;
+    int v2002 = v2001 + 1;
+    int v2003 = v2002 + 1;
+    int v2004 = v2003 + 1;
+    int v2005 = v2004 + 1;
+    int v2006 = v2005 + 1;
+    int v2007 = v2006 + 1;
+    int v2008 = v2007 + 1;
+    int v2009 = v2008 + 1;
+    int v2010 = v2009 + 1;
+    int v2011 = v2010 + 1;
+    int v2012 = v2011 + 1;
+    int v2013 = v2012 + 1;
+    int v2014 = v2013 + 1;
+    int v2015 = v2014 + 1;
+    int v2016 = v2015 + 1;
+    int v2017 = v2016 + 1;
+    int v2018 = v2017 + 1;
+    int v2019 = v2018 + 1;
+    int v2020 = v2019 + 1;
+    int v2021 = v2020 + 1;
+    int v2022 = v2021 + 1;
+    int v2023 = v2022 + 1;
+    int v2024 = v2023 + 1;
+    int v2025 = v2024 + 1;
+    int v2026 = v2025 + 1;
+    int v2027 = v2026 + 1;
+    int v2028 = v2027 + 1;
+    int v2029 = v2028 + 1;
+    int v2030 = v2029 + 1;
+    int v2031 = v2030 + 1;
+    int v2032 = v2031 + 1;
+    int v2033 = v2032 + 1;
+    int v2034 = v2033 + 1;
+    int v2035 = v2034 + 1;
+    int v2036 = v2035 + 1;
+    int v2037 = v2036 + 1;
+    int v2038 = v2037 + 1;
+    int v2039 = v2038 + 1;
+    int v2040 = v2039 + 1;
+    int v2041 = v2040 + 1;
+    int v2042 = v2041 + 1;
+    int v2043 = v2042 + 1;
+    int v2044 = v2043 + 1;
+    int v2045 = v2044 + 1;
+    int v2046 = v2045 + 1;
+    int v2047 = v2046 + 1;
+    int v2048 = v2047 + 1;
+    int v2049 = v2048 + 1;
+    int v2050 = v2049 + 1;
+    int v2051 = v2050 + 1;
+    int v2052 = v2051 + 1;
+    int v2053 = v2052 + 1;
+    int v2054 = v2053 + 1;
+    int v2055 = v2054 + 1;
+    int v2056 = v2055 + 1;
+    int v2057 = v2056 + 1;
+    int v2058 = v2057 + 1;
+    int v2059 = v2058 + 1;
+    int v2060 = v2059 + 1;
+    int v2061 = v2060 + 1;
+    int v2062 = v2061 + 1;
+    int v2063 = v2062 + 1;
+    int v2064 = v2063 + 1;
+    int v2065 = v2064 + 1;
+    int v2066 = v2065 + 1;
+    int v2067 = v2066 + 1;
+    int v2068 = v2067 + 1;
+    int v2069 = v2068 + 1;
+    int v2070 = v2069 + 1;
+    int v2071 = v2070 + 1;
+    int v2072 = v2071 + 1;
+    int v2073 = v2072 + 1;
+    int v2074 = v2073 + 1;
+    int v2075 = v2074 + 1;
+    int v2076 = v2075 + 1;
+    int v2077 = v2076 + 1;
+    int v2078 = v2077 + 1;
+    int v2079 = v2078 + 1;
+    int v2080 = v2079 + 1;
+    int v2081 = v2080 + 1;
+    int v2082 = v2081 + 1;
+    int v2083 = v2082 + 1;
+    int v2084 = v2083 + 1;
+    int v2085 = v2084 + 1;
+    int v2086 = v2085 + 1;
+    int v2087 = v2086 + 1;
+    int v2088 = v2087 + 1;
+    int v2089 = v2088 + 1;
+    int v2090 = v2089 + 1;
+    int v2091 = v2090 + 1;
+    int v2092 = v2091 + 1;
+    int v2093 = v2092 + 1;
+    int v2094 = v2093 + 1;
+    int v2095 = v2094 + 1;
+    int v2096 = v2095 + 1;
+    int v2097 = v2096 + 1;
+    int v2098 = v2097 + 1;
+    int v2099 = v2098 + 1;
+    int v2100 = v2099 + 1;
+    int v2101 = v2100 + 1;
+    int v2102 = v2101 + 1;
+    int v2103 = v2102 + 1;
+    int v2104 = v2103 + 1;
+    int v2105 = v2104 + 1;
+    int v2106 = v2105 + 1;
+    int v2107 = v2106 + 1;
+    int v2108 = v2107 + 1;
+    int v2109 = v2108 + 1;
+    int v2110 = v2109 + 1;
+    int v2111 = v2110 + 1;
+    int v2112 = v2111 + 1;
+    int v2113 = v2112 + 1;
+    int v2114 = v2113 + 1;
+    int v2115 = v2114 + 1;
+    int v2116 = v2115 + 1;
+    int v2117 = v2116 + 1;
+    int v2118 = v2117 + 1;
+    int v2119 = v2118 + 1;
+    int v2120 = v2119 + 1;
+    int v2121 = v2120 + 1;
+    int v2122 = v2121 + 1;
+    int v2123 = v2122 + 1;
+    int v2124 = v2123 + 1;
+    int v2125 = v2124 + 1;
+    int v2126 = v2125 + 1;
+    int v2127 = v2126 + 1;
+    int v2128 = v2127 + 1;
+    int v2129 = v2128 + 1;
+    int v2130 = v2129 + 1;
+    int v2131 = v2130 + 1;
+    int v2132 = v2131 + 1;
+    int v2133 = v2132 + 1;
+    int v2134 = v2133 + 1;
+    int v2135 = v2134 + 1;
+    int v2136 = v2135 + 1;
+    int v2137 = v2136 + 1;
+    int v2138 = v2137 + 1;
+    int v2139 = v2138 + 1;
+    int v2140 = v2139 + 1;
+    int v2141 = v2140 + 1;
+    int v2142 = v2141 + 1;
+    int v2143 = v2142 + 1;
+    int v2144 = v2143 + 1;
+    int v2145 = v2144 + 1;
+    int v2146 = v2145 + 1;
+    int v2147 = v2146 + 1;
+    int v2148 = v2147 + 1;
+    int v2149 = v2148 + 1;
+    int v2150 = v2149 + 1;
+    int v2151 = v2150 + 1;
+    int v2152 = v2151 + 1;
+    int v2153 = v2152 + 1;
+    int v2154 = v2153 + 1;
+    int v2155 = v2154 + 1;
+    int v2156 = v2155 + 1;
+    int v2157 = v2156 + 1;
+    int v2158 = v2157 + 1;
+    int v2159 = v2158 + 1;
+    int v2160 = v2159 + 1;
+    int v2161 = v2160 + 1;
+    int v2162 = v2161 + 1;
+    int v2163 = v2162 + 1;
+    int v2164 = v2163 + 1;
+    int v2165 = v2164 + 1;
+    int v2166 = v2165 + 1;
+    int v2167 = v2166 + 1;
+    int v2168 = v2167 + 1;
+    int v2169 = v2168 + 1;
+    int v2170 = v2169 + 1;
+    int v2171 = v2170 + 1;
+    int v2172 = v2171 + 1;
+    int v2173 = v2172 + 1;
+    int v2174 = v2173 + 1;
+    int v2175 = v2174 + 1;
+    int v2176 = v2175 + 1;
+    int v2177 = v2176 + 1;
+    int v2178 = v2177 + 1;
+    int v2179 = v2178 + 1;
+    int v2180 = v2179 + 1;
+    int v2181 = v2180 + 1;
+    int v2182 = v2181 + 1;
+    int v2183 = v2182 + 1;
+    int v2184 = v2183 + 1;
+    int v2185 = v2184 + 1;
+    int v2186 = v2185 + 1;
+    int v2187 = v2186 + 1;
+    int v2188 = v2187 + 1;
+    int v2189 = v2188 + 1;
+    int v2190 = v2189 + 1;
+    int v2191 = v2190 + 1;
+    int v2192 = v2191 + 1;
+    int v2193 = v2192 + 1;
+    int v2194 = v2193 + 1;
+    int v2195 = v2194 + 1;
+    int v2196 = v2195 + 1;
+    int v2197 = v2196 + 1;
+    int v2198 = v2197 + 1;
+    int v2199 = v2198 + 1;
+    int v2200 = v2199 + 1;
+    int v2201 = v2200 + 1;
+    int v2202 = v2201 + 1;
+    int v2203 = v2202 + 1;
+    int v2204 = v2203 + 1;
+    int v2205 = v2204 + 1;
+    int v2206 = v2205 + 1;
+    int v2207 = v2206 + 1;
+    int v2208 = v2207 + 1;
+    int v2209 = v2208 + 1;
+    int v2210 = v2209 + 1;
+    int v2211 = v2210 + 1;
+    int v2212 = v2211 + 1;
+    int v2213 = v2212 + 1;
+    int v2214 = v2213 + 1;
+    int v2215 = v2214 + 1;
+    int v2216 = v2215 + 1;
+    int v2217 = v2216 + 1;
+    int v2218 = v2217 + 1;
+    int v2219 = v2218 + 1;
+    int v2220 = v2219 + 1;
+    int v2221 = v2220 + 1;
+    int v2222 = v2221 + 1;
+    int v2223 = v2222 + 1;
+    int v2224 = v2223 + 1;
+    int v2225 = v2224 + 1;
+    int v2226 = v2225 + 1;
+    int v2227 = v2226 + 1;
+    int v2228 = v2227 + 1;
+    int v2229 = v2228 + 1;
+    int v2230 = v2229 + 1;
+    int v2231 = v2230 + 1;
+    int v2232 = v2231 + 1;
+    int v2233 = v2232 + 1;
+    int v2234 = v2233 + 1;
+    int v2235 = v2234 + 1;
+    int v2236 = v2235 + 1;
+    int v2237 = v2236 + 1;
+    int v2238 = v2237 + 1;
+    int v2239 = v2238 + 1;
+    int v2240 = v2239 + 1;
+    int v2241 = v2240 + 1;
+    int v2242 = v2241 + 1;
+    int v2243 = v2242 + 1;
+    int v2244 = v2243 + 1;
+    int v2245 = v2244 + 1;
+    int v2246 = v2245 + 1;
+    int v2247 = v2246 + 1;
+    int v2248 = v2247 + 1;
+    int v2249 = v2248 + 1;
+    int v2250 = v2249 + 1;
+    int v2251 = v2250 + 1;
+    int v2252 = v2251 + 1;
+    int v2253 = v2252 + 1;
+    int v2254 = v2253 + 1;
+    int v2255 = v2254 + 1;
+    int v2256 = v2255 + 1;
+    int v2257 = v2256 + 1;
+    int v2258 = v2257 + 1;
+    int v2259 = v2258 + 1;
+    int v2260 = v2259 + 1;
+    int v2261 = v2260 + 1;
+    int v2262 = v2261 + 1;
+    int v2263 = v2262 + 1;
+    int v2264 = v2263 + 1;
+    int v2265 = v2264 + 1;
+    int v2266 = v2265 + 1;
+    int v2267 = v2266 + 1;
+    int v2268 = v2267 + 1;
+    int v2269 = v2268 + 1;
+    int v2270 = v2269 + 1;
+    int v2271 = v2270 + 1;
+    int v2272 = v2271 + 1;
+    int v2273 = v2272 + 1;
+    int v2274 = v2273 + 1;
+    int v2275 = v2274 + 1;
+    int v2276 = v2275 + 1;
+    int v2277 = v2276 + 1;
+    int v2278 = v2277 + 1;
+    int v2279 = v2278 + 1;
+    int v2280 = v2279 + 1;
+    int v2281 = v2280 + 1;
+    int v2282 = v2281 + 1;
+    int v2283 = v2282 + 1;
+    int v2284 = v2283 + 1;
+    int v2285 = v2284 + 1;
+    int v2286 = v2285 + 1;
+    int v2287 = v2286 + 1;
+    int v2288 = v2287 + 1;
+    int v2289 = v2288 + 1;
+    int v2290 = v2289 + 1;
+    int v2291 = v2290 + 1;
+    int v2292 = v2291 + 1;
+    int v2293 = v2292 + 1;
+    int v2294 = v2293 + 1;
+    int v2295 = v2294 + 1;
+    int v2296 = v2295 + 1;
+    int v2297 = v2296 + 1;
+    int v2298 = v2297 + 1;
+    int v2299 = v2298 + 1;
+    int v2300 = v2299 + 1;
+    int v2301 = v2300 + 1;
+    int v2302 = v2301 + 1;
+    int v2303 = v2302 + 1;
+    int v2304 = v2303 + 1;
+    int v2305 = v2304 + 1;
+    int v2306 = v2305 + 1;
+    int v2307 = v2306 + 1;
+    int v2308 = v2307 + 1;
+    int v2309 = v2308 + 1;
+    int v2310 = v2309 + 1;
+    int v2311 = v2310 + 1;
+    int v2312 = v2311 + 1;
+    int v2313 = v2312 + 1;
+    int v2314 = v2313 + 1;
+    int v2315 = v2314 + 1;
+    int v2316 = v2315 + 1;
+    int v2317 = v2316 + 1;
+    int v2318 = v2317 + 1;
+    int v2319 = v2318 + 1;
+    int v2320 = v2319 + 1;
+    int v2321 = v2320 + 1;
+    int v2322 = v2321 + 1;
+    int v2323 = v2322 + 1;
+    int v2324 = v2323 + 1;
+    int v2325 = v2324 + 1;
+    int v2326 = v2325 + 1;
+    int v2327 = v2326 + 1;
+    int v2328 = v2327 + 1;
+    int v2329 = v2328 + 1;
+    int v2330 = v2329 + 1;
+    int v2331 = v2330 + 1;
+    int v2332 = v2331 + 1;
+    int v2333 = v2332 + 1;
+    int v2334 = v2333 + 1;
+    int v2335 = v2334 + 1;
+    int v2336 = v2335 + 1;
+    int v2337 = v2336 + 1;
+    int v2338 = v2337 + 1;
+    int v2339 = v2338 + 1;
+    int v2340 = v2339 + 1;
+    int v2341 = v2340 + 1;
+    int v2342 = v2341 + 1;
+    int v2343 = v2342 + 1;
+    int v2344 = v2343 + 1;
+    int v2345 = v2344 + 1;
+    int v2346 = v2345 + 1;
+    int v2347 = v2346 + 1;
+    int v2348 = v2347 + 1;
+    int v2349 = v2348 + 1;
+    int v2350 = v2349 + 1;
+    int v2351 = v2350 + 1;
+    int v2352 = v2351 + 1;
+    int v2353 = v2352 + 1;
+    int v2354 = v2353 + 1;
+    int v2355 = v2354 + 1;
+    int v2356 = v2355 + 1;
+    int v2357 = v2356 + 1;
+    int v2358 = v2357 + 1;
+    int v2359 = v2358 + 1;
+    int v2360 = v2359 + 1;
+    int v2361 = v2360 + 1;
+    int v2362 = v2361 + 1;
+    int v2363 = v2362 + 1;
+    int v2364 = v2363 + 1;
+    int v2365 = v2364 + 1;
+    int v2366 = v2365 + 1;
+    int v2367 = v2366 + 1;
+    int v2368 = v2367 + 1;
+    int v2369 = v2368 + 1;
+    int v2370 = v2369 + 1;
+    int v2371 = v2370 + 1;
+    int v2372 = v2371 + 1;
+    int v2373 = v2372 + 1;
+    int v2374 = v2373 + 1;
+    int v2375 = v2374 + 1;
+    int v2376 = v2375 + 1;
+    int v2377 = v2376 + 1;
+    int v2378 = v2377 + 1;
+    int v2379 = v2378 + 1;
+    int v2380 = v2379 + 1;
+    int v2381 = v2380 + 1;
+    int v2382 = v2381 + 1;
+    int v2383 = v2382 + 1;
+    int v2384 = v2383 + 1;
+    int v2385 = v2384 + 1;
+    int v2386 = v2385 + 1;
+    int v2387 = v2386 + 1;
+    int v2388 = v2387 + 1;
+    int v2389 = v2388 + 1;
+    int v2390 = v2389 + 1;
+    int v2391 = v2390 + 1;
+    int v2392 = v2391 + 1;
+    int v2393 = v2392 + 1;
+    int v2394 = v2393 + 1;
+    int v2395 = v2394 + 1;
+    int v2396 = v2395 + 1;
+    int v2397 = v2396 + 1;
+    int v2398 = v2397 + 1;
+    int v2399 = v2398 + 1;
+    int v2400 = v2399 + 1;
+    int v2401 = v2400 + 1;
+    int v2402 = v2401 + 1;
+    int v2403 = v2402 + 1;
+    int v2404 = v2403 + 1;
+    int v2405 = v2404 + 1;
+    int v2406 = v2405 + 1;
+    int v2407 = v2406 + 1;
+    int v2408 = v2407 + 1;
+    int v2409 = v2408 + 1;
+    int v2410 = v2409 + 1;
+    int v2411 = v2410 + 1;
+    int v2412 = v2411 + 1;
+    int v2413 = v2412 + 1;
+    int v2414 = v2413 + 1;
+    int v2415 = v2414 + 1;
+    int v2416 = v2415 + 1;
+    int v2417 = v2416 + 1;
+    int v2418 = v2417 + 1;
+    int v2419 = v2418 + 1;
+    int v2420 = v2419 + 1;
+    int v2421 = v2420 + 1;
+    int v2422 = v2421 + 1;
+    int v2423 = v2422 + 1;
+    int v2424 = v2423 + 1;
+    int v2425 = v2424 + 1;
+    int v2426 = v2425 + 1;
+    int v2427 = v2426 + 1;
+    int v2428 = v2427 + 1;
+    int v2429 = v2428 + 1;
+    int v2430 = v2429 + 1;
+    int v2431 = v2430 + 1;
+    int v2432 = v2431 + 1;
+    int v2433 = v2432 + 1;
+    int v2434 = v2433 + 1;
+    int v2435 = v2434 + 1;
+    int v2436 = v2435 + 1;
+    int v2437 = v2436 + 1;
+    int v2438 = v2437 + 1;
+    int v2439 = v2438 + 1;
+    int v2440 = v2439 + 1;
+    int v2441 = v2440 + 1;
+    int v2442 = v2441 + 1;
+    int v2443 = v2442 + 1;
+    int v2444 = v2443 + 1;
+    int v2445 = v2444 + 1;
+    int v2446 = v2445 + 1;
+    int v2447 = v2446 + 1;
+    int v2448 = v2447 + 1;
+    int v2449 = v2448 + 1;
+    int v2450 = v2449 + 1;
+    int v2451 = v2450 + 1;
+    int v2452 = v2451 + 1;
+    int v2453 = v2452 + 1;
+    int v2454 = v2453 + 1;
+    int v2455 = v2454 + 1;
+    int v2456 = v2455 + 1;
+    int v2457 = v2456 + 1;
+    int v2458 = v2457 + 1;
+    int v2459 = v2458 + 1;
+    int v2460 = v2459 + 1;
+    int v2461 = v2460 + 1;
+    int v2462 = v2461 + 1;
+    int v2463 = v2462 + 1;
+    int v2464 = v2463 + 1;
+    int v2465 = v2464 + 1;
+    int v2466 = v2465 + 1;
+    int v2467 = v2466 + 1;
+    int v2468 = v2467 + 1;
+    int v2469 = v2468 + 1;
+    int v2470 = v2469 + 1;
+    int v2471 = v2470 + 1;
+    int v2472 = v2471 + 1;
+    int v2473 = v2472 + 1;
+    int v2474 = v2473 + 1;
+    int v2475 = v2474 + 1;
+    int v2476 = v2475 + 1;
+    int v2477 = v2476 + 1;
+    int v2478 = v2477 + 1;
+    int v2479 = v2478 + 1;
+    int v2480 = v2479 + 1;
+    int v2481 = v2480 + 1;
+    int v2482 = v2481 + 1;
+    int v2483 = v2482 + 1;
+    int v2484 = v2483 + 1;
+    int v2485 = v2484 + 1;
+    int v2486 = v2485 + 1;
+    int v2487 = v2486 + 1;
+    int v2488 = v2487 + 1;
+    int v2489 = v2488 + 1;
+    int v2490 = v2489 + 1;
+    int v2491 = v2490 + 1;
+    int v2492 = v2491 + 1;
+    int v2493 = v2492 + 1;
+    int v2494 = v2493 + 1;
+    int v2495 = v2494 + 1;
+    int v2496 = v2495 + 1;
+    int v2497 = v2496 + 1;
+    int v2498 = v2497 + 1;
+    int v2499 = v2498 + 1;
+    int v2500 = v2499 + 1;
+    int v2501 = v2500 + 1;
+    int v2502 = v2501 + 1;
+    int v2503 = v2502 + 1;
+    int v2504 = v2503 + 1;
+    int v2505 = v2504 + 1;
+    int v2506 = v2505 + 1;
+    int v2507 = v2506 + 1;
+    int v2508 = v2507 + 1;
+    int v2509 = v2508 + 1;
+    int v2510 = v2509 + 1;
+    int v2511 = v2510 + 1;
+    int v2512 = v2511 + 1;
+    int v2513 = v2512 + 1;
+    int v2514 = v2513 + 1;
+    int v2515 = v2514 + 1;
+    int v2516 = v2515 + 1;
+    int v2517 = v2516 + 1;
+    int v2518 = v2517 + 1;
+    int v2519 = v2518 + 1;
+    int v2520 = v2519 + 1;
+    int v2521 = v2520 + 1;
+    int v2522 = v2521 + 1;
+    int v2523 = v2522 + 1;
+    int v2524 = v2523 + 1;
+    int v2525 = v2524 + 1;
+    int v2526 = v2525 + 1;
+    int v2527 = v2526 + 1;
+    int v2528 = v2527 + 1;
+    int v2529 = v2528 + 1;
+    int v2530 = v2529 + 1;
+    int v2531 = v2530 + 1;
+    int v2532 = v2531 + 1;
+    int v2533 = v2532 + 1;
+    int v2534 = v2533 + 1;
+    int v2535 = v2534 + 1;
+    int v2536 = v2535 + 1;
+    int v2537 = v2536 + 1;
+    int v2538 = v2537 + 1;
+    int v2539 = v2538 + 1;
+    int v2540 = v2539 + 1;
+    int v2541 = v2540 + 1;
+    int v2542 = v2541 + 1;
+    int v2543 = v2542 + 1;
+    int v2544 = v2543 + 1;
+    int v2545 = v2544 + 1;
+    int v2546 = v2545 + 1;
+    int v2547 = v2546 + 1;
+    int v2548 = v2547 + 1;
+    int v2549 = v2548 + 1;
+    int v2550 = v2549 + 1;
+    int v2551 = v2550 + 1;
+    int v2552 = v2551 + 1;
+    int v2553 = v2552 + 1;
+    int v2554 = v2553 + 1;
+    int v2555 = v2554 + 1;
+    int v2556 = v2555 + 1;
+    int v2557 = v2556 + 1;
+    int v2558 = v2557 + 1;
+    int v2559 = v2558 + 1;
+    int v2560 = v2559 + 1;
+    int v2561 = v2560 + 1;
+    int v2562 = v2561 + 1;
+    int v2563 = v2562 + 1;
+    int v2564 = v2563 + 1;
+    int v2565 = v2564 + 1;
+    int v2566 = v2565 + 1;
+    int v2567 = v2566 + 1;
+    int v2568 = v2567 + 1;
+    int v2569 = v2568 + 1;
+    int v2570 = v2569 + 1;
+    int v2571 = v2570 + 1;
+    int v2572 = v2571 + 1;
+    int v2573 = v2572 + 1;
+    int v2574 = v2573 + 1;
+    int v2575 = v2574 + 1;
+    int v2576 = v2575 + 1;
+    int v2577 = v2576 + 1;
+    int v2578 = v2577 + 1;
+    int v2579 = v2578 + 1;
+    int v2580 = v2579 + 1;
+    int v2581 = v2580 + 1;
+    int v2582 = v2581 + 1;
+    int v2583 = v2582 + 1;
+    int v2584 = v2583 + 1;
+    int v2585 = v2584 + 1;
+    int v2586 = v2585 + 1;
+    int v2587 = v2586 + 1;
+    int v2588 = v2587 + 1;
+    int v2589 = v2588 + 1;
+    int v2590 = v2589 + 1;
+    int v2591 = v2590 + 1;
+    int v2592 = v2591 + 1;
+    int v2593 = v2592 + 1;
+    int v2594 = v2593 + 1;
+    int v2595 = v2594 + 1;
+    int v2596 = v2595 + 1;
+    int v2597 = v2596 + 1;
+    int v2598 = v2597 + 1;
+    int v2599 = v2598 + 1;
+    int v2600 = v2599 + 1;
+    int v2601 = v2600 + 1;
+    int v2602 = v2601 + 1;
+    int v2603 = v2602 + 1;
+    int v2604 = v2603 + 1;
+    int v2605 = v2604 + 1;
+    int v2606 = v2605 + 1;
+    int v2607 = v2606 + 1;
+    int v2608 = v2607 + 1;
+    int v2609 = v2608 + 1;
+    int v2610 = v2609 + 1;
+    int v2611 = v2610 + 1;
+    int v2612 = v2611 + 1;
+    int v2613 = v2612 + 1;
+    int v2614 = v2613 + 1;
+    int v2615 = v2614 + 1;
+    int v2616 = v2615 + 1;
+    int v2617 = v2616 + 1;
+    int v2618 = v2617 + 1;
+    int v2619 = v2618 + 1;
+    int v2620 = v2619 + 1;
+    int v2621 = v2620 + 1;
+    int v2622 = v2621 + 1;
+    int v2623 = v2622 + 1;
+    int v2624 = v2623 + 1;
+    int v2625 = v2624 + 1;
+    int v2626 = v2625 + 1;
+    int v2627 = v2626 + 1;
+    int v2628 = v2627 + 1;
+    int v2629 = v2628 + 1;
+    int v2630 = v2629 + 1;
+    int v2631 = v2630 + 1;
+    int v2632 = v2631 + 1;
+    int v2633 = v2632 + 1;
+    int v2634 = v2633 + 1;
+    int v2635 = v2634 + 1;
+    int v2636 = v2635 + 1;
+    int v2637 = v2636 + 1;
+    int v2638 = v2637 + 1;
+    int v2639 = v2638 + 1;
+    int v2640 = v2639 + 1;
+    int v2641 = v2640 + 1;
+    int v2642 = v2641 + 1;
+    int v2643 = v2642 + 1;
+    int v2644 = v2643 + 1;
+    int v2645 = v2644 + 1;
+    int v2646 = v2645 + 1;
+    int v2647 = v2646 + 1;
+    int v2648 = v2647 + 1;
+    int v2649 = v2648 + 1;
+    int v2650 = v2649 + 1;
+    int v2651 = v2650 + 1;
+    int v2652 = v2651 + 1;
+    int v2653 = v2652 + 1;
+    int v2654 = v2653 + 1;
+    int v2655 = v2654 + 1;
+    int v2656 = v2655 + 1;
+    int v2657 = v2656 + 1;
+    int v2658 = v2657 + 1;
+    int v2659 = v2658 + 1;
+    int v2660 = v2659 + 1;
+    int v2661 = v2660 + 1;
+    int v2662 = v2661 + 1;
+    int v2663 = v2662 + 1;
+    int v2664 = v2663 + 1;
+    int v2665 = v2664 + 1;
+    int v2666 = v2665 + 1;
+    int v2667 = v2666 + 1;
+    int v2668 = v2667 + 1;
+    int v2669 = v2668 + 1;
+    int v2670 = v2669 + 1;
+    int v2671 = v2670 + 1;
+    int v2672 = v2671 + 1;
+    int v2673 = v2672 + 1;
+    int v2674 = v2673 + 1;
+    int v2675 = v2674 + 1;
+    int v2676 = v2675 + 1;
+    int v2677 = v2676 + 1;
+    int v2678 = v2677 + 1;
+    int v2679 = v2678 + 1;
+    int v2680 = v2679 + 1;
+    int v2681 = v2680 + 1;
+    int v2682 = v2681 + 1;
+    int v2683 = v2682 + 1;
+    int v2684 = v2683 + 1;
+    int v2685 = v2684 + 1;
+    int v2686 = v2685 + 1;
+    int v2687 = v2686 + 1;
+    int v2688 = v2687 + 1;
+    int v2689 = v2688 + 1;
+    int v2690 = v2689 + 1;
+    int v2691 = v2690 + 1;
+    int v2692 = v2691 + 1;
+    int v2693 = v2692 + 1;
+    int v2694 = v2693 + 1;
+    int v2695 = v2694 + 1;
+    int v2696 = v2695 + 1;
+    int v2697 = v2696 + 1;
+    int v2698 = v2697 + 1;
+    int v2699 = v2698 + 1;
+    int v2700 = v2699 + 1;
+    int v2701 = v2700 + 1;
+    int v2702 = v2701 + 1;
+    int v2703 = v2702 + 1;
+    int v2704 = v2703 + 1;
+    int v2705 = v2704 + 1;
+    int v2706 = v2705 + 1;
+    int v2707 = v2706 + 1;
+    int v2708 = v2707 + 1;
+    int v2709 = v2708 + 1;
+    int v2710 = v2709 + 1;
+    int v2711 = v2710 + 1;
+    int v2712 = v2711 + 1;
+    int v2713 = v2712 + 1;
+    int v2714 = v2713 + 1;
+    int v2715 = v2714 + 1;
+    int v2716 = v2715 + 1;
+    int v2717 = v2716 + 1;
+    int v2718 = v2717 + 1;
+    int v2719 = v2718 + 1;
+    int v2720 = v2719 + 1;
+    int v2721 = v2720 + 1;
+    int v2722 = v2721 + 1;
+    int v2723 = v2722 + 1;
+    int v2724 = v2723 + 1;
+    int v2725 = v2724 + 1;
+    int v2726 = v2725 + 1;
+    int v2727 = v2726 + 1;
+    int v2728 = v2727 + 1;
+    int v2729 = v2728 + 1;
+    int v2730 = v2729 + 1;
+    int v2731 = v2730 + 1;
+    int v2732 = v2731 + 1;
+    int v2733 = v2732 + 1;
+    int v2734 = v2733 + 1;
+    int v2735 = v2734 + 1;
+    int v2736 = v2735 + 1;
+    int v2737 = v2736 + 1;
+    int v2738 = v2737 + 1;
+    int v2739 = v2738 + 1;
+    int v2740 = v2739 + 1;
+    int v2741 = v2740 + 1;
+    int v2742 = v2741 + 1;
+    int v2743 = v2742 + 1;
+    int v2744 = v2743 + 1;
+    int v2745 = v2744 + 1;
+    int v2746 = v2745 + 1;
+    int v2747 = v2746 + 1;
+    int v2748 = v2747 + 1;
+    int v2749 = v2748 + 1;
+    int v2750 = v2749 + 1;
+    int v2751 = v2750 + 1;
+    int v2752 = v2751 + 1;
+    int v2753 = v2752 + 1;
+    int v2754 = v2753 + 1;
+    int v2755 = v2754 + 1;
+    int v2756 = v2755 + 1;
+    int v2757 = v2756 + 1;
+    int v2758 = v2757 + 1;
+    int v2759 = v2758 + 1;
+    int v2760 = v2759 + 1;
+    int v2761 = v2760 + 1;
+    int v2762 = v2761 + 1;
+    int v2763 = v2762 + 1;
+    int v2764 = v2763 + 1;
+    int v2765 = v2764 + 1;
+    int v2766 = v2765 + 1;
+    int v2767 = v2766 + 1;
+    int v2768 = v2767 + 1;
+    int v2769 = v2768 + 1;
+    int v2770 = v2769 + 1;
+    int v2771 = v2770 + 1;
+    int v2772 = v2771 + 1;
+    int v2773 = v2772 + 1;
+    int v2774 = v2773 + 1;
+    int v2775 = v2774 + 1;
+    int v2776 = v2775 + 1;
+    int v2777 = v2776 + 1;
+    int v2778 = v2777 + 1;
+    int v2779 = v2778 + 1;
+    int v2780 = v2779 + 1;
+    int v2781 = v2780 + 1;
+    int v2782 = v2781 + 1;
+    int v2783 = v2782 + 1;
+    int v2784 = v2783 + 1;
+    int v2785 = v2784 + 1;
+    int v2786 = v2785 + 1;
+    int v2787 = v2786 + 1;
+    int v2788 = v2787 + 1;
+    int v2789 = v2788 + 1;
+    int v2790 = v2789 + 1;
+    int v2791 = v2790 + 1;
+    int v2792 = v2791 + 1;
+    int v2793 = v2792 + 1;
+    int v2794 = v2793 + 1;
+    int v2795 = v2794 + 1;
+    int v2796 = v2795 + 1;
+    int v2797 = v2796 + 1;
+    int v2798 = v2797 + 1;
+    int v2799 = v2798 + 1;
+    int v2800 = v2799 + 1;
+    int v2801 = v2800 + 1;
+    int v2802 = v2801 + 1;
+    int v2803 = v2802 + 1;
+    int v2804 = v2803 + 1;
+    int v2805 = v2804 + 1;
+    int v2806 = v2805 + 1;
+    int v2807 = v2806 + 1;
+    int v2808 = v2807 + 1;
+    int v2809 = v2808 + 1;
+    int v2810 = v2809 + 1;
+    int v2811 = v2810 + 1;
+    int v2812 = v2811 + 1;
+    int v2813 = v2812 + 1;
+    int v2814 = v2813 + 1;
+    int v2815 = v2814 + 1;
+    int v2816 = v2815 + 1;
+    int v2817 = v2816 + 1;
+    int v2818 = v2817 + 1;
+    int v2819 = v2818 + 1;
+    int v2820 = v2819 + 1;
+    int v2821 = v2820 + 1;
+    int v2822 = v2821 + 1;
+    int v2823 = v2822 + 1;
+    int v2824 = v2823 + 1;
+    int v2825 = v2824 + 1;
+    int v2826 = v2825 + 1;
+    int v2827 = v2826 + 1;
+    int v2828 = v2827 + 1;
+    int v2829 = v2828 + 1;
+    int v2830 = v2829 + 1;
+    int v2831 = v2830 + 1;
+    int v2832 = v2831 + 1;
+    int v2833 = v2832 + 1;
+    int v2834 = v2833 + 1;
+    int v2835 = v2834 + 1;
+    int v2836 = v2835 + 1;
+    int v2837 = v2836 + 1;
+    int v2838 = v2837 + 1;
+    int v2839 = v2838 + 1;
+    int v2840 = v2839 + 1;
+    int v2841 = v2840 + 1;
+    int v2842 = v2841 + 1;
+    int v2843 = v2842 + 1;
+    int v2844 = v2843 + 1;
+    int v2845 = v2844 + 1;
+    int v2846 = v2845 + 1;
+    int v2847 = v2846 + 1;
+    int v2848 = v2847 + 1;
+    int v2849 = v2848 + 1;
+    int v2850 = v2849 + 1;
+    int v2851 = v2850 + 1;
+    int v2852 = v2851 + 1;
+    int v2853 = v2852 + 1;
+    int v2854 = v2853 + 1;
+    int v2855 = v2854 + 1;
+    int v2856 = v2855 + 1;
+    int v2857 = v2856 + 1;
+    int v2858 = v2857 + 1;
+    int v2859 = v2858 + 1;
+    int v2860 = v2859 + 1;
+    int v2861 = v2860 + 1;
+    int v2862 = v2861 + 1;
+    int v2863 = v2862 + 1;
+    int v2864 = v2863 + 1;
+    int v2865 = v2864 + 1;
+    int v2866 = v2865 + 1;
+    int v2867 = v2866 + 1;
+    int v2868 = v2867 + 1;
+    int v2869 = v2868 + 1;
+    int v2870 = v2869 + 1;
+    int v2871 = v2870 + 1;
+    int v2872 = v2871 + 1;
+    int v2873 = v2872 + 1;
+    int v2874 = v2873 + 1;
+    int v2875 = v2874 + 1;
+    int v2876 = v2875 + 1;
+    int v2877 = v2876 + 1;
+    int v2878 = v2877 + 1;
+    int v2879 = v2878 + 1;
+    int v2880 = v2879 + 1;
+    int v2881 = v2880 + 1;
+    int v2882 = v2881 + 1;
+    int v2883 = v2882 + 1;
+    int v2884 = v2883 + 1;
+    int v2885 = v2884 + 1;
+    int v2886 = v2885 + 1;
+    int v2887 = v2886 + 1;
+    int v2888 = v2887 + 1;
+    int v2889 = v2888 + 1;
+    int v2890 = v2889 + 1;
+    int v2891 = v2890 + 1;
+    int v2892 = v2891 + 1;
+    int v2893 = v2892 + 1;
+    int v2894 = v2893 + 1;
+    int v2895 = v2894 + 1;
+    int v2896 = v2895 + 1;
+    int v2897 = v2896 + 1;
+    int v2898 = v2897 + 1;
+    int v2899 = v2898 + 1;
+    int v2900 = v2899 + 1;
+    int v2901 = v2900 + 1;
+    int v2902 = v2901 + 1;
+    int v2903 = v2902 + 1;
+    int v2904 = v2903 + 1;
+    int v2905 = v2904 + 1;
+    int v2906 = v2905 + 1;
+    int v2907 = v2906 + 1;
+    int v2908 = v2907 + 1;
+    int v2909 = v2908 + 1;
+    int v2910 = v2909 + 1;
+    int v2911 = v2910 + 1;
+    int v2912 = v2911 + 1;
+    int v2913 = v2912 + 1;
+    int v2914 = v2913 + 1;
+    int v2915 = v2914 + 1;
+    int v2916 = v2915 + 1;
+    int v2917 = v2916 + 1;
+    int v2918 = v2917 + 1;
+    int v2919 = v2918 + 1;
+    int v2920 = v2919 + 1;
+    int v2921 = v2920 + 1;
+    int v2922 = v2921 + 1;
+    int v2923 = v2922 + 1;
+    int v2924 = v2923 + 1;
+    int v2925 = v2924 + 1;
+    int v2926 = v2925 + 1;
+    int v2927 = v2926 + 1;
+    int v2928 = v2927 + 1;
+    int v2929 = v2928 + 1;
+    int v2930 = v2929 + 1;
+    int v2931 = v2930 + 1;
+    int v2932 = v2931 + 1;
+    int v2933 = v2932 + 1;
+    int v2934 = v2933 + 1;
+    int v2935 = v2934 + 1;
+    int v2936 = v2935 + 1;
+    int v2937 = v2936 + 1;
+    int v2938 = v2937 + 1;
+    int v2939 = v2938 + 1;
+    int v2940 = v2939 + 1;
+    int v2941 = v2940 + 1;
+    int v2942 = v2941 + 1;
+    int v2943 = v2942 + 1;
+    int v2944 = v2943 + 1;
+    int v2945 = v2944 + 1;
+    int v2946 = v2945 + 1;
+    int v2947 = v2946 + 1;
+    int v2948 = v2947 + 1;
+    int v2949 = v2948 + 1;
+    int v2950 = v2949 + 1;
+    int v2951 = v2950 + 1;
+    int v2952 = v2951 + 1;
+    int v2953 = v2952 + 1;
+    int v2954 = v2953 + 1;
+    int v2955 = v2954 + 1;
+    int v2956 = v2955 + 1;
+    int v2957 = v2956 + 1;
+    int v2958 = v2957 + 1;
+    int v2959 = v2958 + 1;
+    int v2960 = v2959 + 1;
+    int v2961 = v2960 + 1;
+    int v2962 = v2961 + 1;
+    int v2963 = v2962 + 1;
+    int v2964 = v2963 + 1;
+    int v2965 = v2964 + 1;
+    int v2966 = v2965 + 1;
+    int v2967 = v2966 + 1;
+    int v2968 = v2967 + 1;
+    int v2969 = v2968 + 1;
+    int v2970 = v2969 + 1;
+    int v2971 = v2970 + 1;
+    int v2972 = v2971 + 1;
+    int v2973 = v2972 + 1;
+    int v2974 = v2973 + 1;
+    int v2975 = v2974 + 1;
+    int v2976 = v2975 + 1;
+    int v2977 = v2976 + 1;
+    int v2978 = v2977 + 1;
+    int v2979 = v2978 + 1;
+    int v2980 = v2979 + 1;
+    int v2981 = v2980 + 1;
+    int v2982 = v2981 + 1;
+    int v2983 = v2982 + 1;
+    int v2984 = v2983 + 1;
+    int v2985 = v2984 + 1;
+    int v2986 = v2985 + 1;
+    int v2987 = v2986 + 1;
+    int v2988 = v2987 + 1;
+    int v2989 = v2988 + 1;
+    int v2990 = v2989 + 1;
+    int v2991 = v2990 + 1;
+    int v2992 = v2991 + 1;
+    int v2993 = v2992 + 1;
+    int v2994 = v2993 + 1;
+    int v2995 = v2994 + 1;
+    int v2996 = v2995 + 1;
+    int v2997 = v2996 + 1;
+    int v2998 = v2997 + 1;
+    int v2999 = v2998 + 1;
+    int v3000 = v2999 + 1;
+    int v3001 = v3000 + 1;
+    int v3002 = v3001 + 1;
+    int v3003 = v3002 + 1;
+    int v3004 = v3003 + 1;
+    int v3005 = v3004 + 1;
+    int v3006 = v3005 + 1;
+    int v3007 = v3006 + 1;
+    int v3008 = v3007 + 1;
+    int v3009 = v3008 + 1;
+    int v3010 = v3009 + 1;
+    int v3011 = v3010 + 1;
+    int v3012 = v3011 + 1;
+    int v3013 = v3012 + 1;
+    int v3014 = v3013 + 1;
+    int v3015 = v3014 + 1;
+    int v3016 = v3015 + 1;
+    int v3017 = v3016 + 1;
+    int v3018 = v3017 + 1;
+    int v3019 = v3018 + 1;
+    int v3020 = v3019 + 1;
+    int v3021 = v3020 + 1;
+    int v3022 = v3021 + 1;
+    int v3023 = v3022 + 1;
+    int v3024 = v3023 + 1;
+    int v3025 = v3024 + 1;
+    int v3026 = v3025 + 1;
+    int v3027 = v3026 + 1;
+    int v3028 = v3027 + 1;
+    int v3029 = v3028 + 1;
+    int v3030 = v3029 + 1;
+    int v3031 = v3030 + 1;
+    int v3032 = v3031 + 1;
+    int v3033 = v3032 + 1;
+    int v3034 = v3033 + 1;
+    int v3035 = v3034 + 1;
+    int v3036 = v3035 + 1;
+    int v3037 = v3036 + 1;
+    int v3038 = v3037 + 1;
+    int v3039 = v3038 + 1;
+    int v3040 = v3039 + 1;
+    int v3041 = v3040 + 1;
+    int v3042 = v3041 + 1;
+    int v3043 = v3042 + 1;
+    int v3044 = v3043 + 1;
+    int v3045 = v3044 + 1;
+    int v3046 = v3045 + 1;
+    int v3047 = v3046 + 1;
+    int v3048 = v3047 + 1;
+    int v3049 = v3048 + 1;
+    int v3050 = v3049 + 1;
+    int v3051 = v3050 + 1;
+    int v3052 = v3051 + 1;
+    int v3053 = v3052 + 1;
+    int v3054 = v3053 + 1;
+    int v3055 = v3054 + 1;
+    int v3056 = v3055 + 1;
+    int v3057 = v3056 + 1;
+    int v3058 = v3057 + 1;
+    int v3059 = v3058 + 1;
+    int v3060 = v3059 + 1;
+    int v3061 = v3060 + 1;
+    int v3062 = v3061 + 1;
+    int v3063 = v3062 + 1;
+    int v3064 = v3063 + 1;
+    int v3065 = v3064 + 1;
+    int v3066 = v3065 + 1;
+    int v3067 = v3066 + 1;
+    int v3068 = v3067 + 1;
+    int v3069 = v3068 + 1;
+    int v3070 = v3069 + 1;
+    int v3071 = v3070 + 1;
+    int v3072 = v3071 + 1;
+    int v3073 = v3072 + 1;
+    int v3074 = v3073 + 1;
+    int v3075 = v3074 + 1;
+    int v3076 = v3075 + 1;
+    int v3077 = v3076 + 1;
+    int v3078 = v3077 + 1;
+    int v3079 = v3078 + 1;
+    int v3080 = v3079 + 1;
+    int v3081 = v3080 + 1;
+    int v3082 = v3081 + 1;
+    int v3083 = v3082 + 1;
+    int v3084 = v3083 + 1;
+    int v3085 = v3084 + 1;
+    int v3086 = v3085 + 1;
+    int v3087 = v3086 + 1;
+    int v3088 = v3087 + 1;
+    int v3089 = v3088 + 1;
+    int v3090 = v3089 + 1;
+    int v3091 = v3090 + 1;
+    int v3092 = v3091 + 1;
+    int v3093 = v3092 + 1;
+    int v3094 = v3093 + 1;
+    int v3095 = v3094 + 1;
+    int v3096 = v3095 + 1;
+    int v3097 = v3096 + 1;
+    int v3098 = v3097 + 1;
+    int v3099 = v3098 + 1;
+    int v3100 = v3099 + 1;
+    int v3101 = v3100 + 1;
+    int v3102 = v3101 + 1;
+    int v3103 = v3102 + 1;
+    int v3104 = v3103 + 1;
+    int v3105 = v3104 + 1;
+    int v3106 = v3105 + 1;
+    int v3107 = v3106 + 1;
+    int v3108 = v3107 + 1;
+    int v3109 = v3108 + 1;
+    int v3110 = v3109 + 1;
+    int v3111 = v3110 + 1;
+    int v3112 = v3111 + 1;
+    int v3113 = v3112 + 1;
+    int v3114 = v3113 + 1;
+    int v3115 = v3114 + 1;
+    int v3116 = v3115 + 1;
+    int v3117 = v3116 + 1;
+    int v3118 = v3117 + 1;
+    int v3119 = v3118 + 1;
+    int v3120 = v3119 + 1;
+    int v3121 = v3120 + 1;
+    int v3122 = v3121 + 1;
+    int v3123 = v3122 + 1;
+    int v3124 = v3123 + 1;
+    int v3125 = v3124 + 1;
+    int v3126 = v3125 + 1;
+    int v3127 = v3126 + 1;
+    int v3128 = v3127 + 1;
+    int v3129 = v3128 + 1;
+    int v3130 = v3129 + 1;
+    int v3131 = v3130 + 1;
+    int v3132 = v3131 + 1;
+    int v3133 = v3132 + 1;
+    int v3134 = v3133 + 1;
+    int v3135 = v3134 + 1;
+    int v3136 = v3135 + 1;
+    int v3137 = v3136 + 1;
+    int v3138 = v3137 + 1;
+    int v3139 = v3138 + 1;
+    int v3140 = v3139 + 1;
+    int v3141 = v3140 + 1;
+    int v3142 = v3141 + 1;
+    int v3143 = v3142 + 1;
+    int v3144 = v3143 + 1;
+    int v3145 = v3144 + 1;
+    int v3146 = v3145 + 1;
+    int v3147 = v3146 + 1;
+    int v3148 = v3147 + 1;
+    int v3149 = v3148 + 1;
+    int v3150 = v3149 + 1;
+    int v3151 = v3150 + 1;
+    int v3152 = v3151 + 1;
+    int v3153 = v3152 + 1;
+    int v3154 = v3153 + 1;
+    int v3155 = v3154 + 1;
+    int v3156 = v3155 + 1;
+    int v3157 = v3156 + 1;
+    int v3158 = v3157 + 1;
+    int v3159 = v3158 + 1;
+    int v3160 = v3159 + 1;
+    int v3161 = v3160 + 1;
+    int v3162 = v3161 + 1;
+    int v3163 = v3162 + 1;
+    int v3164 = v3163 + 1;
+    int v3165 = v3164 + 1;
+    int v3166 = v3165 + 1;
+    int v3167 = v3166 + 1;
+    int v3168 = v3167 + 1;
+    int v3169 = v3168 + 1;
+    int v3170 = v3169 + 1;
+    int v3171 = v3170 + 1;
+    int v3172 = v3171 + 1;
+    int v3173 = v3172 + 1;
+    int v3174 = v3173 + 1;
+    int v3175 = v3174 + 1;
+    int v3176 = v3175 + 1;
+    int v3177 = v3176 + 1;
+    int v3178 = v3177 + 1;
+    int v3179 = v3178 + 1;
+    int v3180 = v3179 + 1;
+    int v3181 = v3180 + 1;
+    int v3182 = v3181 + 1;
+    int v3183 = v3182 + 1;
+    int v3184 = v3183 + 1;
+    int v3185 = v3184 + 1;
+    int v3186 = v3185 + 1;
+    int v3187 = v3186 + 1;
+    int v3188 = v3187 + 1;
+    int v3189 = v3188 + 1;
+    int v3190 = v3189 + 1;
+    int v3191 = v3190 + 1;
+    int v3192 = v3191 + 1;
+    int v3193 = v3192 + 1;
+    int v3194 = v3193 + 1;
+    int v3195 = v3194 + 1;
+    int v3196 = v3195 + 1;
+    int v3197 = v3196 + 1;
+    int v3198 = v3197 + 1;
+    int v3199 = v3198 + 1;
+    int v3200 = v3199 + 1;
+    int v3201 = v3200 + 1;
+    int v3202 = v3201 + 1;
+    int v3203 = v3202 + 1;
+    int v3204 = v3203 + 1;
+    int v3205 = v3204 + 1;
+    int v3206 = v3205 + 1;
+    int v3207 = v3206 + 1;
+    int v3208 = v3207 + 1;
+    int v3209 = v3208 + 1;
+    int v3210 = v3209 + 1;
+    int v3211 = v3210 + 1;
+    int v3212 = v3211 + 1;
+    int v3213 = v3212 + 1;
+    int v3214 = v3213 + 1;
+    int v3215 = v3214 + 1;
+    int v3216 = v3215 + 1;
+    int v3217 = v3216 + 1;
+    int v3218 = v3217 + 1;
+    int v3219 = v3218 + 1;
+    int v3220 = v3219 + 1;
+    int v3221 = v3220 + 1;
+    int v3222 = v3221 + 1;
+    int v3223 = v3222 + 1;
+    int v3224 = v3223 + 1;
+    int v3225 = v3224 + 1;
+    int v3226 = v3225 + 1;
+    int v3227 = v3226 + 1;
+    int v3228 = v3227 + 1;
+    int v3229 = v3228 + 1;
+    int v3230 = v3229 + 1;
+    int v3231 = v3230 + 1;
+    int v3232 = v3231 + 1;
+    int v3233 = v3232 + 1;
+    int v3234 = v3233 + 1;
+    int v3235 = v3234 + 1;
+    int v3236 = v3235 + 1;
+    int v3237 = v3236 + 1;
+    int v3238 = v3237 + 1;
+    int v3239 = v3238 + 1;
+    int v3240 = v3239 + 1;
+    int v3241 = v3240 + 1;
+    int v3242 = v3241 + 1;
+    int v3243 = v3242 + 1;
+    int v3244 = v3243 + 1;
+    int v3245 = v3244 + 1;
+    int v3246 = v3245 + 1;
+    int v3247 = v3246 + 1;
+    int v3248 = v3247 + 1;
+    int v3249 = v3248 + 1;
+    int v3250 = v3249 + 1;
+    int v3251 = v3250 + 1;
+    int v3252 = v3251 + 1;
+    int v3253 = v3252 + 1;
+    int v3254 = v3253 + 1;
+    int v3255 = v3254 + 1;
+    int v3256 = v3255 + 1;
+    int v3257 = v3256 + 1;
+    int v3258 = v3257 + 1;
+    int v3259 = v3258 + 1;
+    int v3260 = v3259 + 1;
+    int v3261 = v3260 + 1;
+    int v3262 = v3261 + 1;
+    int v3263 = v3262 + 1;
+    int v3264 = v3263 + 1;
+    int v3265 = v3264 + 1;
+    int v3266 = v3265 + 1;
+    int v3267 = v3266 + 1;
+    int v3268 = v3267 + 1;
+    int v3269 = v3268 + 1;
+    int v3270 = v3269 + 1;
+    int v3271 = v3270 + 1;
+    int v3272 = v3271 + 1;
+    int v3273 = v3272 + 1;
+    int v3274 = v3273 + 1;
+    int v3275 = v3274 + 1;
+    int v3276 = v3275 + 1;
+    int v3277 = v3276 + 1;
+    int v3278 = v3277 + 1;
+    int v3279 = v3278 + 1;
+    int v3280 = v3279 + 1;
+    int v3281 = v3280 + 1;
+    int v3282 = v3281 + 1;
+    int v3283 = v3282 + 1;
+    int v3284 = v3283 + 1;
+    int v3285 = v3284 + 1;
+    int v3286 = v3285 + 1;
+    int v3287 = v3286 + 1;
+    int v3288 = v3287 + 1;
+    int v3289 = v3288 + 1;
+    int v3290 = v3289 + 1;
+    int v3291 = v3290 + 1;
+    int v3292 = v3291 + 1;
+    int v3293 = v3292 + 1;
+    int v3294 = v3293 + 1;
+    int v3295 = v3294 + 1;
+    int v3296 = v3295 + 1;
+    int v3297 = v3296 + 1;
+    int v3298 = v3297 + 1;
+    int v3299 = v3298 + 1;
+    int v3300 = v3299 + 1;
+    int v3301 = v3300 + 1;
+    int v3302 = v3301 + 1;
+    int v3303 = v3302 + 1;
+    int v3304 = v3303 + 1;
+    int v3305 = v3304 + 1;
+    int v3306 = v3305 + 1;
+    int v3307 = v3306 + 1;
+    int v3308 = v3307 + 1;
+    int v3309 = v3308 + 1;
+    int v3310 = v3309 + 1;
+    int v3311 = v3310 + 1;
+    int v3312 = v3311 + 1;
+    int v3313 = v3312 + 1;
+    int v3314 = v3313 + 1;
+    int v3315 = v3314 + 1;
+    int v3316 = v3315 + 1;
+    int v3317 = v3316 + 1;
+    int v3318 = v3317 + 1;
+    int v3319 = v3318 + 1;
+    int v3320 = v3319 + 1;
+    int v3321 = v3320 + 1;
+    int v3322 = v3321 + 1;
+    int v3323 = v3322 + 1;
+    int v3324 = v3323 + 1;
+    int v3325 = v3324 + 1;
+    int v3326 = v3325 + 1;
+    int v3327 = v3326 + 1;
+    int v3328 = v3327 + 1;
+    int v3329 = v3328 + 1;
+    int v3330 = v3329 + 1;
+    int v3331 = v3330 + 1;
+    int v3332 = v3331 + 1;
+    int v3333 = v3332 + 1;
+    int v3334 = v3333 + 1;
+    int v3335 = v3334 + 1;
+    int v3336 = v3335 + 1;
+    int v3337 = v3336 + 1;
+    int v3338 = v3337 + 1;
+    int v3339 = v3338 + 1;
+    int v3340 = v3339 + 1;
+    int v3341 = v3340 + 1;
+    int v3342 = v3341 + 1;
+    int v3343 = v3342 + 1;
+    int v3344 = v3343 + 1;
+    int v3345 = v3344 + 1;
+    int v3346 = v3345 + 1;
+    int v3347 = v3346 + 1;
+    int v3348 = v3347 + 1;
+    int v3349 = v3348 + 1;
+    int v3350 = v3349 + 1;
+    int v3351 = v3350 + 1;
+    int v3352 = v3351 + 1;
+    int v3353 = v3352 + 1;
+    int v3354 = v3353 + 1;
+    int v3355 = v3354 + 1;
+    int v3356 = v3355 + 1;
+    int v3357 = v3356 + 1;
+    int v3358 = v3357 + 1;
+    int v3359 = v3358 + 1;
+    int v3360 = v3359 + 1;
+    int v3361 = v3360 + 1;
+    int v3362 = v3361 + 1;
+    int v3363 = v3362 + 1;
+    int v3364 = v3363 + 1;
+    int v3365 = v3364 + 1;
+    int v3366 = v3365 + 1;
+    int v3367 = v3366 + 1;
+    int v3368 = v3367 + 1;
+    int v3369 = v3368 + 1;
+    int v3370 = v3369 + 1;
+    int v3371 = v3370 + 1;
+    int v3372 = v3371 + 1;
+    int v3373 = v3372 + 1;
+    int v3374 = v3373 + 1;
+    int v3375 = v3374 + 1;
+    int v3376 = v3375 + 1;
+    int v3377 = v3376 + 1;
+    int v3378 = v3377 + 1;
+    int v3379 = v3378 + 1;
+    int v3380 = v3379 + 1;
+    int v3381 = v3380 + 1;
+    int v3382 = v3381 + 1;
+    int v3383 = v3382 + 1;
+    int v3384 = v3383 + 1;
+    int v3385 = v3384 + 1;
+    int v3386 = v3385 + 1;
+    int v3387 = v3386 + 1;
+    int v3388 = v3387 + 1;
+    int v3389 = v3388 + 1;
+    int v3390 = v3389 + 1;
+    int v3391 = v3390 + 1;
+    int v3392 = v3391 + 1;
+    int v3393 = v3392 + 1;
+    int v3394 = v3393 + 1;
+    int v3395 = v3394 + 1;
+    int v3396 = v3395 + 1;
+    int v3397 = v3396 + 1;
+    int v3398 = v3397 + 1;
+    int v3399 = v3398 + 1;
+    int v3400 = v3399 + 1;
+    int v3401 = v3400 + 1;
+    int v3402 = v3401 + 1;
+    int v3403 = v3402 + 1;
+    int v3404 = v3403 + 1;
+    int v3405 = v3404 + 1;
+    int v3406 = v3405 + 1;
+    int v3407 = v3406 + 1;
+    int v3408 = v3407 + 1;
+    int v3409 = v3408 + 1;
+    int v3410 = v3409 + 1;
+    int v3411 = v3410 + 1;
+    int v3412 = v3411 + 1;
+    int v3413 = v3412 + 1;
+    int v3414 = v3413 + 1;
+    int v3415 = v3414 + 1;
+    int v3416 = v3415 + 1;
+    int v3417 = v3416 + 1;
+    int v3418 = v3417 + 1;
+    int v3419 = v3418 + 1;
+    int v3420 = v3419 + 1;
+    int v3421 = v3420 + 1;
+    int v3422 = v3421 + 1;
+    int v3423 = v3422 + 1;
+    int v3424 = v3423 + 1;
+    int v3425 = v3424 + 1;
+    int v3426 = v3425 + 1;
+    int v3427 = v3426 + 1;
+    int v3428 = v3427 + 1;
+    int v3429 = v3428 + 1;
+    int v3430 = v3429 + 1;
+    int v3431 = v3430 + 1;
+    int v3432 = v3431 + 1;
+    int v3433 = v3432 + 1;
+    int v3434 = v3433 + 1;
+    int v3435 = v3434 + 1;
+    int v3436 = v3435 + 1;
+    int v3437 = v3436 + 1;
+    int v3438 = v3437 + 1;
+    int v3439 = v3438 + 1;
+    int v3440 = v3439 + 1;
+    int v3441 = v3440 + 1;
+    int v3442 = v3441 + 1;
+    int v3443 = v3442 + 1;
+    int v3444 = v3443 + 1;
+    int v3445 = v3444 + 1;
+    int v3446 = v3445 + 1;
+    int v3447 = v3446 + 1;
+    int v3448 = v3447 + 1;
+    int v3449 = v3448 + 1;
+    int v3450 = v3449 + 1;
+    int v3451 = v3450 + 1;
+    int v3452 = v3451 + 1;
+    int v3453 = v3452 + 1;
+    int v3454 = v3453 + 1;
+    int v3455 = v3454 + 1;
+    int v3456 = v3455 + 1;
+    int v3457 = v3456 + 1;
+    int v3458 = v3457 + 1;
+    int v3459 = v3458 + 1;
+    int v3460 = v3459 + 1;
+    int v3461 = v3460 + 1;
+    int v3462 = v3461 + 1;
+    int v3463 = v3462 + 1;
+    int v3464 = v3463 + 1;
+    int v3465 = v3464 + 1;
+    int v3466 = v3465 + 1;
+    int v3467 = v3466 + 1;
+    int v3468 = v3467 + 1;
+    int v3469 = v3468 + 1;
+    int v3470 = v3469 + 1;
+    int v3471 = v3470 + 1;
+    int v3472 = v3471 + 1;
+    int v3473 = v3472 + 1;
+    int v3474 = v3473 + 1;
+    int v3475 = v3474 + 1;
+    int v3476 = v3475 + 1;
+    int v3477 = v3476 + 1;
+    int v3478 = v3477 + 1;
+    int v3479 = v3478 + 1;
+    int v3480 = v3479 + 1;
+    int v3481 = v3480 + 1;
+    int v3482 = v3481 + 1;
+    int v3483 = v3482 + 1;
+    int v3484 = v3483 + 1;
+    int v3485 = v3484 + 1;
+    int v3486 = v3485 + 1;
+    int v3487 = v3486 + 1;
+    int v3488 = v3487 + 1;
+    int v3489 = v3488 + 1;
+    int v3490 = v3489 + 1;
+    int v3491 = v3490 + 1;
+    int v3492 = v3491 + 1;
+    int v3493 = v3492 + 1;
+    int v3494 = v3493 + 1;
+    int v3495 = v3494 + 1;
+    int v3496 = v3495 + 1;
+    int v3497 = v3496 + 1;
+    int v3498 = v3497 + 1;
+    int v3499 = v3498 + 1;
+    int v3500 = v3499 + 1;
+    int v3501 = v3500 + 1;
+    int v3502 = v3501 + 1;
+    int v3503 = v3502 + 1;
+    int v3504 = v3503 + 1;
+    int v3505 = v3504 + 1;
+    int v3506 = v3505 + 1;
+    int v3507 = v3506 + 1;
+    int v3508 = v3507 + 1;
+    int v3509 = v3508 + 1;
+    int v3510 = v3509 + 1;
+    int v3511 = v3510 + 1;
+    int v3512 = v3511 + 1;
+    int v3513 = v3512 + 1;
+    int v3514 = v3513 + 1;
+    int v3515 = v3514 + 1;
+    int v3516 = v3515 + 1;
+    int v3517 = v3516 + 1;
+    int v3518 = v3517 + 1;
+    int v3519 = v3518 + 1;
+    int v3520 = v3519 + 1;
+    int v3521 = v3520 + 1;
+    int v3522 = v3521 + 1;
+    int v3523 = v3522 + 1;
+    int v3524 = v3523 + 1;
+    int v3525 = v3524 + 1;
+    int v3526 = v3525 + 1;
+    int v3527 = v3526 + 1;
+    int v3528 = v3527 + 1;
+    int v3529 = v3528 + 1;
+    int v3530 = v3529 + 1;
+    int v3531 = v3530 + 1;
+    int v3532 = v3531 + 1;
+    int v3533 = v3532 + 1;
+    int v3534 = v3533 + 1;
+    int v3535 = v3534 + 1;
+    int v3536 = v3535 + 1;
+    int v3537 = v3536 + 1;
+    int v3538 = v3537 + 1;
+    int v3539 = v3538 + 1;
+    int v3540 = v3539 + 1;
+    int v3541 = v3540 + 1;
+    int v3542 = v3541 + 1;
+    int v3543 = v3542 + 1;
+    int v3544 = v3543 + 1;
+    int v3545 = v3544 + 1;
+    int v3546 = v3545 + 1;
+    int v3547 = v3546 + 1;
+    int v3548 = v3547 + 1;
+    int v3549 = v3548 + 1;
+    int v3550 = v3549 + 1;
+    int v3551 = v3550 + 1;
+    int v3552 = v3551 + 1;
+    int v3553 = v3552 + 1;
+    int v3554 = v3553 + 1;
+    int v3555 = v3554 + 1;
+    int v3556 = v3555 + 1;
+    int v3557 = v3556 + 1;
+    int v3558 = v3557 + 1;
+    int v3559 = v3558 + 1;
+    int v3560 = v3559 + 1;
+    int v3561 = v3560 + 1;
+    int v3562 = v3561 + 1;
+    int v3563 = v3562 + 1;
+    int v3564 = v3563 + 1;
+    int v3565 = v3564 + 1;
+    int v3566 = v3565 + 1;
+    int v3567 = v3566 + 1;
+    int v3568 = v3567 + 1;
+    int v3569 = v3568 + 1;
+    int v3570 = v3569 + 1;
+    int v3571 = v3570 + 1;
+    int v3572 = v3571 + 1;
+    int v3573 = v3572 + 1;
+    int v3574 = v3573 + 1;
+    int v3575 = v3574 + 1;
+    int v3576 = v3575 + 1;
+    int v3577 = v3576 + 1;
+    int v3578 = v3577 + 1;
+    int v3579 = v3578 + 1;
+    int v3580 = v3579 + 1;
+    int v3581 = v3580 + 1;
+    int v3582 = v3581 + 1;
+    int v3583 = v3582 + 1;
+    int v3584 = v3583 + 1;
+    int v3585 = v3584 + 1;
+    int v3586 = v3585 + 1;
+    int v3587 = v3586 + 1;
+    int v3588 = v3587 + 1;
+    int v3589 = v3588 + 1;
+    int v3590 = v3589 + 1;
+    int v3591 = v3590 + 1;
+    int v3592 = v3591 + 1;
+    int v3593 = v3592 + 1;
+    int v3594 = v3593 + 1;
+    int v3595 = v3594 + 1;
+    int v3596 = v3595 + 1;
+    int v3597 = v3596 + 1;
+    int v3598 = v3597 + 1;
+    int v3599 = v3598 + 1;
+    int v3600 = v3599 + 1;
+    int v3601 = v3600 + 1;
+    int v3602 = v3601 + 1;
+    int v3603 = v3602 + 1;
+    int v3604 = v3603 + 1;
+    int v3605 = v3604 + 1;
+    int v3606 = v3605 + 1;
+    int v3607 = v3606 + 1;
+    int v3608 = v3607 + 1;
+    int v3609 = v3608 + 1;
+    int v3610 = v3609 + 1;
+    int v3611 = v3610 + 1;
+    int v3612 = v3611 + 1;
+    int v3613 = v3612 + 1;
+    int v3614 = v3613 + 1;
+    int v3615 = v3614 + 1;
+    int v3616 = v3615 + 1;
+    int v3617 = v3616 + 1;
+    int v3618 = v3617 + 1;
+    int v3619 = v3618 + 1;
+    int v3620 = v3619 + 1;
+    int v3621 = v3620 + 1;
+    int v3622 = v3621 + 1;
+    int v3623 = v3622 + 1;
+    int v3624 = v3623 + 1;
+    int v3625 = v3624 + 1;
+    int v3626 = v3625 + 1;
+    int v3627 = v3626 + 1;
+    int v3628 = v3627 + 1;
+    int v3629 = v3628 + 1;
+    int v3630 = v3629 + 1;
+    int v3631 = v3630 + 1;
+    int v3632 = v3631 + 1;
+    int v3633 = v3632 + 1;
+    int v3634 = v3633 + 1;
+    int v3635 = v3634 + 1;
+    int v3636 = v3635 + 1;
+    int v3637 = v3636 + 1;
+    int v3638 = v3637 + 1;
+    int v3639 = v3638 + 1;
+    int v3640 = v3639 + 1;
+    int v3641 = v3640 + 1;
+    int v3642 = v3641 + 1;
+    int v3643 = v3642 + 1;
+    int v3644 = v3643 + 1;
+    int v3645 = v3644 + 1;
+    int v3646 = v3645 + 1;
+    int v3647 = v3646 + 1;
+    int v3648 = v3647 + 1;
+    int v3649 = v3648 + 1;
+    int v3650 = v3649 + 1;
+    int v3651 = v3650 + 1;
+    int v3652 = v3651 + 1;
+    int v3653 = v3652 + 1;
+    int v3654 = v3653 + 1;
+    int v3655 = v3654 + 1;
+    int v3656 = v3655 + 1;
+    int v3657 = v3656 + 1;
+    int v3658 = v3657 + 1;
+    int v3659 = v3658 + 1;
+    int v3660 = v3659 + 1;
+    int v3661 = v3660 + 1;
+    int v3662 = v3661 + 1;
+    int v3663 = v3662 + 1;
+    int v3664 = v3663 + 1;
+    int v3665 = v3664 + 1;
+    int v3666 = v3665 + 1;
+    int v3667 = v3666 + 1;
+    int v3668 = v3667 + 1;
+    int v3669 = v3668 + 1;
+    int v3670 = v3669 + 1;
+    int v3671 = v3670 + 1;
+    int v3672 = v3671 + 1;
+    int v3673 = v3672 + 1;
+    int v3674 = v3673 + 1;
+    int v3675 = v3674 + 1;
+    int v3676 = v3675 + 1;
+    int v3677 = v3676 + 1;
+    int v3678 = v3677 + 1;
+    int v3679 = v3678 + 1;
+    int v3680 = v3679 + 1;
+    int v3681 = v3680 + 1;
+    int v3682 = v3681 + 1;
+    int v3683 = v3682 + 1;
+    int v3684 = v3683 + 1;
+    int v3685 = v3684 + 1;
+    int v3686 = v3685 + 1;
+    int v3687 = v3686 + 1;
+    int v3688 = v3687 + 1;
+    int v3689 = v3688 + 1;
+    int v3690 = v3689 + 1;
+    int v3691 = v3690 + 1;
+    int v3692 = v3691 + 1;
+    int v3693 = v3692 + 1;
+    int v3694 = v3693 + 1;
+    int v3695 = v3694 + 1;
+    int v3696 = v3695 + 1;
+    int v3697 = v3696 + 1;
+    int v3698 = v3697 + 1;
+    int v3699 = v3698 + 1;
+    int v3700 = v3699 + 1;
+    int v3701 = v3700 + 1;
+    int v3702 = v3701 + 1;
+    int v3703 = v3702 + 1;
+    int v3704 = v3703 + 1;
+    int v3705 = v3704 + 1;
+    int v3706 = v3705 + 1;
+    int v3707 = v3706 + 1;
+    int v3708 = v3707 + 1;
+    int v3709 = v3708 + 1;
+    int v3710 = v3709 + 1;
+    int v3711 = v3710 + 1;
+    int v3712 = v3711 + 1;
+    int v3713 = v3712 + 1;
+    int v3714 = v3713 + 1;
+    int v3715 = v3714 + 1;
+    int v3716 = v3715 + 1;
+    int v3717 = v3716 + 1;
+    int v3718 = v3717 + 1;
+    int v3719 = v3718 + 1;
+    int v3720 = v3719 + 1;
+    int v3721 = v3720 + 1;
+    int v3722 = v3721 + 1;
+    int v3723 = v3722 + 1;
+    int v3724 = v3723 + 1;
+    int v3725 = v3724 + 1;
+    int v3726 = v3725 + 1;
+    int v3727 = v3726 + 1;
+    int v3728 = v3727 + 1;
+    int v3729 = v3728 + 1;
+    int v3730 = v3729 + 1;
+    int v3731 = v3730 + 1;
+    int v3732 = v3731 + 1;
+    int v3733 = v3732 + 1;
+    int v3734 = v3733 + 1;
+    int v3735 = v3734 + 1;
+    int v3736 = v3735 + 1;
+    int v3737 = v3736 + 1;
+    int v3738 = v3737 + 1;
+    int v3739 = v3738 + 1;
+    int v3740 = v3739 + 1;
+    int v3741 = v3740 + 1;
+    int v3742 = v3741 + 1;
+    int v3743 = v3742 + 1;
+    int v3744 = v3743 + 1;
+    int v3745 = v3744 + 1;
+    int v3746 = v3745 + 1;
+    int v3747 = v3746 + 1;
+    int v3748 = v3747 + 1;
+    int v3749 = v3748 + 1;
+    int v3750 = v3749 + 1;
+    int v3751 = v3750 + 1;
+    int v3752 = v3751 + 1;
+    int v3753 = v3752 + 1;
+    int v3754 = v3753 + 1;
+    int v3755 = v3754 + 1;
+    int v3756 = v3755 + 1;
+    int v3757 = v3756 + 1;
+    int v3758 = v3757 + 1;
+    int v3759 = v3758 + 1;
+    int v3760 = v3759 + 1;
+    int v3761 = v3760 + 1;
+    int v3762 = v3761 + 1;
+    int v3763 = v3762 + 1;
+    int v3764 = v3763 + 1;
+    int v3765 = v3764 + 1;
+    int v3766 = v3765 + 1;
+    int v3767 = v3766 + 1;
+    int v3768 = v3767 + 1;
+    int v3769 = v3768 + 1;
+    int v3770 = v3769 + 1;
+    int v3771 = v3770 + 1;
+    int v3772 = v3771 + 1;
+    int v3773 = v3772 + 1;
+    int v3774 = v3773 + 1;
+    int v3775 = v3774 + 1;
+    int v3776 = v3775 + 1;
+    int v3777 = v3776 + 1;
+    int v3778 = v3777 + 1;
+    int v3779 = v3778 + 1;
+    int v3780 = v3779 + 1;
+    int v3781 = v3780 + 1;
+    int v3782 = v3781 + 1;
+    int v3783 = v3782 + 1;
+    int v3784 = v3783 + 1;
+    int v3785 = v3784 + 1;
+    int v3786 = v3785 + 1;
+    int v3787 = v3786 + 1;
+    int v3788 = v3787 + 1;
+    int v3789 = v3788 + 1;
+    int v3790 = v3789 + 1;
+    int v3791 = v3790 + 1;
+    int v3792 = v3791 + 1;
+    int v3793 = v3792 + 1;
+    int v3794 = v3793 + 1;
+    int v3795 = v3794 + 1;
+    int v3796 = v3795 + 1;
+    int v3797 = v3796 + 1;
+    int v3798 = v3797 + 1;
+    int v3799 = v3798 + 1;
+    int v3800 = v3799 + 1;
+    int v3801 = v3800 + 1;
+    int v3802 = v3801 + 1;
+    int v3803 = v3802 + 1;
+    int v3804 = v3803 + 1;
+    int v3805 = v3804 + 1;
+    int v3806 = v3805 + 1;
+    int v3807 = v3806 + 1;
+    int v3808 = v3807 + 1;
+    int v3809 = v3808 + 1;
+    int v3810 = v3809 + 1;
+    int v3811 = v3810 + 1;
+    int v3812 = v3811 + 1;
+    int v3813 = v3812 + 1;
+    int v3814 = v3813 + 1;
+    int v3815 = v3814 + 1;
+    int v3816 = v3815 + 1;
+    int v3817 = v3816 + 1;
+    int v3818 = v3817 + 1;
+    int v3819 = v3818 + 1;
+    int v3820 = v3819 + 1;
+    int v3821 = v3820 + 1;
+    int v3822 = v3821 + 1;
+    int v3823 = v3822 + 1;
+    int v3824 = v3823 + 1;
+    int v3825 = v3824 + 1;
+    int v3826 = v3825 + 1;
+    int v3827 = v3826 + 1;
+    int v3828 = v3827 + 1;
+    int v3829 = v3828 + 1;
+    int v3830 = v3829 + 1;
+    int v3831 = v3830 + 1;
+    int v3832 = v3831 + 1;
+    int v3833 = v3832 + 1;
+    int v3834 = v3833 + 1;
+    int v3835 = v3834 + 1;
+    int v3836 = v3835 + 1;
+    int v3837 = v3836 + 1;
+    int v3838 = v3837 + 1;
+    int v3839 = v3838 + 1;
+    int v3840 = v3839 + 1;
+    int v3841 = v3840 + 1;
+    int v3842 = v3841 + 1;
+    int v3843 = v3842 + 1;
+    int v3844 = v3843 + 1;
+    int v3845 = v3844 + 1;
+    int v3846 = v3845 + 1;
+    int v3847 = v3846 + 1;
+    int v3848 = v3847 + 1;
+    int v3849 = v3848 + 1;
+    int v3850 = v3849 + 1;
+    int v3851 = v3850 + 1;
+    int v3852 = v3851 + 1;
+    int v3853 = v3852 + 1;
+    int v3854 = v3853 + 1;
+    int v3855 = v3854 + 1;
+    int v3856 = v3855 + 1;
+    int v3857 = v3856 + 1;
+    int v3858 = v3857 + 1;
+    int v3859 = v3858 + 1;
+    int v3860 = v3859 + 1;
+    int v3861 = v3860 + 1;
+    int v3862 = v3861 + 1;
+    int v3863 = v3862 + 1;
+    int v3864 = v3863 + 1;
+    int v3865 = v3864 + 1;
+    int v3866 = v3865 + 1;
+    int v3867 = v3866 + 1;
+    int v3868 = v3867 + 1;
+    int v3869 = v3868 + 1;
+    int v3870 = v3869 + 1;
+    int v3871 = v3870 + 1;
+    int v3872 = v3871 + 1;
+    int v3873 = v3872 + 1;
+    int v3874 = v3873 + 1;
+    int v3875 = v3874 + 1;
+    int v3876 = v3875 + 1;
+    int v3877 = v3876 + 1;
+    int v3878 = v3877 + 1;
+    int v3879 = v3878 + 1;
+    int v3880 = v3879 + 1;
+    int v3881 = v3880 + 1;
+    int v3882 = v3881 + 1;
+    int v3883 = v3882 + 1;
+    int v3884 = v3883 + 1;
+    int v3885 = v3884 + 1;
+    int v3886 = v3885 + 1;
+    int v3887 = v3886 + 1;
+    int v3888 = v3887 + 1;
+    int v3889 = v3888 + 1;
+    int v3890 = v3889 + 1;
+    int v3891 = v3890 + 1;
+    int v3892 = v3891 + 1;
+    int v3893 = v3892 + 1;
+    int v3894 = v3893 + 1;
+    int v3895 = v3894 + 1;
+    int v3896 = v3895 + 1;
+    int v3897 = v3896 + 1;
+    int v3898 = v3897 + 1;
+    int v3899 = v3898 + 1;
+    int v3900 = v3899 + 1;
+    int v3901 = v3900 + 1;
+    int v3902 = v3901 + 1;
+    int v3903 = v3902 + 1;
+    int v3904 = v3903 + 1;
+    int v3905 = v3904 + 1;
+    int v3906 = v3905 + 1;
+    int v3907 = v3906 + 1;
+    int v3908 = v3907 + 1;
+    int v3909 = v3908 + 1;
+    int v3910 = v3909 + 1;
+    int v3911 = v3910 + 1;
+    int v3912 = v3911 + 1;
+    int v3913 = v3912 + 1;
+    int v3914 = v3913 + 1;
+    int v3915 = v3914 + 1;
+    int v3916 = v3915 + 1;
+    int v3917 = v3916 + 1;
+    int v3918 = v3917 + 1;
+    int v3919 = v3918 + 1;
+    int v3920 = v3919 + 1;
+    int v3921 = v3920 + 1;
+    int v3922 = v3921 + 1;
+    int v3923 = v3922 + 1;
+    int v3924 = v3923 + 1;
+    int v3925 = v3924 + 1;
+    int v3926 = v3925 + 1;
+    int v3927 = v3926 + 1;
+    int v3928 = v3927 + 1;
+    int v3929 = v3928 + 1;
+    int v3930 = v3929 + 1;
+    int v3931 = v3930 + 1;
+    int v3932 = v3931 + 1;
+    int v3933 = v3932 + 1;
+    int v3934 = v3933 + 1;
+    int v3935 = v3934 + 1;
+    int v3936 = v3935 + 1;
+    int v3937 = v3936 + 1;
+    int v3938 = v3937 + 1;
+    int v3939 = v3938 + 1;
+    int v3940 = v3939 + 1;
+    int v3941 = v3940 + 1;
+    int v3942 = v3941 + 1;
+    int v3943 = v3942 + 1;
+    int v3944 = v3943 + 1;
+    int v3945 = v3944 + 1;
+    int v3946 = v3945 + 1;
+    int v3947 = v3946 + 1;
+    int v3948 = v3947 + 1;
+    int v3949 = v3948 + 1;
+    int v3950 = v3949 + 1;
+    int v3951 = v3950 + 1;
+    int v3952 = v3951 + 1;
+    int v3953 = v3952 + 1;
+    int v3954 = v3953 + 1;
+    int v3955 = v3954 + 1;
+    int v3956 = v3955 + 1;
+    int v3957 = v3956 + 1;
+    int v3958 = v3957 + 1;
+    int v3959 = v3958 + 1;
+    int v3960 = v3959 + 1;
+    int v3961 = v3960 + 1;
+    int v3962 = v3961 + 1;
+    int v3963 = v3962 + 1;
+    int v3964 = v3963 + 1;
+    int v3965 = v3964 + 1;
+    int v3966 = v3965 + 1;
+    int v3967 = v3966 + 1;
+    int v3968 = v3967 + 1;
+    int v3969 = v3968 + 1;
+    int v3970 = v3969 + 1;
+    int v3971 = v3970 + 1;
+    int v3972 = v3971 + 1;
+    int v3973 = v3972 + 1;
+    int v3974 = v3973 + 1;
+    int v3975 = v3974 + 1;
+    int v3976 = v3975 + 1;
+    int v3977 = v3976 + 1;
+    int v3978 = v3977 + 1;
+    int v3979 = v3978 + 1;
+    int v3980 = v3979 + 1;
+    int v3981 = v3980 + 1;
+    int v3982 = v3981 + 1;
+    int v3983 = v3982 + 1;
+    int v3984 = v3983 + 1;
+    int v3985 = v3984 + 1;
+    int v3986 = v3985 + 1;
+    int v3987 = v3986 + 1;
+    int v3988 = v3987 + 1;
+    int v3989 = v3988 + 1;
+    int v3990 = v3989 + 1;
+    int v3991 = v3990 + 1;
+    int v3992 = v3991 + 1;
+    int v3993 = v3992 + 1;
+    int v3994 = v3993 + 1;
+    int v3995 = v3994 + 1;
+    int v3996 = v3995 + 1;
+    int v3997 = v3996 + 1;
+    int v3998 = v3997 + 1;
+    int v3999 = v3998 + 1;
+    int v4000 = v3999 + 1;
+    int v4001 = v4000 + 1;
+    int v4002 = v4001 + 1;
+    int v4003 = v4002 + 1;
+    int v4004 = v4003 + 1;
+    int v4005 = v4004 + 1;
+    int v4006 = v4005 + 1;
+    int v4007 = v4006 + 1;
+    int v4008 = v4007 + 1;
+    int v4009 = v4008 + 1;
+    int v4010 = v4009 + 1;
+    int v4011 = v4010 + 1;
+    int v4012 = v4011 + 1;
+    int v4013 = v4012 + 1;
+    int v4014 = v4013 + 1;
+    int v4015 = v4014 + 1;
+    int v4016 = v4015 + 1;
+    int v4017 = v4016 + 1;
+    int v4018 = v4017 + 1;
+    int v4019 = v4018 + 1;
+    int v4020 = v4019 + 1;
+    int v4021 = v4020 + 1;
+    int v4022 = v4021 + 1;
+    int v4023 = v4022 + 1;
+    int v4024 = v4023 + 1;
+    int v4025 = v4024 + 1;
+    int v4026 = v4025 + 1;
+    int v4027 = v4026 + 1;
+    int v4028 = v4027 + 1;
+    int v4029 = v4028 + 1;
+    int v4030 = v4029 + 1;
+    int v4031 = v4030 + 1;
+    int v4032 = v4031 + 1;
+    int v4033 = v4032 + 1;
+    int v4034 = v4033 + 1;
+    int v4035 = v4034 + 1;
+    int v4036 = v4035 + 1;
+    int v4037 = v4036 + 1;
+    int v4038 = v4037 + 1;
+    int v4039 = v4038 + 1;
+    int v4040 = v4039 + 1;
+    int v4041 = v4040 + 1;
+    int v4042 = v4041 + 1;
+    int v4043 = v4042 + 1;
+    int v4044 = v4043 + 1;
+    int v4045 = v4044 + 1;
+    int v4046 = v4045 + 1;
+    int v4047 = v4046 + 1;
+    int v4048 = v4047 + 1;
+    int v4049 = v4048 + 1;
+    int v4050 = v4049 + 1;
+    int v4051 = v4050 + 1;
+    int v4052 = v4051 + 1;
+    int v4053 = v4052 + 1;
+    int v4054 = v4053 + 1;
+    int v4055 = v4054 + 1;
+    int v4056 = v4055 + 1;
+    int v4057 = v4056 + 1;
+    int v4058 = v4057 + 1;
+    int v4059 = v4058 + 1;
+    int v4060 = v4059 + 1;
+    int v4061 = v4060 + 1;
+    int v4062 = v4061 + 1;
+    int v4063 = v4062 + 1;
+    int v4064 = v4063 + 1;
+    int v4065 = v4064 + 1;
+    int v4066 = v4065 + 1;
+    int v4067 = v4066 + 1;
+    int v4068 = v4067 + 1;
+    int v4069 = v4068 + 1;
+    int v4070 = v4069 + 1;
+    int v4071 = v4070 + 1;
+    int v4072 = v4071 + 1;
+    int v4073 = v4072 + 1;
+    int v4074 = v4073 + 1;
+    int v4075 = v4074 + 1;
+    int v4076 = v4075 + 1;
+    int v4077 = v4076 + 1;
+    int v4078 = v4077 + 1;
+    int v4079 = v4078 + 1;
+    int v4080 = v4079 + 1;
+    int v4081 = v4080 + 1;
+    int v4082 = v4081 + 1;
+    int v4083 = v4082 + 1;
+    int v4084 = v4083 + 1;
+    int v4085 = v4084 + 1;
+    int v4086 = v4085 + 1;
+    int v4087 = v4086 + 1;
+    int v4088 = v4087 + 1;
+    int v4089 = v4088 + 1;
+    int v4090 = v4089 + 1;
+    int v4091 = v4090 + 1;
+    int v4092 = v4091 + 1;
+    int v4093 = v4092 + 1;
+    int v4094 = v4093 + 1;
+    int v4095 = v4094 + 1;
+    int v4096 = v4095 + 1;
+    int v4097 = v4096 + 1;
+    int v4098 = v4097 + 1;
+    int v4099 = v4098 + 1;
+    int v4100 = v4099 + 1;
+    int v4101 = v4100 + 1;
+    int v4102 = v4101 + 1;
+    int v4103 = v4102 + 1;
+    int v4104 = v4103 + 1;
+    int v4105 = v4104 + 1;
+    int v4106 = v4105 + 1;
+    int v4107 = v4106 + 1;
+    int v4108 = v4107 + 1;
+    int v4109 = v4108 + 1;
+    int v4110 = v4109 + 1;
+    int v4111 = v4110 + 1;
+    int v4112 = v4111 + 1;
+    int v4113 = v4112 + 1;
+    int v4114 = v4113 + 1;
+    int v4115 = v4114 + 1;
+    int v4116 = v4115 + 1;
+    int v4117 = v4116 + 1;
+    int v4118 = v4117 + 1;
+    int v4119 = v4118 + 1;
+    int v4120 = v4119 + 1;
+    int v4121 = v4120 + 1;
+    int v4122 = v4121 + 1;
+    int v4123 = v4122 + 1;
+    int v4124 = v4123 + 1;
+    int v4125 = v4124 + 1;
+    int v4126 = v4125 + 1;
+    int v4127 = v4126 + 1;
+    int v4128 = v4127 + 1;
+    int v4129 = v4128 + 1;
+    int v4130 = v4129 + 1;
+    int v4131 = v4130 + 1;
+    int v4132 = v4131 + 1;
+    int v4133 = v4132 + 1;
+    int v4134 = v4133 + 1;
+    int v4135 = v4134 + 1;
+    int v4136 = v4135 + 1;
+    int v4137 = v4136 + 1;
+    int v4138 = v4137 + 1;
+    int v4139 = v4138 + 1;
+    int v4140 = v4139 + 1;
+    int v4141 = v4140 + 1;
+    int v4142 = v4141 + 1;
+    int v4143 = v4142 + 1;
+    int v4144 = v4143 + 1;
+    int v4145 = v4144 + 1;
+    int v4146 = v4145 + 1;
+    int v4147 = v4146 + 1;
+    int v4148 = v4147 + 1;
+    int v4149 = v4148 + 1;
+    int v4150 = v4149 + 1;
+    int v4151 = v4150 + 1;
+    int v4152 = v4151 + 1;
+    int v4153 = v4152 + 1;
+    int v4154 = v4153 + 1;
+    int v4155 = v4154 + 1;
+    int v4156 = v4155 + 1;
+    int v4157 = v4156 + 1;
+    int v4158 = v4157 + 1;
+    int v4159 = v4158 + 1;
+    int v4160 = v4159 + 1;
+    int v4161 = v4160 + 1;
+    int v4162 = v4161 + 1;
+    int v4163 = v4162 + 1;
+    int v4164 = v4163 + 1;
+    int v4165 = v4164 + 1;
+    int v4166 = v4165 + 1;
+    int v4167 = v4166 + 1;
+    int v4168 = v4167 + 1;
+    int v4169 = v4168 + 1;
+    int v4170 = v4169 + 1;
+    int v4171 = v4170 + 1;
+    int v4172 = v4171 + 1;
+    int v4173 = v4172 + 1;
+    int v4174 = v4173 + 1;
+    int v4175 = v4174 + 1;
+    int v4176 = v4175 + 1;
+    int v4177 = v4176 + 1;
+    int v4178 = v4177 + 1;
+    int v4179 = v4178 + 1;
+    int v4180 = v4179 + 1;
+    int v4181 = v4180 + 1;
+    int v4182 = v4181 + 1;
+    int v4183 = v4182 + 1;
+    int v4184 = v4183 + 1;
+    int v4185 = v4184 + 1;
+    int v4186 = v4185 + 1;
+    int v4187 = v4186 + 1;
+    int v4188 = v4187 + 1;
+    int v4189 = v4188 + 1;
+    int v4190 = v4189 + 1;
+    int v4191 = v4190 + 1;
+    int v4192 = v4191 + 1;
+    int v4193 = v4192 + 1;
+    int v4194 = v4193 + 1;
+    int v4195 = v4194 + 1;
+    int v4196 = v4195 + 1;
+    int v4197 = v4196 + 1;
+    int v4198 = v4197 + 1;
+    int v4199 = v4198 + 1;
+    int v4200 = v4199 + 1;
+    int v4201 = v4200 + 1;
+    int v4202 = v4201 + 1;
+    int v4203 = v4202 + 1;
+    int v4204 = v4203 + 1;
+    int v4205 = v4204 + 1;
+    int v4206 = v4205 + 1;
+    int v4207 = v4206 + 1;
+    int v4208 = v4207 + 1;
+    int v4209 = v4208 + 1;
+    int v4210 = v4209 + 1;
+    int v4211 = v4210 + 1;
+    int v4212 = v4211 + 1;
+    int v4213 = v4212 + 1;
+    int v4214 = v4213 + 1;
+    int v4215 = v4214 + 1;
+    int v4216 = v4215 + 1;
+    int v4217 = v4216 + 1;
+    int v4218 = v4217 + 1;
+    int v4219 = v4218 + 1;
+    int v4220 = v4219 + 1;
+    int v4221 = v4220 + 1;
+    int v4222 = v4221 + 1;
+    int v4223 = v4222 + 1;
+    int v4224 = v4223 + 1;
+    int v4225 = v4224 + 1;
+    int v4226 = v4225 + 1;
+    int v4227 = v4226 + 1;
+    int v4228 = v4227 + 1;
+    int v4229 = v4228 + 1;
+    int v4230 = v4229 + 1;
+    int v4231 = v4230 + 1;
+    int v4232 = v4231 + 1;
+    int v4233 = v4232 + 1;
+    int v4234 = v4233 + 1;
+    int v4235 = v4234 + 1;
+    int v4236 = v4235 + 1;
+    int v4237 = v4236 + 1;
+    int v4238 = v4237 + 1;
+    int v4239 = v4238 + 1;
+    int v4240 = v4239 + 1;
+    int v4241 = v4240 + 1;
+    int v4242 = v4241 + 1;
+    int v4243 = v4242 + 1;
+    int v4244 = v4243 + 1;
+    int v4245 = v4244 + 1;
+    int v4246 = v4245 + 1;
+    int v4247 = v4246 + 1;
+    int v4248 = v4247 + 1;
+    int v4249 = v4248 + 1;
+    int v4250 = v4249 + 1;
+    int v4251 = v4250 + 1;
+    int v4252 = v4251 + 1;
+    int v4253 = v4252 + 1;
+    int v4254 = v4253 + 1;
+    int v4255 = v4254 + 1;
+    int v4256 = v4255 + 1;
+    int v4257 = v4256 + 1;
+    int v4258 = v4257 + 1;
+    int v4259 = v4258 + 1;
+    int v4260 = v4259 + 1;
+    int v4261 = v4260 + 1;
+    int v4262 = v4261 + 1;
+    int v4263 = v4262 + 1;
+    int v4264 = v4263 + 1;
+    int v4265 = v4264 + 1;
+    int v4266 = v4265 + 1;
+    int v4267 = v4266 + 1;
+    int v4268 = v4267 + 1;
+    int v4269 = v4268 + 1;
+    int v4270 = v4269 + 1;
+    int v4271 = v4270 + 1;
+    int v4272 = v4271 + 1;
+    int v4273 = v4272 + 1;
+    int v4274 = v4273 + 1;
+    int v4275 = v4274 + 1;
+    int v4276 = v4275 + 1;
+    int v4277 = v4276 + 1;
+    int v4278 = v4277 + 1;
+    int v4279 = v4278 + 1;
+    int v4280 = v4279 + 1;
+    int v4281 = v4280 + 1;
+    int v4282 = v4281 + 1;
+    int v4283 = v4282 + 1;
+    int v4284 = v4283 + 1;
+    int v4285 = v4284 + 1;
+    int v4286 = v4285 + 1;
+    int v4287 = v4286 + 1;
+    int v4288 = v4287 + 1;
+    int v4289 = v4288 + 1;
+    int v4290 = v4289 + 1;
+    int v4291 = v4290 + 1;
+    int v4292 = v4291 + 1;
+    int v4293 = v4292 + 1;
+    int v4294 = v4293 + 1;
+    int v4295 = v4294 + 1;
+    int v4296 = v4295 + 1;
+    int v4297 = v4296 + 1;
+    int v4298 = v4297 + 1;
+    int v4299 = v4298 + 1;
+    int v4300 = v4299 + 1;
+    int v4301 = v4300 + 1;
+    int v4302 = v4301 + 1;
+    int v4303 = v4302 + 1;
+    int v4304 = v4303 + 1;
+    int v4305 = v4304 + 1;
+    int v4306 = v4305 + 1;
+    int v4307 = v4306 + 1;
+    int v4308 = v4307 + 1;
+    int v4309 = v4308 + 1;
+    int v4310 = v4309 + 1;
+    int v4311 = v4310 + 1;
+    int v4312 = v4311 + 1;
+    int v4313 = v4312 + 1;
+    int v4314 = v4313 + 1;
+    int v4315 = v4314 + 1;
+    int v4316 = v4315 + 1;
+    int v4317 = v4316 + 1;
+    int v4318 = v4317 + 1;
+    int v4319 = v4318 + 1;
+    int v4320 = v4319 + 1;
+    int v4321 = v4320 + 1;
+    int v4322 = v4321 + 1;
+    int v4323 = v4322 + 1;
+    int v4324 = v4323 + 1;
+    int v4325 = v4324 + 1;
+    int v4326 = v4325 + 1;
+    int v4327 = v4326 + 1;
+    int v4328 = v4327 + 1;
+    int v4329 = v4328 + 1;
+    int v4330 = v4329 + 1;
+    int v4331 = v4330 + 1;
+    int v4332 = v4331 + 1;
+    int v4333 = v4332 + 1;
+    int v4334 = v4333 + 1;
+    int v4335 = v4334 + 1;
+    int v4336 = v4335 + 1;
+    int v4337 = v4336 + 1;
+    int v4338 = v4337 + 1;
+    int v4339 = v4338 + 1;
+    int v4340 = v4339 + 1;
+    int v4341 = v4340 + 1;
+    int v4342 = v4341 + 1;
+    int v4343 = v4342 + 1;
+    int v4344 = v4343 + 1;
+    int v4345 = v4344 + 1;
+    int v4346 = v4345 + 1;
+    int v4347 = v4346 + 1;
+    int v4348 = v4347 + 1;
+    int v4349 = v4348 + 1;
+    int v4350 = v4349 + 1;
+    int v4351 = v4350 + 1;
+    int v4352 = v4351 + 1;
+    int v4353 = v4352 + 1;
+    int v4354 = v4353 + 1;
+    int v4355 = v4354 + 1;
+    int v4356 = v4355 + 1;
+    int v4357 = v4356 + 1;
+    int v4358 = v4357 + 1;
+    int v4359 = v4358 + 1;
+    int v4360 = v4359 + 1;
+    int v4361 = v4360 + 1;
+    int v4362 = v4361 + 1;
+    int v4363 = v4362 + 1;
+    int v4364 = v4363 + 1;
+    int v4365 = v4364 + 1;
+    int v4366 = v4365 + 1;
+    int v4367 = v4366 + 1;
+    int v4368 = v4367 + 1;
+    int v4369 = v4368 + 1;
+    int v4370 = v4369 + 1;
+    int v4371 = v4370 + 1;
+    int v4372 = v4371 + 1;
+    int v4373 = v4372 + 1;
+    int v4374 = v4373 + 1;
+    int v4375 = v4374 + 1;
+    int v4376 = v4375 + 1;
+    int v4377 = v4376 + 1;
+    int v4378 = v4377 + 1;
+    int v4379 = v4378 + 1;
+    int v4380 = v4379 + 1;
+    int v4381 = v4380 + 1;
+    int v4382 = v4381 + 1;
+    int v4383 = v4382 + 1;
+    int v4384 = v4383 + 1;
+    int v4385 = v4384 + 1;
+    int v4386 = v4385 + 1;
+    int v4387 = v4386 + 1;
+    int v4388 = v4387 + 1;
+    int v4389 = v4388 + 1;
+    int v4390 = v4389 + 1;
+    int v4391 = v4390 + 1;
+    int v4392 = v4391 + 1;
+    int v4393 = v4392 + 1;
+    int v4394 = v4393 + 1;
+    int v4395 = v4394 + 1;
+    int v4396 = v4395 + 1;
+    int v4397 = v4396 + 1;
+    int v4398 = v4397 + 1;
+    int v4399 = v4398 + 1;
+    int v4400 = v4399 + 1;
+    int v4401 = v4400 + 1;
+    int v4402 = v4401 + 1;
+    int v4403 = v4402 + 1;
+    int v4404 = v4403 + 1;
+    int v4405 = v4404 + 1;
+    int v4406 = v4405 + 1;
+    int v4407 = v4406 + 1;
+    int v4408 = v4407 + 1;
+    int v4409 = v4408 + 1;
+    int v4410 = v4409 + 1;
+    int v4411 = v4410 + 1;
+    int v4412 = v4411 + 1;
+    int v4413 = v4412 + 1;
+    int v4414 = v4413 + 1;
+    int v4415 = v4414 + 1;
+    int v4416 = v4415 + 1;
+    int v4417 = v4416 + 1;
+    int v4418 = v4417 + 1;
+    int v4419 = v4418 + 1;
+    int v4420 = v4419 + 1;
+    int v4421 = v4420 + 1;
+    int v4422 = v4421 + 1;
+    int v4423 = v4422 + 1;
+    int v4424 = v4423 + 1;
+    int v4425 = v4424 + 1;
+    int v4426 = v4425 + 1;
+    int v4427 = v4426 + 1;
+    int v4428 = v4427 + 1;
+    int v4429 = v4428 + 1;
+    int v4430 = v4429 + 1;
+    int v4431 = v4430 + 1;
+    int v4432 = v4431 + 1;
+    int v4433 = v4432 + 1;
+    int v4434 = v4433 + 1;
+    int v4435 = v4434 + 1;
+    int v4436 = v4435 + 1;
+    int v4437 = v4436 + 1;
+    int v4438 = v4437 + 1;
+    int v4439 = v4438 + 1;
+    int v4440 = v4439 + 1;
+    int v4441 = v4440 + 1;
+    int v4442 = v4441 + 1;
+    int v4443 = v4442 + 1;
+    int v4444 = v4443 + 1;
+    int v4445 = v4444 + 1;
+    int v4446 = v4445 + 1;
+    int v4447 = v4446 + 1;
+    int v4448 = v4447 + 1;
+    int v4449 = v4448 + 1;
+    int v4450 = v4449 + 1;
+    int v4451 = v4450 + 1;
+    int v4452 = v4451 + 1;
+    int v4453 = v4452 + 1;
+    int v4454 = v4453 + 1;
+    int v4455 = v4454 + 1;
+    int v4456 = v4455 + 1;
+    int v4457 = v4456 + 1;
+    int v4458 = v4457 + 1;
+    int v4459 = v4458 + 1;
+    int v4460 = v4459 + 1;
+    int v4461 = v4460 + 1;
+    int v4462 = v4461 + 1;
+    int v4463 = v4462 + 1;
+    int v4464 = v4463 + 1;
+    int v4465 = v4464 + 1;
+    int v4466 = v4465 + 1;
+    int v4467 = v4466 + 1;
+    int v4468 = v4467 + 1;
+    int v4469 = v4468 + 1;
+    int v4470 = v4469 + 1;
+    int v4471 = v4470 + 1;
+    int v4472 = v4471 + 1;
+    int v4473 = v4472 + 1;
+    int v4474 = v4473 + 1;
+    int v4475 = v4474 + 1;
+    int v4476 = v4475 + 1;
+    int v4477 = v4476 + 1;
+    int v4478 = v4477 + 1;
+    int v4479 = v4478 + 1;
+    int v4480 = v4479 + 1;
+    int v4481 = v4480 + 1;
+    int v4482 = v4481 + 1;
+    int v4483 = v4482 + 1;
+    int v4484 = v4483 + 1;
+    int v4485 = v4484 + 1;
+    int v4486 = v4485 + 1;
+    int v4487 = v4486 + 1;
+    int v4488 = v4487 + 1;
+    int v4489 = v4488 + 1;
+    int v4490 = v4489 + 1;
+    int v4491 = v4490 + 1;
+    int v4492 = v4491 + 1;
+    int v4493 = v4492 + 1;
+    int v4494 = v4493 + 1;
+    int v4495 = v4494 + 1;
+    int v4496 = v4495 + 1;
+    int v4497 = v4496 + 1;
+    int v4498 = v4497 + 1;
+    int v4499 = v4498 + 1;
+    int v4500 = v4499 + 1;
+    int v4501 = v4500 + 1;
+    int v4502 = v4501 + 1;
+    int v4503 = v4502 + 1;
+    int v4504 = v4503 + 1;
+    int v4505 = v4504 + 1;
+    int v4506 = v4505 + 1;
+    int v4507 = v4506 + 1;
+    int v4508 = v4507 + 1;
+    int v4509 = v4508 + 1;
+    int v4510 = v4509 + 1;
+    int v4511 = v4510 + 1;
+    int v4512 = v4511 + 1;
+    int v4513 = v4512 + 1;
+    int v4514 = v4513 + 1;
+    int v4515 = v4514 + 1;
+    int v4516 = v4515 + 1;
+    int v4517 = v4516 + 1;
+    int v4518 = v4517 + 1;
+    int v4519 = v4518 + 1;
+    int v4520 = v4519 + 1;
+    int v4521 = v4520 + 1;
+    int v4522 = v4521 + 1;
+    int v4523 = v4522 + 1;
+    int v4524 = v4523 + 1;
+    int v4525 = v4524 + 1;
+    int v4526 = v4525 + 1;
+    int v4527 = v4526 + 1;
+    int v4528 = v4527 + 1;
+    int v4529 = v4528 + 1;
+    int v4530 = v4529 + 1;
+    int v4531 = v4530 + 1;
+    int v4532 = v4531 + 1;
+    int v4533 = v4532 + 1;
+    int v4534 = v4533 + 1;
+    int v4535 = v4534 + 1;
+    int v4536 = v4535 + 1;
+    int v4537 = v4536 + 1;
+    int v4538 = v4537 + 1;
+    int v4539 = v4538 + 1;
+    int v4540 = v4539 + 1;
+    int v4541 = v4540 + 1;
+    int v4542 = v4541 + 1;
+    int v4543 = v4542 + 1;
+    int v4544 = v4543 + 1;
+    int v4545 = v4544 + 1;
+    int v4546 = v4545 + 1;
+    int v4547 = v4546 + 1;
+    int v4548 = v4547 + 1;
+    int v4549 = v4548 + 1;
+    int v4550 = v4549 + 1;
+    int v4551 = v4550 + 1;
+    int v4552 = v4551 + 1;
+    int v4553 = v4552 + 1;
+    int v4554 = v4553 + 1;
+    int v4555 = v4554 + 1;
+    int v4556 = v4555 + 1;
+    int v4557 = v4556 + 1;
+    int v4558 = v4557 + 1;
+    int v4559 = v4558 + 1;
+    int v4560 = v4559 + 1;
+    int v4561 = v4560 + 1;
+    int v4562 = v4561 + 1;
+    int v4563 = v4562 + 1;
+    int v4564 = v4563 + 1;
+    int v4565 = v4564 + 1;
+    int v4566 = v4565 + 1;
+    int v4567 = v4566 + 1;
+    int v4568 = v4567 + 1;
+    int v4569 = v4568 + 1;
+    int v4570 = v4569 + 1;
+    int v4571 = v4570 + 1;
+    int v4572 = v4571 + 1;
+    int v4573 = v4572 + 1;
+    int v4574 = v4573 + 1;
+    int v4575 = v4574 + 1;
+    int v4576 = v4575 + 1;
+    int v4577 = v4576 + 1;
+    int v4578 = v4577 + 1;
+    int v4579 = v4578 + 1;
+    int v4580 = v4579 + 1;
+    int v4581 = v4580 + 1;
+    int v4582 = v4581 + 1;
+    int v4583 = v4582 + 1;
+    int v4584 = v4583 + 1;
+    int v4585 = v4584 + 1;
+    int v4586 = v4585 + 1;
+    int v4587 = v4586 + 1;
+    int v4588 = v4587 + 1;
+    int v4589 = v4588 + 1;
+    int v4590 = v4589 + 1;
+    int v4591 = v4590 + 1;
+    int v4592 = v4591 + 1;
+    int v4593 = v4592 + 1;
+    int v4594 = v4593 + 1;
+    int v4595 = v4594 + 1;
+    int v4596 = v4595 + 1;
+    int v4597 = v4596 + 1;
+    int v4598 = v4597 + 1;
+    int v4599 = v4598 + 1;
+    int v4600 = v4599 + 1;
+    int v4601 = v4600 + 1;
+    int v4602 = v4601 + 1;
+    int v4603 = v4602 + 1;
+    int v4604 = v4603 + 1;
+    int v4605 = v4604 + 1;
+    int v4606 = v4605 + 1;
+    int v4607 = v4606 + 1;
+    int v4608 = v4607 + 1;
+    int v4609 = v4608 + 1;
+    int v4610 = v4609 + 1;
+    int v4611 = v4610 + 1;
+    int v4612 = v4611 + 1;
+    int v4613 = v4612 + 1;
+    int v4614 = v4613 + 1;
+    int v4615 = v4614 + 1;
+    int v4616 = v4615 + 1;
+    int v4617 = v4616 + 1;
+    int v4618 = v4617 + 1;
+    int v4619 = v4618 + 1;
+    int v4620 = v4619 + 1;
+    int v4621 = v4620 + 1;
+    int v4622 = v4621 + 1;
+    int v4623 = v4622 + 1;
+    int v4624 = v4623 + 1;
+    int v4625 = v4624 + 1;
+    int v4626 = v4625 + 1;
+    int v4627 = v4626 + 1;
+    int v4628 = v4627 + 1;
+    int v4629 = v4628 + 1;
+    int v4630 = v4629 + 1;
+    int v4631 = v4630 + 1;
+    int v4632 = v4631 + 1;
+    int v4633 = v4632 + 1;
+    int v4634 = v4633 + 1;
+    int v4635 = v4634 + 1;
+    int v4636 = v4635 + 1;
+    int v4637 = v4636 + 1;
+    int v4638 = v4637 + 1;
+    int v4639 = v4638 + 1;
+    int v4640 = v4639 + 1;
+    int v4641 = v4640 + 1;
+    int v4642 = v4641 + 1;
+    int v4643 = v4642 + 1;
+    int v4644 = v4643 + 1;
+    int v4645 = v4644 + 1;
+    int v4646 = v4645 + 1;
+    int v4647 = v4646 + 1;
+    int v4648 = v4647 + 1;
+    int v4649 = v4648 + 1;
+    int v4650 = v4649 + 1;
+    int v4651 = v4650 + 1;
+    int v4652 = v4651 + 1;
+    int v4653 = v4652 + 1;
+    int v4654 = v4653 + 1;
+    int v4655 = v4654 + 1;
+    int v4656 = v4655 + 1;
+    int v4657 = v4656 + 1;
+    int v4658 = v4657 + 1;
+    int v4659 = v4658 + 1;
+    int v4660 = v4659 + 1;
+    int v4661 = v4660 + 1;
+    int v4662 = v4661 + 1;
+    int v4663 = v4662 + 1;
+    int v4664 = v4663 + 1;
+    int v4665 = v4664 + 1;
+    int v4666 = v4665 + 1;
+    int v4667 = v4666 + 1;
+    int v4668 = v4667 + 1;
+    int v4669 = v4668 + 1;
+    int v4670 = v4669 + 1;
+    int v4671 = v4670 + 1;
+    int v4672 = v4671 + 1;
+    int v4673 = v4672 + 1;
+    int v4674 = v4673 + 1;
+    int v4675 = v4674 + 1;
+    int v4676 = v4675 + 1;
+    int v4677 = v4676 + 1;
+    int v4678 = v4677 + 1;
+    int v4679 = v4678 + 1;
+    int v4680 = v4679 + 1;
+    int v4681 = v4680 + 1;
+    int v4682 = v4681 + 1;
+    int v4683 = v4682 + 1;
+    int v4684 = v4683 + 1;
+    int v4685 = v4684 + 1;
+    int v4686 = v4685 + 1;
+    int v4687 = v4686 + 1;
+    int v4688 = v4687 + 1;
+    int v4689 = v4688 + 1;
+    int v4690 = v4689 + 1;
+    int v4691 = v4690 + 1;
+    int v4692 = v4691 + 1;
+    int v4693 = v4692 + 1;
+    int v4694 = v4693 + 1;
+    int v4695 = v4694 + 1;
+    int v4696 = v4695 + 1;
+    int v4697 = v4696 + 1;
+    int v4698 = v4697 + 1;
+    int v4699 = v4698 + 1;
+    int v4700 = v4699 + 1;
+    int v4701 = v4700 + 1;
+    int v4702 = v4701 + 1;
+    int v4703 = v4702 + 1;
+    int v4704 = v4703 + 1;
+    int v4705 = v4704 + 1;
+    int v4706 = v4705 + 1;
+    int v4707 = v4706 + 1;
+    int v4708 = v4707 + 1;
+    int v4709 = v4708 + 1;
+    int v4710 = v4709 + 1;
+    int v4711 = v4710 + 1;
+    int v4712 = v4711 + 1;
+    int v4713 = v4712 + 1;
+    int v4714 = v4713 + 1;
+    int v4715 = v4714 + 1;
+    int v4716 = v4715 + 1;
+    int v4717 = v4716 + 1;
+    int v4718 = v4717 + 1;
+    int v4719 = v4718 + 1;
+    int v4720 = v4719 + 1;
+    int v4721 = v4720 + 1;
+    int v4722 = v4721 + 1;
+    int v4723 = v4722 + 1;
+    int v4724 = v4723 + 1;
+    int v4725 = v4724 + 1;
+    int v4726 = v4725 + 1;
+    int v4727 = v4726 + 1;
+    int v4728 = v4727 + 1;
+    int v4729 = v4728 + 1;
+    int v4730 = v4729 + 1;
+    int v4731 = v4730 + 1;
+    int v4732 = v4731 + 1;
+    int v4733 = v4732 + 1;
+    int v4734 = v4733 + 1;
+    int v4735 = v4734 + 1;
+    int v4736 = v4735 + 1;
+    int v4737 = v4736 + 1;
+    int v4738 = v4737 + 1;
+    int v4739 = v4738 + 1;
+    int v4740 = v4739 + 1;
+    int v4741 = v4740 + 1;
+    int v4742 = v4741 + 1;
+    int v4743 = v4742 + 1;
+    int v4744 = v4743 + 1;
+    int v4745 = v4744 + 1;
+    int v4746 = v4745 + 1;
+    int v4747 = v4746 + 1;
+    int v4748 = v4747 + 1;
+    int v4749 = v4748 + 1;
+    int v4750 = v4749 + 1;
+    int v4751 = v4750 + 1;
+    int v4752 = v4751 + 1;
+    int v4753 = v4752 + 1;
+    int v4754 = v4753 + 1;
+    int v4755 = v4754 + 1;
+    int v4756 = v4755 + 1;
+    int v4757 = v4756 + 1;
+    int v4758 = v4757 + 1;
+    int v4759 = v4758 + 1;
+    int v4760 = v4759 + 1;
+    int v4761 = v4760 + 1;
+    int v4762 = v4761 + 1;
+    int v4763 = v4762 + 1;
+    int v4764 = v4763 + 1;
+    int v4765 = v4764 + 1;
+    int v4766 = v4765 + 1;
+    int v4767 = v4766 + 1;
+    int v4768 = v4767 + 1;
+    int v4769 = v4768 + 1;
+    int v4770 = v4769 + 1;
+    int v4771 = v4770 + 1;
+    int v4772 = v4771 + 1;
+    int v4773 = v4772 + 1;
+    int v4774 = v4773 + 1;
+    int v4775 = v4774 + 1;
+    int v4776 = v4775 + 1;
+    int v4777 = v4776 + 1;
+    int v4778 = v4777 + 1;
+    int v4779 = v4778 + 1;
+    int v4780 = v4779 + 1;
+    int v4781 = v4780 + 1;
+    int v4782 = v4781 + 1;
+    int v4783 = v4782 + 1;
+    int v4784 = v4783 + 1;
+    int v4785 = v4784 + 1;
+    int v4786 = v4785 + 1;
+    int v4787 = v4786 + 1;
+    int v4788 = v4787 + 1;
+    int v4789 = v4788 + 1;
+    int v4790 = v4789 + 1;
+    int v4791 = v4790 + 1;
+    int v4792 = v4791 + 1;
+    int v4793 = v4792 + 1;
+    int v4794 = v4793 + 1;
+    int v4795 = v4794 + 1;
+    int v4796 = v4795 + 1;
+    int v4797 = v4796 + 1;
+    int v4798 = v4797 + 1;
+    int v4799 = v4798 + 1;
+    int v4800 = v4799 + 1;
+    int v4801 = v4800 + 1;
+    int v4802 = v4801 + 1;
+    int v4803 = v4802 + 1;
+    int v4804 = v4803 + 1;
+    int v4805 = v4804 + 1;
+    int v4806 = v4805 + 1;
+    int v4807 = v4806 + 1;
+    int v4808 = v4807 + 1;
+    int v4809 = v4808 + 1;
+    int v4810 = v4809 + 1;
+    int v4811 = v4810 + 1;
+    int v4812 = v4811 + 1;
+    int v4813 = v4812 + 1;
+    int v4814 = v4813 + 1;
+    int v4815 = v4814 + 1;
+    int v4816 = v4815 + 1;
+    int v4817 = v4816 + 1;
+    int v4818 = v4817 + 1;
+    int v4819 = v4818 + 1;
+    int v4820 = v4819 + 1;
+    int v4821 = v4820 + 1;
+    int v4822 = v4821 + 1;
+    int v4823 = v4822 + 1;
+    int v4824 = v4823 + 1;
+    int v4825 = v4824 + 1;
+    int v4826 = v4825 + 1;
+    int v4827 = v4826 + 1;
+    int v4828 = v4827 + 1;
+    int v4829 = v4828 + 1;
+    int v4830 = v4829 + 1;
+    int v4831 = v4830 + 1;
+    int v4832 = v4831 + 1;
+    int v4833 = v4832 + 1;
+    int v4834 = v4833 + 1;
+    int v4835 = v4834 + 1;
+    int v4836 = v4835 + 1;
+    int v4837 = v4836 + 1;
+    int v4838 = v4837 + 1;
+    int v4839 = v4838 + 1;
+    int v4840 = v4839 + 1;
+    int v4841 = v4840 + 1;
+    int v4842 = v4841 + 1;
+    int v4843 = v4842 + 1;
+    int v4844 = v4843 + 1;
+    int v4845 = v4844 + 1;
+    int v4846 = v4845 + 1;
+    int v4847 = v4846 + 1;
+    int v4848 = v4847 + 1;
+    int v4849 = v4848 + 1;
+    int v4850 = v4849 + 1;
+    int v4851 = v4850 + 1;
+    int v4852 = v4851 + 1;
+    int v4853 = v4852 + 1;
+    int v4854 = v4853 + 1;
+    int v4855 = v4854 + 1;
+    int v4856 = v4855 + 1;
+    int v4857 = v4856 + 1;
+    int v4858 = v4857 + 1;
+    int v4859 = v4858 + 1;
+    int v4860 = v4859 + 1;
+    int v4861 = v4860 + 1;
+    int v4862 = v4861 + 1;
+    int v4863 = v4862 + 1;
+    int v4864 = v4863 + 1;
+    int v4865 = v4864 + 1;
+    int v4866 = v4865 + 1;
+    int v4867 = v4866 + 1;
+    int v4868 = v4867 + 1;
+    int v4869 = v4868 + 1;
+    int v4870 = v4869 + 1;
+    int v4871 = v4870 + 1;
+    int v4872 = v4871 + 1;
+    int v4873 = v4872 + 1;
+    int v4874 = v4873 + 1;
+    int v4875 = v4874 + 1;
+    int v4876 = v4875 + 1;
+    int v4877 = v4876 + 1;
+    int v4878 = v4877 + 1;
+    int v4879 = v4878 + 1;
+    int v4880 = v4879 + 1;
+    int v4881 = v4880 + 1;
+    int v4882 = v4881 + 1;
+    int v4883 = v4882 + 1;
+    int v4884 = v4883 + 1;
+    int v4885 = v4884 + 1;
+    int v4886 = v4885 + 1;
+    int v4887 = v4886 + 1;
+    int v4888 = v4887 + 1;
+    int v4889 = v4888 + 1;
+    int v4890 = v4889 + 1;
+    int v4891 = v4890 + 1;
+    int v4892 = v4891 + 1;
+    int v4893 = v4892 + 1;
+    int v4894 = v4893 + 1;
+    int v4895 = v4894 + 1;
+    int v4896 = v4895 + 1;
+    int v4897 = v4896 + 1;
+    int v4898 = v4897 + 1;
+    int v4899 = v4898 + 1;
+    int v4900 = v4899 + 1;
+    int v4901 = v4900 + 1;
+    int v4902 = v4901 + 1;
+    int v4903 = v4902 + 1;
+    int v4904 = v4903 + 1;
+    int v4905 = v4904 + 1;
+    int v4906 = v4905 + 1;
+    int v4907 = v4906 + 1;
+    int v4908 = v4907 + 1;
+    int v4909 = v4908 + 1;
+    int v4910 = v4909 + 1;
+    int v4911 = v4910 + 1;
+    int v4912 = v4911 + 1;
+    int v4913 = v4912 + 1;
+    int v4914 = v4913 + 1;
+    int v4915 = v4914 + 1;
+    int v4916 = v4915 + 1;
+    int v4917 = v4916 + 1;
+    int v4918 = v4917 + 1;
+    int v4919 = v4918 + 1;
+    int v4920 = v4919 + 1;
+    int v4921 = v4920 + 1;
+    int v4922 = v4921 + 1;
+    int v4923 = v4922 + 1;
+    int v4924 = v4923 + 1;
+    int v4925 = v4924 + 1;
+    int v4926 = v4925 + 1;
+    int v4927 = v4926 + 1;
+    int v4928 = v4927 + 1;
+    int v4929 = v4928 + 1;
+    int v4930 = v4929 + 1;
+    int v4931 = v4930 + 1;
+    int v4932 = v4931 + 1;
+    int v4933 = v4932 + 1;
+    int v4934 = v4933 + 1;
+    int v4935 = v4934 + 1;
+    int v4936 = v4935 + 1;
+    int v4937 = v4936 + 1;
+    int v4938 = v4937 + 1;
+    int v4939 = v4938 + 1;
+    int v4940 = v4939 + 1;
+    int v4941 = v4940 + 1;
+    int v4942 = v4941 + 1;
+    int v4943 = v4942 + 1;
+    int v4944 = v4943 + 1;
+    int v4945 = v4944 + 1;
+    int v4946 = v4945 + 1;
+    int v4947 = v4946 + 1;
+    int v4948 = v4947 + 1;
+    int v4949 = v4948 + 1;
+    int v4950 = v4949 + 1;
+    int v4951 = v4950 + 1;
+    int v4952 = v4951 + 1;
+    int v4953 = v4952 + 1;
+    int v4954 = v4953 + 1;
+    int v4955 = v4954 + 1;
+    int v4956 = v4955 + 1;
+    int v4957 = v4956 + 1;
+    int v4958 = v4957 + 1;
+    int v4959 = v4958 + 1;
+    int v4960 = v4959 + 1;
+    int v4961 = v4960 + 1;
+    int v4962 = v4961 + 1;
+    int v4963 = v4962 + 1;
+    int v4964 = v4963 + 1;
+    int v4965 = v4964 + 1;
+    int v4966 = v4965 + 1;
+    int v4967 = v4966 + 1;
+    int v4968 = v4967 + 1;
+    int v4969 = v4968 + 1;
+    int v4970 = v4969 + 1;
+    int v4971 = v4970 + 1;
+    int v4972 = v4971 + 1;
+    int v4973 = v4972 + 1;
+    int v4974 = v4973 + 1;
+    int v4975 = v4974 + 1;
+    int v4976 = v4975 + 1;
+    int v4977 = v4976 + 1;
+    int v4978 = v4977 + 1;
+    int v4979 = v4978 + 1;
+    int v4980 = v4979 + 1;
+    int v4981 = v4980 + 1;
+    int v4982 = v4981 + 1;
+    int v4983 = v4982 + 1;
+    int v4984 = v4983 + 1;
+    int v4985 = v4984 + 1;
+    int v4986 = v4985 + 1;
+    int v4987 = v4986 + 1;
+    int v4988 = v4987 + 1;
+    int v4989 = v4988 + 1;
+    int v4990 = v4989 + 1;
+    int v4991 = v4990 + 1;
+    int v4992 = v4991 + 1;
+    int v4993 = v4992 + 1;
+    int v4994 = v4993 + 1;
+    int v4995 = v4994 + 1;
+    int v4996 = v4995 + 1;
+    int v4997 = v4996 + 1;
+    int v4998 = v4997 + 1;
+    int v4999 = v4998 + 1;
+    int v5000 = v4999 + 1;
+    int v5001 = v5000 + 1;
+    int v5002 = v5001 + 1;
+    int v5003 = v5002 + 1;
+    int v5004 = v5003 + 1;
+    int v5005 = v5004 + 1;
+    int v5006 = v5005 + 1;
+    int v5007 = v5006 + 1;
+    int v5008 = v5007 + 1;
+    int v5009 = v5008 + 1;
+    int v5010 = v5009 + 1;
+    int v5011 = v5010 + 1;
+    int v5012 = v5011 + 1;
+    int v5013 = v5012 + 1;
+    int v5014 = v5013 + 1;
+    int v5015 = v5014 + 1;
+    int v5016 = v5015 + 1;
+    int v5017 = v5016 + 1;
+    int v5018 = v5017 + 1;
+    int v5019 = v5018 + 1;
+    int v5020 = v5019 + 1;
+    int v5021 = v5020 + 1;
+    int v5022 = v5021 + 1;
+    int v5023 = v5022 + 1;
+    int v5024 = v5023 + 1;
+    int v5025 = v5024 + 1;
+    int v5026 = v5025 + 1;
+    int v5027 = v5026 + 1;
+    int v5028 = v5027 + 1;
+    int v5029 = v5028 + 1;
+    int v5030 = v5029 + 1;
+    int v5031 = v5030 + 1;
+    int v5032 = v5031 + 1;
+    int v5033 = v5032 + 1;
+    int v5034 = v5033 + 1;
+    int v5035 = v5034 + 1;
+    int v5036 = v5035 + 1;
+    int v5037 = v5036 + 1;
+    int v5038 = v5037 + 1;
+    int v5039 = v5038 + 1;
+    int v5040 = v5039 + 1;
+    int v5041 = v5040 + 1;
+    int v5042 = v5041 + 1;
+    int v5043 = v5042 + 1;
+    int v5044 = v5043 + 1;
+    int v5045 = v5044 + 1;
+    int v5046 = v5045 + 1;
+    int v5047 = v5046 + 1;
+    int v5048 = v5047 + 1;
+    int v5049 = v5048 + 1;
+    int v5050 = v5049 + 1;
+    int v5051 = v5050 + 1;
+    int v5052 = v5051 + 1;
+    int v5053 = v5052 + 1;
+    int v5054 = v5053 + 1;
+    int v5055 = v5054 + 1;
+    int v5056 = v5055 + 1;
+    int v5057 = v5056 + 1;
+    int v5058 = v5057 + 1;
+    int v5059 = v5058 + 1;
+    int v5060 = v5059 + 1;
+    int v5061 = v5060 + 1;
+    int v5062 = v5061 + 1;
+    int v5063 = v5062 + 1;
+    int v5064 = v5063 + 1;
+    int v5065 = v5064 + 1;
+    int v5066 = v5065 + 1;
+    int v5067 = v5066 + 1;
+    int v5068 = v5067 + 1;
+    int v5069 = v5068 + 1;
+    int v5070 = v5069 + 1;
+    int v5071 = v5070 + 1;
+    int v5072 = v5071 + 1;
+    int v5073 = v5072 + 1;
+    int v5074 = v5073 + 1;
+    int v5075 = v5074 + 1;
+    int v5076 = v5075 + 1;
+    int v5077 = v5076 + 1;
+    int v5078 = v5077 + 1;
+    int v5079 = v5078 + 1;
+    int v5080 = v5079 + 1;
+    int v5081 = v5080 + 1;
+    int v5082 = v5081 + 1;
+    int v5083 = v5082 + 1;
+    int v5084 = v5083 + 1;
+    int v5085 = v5084 + 1;
+    int v5086 = v5085 + 1;
+    int v5087 = v5086 + 1;
+    int v5088 = v5087 + 1;
+    int v5089 = v5088 + 1;
+    int v5090 = v5089 + 1;
+    int v5091 = v5090 + 1;
+    int v5092 = v5091 + 1;
+    int v5093 = v5092 + 1;
+    int v5094 = v5093 + 1;
+    int v5095 = v5094 + 1;
+    int v5096 = v5095 + 1;
+    int v5097 = v5096 + 1;
+    int v5098 = v5097 + 1;
+    int v5099 = v5098 + 1;
+    int v5100 = v5099 + 1;
+    int v5101 = v5100 + 1;
+    int v5102 = v5101 + 1;
+    int v5103 = v5102 + 1;
+    int v5104 = v5103 + 1;
+    int v5105 = v5104 + 1;
+    int v5106 = v5105 + 1;
+    int v5107 = v5106 + 1;
+    int v5108 = v5107 + 1;
+    int v5109 = v5108 + 1;
+    int v5110 = v5109 + 1;
+    int v5111 = v5110 + 1;
+    int v5112 = v5111 + 1;
+    int v5113 = v5112 + 1;
+    int v5114 = v5113 + 1;
+    int v5115 = v5114 + 1;
+    int v5116 = v5115 + 1;
+    int v5117 = v5116 + 1;
+    int v5118 = v5117 + 1;
+    int v5119 = v5118 + 1;
+    int v5120 = v5119 + 1;
+    int v5121 = v5120 + 1;
+    int v5122 = v5121 + 1;
+    int v5123 = v5122 + 1;
+    int v5124 = v5123 + 1;
+    int v5125 = v5124 + 1;
+    int v5126 = v5125 + 1;
+    int v5127 = v5126 + 1;
+    int v5128 = v5127 + 1;
+    int v5129 = v5128 + 1;
+    int v5130 = v5129 + 1;
+    int v5131 = v5130 + 1;
+    int v5132 = v5131 + 1;
+    int v5133 = v5132 + 1;
+    int v5134 = v5133 + 1;
+    int v5135 = v5134 + 1;
+    int v5136 = v5135 + 1;
+    int v5137 = v5136 + 1;
+    int v5138 = v5137 + 1;
+    int v5139 = v5138 + 1;
+    int v5140 = v5139 + 1;
+    int v5141 = v5140 + 1;
+    int v5142 = v5141 + 1;
+    int v5143 = v5142 + 1;
+    int v5144 = v5143 + 1;
+    int v5145 = v5144 + 1;
+    int v5146 = v5145 + 1;
+    int v5147 = v5146 + 1;
+    int v5148 = v5147 + 1;
+    int v5149 = v5148 + 1;
+    int v5150 = v5149 + 1;
+    int v5151 = v5150 + 1;
+    int v5152 = v5151 + 1;
+    int v5153 = v5152 + 1;
+    int v5154 = v5153 + 1;
+    int v5155 = v5154 + 1;
+    int v5156 = v5155 + 1;
+    int v5157 = v5156 + 1;
+    int v5158 = v5157 + 1;
+    int v5159 = v5158 + 1;
+    int v5160 = v5159 + 1;
+    int v5161 = v5160 + 1;
+    int v5162 = v5161 + 1;
+    int v5163 = v5162 + 1;
+    int v5164 = v5163 + 1;
+    int v5165 = v5164 + 1;
+    int v5166 = v5165 + 1;
+    int v5167 = v5166 + 1;
+    int v5168 = v5167 + 1;
+    int v5169 = v5168 + 1;
+    int v5170 = v5169 + 1;
+    int v5171 = v5170 + 1;
+    int v5172 = v5171 + 1;
+    int v5173 = v5172 + 1;
+    int v5174 = v5173 + 1;
+    int v5175 = v5174 + 1;
+    int v5176 = v5175 + 1;
+    int v5177 = v5176 + 1;
+    int v5178 = v5177 + 1;
+    int v5179 = v5178 + 1;
+    int v5180 = v5179 + 1;
+    int v5181 = v5180 + 1;
+    int v5182 = v5181 + 1;
+    int v5183 = v5182 + 1;
+    int v5184 = v5183 + 1;
+    int v5185 = v5184 + 1;
+    int v5186 = v5185 + 1;
+    int v5187 = v5186 + 1;
+    int v5188 = v5187 + 1;
+    int v5189 = v5188 + 1;
+    int v5190 = v5189 + 1;
+    int v5191 = v5190 + 1;
+    int v5192 = v5191 + 1;
+    int v5193 = v5192 + 1;
+    int v5194 = v5193 + 1;
+    int v5195 = v5194 + 1;
+    int v5196 = v5195 + 1;
+    int v5197 = v5196 + 1;
+    int v5198 = v5197 + 1;
+    int v5199 = v5198 + 1;
+    int v5200 = v5199 + 1;
+    int v5201 = v5200 + 1;
+    int v5202 = v5201 + 1;
+    int v5203 = v5202 + 1;
+    int v5204 = v5203 + 1;
+    int v5205 = v5204 + 1;
+    int v5206 = v5205 + 1;
+    int v5207 = v5206 + 1;
+    int v5208 = v5207 + 1;
+    int v5209 = v5208 + 1;
+    int v5210 = v5209 + 1;
+    int v5211 = v5210 + 1;
+    int v5212 = v5211 + 1;
+    int v5213 = v5212 + 1;
+    int v5214 = v5213 + 1;
+    int v5215 = v5214 + 1;
+    int v5216 = v5215 + 1;
+    int v5217 = v5216 + 1;
+    int v5218 = v5217 + 1;
+    int v5219 = v5218 + 1;
+    int v5220 = v5219 + 1;
+    int v5221 = v5220 + 1;
+    int v5222 = v5221 + 1;
+    int v5223 = v5222 + 1;
+    int v5224 = v5223 + 1;
+    int v5225 = v5224 + 1;
+    int v5226 = v5225 + 1;
+    int v5227 = v5226 + 1;
+    int v5228 = v5227 + 1;
+    int v5229 = v5228 + 1;
+    int v5230 = v5229 + 1;
+    int v5231 = v5230 + 1;
+    int v5232 = v5231 + 1;
+    int v5233 = v5232 + 1;
+    int v5234 = v5233 + 1;
+    int v5235 = v5234 + 1;
+    int v5236 = v5235 + 1;
+    int v5237 = v5236 + 1;
+    int v5238 = v5237 + 1;
+    int v5239 = v5238 + 1;
+    int v5240 = v5239 + 1;
+    int v5241 = v5240 + 1;
+    int v5242 = v5241 + 1;
+    int v5243 = v5242 + 1;
+    int v5244 = v5243 + 1;
+    int v5245 = v5244 + 1;
+    int v5246 = v5245 + 1;
+    int v5247 = v5246 + 1;
+    int v5248 = v5247 + 1;
+    int v5249 = v5248 + 1;
+    int v5250 = v5249 + 1;
+    int v5251 = v5250 + 1;
+    int v5252 = v5251 + 1;
+    int v5253 = v5252 + 1;
+    int v5254 = v5253 + 1;
+    int v5255 = v5254 + 1;
+    int v5256 = v5255 + 1;
+    int v5257 = v5256 + 1;
+    int v5258 = v5257 + 1;
+    int v5259 = v5258 + 1;
+    int v5260 = v5259 + 1;
+    int v5261 = v5260 + 1;
+    int v5262 = v5261 + 1;
+    int v5263 = v5262 + 1;
+    int v5264 = v5263 + 1;
+    int v5265 = v5264 + 1;
+    int v5266 = v5265 + 1;
+    int v5267 = v5266 + 1;
+    int v5268 = v5267 + 1;
+    int v5269 = v5268 + 1;
+    int v5270 = v5269 + 1;
+    int v5271 = v5270 + 1;
+    int v5272 = v5271 + 1;
+    int v5273 = v5272 + 1;
+    int v5274 = v5273 + 1;
+    int v5275 = v5274 + 1;
+    int v5276 = v5275 + 1;
+    int v5277 = v5276 + 1;
+    int v5278 = v5277 + 1;
+    int v5279 = v5278 + 1;
+    int v5280 = v5279 + 1;
+    int v5281 = v5280 + 1;
+    int v5282 = v5281 + 1;
+    int v5283 = v5282 + 1;
+    int v5284 = v5283 + 1;
+    int v5285 = v5284 + 1;
+    int v5286 = v5285 + 1;
+    int v5287 = v5286 + 1;
+    int v5288 = v5287 + 1;
+    int v5289 = v5288 + 1;
+    int v5290 = v5289 + 1;
+    int v5291 = v5290 + 1;
+    int v5292 = v5291 + 1;
+    int v5293 = v5292 + 1;
+    int v5294 = v5293 + 1;
+    int v5295 = v5294 + 1;
+    int v5296 = v5295 + 1;
+    int v5297 = v5296 + 1;
+    int v5298 = v5297 + 1;
+    int v5299 = v5298 + 1;
+    int v5300 = v5299 + 1;
+    int v5301 = v5300 + 1;
+    int v5302 = v5301 + 1;
+    int v5303 = v5302 + 1;
+    int v5304 = v5303 + 1;
+    int v5305 = v5304 + 1;
+    int v5306 = v5305 + 1;
+    int v5307 = v5306 + 1;
+    int v5308 = v5307 + 1;
+    int v5309 = v5308 + 1;
+    int v5310 = v5309 + 1;
+    int v5311 = v5310 + 1;
+    int v5312 = v5311 + 1;
+    int v5313 = v5312 + 1;
+    int v5314 = v5313 + 1;
+    int v5315 = v5314 + 1;
+    int v5316 = v5315 + 1;
+    int v5317 = v5316 + 1;
+    int v5318 = v5317 + 1;
+    int v5319 = v5318 + 1;
+    int v5320 = v5319 + 1;
+    int v5321 = v5320 + 1;
+    int v5322 = v5321 + 1;
+    int v5323 = v5322 + 1;
+    int v5324 = v5323 + 1;
+    int v5325 = v5324 + 1;
+    int v5326 = v5325 + 1;
+    int v5327 = v5326 + 1;
+    int v5328 = v5327 + 1;
+    int v5329 = v5328 + 1;
+    int v5330 = v5329 + 1;
+    int v5331 = v5330 + 1;
+    int v5332 = v5331 + 1;
+    int v5333 = v5332 + 1;
+    int v5334 = v5333 + 1;
+    int v5335 = v5334 + 1;
+    int v5336 = v5335 + 1;
+    int v5337 = v5336 + 1;
+    int v5338 = v5337 + 1;
+    int v5339 = v5338 + 1;
+    int v5340 = v5339 + 1;
+    int v5341 = v5340 + 1;
+    int v5342 = v5341 + 1;
+    int v5343 = v5342 + 1;
+    int v5344 = v5343 + 1;
+    int v5345 = v5344 + 1;
+    int v5346 = v5345 + 1;
+    int v5347 = v5346 + 1;
+    int v5348 = v5347 + 1;
+    int v5349 = v5348 + 1;
+    int v5350 = v5349 + 1;
+    int v5351 = v5350 + 1;
+    int v5352 = v5351 + 1;
+    int v5353 = v5352 + 1;
+    int v5354 = v5353 + 1;
+    int v5355 = v5354 + 1;
+    int v5356 = v5355 + 1;
+    int v5357 = v5356 + 1;
+    int v5358 = v5357 + 1;
+    int v5359 = v5358 + 1;
+    int v5360 = v5359 + 1;
+    int v5361 = v5360 + 1;
+    int v5362 = v5361 + 1;
+    int v5363 = v5362 + 1;
+    int v5364 = v5363 + 1;
+    int v5365 = v5364 + 1;
+    int v5366 = v5365 + 1;
+    int v5367 = v5366 + 1;
+    int v5368 = v5367 + 1;
+    int v5369 = v5368 + 1;
+    int v5370 = v5369 + 1;
+    int v5371 = v5370 + 1;
+    int v5372 = v5371 + 1;
+    int v5373 = v5372 + 1;
+    int v5374 = v5373 + 1;
+    int v5375 = v5374 + 1;
+    int v5376 = v5375 + 1;
+    int v5377 = v5376 + 1;
+    int v5378 = v5377 + 1;
+    int v5379 = v5378 + 1;
+    int v5380 = v5379 + 1;
+    int v5381 = v5380 + 1;
+    int v5382 = v5381 + 1;
+    int v5383 = v5382 + 1;
+    int v5384 = v5383 + 1;
+    int v5385 = v5384 + 1;
+    int v5386 = v5385 + 1;
+    int v5387 = v5386 + 1;
+    int v5388 = v5387 + 1;
+    int v5389 = v5388 + 1;
+    int v5390 = v5389 + 1;
+    int v5391 = v5390 + 1;
+    int v5392 = v5391 + 1;
+    int v5393 = v5392 + 1;
+    int v5394 = v5393 + 1;
+    int v5395 = v5394 + 1;
+    int v5396 = v5395 + 1;
+    int v5397 = v5396 + 1;
+    int v5398 = v5397 + 1;
+    int v5399 = v5398 + 1;
+    int v5400 = v5399 + 1;
+    int v5401 = v5400 + 1;
+    int v5402 = v5401 + 1;
+    int v5403 = v5402 + 1;
+    int v5404 = v5403 + 1;
+    int v5405 = v5404 + 1;
+    int v5406 = v5405 + 1;
+    int v5407 = v5406 + 1;
+    int v5408 = v5407 + 1;
+    int v5409 = v5408 + 1;
+    int v5410 = v5409 + 1;
+    int v5411 = v5410 + 1;
+    int v5412 = v5411 + 1;
+    int v5413 = v5412 + 1;
+    int v5414 = v5413 + 1;
+    int v5415 = v5414 + 1;
+    int v5416 = v5415 + 1;
+    int v5417 = v5416 + 1;
+    int v5418 = v5417 + 1;
+    int v5419 = v5418 + 1;
+    int v5420 = v5419 + 1;
+    int v5421 = v5420 + 1;
+    int v5422 = v5421 + 1;
+    int v5423 = v5422 + 1;
+    int v5424 = v5423 + 1;
+    int v5425 = v5424 + 1;
+    int v5426 = v5425 + 1;
+    int v5427 = v5426 + 1;
+    int v5428 = v5427 + 1;
+    int v5429 = v5428 + 1;
+    int v5430 = v5429 + 1;
+    int v5431 = v5430 + 1;
+    int v5432 = v5431 + 1;
+    int v5433 = v5432 + 1;
+    int v5434 = v5433 + 1;
+    int v5435 = v5434 + 1;
+    int v5436 = v5435 + 1;
+    int v5437 = v5436 + 1;
+    int v5438 = v5437 + 1;
+    int v5439 = v5438 + 1;
+    int v5440 = v5439 + 1;
+    int v5441 = v5440 + 1;
+    int v5442 = v5441 + 1;
+    int v5443 = v5442 + 1;
+    int v5444 = v5443 + 1;
+    int v5445 = v5444 + 1;
+    int v5446 = v5445 + 1;
+    int v5447 = v5446 + 1;
+    int v5448 = v5447 + 1;
+    int v5449 = v5448 + 1;
+    int v5450 = v5449 + 1;
+    int v5451 = v5450 + 1;
+    int v5452 = v5451 + 1;
+    int v5453 = v5452 + 1;
+    int v5454 = v5453 + 1;
+    int v5455 = v5454 + 1;
+    int v5456 = v5455 + 1;
+    int v5457 = v5456 + 1;
+    int v5458 = v5457 + 1;
+    int v5459 = v5458 + 1;
+    int v5460 = v5459 + 1;
+    int v5461 = v5460 + 1;
+    int v5462 = v5461 + 1;
+    int v5463 = v5462 + 1;
+    int v5464 = v5463 + 1;
+    int v5465 = v5464 + 1;
+    int v5466 = v5465 + 1;
+    int v5467 = v5466 + 1;
+    int v5468 = v5467 + 1;
+    int v5469 = v5468 + 1;
+    int v5470 = v5469 + 1;
+    int v5471 = v5470 + 1;
+    int v5472 = v5471 + 1;
+    int v5473 = v5472 + 1;
+    int v5474 = v5473 + 1;
+    int v5475 = v5474 + 1;
+    int v5476 = v5475 + 1;
+    int v5477 = v5476 + 1;
+    int v5478 = v5477 + 1;
+    int v5479 = v5478 + 1;
+    int v5480 = v5479 + 1;
+    int v5481 = v5480 + 1;
+    int v5482 = v5481 + 1;
+    int v5483 = v5482 + 1;
+    int v5484 = v5483 + 1;
+    int v5485 = v5484 + 1;
+    int v5486 = v5485 + 1;
+    int v5487 = v5486 + 1;
+    int v5488 = v5487 + 1;
+    int v5489 = v5488 + 1;
+    int v5490 = v5489 + 1;
+    int v5491 = v5490 + 1;
+    int v5492 = v5491 + 1;
+    int v5493 = v5492 + 1;
+    int v5494 = v5493 + 1;
+    int v5495 = v5494 + 1;
+    int v5496 = v5495 + 1;
+    int v5497 = v5496 + 1;
+    int v5498 = v5497 + 1;
+    int v5499 = v5498 + 1;
+    int v5500 = v5499 + 1;
+    int v5501 = v5500 + 1;
+    int v5502 = v5501 + 1;
+    int v5503 = v5502 + 1;
+    int v5504 = v5503 + 1;
+    int v5505 = v5504 + 1;
+    int v5506 = v5505 + 1;
+    int v5507 = v5506 + 1;
+    int v5508 = v5507 + 1;
+    int v5509 = v5508 + 1;
+    int v5510 = v5509 + 1;
+    int v5511 = v5510 + 1;
+    int v5512 = v5511 + 1;
+    int v5513 = v5512 + 1;
+    int v5514 = v5513 + 1;
+    int v5515 = v5514 + 1;
+    int v5516 = v5515 + 1;
+    int v5517 = v5516 + 1;
+    int v5518 = v5517 + 1;
+    int v5519 = v5518 + 1;
+    int v5520 = v5519 + 1;
+    int v5521 = v5520 + 1;
+    int v5522 = v5521 + 1;
+    int v5523 = v5522 + 1;
+    int v5524 = v5523 + 1;
+    int v5525 = v5524 + 1;
+    int v5526 = v5525 + 1;
+    int v5527 = v5526 + 1;
+    int v5528 = v5527 + 1;
+    int v5529 = v5528 + 1;
+    int v5530 = v5529 + 1;
+    int v5531 = v5530 + 1;
+    int v5532 = v5531 + 1;
+    int v5533 = v5532 + 1;
+    int v5534 = v5533 + 1;
+    int v5535 = v5534 + 1;
+    int v5536 = v5535 + 1;
+    int v5537 = v5536 + 1;
+    int v5538 = v5537 + 1;
+    int v5539 = v5538 + 1;
+    int v5540 = v5539 + 1;
+    int v5541 = v5540 + 1;
+    int v5542 = v5541 + 1;
+    int v5543 = v5542 + 1;
+    int v5544 = v5543 + 1;
+    int v5545 = v5544 + 1;
+    int v5546 = v5545 + 1;
+    int v5547 = v5546 + 1;
+    int v5548 = v5547 + 1;
+    int v5549 = v5548 + 1;
+    int v5550 = v5549 + 1;
+    int v5551 = v5550 + 1;
+    int v5552 = v5551 + 1;
+    int v5553 = v5552 + 1;
+    int v5554 = v5553 + 1;
+    int v5555 = v5554 + 1;
+    int v5556 = v5555 + 1;
+    int v5557 = v5556 + 1;
+    int v5558 = v5557 + 1;
+    int v5559 = v5558 + 1;
+    int v5560 = v5559 + 1;
+    int v5561 = v5560 + 1;
+    int v5562 = v5561 + 1;
+    int v5563 = v5562 + 1;
+    int v5564 = v5563 + 1;
+    int v5565 = v5564 + 1;
+    int v5566 = v5565 + 1;
+    int v5567 = v5566 + 1;
+    int v5568 = v5567 + 1;
+    int v5569 = v5568 + 1;
+    int v5570 = v5569 + 1;
+    int v5571 = v5570 + 1;
+    int v5572 = v5571 + 1;
+    int v5573 = v5572 + 1;
+    int v5574 = v5573 + 1;
+    int v5575 = v5574 + 1;
+    int v5576 = v5575 + 1;
+    int v5577 = v5576 + 1;
+    int v5578 = v5577 + 1;
+    int v5579 = v5578 + 1;
+    int v5580 = v5579 + 1;
+    int v5581 = v5580 + 1;
+    int v5582 = v5581 + 1;
+    int v5583 = v5582 + 1;
+    int v5584 = v5583 + 1;
+    int v5585 = v5584 + 1;
+    int v5586 = v5585 + 1;
+    int v5587 = v5586 + 1;
+    int v5588 = v5587 + 1;
+    int v5589 = v5588 + 1;
+    int v5590 = v5589 + 1;
+    int v5591 = v5590 + 1;
+    int v5592 = v5591 + 1;
+    int v5593 = v5592 + 1;
+    int v5594 = v5593 + 1;
+    int v5595 = v5594 + 1;
+    int v5596 = v5595 + 1;
+    int v5597 = v5596 + 1;
+    int v5598 = v5597 + 1;
+    int v5599 = v5598 + 1;
+    int v5600 = v5599 + 1;
+    int v5601 = v5600 + 1;
+    int v5602 = v5601 + 1;
+    int v5603 = v5602 + 1;
+    int v5604 = v5603 + 1;
+    int v5605 = v5604 + 1;
+    int v5606 = v5605 + 1;
+    int v5607 = v5606 + 1;
+    int v5608 = v5607 + 1;
+    int v5609 = v5608 + 1;
+    int v5610 = v5609 + 1;
+    int v5611 = v5610 + 1;
+    int v5612 = v5611 + 1;
+    int v5613 = v5612 + 1;
+    int v5614 = v5613 + 1;
+    int v5615 = v5614 + 1;
+    int v5616 = v5615 + 1;
+    int v5617 = v5616 + 1;
+    int v5618 = v5617 + 1;
+    int v5619 = v5618 + 1;
+    int v5620 = v5619 + 1;
+    int v5621 = v5620 + 1;
+    int v5622 = v5621 + 1;
+    int v5623 = v5622 + 1;
+    int v5624 = v5623 + 1;
+    int v5625 = v5624 + 1;
+    int v5626 = v5625 + 1;
+    int v5627 = v5626 + 1;
+    int v5628 = v5627 + 1;
+    int v5629 = v5628 + 1;
+    int v5630 = v5629 + 1;
+    int v5631 = v5630 + 1;
+    int v5632 = v5631 + 1;
+    int v5633 = v5632 + 1;
+    int v5634 = v5633 + 1;
+    int v5635 = v5634 + 1;
+    int v5636 = v5635 + 1;
+    int v5637 = v5636 + 1;
+    int v5638 = v5637 + 1;
+    int v5639 = v5638 + 1;
+    int v5640 = v5639 + 1;
+    int v5641 = v5640 + 1;
+    int v5642 = v5641 + 1;
+    int v5643 = v5642 + 1;
+    int v5644 = v5643 + 1;
+    int v5645 = v5644 + 1;
+    int v5646 = v5645 + 1;
+    int v5647 = v5646 + 1;
+    int v5648 = v5647 + 1;
+    int v5649 = v5648 + 1;
+    int v5650 = v5649 + 1;
+    int v5651 = v5650 + 1;
+    int v5652 = v5651 + 1;
+    int v5653 = v5652 + 1;
+    int v5654 = v5653 + 1;
+    int v5655 = v5654 + 1;
+    int v5656 = v5655 + 1;
+    int v5657 = v5656 + 1;
+    int v5658 = v5657 + 1;
+    int v5659 = v5658 + 1;
+    int v5660 = v5659 + 1;
+    int v5661 = v5660 + 1;
+    int v5662 = v5661 + 1;
+    int v5663 = v5662 + 1;
+    int v5664 = v5663 + 1;
+    int v5665 = v5664 + 1;
+    int v5666 = v5665 + 1;
+    int v5667 = v5666 + 1;
+    int v5668 = v5667 + 1;
+    int v5669 = v5668 + 1;
+    int v5670 = v5669 + 1;
+    int v5671 = v5670 + 1;
+    int v5672 = v5671 + 1;
+    int v5673 = v5672 + 1;
+    int v5674 = v5673 + 1;
+    int v5675 = v5674 + 1;
+    int v5676 = v5675 + 1;
+    int v5677 = v5676 + 1;
+    int v5678 = v5677 + 1;
+    int v5679 = v5678 + 1;
+    int v5680 = v5679 + 1;
+    int v5681 = v5680 + 1;
+    int v5682 = v5681 + 1;
+    int v5683 = v5682 + 1;
+    int v5684 = v5683 + 1;
+    int v5685 = v5684 + 1;
+    int v5686 = v5685 + 1;
+    int v5687 = v5686 + 1;
+    int v5688 = v5687 + 1;
+    int v5689 = v5688 + 1;
+    int v5690 = v5689 + 1;
+    int v5691 = v5690 + 1;
+    int v5692 = v5691 + 1;
+    int v5693 = v5692 + 1;
+    int v5694 = v5693 + 1;
+    int v5695 = v5694 + 1;
+    int v5696 = v5695 + 1;
+    int v5697 = v5696 + 1;
+    int v5698 = v5697 + 1;
+    int v5699 = v5698 + 1;
+    int v5700 = v5699 + 1;
+    int v5701 = v5700 + 1;
+    int v5702 = v5701 + 1;
+    int v5703 = v5702 + 1;
+    int v5704 = v5703 + 1;
+    int v5705 = v5704 + 1;
+    int v5706 = v5705 + 1;
+    int v5707 = v5706 + 1;
+    int v5708 = v5707 + 1;
+    int v5709 = v5708 + 1;
+    int v5710 = v5709 + 1;
+    int v5711 = v5710 + 1;
+    int v5712 = v5711 + 1;
+    int v5713 = v5712 + 1;
+    int v5714 = v5713 + 1;
+    int v5715 = v5714 + 1;
+    int v5716 = v5715 + 1;
+    int v5717 = v5716 + 1;
+    int v5718 = v5717 + 1;
+    int v5719 = v5718 + 1;
+    int v5720 = v5719 + 1;
+    int v5721 = v5720 + 1;
+    int v5722 = v5721 + 1;
+    int v5723 = v5722 + 1;
+    int v5724 = v5723 + 1;
+    int v5725 = v5724 + 1;
+    int v5726 = v5725 + 1;
+    int v5727 = v5726 + 1;
+    int v5728 = v5727 + 1;
+    int v5729 = v5728 + 1;
+    int v5730 = v5729 + 1;
+    int v5731 = v5730 + 1;
+    int v5732 = v5731 + 1;
+    int v5733 = v5732 + 1;
+    int v5734 = v5733 + 1;
+    int v5735 = v5734 + 1;
+    int v5736 = v5735 + 1;
+    int v5737 = v5736 + 1;
+    int v5738 = v5737 + 1;
+    int v5739 = v5738 + 1;
+    int v5740 = v5739 + 1;
+    int v5741 = v5740 + 1;
+    int v5742 = v5741 + 1;
+    int v5743 = v5742 + 1;
+    int v5744 = v5743 + 1;
+    int v5745 = v5744 + 1;
+    int v5746 = v5745 + 1;
+    int v5747 = v5746 + 1;
+    int v5748 = v5747 + 1;
+    int v5749 = v5748 + 1;
+    int v5750 = v5749 + 1;
+    int v5751 = v5750 + 1;
+    int v5752 = v5751 + 1;
+    int v5753 = v5752 + 1;
+    int v5754 = v5753 + 1;
+    int v5755 = v5754 + 1;
+    int v5756 = v5755 + 1;
+    int v5757 = v5756 + 1;
+    int v5758 = v5757 + 1;
+    int v5759 = v5758 + 1;
+    int v5760 = v5759 + 1;
+    int v5761 = v5760 + 1;
+    int v5762 = v5761 + 1;
+    int v5763 = v5762 + 1;
+    int v5764 = v5763 + 1;
+    int v5765 = v5764 + 1;
+    int v5766 = v5765 + 1;
+    int v5767 = v5766 + 1;
+    int v5768 = v5767 + 1;
+    int v5769 = v5768 + 1;
+    int v5770 = v5769 + 1;
+    int v5771 = v5770 + 1;
+    int v5772 = v5771 + 1;
+    int v5773 = v5772 + 1;
+    int v5774 = v5773 + 1;
+    int v5775 = v5774 + 1;
+    int v5776 = v5775 + 1;
+    int v5777 = v5776 + 1;
+    int v5778 = v5777 + 1;
+    int v5779 = v5778 + 1;
+    int v5780 = v5779 + 1;
+    int v5781 = v5780 + 1;
+    int v5782 = v5781 + 1;
+    int v5783 = v5782 + 1;
+    int v5784 = v5783 + 1;
+    int v5785 = v5784 + 1;
+    int v5786 = v5785 + 1;
+    int v5787 = v5786 + 1;
+    int v5788 = v5787 + 1;
+    int v5789 = v5788 + 1;
+    int v5790 = v5789 + 1;
+    int v5791 = v5790 + 1;
+    int v5792 = v5791 + 1;
+    int v5793 = v5792 + 1;
+    int v5794 = v5793 + 1;
+    int v5795 = v5794 + 1;
+    int v5796 = v5795 + 1;
+    int v5797 = v5796 + 1;
+    int v5798 = v5797 + 1;
+    int v5799 = v5798 + 1;
+    int v5800 = v5799 + 1;
+    int v5801 = v5800 + 1;
+    int v5802 = v5801 + 1;
+    int v5803 = v5802 + 1;
+    int v5804 = v5803 + 1;
+    int v5805 = v5804 + 1;
+    int v5806 = v5805 + 1;
+    int v5807 = v5806 + 1;
+    int v5808 = v5807 + 1;
+    int v5809 = v5808 + 1;
+    int v5810 = v5809 + 1;
+    int v5811 = v5810 + 1;
+    int v5812 = v5811 + 1;
+    int v5813 = v5812 + 1;
+    int v5814 = v5813 + 1;
+    int v5815 = v5814 + 1;
+    int v5816 = v5815 + 1;
+    int v5817 = v5816 + 1;
+    int v5818 = v5817 + 1;
+    int v5819 = v5818 + 1;
+    int v5820 = v5819 + 1;
+    int v5821 = v5820 + 1;
+    int v5822 = v5821 + 1;
+    int v5823 = v5822 + 1;
+    int v5824 = v5823 + 1;
+    int v5825 = v5824 + 1;
+    int v5826 = v5825 + 1;
+    int v5827 = v5826 + 1;
+    int v5828 = v5827 + 1;
+    int v5829 = v5828 + 1;
+    int v5830 = v5829 + 1;
+    int v5831 = v5830 + 1;
+    int v5832 = v5831 + 1;
+    int v5833 = v5832 + 1;
+    int v5834 = v5833 + 1;
+    int v5835 = v5834 + 1;
+    int v5836 = v5835 + 1;
+    int v5837 = v5836 + 1;
+    int v5838 = v5837 + 1;
+    int v5839 = v5838 + 1;
+    int v5840 = v5839 + 1;
+    int v5841 = v5840 + 1;
+    int v5842 = v5841 + 1;
+    int v5843 = v5842 + 1;
+    int v5844 = v5843 + 1;
+    int v5845 = v5844 + 1;
+    int v5846 = v5845 + 1;
+    int v5847 = v5846 + 1;
+    int v5848 = v5847 + 1;
+    int v5849 = v5848 + 1;
+    int v5850 = v5849 + 1;
+    int v5851 = v5850 + 1;
+    int v5852 = v5851 + 1;
+    int v5853 = v5852 + 1;
+    int v5854 = v5853 + 1;
+    int v5855 = v5854 + 1;
+    int v5856 = v5855 + 1;
+    int v5857 = v5856 + 1;
+    int v5858 = v5857 + 1;
+    int v5859 = v5858 + 1;
+    int v5860 = v5859 + 1;
+    int v5861 = v5860 + 1;
+    int v5862 = v5861 + 1;
+    int v5863 = v5862 + 1;
+    int v5864 = v5863 + 1;
+    int v5865 = v5864 + 1;
+    int v5866 = v5865 + 1;
+    int v5867 = v5866 + 1;
+    int v5868 = v5867 + 1;
+    int v5869 = v5868 + 1;
+    int v5870 = v5869 + 1;
+    int v5871 = v5870 + 1;
+    int v5872 = v5871 + 1;
+    int v5873 = v5872 + 1;
+    int v5874 = v5873 + 1;
+    int v5875 = v5874 + 1;
+    int v5876 = v5875 + 1;
+    int v5877 = v5876 + 1;
+    int v5878 = v5877 + 1;
+    int v5879 = v5878 + 1;
+    int v5880 = v5879 + 1;
+    int v5881 = v5880 + 1;
+    int v5882 = v5881 + 1;
+    int v5883 = v5882 + 1;
+    int v5884 = v5883 + 1;
+    int v5885 = v5884 + 1;
+    int v5886 = v5885 + 1;
+    int v5887 = v5886 + 1;
+    int v5888 = v5887 + 1;
+    int v5889 = v5888 + 1;
+    int v5890 = v5889 + 1;
+    int v5891 = v5890 + 1;
+    int v5892 = v5891 + 1;
+    int v5893 = v5892 + 1;
+    int v5894 = v5893 + 1;
+    int v5895 = v5894 + 1;
+    int v5896 = v5895 + 1;
+    int v5897 = v5896 + 1;
+    int v5898 = v5897 + 1;
+    int v5899 = v5898 + 1;
+    int v5900 = v5899 + 1;
+    int v5901 = v5900 + 1;
+    int v5902 = v5901 + 1;
+    int v5903 = v5902 + 1;
+    int v5904 = v5903 + 1;
+    int v5905 = v5904 + 1;
+    int v5906 = v5905 + 1;
+    int v5907 = v5906 + 1;
+    int v5908 = v5907 + 1;
+    int v5909 = v5908 + 1;
+    int v5910 = v5909 + 1;
+    int v5911 = v5910 + 1;
+    int v5912 = v5911 + 1;
+    int v5913 = v5912 + 1;
+    int v5914 = v5913 + 1;
+    int v5915 = v5914 + 1;
+    int v5916 = v5915 + 1;
+    int v5917 = v5916 + 1;
+    int v5918 = v5917 + 1;
+    int v5919 = v5918 + 1;
+    int v5920 = v5919 + 1;
+    int v5921 = v5920 + 1;
+    int v5922 = v5921 + 1;
+    int v5923 = v5922 + 1;
+    int v5924 = v5923 + 1;
+    int v5925 = v5924 + 1;
+    int v5926 = v5925 + 1;
+    int v5927 = v5926 + 1;
+    int v5928 = v5927 + 1;
+    int v5929 = v5928 + 1;
+    int v5930 = v5929 + 1;
+    int v5931 = v5930 + 1;
+    int v5932 = v5931 + 1;
+    int v5933 = v5932 + 1;
+    int v5934 = v5933 + 1;
+    int v5935 = v5934 + 1;
+    int v5936 = v5935 + 1;
+    int v5937 = v5936 + 1;
+    int v5938 = v5937 + 1;
+    int v5939 = v5938 + 1;
+    int v5940 = v5939 + 1;
+    int v5941 = v5940 + 1;
+    int v5942 = v5941 + 1;
+    int v5943 = v5942 + 1;
+    int v5944 = v5943 + 1;
+    int v5945 = v5944 + 1;
+    int v5946 = v5945 + 1;
+    int v5947 = v5946 + 1;
+    int v5948 = v5947 + 1;
+    int v5949 = v5948 + 1;
+    int v5950 = v5949 + 1;
+    int v5951 = v5950 + 1;
+    int v5952 = v5951 + 1;
+    int v5953 = v5952 + 1;
+    int v5954 = v5953 + 1;
+    int v5955 = v5954 + 1;
+    int v5956 = v5955 + 1;
+    int v5957 = v5956 + 1;
+    int v5958 = v5957 + 1;
+    int v5959 = v5958 + 1;
+    int v5960 = v5959 + 1;
+    int v5961 = v5960 + 1;
+    int v5962 = v5961 + 1;
+    int v5963 = v5962 + 1;
+    int v5964 = v5963 + 1;
+    int v5965 = v5964 + 1;
+    int v5966 = v5965 + 1;
+    int v5967 = v5966 + 1;
+    int v5968 = v5967 + 1;
+    int v5969 = v5968 + 1;
+    int v5970 = v5969 + 1;
+    int v5971 = v5970 + 1;
+    int v5972 = v5971 + 1;
+    int v5973 = v5972 + 1;
+    int v5974 = v5973 + 1;
+    int v5975 = v5974 + 1;
+    int v5976 = v5975 + 1;
+    int v5977 = v5976 + 1;
+    int v5978 = v5977 + 1;
+    int v5979 = v5978 + 1;
+    int v5980 = v5979 + 1;
+    int v5981 = v5980 + 1;
+    int v5982 = v5981 + 1;
+    int v5983 = v5982 + 1;
+    int v5984 = v5983 + 1;
+    int v5985 = v5984 + 1;
+    int v5986 = v5985 + 1;
+    int v5987 = v5986 + 1;
+    int v5988 = v5987 + 1;
+    int v5989 = v5988 + 1;
+    int v5990 = v5989 + 1;
+    int v5991 = v5990 + 1;
+    int v5992 = v5991 + 1;
+    int v5993 = v5992 + 1;
+    int v5994 = v5993 + 1;
+    int v5995 = v5994 + 1;
+    int v5996 = v5995 + 1;
+    int v5997 = v5996 + 1;
+    int v5998 = v5997 + 1;
+    int v5999 = v5998 + 1;
+    int v6000 = v5999 + 1;
+    int v6001 = v6000 + 1;
+    int v6002 = v6001 + 1;
+    int v6003 = v6002 + 1;
+    int v6004 = v6003 + 1;
+    int v6005 = v6004 + 1;
+    int v6006 = v6005 + 1;
+    int v6007 = v6006 + 1;
+    int v6008 = v6007 + 1;
+    int v6009 = v6008 + 1;
+    int v6010 = v6009 + 1;
+    int v6011 = v6010 + 1;
+    int v6012 = v6011 + 1;
+    int v6013 = v6012 + 1;
+    int v6014 = v6013 + 1;
+    int v6015 = v6014 + 1;
+    int v6016 = v6015 + 1;
+    int v6017 = v6016 + 1;
+    int v6018 = v6017 + 1;
+    int v6019 = v6018 + 1;
+    int v6020 = v6019 + 1;
+    int v6021 = v6020 + 1;
+    int v6022 = v6021 + 1;
+    int v6023 = v6022 + 1;
+    int v6024 = v6023 + 1;
+    int v6025 = v6024 + 1;
+    int v6026 = v6025 + 1;
+    int v6027 = v6026 + 1;
+    int v6028 = v6027 + 1;
+    int v6029 = v6028 + 1;
+    int v6030 = v6029 + 1;
+    int v6031 = v6030 + 1;
+    int v6032 = v6031 + 1;
+    int v6033 = v6032 + 1;
+    int v6034 = v6033 + 1;
+    int v6035 = v6034 + 1;
+    int v6036 = v6035 + 1;
+    int v6037 = v6036 + 1;
+    int v6038 = v6037 + 1;
+    int v6039 = v6038 + 1;
+    int v6040 = v6039 + 1;
+    int v6041 = v6040 + 1;
+    int v6042 = v6041 + 1;
+    int v6043 = v6042 + 1;
+    int v6044 = v6043 + 1;
+    int v6045 = v6044 + 1;
+    int v6046 = v6045 + 1;
+    int v6047 = v6046 + 1;
+    int v6048 = v6047 + 1;
+    int v6049 = v6048 + 1;
+    int v6050 = v6049 + 1;
+    int v6051 = v6050 + 1;
+    int v6052 = v6051 + 1;
+    int v6053 = v6052 + 1;
+    int v6054 = v6053 + 1;
+    int v6055 = v6054 + 1;
+    int v6056 = v6055 + 1;
+    int v6057 = v6056 + 1;
+    int v6058 = v6057 + 1;
+    int v6059 = v6058 + 1;
+    int v6060 = v6059 + 1;
+    int v6061 = v6060 + 1;
+    int v6062 = v6061 + 1;
+    int v6063 = v6062 + 1;
+    int v6064 = v6063 + 1;
+    int v6065 = v6064 + 1;
+    int v6066 = v6065 + 1;
+    int v6067 = v6066 + 1;
+    int v6068 = v6067 + 1;
+    int v6069 = v6068 + 1;
+    int v6070 = v6069 + 1;
+    int v6071 = v6070 + 1;
+    int v6072 = v6071 + 1;
+    int v6073 = v6072 + 1;
+    int v6074 = v6073 + 1;
+    int v6075 = v6074 + 1;
+    int v6076 = v6075 + 1;
+    int v6077 = v6076 + 1;
+    int v6078 = v6077 + 1;
+    int v6079 = v6078 + 1;
+    int v6080 = v6079 + 1;
+    int v6081 = v6080 + 1;
+    int v6082 = v6081 + 1;
+    int v6083 = v6082 + 1;
+    int v6084 = v6083 + 1;
+    int v6085 = v6084 + 1;
+    int v6086 = v6085 + 1;
+    int v6087 = v6086 + 1;
+    int v6088 = v6087 + 1;
+    int v6089 = v6088 + 1;
+    int v6090 = v6089 + 1;
+    int v6091 = v6090 + 1;
+    int v6092 = v6091 + 1;
+    int v6093 = v6092 + 1;
+    int v6094 = v6093 + 1;
+    int v6095 = v6094 + 1;
+    int v6096 = v6095 + 1;
+    int v6097 = v6096 + 1;
+    int v6098 = v6097 + 1;
+    int v6099 = v6098 + 1;
+    int v6100 = v6099 + 1;
+    int v6101 = v6100 + 1;
+    int v6102 = v6101 + 1;
+    int v6103 = v6102 + 1;
+    int v6104 = v6103 + 1;
+    int v6105 = v6104 + 1;
+    int v6106 = v6105 + 1;
+    int v6107 = v6106 + 1;
+    int v6108 = v6107 + 1;
+    int v6109 = v6108 + 1;
+    int v6110 = v6109 + 1;
+    int v6111 = v6110 + 1;
+    int v6112 = v6111 + 1;
+    int v6113 = v6112 + 1;
+    int v6114 = v6113 + 1;
+    int v6115 = v6114 + 1;
+    int v6116 = v6115 + 1;
+    int v6117 = v6116 + 1;
+    int v6118 = v6117 + 1;
+    int v6119 = v6118 + 1;
+    int v6120 = v6119 + 1;
+    int v6121 = v6120 + 1;
+    int v6122 = v6121 + 1;
+    int v6123 = v6122 + 1;
+    int v6124 = v6123 + 1;
+    int v6125 = v6124 + 1;
+    int v6126 = v6125 + 1;
+    int v6127 = v6126 + 1;
+    int v6128 = v6127 + 1;
+    int v6129 = v6128 + 1;
+    int v6130 = v6129 + 1;
+    int v6131 = v6130 + 1;
+    int v6132 = v6131 + 1;
+    int v6133 = v6132 + 1;
+    int v6134 = v6133 + 1;
+    int v6135 = v6134 + 1;
+    int v6136 = v6135 + 1;
+    int v6137 = v6136 + 1;
+    int v6138 = v6137 + 1;
+    int v6139 = v6138 + 1;
+    int v6140 = v6139 + 1;
+    int v6141 = v6140 + 1;
+    int v6142 = v6141 + 1;
+    int v6143 = v6142 + 1;
+    int v6144 = v6143 + 1;
+    int v6145 = v6144 + 1;
+    int v6146 = v6145 + 1;
+    int v6147 = v6146 + 1;
+    int v6148 = v6147 + 1;
+    int v6149 = v6148 + 1;
+    int v6150 = v6149 + 1;
+    int v6151 = v6150 + 1;
+    int v6152 = v6151 + 1;
+    int v6153 = v6152 + 1;
+    int v6154 = v6153 + 1;
+    int v6155 = v6154 + 1;
+    int v6156 = v6155 + 1;
+    int v6157 = v6156 + 1;
+    int v6158 = v6157 + 1;
+    int v6159 = v6158 + 1;
+    int v6160 = v6159 + 1;
+    int v6161 = v6160 + 1;
+    int v6162 = v6161 + 1;
+    int v6163 = v6162 + 1;
+    int v6164 = v6163 + 1;
+    int v6165 = v6164 + 1;
+    int v6166 = v6165 + 1;
+    int v6167 = v6166 + 1;
+    int v6168 = v6167 + 1;
+    int v6169 = v6168 + 1;
+    int v6170 = v6169 + 1;
+    int v6171 = v6170 + 1;
+    int v6172 = v6171 + 1;
+    int v6173 = v6172 + 1;
+    int v6174 = v6173 + 1;
+    int v6175 = v6174 + 1;
+    int v6176 = v6175 + 1;
+    int v6177 = v6176 + 1;
+    int v6178 = v6177 + 1;
+    int v6179 = v6178 + 1;
+    int v6180 = v6179 + 1;
+    int v6181 = v6180 + 1;
+    int v6182 = v6181 + 1;
+    int v6183 = v6182 + 1;
+    int v6184 = v6183 + 1;
+    int v6185 = v6184 + 1;
+    int v6186 = v6185 + 1;
+    int v6187 = v6186 + 1;
+    int v6188 = v6187 + 1;
+    int v6189 = v6188 + 1;
+    int v6190 = v6189 + 1;
+    int v6191 = v6190 + 1;
+    int v6192 = v6191 + 1;
+    int v6193 = v6192 + 1;
+    int v6194 = v6193 + 1;
+    int v6195 = v6194 + 1;
+    int v6196 = v6195 + 1;
+    int v6197 = v6196 + 1;
+    int v6198 = v6197 + 1;
+    int v6199 = v6198 + 1;
+    int v6200 = v6199 + 1;
+    int v6201 = v6200 + 1;
+    int v6202 = v6201 + 1;
+    int v6203 = v6202 + 1;
+    int v6204 = v6203 + 1;
+    int v6205 = v6204 + 1;
+    int v6206 = v6205 + 1;
+    int v6207 = v6206 + 1;
+    int v6208 = v6207 + 1;
+    int v6209 = v6208 + 1;
+    int v6210 = v6209 + 1;
+    int v6211 = v6210 + 1;
+    int v6212 = v6211 + 1;
+    int v6213 = v6212 + 1;
+    int v6214 = v6213 + 1;
+    int v6215 = v6214 + 1;
+    int v6216 = v6215 + 1;
+    int v6217 = v6216 + 1;
+    int v6218 = v6217 + 1;
+    int v6219 = v6218 + 1;
+    int v6220 = v6219 + 1;
+    int v6221 = v6220 + 1;
+    int v6222 = v6221 + 1;
+    int v6223 = v6222 + 1;
+    int v6224 = v6223 + 1;
+    int v6225 = v6224 + 1;
+    int v6226 = v6225 + 1;
+    int v6227 = v6226 + 1;
+    int v6228 = v6227 + 1;
+    int v6229 = v6228 + 1;
+    int v6230 = v6229 + 1;
+    int v6231 = v6230 + 1;
+    int v6232 = v6231 + 1;
+    int v6233 = v6232 + 1;
+    int v6234 = v6233 + 1;
+    int v6235 = v6234 + 1;
+    int v6236 = v6235 + 1;
+    int v6237 = v6236 + 1;
+    int v6238 = v6237 + 1;
+    int v6239 = v6238 + 1;
+    int v6240 = v6239 + 1;
+    int v6241 = v6240 + 1;
+    int v6242 = v6241 + 1;
+    int v6243 = v6242 + 1;
+    int v6244 = v6243 + 1;
+    int v6245 = v6244 + 1;
+    int v6246 = v6245 + 1;
+    int v6247 = v6246 + 1;
+    int v6248 = v6247 + 1;
+    int v6249 = v6248 + 1;
+    int v6250 = v6249 + 1;
+    int v6251 = v6250 + 1;
+    int v6252 = v6251 + 1;
+    int v6253 = v6252 + 1;
+    int v6254 = v6253 + 1;
+    int v6255 = v6254 + 1;
+    int v6256 = v6255 + 1;
+    int v6257 = v6256 + 1;
+    int v6258 = v6257 + 1;
+    int v6259 = v6258 + 1;
+    int v6260 = v6259 + 1;
+    int v6261 = v6260 + 1;
+    int v6262 = v6261 + 1;
+    int v6263 = v6262 + 1;
+    int v6264 = v6263 + 1;
+    int v6265 = v6264 + 1;
+    int v6266 = v6265 + 1;
+    int v6267 = v6266 + 1;
+    int v6268 = v6267 + 1;
+    int v6269 = v6268 + 1;
+    int v6270 = v6269 + 1;
+    int v6271 = v6270 + 1;
+    int v6272 = v6271 + 1;
+    int v6273 = v6272 + 1;
+    int v6274 = v6273 + 1;
+    int v6275 = v6274 + 1;
+    int v6276 = v6275 + 1;
+    int v6277 = v6276 + 1;
+    int v6278 = v6277 + 1;
+    int v6279 = v6278 + 1;
+    int v6280 = v6279 + 1;
+    int v6281 = v6280 + 1;
+    int v6282 = v6281 + 1;
+    int v6283 = v6282 + 1;
+    int v6284 = v6283 + 1;
+    int v6285 = v6284 + 1;
+    int v6286 = v6285 + 1;
+    int v6287 = v6286 + 1;
+    int v6288 = v6287 + 1;
+    int v6289 = v6288 + 1;
+    int v6290 = v6289 + 1;
+    int v6291 = v6290 + 1;
+    int v6292 = v6291 + 1;
+    int v6293 = v6292 + 1;
+    int v6294 = v6293 + 1;
+    int v6295 = v6294 + 1;
+    int v6296 = v6295 + 1;
+    int v6297 = v6296 + 1;
+    int v6298 = v6297 + 1;
+    int v6299 = v6298 + 1;
+    int v6300 = v6299 + 1;
+    int v6301 = v6300 + 1;
+    int v6302 = v6301 + 1;
+    int v6303 = v6302 + 1;
+    int v6304 = v6303 + 1;
+    int v6305 = v6304 + 1;
+    int v6306 = v6305 + 1;
+    int v6307 = v6306 + 1;
+    int v6308 = v6307 + 1;
+    int v6309 = v6308 + 1;
+    int v6310 = v6309 + 1;
+    int v6311 = v6310 + 1;
+    int v6312 = v6311 + 1;
+    int v6313 = v6312 + 1;
+    int v6314 = v6313 + 1;
+    int v6315 = v6314 + 1;
+    int v6316 = v6315 + 1;
+    int v6317 = v6316 + 1;
+    int v6318 = v6317 + 1;
+    int v6319 = v6318 + 1;
+    int v6320 = v6319 + 1;
+    int v6321 = v6320 + 1;
+    int v6322 = v6321 + 1;
+    int v6323 = v6322 + 1;
+    int v6324 = v6323 + 1;
+    int v6325 = v6324 + 1;
+    int v6326 = v6325 + 1;
+    int v6327 = v6326 + 1;
+    int v6328 = v6327 + 1;
+    int v6329 = v6328 + 1;
+    int v6330 = v6329 + 1;
+    int v6331 = v6330 + 1;
+    int v6332 = v6331 + 1;
+    int v6333 = v6332 + 1;
+    int v6334 = v6333 + 1;
+    int v6335 = v6334 + 1;
+    int v6336 = v6335 + 1;
+    int v6337 = v6336 + 1;
+    int v6338 = v6337 + 1;
+    int v6339 = v6338 + 1;
+    int v6340 = v6339 + 1;
+    int v6341 = v6340 + 1;
+    int v6342 = v6341 + 1;
+    int v6343 = v6342 + 1;
+    int v6344 = v6343 + 1;
+    int v6345 = v6344 + 1;
+    int v6346 = v6345 + 1;
+    int v6347 = v6346 + 1;
+    int v6348 = v6347 + 1;
+    int v6349 = v6348 + 1;
+    int v6350 = v6349 + 1;
+    int v6351 = v6350 + 1;
+    int v6352 = v6351 + 1;
+    int v6353 = v6352 + 1;
+    int v6354 = v6353 + 1;
+    int v6355 = v6354 + 1;
+    int v6356 = v6355 + 1;
+    int v6357 = v6356 + 1;
+    int v6358 = v6357 + 1;
+    int v6359 = v6358 + 1;
+    int v6360 = v6359 + 1;
+    int v6361 = v6360 + 1;
+    int v6362 = v6361 + 1;
+    int v6363 = v6362 + 1;
+    int v6364 = v6363 + 1;
+    int v6365 = v6364 + 1;
+    int v6366 = v6365 + 1;
+    int v6367 = v6366 + 1;
+    int v6368 = v6367 + 1;
+    int v6369 = v6368 + 1;
+    int v6370 = v6369 + 1;
+    int v6371 = v6370 + 1;
+    int v6372 = v6371 + 1;
+    int v6373 = v6372 + 1;
+    int v6374 = v6373 + 1;
+    int v6375 = v6374 + 1;
+    int v6376 = v6375 + 1;
+    int v6377 = v6376 + 1;
+    int v6378 = v6377 + 1;
+    int v6379 = v6378 + 1;
+    int v6380 = v6379 + 1;
+    int v6381 = v6380 + 1;
+    int v6382 = v6381 + 1;
+    int v6383 = v6382 + 1;
+    int v6384 = v6383 + 1;
+    int v6385 = v6384 + 1;
+    int v6386 = v6385 + 1;
+    int v6387 = v6386 + 1;
+    int v6388 = v6387 + 1;
+    int v6389 = v6388 + 1;
+    int v6390 = v6389 + 1;
+    int v6391 = v6390 + 1;
+    int v6392 = v6391 + 1;
+    int v6393 = v6392 + 1;
+    int v6394 = v6393 + 1;
+    int v6395 = v6394 + 1;
+    int v6396 = v6395 + 1;
+    int v6397 = v6396 + 1;
+    int v6398 = v6397 + 1;
+    int v6399 = v6398 + 1;
+    int v6400 = v6399 + 1;
+    int v6401 = v6400 + 1;
+    int v6402 = v6401 + 1;
+    int v6403 = v6402 + 1;
+    int v6404 = v6403 + 1;
+    int v6405 = v6404 + 1;
+    int v6406 = v6405 + 1;
+    int v6407 = v6406 + 1;
+    int v6408 = v6407 + 1;
+    int v6409 = v6408 + 1;
+    int v6410 = v6409 + 1;
+    int v6411 = v6410 + 1;
+    int v6412 = v6411 + 1;
+    int v6413 = v6412 + 1;
+    int v6414 = v6413 + 1;
+    int v6415 = v6414 + 1;
+    int v6416 = v6415 + 1;
+    int v6417 = v6416 + 1;
+    int v6418 = v6417 + 1;
+    int v6419 = v6418 + 1;
+    int v6420 = v6419 + 1;
+    int v6421 = v6420 + 1;
+    int v6422 = v6421 + 1;
+    int v6423 = v6422 + 1;
+    int v6424 = v6423 + 1;
+    int v6425 = v6424 + 1;
+    int v6426 = v6425 + 1;
+    int v6427 = v6426 + 1;
+    int v6428 = v6427 + 1;
+    int v6429 = v6428 + 1;
+    int v6430 = v6429 + 1;
+    int v6431 = v6430 + 1;
+    int v6432 = v6431 + 1;
+    int v6433 = v6432 + 1;
+    int v6434 = v6433 + 1;
+    int v6435 = v6434 + 1;
+    int v6436 = v6435 + 1;
+    int v6437 = v6436 + 1;
+    int v6438 = v6437 + 1;
+    int v6439 = v6438 + 1;
+    int v6440 = v6439 + 1;
+    int v6441 = v6440 + 1;
+    int v6442 = v6441 + 1;
+    int v6443 = v6442 + 1;
+    int v6444 = v6443 + 1;
+    int v6445 = v6444 + 1;
+    int v6446 = v6445 + 1;
+    int v6447 = v6446 + 1;
+    int v6448 = v6447 + 1;
+    int v6449 = v6448 + 1;
+    int v6450 = v6449 + 1;
+    int v6451 = v6450 + 1;
+    int v6452 = v6451 + 1;
+    int v6453 = v6452 + 1;
+    int v6454 = v6453 + 1;
+    int v6455 = v6454 + 1;
+    int v6456 = v6455 + 1;
+    int v6457 = v6456 + 1;
+    int v6458 = v6457 + 1;
+    int v6459 = v6458 + 1;
+    int v6460 = v6459 + 1;
+    int v6461 = v6460 + 1;
+    int v6462 = v6461 + 1;
+    int v6463 = v6462 + 1;
+    int v6464 = v6463 + 1;
+    int v6465 = v6464 + 1;
+    int v6466 = v6465 + 1;
+    int v6467 = v6466 + 1;
+    int v6468 = v6467 + 1;
+    int v6469 = v6468 + 1;
+    int v6470 = v6469 + 1;
+    int v6471 = v6470 + 1;
+    int v6472 = v6471 + 1;
+    int v6473 = v6472 + 1;
+    int v6474 = v6473 + 1;
+    int v6475 = v6474 + 1;
+    int v6476 = v6475 + 1;
+    int v6477 = v6476 + 1;
+    int v6478 = v6477 + 1;
+    int v6479 = v6478 + 1;
+    int v6480 = v6479 + 1;
+    int v6481 = v6480 + 1;
+    int v6482 = v6481 + 1;
+    int v6483 = v6482 + 1;
+    int v6484 = v6483 + 1;
+    int v6485 = v6484 + 1;
+    int v6486 = v6485 + 1;
+    int v6487 = v6486 + 1;
+    int v6488 = v6487 + 1;
+    int v6489 = v6488 + 1;
+    int v6490 = v6489 + 1;
+    int v6491 = v6490 + 1;
+    int v6492 = v6491 + 1;
+    int v6493 = v6492 + 1;
+    int v6494 = v6493 + 1;
+    int v6495 = v6494 + 1;
+    int v6496 = v6495 + 1;
+    int v6497 = v6496 + 1;
+    int v6498 = v6497 + 1;
+    int v6499 = v6498 + 1;
+    int v6500 = v6499 + 1;
+    int v6501 = v6500 + 1;
+    int v6502 = v6501 + 1;
+    int v6503 = v6502 + 1;
+    int v6504 = v6503 + 1;
+    int v6505 = v6504 + 1;
+    int v6506 = v6505 + 1;
+    int v6507 = v6506 + 1;
+    int v6508 = v6507 + 1;
+    int v6509 = v6508 + 1;
+    int v6510 = v6509 + 1;
+    int v6511 = v6510 + 1;
+    int v6512 = v6511 + 1;
+    int v6513 = v6512 + 1;
+    int v6514 = v6513 + 1;
+    int v6515 = v6514 + 1;
+    int v6516 = v6515 + 1;
+    int v6517 = v6516 + 1;
+    int v6518 = v6517 + 1;
+    int v6519 = v6518 + 1;
+    int v6520 = v6519 + 1;
+    int v6521 = v6520 + 1;
+    int v6522 = v6521 + 1;
+    int v6523 = v6522 + 1;
+    int v6524 = v6523 + 1;
+    int v6525 = v6524 + 1;
+    int v6526 = v6525 + 1;
+    int v6527 = v6526 + 1;
+    int v6528 = v6527 + 1;
+    int v6529 = v6528 + 1;
+    int v6530 = v6529 + 1;
+    int v6531 = v6530 + 1;
+    int v6532 = v6531 + 1;
+    int v6533 = v6532 + 1;
+    int v6534 = v6533 + 1;
+    int v6535 = v6534 + 1;
+    int v6536 = v6535 + 1;
+    int v6537 = v6536 + 1;
+    int v6538 = v6537 + 1;
+    int v6539 = v6538 + 1;
+    int v6540 = v6539 + 1;
+    int v6541 = v6540 + 1;
+    int v6542 = v6541 + 1;
+    int v6543 = v6542 + 1;
+    int v6544 = v6543 + 1;
+    int v6545 = v6544 + 1;
+    int v6546 = v6545 + 1;
+    int v6547 = v6546 + 1;
+    int v6548 = v6547 + 1;
+    int v6549 = v6548 + 1;
+    int v6550 = v6549 + 1;
+    int v6551 = v6550 + 1;
+    int v6552 = v6551 + 1;
+    int v6553 = v6552 + 1;
+    int v6554 = v6553 + 1;
+    int v6555 = v6554 + 1;
+    int v6556 = v6555 + 1;
+    int v6557 = v6556 + 1;
+    int v6558 = v6557 + 1;
+    int v6559 = v6558 + 1;
+    int v6560 = v6559 + 1;
+    int v6561 = v6560 + 1;
+    int v6562 = v6561 + 1;
+    int v6563 = v6562 + 1;
+    int v6564 = v6563 + 1;
+    int v6565 = v6564 + 1;
+    int v6566 = v6565 + 1;
+    int v6567 = v6566 + 1;
+    int v6568 = v6567 + 1;
+    int v6569 = v6568 + 1;
+    int v6570 = v6569 + 1;
+    int v6571 = v6570 + 1;
+    int v6572 = v6571 + 1;
+    int v6573 = v6572 + 1;
+    int v6574 = v6573 + 1;
+    int v6575 = v6574 + 1;
+    int v6576 = v6575 + 1;
+    int v6577 = v6576 + 1;
+    int v6578 = v6577 + 1;
+    int v6579 = v6578 + 1;
+    int v6580 = v6579 + 1;
+    int v6581 = v6580 + 1;
+    int v6582 = v6581 + 1;
+    int v6583 = v6582 + 1;
+    int v6584 = v6583 + 1;
+    int v6585 = v6584 + 1;
+    int v6586 = v6585 + 1;
+    int v6587 = v6586 + 1;
+    int v6588 = v6587 + 1;
+    int v6589 = v6588 + 1;
+    int v6590 = v6589 + 1;
+    int v6591 = v6590 + 1;
+    int v6592 = v6591 + 1;
+    int v6593 = v6592 + 1;
+    int v6594 = v6593 + 1;
+    int v6595 = v6594 + 1;
+    int v6596 = v6595 + 1;
+    int v6597 = v6596 + 1;
+    int v6598 = v6597 + 1;
+    int v6599 = v6598 + 1;
+    int v6600 = v6599 + 1;
+    int v6601 = v6600 + 1;
+    int v6602 = v6601 + 1;
+    int v6603 = v6602 + 1;
+    int v6604 = v6603 + 1;
+    int v6605 = v6604 + 1;
+    int v6606 = v6605 + 1;
+    int v6607 = v6606 + 1;
+    int v6608 = v6607 + 1;
+    int v6609 = v6608 + 1;
+    int v6610 = v6609 + 1;
+    int v6611 = v6610 + 1;
+    int v6612 = v6611 + 1;
+    int v6613 = v6612 + 1;
+    int v6614 = v6613 + 1;
+    int v6615 = v6614 + 1;
+    int v6616 = v6615 + 1;
+    int v6617 = v6616 + 1;
+    int v6618 = v6617 + 1;
+    int v6619 = v6618 + 1;
+    int v6620 = v6619 + 1;
+    int v6621 = v6620 + 1;
+    int v6622 = v6621 + 1;
+    int v6623 = v6622 + 1;
+    int v6624 = v6623 + 1;
+    int v6625 = v6624 + 1;
+    int v6626 = v6625 + 1;
+    int v6627 = v6626 + 1;
+    int v6628 = v6627 + 1;
+    int v6629 = v6628 + 1;
+    int v6630 = v6629 + 1;
+    int v6631 = v6630 + 1;
+    int v6632 = v6631 + 1;
+    int v6633 = v6632 + 1;
+    int v6634 = v6633 + 1;
+    int v6635 = v6634 + 1;
+    int v6636 = v6635 + 1;
+    int v6637 = v6636 + 1;
+    int v6638 = v6637 + 1;
+    int v6639 = v6638 + 1;
+    int v6640 = v6639 + 1;
+    int v6641 = v6640 + 1;
+    int v6642 = v6641 + 1;
+    int v6643 = v6642 + 1;
+    int v6644 = v6643 + 1;
+    int v6645 = v6644 + 1;
+    int v6646 = v6645 + 1;
+    int v6647 = v6646 + 1;
+    int v6648 = v6647 + 1;
+    int v6649 = v6648 + 1;
+    int v6650 = v6649 + 1;
+    int v6651 = v6650 + 1;
+    int v6652 = v6651 + 1;
+    int v6653 = v6652 + 1;
+    int v6654 = v6653 + 1;
+    int v6655 = v6654 + 1;
+    int v6656 = v6655 + 1;
+    int v6657 = v6656 + 1;
+    int v6658 = v6657 + 1;
+    int v6659 = v6658 + 1;
+    int v6660 = v6659 + 1;
+    int v6661 = v6660 + 1;
+    int v6662 = v6661 + 1;
+    int v6663 = v6662 + 1;
+    int v6664 = v6663 + 1;
+    int v6665 = v6664 + 1;
+    int v6666 = v6665 + 1;
+    int v6667 = v6666 + 1;
+    int v6668 = v6667 + 1;
+    int v6669 = v6668 + 1;
+    int v6670 = v6669 + 1;
+    int v6671 = v6670 + 1;
+    int v6672 = v6671 + 1;
+    int v6673 = v6672 + 1;
+    int v6674 = v6673 + 1;
+    int v6675 = v6674 + 1;
+    int v6676 = v6675 + 1;
+    int v6677 = v6676 + 1;
+    int v6678 = v6677 + 1;
+    int v6679 = v6678 + 1;
+    int v6680 = v6679 + 1;
+    int v6681 = v6680 + 1;
+    int v6682 = v6681 + 1;
+    int v6683 = v6682 + 1;
+    int v6684 = v6683 + 1;
+    int v6685 = v6684 + 1;
+    int v6686 = v6685 + 1;
+    int v6687 = v6686 + 1;
+    int v6688 = v6687 + 1;
+    int v6689 = v6688 + 1;
+    int v6690 = v6689 + 1;
+    int v6691 = v6690 + 1;
+    int v6692 = v6691 + 1;
+    int v6693 = v6692 + 1;
+    int v6694 = v6693 + 1;
+    int v6695 = v6694 + 1;
+    int v6696 = v6695 + 1;
+    int v6697 = v6696 + 1;
+    int v6698 = v6697 + 1;
+    int v6699 = v6698 + 1;
+    int v6700 = v6699 + 1;
+    int v6701 = v6700 + 1;
+    int v6702 = v6701 + 1;
+    int v6703 = v6702 + 1;
+    int v6704 = v6703 + 1;
+    int v6705 = v6704 + 1;
+    int v6706 = v6705 + 1;
+    int v6707 = v6706 + 1;
+    int v6708 = v6707 + 1;
+    int v6709 = v6708 + 1;
+    int v6710 = v6709 + 1;
+    int v6711 = v6710 + 1;
+    int v6712 = v6711 + 1;
+    int v6713 = v6712 + 1;
+    int v6714 = v6713 + 1;
+    int v6715 = v6714 + 1;
+    int v6716 = v6715 + 1;
+    int v6717 = v6716 + 1;
+    int v6718 = v6717 + 1;
+    int v6719 = v6718 + 1;
+    int v6720 = v6719 + 1;
+    int v6721 = v6720 + 1;
+    int v6722 = v6721 + 1;
+    int v6723 = v6722 + 1;
+    int v6724 = v6723 + 1;
+    int v6725 = v6724 + 1;
+    int v6726 = v6725 + 1;
+    int v6727 = v6726 + 1;
+    int v6728 = v6727 + 1;
+    int v6729 = v6728 + 1;
+    int v6730 = v6729 + 1;
+    int v6731 = v6730 + 1;
+    int v6732 = v6731 + 1;
+    int v6733 = v6732 + 1;
+    int v6734 = v6733 + 1;
+    int v6735 = v6734 + 1;
+    int v6736 = v6735 + 1;
+    int v6737 = v6736 + 1;
+    int v6738 = v6737 + 1;
+    int v6739 = v6738 + 1;
+    int v6740 = v6739 + 1;
+    int v6741 = v6740 + 1;
+    int v6742 = v6741 + 1;
+    int v6743 = v6742 + 1;
+    int v6744 = v6743 + 1;
+    int v6745 = v6744 + 1;
+    int v6746 = v6745 + 1;
+    int v6747 = v6746 + 1;
+    int v6748 = v6747 + 1;
+    int v6749 = v6748 + 1;
+    int v6750 = v6749 + 1;
+    int v6751 = v6750 + 1;
+    int v6752 = v6751 + 1;
+    int v6753 = v6752 + 1;
+    int v6754 = v6753 + 1;
+    int v6755 = v6754 + 1;
+    int v6756 = v6755 + 1;
+    int v6757 = v6756 + 1;
+    int v6758 = v6757 + 1;
+    int v6759 = v6758 + 1;
+    int v6760 = v6759 + 1;
+    int v6761 = v6760 + 1;
+    int v6762 = v6761 + 1;
+    int v6763 = v6762 + 1;
+    int v6764 = v6763 + 1;
+    int v6765 = v6764 + 1;
+    int v6766 = v6765 + 1;
+    int v6767 = v6766 + 1;
+    int v6768 = v6767 + 1;
+    int v6769 = v6768 + 1;
+    int v6770 = v6769 + 1;
+    int v6771 = v6770 + 1;
+    int v6772 = v6771 + 1;
+    int v6773 = v6772 + 1;
+    int v6774 = v6773 + 1;
+    int v6775 = v6774 + 1;
+    int v6776 = v6775 + 1;
+    int v6777 = v6776 + 1;
+    int v6778 = v6777 + 1;
+    int v6779 = v6778 + 1;
+    int v6780 = v6779 + 1;
+    int v6781 = v6780 + 1;
+    int v6782 = v6781 + 1;
+    int v6783 = v6782 + 1;
+    int v6784 = v6783 + 1;
+    int v6785 = v6784 + 1;
+    int v6786 = v6785 + 1;
+    int v6787 = v6786 + 1;
+    int v6788 = v6787 + 1;
+    int v6789 = v6788 + 1;
+    int v6790 = v6789 + 1;
+    int v6791 = v6790 + 1;
+    int v6792 = v6791 + 1;
+    int v6793 = v6792 + 1;
+    int v6794 = v6793 + 1;
+    int v6795 = v6794 + 1;
+    int v6796 = v6795 + 1;
+    int v6797 = v6796 + 1;
+    int v6798 = v6797 + 1;
+    int v6799 = v6798 + 1;
+    int v6800 = v6799 + 1;
+    int v6801 = v6800 + 1;
+    int v6802 = v6801 + 1;
+    int v6803 = v6802 + 1;
+    int v6804 = v6803 + 1;
+    int v6805 = v6804 + 1;
+    int v6806 = v6805 + 1;
+    int v6807 = v6806 + 1;
+    int v6808 = v6807 + 1;
+    int v6809 = v6808 + 1;
+    int v6810 = v6809 + 1;
+    int v6811 = v6810 + 1;
+    int v6812 = v6811 + 1;
+    int v6813 = v6812 + 1;
+    int v6814 = v6813 + 1;
+    int v6815 = v6814 + 1;
+    int v6816 = v6815 + 1;
+    int v6817 = v6816 + 1;
+    int v6818 = v6817 + 1;
+    int v6819 = v6818 + 1;
+    int v6820 = v6819 + 1;
+    int v6821 = v6820 + 1;
+    int v6822 = v6821 + 1;
+    int v6823 = v6822 + 1;
+    int v6824 = v6823 + 1;
+    int v6825 = v6824 + 1;
+    int v6826 = v6825 + 1;
+    int v6827 = v6826 + 1;
+    int v6828 = v6827 + 1;
+    int v6829 = v6828 + 1;
+    int v6830 = v6829 + 1;
+    int v6831 = v6830 + 1;
+    int v6832 = v6831 + 1;
+    int v6833 = v6832 + 1;
+    int v6834 = v6833 + 1;
+    int v6835 = v6834 + 1;
+    int v6836 = v6835 + 1;
+    int v6837 = v6836 + 1;
+    int v6838 = v6837 + 1;
+    int v6839 = v6838 + 1;
+    int v6840 = v6839 + 1;
+    int v6841 = v6840 + 1;
+    int v6842 = v6841 + 1;
+    int v6843 = v6842 + 1;
+    int v6844 = v6843 + 1;
+    int v6845 = v6844 + 1;
+    int v6846 = v6845 + 1;
+    int v6847 = v6846 + 1;
+    int v6848 = v6847 + 1;
+    int v6849 = v6848 + 1;
+    int v6850 = v6849 + 1;
+    int v6851 = v6850 + 1;
+    int v6852 = v6851 + 1;
+    int v6853 = v6852 + 1;
+    int v6854 = v6853 + 1;
+    int v6855 = v6854 + 1;
+    int v6856 = v6855 + 1;
+    int v6857 = v6856 + 1;
+    int v6858 = v6857 + 1;
+    int v6859 = v6858 + 1;
+    int v6860 = v6859 + 1;
+    int v6861 = v6860 + 1;
+    int v6862 = v6861 + 1;
+    int v6863 = v6862 + 1;
+    int v6864 = v6863 + 1;
+    int v6865 = v6864 + 1;
+    int v6866 = v6865 + 1;
+    int v6867 = v6866 + 1;
+    int v6868 = v6867 + 1;
+    int v6869 = v6868 + 1;
+    int v6870 = v6869 + 1;
+    int v6871 = v6870 + 1;
+    int v6872 = v6871 + 1;
+    int v6873 = v6872 + 1;
+    int v6874 = v6873 + 1;
+    int v6875 = v6874 + 1;
+    int v6876 = v6875 + 1;
+    int v6877 = v6876 + 1;
+    int v6878 = v6877 + 1;
+    int v6879 = v6878 + 1;
+    int v6880 = v6879 + 1;
+    int v6881 = v6880 + 1;
+    int v6882 = v6881 + 1;
+    int v6883 = v6882 + 1;
+    int v6884 = v6883 + 1;
+    int v6885 = v6884 + 1;
+    int v6886 = v6885 + 1;
+    int v6887 = v6886 + 1;
+    int v6888 = v6887 + 1;
+    int v6889 = v6888 + 1;
+    int v6890 = v6889 + 1;
+    int v6891 = v6890 + 1;
+    int v6892 = v6891 + 1;
+    int v6893 = v6892 + 1;
+    int v6894 = v6893 + 1;
+    int v6895 = v6894 + 1;
+    int v6896 = v6895 + 1;
+    int v6897 = v6896 + 1;
+    int v6898 = v6897 + 1;
+    int v6899 = v6898 + 1;
+    int v6900 = v6899 + 1;
+    int v6901 = v6900 + 1;
+    int v6902 = v6901 + 1;
+    int v6903 = v6902 + 1;
+    int v6904 = v6903 + 1;
+    int v6905 = v6904 + 1;
+    int v6906 = v6905 + 1;
+    int v6907 = v6906 + 1;
+    int v6908 = v6907 + 1;
+    int v6909 = v6908 + 1;
+    int v6910 = v6909 + 1;
+    int v6911 = v6910 + 1;
+    int v6912 = v6911 + 1;
+    int v6913 = v6912 + 1;
+    int v6914 = v6913 + 1;
+    int v6915 = v6914 + 1;
+    int v6916 = v6915 + 1;
+    int v6917 = v6916 + 1;
+    int v6918 = v6917 + 1;
+    int v6919 = v6918 + 1;
+    int v6920 = v6919 + 1;
+    int v6921 = v6920 + 1;
+    int v6922 = v6921 + 1;
+    int v6923 = v6922 + 1;
+    int v6924 = v6923 + 1;
+    int v6925 = v6924 + 1;
+    int v6926 = v6925 + 1;
+    int v6927 = v6926 + 1;
+    int v6928 = v6927 + 1;
+    int v6929 = v6928 + 1;
+    int v6930 = v6929 + 1;
+    int v6931 = v6930 + 1;
+    int v6932 = v6931 + 1;
+    int v6933 = v6932 + 1;
+    int v6934 = v6933 + 1;
+    int v6935 = v6934 + 1;
+    int v6936 = v6935 + 1;
+    int v6937 = v6936 + 1;
+    int v6938 = v6937 + 1;
+    int v6939 = v6938 + 1;
+    int v6940 = v6939 + 1;
+    int v6941 = v6940 + 1;
+    int v6942 = v6941 + 1;
+    int v6943 = v6942 + 1;
+    int v6944 = v6943 + 1;
+    int v6945 = v6944 + 1;
+    int v6946 = v6945 + 1;
+    int v6947 = v6946 + 1;
+    int v6948 = v6947 + 1;
+    int v6949 = v6948 + 1;
+    int v6950 = v6949 + 1;
+    int v6951 = v6950 + 1;
+    int v6952 = v6951 + 1;
+    int v6953 = v6952 + 1;
+    int v6954 = v6953 + 1;
+    int v6955 = v6954 + 1;
+    int v6956 = v6955 + 1;
+    int v6957 = v6956 + 1;
+    int v6958 = v6957 + 1;
+    int v6959 = v6958 + 1;
+    int v6960 = v6959 + 1;
+    int v6961 = v6960 + 1;
+    int v6962 = v6961 + 1;
+    int v6963 = v6962 + 1;
+    int v6964 = v6963 + 1;
+    int v6965 = v6964 + 1;
+    int v6966 = v6965 + 1;
+    int v6967 = v6966 + 1;
+    int v6968 = v6967 + 1;
+    int v6969 = v6968 + 1;
+    int v6970 = v6969 + 1;
+    int v6971 = v6970 + 1;
+    int v6972 = v6971 + 1;
+    int v6973 = v6972 + 1;
+    int v6974 = v6973 + 1;
+    int v6975 = v6974 + 1;
+    int v6976 = v6975 + 1;
+    int v6977 = v6976 + 1;
+    int v6978 = v6977 + 1;
+    int v6979 = v6978 + 1;
+    int v6980 = v6979 + 1;
+    int v6981 = v6980 + 1;
+    int v6982 = v6981 + 1;
+    int v6983 = v6982 + 1;
+    int v6984 = v6983 + 1;
+    int v6985 = v6984 + 1;
+    int v6986 = v6985 + 1;
+    int v6987 = v6986 + 1;
+    int v6988 = v6987 + 1;
+    int v6989 = v6988 + 1;
+    int v6990 = v6989 + 1;
+    int v6991 = v6990 + 1;
+    int v6992 = v6991 + 1;
+    int v6993 = v6992 + 1;
+    int v6994 = v6993 + 1;
+    int v6995 = v6994 + 1;
+    int v6996 = v6995 + 1;
+    int v6997 = v6996 + 1;
+    int v6998 = v6997 + 1;
+    int v6999 = v6998 + 1;
+    int v7000 = v6999 + 1;
+    int v7001 = v7000 + 1;
+    int v7002 = v7001 + 1;
+    int v7003 = v7002 + 1;
+    int v7004 = v7003 + 1;
+    int v7005 = v7004 + 1;
+    int v7006 = v7005 + 1;
+    int v7007 = v7006 + 1;
+    int v7008 = v7007 + 1;
+    int v7009 = v7008 + 1;
+    int v7010 = v7009 + 1;
+    int v7011 = v7010 + 1;
+    int v7012 = v7011 + 1;
+    int v7013 = v7012 + 1;
+    int v7014 = v7013 + 1;
+    int v7015 = v7014 + 1;
+    int v7016 = v7015 + 1;
+    int v7017 = v7016 + 1;
+    int v7018 = v7017 + 1;
+    int v7019 = v7018 + 1;
+    int v7020 = v7019 + 1;
+    int v7021 = v7020 + 1;
+    int v7022 = v7021 + 1;
+    int v7023 = v7022 + 1;
+    int v7024 = v7023 + 1;
+    int v7025 = v7024 + 1;
+    int v7026 = v7025 + 1;
+    int v7027 = v7026 + 1;
+    int v7028 = v7027 + 1;
+    int v7029 = v7028 + 1;
+    int v7030 = v7029 + 1;
+    int v7031 = v7030 + 1;
+    int v7032 = v7031 + 1;
+    int v7033 = v7032 + 1;
+    int v7034 = v7033 + 1;
+    int v7035 = v7034 + 1;
+    int v7036 = v7035 + 1;
+    int v7037 = v7036 + 1;
+    int v7038 = v7037 + 1;
+    int v7039 = v7038 + 1;
+    int v7040 = v7039 + 1;
+    int v7041 = v7040 + 1;
+    int v7042 = v7041 + 1;
+    int v7043 = v7042 + 1;
+    int v7044 = v7043 + 1;
+    int v7045 = v7044 + 1;
+    int v7046 = v7045 + 1;
+    int v7047 = v7046 + 1;
+    int v7048 = v7047 + 1;
+    int v7049 = v7048 + 1;
+    int v7050 = v7049 + 1;
+    int v7051 = v7050 + 1;
+    int v7052 = v7051 + 1;
+    int v7053 = v7052 + 1;
+    int v7054 = v7053 + 1;
+    int v7055 = v7054 + 1;
+    int v7056 = v7055 + 1;
+    int v7057 = v7056 + 1;
+    int v7058 = v7057 + 1;
+    int v7059 = v7058 + 1;
+    int v7060 = v7059 + 1;
+    int v7061 = v7060 + 1;
+    int v7062 = v7061 + 1;
+    int v7063 = v7062 + 1;
+    int v7064 = v7063 + 1;
+    int v7065 = v7064 + 1;
+    int v7066 = v7065 + 1;
+    int v7067 = v7066 + 1;
+    int v7068 = v7067 + 1;
+    int v7069 = v7068 + 1;
+    int v7070 = v7069 + 1;
+    int v7071 = v7070 + 1;
+    int v7072 = v7071 + 1;
+    int v7073 = v7072 + 1;
+    int v7074 = v7073 + 1;
+    int v7075 = v7074 + 1;
+    int v7076 = v7075 + 1;
+    int v7077 = v7076 + 1;
+    int v7078 = v7077 + 1;
+    int v7079 = v7078 + 1;
+    int v7080 = v7079 + 1;
+    int v7081 = v7080 + 1;
+    int v7082 = v7081 + 1;
+    int v7083 = v7082 + 1;
+    int v7084 = v7083 + 1;
+    int v7085 = v7084 + 1;
+    int v7086 = v7085 + 1;
+    int v7087 = v7086 + 1;
+    int v7088 = v7087 + 1;
+    int v7089 = v7088 + 1;
+    int v7090 = v7089 + 1;
+    int v7091 = v7090 + 1;
+    int v7092 = v7091 + 1;
+    int v7093 = v7092 + 1;
+    int v7094 = v7093 + 1;
+    int v7095 = v7094 + 1;
+    int v7096 = v7095 + 1;
+    int v7097 = v7096 + 1;
+    int v7098 = v7097 + 1;
+    int v7099 = v7098 + 1;
+    int v7100 = v7099 + 1;
+    int v7101 = v7100 + 1;
+    int v7102 = v7101 + 1;
+    int v7103 = v7102 + 1;
+    int v7104 = v7103 + 1;
+    int v7105 = v7104 + 1;
+    int v7106 = v7105 + 1;
+    int v7107 = v7106 + 1;
+    int v7108 = v7107 + 1;
+    int v7109 = v7108 + 1;
+    int v7110 = v7109 + 1;
+    int v7111 = v7110 + 1;
+    int v7112 = v7111 + 1;
+    int v7113 = v7112 + 1;
+    int v7114 = v7113 + 1;
+    int v7115 = v7114 + 1;
+    int v7116 = v7115 + 1;
+    int v7117 = v7116 + 1;
+    int v7118 = v7117 + 1;
+    int v7119 = v7118 + 1;
+    int v7120 = v7119 + 1;
+    int v7121 = v7120 + 1;
+    int v7122 = v7121 + 1;
+    int v7123 = v7122 + 1;
+    int v7124 = v7123 + 1;
+    int v7125 = v7124 + 1;
+    int v7126 = v7125 + 1;
+    int v7127 = v7126 + 1;
+    int v7128 = v7127 + 1;
+    int v7129 = v7128 + 1;
+    int v7130 = v7129 + 1;
+    int v7131 = v7130 + 1;
+    int v7132 = v7131 + 1;
+    int v7133 = v7132 + 1;
+    int v7134 = v7133 + 1;
+    int v7135 = v7134 + 1;
+    int v7136 = v7135 + 1;
+    int v7137 = v7136 + 1;
+    int v7138 = v7137 + 1;
+    int v7139 = v7138 + 1;
+    int v7140 = v7139 + 1;
+    int v7141 = v7140 + 1;
+    int v7142 = v7141 + 1;
+    int v7143 = v7142 + 1;
+    int v7144 = v7143 + 1;
+    int v7145 = v7144 + 1;
+    int v7146 = v7145 + 1;
+    int v7147 = v7146 + 1;
+    int v7148 = v7147 + 1;
+    int v7149 = v7148 + 1;
+    int v7150 = v7149 + 1;
+    int v7151 = v7150 + 1;
+    int v7152 = v7151 + 1;
+    int v7153 = v7152 + 1;
+    int v7154 = v7153 + 1;
+    int v7155 = v7154 + 1;
+    int v7156 = v7155 + 1;
+    int v7157 = v7156 + 1;
+    int v7158 = v7157 + 1;
+    int v7159 = v7158 + 1;
+    int v7160 = v7159 + 1;
+    int v7161 = v7160 + 1;
+    int v7162 = v7161 + 1;
+    int v7163 = v7162 + 1;
+    int v7164 = v7163 + 1;
+    int v7165 = v7164 + 1;
+    int v7166 = v7165 + 1;
+    int v7167 = v7166 + 1;
+    int v7168 = v7167 + 1;
+    int v7169 = v7168 + 1;
+    int v7170 = v7169 + 1;
+    int v7171 = v7170 + 1;
+    int v7172 = v7171 + 1;
+    int v7173 = v7172 + 1;
+    int v7174 = v7173 + 1;
+    int v7175 = v7174 + 1;
+    int v7176 = v7175 + 1;
+    int v7177 = v7176 + 1;
+    int v7178 = v7177 + 1;
+    int v7179 = v7178 + 1;
+    int v7180 = v7179 + 1;
+    int v7181 = v7180 + 1;
+    int v7182 = v7181 + 1;
+    int v7183 = v7182 + 1;
+    int v7184 = v7183 + 1;
+    int v7185 = v7184 + 1;
+    int v7186 = v7185 + 1;
+    int v7187 = v7186 + 1;
+    int v7188 = v7187 + 1;
+    int v7189 = v7188 + 1;
+    int v7190 = v7189 + 1;
+    int v7191 = v7190 + 1;
+    int v7192 = v7191 + 1;
+    int v7193 = v7192 + 1;
+    int v7194 = v7193 + 1;
+    int v7195 = v7194 + 1;
+    int v7196 = v7195 + 1;
+    int v7197 = v7196 + 1;
+    int v7198 = v7197 + 1;
+    int v7199 = v7198 + 1;
+    int v7200 = v7199 + 1;
+    int v7201 = v7200 + 1;
+    int v7202 = v7201 + 1;
+    int v7203 = v7202 + 1;
+    int v7204 = v7203 + 1;
+    int v7205 = v7204 + 1;
+    int v7206 = v7205 + 1;
+    int v7207 = v7206 + 1;
+    int v7208 = v7207 + 1;
+    int v7209 = v7208 + 1;
+    int v7210 = v7209 + 1;
+    int v7211 = v7210 + 1;
+    int v7212 = v7211 + 1;
+    int v7213 = v7212 + 1;
+    int v7214 = v7213 + 1;
+    int v7215 = v7214 + 1;
+    int v7216 = v7215 + 1;
+    int v7217 = v7216 + 1;
+    int v7218 = v7217 + 1;
+    int v7219 = v7218 + 1;
+    int v7220 = v7219 + 1;
+    int v7221 = v7220 + 1;
+    int v7222 = v7221 + 1;
+    int v7223 = v7222 + 1;
+    int v7224 = v7223 + 1;
+    int v7225 = v7224 + 1;
+    int v7226 = v7225 + 1;
+    int v7227 = v7226 + 1;
+    int v7228 = v7227 + 1;
+    int v7229 = v7228 + 1;
+    int v7230 = v7229 + 1;
+    int v7231 = v7230 + 1;
+    int v7232 = v7231 + 1;
+    int v7233 = v7232 + 1;
+    int v7234 = v7233 + 1;
+    int v7235 = v7234 + 1;
+    int v7236 = v7235 + 1;
+    int v7237 = v7236 + 1;
+    int v7238 = v7237 + 1;
+    int v7239 = v7238 + 1;
+    int v7240 = v7239 + 1;
+    int v7241 = v7240 + 1;
+    int v7242 = v7241 + 1;
+    int v7243 = v7242 + 1;
+    int v7244 = v7243 + 1;
+    int v7245 = v7244 + 1;
+    int v7246 = v7245 + 1;
+    int v7247 = v7246 + 1;
+    int v7248 = v7247 + 1;
+    int v7249 = v7248 + 1;
+    int v7250 = v7249 + 1;
+    int v7251 = v7250 + 1;
+    int v7252 = v7251 + 1;
+    int v7253 = v7252 + 1;
+    int v7254 = v7253 + 1;
+    int v7255 = v7254 + 1;
+    int v7256 = v7255 + 1;
+    int v7257 = v7256 + 1;
+    int v7258 = v7257 + 1;
+    int v7259 = v7258 + 1;
+    int v7260 = v7259 + 1;
+    int v7261 = v7260 + 1;
+    int v7262 = v7261 + 1;
+    int v7263 = v7262 + 1;
+    int v7264 = v7263 + 1;
+    int v7265 = v7264 + 1;
+    int v7266 = v7265 + 1;
+    int v7267 = v7266 + 1;
+    int v7268 = v7267 + 1;
+    int v7269 = v7268 + 1;
+    int v7270 = v7269 + 1;
+    int v7271 = v7270 + 1;
+    int v7272 = v7271 + 1;
+    int v7273 = v7272 + 1;
+    int v7274 = v7273 + 1;
+    int v7275 = v7274 + 1;
+    int v7276 = v7275 + 1;
+    int v7277 = v7276 + 1;
+    int v7278 = v7277 + 1;
+    int v7279 = v7278 + 1;
+    int v7280 = v7279 + 1;
+    int v7281 = v7280 + 1;
+    int v7282 = v7281 + 1;
+    int v7283 = v7282 + 1;
+    int v7284 = v7283 + 1;
+    int v7285 = v7284 + 1;
+    int v7286 = v7285 + 1;
+    int v7287 = v7286 + 1;
+    int v7288 = v7287 + 1;
+    int v7289 = v7288 + 1;
+    int v7290 = v7289 + 1;
+    int v7291 = v7290 + 1;
+    int v7292 = v7291 + 1;
+    int v7293 = v7292 + 1;
+    int v7294 = v7293 + 1;
+    int v7295 = v7294 + 1;
+    int v7296 = v7295 + 1;
+    int v7297 = v7296 + 1;
+    int v7298 = v7297 + 1;
+    int v7299 = v7298 + 1;
+    int v7300 = v7299 + 1;
+    int v7301 = v7300 + 1;
+    int v7302 = v7301 + 1;
+    int v7303 = v7302 + 1;
+    int v7304 = v7303 + 1;
+    int v7305 = v7304 + 1;
+    int v7306 = v7305 + 1;
+    int v7307 = v7306 + 1;
+    int v7308 = v7307 + 1;
+    int v7309 = v7308 + 1;
+    int v7310 = v7309 + 1;
+    int v7311 = v7310 + 1;
+    int v7312 = v7311 + 1;
+    int v7313 = v7312 + 1;
+    int v7314 = v7313 + 1;
+    int v7315 = v7314 + 1;
+    int v7316 = v7315 + 1;
+    int v7317 = v7316 + 1;
+    int v7318 = v7317 + 1;
+    int v7319 = v7318 + 1;
+    int v7320 = v7319 + 1;
+    int v7321 = v7320 + 1;
+    int v7322 = v7321 + 1;
+    int v7323 = v7322 + 1;
+    int v7324 = v7323 + 1;
+    int v7325 = v7324 + 1;
+    int v7326 = v7325 + 1;
+    int v7327 = v7326 + 1;
+    int v7328 = v7327 + 1;
+    int v7329 = v7328 + 1;
+    int v7330 = v7329 + 1;
+    int v7331 = v7330 + 1;
+    int v7332 = v7331 + 1;
+    int v7333 = v7332 + 1;
+    int v7334 = v7333 + 1;
+    int v7335 = v7334 + 1;
+    int v7336 = v7335 + 1;
+    int v7337 = v7336 + 1;
+    int v7338 = v7337 + 1;
+    int v7339 = v7338 + 1;
+    int v7340 = v7339 + 1;
+    int v7341 = v7340 + 1;
+    int v7342 = v7341 + 1;
+    int v7343 = v7342 + 1;
+    int v7344 = v7343 + 1;
+    int v7345 = v7344 + 1;
+    int v7346 = v7345 + 1;
+    int v7347 = v7346 + 1;
+    int v7348 = v7347 + 1;
+    int v7349 = v7348 + 1;
+    int v7350 = v7349 + 1;
+    int v7351 = v7350 + 1;
+    int v7352 = v7351 + 1;
+    int v7353 = v7352 + 1;
+    int v7354 = v7353 + 1;
+    int v7355 = v7354 + 1;
+    int v7356 = v7355 + 1;
+    int v7357 = v7356 + 1;
+    int v7358 = v7357 + 1;
+    int v7359 = v7358 + 1;
+    int v7360 = v7359 + 1;
+    int v7361 = v7360 + 1;
+    int v7362 = v7361 + 1;
+    int v7363 = v7362 + 1;
+    int v7364 = v7363 + 1;
+    int v7365 = v7364 + 1;
+    int v7366 = v7365 + 1;
+    int v7367 = v7366 + 1;
+    int v7368 = v7367 + 1;
+    int v7369 = v7368 + 1;
+    int v7370 = v7369 + 1;
+    int v7371 = v7370 + 1;
+    int v7372 = v7371 + 1;
+    int v7373 = v7372 + 1;
+    int v7374 = v7373 + 1;
+    int v7375 = v7374 + 1;
+    int v7376 = v7375 + 1;
+    int v7377 = v7376 + 1;
+    int v7378 = v7377 + 1;
+    int v7379 = v7378 + 1;
+    int v7380 = v7379 + 1;
+    int v7381 = v7380 + 1;
+    int v7382 = v7381 + 1;
+    int v7383 = v7382 + 1;
+    int v7384 = v7383 + 1;
+    int v7385 = v7384 + 1;
+    int v7386 = v7385 + 1;
+    int v7387 = v7386 + 1;
+    int v7388 = v7387 + 1;
+    int v7389 = v7388 + 1;
+    int v7390 = v7389 + 1;
+    int v7391 = v7390 + 1;
+    int v7392 = v7391 + 1;
+    int v7393 = v7392 + 1;
+    int v7394 = v7393 + 1;
+    int v7395 = v7394 + 1;
+    int v7396 = v7395 + 1;
+    int v7397 = v7396 + 1;
+    int v7398 = v7397 + 1;
+    int v7399 = v7398 + 1;
+    int v7400 = v7399 + 1;
+    int v7401 = v7400 + 1;
+    int v7402 = v7401 + 1;
+    int v7403 = v7402 + 1;
+    int v7404 = v7403 + 1;
+    int v7405 = v7404 + 1;
+    int v7406 = v7405 + 1;
+    int v7407 = v7406 + 1;
+    int v7408 = v7407 + 1;
+    int v7409 = v7408 + 1;
+    int v7410 = v7409 + 1;
+    int v7411 = v7410 + 1;
+    int v7412 = v7411 + 1;
+    int v7413 = v7412 + 1;
+    int v7414 = v7413 + 1;
+    int v7415 = v7414 + 1;
+    int v7416 = v7415 + 1;
+    int v7417 = v7416 + 1;
+    int v7418 = v7417 + 1;
+    int v7419 = v7418 + 1;
+    int v7420 = v7419 + 1;
+    int v7421 = v7420 + 1;
+    int v7422 = v7421 + 1;
+    int v7423 = v7422 + 1;
+    int v7424 = v7423 + 1;
+    int v7425 = v7424 + 1;
+    int v7426 = v7425 + 1;
+    int v7427 = v7426 + 1;
+    int v7428 = v7427 + 1;
+    int v7429 = v7428 + 1;
+    int v7430 = v7429 + 1;
+    int v7431 = v7430 + 1;
+    int v7432 = v7431 + 1;
+    int v7433 = v7432 + 1;
+    int v7434 = v7433 + 1;
+    int v7435 = v7434 + 1;
+    int v7436 = v7435 + 1;
+    int v7437 = v7436 + 1;
+    int v7438 = v7437 + 1;
+    int v7439 = v7438 + 1;
+    int v7440 = v7439 + 1;
+    int v7441 = v7440 + 1;
+    int v7442 = v7441 + 1;
+    int v7443 = v7442 + 1;
+    int v7444 = v7443 + 1;
+    int v7445 = v7444 + 1;
+    int v7446 = v7445 + 1;
+    int v7447 = v7446 + 1;
+    int v7448 = v7447 + 1;
+    int v7449 = v7448 + 1;
+    int v7450 = v7449 + 1;
+    int v7451 = v7450 + 1;
+    int v7452 = v7451 + 1;
+    int v7453 = v7452 + 1;
+    int v7454 = v7453 + 1;
+    int v7455 = v7454 + 1;
+    int v7456 = v7455 + 1;
+    int v7457 = v7456 + 1;
+    int v7458 = v7457 + 1;
+    int v7459 = v7458 + 1;
+    int v7460 = v7459 + 1;
+    int v7461 = v7460 + 1;
+    int v7462 = v7461 + 1;
+    int v7463 = v7462 + 1;
+    int v7464 = v7463 + 1;
+    int v7465 = v7464 + 1;
+    int v7466 = v7465 + 1;
+    int v7467 = v7466 + 1;
+    int v7468 = v7467 + 1;
+    int v7469 = v7468 + 1;
+    int v7470 = v7469 + 1;
+    int v7471 = v7470 + 1;
+    int v7472 = v7471 + 1;
+    int v7473 = v7472 + 1;
+    int v7474 = v7473 + 1;
+    int v7475 = v7474 + 1;
+    int v7476 = v7475 + 1;
+    int v7477 = v7476 + 1;
+    int v7478 = v7477 + 1;
+    int v7479 = v7478 + 1;
+    int v7480 = v7479 + 1;
+    int v7481 = v7480 + 1;
+    int v7482 = v7481 + 1;
+    int v7483 = v7482 + 1;
+    int v7484 = v7483 + 1;
+    int v7485 = v7484 + 1;
+    int v7486 = v7485 + 1;
+    int v7487 = v7486 + 1;
+    int v7488 = v7487 + 1;
+    int v7489 = v7488 + 1;
+    int v7490 = v7489 + 1;
+    int v7491 = v7490 + 1;
+    int v7492 = v7491 + 1;
+    int v7493 = v7492 + 1;
+    int v7494 = v7493 + 1;
+    int v7495 = v7494 + 1;
+    int v7496 = v7495 + 1;
+    int v7497 = v7496 + 1;
+    int v7498 = v7497 + 1;
+    int v7499 = v7498 + 1;
+    int v7500 = v7499 + 1;
+    int v7501 = v7500 + 1;
+    int v7502 = v7501 + 1;
+    int v7503 = v7502 + 1;
+    int v7504 = v7503 + 1;
+    int v7505 = v7504 + 1;
+    int v7506 = v7505 + 1;
+    int v7507 = v7506 + 1;
+    int v7508 = v7507 + 1;
+    int v7509 = v7508 + 1;
+    int v7510 = v7509 + 1;
+    int v7511 = v7510 + 1;
+    int v7512 = v7511 + 1;
+    int v7513 = v7512 + 1;
+    int v7514 = v7513 + 1;
+    int v7515 = v7514 + 1;
+    int v7516 = v7515 + 1;
+    int v7517 = v7516 + 1;
+    int v7518 = v7517 + 1;
+    int v7519 = v7518 + 1;
+    int v7520 = v7519 + 1;
+    int v7521 = v7520 + 1;
+    int v7522 = v7521 + 1;
+    int v7523 = v7522 + 1;
+    int v7524 = v7523 + 1;
+    int v7525 = v7524 + 1;
+    int v7526 = v7525 + 1;
+    int v7527 = v7526 + 1;
+    int v7528 = v7527 + 1;
+    int v7529 = v7528 + 1;
+    int v7530 = v7529 + 1;
+    int v7531 = v7530 + 1;
+    int v7532 = v7531 + 1;
+    int v7533 = v7532 + 1;
+    int v7534 = v7533 + 1;
+    int v7535 = v7534 + 1;
+    int v7536 = v7535 + 1;
+    int v7537 = v7536 + 1;
+    int v7538 = v7537 + 1;
+    int v7539 = v7538 + 1;
+    int v7540 = v7539 + 1;
+    int v7541 = v7540 + 1;
+    int v7542 = v7541 + 1;
+    int v7543 = v7542 + 1;
+    int v7544 = v7543 + 1;
+    int v7545 = v7544 + 1;
+    int v7546 = v7545 + 1;
+    int v7547 = v7546 + 1;
+    int v7548 = v7547 + 1;
+    int v7549 = v7548 + 1;
+    int v7550 = v7549 + 1;
+    int v7551 = v7550 + 1;
+    int v7552 = v7551 + 1;
+    int v7553 = v7552 + 1;
+    int v7554 = v7553 + 1;
+    int v7555 = v7554 + 1;
+    int v7556 = v7555 + 1;
+    int v7557 = v7556 + 1;
+    int v7558 = v7557 + 1;
+    int v7559 = v7558 + 1;
+    int v7560 = v7559 + 1;
+    int v7561 = v7560 + 1;
+    int v7562 = v7561 + 1;
+    int v7563 = v7562 + 1;
+    int v7564 = v7563 + 1;
+    int v7565 = v7564 + 1;
+    int v7566 = v7565 + 1;
+    int v7567 = v7566 + 1;
+    int v7568 = v7567 + 1;
+    int v7569 = v7568 + 1;
+    int v7570 = v7569 + 1;
+    int v7571 = v7570 + 1;
+    int v7572 = v7571 + 1;
+    int v7573 = v7572 + 1;
+    int v7574 = v7573 + 1;
+    int v7575 = v7574 + 1;
+    int v7576 = v7575 + 1;
+    int v7577 = v7576 + 1;
+    int v7578 = v7577 + 1;
+    int v7579 = v7578 + 1;
+    int v7580 = v7579 + 1;
+    int v7581 = v7580 + 1;
+    int v7582 = v7581 + 1;
+    int v7583 = v7582 + 1;
+    int v7584 = v7583 + 1;
+    int v7585 = v7584 + 1;
+    int v7586 = v7585 + 1;
+    int v7587 = v7586 + 1;
+    int v7588 = v7587 + 1;
+    int v7589 = v7588 + 1;
+    int v7590 = v7589 + 1;
+    int v7591 = v7590 + 1;
+    int v7592 = v7591 + 1;
+    int v7593 = v7592 + 1;
+    int v7594 = v7593 + 1;
+    int v7595 = v7594 + 1;
+    int v7596 = v7595 + 1;
+    int v7597 = v7596 + 1;
+    int v7598 = v7597 + 1;
+    int v7599 = v7598 + 1;
+    int v7600 = v7599 + 1;
+    int v7601 = v7600 + 1;
+    int v7602 = v7601 + 1;
+    int v7603 = v7602 + 1;
+    int v7604 = v7603 + 1;
+    int v7605 = v7604 + 1;
+    int v7606 = v7605 + 1;
+    int v7607 = v7606 + 1;
+    int v7608 = v7607 + 1;
+    int v7609 = v7608 + 1;
+    int v7610 = v7609 + 1;
+    int v7611 = v7610 + 1;
+    int v7612 = v7611 + 1;
+    int v7613 = v7612 + 1;
+    int v7614 = v7613 + 1;
+    int v7615 = v7614 + 1;
+    int v7616 = v7615 + 1;
+    int v7617 = v7616 + 1;
+    int v7618 = v7617 + 1;
+    int v7619 = v7618 + 1;
+    int v7620 = v7619 + 1;
+    int v7621 = v7620 + 1;
+    int v7622 = v7621 + 1;
+    int v7623 = v7622 + 1;
+    int v7624 = v7623 + 1;
+    int v7625 = v7624 + 1;
+    int v7626 = v7625 + 1;
+    int v7627 = v7626 + 1;
+    int v7628 = v7627 + 1;
+    int v7629 = v7628 + 1;
+    int v7630 = v7629 + 1;
+    int v7631 = v7630 + 1;
+    int v7632 = v7631 + 1;
+    int v7633 = v7632 + 1;
+    int v7634 = v7633 + 1;
+    int v7635 = v7634 + 1;
+    int v7636 = v7635 + 1;
+    int v7637 = v7636 + 1;
+    int v7638 = v7637 + 1;
+    int v7639 = v7638 + 1;
+    int v7640 = v7639 + 1;
+    int v7641 = v7640 + 1;
+    int v7642 = v7641 + 1;
+    int v7643 = v7642 + 1;
+    int v7644 = v7643 + 1;
+    int v7645 = v7644 + 1;
+    int v7646 = v7645 + 1;
+    int v7647 = v7646 + 1;
+    int v7648 = v7647 + 1;
+    int v7649 = v7648 + 1;
+    int v7650 = v7649 + 1;
+    int v7651 = v7650 + 1;
+    int v7652 = v7651 + 1;
+    int v7653 = v7652 + 1;
+    int v7654 = v7653 + 1;
+    int v7655 = v7654 + 1;
+    int v7656 = v7655 + 1;
+    int v7657 = v7656 + 1;
+    int v7658 = v7657 + 1;
+    int v7659 = v7658 + 1;
+    int v7660 = v7659 + 1;
+    int v7661 = v7660 + 1;
+    int v7662 = v7661 + 1;
+    int v7663 = v7662 + 1;
+    int v7664 = v7663 + 1;
+    int v7665 = v7664 + 1;
+    int v7666 = v7665 + 1;
+    int v7667 = v7666 + 1;
+    int v7668 = v7667 + 1;
+    int v7669 = v7668 + 1;
+    int v7670 = v7669 + 1;
+    int v7671 = v7670 + 1;
+    int v7672 = v7671 + 1;
+    int v7673 = v7672 + 1;
+    int v7674 = v7673 + 1;
+    int v7675 = v7674 + 1;
+    int v7676 = v7675 + 1;
+    int v7677 = v7676 + 1;
+    int v7678 = v7677 + 1;
+    int v7679 = v7678 + 1;
+    int v7680 = v7679 + 1;
+    int v7681 = v7680 + 1;
+    int v7682 = v7681 + 1;
+    int v7683 = v7682 + 1;
+    int v7684 = v7683 + 1;
+    int v7685 = v7684 + 1;
+    int v7686 = v7685 + 1;
+    int v7687 = v7686 + 1;
+    int v7688 = v7687 + 1;
+    int v7689 = v7688 + 1;
+    int v7690 = v7689 + 1;
+    int v7691 = v7690 + 1;
+    int v7692 = v7691 + 1;
+    int v7693 = v7692 + 1;
+    int v7694 = v7693 + 1;
+    int v7695 = v7694 + 1;
+    int v7696 = v7695 + 1;
+    int v7697 = v7696 + 1;
+    int v7698 = v7697 + 1;
+    int v7699 = v7698 + 1;
+    int v7700 = v7699 + 1;
+    int v7701 = v7700 + 1;
+    int v7702 = v7701 + 1;
+    int v7703 = v7702 + 1;
+    int v7704 = v7703 + 1;
+    int v7705 = v7704 + 1;
+    int v7706 = v7705 + 1;
+    int v7707 = v7706 + 1;
+    int v7708 = v7707 + 1;
+    int v7709 = v7708 + 1;
+    int v7710 = v7709 + 1;
+    int v7711 = v7710 + 1;
+    int v7712 = v7711 + 1;
+    int v7713 = v7712 + 1;
+    int v7714 = v7713 + 1;
+    int v7715 = v7714 + 1;
+    int v7716 = v7715 + 1;
+    int v7717 = v7716 + 1;
+    int v7718 = v7717 + 1;
+    int v7719 = v7718 + 1;
+    int v7720 = v7719 + 1;
+    int v7721 = v7720 + 1;
+    int v7722 = v7721 + 1;
+    int v7723 = v7722 + 1;
+    int v7724 = v7723 + 1;
+    int v7725 = v7724 + 1;
+    int v7726 = v7725 + 1;
+    int v7727 = v7726 + 1;
+    int v7728 = v7727 + 1;
+    int v7729 = v7728 + 1;
+    int v7730 = v7729 + 1;
+    int v7731 = v7730 + 1;
+    int v7732 = v7731 + 1;
+    int v7733 = v7732 + 1;
+    int v7734 = v7733 + 1;
+    int v7735 = v7734 + 1;
+    int v7736 = v7735 + 1;
+    int v7737 = v7736 + 1;
+    int v7738 = v7737 + 1;
+    int v7739 = v7738 + 1;
+    int v7740 = v7739 + 1;
+    int v7741 = v7740 + 1;
+    int v7742 = v7741 + 1;
+    int v7743 = v7742 + 1;
+    int v7744 = v7743 + 1;
+    int v7745 = v7744 + 1;
+    int v7746 = v7745 + 1;
+    int v7747 = v7746 + 1;
+    int v7748 = v7747 + 1;
+    int v7749 = v7748 + 1;
+    int v7750 = v7749 + 1;
+    int v7751 = v7750 + 1;
+    int v7752 = v7751 + 1;
+    int v7753 = v7752 + 1;
+    int v7754 = v7753 + 1;
+    int v7755 = v7754 + 1;
+    int v7756 = v7755 + 1;
+    int v7757 = v7756 + 1;
+    int v7758 = v7757 + 1;
+    int v7759 = v7758 + 1;
+    int v7760 = v7759 + 1;
+    int v7761 = v7760 + 1;
+    int v7762 = v7761 + 1;
+    int v7763 = v7762 + 1;
+    int v7764 = v7763 + 1;
+    int v7765 = v7764 + 1;
+    int v7766 = v7765 + 1;
+    int v7767 = v7766 + 1;
+    int v7768 = v7767 + 1;
+    int v7769 = v7768 + 1;
+    int v7770 = v7769 + 1;
+    int v7771 = v7770 + 1;
+    int v7772 = v7771 + 1;
+    int v7773 = v7772 + 1;
+    int v7774 = v7773 + 1;
+    int v7775 = v7774 + 1;
+    int v7776 = v7775 + 1;
+    int v7777 = v7776 + 1;
+    int v7778 = v7777 + 1;
+    int v7779 = v7778 + 1;
+    int v7780 = v7779 + 1;
+    int v7781 = v7780 + 1;
+    int v7782 = v7781 + 1;
+    int v7783 = v7782 + 1;
+    int v7784 = v7783 + 1;
+    int v7785 = v7784 + 1;
+    int v7786 = v7785 + 1;
+    int v7787 = v7786 + 1;
+    int v7788 = v7787 + 1;
+    int v7789 = v7788 + 1;
+    int v7790 = v7789 + 1;
+    int v7791 = v7790 + 1;
+    int v7792 = v7791 + 1;
+    int v7793 = v7792 + 1;
+    int v7794 = v7793 + 1;
+    int v7795 = v7794 + 1;
+    int v7796 = v7795 + 1;
+    int v7797 = v7796 + 1;
+    int v7798 = v7797 + 1;
+    int v7799 = v7798 + 1;
+    int v7800 = v7799 + 1;
+    int v7801 = v7800 + 1;
+    int v7802 = v7801 + 1;
+    int v7803 = v7802 + 1;
+    int v7804 = v7803 + 1;
+    int v7805 = v7804 + 1;
+    int v7806 = v7805 + 1;
+    int v7807 = v7806 + 1;
+    int v7808 = v7807 + 1;
+    int v7809 = v7808 + 1;
+    int v7810 = v7809 + 1;
+    int v7811 = v7810 + 1;
+    int v7812 = v7811 + 1;
+    int v7813 = v7812 + 1;
+    int v7814 = v7813 + 1;
+    int v7815 = v7814 + 1;
+    int v7816 = v7815 + 1;
+    int v7817 = v7816 + 1;
+    int v7818 = v7817 + 1;
+    int v7819 = v7818 + 1;
+    int v7820 = v7819 + 1;
+    int v7821 = v7820 + 1;
+    int v7822 = v7821 + 1;
+    int v7823 = v7822 + 1;
+    int v7824 = v7823 + 1;
+    int v7825 = v7824 + 1;
+    int v7826 = v7825 + 1;
+    int v7827 = v7826 + 1;
+    int v7828 = v7827 + 1;
+    int v7829 = v7828 + 1;
+    int v7830 = v7829 + 1;
+    int v7831 = v7830 + 1;
+    int v7832 = v7831 + 1;
+    int v7833 = v7832 + 1;
+    int v7834 = v7833 + 1;
+    int v7835 = v7834 + 1;
+    int v7836 = v7835 + 1;
+    int v7837 = v7836 + 1;
+    int v7838 = v7837 + 1;
+    int v7839 = v7838 + 1;
+    int v7840 = v7839 + 1;
+    int v7841 = v7840 + 1;
+    int v7842 = v7841 + 1;
+    int v7843 = v7842 + 1;
+    int v7844 = v7843 + 1;
+    int v7845 = v7844 + 1;
+    int v7846 = v7845 + 1;
+    int v7847 = v7846 + 1;
+    int v7848 = v7847 + 1;
+    int v7849 = v7848 + 1;
+    int v7850 = v7849 + 1;
+    int v7851 = v7850 + 1;
+    int v7852 = v7851 + 1;
+    int v7853 = v7852 + 1;
+    int v7854 = v7853 + 1;
+    int v7855 = v7854 + 1;
+    int v7856 = v7855 + 1;
+    int v7857 = v7856 + 1;
+    int v7858 = v7857 + 1;
+    int v7859 = v7858 + 1;
+    int v7860 = v7859 + 1;
+    int v7861 = v7860 + 1;
+    int v7862 = v7861 + 1;
+    int v7863 = v7862 + 1;
+    int v7864 = v7863 + 1;
+    int v7865 = v7864 + 1;
+    int v7866 = v7865 + 1;
+    int v7867 = v7866 + 1;
+    int v7868 = v7867 + 1;
+    int v7869 = v7868 + 1;
+    int v7870 = v7869 + 1;
+    int v7871 = v7870 + 1;
+    int v7872 = v7871 + 1;
+    int v7873 = v7872 + 1;
+    int v7874 = v7873 + 1;
+    int v7875 = v7874 + 1;
+    int v7876 = v7875 + 1;
+    int v7877 = v7876 + 1;
+    int v7878 = v7877 + 1;
+    int v7879 = v7878 + 1;
+    int v7880 = v7879 + 1;
+    int v7881 = v7880 + 1;
+    int v7882 = v7881 + 1;
+    int v7883 = v7882 + 1;
+    int v7884 = v7883 + 1;
+    int v7885 = v7884 + 1;
+    int v7886 = v7885 + 1;
+    int v7887 = v7886 + 1;
+    int v7888 = v7887 + 1;
+    int v7889 = v7888 + 1;
+    int v7890 = v7889 + 1;
+    int v7891 = v7890 + 1;
+    int v7892 = v7891 + 1;
+    int v7893 = v7892 + 1;
+    int v7894 = v7893 + 1;
+    int v7895 = v7894 + 1;
+    int v7896 = v7895 + 1;
+    int v7897 = v7896 + 1;
+    int v7898 = v7897 + 1;
+    int v7899 = v7898 + 1;
+    int v7900 = v7899 + 1;
+    int v7901 = v7900 + 1;
+    int v7902 = v7901 + 1;
+    int v7903 = v7902 + 1;
+    int v7904 = v7903 + 1;
+    int v7905 = v7904 + 1;
+    int v7906 = v7905 + 1;
+    int v7907 = v7906 + 1;
+    int v7908 = v7907 + 1;
+    int v7909 = v7908 + 1;
+    int v7910 = v7909 + 1;
+    int v7911 = v7910 + 1;
+    int v7912 = v7911 + 1;
+    int v7913 = v7912 + 1;
+    int v7914 = v7913 + 1;
+    int v7915 = v7914 + 1;
+    int v7916 = v7915 + 1;
+    int v7917 = v7916 + 1;
+    int v7918 = v7917 + 1;
+    int v7919 = v7918 + 1;
+    int v7920 = v7919 + 1;
+    int v7921 = v7920 + 1;
+    int v7922 = v7921 + 1;
+    int v7923 = v7922 + 1;
+    int v7924 = v7923 + 1;
+    int v7925 = v7924 + 1;
+    int v7926 = v7925 + 1;
+    int v7927 = v7926 + 1;
+    int v7928 = v7927 + 1;
+    int v7929 = v7928 + 1;
+    int v7930 = v7929 + 1;
+    int v7931 = v7930 + 1;
+    int v7932 = v7931 + 1;
+    int v7933 = v7932 + 1;
+    int v7934 = v7933 + 1;
+    int v7935 = v7934 + 1;
+    int v7936 = v7935 + 1;
+    int v7937 = v7936 + 1;
+    int v7938 = v7937 + 1;
+    int v7939 = v7938 + 1;
+    int v7940 = v7939 + 1;
+    int v7941 = v7940 + 1;
+    int v7942 = v7941 + 1;
+    int v7943 = v7942 + 1;
+    int v7944 = v7943 + 1;
+    int v7945 = v7944 + 1;
+    int v7946 = v7945 + 1;
+    int v7947 = v7946 + 1;
+    int v7948 = v7947 + 1;
+    int v7949 = v7948 + 1;
+    int v7950 = v7949 + 1;
+    int v7951 = v7950 + 1;
+    int v7952 = v7951 + 1;
+    int v7953 = v7952 + 1;
+    int v7954 = v7953 + 1;
+    int v7955 = v7954 + 1;
+    int v7956 = v7955 + 1;
+    int v7957 = v7956 + 1;
+    int v7958 = v7957 + 1;
+    int v7959 = v7958 + 1;
+    int v7960 = v7959 + 1;
+    int v7961 = v7960 + 1;
+    int v7962 = v7961 + 1;
+    int v7963 = v7962 + 1;
+    int v7964 = v7963 + 1;
+    int v7965 = v7964 + 1;
+    int v7966 = v7965 + 1;
+    int v7967 = v7966 + 1;
+    int v7968 = v7967 + 1;
+    int v7969 = v7968 + 1;
+    int v7970 = v7969 + 1;
+    int v7971 = v7970 + 1;
+    int v7972 = v7971 + 1;
+    int v7973 = v7972 + 1;
+    int v7974 = v7973 + 1;
+    int v7975 = v7974 + 1;
+    int v7976 = v7975 + 1;
+    int v7977 = v7976 + 1;
+    int v7978 = v7977 + 1;
+    int v7979 = v7978 + 1;
+    int v7980 = v7979 + 1;
+    int v7981 = v7980 + 1;
+    int v7982 = v7981 + 1;
+    int v7983 = v7982 + 1;
+    int v7984 = v7983 + 1;
+    int v7985 = v7984 + 1;
+    int v7986 = v7985 + 1;
+    int v7987 = v7986 + 1;
+    int v7988 = v7987 + 1;
+    int v7989 = v7988 + 1;
+    int v7990 = v7989 + 1;
+    int v7991 = v7990 + 1;
+    int v7992 = v7991 + 1;
+    int v7993 = v7992 + 1;
+    int v7994 = v7993 + 1;
+    int v7995 = v7994 + 1;
+    int v7996 = v7995 + 1;
+    int v7997 = v7996 + 1;
+    int v7998 = v7997 + 1;
+    int v7999 = v7998 + 1;
+    int v8000 = v7999 + 1;
+    int v8001 = v8000 + 1;
+    int v8002 = v8001 + 1;
+    int v8003 = v8002 + 1;
+    int v8004 = v8003 + 1;
+    int v8005 = v8004 + 1;
+    int v8006 = v8005 + 1;
+    int v8007 = v8006 + 1;
+    int v8008 = v8007 + 1;
+    int v8009 = v8008 + 1;
+    int v8010 = v8009 + 1;
+    int v8011 = v8010 + 1;
+    int v8012 = v8011 + 1;
+    int v8013 = v8012 + 1;
+    int v8014 = v8013 + 1;
+    int v8015 = v8014 + 1;
+    int v8016 = v8015 + 1;
+    int v8017 = v8016 + 1;
+    int v8018 = v8017 + 1;
+    int v8019 = v8018 + 1;
+    int v8020 = v8019 + 1;
+    int v8021 = v8020 + 1;
+    int v8022 = v8021 + 1;
+    int v8023 = v8022 + 1;
+    int v8024 = v8023 + 1;
+    int v8025 = v8024 + 1;
+    int v8026 = v8025 + 1;
+    int v8027 = v8026 + 1;
+    int v8028 = v8027 + 1;
+    int v8029 = v8028 + 1;
+    int v8030 = v8029 + 1;
+    int v8031 = v8030 + 1;
+    int v8032 = v8031 + 1;
+    int v8033 = v8032 + 1;
+    int v8034 = v8033 + 1;
+    int v8035 = v8034 + 1;
+    int v8036 = v8035 + 1;
+    int v8037 = v8036 + 1;
+    int v8038 = v8037 + 1;
+    int v8039 = v8038 + 1;
+    int v8040 = v8039 + 1;
+    int v8041 = v8040 + 1;
+    int v8042 = v8041 + 1;
+    int v8043 = v8042 + 1;
+    int v8044 = v8043 + 1;
+    int v8045 = v8044 + 1;
+    int v8046 = v8045 + 1;
+    int v8047 = v8046 + 1;
+    int v8048 = v8047 + 1;
+    int v8049 = v8048 + 1;
+    int v8050 = v8049 + 1;
+    int v8051 = v8050 + 1;
+    int v8052 = v8051 + 1;
+    int v8053 = v8052 + 1;
+    int v8054 = v8053 + 1;
+    int v8055 = v8054 + 1;
+    int v8056 = v8055 + 1;
+    int v8057 = v8056 + 1;
+    int v8058 = v8057 + 1;
+    int v8059 = v8058 + 1;
+    int v8060 = v8059 + 1;
+    int v8061 = v8060 + 1;
+    int v8062 = v8061 + 1;
+    int v8063 = v8062 + 1;
+    int v8064 = v8063 + 1;
+    int v8065 = v8064 + 1;
+    int v8066 = v8065 + 1;
+    int v8067 = v8066 + 1;
+    int v8068 = v8067 + 1;
+    int v8069 = v8068 + 1;
+    int v8070 = v8069 + 1;
+    int v8071 = v8070 + 1;
+    int v8072 = v8071 + 1;
+    int v8073 = v8072 + 1;
+    int v8074 = v8073 + 1;
+    int v8075 = v8074 + 1;
+    int v8076 = v8075 + 1;
+    int v8077 = v8076 + 1;
+    int v8078 = v8077 + 1;
+    int v8079 = v8078 + 1;
+    int v8080 = v8079 + 1;
+    int v8081 = v8080 + 1;
+    int v8082 = v8081 + 1;
+    int v8083 = v8082 + 1;
+    int v8084 = v8083 + 1;
+    int v8085 = v8084 + 1;
+    int v8086 = v8085 + 1;
+    int v8087 = v8086 + 1;
+    int v8088 = v8087 + 1;
+    int v8089 = v8088 + 1;
+    int v8090 = v8089 + 1;
+    int v8091 = v8090 + 1;
+    int v8092 = v8091 + 1;
+    int v8093 = v8092 + 1;
+    int v8094 = v8093 + 1;
+    int v8095 = v8094 + 1;
+    int v8096 = v8095 + 1;
+    int v8097 = v8096 + 1;
+    int v8098 = v8097 + 1;
+    int v8099 = v8098 + 1;
+    int v8100 = v8099 + 1;
+    int v8101 = v8100 + 1;
+    int v8102 = v8101 + 1;
+    int v8103 = v8102 + 1;
+    int v8104 = v8103 + 1;
+    int v8105 = v8104 + 1;
+    int v8106 = v8105 + 1;
+    int v8107 = v8106 + 1;
+    int v8108 = v8107 + 1;
+    int v8109 = v8108 + 1;
+    int v8110 = v8109 + 1;
+    int v8111 = v8110 + 1;
+    int v8112 = v8111 + 1;
+    int v8113 = v8112 + 1;
+    int v8114 = v8113 + 1;
+    int v8115 = v8114 + 1;
+    int v8116 = v8115 + 1;
+    int v8117 = v8116 + 1;
+    int v8118 = v8117 + 1;
+    int v8119 = v8118 + 1;
+    int v8120 = v8119 + 1;
+    int v8121 = v8120 + 1;
+    int v8122 = v8121 + 1;
+    int v8123 = v8122 + 1;
+    int v8124 = v8123 + 1;
+    int v8125 = v8124 + 1;
+    int v8126 = v8125 + 1;
+    int v8127 = v8126 + 1;
+    int v8128 = v8127 + 1;
+    int v8129 = v8128 + 1;
+    int v8130 = v8129 + 1;
+    int v8131 = v8130 + 1;
+    int v8132 = v8131 + 1;
+    int v8133 = v8132 + 1;
+    int v8134 = v8133 + 1;
+    int v8135 = v8134 + 1;
+    int v8136 = v8135 + 1;
+    int v8137 = v8136 + 1;
+    int v8138 = v8137 + 1;
+    int v8139 = v8138 + 1;
+    int v8140 = v8139 + 1;
+    int v8141 = v8140 + 1;
+    int v8142 = v8141 + 1;
+    int v8143 = v8142 + 1;
+    int v8144 = v8143 + 1;
+    int v8145 = v8144 + 1;
+    int v8146 = v8145 + 1;
+    int v8147 = v8146 + 1;
+    int v8148 = v8147 + 1;
+    int v8149 = v8148 + 1;
+    int v8150 = v8149 + 1;
+    int v8151 = v8150 + 1;
+    int v8152 = v8151 + 1;
+    int v8153 = v8152 + 1;
+    int v8154 = v8153 + 1;
+    int v8155 = v8154 + 1;
+    int v8156 = v8155 + 1;
+    int v8157 = v8156 + 1;
+    int v8158 = v8157 + 1;
+    int v8159 = v8158 + 1;
+    int v8160 = v8159 + 1;
+    int v8161 = v8160 + 1;
+    int v8162 = v8161 + 1;
+    int v8163 = v8162 + 1;
+    int v8164 = v8163 + 1;
+    int v8165 = v8164 + 1;
+    int v8166 = v8165 + 1;
+    int v8167 = v8166 + 1;
+    int v8168 = v8167 + 1;
+    int v8169 = v8168 + 1;
+    int v8170 = v8169 + 1;
+    int v8171 = v8170 + 1;
+    int v8172 = v8171 + 1;
+    int v8173 = v8172 + 1;
+    int v8174 = v8173 + 1;
+    int v8175 = v8174 + 1;
+    int v8176 = v8175 + 1;
+    int v8177 = v8176 + 1;
+    int v8178 = v8177 + 1;
+    int v8179 = v8178 + 1;
+    int v8180 = v8179 + 1;
+    int v8181 = v8180 + 1;
+    int v8182 = v8181 + 1;
+    int v8183 = v8182 + 1;
+    int v8184 = v8183 + 1;
+    int v8185 = v8184 + 1;
+    int v8186 = v8185 + 1;
+    int v8187 = v8186 + 1;
+    int v8188 = v8187 + 1;
+    int v8189 = v8188 + 1;
+    int v8190 = v8189 + 1;
+    int v8191 = v8190 + 1;
+    int v8192 = v8191 + 1;
+    int v8193 = v8192 + 1;
+    int v8194 = v8193 + 1;
+    int v8195 = v8194 + 1;
+    int v8196 = v8195 + 1;
+    int v8197 = v8196 + 1;
+    int v8198 = v8197 + 1;
+    int v8199 = v8198 + 1;
+    int v8200 = v8199 + 1;
+    int v8201 = v8200 + 1;
+    int v8202 = v8201 + 1;
+    int v8203 = v8202 + 1;
+    int v8204 = v8203 + 1;
+    int v8205 = v8204 + 1;
+    int v8206 = v8205 + 1;
+    int v8207 = v8206 + 1;
+    int v8208 = v8207 + 1;
+    int v8209 = v8208 + 1;
+    int v8210 = v8209 + 1;
+    int v8211 = v8210 + 1;
+    int v8212 = v8211 + 1;
+    int v8213 = v8212 + 1;
+    int v8214 = v8213 + 1;
+    int v8215 = v8214 + 1;
+    int v8216 = v8215 + 1;
+    int v8217 = v8216 + 1;
+    int v8218 = v8217 + 1;
+    int v8219 = v8218 + 1;
+    int v8220 = v8219 + 1;
+    int v8221 = v8220 + 1;
+    int v8222 = v8221 + 1;
+    int v8223 = v8222 + 1;
+    int v8224 = v8223 + 1;
+    int v8225 = v8224 + 1;
+    int v8226 = v8225 + 1;
+    int v8227 = v8226 + 1;
+    int v8228 = v8227 + 1;
+    int v8229 = v8228 + 1;
+    int v8230 = v8229 + 1;
+    int v8231 = v8230 + 1;
+    int v8232 = v8231 + 1;
+    int v8233 = v8232 + 1;
+    int v8234 = v8233 + 1;
+    int v8235 = v8234 + 1;
+    int v8236 = v8235 + 1;
+    int v8237 = v8236 + 1;
+    int v8238 = v8237 + 1;
+    int v8239 = v8238 + 1;
+    int v8240 = v8239 + 1;
+    int v8241 = v8240 + 1;
+    int v8242 = v8241 + 1;
+    int v8243 = v8242 + 1;
+    int v8244 = v8243 + 1;
+    int v8245 = v8244 + 1;
+    int v8246 = v8245 + 1;
+    int v8247 = v8246 + 1;
+    int v8248 = v8247 + 1;
+    int v8249 = v8248 + 1;
+    int v8250 = v8249 + 1;
+    int v8251 = v8250 + 1;
+    int v8252 = v8251 + 1;
+    int v8253 = v8252 + 1;
+    int v8254 = v8253 + 1;
+    int v8255 = v8254 + 1;
+    int v8256 = v8255 + 1;
+    int v8257 = v8256 + 1;
+    int v8258 = v8257 + 1;
+    int v8259 = v8258 + 1;
+    int v8260 = v8259 + 1;
+    int v8261 = v8260 + 1;
+    int v8262 = v8261 + 1;
+    int v8263 = v8262 + 1;
+    int v8264 = v8263 + 1;
+    int v8265 = v8264 + 1;
+    int v8266 = v8265 + 1;
+    int v8267 = v8266 + 1;
+    int v8268 = v8267 + 1;
+    int v8269 = v8268 + 1;
+    int v8270 = v8269 + 1;
+    int v8271 = v8270 + 1;
+    int v8272 = v8271 + 1;
+    int v8273 = v8272 + 1;
+    int v8274 = v8273 + 1;
+    int v8275 = v8274 + 1;
+    int v8276 = v8275 + 1;
+    int v8277 = v8276 + 1;
+    int v8278 = v8277 + 1;
+    int v8279 = v8278 + 1;
+    int v8280 = v8279 + 1;
+    int v8281 = v8280 + 1;
+    int v8282 = v8281 + 1;
+    int v8283 = v8282 + 1;
+    int v8284 = v8283 + 1;
+    int v8285 = v8284 + 1;
+    int v8286 = v8285 + 1;
+    int v8287 = v8286 + 1;
+    int v8288 = v8287 + 1;
+    int v8289 = v8288 + 1;
+    int v8290 = v8289 + 1;
+    int v8291 = v8290 + 1;
+    int v8292 = v8291 + 1;
+    int v8293 = v8292 + 1;
+    int v8294 = v8293 + 1;
+    int v8295 = v8294 + 1;
+    int v8296 = v8295 + 1;
+    int v8297 = v8296 + 1;
+    int v8298 = v8297 + 1;
+    int v8299 = v8298 + 1;
+    int v8300 = v8299 + 1;
+    int v8301 = v8300 + 1;
+    int v8302 = v8301 + 1;
+    int v8303 = v8302 + 1;
+    int v8304 = v8303 + 1;
+    int v8305 = v8304 + 1;
+    int v8306 = v8305 + 1;
+    int v8307 = v8306 + 1;
+    int v8308 = v8307 + 1;
+    int v8309 = v8308 + 1;
+    int v8310 = v8309 + 1;
+    int v8311 = v8310 + 1;
+    int v8312 = v8311 + 1;
+    int v8313 = v8312 + 1;
+    int v8314 = v8313 + 1;
+    int v8315 = v8314 + 1;
+    int v8316 = v8315 + 1;
+    int v8317 = v8316 + 1;
+    int v8318 = v8317 + 1;
+    int v8319 = v8318 + 1;
+    int v8320 = v8319 + 1;
+    int v8321 = v8320 + 1;
+    int v8322 = v8321 + 1;
+    int v8323 = v8322 + 1;
+    int v8324 = v8323 + 1;
+    int v8325 = v8324 + 1;
+    int v8326 = v8325 + 1;
+    int v8327 = v8326 + 1;
+    int v8328 = v8327 + 1;
+    int v8329 = v8328 + 1;
+    int v8330 = v8329 + 1;
+    int v8331 = v8330 + 1;
+    int v8332 = v8331 + 1;
+    int v8333 = v8332 + 1;
+    int v8334 = v8333 + 1;
+    int v8335 = v8334 + 1;
+    int v8336 = v8335 + 1;
+    int v8337 = v8336 + 1;
+    int v8338 = v8337 + 1;
+    int v8339 = v8338 + 1;
+    int v8340 = v8339 + 1;
+    int v8341 = v8340 + 1;
+    int v8342 = v8341 + 1;
+    int v8343 = v8342 + 1;
+    int v8344 = v8343 + 1;
+    int v8345 = v8344 + 1;
+    int v8346 = v8345 + 1;
+    int v8347 = v8346 + 1;
+    int v8348 = v8347 + 1;
+    int v8349 = v8348 + 1;
+    int v8350 = v8349 + 1;
+    int v8351 = v8350 + 1;
+    int v8352 = v8351 + 1;
+    int v8353 = v8352 + 1;
+    int v8354 = v8353 + 1;
+    int v8355 = v8354 + 1;
+    int v8356 = v8355 + 1;
+    int v8357 = v8356 + 1;
+    int v8358 = v8357 + 1;
+    int v8359 = v8358 + 1;
+    int v8360 = v8359 + 1;
+    int v8361 = v8360 + 1;
+    int v8362 = v8361 + 1;
+    int v8363 = v8362 + 1;
+    int v8364 = v8363 + 1;
+    int v8365 = v8364 + 1;
+    int v8366 = v8365 + 1;
+    int v8367 = v8366 + 1;
+    int v8368 = v8367 + 1;
+    int v8369 = v8368 + 1;
+    int v8370 = v8369 + 1;
+    int v8371 = v8370 + 1;
+    int v8372 = v8371 + 1;
+    int v8373 = v8372 + 1;
+    int v8374 = v8373 + 1;
+    int v8375 = v8374 + 1;
+    int v8376 = v8375 + 1;
+    int v8377 = v8376 + 1;
+    int v8378 = v8377 + 1;
+    int v8379 = v8378 + 1;
+    int v8380 = v8379 + 1;
+    int v8381 = v8380 + 1;
+    int v8382 = v8381 + 1;
+    int v8383 = v8382 + 1;
+    int v8384 = v8383 + 1;
+    int v8385 = v8384 + 1;
+    int v8386 = v8385 + 1;
+    int v8387 = v8386 + 1;
+    int v8388 = v8387 + 1;
+    int v8389 = v8388 + 1;
+    int v8390 = v8389 + 1;
+    int v8391 = v8390 + 1;
+    int v8392 = v8391 + 1;
+    int v8393 = v8392 + 1;
+    int v8394 = v8393 + 1;
+    int v8395 = v8394 + 1;
+    int v8396 = v8395 + 1;
+    int v8397 = v8396 + 1;
+    int v8398 = v8397 + 1;
+    int v8399 = v8398 + 1;
+    int v8400 = v8399 + 1;
+    int v8401 = v8400 + 1;
+    int v8402 = v8401 + 1;
+    int v8403 = v8402 + 1;
+    int v8404 = v8403 + 1;
+    int v8405 = v8404 + 1;
+    int v8406 = v8405 + 1;
+    int v8407 = v8406 + 1;
+    int v8408 = v8407 + 1;
+    int v8409 = v8408 + 1;
+    int v8410 = v8409 + 1;
+    int v8411 = v8410 + 1;
+    int v8412 = v8411 + 1;
+    int v8413 = v8412 + 1;
+    int v8414 = v8413 + 1;
+    int v8415 = v8414 + 1;
+    int v8416 = v8415 + 1;
+    int v8417 = v8416 + 1;
+    int v8418 = v8417 + 1;
+    int v8419 = v8418 + 1;
+    int v8420 = v8419 + 1;
+    int v8421 = v8420 + 1;
+    int v8422 = v8421 + 1;
+    int v8423 = v8422 + 1;
+    int v8424 = v8423 + 1;
+    int v8425 = v8424 + 1;
+    int v8426 = v8425 + 1;
+    int v8427 = v8426 + 1;
+    int v8428 = v8427 + 1;
+    int v8429 = v8428 + 1;
+    int v8430 = v8429 + 1;
+    int v8431 = v8430 + 1;
+    int v8432 = v8431 + 1;
+    int v8433 = v8432 + 1;
+    int v8434 = v8433 + 1;
+    int v8435 = v8434 + 1;
+    int v8436 = v8435 + 1;
+    int v8437 = v8436 + 1;
+    int v8438 = v8437 + 1;
+    int v8439 = v8438 + 1;
+    int v8440 = v8439 + 1;
+    int v8441 = v8440 + 1;
+    int v8442 = v8441 + 1;
+    int v8443 = v8442 + 1;
+    int v8444 = v8443 + 1;
+    int v8445 = v8444 + 1;
+    int v8446 = v8445 + 1;
+    int v8447 = v8446 + 1;
+    int v8448 = v8447 + 1;
+    int v8449 = v8448 + 1;
+    int v8450 = v8449 + 1;
+    int v8451 = v8450 + 1;
+    int v8452 = v8451 + 1;
+    int v8453 = v8452 + 1;
+    int v8454 = v8453 + 1;
+    int v8455 = v8454 + 1;
+    int v8456 = v8455 + 1;
+    int v8457 = v8456 + 1;
+    int v8458 = v8457 + 1;
+    int v8459 = v8458 + 1;
+    int v8460 = v8459 + 1;
+    int v8461 = v8460 + 1;
+    int v8462 = v8461 + 1;
+    int v8463 = v8462 + 1;
+    int v8464 = v8463 + 1;
+    int v8465 = v8464 + 1;
+    int v8466 = v8465 + 1;
+    int v8467 = v8466 + 1;
+    int v8468 = v8467 + 1;
+    int v8469 = v8468 + 1;
+    int v8470 = v8469 + 1;
+    int v8471 = v8470 + 1;
+    int v8472 = v8471 + 1;
+    int v8473 = v8472 + 1;
+    int v8474 = v8473 + 1;
+    int v8475 = v8474 + 1;
+    int v8476 = v8475 + 1;
+    int v8477 = v8476 + 1;
+    int v8478 = v8477 + 1;
+    int v8479 = v8478 + 1;
+    int v8480 = v8479 + 1;
+    int v8481 = v8480 + 1;
+    int v8482 = v8481 + 1;
+    int v8483 = v8482 + 1;
+    int v8484 = v8483 + 1;
+    int v8485 = v8484 + 1;
+    int v8486 = v8485 + 1;
+    int v8487 = v8486 + 1;
+    int v8488 = v8487 + 1;
+    int v8489 = v8488 + 1;
+    int v8490 = v8489 + 1;
+    int v8491 = v8490 + 1;
+    int v8492 = v8491 + 1;
+    int v8493 = v8492 + 1;
+    int v8494 = v8493 + 1;
+    int v8495 = v8494 + 1;
+    int v8496 = v8495 + 1;
+    int v8497 = v8496 + 1;
+    int v8498 = v8497 + 1;
+    int v8499 = v8498 + 1;
+    int v8500 = v8499 + 1;
+    int v8501 = v8500 + 1;
+    int v8502 = v8501 + 1;
+    int v8503 = v8502 + 1;
+    int v8504 = v8503 + 1;
+    int v8505 = v8504 + 1;
+    int v8506 = v8505 + 1;
+    int v8507 = v8506 + 1;
+    int v8508 = v8507 + 1;
+    int v8509 = v8508 + 1;
+    int v8510 = v8509 + 1;
+    int v8511 = v8510 + 1;
+    int v8512 = v8511 + 1;
+    int v8513 = v8512 + 1;
+    int v8514 = v8513 + 1;
+    int v8515 = v8514 + 1;
+    int v8516 = v8515 + 1;
+    int v8517 = v8516 + 1;
+    int v8518 = v8517 + 1;
+    int v8519 = v8518 + 1;
+    int v8520 = v8519 + 1;
+    int v8521 = v8520 + 1;
+    int v8522 = v8521 + 1;
+    int v8523 = v8522 + 1;
+    int v8524 = v8523 + 1;
+    int v8525 = v8524 + 1;
+    int v8526 = v8525 + 1;
+    int v8527 = v8526 + 1;
+    int v8528 = v8527 + 1;
+    int v8529 = v8528 + 1;
+    int v8530 = v8529 + 1;
+    int v8531 = v8530 + 1;
+    int v8532 = v8531 + 1;
+    int v8533 = v8532 + 1;
+    int v8534 = v8533 + 1;
+    int v8535 = v8534 + 1;
+    int v8536 = v8535 + 1;
+    int v8537 = v8536 + 1;
+    int v8538 = v8537 + 1;
+    int v8539 = v8538 + 1;
+    int v8540 = v8539 + 1;
+    int v8541 = v8540 + 1;
+    int v8542 = v8541 + 1;
+    int v8543 = v8542 + 1;
+    int v8544 = v8543 + 1;
+    int v8545 = v8544 + 1;
+    int v8546 = v8545 + 1;
+    int v8547 = v8546 + 1;
+    int v8548 = v8547 + 1;
+    int v8549 = v8548 + 1;
+    int v8550 = v8549 + 1;
+    int v8551 = v8550 + 1;
+    int v8552 = v8551 + 1;
+    int v8553 = v8552 + 1;
+    int v8554 = v8553 + 1;
+    int v8555 = v8554 + 1;
+    int v8556 = v8555 + 1;
+    int v8557 = v8556 + 1;
+    int v8558 = v8557 + 1;
+    int v8559 = v8558 + 1;
+    int v8560 = v8559 + 1;
+    int v8561 = v8560 + 1;
+    int v8562 = v8561 + 1;
+    int v8563 = v8562 + 1;
+    int v8564 = v8563 + 1;
+    int v8565 = v8564 + 1;
+    int v8566 = v8565 + 1;
+    int v8567 = v8566 + 1;
+    int v8568 = v8567 + 1;
+    int v8569 = v8568 + 1;
+    int v8570 = v8569 + 1;
+    int v8571 = v8570 + 1;
+    int v8572 = v8571 + 1;
+    int v8573 = v8572 + 1;
+    int v8574 = v8573 + 1;
+    int v8575 = v8574 + 1;
+    int v8576 = v8575 + 1;
+    int v8577 = v8576 + 1;
+    int v8578 = v8577 + 1;
+    int v8579 = v8578 + 1;
+    int v8580 = v8579 + 1;
+    int v8581 = v8580 + 1;
+    int v8582 = v8581 + 1;
+    int v8583 = v8582 + 1;
+    int v8584 = v8583 + 1;
+    int v8585 = v8584 + 1;
+    int v8586 = v8585 + 1;
+    int v8587 = v8586 + 1;
+    int v8588 = v8587 + 1;
+    int v8589 = v8588 + 1;
+    int v8590 = v8589 + 1;
+    int v8591 = v8590 + 1;
+    int v8592 = v8591 + 1;
+    int v8593 = v8592 + 1;
+    int v8594 = v8593 + 1;
+    int v8595 = v8594 + 1;
+    int v8596 = v8595 + 1;
+    int v8597 = v8596 + 1;
+    int v8598 = v8597 + 1;
+    int v8599 = v8598 + 1;
+    int v8600 = v8599 + 1;
+    int v8601 = v8600 + 1;
+    int v8602 = v8601 + 1;
+    int v8603 = v8602 + 1;
+    int v8604 = v8603 + 1;
+    int v8605 = v8604 + 1;
+    int v8606 = v8605 + 1;
+    int v8607 = v8606 + 1;
+    int v8608 = v8607 + 1;
+    int v8609 = v8608 + 1;
+    int v8610 = v8609 + 1;
+    int v8611 = v8610 + 1;
+    int v8612 = v8611 + 1;
+    int v8613 = v8612 + 1;
+    int v8614 = v8613 + 1;
+    int v8615 = v8614 + 1;
+    int v8616 = v8615 + 1;
+    int v8617 = v8616 + 1;
+    int v8618 = v8617 + 1;
+    int v8619 = v8618 + 1;
+    int v8620 = v8619 + 1;
+    int v8621 = v8620 + 1;
+    int v8622 = v8621 + 1;
+    int v8623 = v8622 + 1;
+    int v8624 = v8623 + 1;
+    int v8625 = v8624 + 1;
+    int v8626 = v8625 + 1;
+    int v8627 = v8626 + 1;
+    int v8628 = v8627 + 1;
+    int v8629 = v8628 + 1;
+    int v8630 = v8629 + 1;
+    int v8631 = v8630 + 1;
+    int v8632 = v8631 + 1;
+    int v8633 = v8632 + 1;
+    int v8634 = v8633 + 1;
+    int v8635 = v8634 + 1;
+    int v8636 = v8635 + 1;
+    int v8637 = v8636 + 1;
+    int v8638 = v8637 + 1;
+    int v8639 = v8638 + 1;
+    int v8640 = v8639 + 1;
+    int v8641 = v8640 + 1;
+    int v8642 = v8641 + 1;
+    int v8643 = v8642 + 1;
+    int v8644 = v8643 + 1;
+    int v8645 = v8644 + 1;
+    int v8646 = v8645 + 1;
+    int v8647 = v8646 + 1;
+    int v8648 = v8647 + 1;
+    int v8649 = v8648 + 1;
+    int v8650 = v8649 + 1;
+    int v8651 = v8650 + 1;
+    int v8652 = v8651 + 1;
+    int v8653 = v8652 + 1;
+    int v8654 = v8653 + 1;
+    int v8655 = v8654 + 1;
+    int v8656 = v8655 + 1;
+    int v8657 = v8656 + 1;
+    int v8658 = v8657 + 1;
+    int v8659 = v8658 + 1;
+    int v8660 = v8659 + 1;
+    int v8661 = v8660 + 1;
+    int v8662 = v8661 + 1;
+    int v8663 = v8662 + 1;
+    int v8664 = v8663 + 1;
+    int v8665 = v8664 + 1;
+    int v8666 = v8665 + 1;
+    int v8667 = v8666 + 1;
+    int v8668 = v8667 + 1;
+    int v8669 = v8668 + 1;
+    int v8670 = v8669 + 1;
+    int v8671 = v8670 + 1;
+    int v8672 = v8671 + 1;
+    int v8673 = v8672 + 1;
+    int v8674 = v8673 + 1;
+    int v8675 = v8674 + 1;
+    int v8676 = v8675 + 1;
+    int v8677 = v8676 + 1;
+    int v8678 = v8677 + 1;
+    int v8679 = v8678 + 1;
+    int v8680 = v8679 + 1;
+    int v8681 = v8680 + 1;
+    int v8682 = v8681 + 1;
+    int v8683 = v8682 + 1;
+    int v8684 = v8683 + 1;
+    int v8685 = v8684 + 1;
+    int v8686 = v8685 + 1;
+    int v8687 = v8686 + 1;
+    int v8688 = v8687 + 1;
+    int v8689 = v8688 + 1;
+    int v8690 = v8689 + 1;
+    int v8691 = v8690 + 1;
+    int v8692 = v8691 + 1;
+    int v8693 = v8692 + 1;
+    int v8694 = v8693 + 1;
+    int v8695 = v8694 + 1;
+    int v8696 = v8695 + 1;
+    int v8697 = v8696 + 1;
+    int v8698 = v8697 + 1;
+    int v8699 = v8698 + 1;
+    int v8700 = v8699 + 1;
+    int v8701 = v8700 + 1;
+    int v8702 = v8701 + 1;
+    int v8703 = v8702 + 1;
+    int v8704 = v8703 + 1;
+    int v8705 = v8704 + 1;
+    int v8706 = v8705 + 1;
+    int v8707 = v8706 + 1;
+    int v8708 = v8707 + 1;
+    int v8709 = v8708 + 1;
+    int v8710 = v8709 + 1;
+    int v8711 = v8710 + 1;
+    int v8712 = v8711 + 1;
+    int v8713 = v8712 + 1;
+    int v8714 = v8713 + 1;
+    int v8715 = v8714 + 1;
+    int v8716 = v8715 + 1;
+    int v8717 = v8716 + 1;
+    int v8718 = v8717 + 1;
+    int v8719 = v8718 + 1;
+    int v8720 = v8719 + 1;
+    int v8721 = v8720 + 1;
+    int v8722 = v8721 + 1;
+    int v8723 = v8722 + 1;
+    int v8724 = v8723 + 1;
+    int v8725 = v8724 + 1;
+    int v8726 = v8725 + 1;
+    int v8727 = v8726 + 1;
+    int v8728 = v8727 + 1;
+    int v8729 = v8728 + 1;
+    int v8730 = v8729 + 1;
+    int v8731 = v8730 + 1;
+    int v8732 = v8731 + 1;
+    int v8733 = v8732 + 1;
+    int v8734 = v8733 + 1;
+    int v8735 = v8734 + 1;
+    int v8736 = v8735 + 1;
+    int v8737 = v8736 + 1;
+    int v8738 = v8737 + 1;
+    int v8739 = v8738 + 1;
+    int v8740 = v8739 + 1;
+    int v8741 = v8740 + 1;
+    int v8742 = v8741 + 1;
+    int v8743 = v8742 + 1;
+    int v8744 = v8743 + 1;
+    int v8745 = v8744 + 1;
+    int v8746 = v8745 + 1;
+    int v8747 = v8746 + 1;
+    int v8748 = v8747 + 1;
+    int v8749 = v8748 + 1;
+    int v8750 = v8749 + 1;
+    int v8751 = v8750 + 1;
+    int v8752 = v8751 + 1;
+    int v8753 = v8752 + 1;
+    int v8754 = v8753 + 1;
+    int v8755 = v8754 + 1;
+    int v8756 = v8755 + 1;
+    int v8757 = v8756 + 1;
+    int v8758 = v8757 + 1;
+    int v8759 = v8758 + 1;
+    int v8760 = v8759 + 1;
+    int v8761 = v8760 + 1;
+    int v8762 = v8761 + 1;
+    int v8763 = v8762 + 1;
+    int v8764 = v8763 + 1;
+    int v8765 = v8764 + 1;
+    int v8766 = v8765 + 1;
+    int v8767 = v8766 + 1;
+    int v8768 = v8767 + 1;
+    int v8769 = v8768 + 1;
+    int v8770 = v8769 + 1;
+    int v8771 = v8770 + 1;
+    int v8772 = v8771 + 1;
+    int v8773 = v8772 + 1;
+    int v8774 = v8773 + 1;
+    int v8775 = v8774 + 1;
+    int v8776 = v8775 + 1;
+    int v8777 = v8776 + 1;
+    int v8778 = v8777 + 1;
+    int v8779 = v8778 + 1;
+    int v8780 = v8779 + 1;
+    int v8781 = v8780 + 1;
+    int v8782 = v8781 + 1;
+    int v8783 = v8782 + 1;
+    int v8784 = v8783 + 1;
+    int v8785 = v8784 + 1;
+    int v8786 = v8785 + 1;
+    int v8787 = v8786 + 1;
+    int v8788 = v8787 + 1;
+    int v8789 = v8788 + 1;
+    int v8790 = v8789 + 1;
+    int v8791 = v8790 + 1;
+    int v8792 = v8791 + 1;
+    int v8793 = v8792 + 1;
+    int v8794 = v8793 + 1;
+    int v8795 = v8794 + 1;
+    int v8796 = v8795 + 1;
+    int v8797 = v8796 + 1;
+    int v8798 = v8797 + 1;
+    int v8799 = v8798 + 1;
+    int v8800 = v8799 + 1;
+    int v8801 = v8800 + 1;
+    int v8802 = v8801 + 1;
+    int v8803 = v8802 + 1;
+    int v8804 = v8803 + 1;
+    int v8805 = v8804 + 1;
+    int v8806 = v8805 + 1;
+    int v8807 = v8806 + 1;
+    int v8808 = v8807 + 1;
+    int v8809 = v8808 + 1;
+    int v8810 = v8809 + 1;
+    int v8811 = v8810 + 1;
+    int v8812 = v8811 + 1;
+    int v8813 = v8812 + 1;
+    int v8814 = v8813 + 1;
+    int v8815 = v8814 + 1;
+    int v8816 = v8815 + 1;
+    int v8817 = v8816 + 1;
+    int v8818 = v8817 + 1;
+    int v8819 = v8818 + 1;
+    int v8820 = v8819 + 1;
+    int v8821 = v8820 + 1;
+    int v8822 = v8821 + 1;
+    int v8823 = v8822 + 1;
+    int v8824 = v8823 + 1;
+    int v8825 = v8824 + 1;
+    int v8826 = v8825 + 1;
+    int v8827 = v8826 + 1;
+    int v8828 = v8827 + 1;
+    int v8829 = v8828 + 1;
+    int v8830 = v8829 + 1;
+    int v8831 = v8830 + 1;
+    int v8832 = v8831 + 1;
+    int v8833 = v8832 + 1;
+    int v8834 = v8833 + 1;
+    int v8835 = v8834 + 1;
+    int v8836 = v8835 + 1;
+    int v8837 = v8836 + 1;
+    int v8838 = v8837 + 1;
+    int v8839 = v8838 + 1;
+    int v8840 = v8839 + 1;
+    int v8841 = v8840 + 1;
+    int v8842 = v8841 + 1;
+    int v8843 = v8842 + 1;
+    int v8844 = v8843 + 1;
+    int v8845 = v8844 + 1;
+    int v8846 = v8845 + 1;
+    int v8847 = v8846 + 1;
+    int v8848 = v8847 + 1;
+    int v8849 = v8848 + 1;
+    int v8850 = v8849 + 1;
+    int v8851 = v8850 + 1;
+    int v8852 = v8851 + 1;
+    int v8853 = v8852 + 1;
+    int v8854 = v8853 + 1;
+    int v8855 = v8854 + 1;
+    int v8856 = v8855 + 1;
+    int v8857 = v8856 + 1;
+    int v8858 = v8857 + 1;
+    int v8859 = v8858 + 1;
+    int v8860 = v8859 + 1;
+    int v8861 = v8860 + 1;
+    int v8862 = v8861 + 1;
+    int v8863 = v8862 + 1;
+    int v8864 = v8863 + 1;
+    int v8865 = v8864 + 1;
+    int v8866 = v8865 + 1;
+    int v8867 = v8866 + 1;
+    int v8868 = v8867 + 1;
+    int v8869 = v8868 + 1;
+    int v8870 = v8869 + 1;
+    int v8871 = v8870 + 1;
+    int v8872 = v8871 + 1;
+    int v8873 = v8872 + 1;
+    int v8874 = v8873 + 1;
+    int v8875 = v8874 + 1;
+    int v8876 = v8875 + 1;
+    int v8877 = v8876 + 1;
+    int v8878 = v8877 + 1;
+    int v8879 = v8878 + 1;
+    int v8880 = v8879 + 1;
+    int v8881 = v8880 + 1;
+    int v8882 = v8881 + 1;
+    int v8883 = v8882 + 1;
+    int v8884 = v8883 + 1;
+    int v8885 = v8884 + 1;
+    int v8886 = v8885 + 1;
+    int v8887 = v8886 + 1;
+    int v8888 = v8887 + 1;
+    int v8889 = v8888 + 1;
+    int v8890 = v8889 + 1;
+    int v8891 = v8890 + 1;
+    int v8892 = v8891 + 1;
+    int v8893 = v8892 + 1;
+    int v8894 = v8893 + 1;
+    int v8895 = v8894 + 1;
+    int v8896 = v8895 + 1;
+    int v8897 = v8896 + 1;
+    int v8898 = v8897 + 1;
+    int v8899 = v8898 + 1;
+    int v8900 = v8899 + 1;
+    int v8901 = v8900 + 1;
+    int v8902 = v8901 + 1;
+    int v8903 = v8902 + 1;
+    int v8904 = v8903 + 1;
+    int v8905 = v8904 + 1;
+    int v8906 = v8905 + 1;
+    int v8907 = v8906 + 1;
+    int v8908 = v8907 + 1;
+    int v8909 = v8908 + 1;
+    int v8910 = v8909 + 1;
+    int v8911 = v8910 + 1;
+    int v8912 = v8911 + 1;
+    int v8913 = v8912 + 1;
+    int v8914 = v8913 + 1;
+    int v8915 = v8914 + 1;
+    int v8916 = v8915 + 1;
+    int v8917 = v8916 + 1;
+    int v8918 = v8917 + 1;
+    int v8919 = v8918 + 1;
+    int v8920 = v8919 + 1;
+    int v8921 = v8920 + 1;
+    int v8922 = v8921 + 1;
+    int v8923 = v8922 + 1;
+    int v8924 = v8923 + 1;
+    int v8925 = v8924 + 1;
+    int v8926 = v8925 + 1;
+    int v8927 = v8926 + 1;
+    int v8928 = v8927 + 1;
+    int v8929 = v8928 + 1;
+    int v8930 = v8929 + 1;
+    int v8931 = v8930 + 1;
+    int v8932 = v8931 + 1;
+    int v8933 = v8932 + 1;
+    int v8934 = v8933 + 1;
+    int v8935 = v8934 + 1;
+    int v8936 = v8935 + 1;
+    int v8937 = v8936 + 1;
+    int v8938 = v8937 + 1;
+    int v8939 = v8938 + 1;
+    int v8940 = v8939 + 1;
+    int v8941 = v8940 + 1;
+    int v8942 = v8941 + 1;
+    int v8943 = v8942 + 1;
+    int v8944 = v8943 + 1;
+    int v8945 = v8944 + 1;
+    int v8946 = v8945 + 1;
+    int v8947 = v8946 + 1;
+    int v8948 = v8947 + 1;
+    int v8949 = v8948 + 1;
+    int v8950 = v8949 + 1;
+    int v8951 = v8950 + 1;
+    int v8952 = v8951 + 1;
+    int v8953 = v8952 + 1;
+    int v8954 = v8953 + 1;
+    int v8955 = v8954 + 1;
+    int v8956 = v8955 + 1;
+    int v8957 = v8956 + 1;
+    int v8958 = v8957 + 1;
+    int v8959 = v8958 + 1;
+    int v8960 = v8959 + 1;
+    int v8961 = v8960 + 1;
+    int v8962 = v8961 + 1;
+    int v8963 = v8962 + 1;
+    int v8964 = v8963 + 1;
+    int v8965 = v8964 + 1;
+    int v8966 = v8965 + 1;
+    int v8967 = v8966 + 1;
+    int v8968 = v8967 + 1;
+    int v8969 = v8968 + 1;
+    int v8970 = v8969 + 1;
+    int v8971 = v8970 + 1;
+    int v8972 = v8971 + 1;
+    int v8973 = v8972 + 1;
+    int v8974 = v8973 + 1;
+    int v8975 = v8974 + 1;
+    int v8976 = v8975 + 1;
+    int v8977 = v8976 + 1;
+    int v8978 = v8977 + 1;
+    int v8979 = v8978 + 1;
+    int v8980 = v8979 + 1;
+    int v8981 = v8980 + 1;
+    int v8982 = v8981 + 1;
+    int v8983 = v8982 + 1;
+    int v8984 = v8983 + 1;
+    int v8985 = v8984 + 1;
+    int v8986 = v8985 + 1;
+    int v8987 = v8986 + 1;
+    int v8988 = v8987 + 1;
+    int v8989 = v8988 + 1;
+    int v8990 = v8989 + 1;
+    int v8991 = v8990 + 1;
+    int v8992 = v8991 + 1;
+    int v8993 = v8992 + 1;
+    int v8994 = v8993 + 1;
+    int v8995 = v8994 + 1;
+    int v8996 = v8995 + 1;
+    int v8997 = v8996 + 1;
+    int v8998 = v8997 + 1;
+    int v8999 = v8998 + 1;
+    int v9000 = v8999 + 1;
+    int v9001 = v9000 + 1;
+    int v9002 = v9001 + 1;
+    int v9003 = v9002 + 1;
+    int v9004 = v9003 + 1;
+    int v9005 = v9004 + 1;
+    int v9006 = v9005 + 1;
+    int v9007 = v9006 + 1;
+    int v9008 = v9007 + 1;
+    int v9009 = v9008 + 1;
+    int v9010 = v9009 + 1;
+    int v9011 = v9010 + 1;
+    int v9012 = v9011 + 1;
+    int v9013 = v9012 + 1;
+    int v9014 = v9013 + 1;
+    int v9015 = v9014 + 1;
+    int v9016 = v9015 + 1;
+    int v9017 = v9016 + 1;
+    int v9018 = v9017 + 1;
+    int v9019 = v9018 + 1;
+    int v9020 = v9019 + 1;
+    int v9021 = v9020 + 1;
+    int v9022 = v9021 + 1;
+    int v9023 = v9022 + 1;
+    int v9024 = v9023 + 1;
+    int v9025 = v9024 + 1;
+    int v9026 = v9025 + 1;
+    int v9027 = v9026 + 1;
+    int v9028 = v9027 + 1;
+    int v9029 = v9028 + 1;
+    int v9030 = v9029 + 1;
+    int v9031 = v9030 + 1;
+    int v9032 = v9031 + 1;
+    int v9033 = v9032 + 1;
+    int v9034 = v9033 + 1;
+    int v9035 = v9034 + 1;
+    int v9036 = v9035 + 1;
+    int v9037 = v9036 + 1;
+    int v9038 = v9037 + 1;
+    int v9039 = v9038 + 1;
+    int v9040 = v9039 + 1;
+    int v9041 = v9040 + 1;
+    int v9042 = v9041 + 1;
+    int v9043 = v9042 + 1;
+    int v9044 = v9043 + 1;
+    int v9045 = v9044 + 1;
+    int v9046 = v9045 + 1;
+    int v9047 = v9046 + 1;
+    int v9048 = v9047 + 1;
+    int v9049 = v9048 + 1;
+    int v9050 = v9049 + 1;
+    int v9051 = v9050 + 1;
+    int v9052 = v9051 + 1;
+    int v9053 = v9052 + 1;
+    int v9054 = v9053 + 1;
+    int v9055 = v9054 + 1;
+    int v9056 = v9055 + 1;
+    int v9057 = v9056 + 1;
+    int v9058 = v9057 + 1;
+    int v9059 = v9058 + 1;
+    int v9060 = v9059 + 1;
+    int v9061 = v9060 + 1;
+    int v9062 = v9061 + 1;
+    int v9063 = v9062 + 1;
+    int v9064 = v9063 + 1;
+    int v9065 = v9064 + 1;
+    int v9066 = v9065 + 1;
+    int v9067 = v9066 + 1;
+    int v9068 = v9067 + 1;
+    int v9069 = v9068 + 1;
+    int v9070 = v9069 + 1;
+    int v9071 = v9070 + 1;
+    int v9072 = v9071 + 1;
+    int v9073 = v9072 + 1;
+    int v9074 = v9073 + 1;
+    int v9075 = v9074 + 1;
+    int v9076 = v9075 + 1;
+    int v9077 = v9076 + 1;
+    int v9078 = v9077 + 1;
+    int v9079 = v9078 + 1;
+    int v9080 = v9079 + 1;
+    int v9081 = v9080 + 1;
+    int v9082 = v9081 + 1;
+    int v9083 = v9082 + 1;
+    int v9084 = v9083 + 1;
+    int v9085 = v9084 + 1;
+    int v9086 = v9085 + 1;
+    int v9087 = v9086 + 1;
+    int v9088 = v9087 + 1;
+    int v9089 = v9088 + 1;
+    int v9090 = v9089 + 1;
+    int v9091 = v9090 + 1;
+    int v9092 = v9091 + 1;
+    int v9093 = v9092 + 1;
+    int v9094 = v9093 + 1;
+    int v9095 = v9094 + 1;
+    int v9096 = v9095 + 1;
+    int v9097 = v9096 + 1;
+    int v9098 = v9097 + 1;
+    int v9099 = v9098 + 1;
+    int v9100 = v9099 + 1;
+    int v9101 = v9100 + 1;
+    int v9102 = v9101 + 1;
+    int v9103 = v9102 + 1;
+    int v9104 = v9103 + 1;
+    int v9105 = v9104 + 1;
+    int v9106 = v9105 + 1;
+    int v9107 = v9106 + 1;
+    int v9108 = v9107 + 1;
+    int v9109 = v9108 + 1;
+    int v9110 = v9109 + 1;
+    int v9111 = v9110 + 1;
+    int v9112 = v9111 + 1;
+    int v9113 = v9112 + 1;
+    int v9114 = v9113 + 1;
+    int v9115 = v9114 + 1;
+    int v9116 = v9115 + 1;
+    int v9117 = v9116 + 1;
+    int v9118 = v9117 + 1;
+    int v9119 = v9118 + 1;
+    int v9120 = v9119 + 1;
+    int v9121 = v9120 + 1;
+    int v9122 = v9121 + 1;
+    int v9123 = v9122 + 1;
+    int v9124 = v9123 + 1;
+    int v9125 = v9124 + 1;
+    int v9126 = v9125 + 1;
+    int v9127 = v9126 + 1;
+    int v9128 = v9127 + 1;
+    int v9129 = v9128 + 1;
+    int v9130 = v9129 + 1;
+    int v9131 = v9130 + 1;
+    int v9132 = v9131 + 1;
+    int v9133 = v9132 + 1;
+    int v9134 = v9133 + 1;
+    int v9135 = v9134 + 1;
+    int v9136 = v9135 + 1;
+    int v9137 = v9136 + 1;
+    int v9138 = v9137 + 1;
+    int v9139 = v9138 + 1;
+    int v9140 = v9139 + 1;
+    int v9141 = v9140 + 1;
+    int v9142 = v9141 + 1;
+    int v9143 = v9142 + 1;
+    int v9144 = v9143 + 1;
+    int v9145 = v9144 + 1;
+    int v9146 = v9145 + 1;
+    int v9147 = v9146 + 1;
+    int v9148 = v9147 + 1;
+    int v9149 = v9148 + 1;
+    int v9150 = v9149 + 1;
+    int v9151 = v9150 + 1;
+    int v9152 = v9151 + 1;
+    int v9153 = v9152 + 1;
+    int v9154 = v9153 + 1;
+    int v9155 = v9154 + 1;
+    int v9156 = v9155 + 1;
+    int v9157 = v9156 + 1;
+    int v9158 = v9157 + 1;
+    int v9159 = v9158 + 1;
+    int v9160 = v9159 + 1;
+    int v9161 = v9160 + 1;
+    int v9162 = v9161 + 1;
+    int v9163 = v9162 + 1;
+    int v9164 = v9163 + 1;
+    int v9165 = v9164 + 1;
+    int v9166 = v9165 + 1;
+    int v9167 = v9166 + 1;
+    int v9168 = v9167 + 1;
+    int v9169 = v9168 + 1;
+    int v9170 = v9169 + 1;
+    int v9171 = v9170 + 1;
+    int v9172 = v9171 + 1;
+    int v9173 = v9172 + 1;
+    int v9174 = v9173 + 1;
+    int v9175 = v9174 + 1;
+    int v9176 = v9175 + 1;
+    int v9177 = v9176 + 1;
+    int v9178 = v9177 + 1;
+    int v9179 = v9178 + 1;
+    int v9180 = v9179 + 1;
+    int v9181 = v9180 + 1;
+    int v9182 = v9181 + 1;
+    int v9183 = v9182 + 1;
+    int v9184 = v9183 + 1;
+    int v9185 = v9184 + 1;
+    int v9186 = v9185 + 1;
+    int v9187 = v9186 + 1;
+    int v9188 = v9187 + 1;
+    int v9189 = v9188 + 1;
+    int v9190 = v9189 + 1;
+    int v9191 = v9190 + 1;
+    int v9192 = v9191 + 1;
+    int v9193 = v9192 + 1;
+    int v9194 = v9193 + 1;
+    int v9195 = v9194 + 1;
+    int v9196 = v9195 + 1;
+    int v9197 = v9196 + 1;
+    int v9198 = v9197 + 1;
+    int v9199 = v9198 + 1;
+    int v9200 = v9199 + 1;
+    int v9201 = v9200 + 1;
+    int v9202 = v9201 + 1;
+    int v9203 = v9202 + 1;
+    int v9204 = v9203 + 1;
+    int v9205 = v9204 + 1;
+    int v9206 = v9205 + 1;
+    int v9207 = v9206 + 1;
+    int v9208 = v9207 + 1;
+    int v9209 = v9208 + 1;
+    int v9210 = v9209 + 1;
+    int v9211 = v9210 + 1;
+    int v9212 = v9211 + 1;
+    int v9213 = v9212 + 1;
+    int v9214 = v9213 + 1;
+    int v9215 = v9214 + 1;
+    int v9216 = v9215 + 1;
+    int v9217 = v9216 + 1;
+    int v9218 = v9217 + 1;
+    int v9219 = v9218 + 1;
+    int v9220 = v9219 + 1;
+    int v9221 = v9220 + 1;
+    int v9222 = v9221 + 1;
+    int v9223 = v9222 + 1;
+    int v9224 = v9223 + 1;
+    int v9225 = v9224 + 1;
+    int v9226 = v9225 + 1;
+    int v9227 = v9226 + 1;
+    int v9228 = v9227 + 1;
+    int v9229 = v9228 + 1;
+    int v9230 = v9229 + 1;
+    int v9231 = v9230 + 1;
+    int v9232 = v9231 + 1;
+    int v9233 = v9232 + 1;
+    int v9234 = v9233 + 1;
+    int v9235 = v9234 + 1;
+    int v9236 = v9235 + 1;
+    int v9237 = v9236 + 1;
+    int v9238 = v9237 + 1;
+    int v9239 = v9238 + 1;
+    int v9240 = v9239 + 1;
+    int v9241 = v9240 + 1;
+    int v9242 = v9241 + 1;
+    int v9243 = v9242 + 1;
+    int v9244 = v9243 + 1;
+    int v9245 = v9244 + 1;
+    int v9246 = v9245 + 1;
+    int v9247 = v9246 + 1;
+    int v9248 = v9247 + 1;
+    int v9249 = v9248 + 1;
+    int v9250 = v9249 + 1;
+    int v9251 = v9250 + 1;
+    int v9252 = v9251 + 1;
+    int v9253 = v9252 + 1;
+    int v9254 = v9253 + 1;
+    int v9255 = v9254 + 1;
+    int v9256 = v9255 + 1;
+    int v9257 = v9256 + 1;
+    int v9258 = v9257 + 1;
+    int v9259 = v9258 + 1;
+    int v9260 = v9259 + 1;
+    int v9261 = v9260 + 1;
+    int v9262 = v9261 + 1;
+    int v9263 = v9262 + 1;
+    int v9264 = v9263 + 1;
+    int v9265 = v9264 + 1;
+    int v9266 = v9265 + 1;
+    int v9267 = v9266 + 1;
+    int v9268 = v9267 + 1;
+    int v9269 = v9268 + 1;
+    int v9270 = v9269 + 1;
+    int v9271 = v9270 + 1;
+    int v9272 = v9271 + 1;
+    int v9273 = v9272 + 1;
+    int v9274 = v9273 + 1;
+    int v9275 = v9274 + 1;
+    int v9276 = v9275 + 1;
+    int v9277 = v9276 + 1;
+    int v9278 = v9277 + 1;
+    int v9279 = v9278 + 1;
+    int v9280 = v9279 + 1;
+    int v9281 = v9280 + 1;
+    int v9282 = v9281 + 1;
+    int v9283 = v9282 + 1;
+    int v9284 = v9283 + 1;
+    int v9285 = v9284 + 1;
+    int v9286 = v9285 + 1;
+    int v9287 = v9286 + 1;
+    int v9288 = v9287 + 1;
+    int v9289 = v9288 + 1;
+    int v9290 = v9289 + 1;
+    int v9291 = v9290 + 1;
+    int v9292 = v9291 + 1;
+    int v9293 = v9292 + 1;
+    int v9294 = v9293 + 1;
+    int v9295 = v9294 + 1;
+    int v9296 = v9295 + 1;
+    int v9297 = v9296 + 1;
+    int v9298 = v9297 + 1;
+    int v9299 = v9298 + 1;
+    int v9300 = v9299 + 1;
+    int v9301 = v9300 + 1;
+    int v9302 = v9301 + 1;
+    int v9303 = v9302 + 1;
+    int v9304 = v9303 + 1;
+    int v9305 = v9304 + 1;
+    int v9306 = v9305 + 1;
+    int v9307 = v9306 + 1;
+    int v9308 = v9307 + 1;
+    int v9309 = v9308 + 1;
+    int v9310 = v9309 + 1;
+    int v9311 = v9310 + 1;
+    int v9312 = v9311 + 1;
+    int v9313 = v9312 + 1;
+    int v9314 = v9313 + 1;
+    int v9315 = v9314 + 1;
+    int v9316 = v9315 + 1;
+    int v9317 = v9316 + 1;
+    int v9318 = v9317 + 1;
+    int v9319 = v9318 + 1;
+    int v9320 = v9319 + 1;
+    int v9321 = v9320 + 1;
+    int v9322 = v9321 + 1;
+    int v9323 = v9322 + 1;
+    int v9324 = v9323 + 1;
+    int v9325 = v9324 + 1;
+    int v9326 = v9325 + 1;
+    int v9327 = v9326 + 1;
+    int v9328 = v9327 + 1;
+    int v9329 = v9328 + 1;
+    int v9330 = v9329 + 1;
+    int v9331 = v9330 + 1;
+    int v9332 = v9331 + 1;
+    int v9333 = v9332 + 1;
+    int v9334 = v9333 + 1;
+    int v9335 = v9334 + 1;
+    int v9336 = v9335 + 1;
+    int v9337 = v9336 + 1;
+    int v9338 = v9337 + 1;
+    int v9339 = v9338 + 1;
+    int v9340 = v9339 + 1;
+    int v9341 = v9340 + 1;
+    int v9342 = v9341 + 1;
+    int v9343 = v9342 + 1;
+    int v9344 = v9343 + 1;
+    int v9345 = v9344 + 1;
+    int v9346 = v9345 + 1;
+    int v9347 = v9346 + 1;
+    int v9348 = v9347 + 1;
+    int v9349 = v9348 + 1;
+    int v9350 = v9349 + 1;
+    int v9351 = v9350 + 1;
+    int v9352 = v9351 + 1;
+    int v9353 = v9352 + 1;
+    int v9354 = v9353 + 1;
+    int v9355 = v9354 + 1;
+    int v9356 = v9355 + 1;
+    int v9357 = v9356 + 1;
+    int v9358 = v9357 + 1;
+    int v9359 = v9358 + 1;
+    int v9360 = v9359 + 1;
+    int v9361 = v9360 + 1;
+    int v9362 = v9361 + 1;
+    int v9363 = v9362 + 1;
+    int v9364 = v9363 + 1;
+    int v9365 = v9364 + 1;
+    int v9366 = v9365 + 1;
+    int v9367 = v9366 + 1;
+    int v9368 = v9367 + 1;
+    int v9369 = v9368 + 1;
+    int v9370 = v9369 + 1;
+    int v9371 = v9370 + 1;
+    int v9372 = v9371 + 1;
+    int v9373 = v9372 + 1;
+    int v9374 = v9373 + 1;
+    int v9375 = v9374 + 1;
+    int v9376 = v9375 + 1;
+    int v9377 = v9376 + 1;
+    int v9378 = v9377 + 1;
+    int v9379 = v9378 + 1;
+    int v9380 = v9379 + 1;
+    int v9381 = v9380 + 1;
+    int v9382 = v9381 + 1;
+    int v9383 = v9382 + 1;
+    int v9384 = v9383 + 1;
+    int v9385 = v9384 + 1;
+    int v9386 = v9385 + 1;
+    int v9387 = v9386 + 1;
+    int v9388 = v9387 + 1;
+    int v9389 = v9388 + 1;
+    int v9390 = v9389 + 1;
+    int v9391 = v9390 + 1;
+    int v9392 = v9391 + 1;
+    int v9393 = v9392 + 1;
+    int v9394 = v9393 + 1;
+    int v9395 = v9394 + 1;
+    int v9396 = v9395 + 1;
+    int v9397 = v9396 + 1;
+    int v9398 = v9397 + 1;
+    int v9399 = v9398 + 1;
+    int v9400 = v9399 + 1;
+    int v9401 = v9400 + 1;
+    int v9402 = v9401 + 1;
+    int v9403 = v9402 + 1;
+    int v9404 = v9403 + 1;
+    int v9405 = v9404 + 1;
+    int v9406 = v9405 + 1;
+    int v9407 = v9406 + 1;
+    int v9408 = v9407 + 1;
+    int v9409 = v9408 + 1;
+    int v9410 = v9409 + 1;
+    int v9411 = v9410 + 1;
+    int v9412 = v9411 + 1;
+    int v9413 = v9412 + 1;
+    int v9414 = v9413 + 1;
+    int v9415 = v9414 + 1;
+    int v9416 = v9415 + 1;
+    int v9417 = v9416 + 1;
+    int v9418 = v9417 + 1;
+    int v9419 = v9418 + 1;
+    int v9420 = v9419 + 1;
+    int v9421 = v9420 + 1;
+    int v9422 = v9421 + 1;
+    int v9423 = v9422 + 1;
+    int v9424 = v9423 + 1;
+    int v9425 = v9424 + 1;
+    int v9426 = v9425 + 1;
+    int v9427 = v9426 + 1;
+    int v9428 = v9427 + 1;
+    int v9429 = v9428 + 1;
+    int v9430 = v9429 + 1;
+    int v9431 = v9430 + 1;
+    int v9432 = v9431 + 1;
+    int v9433 = v9432 + 1;
+    int v9434 = v9433 + 1;
+    int v9435 = v9434 + 1;
+    int v9436 = v9435 + 1;
+    int v9437 = v9436 + 1;
+    int v9438 = v9437 + 1;
+    int v9439 = v9438 + 1;
+    int v9440 = v9439 + 1;
+    int v9441 = v9440 + 1;
+    int v9442 = v9441 + 1;
+    int v9443 = v9442 + 1;
+    int v9444 = v9443 + 1;
+    int v9445 = v9444 + 1;
+    int v9446 = v9445 + 1;
+    int v9447 = v9446 + 1;
+    int v9448 = v9447 + 1;
+    int v9449 = v9448 + 1;
+    int v9450 = v9449 + 1;
+    int v9451 = v9450 + 1;
+    int v9452 = v9451 + 1;
+    int v9453 = v9452 + 1;
+    int v9454 = v9453 + 1;
+    int v9455 = v9454 + 1;
+    int v9456 = v9455 + 1;
+    int v9457 = v9456 + 1;
+    int v9458 = v9457 + 1;
+    int v9459 = v9458 + 1;
+    int v9460 = v9459 + 1;
+    int v9461 = v9460 + 1;
+    int v9462 = v9461 + 1;
+    int v9463 = v9462 + 1;
+    int v9464 = v9463 + 1;
+    int v9465 = v9464 + 1;
+    int v9466 = v9465 + 1;
+    int v9467 = v9466 + 1;
+    int v9468 = v9467 + 1;
+    int v9469 = v9468 + 1;
+    int v9470 = v9469 + 1;
+    int v9471 = v9470 + 1;
+    int v9472 = v9471 + 1;
+    int v9473 = v9472 + 1;
+    int v9474 = v9473 + 1;
+    int v9475 = v9474 + 1;
+    int v9476 = v9475 + 1;
+    int v9477 = v9476 + 1;
+    int v9478 = v9477 + 1;
+    int v9479 = v9478 + 1;
+    int v9480 = v9479 + 1;
+    int v9481 = v9480 + 1;
+    int v9482 = v9481 + 1;
+    int v9483 = v9482 + 1;
+    int v9484 = v9483 + 1;
+    int v9485 = v9484 + 1;
+    int v9486 = v9485 + 1;
+    int v9487 = v9486 + 1;
+    int v9488 = v9487 + 1;
+    int v9489 = v9488 + 1;
+    int v9490 = v9489 + 1;
+    int v9491 = v9490 + 1;
+    int v9492 = v9491 + 1;
+    int v9493 = v9492 + 1;
+    int v9494 = v9493 + 1;
+    int v9495 = v9494 + 1;
+    int v9496 = v9495 + 1;
+    int v9497 = v9496 + 1;
+    int v9498 = v9497 + 1;
+    int v9499 = v9498 + 1;
+    int v9500 = v9499 + 1;
+    int v9501 = v9500 + 1;
+    int v9502 = v9501 + 1;
+    int v9503 = v9502 + 1;
+    int v9504 = v9503 + 1;
+    int v9505 = v9504 + 1;
+    int v9506 = v9505 + 1;
+    int v9507 = v9506 + 1;
+    int v9508 = v9507 + 1;
+    int v9509 = v9508 + 1;
+    int v9510 = v9509 + 1;
+    int v9511 = v9510 + 1;
+    int v9512 = v9511 + 1;
+    int v9513 = v9512 + 1;
+    int v9514 = v9513 + 1;
+    int v9515 = v9514 + 1;
+    int v9516 = v9515 + 1;
+    int v9517 = v9516 + 1;
+    int v9518 = v9517 + 1;
+    int v9519 = v9518 + 1;
+    int v9520 = v9519 + 1;
+    int v9521 = v9520 + 1;
+    int v9522 = v9521 + 1;
+    int v9523 = v9522 + 1;
+    int v9524 = v9523 + 1;
+    int v9525 = v9524 + 1;
+    int v9526 = v9525 + 1;
+    int v9527 = v9526 + 1;
+    int v9528 = v9527 + 1;
+    int v9529 = v9528 + 1;
+    int v9530 = v9529 + 1;
+    int v9531 = v9530 + 1;
+    int v9532 = v9531 + 1;
+    int v9533 = v9532 + 1;
+    int v9534 = v9533 + 1;
+    int v9535 = v9534 + 1;
+    int v9536 = v9535 + 1;
+    int v9537 = v9536 + 1;
+    int v9538 = v9537 + 1;
+    int v9539 = v9538 + 1;
+    int v9540 = v9539 + 1;
+    int v9541 = v9540 + 1;
+    int v9542 = v9541 + 1;
+    int v9543 = v9542 + 1;
+    int v9544 = v9543 + 1;
+    int v9545 = v9544 + 1;
+    int v9546 = v9545 + 1;
+    int v9547 = v9546 + 1;
+    int v9548 = v9547 + 1;
+    int v9549 = v9548 + 1;
+    int v9550 = v9549 + 1;
+    int v9551 = v9550 + 1;
+    int v9552 = v9551 + 1;
+    int v9553 = v9552 + 1;
+    int v9554 = v9553 + 1;
+    int v9555 = v9554 + 1;
+    int v9556 = v9555 + 1;
+    int v9557 = v9556 + 1;
+    int v9558 = v9557 + 1;
+    int v9559 = v9558 + 1;
+    int v9560 = v9559 + 1;
+    int v9561 = v9560 + 1;
+    int v9562 = v9561 + 1;
+    int v9563 = v9562 + 1;
+    int v9564 = v9563 + 1;
+    int v9565 = v9564 + 1;
+    int v9566 = v9565 + 1;
+    int v9567 = v9566 + 1;
+    int v9568 = v9567 + 1;
+    int v9569 = v9568 + 1;
+    int v9570 = v9569 + 1;
+    int v9571 = v9570 + 1;
+    int v9572 = v9571 + 1;
+    int v9573 = v9572 + 1;
+    int v9574 = v9573 + 1;
+    int v9575 = v9574 + 1;
+    int v9576 = v9575 + 1;
+    int v9577 = v9576 + 1;
+    int v9578 = v9577 + 1;
+    int v9579 = v9578 + 1;
+    int v9580 = v9579 + 1;
+    int v9581 = v9580 + 1;
+    int v9582 = v9581 + 1;
+    int v9583 = v9582 + 1;
+    int v9584 = v9583 + 1;
+    int v9585 = v9584 + 1;
+    int v9586 = v9585 + 1;
+    int v9587 = v9586 + 1;
+    int v9588 = v9587 + 1;
+    int v9589 = v9588 + 1;
+    int v9590 = v9589 + 1;
+    int v9591 = v9590 + 1;
+    int v9592 = v9591 + 1;
+    int v9593 = v9592 + 1;
+    int v9594 = v9593 + 1;
+    int v9595 = v9594 + 1;
+    int v9596 = v9595 + 1;
+    int v9597 = v9596 + 1;
+    int v9598 = v9597 + 1;
+    int v9599 = v9598 + 1;
+    int v9600 = v9599 + 1;
+    int v9601 = v9600 + 1;
+    int v9602 = v9601 + 1;
+    int v9603 = v9602 + 1;
+    int v9604 = v9603 + 1;
+    int v9605 = v9604 + 1;
+    int v9606 = v9605 + 1;
+    int v9607 = v9606 + 1;
+    int v9608 = v9607 + 1;
+    int v9609 = v9608 + 1;
+    int v9610 = v9609 + 1;
+    int v9611 = v9610 + 1;
+    int v9612 = v9611 + 1;
+    int v9613 = v9612 + 1;
+    int v9614 = v9613 + 1;
+    int v9615 = v9614 + 1;
+    int v9616 = v9615 + 1;
+    int v9617 = v9616 + 1;
+    int v9618 = v9617 + 1;
+    int v9619 = v9618 + 1;
+    int v9620 = v9619 + 1;
+    int v9621 = v9620 + 1;
+    int v9622 = v9621 + 1;
+    int v9623 = v9622 + 1;
+    int v9624 = v9623 + 1;
+    int v9625 = v9624 + 1;
+    int v9626 = v9625 + 1;
+    int v9627 = v9626 + 1;
+    int v9628 = v9627 + 1;
+    int v9629 = v9628 + 1;
+    int v9630 = v9629 + 1;
+    int v9631 = v9630 + 1;
+    int v9632 = v9631 + 1;
+    int v9633 = v9632 + 1;
+    int v9634 = v9633 + 1;
+    int v9635 = v9634 + 1;
+    int v9636 = v9635 + 1;
+    int v9637 = v9636 + 1;
+    int v9638 = v9637 + 1;
+    int v9639 = v9638 + 1;
+    int v9640 = v9639 + 1;
+    int v9641 = v9640 + 1;
+    int v9642 = v9641 + 1;
+    int v9643 = v9642 + 1;
+    int v9644 = v9643 + 1;
+    int v9645 = v9644 + 1;
+    int v9646 = v9645 + 1;
+    int v9647 = v9646 + 1;
+    int v9648 = v9647 + 1;
+    int v9649 = v9648 + 1;
+    int v9650 = v9649 + 1;
+    int v9651 = v9650 + 1;
+    int v9652 = v9651 + 1;
+    int v9653 = v9652 + 1;
+    int v9654 = v9653 + 1;
+    int v9655 = v9654 + 1;
+    int v9656 = v9655 + 1;
+    int v9657 = v9656 + 1;
+    int v9658 = v9657 + 1;
+    int v9659 = v9658 + 1;
+    int v9660 = v9659 + 1;
+    int v9661 = v9660 + 1;
+    int v9662 = v9661 + 1;
+    int v9663 = v9662 + 1;
+    int v9664 = v9663 + 1;
+    int v9665 = v9664 + 1;
+    int v9666 = v9665 + 1;
+    int v9667 = v9666 + 1;
+    int v9668 = v9667 + 1;
+    int v9669 = v9668 + 1;
+    int v9670 = v9669 + 1;
+    int v9671 = v9670 + 1;
+    int v9672 = v9671 + 1;
+    int v9673 = v9672 + 1;
+    int v9674 = v9673 + 1;
+    int v9675 = v9674 + 1;
+    int v9676 = v9675 + 1;
+    int v9677 = v9676 + 1;
+    int v9678 = v9677 + 1;
+    int v9679 = v9678 + 1;
+    int v9680 = v9679 + 1;
+    int v9681 = v9680 + 1;
+    int v9682 = v9681 + 1;
+    int v9683 = v9682 + 1;
+    int v9684 = v9683 + 1;
+    int v9685 = v9684 + 1;
+    int v9686 = v9685 + 1;
+    int v9687 = v9686 + 1;
+    int v9688 = v9687 + 1;
+    int v9689 = v9688 + 1;
+    int v9690 = v9689 + 1;
+    int v9691 = v9690 + 1;
+    int v9692 = v9691 + 1;
+    int v9693 = v9692 + 1;
+    int v9694 = v9693 + 1;
+    int v9695 = v9694 + 1;
+    int v9696 = v9695 + 1;
+    int v9697 = v9696 + 1;
+    int v9698 = v9697 + 1;
+    int v9699 = v9698 + 1;
+    int v9700 = v9699 + 1;
+    int v9701 = v9700 + 1;
+    int v9702 = v9701 + 1;
+    int v9703 = v9702 + 1;
+    int v9704 = v9703 + 1;
+    int v9705 = v9704 + 1;
+    int v9706 = v9705 + 1;
+    int v9707 = v9706 + 1;
+    int v9708 = v9707 + 1;
+    int v9709 = v9708 + 1;
+    int v9710 = v9709 + 1;
+    int v9711 = v9710 + 1;
+    int v9712 = v9711 + 1;
+    int v9713 = v9712 + 1;
+    int v9714 = v9713 + 1;
+    int v9715 = v9714 + 1;
+    int v9716 = v9715 + 1;
+    int v9717 = v9716 + 1;
+    int v9718 = v9717 + 1;
+    int v9719 = v9718 + 1;
+    int v9720 = v9719 + 1;
+    int v9721 = v9720 + 1;
+    int v9722 = v9721 + 1;
+    int v9723 = v9722 + 1;
+    int v9724 = v9723 + 1;
+    int v9725 = v9724 + 1;
+    int v9726 = v9725 + 1;
+    int v9727 = v9726 + 1;
+    int v9728 = v9727 + 1;
+    int v9729 = v9728 + 1;
+    int v9730 = v9729 + 1;
+    int v9731 = v9730 + 1;
+    int v9732 = v9731 + 1;
+    int v9733 = v9732 + 1;
+    int v9734 = v9733 + 1;
+    int v9735 = v9734 + 1;
+    int v9736 = v9735 + 1;
+    int v9737 = v9736 + 1;
+    int v9738 = v9737 + 1;
+    int v9739 = v9738 + 1;
+    int v9740 = v9739 + 1;
+    int v9741 = v9740 + 1;
+    int v9742 = v9741 + 1;
+    int v9743 = v9742 + 1;
+    int v9744 = v9743 + 1;
+    int v9745 = v9744 + 1;
+    int v9746 = v9745 + 1;
+    int v9747 = v9746 + 1;
+    int v9748 = v9747 + 1;
+    int v9749 = v9748 + 1;
+    int v9750 = v9749 + 1;
+    int v9751 = v9750 + 1;
+    int v9752 = v9751 + 1;
+    int v9753 = v9752 + 1;
+    int v9754 = v9753 + 1;
+    int v9755 = v9754 + 1;
+    int v9756 = v9755 + 1;
+    int v9757 = v9756 + 1;
+    int v9758 = v9757 + 1;
+    int v9759 = v9758 + 1;
+    int v9760 = v9759 + 1;
+    int v9761 = v9760 + 1;
+    int v9762 = v9761 + 1;
+    int v9763 = v9762 + 1;
+    int v9764 = v9763 + 1;
+    int v9765 = v9764 + 1;
+    int v9766 = v9765 + 1;
+    int v9767 = v9766 + 1;
+    int v9768 = v9767 + 1;
+    int v9769 = v9768 + 1;
+    int v9770 = v9769 + 1;
+    int v9771 = v9770 + 1;
+    int v9772 = v9771 + 1;
+    int v9773 = v9772 + 1;
+    int v9774 = v9773 + 1;
+    int v9775 = v9774 + 1;
+    int v9776 = v9775 + 1;
+    int v9777 = v9776 + 1;
+    int v9778 = v9777 + 1;
+    int v9779 = v9778 + 1;
+    int v9780 = v9779 + 1;
+    int v9781 = v9780 + 1;
+    int v9782 = v9781 + 1;
+    int v9783 = v9782 + 1;
+    int v9784 = v9783 + 1;
+    int v9785 = v9784 + 1;
+    int v9786 = v9785 + 1;
+    int v9787 = v9786 + 1;
+    int v9788 = v9787 + 1;
+    int v9789 = v9788 + 1;
+    int v9790 = v9789 + 1;
+    int v9791 = v9790 + 1;
+    int v9792 = v9791 + 1;
+    int v9793 = v9792 + 1;
+    int v9794 = v9793 + 1;
+    int v9795 = v9794 + 1;
+    int v9796 = v9795 + 1;
+    int v9797 = v9796 + 1;
+    int v9798 = v9797 + 1;
+    int v9799 = v9798 + 1;
+    int v9800 = v9799 + 1;
+    int v9801 = v9800 + 1;
+    int v9802 = v9801 + 1;
+    int v9803 = v9802 + 1;
+    int v9804 = v9803 + 1;
+    int v9805 = v9804 + 1;
+    int v9806 = v9805 + 1;
+    int v9807 = v9806 + 1;
+    int v9808 = v9807 + 1;
+    int v9809 = v9808 + 1;
+    int v9810 = v9809 + 1;
+    int v9811 = v9810 + 1;
+    int v9812 = v9811 + 1;
+    int v9813 = v9812 + 1;
+    int v9814 = v9813 + 1;
+    int v9815 = v9814 + 1;
+    int v9816 = v9815 + 1;
+    int v9817 = v9816 + 1;
+    int v9818 = v9817 + 1;
+    int v9819 = v9818 + 1;
+    int v9820 = v9819 + 1;
+    int v9821 = v9820 + 1;
+    int v9822 = v9821 + 1;
+    int v9823 = v9822 + 1;
+    int v9824 = v9823 + 1;
+    int v9825 = v9824 + 1;
+    int v9826 = v9825 + 1;
+    int v9827 = v9826 + 1;
+    int v9828 = v9827 + 1;
+    int v9829 = v9828 + 1;
+    int v9830 = v9829 + 1;
+    int v9831 = v9830 + 1;
+    int v9832 = v9831 + 1;
+    int v9833 = v9832 + 1;
+    int v9834 = v9833 + 1;
+    int v9835 = v9834 + 1;
+    int v9836 = v9835 + 1;
+    int v9837 = v9836 + 1;
+    int v9838 = v9837 + 1;
+    int v9839 = v9838 + 1;
+    int v9840 = v9839 + 1;
+    int v9841 = v9840 + 1;
+    int v9842 = v9841 + 1;
+    int v9843 = v9842 + 1;
+    int v9844 = v9843 + 1;
+    int v9845 = v9844 + 1;
+    int v9846 = v9845 + 1;
+    int v9847 = v9846 + 1;
+    int v9848 = v9847 + 1;
+    int v9849 = v9848 + 1;
+    int v9850 = v9849 + 1;
+    int v9851 = v9850 + 1;
+    int v9852 = v9851 + 1;
+    int v9853 = v9852 + 1;
+    int v9854 = v9853 + 1;
+    int v9855 = v9854 + 1;
+    int v9856 = v9855 + 1;
+    int v9857 = v9856 + 1;
+    int v9858 = v9857 + 1;
+    int v9859 = v9858 + 1;
+    int v9860 = v9859 + 1;
+    int v9861 = v9860 + 1;
+    int v9862 = v9861 + 1;
+    int v9863 = v9862 + 1;
+    int v9864 = v9863 + 1;
+    int v9865 = v9864 + 1;
+    int v9866 = v9865 + 1;
+    int v9867 = v9866 + 1;
+    int v9868 = v9867 + 1;
+    int v9869 = v9868 + 1;
+    int v9870 = v9869 + 1;
+    int v9871 = v9870 + 1;
+    int v9872 = v9871 + 1;
+    int v9873 = v9872 + 1;
+    int v9874 = v9873 + 1;
+    int v9875 = v9874 + 1;
+    int v9876 = v9875 + 1;
+    int v9877 = v9876 + 1;
+    int v9878 = v9877 + 1;
+    int v9879 = v9878 + 1;
+    int v9880 = v9879 + 1;
+    int v9881 = v9880 + 1;
+    int v9882 = v9881 + 1;
+    int v9883 = v9882 + 1;
+    int v9884 = v9883 + 1;
+    int v9885 = v9884 + 1;
+    int v9886 = v9885 + 1;
+    int v9887 = v9886 + 1;
+    int v9888 = v9887 + 1;
+    int v9889 = v9888 + 1;
+    int v9890 = v9889 + 1;
+    int v9891 = v9890 + 1;
+    int v9892 = v9891 + 1;
+    int v9893 = v9892 + 1;
+    int v9894 = v9893 + 1;
+    int v9895 = v9894 + 1;
+    int v9896 = v9895 + 1;
+    int v9897 = v9896 + 1;
+    int v9898 = v9897 + 1;
+    int v9899 = v9898 + 1;
+    int v9900 = v9899 + 1;
+    int v9901 = v9900 + 1;
+    int v9902 = v9901 + 1;
+    int v9903 = v9902 + 1;
+    int v9904 = v9903 + 1;
+    int v9905 = v9904 + 1;
+    int v9906 = v9905 + 1;
+    int v9907 = v9906 + 1;
+    int v9908 = v9907 + 1;
+    int v9909 = v9908 + 1;
+    int v9910 = v9909 + 1;
+    int v9911 = v9910 + 1;
+    int v9912 = v9911 + 1;
+    int v9913 = v9912 + 1;
+    int v9914 = v9913 + 1;
+    int v9915 = v9914 + 1;
+    int v9916 = v9915 + 1;
+    int v9917 = v9916 + 1;
+    int v9918 = v9917 + 1;
+    int v9919 = v9918 + 1;
+    int v9920 = v9919 + 1;
+    int v9921 = v9920 + 1;
+    int v9922 = v9921 + 1;
+    int v9923 = v9922 + 1;
+    int v9924 = v9923 + 1;
+    int v9925 = v9924 + 1;
+    int v9926 = v9925 + 1;
+    int v9927 = v9926 + 1;
+    int v9928 = v9927 + 1;
+    int v9929 = v9928 + 1;
+    int v9930 = v9929 + 1;
+    int v9931 = v9930 + 1;
+    int v9932 = v9931 + 1;
+    int v9933 = v9932 + 1;
+    int v9934 = v9933 + 1;
+    int v9935 = v9934 + 1;
+    int v9936 = v9935 + 1;
+    int v9937 = v9936 + 1;
+    int v9938 = v9937 + 1;
+    int v9939 = v9938 + 1;
+    int v9940 = v9939 + 1;
+    int v9941 = v9940 + 1;
+    int v9942 = v9941 + 1;
+    int v9943 = v9942 + 1;
+    int v9944 = v9943 + 1;
+    int v9945 = v9944 + 1;
+    int v9946 = v9945 + 1;
+    int v9947 = v9946 + 1;
+    int v9948 = v9947 + 1;
+    int v9949 = v9948 + 1;
+    int v9950 = v9949 + 1;
+    int v9951 = v9950 + 1;
+    int v9952 = v9951 + 1;
+    int v9953 = v9952 + 1;
+    int v9954 = v9953 + 1;
+    int v9955 = v9954 + 1;
+    int v9956 = v9955 + 1;
+    int v9957 = v9956 + 1;
+    int v9958 = v9957 + 1;
+    int v9959 = v9958 + 1;
+    int v9960 = v9959 + 1;
+    int v9961 = v9960 + 1;
+    int v9962 = v9961 + 1;
+    int v9963 = v9962 + 1;
+    int v9964 = v9963 + 1;
+    int v9965 = v9964 + 1;
+    int v9966 = v9965 + 1;
+    int v9967 = v9966 + 1;
+    int v9968 = v9967 + 1;
+    int v9969 = v9968 + 1;
+    int v9970 = v9969 + 1;
+    int v9971 = v9970 + 1;
+    int v9972 = v9971 + 1;
+    int v9973 = v9972 + 1;
+    int v9974 = v9973 + 1;
+    int v9975 = v9974 + 1;
+    int v9976 = v9975 + 1;
+    int v9977 = v9976 + 1;
+    int v9978 = v9977 + 1;
+    int v9979 = v9978 + 1;
+    int v9980 = v9979 + 1;
+    int v9981 = v9980 + 1;
+    int v9982 = v9981 + 1;
+    int v9983 = v9982 + 1;
+    int v9984 = v9983 + 1;
+    int v9985 = v9984 + 1;
+    int v9986 = v9985 + 1;
+    int v9987 = v9986 + 1;
+    int v9988 = v9987 + 1;
+    int v9989 = v9988 + 1;
+    int v9990 = v9989 + 1;
+    int v9991 = v9990 + 1;
+    int v9992 = v9991 + 1;
+    int v9993 = v9992 + 1;
+    int v9994 = v9993 + 1;
+    int v9995 = v9994 + 1;
+    int v9996 = v9995 + 1;
+    int v9997 = v9996 + 1;
+    int v9998 = v9997 + 1;
+    int v9999 = v9998 + 1;
+    int v10000 = v9999 + 1;
+    int v10001 = v10000 + 1;
+    int v10002 = v10001 + 1;
+    int v10003 = v10002 + 1;
+    int v10004 = v10003 + 1;
+    int v10005 = v10004 + 1;
+    int v10006 = v10005 + 1;
+    int v10007 = v10006 + 1;
+    int v10008 = v10007 + 1;
+    int v10009 = v10008 + 1;
+    int v10010 = v10009 + 1;
+    int v10011 = v10010 + 1;
+    int v10012 = v10011 + 1;
+    int v10013 = v10012 + 1;
+    int v10014 = v10013 + 1;
+    int v10015 = v10014 + 1;
+    int v10016 = v10015 + 1;
+    int v10017 = v10016 + 1;
+    int v10018 = v10017 + 1;
+    int v10019 = v10018 + 1;
+    int v10020 = v10019 + 1;
+    int v10021 = v10020 + 1;
+    int v10022 = v10021 + 1;
+    int v10023 = v10022 + 1;
+    int v10024 = v10023 + 1;
+    int v10025 = v10024 + 1;
+    int v10026 = v10025 + 1;
+    int v10027 = v10026 + 1;
+    int v10028 = v10027 + 1;
+    int v10029 = v10028 + 1;
+    int v10030 = v10029 + 1;
+    int v10031 = v10030 + 1;
+    int v10032 = v10031 + 1;
+    int v10033 = v10032 + 1;
+    int v10034 = v10033 + 1;
+    int v10035 = v10034 + 1;
+    int v10036 = v10035 + 1;
+    int v10037 = v10036 + 1;
+    int v10038 = v10037 + 1;
+    int v10039 = v10038 + 1;
+    int v10040 = v10039 + 1;
+    int v10041 = v10040 + 1;
+    int v10042 = v10041 + 1;
+    int v10043 = v10042 + 1;
+    int v10044 = v10043 + 1;
+    int v10045 = v10044 + 1;
+    int v10046 = v10045 + 1;
+    int v10047 = v10046 + 1;
+    int v10048 = v10047 + 1;
+    int v10049 = v10048 + 1;
+    int v10050 = v10049 + 1;
+    int v10051 = v10050 + 1;
+    int v10052 = v10051 + 1;
+    int v10053 = v10052 + 1;
+    int v10054 = v10053 + 1;
+    int v10055 = v10054 + 1;
+    int v10056 = v10055 + 1;
+    int v10057 = v10056 + 1;
+    int v10058 = v10057 + 1;
+    int v10059 = v10058 + 1;
+    int v10060 = v10059 + 1;
+    int v10061 = v10060 + 1;
+    int v10062 = v10061 + 1;
+    int v10063 = v10062 + 1;
+    int v10064 = v10063 + 1;
+    int v10065 = v10064 + 1;
+    int v10066 = v10065 + 1;
+    int v10067 = v10066 + 1;
+    int v10068 = v10067 + 1;
+    int v10069 = v10068 + 1;
+    int v10070 = v10069 + 1;
+    int v10071 = v10070 + 1;
+    int v10072 = v10071 + 1;
+    int v10073 = v10072 + 1;
+    int v10074 = v10073 + 1;
+    int v10075 = v10074 + 1;
+    int v10076 = v10075 + 1;
+    int v10077 = v10076 + 1;
+    int v10078 = v10077 + 1;
+    int v10079 = v10078 + 1;
+    int v10080 = v10079 + 1;
+    int v10081 = v10080 + 1;
+    int v10082 = v10081 + 1;
+    int v10083 = v10082 + 1;
+    int v10084 = v10083 + 1;
+    int v10085 = v10084 + 1;
+    int v10086 = v10085 + 1;
+    int v10087 = v10086 + 1;
+    int v10088 = v10087 + 1;
+    int v10089 = v10088 + 1;
+    int v10090 = v10089 + 1;
+    int v10091 = v10090 + 1;
+    int v10092 = v10091 + 1;
+    int v10093 = v10092 + 1;
+    int v10094 = v10093 + 1;
+    int v10095 = v10094 + 1;
+    int v10096 = v10095 + 1;
+    int v10097 = v10096 + 1;
+    int v10098 = v10097 + 1;
+    int v10099 = v10098 + 1;
+    int v10100 = v10099 + 1;
+    int v10101 = v10100 + 1;
+    int v10102 = v10101 + 1;
+    int v10103 = v10102 + 1;
+    int v10104 = v10103 + 1;
+    int v10105 = v10104 + 1;
+    int v10106 = v10105 + 1;
+    int v10107 = v10106 + 1;
+    int v10108 = v10107 + 1;
+    int v10109 = v10108 + 1;
+    int v10110 = v10109 + 1;
+    int v10111 = v10110 + 1;
+    int v10112 = v10111 + 1;
+    int v10113 = v10112 + 1;
+    int v10114 = v10113 + 1;
+    int v10115 = v10114 + 1;
+    int v10116 = v10115 + 1;
+    int v10117 = v10116 + 1;
+    int v10118 = v10117 + 1;
+    int v10119 = v10118 + 1;
+    int v10120 = v10119 + 1;
+    int v10121 = v10120 + 1;
+    int v10122 = v10121 + 1;
+    int v10123 = v10122 + 1;
+    int v10124 = v10123 + 1;
+    int v10125 = v10124 + 1;
+    int v10126 = v10125 + 1;
+    int v10127 = v10126 + 1;
+    int v10128 = v10127 + 1;
+    int v10129 = v10128 + 1;
+    int v10130 = v10129 + 1;
+    int v10131 = v10130 + 1;
+    int v10132 = v10131 + 1;
+    int v10133 = v10132 + 1;
+    int v10134 = v10133 + 1;
+    int v10135 = v10134 + 1;
+    int v10136 = v10135 + 1;
+    int v10137 = v10136 + 1;
+    int v10138 = v10137 + 1;
+    int v10139 = v10138 + 1;
+    int v10140 = v10139 + 1;
+    int v10141 = v10140 + 1;
+    int v10142 = v10141 + 1;
+    int v10143 = v10142 + 1;
+    int v10144 = v10143 + 1;
+    int v10145 = v10144 + 1;
+    int v10146 = v10145 + 1;
+    int v10147 = v10146 + 1;
+    int v10148 = v10147 + 1;
+    int v10149 = v10148 + 1;
+    int v10150 = v10149 + 1;
+    int v10151 = v10150 + 1;
+    int v10152 = v10151 + 1;
+    int v10153 = v10152 + 1;
+    int v10154 = v10153 + 1;
+    int v10155 = v10154 + 1;
+    int v10156 = v10155 + 1;
+    int v10157 = v10156 + 1;
+    int v10158 = v10157 + 1;
+    int v10159 = v10158 + 1;
+    int v10160 = v10159 + 1;
+    int v10161 = v10160 + 1;
+    int v10162 = v10161 + 1;
+    int v10163 = v10162 + 1;
+    int v10164 = v10163 + 1;
+    int v10165 = v10164 + 1;
+    int v10166 = v10165 + 1;
+    int v10167 = v10166 + 1;
+    int v10168 = v10167 + 1;
+    int v10169 = v10168 + 1;
+    int v10170 = v10169 + 1;
+    int v10171 = v10170 + 1;
+    int v10172 = v10171 + 1;
+    int v10173 = v10172 + 1;
+    int v10174 = v10173 + 1;
+    int v10175 = v10174 + 1;
+    int v10176 = v10175 + 1;
+    int v10177 = v10176 + 1;
+    int v10178 = v10177 + 1;
+    int v10179 = v10178 + 1;
+    int v10180 = v10179 + 1;
+    int v10181 = v10180 + 1;
+    int v10182 = v10181 + 1;
+    int v10183 = v10182 + 1;
+    int v10184 = v10183 + 1;
+    int v10185 = v10184 + 1;
+    int v10186 = v10185 + 1;
+    int v10187 = v10186 + 1;
+    int v10188 = v10187 + 1;
+    int v10189 = v10188 + 1;
+    int v10190 = v10189 + 1;
+    int v10191 = v10190 + 1;
+    int v10192 = v10191 + 1;
+    int v10193 = v10192 + 1;
+    int v10194 = v10193 + 1;
+    int v10195 = v10194 + 1;
+    int v10196 = v10195 + 1;
+    int v10197 = v10196 + 1;
+    int v10198 = v10197 + 1;
+    int v10199 = v10198 + 1;
+    int v10200 = v10199 + 1;
+    int v10201 = v10200 + 1;
+    int v10202 = v10201 + 1;
+    int v10203 = v10202 + 1;
+    int v10204 = v10203 + 1;
+    int v10205 = v10204 + 1;
+    int v10206 = v10205 + 1;
+    int v10207 = v10206 + 1;
+    int v10208 = v10207 + 1;
+    int v10209 = v10208 + 1;
+    int v10210 = v10209 + 1;
+    int v10211 = v10210 + 1;
+    int v10212 = v10211 + 1;
+    int v10213 = v10212 + 1;
+    int v10214 = v10213 + 1;
+    int v10215 = v10214 + 1;
+    int v10216 = v10215 + 1;
+    int v10217 = v10216 + 1;
+    int v10218 = v10217 + 1;
+    int v10219 = v10218 + 1;
+    int v10220 = v10219 + 1;
+    int v10221 = v10220 + 1;
+    int v10222 = v10221 + 1;
+    int v10223 = v10222 + 1;
+    int v10224 = v10223 + 1;
+    int v10225 = v10224 + 1;
+    int v10226 = v10225 + 1;
+    int v10227 = v10226 + 1;
+    int v10228 = v10227 + 1;
+    int v10229 = v10228 + 1;
+    int v10230 = v10229 + 1;
+    int v10231 = v10230 + 1;
+    int v10232 = v10231 + 1;
+    int v10233 = v10232 + 1;
+    int v10234 = v10233 + 1;
+    int v10235 = v10234 + 1;
+    int v10236 = v10235 + 1;
+    int v10237 = v10236 + 1;
+    int v10238 = v10237 + 1;
+    int v10239 = v10238 + 1;
+    int v10240 = v10239 + 1;
+    int v10241 = v10240 + 1;
+    int v10242 = v10241 + 1;
+    int v10243 = v10242 + 1;
+    int v10244 = v10243 + 1;
+    int v10245 = v10244 + 1;
+    int v10246 = v10245 + 1;
+    int v10247 = v10246 + 1;
+    int v10248 = v10247 + 1;
+    int v10249 = v10248 + 1;
+    int v10250 = v10249 + 1;
+    int v10251 = v10250 + 1;
+    int v10252 = v10251 + 1;
+    int v10253 = v10252 + 1;
+    int v10254 = v10253 + 1;
+    int v10255 = v10254 + 1;
+    int v10256 = v10255 + 1;
+    int v10257 = v10256 + 1;
+    int v10258 = v10257 + 1;
+    int v10259 = v10258 + 1;
+    int v10260 = v10259 + 1;
+    int v10261 = v10260 + 1;
+    int v10262 = v10261 + 1;
+    int v10263 = v10262 + 1;
+    int v10264 = v10263 + 1;
+    int v10265 = v10264 + 1;
+    int v10266 = v10265 + 1;
+    int v10267 = v10266 + 1;
+    int v10268 = v10267 + 1;
+    int v10269 = v10268 + 1;
+    int v10270 = v10269 + 1;
+    int v10271 = v10270 + 1;
+    int v10272 = v10271 + 1;
+    int v10273 = v10272 + 1;
+    int v10274 = v10273 + 1;
+    int v10275 = v10274 + 1;
+    int v10276 = v10275 + 1;
+    int v10277 = v10276 + 1;
+    int v10278 = v10277 + 1;
+    int v10279 = v10278 + 1;
+    int v10280 = v10279 + 1;
+    int v10281 = v10280 + 1;
+    int v10282 = v10281 + 1;
+    int v10283 = v10282 + 1;
+    int v10284 = v10283 + 1;
+    int v10285 = v10284 + 1;
+    int v10286 = v10285 + 1;
+    int v10287 = v10286 + 1;
+    int v10288 = v10287 + 1;
+    int v10289 = v10288 + 1;
+    int v10290 = v10289 + 1;
+    int v10291 = v10290 + 1;
+    int v10292 = v10291 + 1;
+    int v10293 = v10292 + 1;
+    int v10294 = v10293 + 1;
+    int v10295 = v10294 + 1;
+    int v10296 = v10295 + 1;
+    int v10297 = v10296 + 1;
+    int v10298 = v10297 + 1;
+    int v10299 = v10298 + 1;
+    int v10300 = v10299 + 1;
+    int v10301 = v10300 + 1;
+    int v10302 = v10301 + 1;
+    int v10303 = v10302 + 1;
+    int v10304 = v10303 + 1;
+    int v10305 = v10304 + 1;
+    int v10306 = v10305 + 1;
+    int v10307 = v10306 + 1;
+    int v10308 = v10307 + 1;
+    int v10309 = v10308 + 1;
+    int v10310 = v10309 + 1;
+    int v10311 = v10310 + 1;
+    int v10312 = v10311 + 1;
+    int v10313 = v10312 + 1;
+    int v10314 = v10313 + 1;
+    int v10315 = v10314 + 1;
+    int v10316 = v10315 + 1;
+    int v10317 = v10316 + 1;
+    int v10318 = v10317 + 1;
+    int v10319 = v10318 + 1;
+    int v10320 = v10319 + 1;
+    int v10321 = v10320 + 1;
+    int v10322 = v10321 + 1;
+    int v10323 = v10322 + 1;
+    int v10324 = v10323 + 1;
+    int v10325 = v10324 + 1;
+    int v10326 = v10325 + 1;
+    int v10327 = v10326 + 1;
+    int v10328 = v10327 + 1;
+    int v10329 = v10328 + 1;
+    int v10330 = v10329 + 1;
+    int v10331 = v10330 + 1;
+    int v10332 = v10331 + 1;
+    int v10333 = v10332 + 1;
+    int v10334 = v10333 + 1;
+    int v10335 = v10334 + 1;
+    int v10336 = v10335 + 1;
+    int v10337 = v10336 + 1;
+    int v10338 = v10337 + 1;
+    int v10339 = v10338 + 1;
+    int v10340 = v10339 + 1;
+    int v10341 = v10340 + 1;
+    int v10342 = v10341 + 1;
+    int v10343 = v10342 + 1;
+    int v10344 = v10343 + 1;
+    int v10345 = v10344 + 1;
+    int v10346 = v10345 + 1;
+    int v10347 = v10346 + 1;
+    int v10348 = v10347 + 1;
+    int v10349 = v10348 + 1;
+    int v10350 = v10349 + 1;
+    int v10351 = v10350 + 1;
+    int v10352 = v10351 + 1;
+    int v10353 = v10352 + 1;
+    int v10354 = v10353 + 1;
+    int v10355 = v10354 + 1;
+    int v10356 = v10355 + 1;
+    int v10357 = v10356 + 1;
+    int v10358 = v10357 + 1;
+    int v10359 = v10358 + 1;
+    int v10360 = v10359 + 1;
+    int v10361 = v10360 + 1;
+    int v10362 = v10361 + 1;
+    int v10363 = v10362 + 1;
+    int v10364 = v10363 + 1;
+    int v10365 = v10364 + 1;
+    int v10366 = v10365 + 1;
+    int v10367 = v10366 + 1;
+    int v10368 = v10367 + 1;
+    int v10369 = v10368 + 1;
+    int v10370 = v10369 + 1;
+    int v10371 = v10370 + 1;
+    int v10372 = v10371 + 1;
+    int v10373 = v10372 + 1;
+    int v10374 = v10373 + 1;
+    int v10375 = v10374 + 1;
+    int v10376 = v10375 + 1;
+    int v10377 = v10376 + 1;
+    int v10378 = v10377 + 1;
+    int v10379 = v10378 + 1;
+    int v10380 = v10379 + 1;
+    int v10381 = v10380 + 1;
+    int v10382 = v10381 + 1;
+    int v10383 = v10382 + 1;
+    int v10384 = v10383 + 1;
+    int v10385 = v10384 + 1;
+    int v10386 = v10385 + 1;
+    int v10387 = v10386 + 1;
+    int v10388 = v10387 + 1;
+    int v10389 = v10388 + 1;
+    int v10390 = v10389 + 1;
+    int v10391 = v10390 + 1;
+    int v10392 = v10391 + 1;
+    int v10393 = v10392 + 1;
+    int v10394 = v10393 + 1;
+    int v10395 = v10394 + 1;
+    int v10396 = v10395 + 1;
+    int v10397 = v10396 + 1;
+    int v10398 = v10397 + 1;
+    int v10399 = v10398 + 1;
+    int v10400 = v10399 + 1;
+    int v10401 = v10400 + 1;
+    int v10402 = v10401 + 1;
+    int v10403 = v10402 + 1;
+    int v10404 = v10403 + 1;
+    int v10405 = v10404 + 1;
+    int v10406 = v10405 + 1;
+    int v10407 = v10406 + 1;
+    int v10408 = v10407 + 1;
+    int v10409 = v10408 + 1;
+    int v10410 = v10409 + 1;
+    int v10411 = v10410 + 1;
+    int v10412 = v10411 + 1;
+    int v10413 = v10412 + 1;
+    int v10414 = v10413 + 1;
+    int v10415 = v10414 + 1;
+    int v10416 = v10415 + 1;
+    int v10417 = v10416 + 1;
+    int v10418 = v10417 + 1;
+    int v10419 = v10418 + 1;
+    int v10420 = v10419 + 1;
+    int v10421 = v10420 + 1;
+    int v10422 = v10421 + 1;
+    int v10423 = v10422 + 1;
+    int v10424 = v10423 + 1;
+    int v10425 = v10424 + 1;
+    int v10426 = v10425 + 1;
+    int v10427 = v10426 + 1;
+    int v10428 = v10427 + 1;
+    int v10429 = v10428 + 1;
+    int v10430 = v10429 + 1;
+    int v10431 = v10430 + 1;
+    int v10432 = v10431 + 1;
+    int v10433 = v10432 + 1;
+    int v10434 = v10433 + 1;
+    int v10435 = v10434 + 1;
+    int v10436 = v10435 + 1;
+    int v10437 = v10436 + 1;
+    int v10438 = v10437 + 1;
+    int v10439 = v10438 + 1;
+    int v10440 = v10439 + 1;
+    int v10441 = v10440 + 1;
+    int v10442 = v10441 + 1;
+    int v10443 = v10442 + 1;
+    int v10444 = v10443 + 1;
+    int v10445 = v10444 + 1;
+    int v10446 = v10445 + 1;
+    int v10447 = v10446 + 1;
+    int v10448 = v10447 + 1;
+    int v10449 = v10448 + 1;
+    int v10450 = v10449 + 1;
+    int v10451 = v10450 + 1;
+    int v10452 = v10451 + 1;
+    int v10453 = v10452 + 1;
+    int v10454 = v10453 + 1;
+    int v10455 = v10454 + 1;
+    int v10456 = v10455 + 1;
+    int v10457 = v10456 + 1;
+    int v10458 = v10457 + 1;
+    int v10459 = v10458 + 1;
+    int v10460 = v10459 + 1;
+    int v10461 = v10460 + 1;
+    int v10462 = v10461 + 1;
+    int v10463 = v10462 + 1;
+    int v10464 = v10463 + 1;
+    int v10465 = v10464 + 1;
+    int v10466 = v10465 + 1;
+    int v10467 = v10466 + 1;
+    int v10468 = v10467 + 1;
+    int v10469 = v10468 + 1;
+    int v10470 = v10469 + 1;
+    int v10471 = v10470 + 1;
+    int v10472 = v10471 + 1;
+    int v10473 = v10472 + 1;
+    int v10474 = v10473 + 1;
+    int v10475 = v10474 + 1;
+    int v10476 = v10475 + 1;
+    int v10477 = v10476 + 1;
+    int v10478 = v10477 + 1;
+    int v10479 = v10478 + 1;
+    int v10480 = v10479 + 1;
+    int v10481 = v10480 + 1;
+    int v10482 = v10481 + 1;
+    int v10483 = v10482 + 1;
+    int v10484 = v10483 + 1;
+    int v10485 = v10484 + 1;
+    int v10486 = v10485 + 1;
+    int v10487 = v10486 + 1;
+    int v10488 = v10487 + 1;
+    int v10489 = v10488 + 1;
+    int v10490 = v10489 + 1;
+    int v10491 = v10490 + 1;
+    int v10492 = v10491 + 1;
+    int v10493 = v10492 + 1;
+    int v10494 = v10493 + 1;
+    int v10495 = v10494 + 1;
+    int v10496 = v10495 + 1;
+    int v10497 = v10496 + 1;
+    int v10498 = v10497 + 1;
+    int v10499 = v10498 + 1;
+    int v10500 = v10499 + 1;
+    int v10501 = v10500 + 1;
+    int v10502 = v10501 + 1;
+    int v10503 = v10502 + 1;
+    int v10504 = v10503 + 1;
+    int v10505 = v10504 + 1;
+    int v10506 = v10505 + 1;
+    int v10507 = v10506 + 1;
+    int v10508 = v10507 + 1;
+    int v10509 = v10508 + 1;
+    int v10510 = v10509 + 1;
+    int v10511 = v10510 + 1;
+    int v10512 = v10511 + 1;
+    int v10513 = v10512 + 1;
+    int v10514 = v10513 + 1;
+    int v10515 = v10514 + 1;
+    int v10516 = v10515 + 1;
+    int v10517 = v10516 + 1;
+    int v10518 = v10517 + 1;
+    int v10519 = v10518 + 1;
+    int v10520 = v10519 + 1;
+    int v10521 = v10520 + 1;
+    int v10522 = v10521 + 1;
+    int v10523 = v10522 + 1;
+    int v10524 = v10523 + 1;
+    int v10525 = v10524 + 1;
+    int v10526 = v10525 + 1;
+    int v10527 = v10526 + 1;
+    int v10528 = v10527 + 1;
+    int v10529 = v10528 + 1;
+    int v10530 = v10529 + 1;
+    int v10531 = v10530 + 1;
+    int v10532 = v10531 + 1;
+    int v10533 = v10532 + 1;
+    int v10534 = v10533 + 1;
+    int v10535 = v10534 + 1;
+    int v10536 = v10535 + 1;
+    int v10537 = v10536 + 1;
+    int v10538 = v10537 + 1;
+    int v10539 = v10538 + 1;
+    int v10540 = v10539 + 1;
+    int v10541 = v10540 + 1;
+    int v10542 = v10541 + 1;
+    int v10543 = v10542 + 1;
+    int v10544 = v10543 + 1;
+    int v10545 = v10544 + 1;
+    int v10546 = v10545 + 1;
+    int v10547 = v10546 + 1;
+    int v10548 = v10547 + 1;
+    int v10549 = v10548 + 1;
+    int v10550 = v10549 + 1;
+    int v10551 = v10550 + 1;
+    int v10552 = v10551 + 1;
+    int v10553 = v10552 + 1;
+    int v10554 = v10553 + 1;
+    int v10555 = v10554 + 1;
+    int v10556 = v10555 + 1;
+    int v10557 = v10556 + 1;
+    int v10558 = v10557 + 1;
+    int v10559 = v10558 + 1;
+    int v10560 = v10559 + 1;
+    int v10561 = v10560 + 1;
+    int v10562 = v10561 + 1;
+    int v10563 = v10562 + 1;
+    int v10564 = v10563 + 1;
+    int v10565 = v10564 + 1;
+    int v10566 = v10565 + 1;
+    int v10567 = v10566 + 1;
+    int v10568 = v10567 + 1;
+    int v10569 = v10568 + 1;
+    int v10570 = v10569 + 1;
+    int v10571 = v10570 + 1;
+    int v10572 = v10571 + 1;
+    int v10573 = v10572 + 1;
+    int v10574 = v10573 + 1;
+    int v10575 = v10574 + 1;
+    int v10576 = v10575 + 1;
+    int v10577 = v10576 + 1;
+    int v10578 = v10577 + 1;
+    int v10579 = v10578 + 1;
+    int v10580 = v10579 + 1;
+    int v10581 = v10580 + 1;
+    int v10582 = v10581 + 1;
+    int v10583 = v10582 + 1;
+    int v10584 = v10583 + 1;
+    int v10585 = v10584 + 1;
+    int v10586 = v10585 + 1;
+    int v10587 = v10586 + 1;
+    int v10588 = v10587 + 1;
+    int v10589 = v10588 + 1;
+    int v10590 = v10589 + 1;
+    int v10591 = v10590 + 1;
+    int v10592 = v10591 + 1;
+    int v10593 = v10592 + 1;
+    int v10594 = v10593 + 1;
+    int v10595 = v10594 + 1;
+    int v10596 = v10595 + 1;
+    int v10597 = v10596 + 1;
+    int v10598 = v10597 + 1;
+    int v10599 = v10598 + 1;
+    int v10600 = v10599 + 1;
+    int v10601 = v10600 + 1;
+    int v10602 = v10601 + 1;
+    int v10603 = v10602 + 1;
+    int v10604 = v10603 + 1;
+    int v10605 = v10604 + 1;
+    int v10606 = v10605 + 1;
+    int v10607 = v10606 + 1;
+    int v10608 = v10607 + 1;
+    int v10609 = v10608 + 1;
+    int v10610 = v10609 + 1;
+    int v10611 = v10610 + 1;
+    int v10612 = v10611 + 1;
+    int v10613 = v10612 + 1;
+    int v10614 = v10613 + 1;
+    int v10615 = v10614 + 1;
+    int v10616 = v10615 + 1;
+    int v10617 = v10616 + 1;
+    int v10618 = v10617 + 1;
+    int v10619 = v10618 + 1;
+    int v10620 = v10619 + 1;
+    int v10621 = v10620 + 1;
+    int v10622 = v10621 + 1;
+    int v10623 = v10622 + 1;
+    int v10624 = v10623 + 1;
+    int v10625 = v10624 + 1;
+    int v10626 = v10625 + 1;
+    int v10627 = v10626 + 1;
+    int v10628 = v10627 + 1;
+    int v10629 = v10628 + 1;
+    int v10630 = v10629 + 1;
+    int v10631 = v10630 + 1;
+    int v10632 = v10631 + 1;
+    int v10633 = v10632 + 1;
+    int v10634 = v10633 + 1;
+    int v10635 = v10634 + 1;
+    int v10636 = v10635 + 1;
+    int v10637 = v10636 + 1;
+    int v10638 = v10637 + 1;
+    int v10639 = v10638 + 1;
+    int v10640 = v10639 + 1;
+    int v10641 = v10640 + 1;
+    int v10642 = v10641 + 1;
+    int v10643 = v10642 + 1;
+    int v10644 = v10643 + 1;
+    int v10645 = v10644 + 1;
+    int v10646 = v10645 + 1;
+    int v10647 = v10646 + 1;
+    int v10648 = v10647 + 1;
+    int v10649 = v10648 + 1;
+    int v10650 = v10649 + 1;
+    int v10651 = v10650 + 1;
+    int v10652 = v10651 + 1;
+    int v10653 = v10652 + 1;
+    int v10654 = v10653 + 1;
+    int v10655 = v10654 + 1;
+    int v10656 = v10655 + 1;
+    int v10657 = v10656 + 1;
+    int v10658 = v10657 + 1;
+    int v10659 = v10658 + 1;
+    int v10660 = v10659 + 1;
+    int v10661 = v10660 + 1;
+    int v10662 = v10661 + 1;
+    int v10663 = v10662 + 1;
+    int v10664 = v10663 + 1;
+    int v10665 = v10664 + 1;
+    int v10666 = v10665 + 1;
+    int v10667 = v10666 + 1;
+    int v10668 = v10667 + 1;
+    int v10669 = v10668 + 1;
+    int v10670 = v10669 + 1;
+    int v10671 = v10670 + 1;
+    int v10672 = v10671 + 1;
+    int v10673 = v10672 + 1;
+    int v10674 = v10673 + 1;
+    int v10675 = v10674 + 1;
+    int v10676 = v10675 + 1;
+    int v10677 = v10676 + 1;
+    int v10678 = v10677 + 1;
+    int v10679 = v10678 + 1;
+    int v10680 = v10679 + 1;
+    int v10681 = v10680 + 1;
+    int v10682 = v10681 + 1;
+    int v10683 = v10682 + 1;
+    int v10684 = v10683 + 1;
+    int v10685 = v10684 + 1;
+    int v10686 = v10685 + 1;
+    int v10687 = v10686 + 1;
+    int v10688 = v10687 + 1;
+    int v10689 = v10688 + 1;
+    int v10690 = v10689 + 1;
+    int v10691 = v10690 + 1;
+    int v10692 = v10691 + 1;
+    int v10693 = v10692 + 1;
+    int v10694 = v10693 + 1;
+    int v10695 = v10694 + 1;
+    int v10696 = v10695 + 1;
+    int v10697 = v10696 + 1;
+    int v10698 = v10697 + 1;
+    int v10699 = v10698 + 1;
+    int v10700 = v10699 + 1;
+    int v10701 = v10700 + 1;
+    int v10702 = v10701 + 1;
+    int v10703 = v10702 + 1;
+    int v10704 = v10703 + 1;
+    int v10705 = v10704 + 1;
+    int v10706 = v10705 + 1;
+    int v10707 = v10706 + 1;
+    int v10708 = v10707 + 1;
+    int v10709 = v10708 + 1;
+    int v10710 = v10709 + 1;
+    int v10711 = v10710 + 1;
+    int v10712 = v10711 + 1;
+    int v10713 = v10712 + 1;
+    int v10714 = v10713 + 1;
+    int v10715 = v10714 + 1;
+    int v10716 = v10715 + 1;
+    int v10717 = v10716 + 1;
+    int v10718 = v10717 + 1;
+    int v10719 = v10718 + 1;
+    int v10720 = v10719 + 1;
+    int v10721 = v10720 + 1;
+    int v10722 = v10721 + 1;
+    int v10723 = v10722 + 1;
+    int v10724 = v10723 + 1;
+    int v10725 = v10724 + 1;
+    int v10726 = v10725 + 1;
+    int v10727 = v10726 + 1;
+    int v10728 = v10727 + 1;
+    int v10729 = v10728 + 1;
+    int v10730 = v10729 + 1;
+    int v10731 = v10730 + 1;
+    int v10732 = v10731 + 1;
+    int v10733 = v10732 + 1;
+    int v10734 = v10733 + 1;
+    int v10735 = v10734 + 1;
+    int v10736 = v10735 + 1;
+    int v10737 = v10736 + 1;
+    int v10738 = v10737 + 1;
+    int v10739 = v10738 + 1;
+    int v10740 = v10739 + 1;
+    int v10741 = v10740 + 1;
+    int v10742 = v10741 + 1;
+    int v10743 = v10742 + 1;
+    int v10744 = v10743 + 1;
+    int v10745 = v10744 + 1;
+    int v10746 = v10745 + 1;
+    int v10747 = v10746 + 1;
+    int v10748 = v10747 + 1;
+    int v10749 = v10748 + 1;
+    int v10750 = v10749 + 1;
+    int v10751 = v10750 + 1;
+    int v10752 = v10751 + 1;
+    int v10753 = v10752 + 1;
+    int v10754 = v10753 + 1;
+    int v10755 = v10754 + 1;
+    int v10756 = v10755 + 1;
+    int v10757 = v10756 + 1;
+    int v10758 = v10757 + 1;
+    int v10759 = v10758 + 1;
+    int v10760 = v10759 + 1;
+    int v10761 = v10760 + 1;
+    int v10762 = v10761 + 1;
+    int v10763 = v10762 + 1;
+    int v10764 = v10763 + 1;
+    int v10765 = v10764 + 1;
+    int v10766 = v10765 + 1;
+    int v10767 = v10766 + 1;
+    int v10768 = v10767 + 1;
+    int v10769 = v10768 + 1;
+    int v10770 = v10769 + 1;
+    int v10771 = v10770 + 1;
+    int v10772 = v10771 + 1;
+    int v10773 = v10772 + 1;
+    int v10774 = v10773 + 1;
+    int v10775 = v10774 + 1;
+    int v10776 = v10775 + 1;
+    int v10777 = v10776 + 1;
+    int v10778 = v10777 + 1;
+    int v10779 = v10778 + 1;
+    int v10780 = v10779 + 1;
+    int v10781 = v10780 + 1;
+    int v10782 = v10781 + 1;
+    int v10783 = v10782 + 1;
+    int v10784 = v10783 + 1;
+    int v10785 = v10784 + 1;
+    int v10786 = v10785 + 1;
+    int v10787 = v10786 + 1;
+    int v10788 = v10787 + 1;
+    int v10789 = v10788 + 1;
+    int v10790 = v10789 + 1;
+    int v10791 = v10790 + 1;
+    int v10792 = v10791 + 1;
+    int v10793 = v10792 + 1;
+    int v10794 = v10793 + 1;
+    int v10795 = v10794 + 1;
+    int v10796 = v10795 + 1;
+    int v10797 = v10796 + 1;
+    int v10798 = v10797 + 1;
+    int v10799 = v10798 + 1;
+    int v10800 = v10799 + 1;
+    int v10801 = v10800 + 1;
+    int v10802 = v10801 + 1;
+    int v10803 = v10802 + 1;
+    int v10804 = v10803 + 1;
+    int v10805 = v10804 + 1;
+    int v10806 = v10805 + 1;
+    int v10807 = v10806 + 1;
+    int v10808 = v10807 + 1;
+    int v10809 = v10808 + 1;
+    int v10810 = v10809 + 1;
+    int v10811 = v10810 + 1;
+    int v10812 = v10811 + 1;
+    int v10813 = v10812 + 1;
+    int v10814 = v10813 + 1;
+    int v10815 = v10814 + 1;
+    int v10816 = v10815 + 1;
+    int v10817 = v10816 + 1;
+    int v10818 = v10817 + 1;
+    int v10819 = v10818 + 1;
+    int v10820 = v10819 + 1;
+    int v10821 = v10820 + 1;
+    int v10822 = v10821 + 1;
+    int v10823 = v10822 + 1;
+    int v10824 = v10823 + 1;
+    int v10825 = v10824 + 1;
+    int v10826 = v10825 + 1;
+    int v10827 = v10826 + 1;
+    int v10828 = v10827 + 1;
+    int v10829 = v10828 + 1;
+    int v10830 = v10829 + 1;
+    int v10831 = v10830 + 1;
+    int v10832 = v10831 + 1;
+    int v10833 = v10832 + 1;
+    int v10834 = v10833 + 1;
+    int v10835 = v10834 + 1;
+    int v10836 = v10835 + 1;
+    int v10837 = v10836 + 1;
+    int v10838 = v10837 + 1;
+    int v10839 = v10838 + 1;
+    int v10840 = v10839 + 1;
+    int v10841 = v10840 + 1;
+    int v10842 = v10841 + 1;
+    int v10843 = v10842 + 1;
+    int v10844 = v10843 + 1;
+    int v10845 = v10844 + 1;
+    int v10846 = v10845 + 1;
+    int v10847 = v10846 + 1;
+    int v10848 = v10847 + 1;
+    int v10849 = v10848 + 1;
+    int v10850 = v10849 + 1;
+    int v10851 = v10850 + 1;
+    int v10852 = v10851 + 1;
+    int v10853 = v10852 + 1;
+    int v10854 = v10853 + 1;
+    int v10855 = v10854 + 1;
+    int v10856 = v10855 + 1;
+    int v10857 = v10856 + 1;
+    int v10858 = v10857 + 1;
+    int v10859 = v10858 + 1;
+    int v10860 = v10859 + 1;
+    int v10861 = v10860 + 1;
+    int v10862 = v10861 + 1;
+    int v10863 = v10862 + 1;
+    int v10864 = v10863 + 1;
+    int v10865 = v10864 + 1;
+    int v10866 = v10865 + 1;
+    int v10867 = v10866 + 1;
+    int v10868 = v10867 + 1;
+    int v10869 = v10868 + 1;
+    int v10870 = v10869 + 1;
+    int v10871 = v10870 + 1;
+    int v10872 = v10871 + 1;
+    int v10873 = v10872 + 1;
+    int v10874 = v10873 + 1;
+    int v10875 = v10874 + 1;
+    int v10876 = v10875 + 1;
+    int v10877 = v10876 + 1;
+    int v10878 = v10877 + 1;
+    int v10879 = v10878 + 1;
+    int v10880 = v10879 + 1;
+    int v10881 = v10880 + 1;
+    int v10882 = v10881 + 1;
+    int v10883 = v10882 + 1;
+    int v10884 = v10883 + 1;
+    int v10885 = v10884 + 1;
+    int v10886 = v10885 + 1;
+    int v10887 = v10886 + 1;
+    int v10888 = v10887 + 1;
+    int v10889 = v10888 + 1;
+    int v10890 = v10889 + 1;
+    int v10891 = v10890 + 1;
+    int v10892 = v10891 + 1;
+    int v10893 = v10892 + 1;
+    int v10894 = v10893 + 1;
+    int v10895 = v10894 + 1;
+    int v10896 = v10895 + 1;
+    int v10897 = v10896 + 1;
+    int v10898 = v10897 + 1;
+    int v10899 = v10898 + 1;
+    int v10900 = v10899 + 1;
+    int v10901 = v10900 + 1;
+    int v10902 = v10901 + 1;
+    int v10903 = v10902 + 1;
+    int v10904 = v10903 + 1;
+    int v10905 = v10904 + 1;
+    int v10906 = v10905 + 1;
+    int v10907 = v10906 + 1;
+    int v10908 = v10907 + 1;
+    int v10909 = v10908 + 1;
+    int v10910 = v10909 + 1;
+    int v10911 = v10910 + 1;
+    int v10912 = v10911 + 1;
+    int v10913 = v10912 + 1;
+    int v10914 = v10913 + 1;
+    int v10915 = v10914 + 1;
+    int v10916 = v10915 + 1;
+    int v10917 = v10916 + 1;
+    int v10918 = v10917 + 1;
+    int v10919 = v10918 + 1;
+    int v10920 = v10919 + 1;
+    int v10921 = v10920 + 1;
+    int v10922 = v10921 + 1;
+    int v10923 = v10922 + 1;
+    int v10924 = v10923 + 1;
+    int v10925 = v10924 + 1;
+    int v10926 = v10925 + 1;
+    int v10927 = v10926 + 1;
+    int v10928 = v10927 + 1;
+    int v10929 = v10928 + 1;
+    int v10930 = v10929 + 1;
+    int v10931 = v10930 + 1;
+    int v10932 = v10931 + 1;
+    int v10933 = v10932 + 1;
+    int v10934 = v10933 + 1;
+    int v10935 = v10934 + 1;
+    int v10936 = v10935 + 1;
+    int v10937 = v10936 + 1;
+    int v10938 = v10937 + 1;
+    int v10939 = v10938 + 1;
+    int v10940 = v10939 + 1;
+    int v10941 = v10940 + 1;
+    int v10942 = v10941 + 1;
+    int v10943 = v10942 + 1;
+    int v10944 = v10943 + 1;
+    int v10945 = v10944 + 1;
+    int v10946 = v10945 + 1;
+    int v10947 = v10946 + 1;
+    int v10948 = v10947 + 1;
+    int v10949 = v10948 + 1;
+    int v10950 = v10949 + 1;
+    int v10951 = v10950 + 1;
+    int v10952 = v10951 + 1;
+    int v10953 = v10952 + 1;
+    int v10954 = v10953 + 1;
+    int v10955 = v10954 + 1;
+    int v10956 = v10955 + 1;
+    int v10957 = v10956 + 1;
+    int v10958 = v10957 + 1;
+    int v10959 = v10958 + 1;
+    int v10960 = v10959 + 1;
+    int v10961 = v10960 + 1;
+    int v10962 = v10961 + 1;
+    int v10963 = v10962 + 1;
+    int v10964 = v10963 + 1;
+    int v10965 = v10964 + 1;
+    int v10966 = v10965 + 1;
+    int v10967 = v10966 + 1;
+    int v10968 = v10967 + 1;
+    int v10969 = v10968 + 1;
+    int v10970 = v10969 + 1;
+    int v10971 = v10970 + 1;
+    int v10972 = v10971 + 1;
+    int v10973 = v10972 + 1;
+    int v10974 = v10973 + 1;
+    int v10975 = v10974 + 1;
+    int v10976 = v10975 + 1;
+    int v10977 = v10976 + 1;
+    int v10978 = v10977 + 1;
+    int v10979 = v10978 + 1;
+    int v10980 = v10979 + 1;
+    int v10981 = v10980 + 1;
+    int v10982 = v10981 + 1;
+    int v10983 = v10982 + 1;
+    int v10984 = v10983 + 1;
+    int v10985 = v10984 + 1;
+    int v10986 = v10985 + 1;
+    int v10987 = v10986 + 1;
+    int v10988 = v10987 + 1;
+    int v10989 = v10988 + 1;
+    int v10990 = v10989 + 1;
+    int v10991 = v10990 + 1;
+    int v10992 = v10991 + 1;
+    int v10993 = v10992 + 1;
+    int v10994 = v10993 + 1;
+    int v10995 = v10994 + 1;
+    int v10996 = v10995 + 1;
+    int v10997 = v10996 + 1;
+    int v10998 = v10997 + 1;
+    int v10999 = v10998 + 1;
+    int v11000 = v10999 + 1;
+    int v11001 = v11000 + 1;
+    int v11002 = v11001 + 1;
+    int v11003 = v11002 + 1;
+    int v11004 = v11003 + 1;
+    int v11005 = v11004 + 1;
+    int v11006 = v11005 + 1;
+    int v11007 = v11006 + 1;
+    int v11008 = v11007 + 1;
+    int v11009 = v11008 + 1;
+    int v11010 = v11009 + 1;
+    int v11011 = v11010 + 1;
+    int v11012 = v11011 + 1;
+    int v11013 = v11012 + 1;
+    int v11014 = v11013 + 1;
+    int v11015 = v11014 + 1;
+    int v11016 = v11015 + 1;
+    int v11017 = v11016 + 1;
+    int v11018 = v11017 + 1;
+    int v11019 = v11018 + 1;
+    int v11020 = v11019 + 1;
+    int v11021 = v11020 + 1;
+    int v11022 = v11021 + 1;
+    int v11023 = v11022 + 1;
+    int v11024 = v11023 + 1;
+    int v11025 = v11024 + 1;
+    int v11026 = v11025 + 1;
+    int v11027 = v11026 + 1;
+    int v11028 = v11027 + 1;
+    int v11029 = v11028 + 1;
+    int v11030 = v11029 + 1;
+    int v11031 = v11030 + 1;
+    int v11032 = v11031 + 1;
+    int v11033 = v11032 + 1;
+    int v11034 = v11033 + 1;
+    int v11035 = v11034 + 1;
+    int v11036 = v11035 + 1;
+    int v11037 = v11036 + 1;
+    int v11038 = v11037 + 1;
+    int v11039 = v11038 + 1;
+    int v11040 = v11039 + 1;
+    int v11041 = v11040 + 1;
+    int v11042 = v11041 + 1;
+    int v11043 = v11042 + 1;
+    int v11044 = v11043 + 1;
+    int v11045 = v11044 + 1;
+    int v11046 = v11045 + 1;
+    int v11047 = v11046 + 1;
+    int v11048 = v11047 + 1;
+    int v11049 = v11048 + 1;
+    int v11050 = v11049 + 1;
+    int v11051 = v11050 + 1;
+    int v11052 = v11051 + 1;
+    int v11053 = v11052 + 1;
+    int v11054 = v11053 + 1;
+    int v11055 = v11054 + 1;
+    int v11056 = v11055 + 1;
+    int v11057 = v11056 + 1;
+    int v11058 = v11057 + 1;
+    int v11059 = v11058 + 1;
+    int v11060 = v11059 + 1;
+    int v11061 = v11060 + 1;
+    int v11062 = v11061 + 1;
+    int v11063 = v11062 + 1;
+    int v11064 = v11063 + 1;
+    int v11065 = v11064 + 1;
+    int v11066 = v11065 + 1;
+    int v11067 = v11066 + 1;
+    int v11068 = v11067 + 1;
+    int v11069 = v11068 + 1;
+    int v11070 = v11069 + 1;
+    int v11071 = v11070 + 1;
+    int v11072 = v11071 + 1;
+    int v11073 = v11072 + 1;
+    int v11074 = v11073 + 1;
+    int v11075 = v11074 + 1;
+    int v11076 = v11075 + 1;
+    int v11077 = v11076 + 1;
+    int v11078 = v11077 + 1;
+    int v11079 = v11078 + 1;
+    int v11080 = v11079 + 1;
+    int v11081 = v11080 + 1;
+    int v11082 = v11081 + 1;
+    int v11083 = v11082 + 1;
+    int v11084 = v11083 + 1;
+    int v11085 = v11084 + 1;
+    int v11086 = v11085 + 1;
+    int v11087 = v11086 + 1;
+    int v11088 = v11087 + 1;
+    int v11089 = v11088 + 1;
+    int v11090 = v11089 + 1;
+    int v11091 = v11090 + 1;
+    int v11092 = v11091 + 1;
+    int v11093 = v11092 + 1;
+    int v11094 = v11093 + 1;
+    int v11095 = v11094 + 1;
+    int v11096 = v11095 + 1;
+    int v11097 = v11096 + 1;
+    int v11098 = v11097 + 1;
+    int v11099 = v11098 + 1;
+    int v11100 = v11099 + 1;
+    int v11101 = v11100 + 1;
+    int v11102 = v11101 + 1;
+    int v11103 = v11102 + 1;
+    int v11104 = v11103 + 1;
+    int v11105 = v11104 + 1;
+    int v11106 = v11105 + 1;
+    int v11107 = v11106 + 1;
+    int v11108 = v11107 + 1;
+    int v11109 = v11108 + 1;
+    int v11110 = v11109 + 1;
+    int v11111 = v11110 + 1;
+    int v11112 = v11111 + 1;
+    int v11113 = v11112 + 1;
+    int v11114 = v11113 + 1;
+    int v11115 = v11114 + 1;
+    int v11116 = v11115 + 1;
+    int v11117 = v11116 + 1;
+    int v11118 = v11117 + 1;
+    int v11119 = v11118 + 1;
+    int v11120 = v11119 + 1;
+    int v11121 = v11120 + 1;
+    int v11122 = v11121 + 1;
+    int v11123 = v11122 + 1;
+    int v11124 = v11123 + 1;
+    int v11125 = v11124 + 1;
+    int v11126 = v11125 + 1;
+    int v11127 = v11126 + 1;
+    int v11128 = v11127 + 1;
+    int v11129 = v11128 + 1;
+    int v11130 = v11129 + 1;
+    int v11131 = v11130 + 1;
+    int v11132 = v11131 + 1;
+    int v11133 = v11132 + 1;
+    int v11134 = v11133 + 1;
+    int v11135 = v11134 + 1;
+    int v11136 = v11135 + 1;
+    int v11137 = v11136 + 1;
+    int v11138 = v11137 + 1;
+    int v11139 = v11138 + 1;
+    int v11140 = v11139 + 1;
+    int v11141 = v11140 + 1;
+    int v11142 = v11141 + 1;
+    int v11143 = v11142 + 1;
+    int v11144 = v11143 + 1;
+    int v11145 = v11144 + 1;
+    int v11146 = v11145 + 1;
+    int v11147 = v11146 + 1;
+    int v11148 = v11147 + 1;
+    int v11149 = v11148 + 1;
+    int v11150 = v11149 + 1;
+    int v11151 = v11150 + 1;
+    int v11152 = v11151 + 1;
+    int v11153 = v11152 + 1;
+    int v11154 = v11153 + 1;
+    int v11155 = v11154 + 1;
+    int v11156 = v11155 + 1;
+    int v11157 = v11156 + 1;
+    int v11158 = v11157 + 1;
+    int v11159 = v11158 + 1;
+    int v11160 = v11159 + 1;
+    int v11161 = v11160 + 1;
+    int v11162 = v11161 + 1;
+    int v11163 = v11162 + 1;
+    int v11164 = v11163 + 1;
+    int v11165 = v11164 + 1;
+    int v11166 = v11165 + 1;
+    int v11167 = v11166 + 1;
+    int v11168 = v11167 + 1;
+    int v11169 = v11168 + 1;
+    int v11170 = v11169 + 1;
+    int v11171 = v11170 + 1;
+    int v11172 = v11171 + 1;
+    int v11173 = v11172 + 1;
+    int v11174 = v11173 + 1;
+    int v11175 = v11174 + 1;
+    int v11176 = v11175 + 1;
+    int v11177 = v11176 + 1;
+    int v11178 = v11177 + 1;
+    int v11179 = v11178 + 1;
+    int v11180 = v11179 + 1;
+    int v11181 = v11180 + 1;
+    int v11182 = v11181 + 1;
+    int v11183 = v11182 + 1;
+    int v11184 = v11183 + 1;
+    int v11185 = v11184 + 1;
+    int v11186 = v11185 + 1;
+    int v11187 = v11186 + 1;
+    int v11188 = v11187 + 1;
+    int v11189 = v11188 + 1;
+    int v11190 = v11189 + 1;
+    int v11191 = v11190 + 1;
+    int v11192 = v11191 + 1;
+    int v11193 = v11192 + 1;
+    int v11194 = v11193 + 1;
+    int v11195 = v11194 + 1;
+    int v11196 = v11195 + 1;
+    int v11197 = v11196 + 1;
+    int v11198 = v11197 + 1;
+    int v11199 = v11198 + 1;
+    int v11200 = v11199 + 1;
+    int v11201 = v11200 + 1;
+    int v11202 = v11201 + 1;
+    int v11203 = v11202 + 1;
+    int v11204 = v11203 + 1;
+    int v11205 = v11204 + 1;
+    int v11206 = v11205 + 1;
+    int v11207 = v11206 + 1;
+    int v11208 = v11207 + 1;
+    int v11209 = v11208 + 1;
+    int v11210 = v11209 + 1;
+    int v11211 = v11210 + 1;
+    int v11212 = v11211 + 1;
+    int v11213 = v11212 + 1;
+    int v11214 = v11213 + 1;
+    int v11215 = v11214 + 1;
+    int v11216 = v11215 + 1;
+    int v11217 = v11216 + 1;
+    int v11218 = v11217 + 1;
+    int v11219 = v11218 + 1;
+    int v11220 = v11219 + 1;
+    int v11221 = v11220 + 1;
+    int v11222 = v11221 + 1;
+    int v11223 = v11222 + 1;
+    int v11224 = v11223 + 1;
+    int v11225 = v11224 + 1;
+    int v11226 = v11225 + 1;
+    int v11227 = v11226 + 1;
+    int v11228 = v11227 + 1;
+    int v11229 = v11228 + 1;
+    int v11230 = v11229 + 1;
+    int v11231 = v11230 + 1;
+    int v11232 = v11231 + 1;
+    int v11233 = v11232 + 1;
+    int v11234 = v11233 + 1;
+    int v11235 = v11234 + 1;
+    int v11236 = v11235 + 1;
+    int v11237 = v11236 + 1;
+    int v11238 = v11237 + 1;
+    int v11239 = v11238 + 1;
+    int v11240 = v11239 + 1;
+    int v11241 = v11240 + 1;
+    int v11242 = v11241 + 1;
+    int v11243 = v11242 + 1;
+    int v11244 = v11243 + 1;
+    int v11245 = v11244 + 1;
+    int v11246 = v11245 + 1;
+    int v11247 = v11246 + 1;
+    int v11248 = v11247 + 1;
+    int v11249 = v11248 + 1;
+    int v11250 = v11249 + 1;
+    int v11251 = v11250 + 1;
+    int v11252 = v11251 + 1;
+    int v11253 = v11252 + 1;
+    int v11254 = v11253 + 1;
+    int v11255 = v11254 + 1;
+    int v11256 = v11255 + 1;
+    int v11257 = v11256 + 1;
+    int v11258 = v11257 + 1;
+    int v11259 = v11258 + 1;
+    int v11260 = v11259 + 1;
+    int v11261 = v11260 + 1;
+    int v11262 = v11261 + 1;
+    int v11263 = v11262 + 1;
+    int v11264 = v11263 + 1;
+    int v11265 = v11264 + 1;
+    int v11266 = v11265 + 1;
+    int v11267 = v11266 + 1;
+    int v11268 = v11267 + 1;
+    int v11269 = v11268 + 1;
+    int v11270 = v11269 + 1;
+    int v11271 = v11270 + 1;
+    int v11272 = v11271 + 1;
+    int v11273 = v11272 + 1;
+    int v11274 = v11273 + 1;
+    int v11275 = v11274 + 1;
+    int v11276 = v11275 + 1;
+    int v11277 = v11276 + 1;
+    int v11278 = v11277 + 1;
+    int v11279 = v11278 + 1;
+    int v11280 = v11279 + 1;
+    int v11281 = v11280 + 1;
+    int v11282 = v11281 + 1;
+    int v11283 = v11282 + 1;
+    int v11284 = v11283 + 1;
+    int v11285 = v11284 + 1;
+    int v11286 = v11285 + 1;
+    int v11287 = v11286 + 1;
+    int v11288 = v11287 + 1;
+    int v11289 = v11288 + 1;
+    int v11290 = v11289 + 1;
+    int v11291 = v11290 + 1;
+    int v11292 = v11291 + 1;
+    int v11293 = v11292 + 1;
+    int v11294 = v11293 + 1;
+    int v11295 = v11294 + 1;
+    int v11296 = v11295 + 1;
+    int v11297 = v11296 + 1;
+    int v11298 = v11297 + 1;
+    int v11299 = v11298 + 1;
+    int v11300 = v11299 + 1;
+    int v11301 = v11300 + 1;
+    int v11302 = v11301 + 1;
+    int v11303 = v11302 + 1;
+    int v11304 = v11303 + 1;
+    int v11305 = v11304 + 1;
+    int v11306 = v11305 + 1;
+    int v11307 = v11306 + 1;
+    int v11308 = v11307 + 1;
+    int v11309 = v11308 + 1;
+    int v11310 = v11309 + 1;
+    int v11311 = v11310 + 1;
+    int v11312 = v11311 + 1;
+    int v11313 = v11312 + 1;
+    int v11314 = v11313 + 1;
+    int v11315 = v11314 + 1;
+    int v11316 = v11315 + 1;
+    int v11317 = v11316 + 1;
+    int v11318 = v11317 + 1;
+    int v11319 = v11318 + 1;
+    int v11320 = v11319 + 1;
+    int v11321 = v11320 + 1;
+    int v11322 = v11321 + 1;
+    int v11323 = v11322 + 1;
+    int v11324 = v11323 + 1;
+    int v11325 = v11324 + 1;
+    int v11326 = v11325 + 1;
+    int v11327 = v11326 + 1;
+    int v11328 = v11327 + 1;
+    int v11329 = v11328 + 1;
+    int v11330 = v11329 + 1;
+    int v11331 = v11330 + 1;
+    int v11332 = v11331 + 1;
+    int v11333 = v11332 + 1;
+    int v11334 = v11333 + 1;
+    int v11335 = v11334 + 1;
+    int v11336 = v11335 + 1;
+    int v11337 = v11336 + 1;
+    int v11338 = v11337 + 1;
+    int v11339 = v11338 + 1;
+    int v11340 = v11339 + 1;
+    int v11341 = v11340 + 1;
+    int v11342 = v11341 + 1;
+    int v11343 = v11342 + 1;
+    int v11344 = v11343 + 1;
+    int v11345 = v11344 + 1;
+    int v11346 = v11345 + 1;
+    int v11347 = v11346 + 1;
+    int v11348 = v11347 + 1;
+    int v11349 = v11348 + 1;
+    int v11350 = v11349 + 1;
+    int v11351 = v11350 + 1;
+    int v11352 = v11351 + 1;
+    int v11353 = v11352 + 1;
+    int v11354 = v11353 + 1;
+    int v11355 = v11354 + 1;
+    int v11356 = v11355 + 1;
+    int v11357 = v11356 + 1;
+    int v11358 = v11357 + 1;
+    int v11359 = v11358 + 1;
+    int v11360 = v11359 + 1;
+    int v11361 = v11360 + 1;
+    int v11362 = v11361 + 1;
+    int v11363 = v11362 + 1;
+    int v11364 = v11363 + 1;
+    int v11365 = v11364 + 1;
+    int v11366 = v11365 + 1;
+    int v11367 = v11366 + 1;
+    int v11368 = v11367 + 1;
+    int v11369 = v11368 + 1;
+    int v11370 = v11369 + 1;
+    int v11371 = v11370 + 1;
+    int v11372 = v11371 + 1;
+    int v11373 = v11372 + 1;
+    int v11374 = v11373 + 1;
+    int v11375 = v11374 + 1;
+    int v11376 = v11375 + 1;
+    int v11377 = v11376 + 1;
+    int v11378 = v11377 + 1;
+    int v11379 = v11378 + 1;
+    int v11380 = v11379 + 1;
+    int v11381 = v11380 + 1;
+    int v11382 = v11381 + 1;
+    int v11383 = v11382 + 1;
+    int v11384 = v11383 + 1;
+    int v11385 = v11384 + 1;
+    int v11386 = v11385 + 1;
+    int v11387 = v11386 + 1;
+    int v11388 = v11387 + 1;
+    int v11389 = v11388 + 1;
+    int v11390 = v11389 + 1;
+    int v11391 = v11390 + 1;
+    int v11392 = v11391 + 1;
+    int v11393 = v11392 + 1;
+    int v11394 = v11393 + 1;
+    int v11395 = v11394 + 1;
+    int v11396 = v11395 + 1;
+    int v11397 = v11396 + 1;
+    int v11398 = v11397 + 1;
+    int v11399 = v11398 + 1;
+    int v11400 = v11399 + 1;
+    int v11401 = v11400 + 1;
+    int v11402 = v11401 + 1;
+    int v11403 = v11402 + 1;
+    int v11404 = v11403 + 1;
+    int v11405 = v11404 + 1;
+    int v11406 = v11405 + 1;
+    int v11407 = v11406 + 1;
+    int v11408 = v11407 + 1;
+    int v11409 = v11408 + 1;
+    int v11410 = v11409 + 1;
+    int v11411 = v11410 + 1;
+    int v11412 = v11411 + 1;
+    int v11413 = v11412 + 1;
+    int v11414 = v11413 + 1;
+    int v11415 = v11414 + 1;
+    int v11416 = v11415 + 1;
+    int v11417 = v11416 + 1;
+    int v11418 = v11417 + 1;
+    int v11419 = v11418 + 1;
+    int v11420 = v11419 + 1;
+    int v11421 = v11420 + 1;
+    int v11422 = v11421 + 1;
+    int v11423 = v11422 + 1;
+    int v11424 = v11423 + 1;
+    int v11425 = v11424 + 1;
+    int v11426 = v11425 + 1;
+    int v11427 = v11426 + 1;
+    int v11428 = v11427 + 1;
+    int v11429 = v11428 + 1;
+    int v11430 = v11429 + 1;
+    int v11431 = v11430 + 1;
+    int v11432 = v11431 + 1;
+    int v11433 = v11432 + 1;
+    int v11434 = v11433 + 1;
+    int v11435 = v11434 + 1;
+    int v11436 = v11435 + 1;
+    int v11437 = v11436 + 1;
+    int v11438 = v11437 + 1;
+    int v11439 = v11438 + 1;
+    int v11440 = v11439 + 1;
+    int v11441 = v11440 + 1;
+    int v11442 = v11441 + 1;
+    int v11443 = v11442 + 1;
+    int v11444 = v11443 + 1;
+    int v11445 = v11444 + 1;
+    int v11446 = v11445 + 1;
+    int v11447 = v11446 + 1;
+    int v11448 = v11447 + 1;
+    int v11449 = v11448 + 1;
+    int v11450 = v11449 + 1;
+    int v11451 = v11450 + 1;
+    int v11452 = v11451 + 1;
+    int v11453 = v11452 + 1;
+    int v11454 = v11453 + 1;
+    int v11455 = v11454 + 1;
+    int v11456 = v11455 + 1;
+    int v11457 = v11456 + 1;
+    int v11458 = v11457 + 1;
+    int v11459 = v11458 + 1;
+    int v11460 = v11459 + 1;
+    int v11461 = v11460 + 1;
+    int v11462 = v11461 + 1;
+    int v11463 = v11462 + 1;
+    int v11464 = v11463 + 1;
+    int v11465 = v11464 + 1;
+    int v11466 = v11465 + 1;
+    int v11467 = v11466 + 1;
+    int v11468 = v11467 + 1;
+    int v11469 = v11468 + 1;
+    int v11470 = v11469 + 1;
+    int v11471 = v11470 + 1;
+    int v11472 = v11471 + 1;
+    int v11473 = v11472 + 1;
+    int v11474 = v11473 + 1;
+    int v11475 = v11474 + 1;
+    int v11476 = v11475 + 1;
+    int v11477 = v11476 + 1;
+    int v11478 = v11477 + 1;
+    int v11479 = v11478 + 1;
+    int v11480 = v11479 + 1;
+    int v11481 = v11480 + 1;
+    int v11482 = v11481 + 1;
+    int v11483 = v11482 + 1;
+    int v11484 = v11483 + 1;
+    int v11485 = v11484 + 1;
+    int v11486 = v11485 + 1;
+    int v11487 = v11486 + 1;
+    int v11488 = v11487 + 1;
+    int v11489 = v11488 + 1;
+    int v11490 = v11489 + 1;
+    int v11491 = v11490 + 1;
+    int v11492 = v11491 + 1;
+    int v11493 = v11492 + 1;
+    int v11494 = v11493 + 1;
+    int v11495 = v11494 + 1;
+    int v11496 = v11495 + 1;
+    int v11497 = v11496 + 1;
+    int v11498 = v11497 + 1;
+    int v11499 = v11498 + 1;
+    int v11500 = v11499 + 1;
+    int v11501 = v11500 + 1;
+    int v11502 = v11501 + 1;
+    int v11503 = v11502 + 1;
+    int v11504 = v11503 + 1;
+    int v11505 = v11504 + 1;
+    int v11506 = v11505 + 1;
+    int v11507 = v11506 + 1;
+    int v11508 = v11507 + 1;
+    int v11509 = v11508 + 1;
+    int v11510 = v11509 + 1;
+    int v11511 = v11510 + 1;
+    int v11512 = v11511 + 1;
+    int v11513 = v11512 + 1;
+    int v11514 = v11513 + 1;
+    int v11515 = v11514 + 1;
+    int v11516 = v11515 + 1;
+    int v11517 = v11516 + 1;
+    int v11518 = v11517 + 1;
+    int v11519 = v11518 + 1;
+    int v11520 = v11519 + 1;
+    int v11521 = v11520 + 1;
+    int v11522 = v11521 + 1;
+    int v11523 = v11522 + 1;
+    int v11524 = v11523 + 1;
+    int v11525 = v11524 + 1;
+    int v11526 = v11525 + 1;
+    int v11527 = v11526 + 1;
+    int v11528 = v11527 + 1;
+    int v11529 = v11528 + 1;
+    int v11530 = v11529 + 1;
+    int v11531 = v11530 + 1;
+    int v11532 = v11531 + 1;
+    int v11533 = v11532 + 1;
+    int v11534 = v11533 + 1;
+    int v11535 = v11534 + 1;
+    int v11536 = v11535 + 1;
+    int v11537 = v11536 + 1;
+    int v11538 = v11537 + 1;
+    int v11539 = v11538 + 1;
+    int v11540 = v11539 + 1;
+    int v11541 = v11540 + 1;
+    int v11542 = v11541 + 1;
+    int v11543 = v11542 + 1;
+    int v11544 = v11543 + 1;
+    int v11545 = v11544 + 1;
+    int v11546 = v11545 + 1;
+    int v11547 = v11546 + 1;
+    int v11548 = v11547 + 1;
+    int v11549 = v11548 + 1;
+    int v11550 = v11549 + 1;
+    int v11551 = v11550 + 1;
+    int v11552 = v11551 + 1;
+    int v11553 = v11552 + 1;
+    int v11554 = v11553 + 1;
+    int v11555 = v11554 + 1;
+    int v11556 = v11555 + 1;
+    int v11557 = v11556 + 1;
+    int v11558 = v11557 + 1;
+    int v11559 = v11558 + 1;
+    int v11560 = v11559 + 1;
+    int v11561 = v11560 + 1;
+    int v11562 = v11561 + 1;
+    int v11563 = v11562 + 1;
+    int v11564 = v11563 + 1;
+    int v11565 = v11564 + 1;
+    int v11566 = v11565 + 1;
+    int v11567 = v11566 + 1;
+    int v11568 = v11567 + 1;
+    int v11569 = v11568 + 1;
+    int v11570 = v11569 + 1;
+    int v11571 = v11570 + 1;
+    int v11572 = v11571 + 1;
+    int v11573 = v11572 + 1;
+    int v11574 = v11573 + 1;
+    int v11575 = v11574 + 1;
+    int v11576 = v11575 + 1;
+    int v11577 = v11576 + 1;
+    int v11578 = v11577 + 1;
+    int v11579 = v11578 + 1;
+    int v11580 = v11579 + 1;
+    int v11581 = v11580 + 1;
+    int v11582 = v11581 + 1;
+    int v11583 = v11582 + 1;
+    int v11584 = v11583 + 1;
+    int v11585 = v11584 + 1;
+    int v11586 = v11585 + 1;
+    int v11587 = v11586 + 1;
+    int v11588 = v11587 + 1;
+    int v11589 = v11588 + 1;
+    int v11590 = v11589 + 1;
+    int v11591 = v11590 + 1;
+    int v11592 = v11591 + 1;
+    int v11593 = v11592 + 1;
+    int v11594 = v11593 + 1;
+    int v11595 = v11594 + 1;
+    int v11596 = v11595 + 1;
+    int v11597 = v11596 + 1;
+    int v11598 = v11597 + 1;
+    int v11599 = v11598 + 1;
+    int v11600 = v11599 + 1;
+    int v11601 = v11600 + 1;
+    int v11602 = v11601 + 1;
+    int v11603 = v11602 + 1;
+    int v11604 = v11603 + 1;
+    int v11605 = v11604 + 1;
+    int v11606 = v11605 + 1;
+    int v11607 = v11606 + 1;
+    int v11608 = v11607 + 1;
+    int v11609 = v11608 + 1;
+    int v11610 = v11609 + 1;
+    int v11611 = v11610 + 1;
+    int v11612 = v11611 + 1;
+    int v11613 = v11612 + 1;
+    int v11614 = v11613 + 1;
+    int v11615 = v11614 + 1;
+    int v11616 = v11615 + 1;
+    int v11617 = v11616 + 1;
+    int v11618 = v11617 + 1;
+    int v11619 = v11618 + 1;
+    int v11620 = v11619 + 1;
+    int v11621 = v11620 + 1;
+    int v11622 = v11621 + 1;
+    int v11623 = v11622 + 1;
+    int v11624 = v11623 + 1;
+    int v11625 = v11624 + 1;
+    int v11626 = v11625 + 1;
+    int v11627 = v11626 + 1;
+    int v11628 = v11627 + 1;
+    int v11629 = v11628 + 1;
+    int v11630 = v11629 + 1;
+    int v11631 = v11630 + 1;
+    int v11632 = v11631 + 1;
+    int v11633 = v11632 + 1;
+    int v11634 = v11633 + 1;
+    int v11635 = v11634 + 1;
+    int v11636 = v11635 + 1;
+    int v11637 = v11636 + 1;
+    int v11638 = v11637 + 1;
+    int v11639 = v11638 + 1;
+    int v11640 = v11639 + 1;
+    int v11641 = v11640 + 1;
+    int v11642 = v11641 + 1;
+    int v11643 = v11642 + 1;
+    int v11644 = v11643 + 1;
+    int v11645 = v11644 + 1;
+    int v11646 = v11645 + 1;
+    int v11647 = v11646 + 1;
+    int v11648 = v11647 + 1;
+    int v11649 = v11648 + 1;
+    int v11650 = v11649 + 1;
+    int v11651 = v11650 + 1;
+    int v11652 = v11651 + 1;
+    int v11653 = v11652 + 1;
+    int v11654 = v11653 + 1;
+    int v11655 = v11654 + 1;
+    int v11656 = v11655 + 1;
+    int v11657 = v11656 + 1;
+    int v11658 = v11657 + 1;
+    int v11659 = v11658 + 1;
+    int v11660 = v11659 + 1;
+    int v11661 = v11660 + 1;
+    int v11662 = v11661 + 1;
+    int v11663 = v11662 + 1;
+    int v11664 = v11663 + 1;
+    int v11665 = v11664 + 1;
+    int v11666 = v11665 + 1;
+    int v11667 = v11666 + 1;
+    int v11668 = v11667 + 1;
+    int v11669 = v11668 + 1;
+    int v11670 = v11669 + 1;
+    int v11671 = v11670 + 1;
+    int v11672 = v11671 + 1;
+    int v11673 = v11672 + 1;
+    int v11674 = v11673 + 1;
+    int v11675 = v11674 + 1;
+    int v11676 = v11675 + 1;
+    int v11677 = v11676 + 1;
+    int v11678 = v11677 + 1;
+    int v11679 = v11678 + 1;
+    int v11680 = v11679 + 1;
+    int v11681 = v11680 + 1;
+    int v11682 = v11681 + 1;
+    int v11683 = v11682 + 1;
+    int v11684 = v11683 + 1;
+    int v11685 = v11684 + 1;
+    int v11686 = v11685 + 1;
+    int v11687 = v11686 + 1;
+    int v11688 = v11687 + 1;
+    int v11689 = v11688 + 1;
+    int v11690 = v11689 + 1;
+    int v11691 = v11690 + 1;
+    int v11692 = v11691 + 1;
+    int v11693 = v11692 + 1;
+    int v11694 = v11693 + 1;
+    int v11695 = v11694 + 1;
+    int v11696 = v11695 + 1;
+    int v11697 = v11696 + 1;
+    int v11698 = v11697 + 1;
+    int v11699 = v11698 + 1;
+    int v11700 = v11699 + 1;
+    int v11701 = v11700 + 1;
+    int v11702 = v11701 + 1;
+    int v11703 = v11702 + 1;
+    int v11704 = v11703 + 1;
+    int v11705 = v11704 + 1;
+    int v11706 = v11705 + 1;
+    int v11707 = v11706 + 1;
+    int v11708 = v11707 + 1;
+    int v11709 = v11708 + 1;
+    int v11710 = v11709 + 1;
+    int v11711 = v11710 + 1;
+    int v11712 = v11711 + 1;
+    int v11713 = v11712 + 1;
+    int v11714 = v11713 + 1;
+    int v11715 = v11714 + 1;
+    int v11716 = v11715 + 1;
+    int v11717 = v11716 + 1;
+    int v11718 = v11717 + 1;
+    int v11719 = v11718 + 1;
+    int v11720 = v11719 + 1;
+    int v11721 = v11720 + 1;
+    int v11722 = v11721 + 1;
+    int v11723 = v11722 + 1;
+    int v11724 = v11723 + 1;
+    int v11725 = v11724 + 1;
+    int v11726 = v11725 + 1;
+    int v11727 = v11726 + 1;
+    int v11728 = v11727 + 1;
+    int v11729 = v11728 + 1;
+    int v11730 = v11729 + 1;
+    int v11731 = v11730 + 1;
+    int v11732 = v11731 + 1;
+    int v11733 = v11732 + 1;
+    int v11734 = v11733 + 1;
+    int v11735 = v11734 + 1;
+    int v11736 = v11735 + 1;
+    int v11737 = v11736 + 1;
+    int v11738 = v11737 + 1;
+    int v11739 = v11738 + 1;
+    int v11740 = v11739 + 1;
+    int v11741 = v11740 + 1;
+    int v11742 = v11741 + 1;
+    int v11743 = v11742 + 1;
+    int v11744 = v11743 + 1;
+    int v11745 = v11744 + 1;
+    int v11746 = v11745 + 1;
+    int v11747 = v11746 + 1;
+    int v11748 = v11747 + 1;
+    int v11749 = v11748 + 1;
+    int v11750 = v11749 + 1;
+    int v11751 = v11750 + 1;
+    int v11752 = v11751 + 1;
+    int v11753 = v11752 + 1;
+    int v11754 = v11753 + 1;
+    int v11755 = v11754 + 1;
+    int v11756 = v11755 + 1;
+    int v11757 = v11756 + 1;
+    int v11758 = v11757 + 1;
+    int v11759 = v11758 + 1;
+    int v11760 = v11759 + 1;
+    int v11761 = v11760 + 1;
+    int v11762 = v11761 + 1;
+    int v11763 = v11762 + 1;
+    int v11764 = v11763 + 1;
+    int v11765 = v11764 + 1;
+    int v11766 = v11765 + 1;
+    int v11767 = v11766 + 1;
+    int v11768 = v11767 + 1;
+    int v11769 = v11768 + 1;
+    int v11770 = v11769 + 1;
+    int v11771 = v11770 + 1;
+    int v11772 = v11771 + 1;
+    int v11773 = v11772 + 1;
+    int v11774 = v11773 + 1;
+    int v11775 = v11774 + 1;
+    int v11776 = v11775 + 1;
+    int v11777 = v11776 + 1;
+    int v11778 = v11777 + 1;
+    int v11779 = v11778 + 1;
+    int v11780 = v11779 + 1;
+    int v11781 = v11780 + 1;
+    int v11782 = v11781 + 1;
+    int v11783 = v11782 + 1;
+    int v11784 = v11783 + 1;
+    int v11785 = v11784 + 1;
+    int v11786 = v11785 + 1;
+    int v11787 = v11786 + 1;
+    int v11788 = v11787 + 1;
+    int v11789 = v11788 + 1;
+    int v11790 = v11789 + 1;
+    int v11791 = v11790 + 1;
+    int v11792 = v11791 + 1;
+    int v11793 = v11792 + 1;
+    int v11794 = v11793 + 1;
+    int v11795 = v11794 + 1;
+    int v11796 = v11795 + 1;
+    int v11797 = v11796 + 1;
+    int v11798 = v11797 + 1;
+    int v11799 = v11798 + 1;
+    int v11800 = v11799 + 1;
+    int v11801 = v11800 + 1;
+    int v11802 = v11801 + 1;
+    int v11803 = v11802 + 1;
+    int v11804 = v11803 + 1;
+    int v11805 = v11804 + 1;
+    int v11806 = v11805 + 1;
+    int v11807 = v11806 + 1;
+    int v11808 = v11807 + 1;
+    int v11809 = v11808 + 1;
+    int v11810 = v11809 + 1;
+    int v11811 = v11810 + 1;
+    int v11812 = v11811 + 1;
+    int v11813 = v11812 + 1;
+    int v11814 = v11813 + 1;
+    int v11815 = v11814 + 1;
+    int v11816 = v11815 + 1;
+    int v11817 = v11816 + 1;
+    int v11818 = v11817 + 1;
+    int v11819 = v11818 + 1;
+    int v11820 = v11819 + 1;
+    int v11821 = v11820 + 1;
+    int v11822 = v11821 + 1;
+    int v11823 = v11822 + 1;
+    int v11824 = v11823 + 1;
+    int v11825 = v11824 + 1;
+    int v11826 = v11825 + 1;
+    int v11827 = v11826 + 1;
+    int v11828 = v11827 + 1;
+    int v11829 = v11828 + 1;
+    int v11830 = v11829 + 1;
+    int v11831 = v11830 + 1;
+    int v11832 = v11831 + 1;
+    int v11833 = v11832 + 1;
+    int v11834 = v11833 + 1;
+    int v11835 = v11834 + 1;
+    int v11836 = v11835 + 1;
+    int v11837 = v11836 + 1;
+    int v11838 = v11837 + 1;
+    int v11839 = v11838 + 1;
+    int v11840 = v11839 + 1;
+    int v11841 = v11840 + 1;
+    int v11842 = v11841 + 1;
+    int v11843 = v11842 + 1;
+    int v11844 = v11843 + 1;
+    int v11845 = v11844 + 1;
+    int v11846 = v11845 + 1;
+    int v11847 = v11846 + 1;
+    int v11848 = v11847 + 1;
+    int v11849 = v11848 + 1;
+    int v11850 = v11849 + 1;
+    int v11851 = v11850 + 1;
+    int v11852 = v11851 + 1;
+    int v11853 = v11852 + 1;
+    int v11854 = v11853 + 1;
+    int v11855 = v11854 + 1;
+    int v11856 = v11855 + 1;
+    int v11857 = v11856 + 1;
+    int v11858 = v11857 + 1;
+    int v11859 = v11858 + 1;
+    int v11860 = v11859 + 1;
+    int v11861 = v11860 + 1;
+    int v11862 = v11861 + 1;
+    int v11863 = v11862 + 1;
+    int v11864 = v11863 + 1;
+    int v11865 = v11864 + 1;
+    int v11866 = v11865 + 1;
+    int v11867 = v11866 + 1;
+    int v11868 = v11867 + 1;
+    int v11869 = v11868 + 1;
+    int v11870 = v11869 + 1;
+    int v11871 = v11870 + 1;
+    int v11872 = v11871 + 1;
+    int v11873 = v11872 + 1;
+    int v11874 = v11873 + 1;
+    int v11875 = v11874 + 1;
+    int v11876 = v11875 + 1;
+    int v11877 = v11876 + 1;
+    int v11878 = v11877 + 1;
+    int v11879 = v11878 + 1;
+    int v11880 = v11879 + 1;
+    int v11881 = v11880 + 1;
+    int v11882 = v11881 + 1;
+    int v11883 = v11882 + 1;
+    int v11884 = v11883 + 1;
+    int v11885 = v11884 + 1;
+    int v11886 = v11885 + 1;
+    int v11887 = v11886 + 1;
+    int v11888 = v11887 + 1;
+    int v11889 = v11888 + 1;
+    int v11890 = v11889 + 1;
+    int v11891 = v11890 + 1;
+    int v11892 = v11891 + 1;
+    int v11893 = v11892 + 1;
+    int v11894 = v11893 + 1;
+    int v11895 = v11894 + 1;
+    int v11896 = v11895 + 1;
+    int v11897 = v11896 + 1;
+    int v11898 = v11897 + 1;
+    int v11899 = v11898 + 1;
+    int v11900 = v11899 + 1;
+    int v11901 = v11900 + 1;
+    int v11902 = v11901 + 1;
+    int v11903 = v11902 + 1;
+    int v11904 = v11903 + 1;
+    int v11905 = v11904 + 1;
+    int v11906 = v11905 + 1;
+    int v11907 = v11906 + 1;
+    int v11908 = v11907 + 1;
+    int v11909 = v11908 + 1;
+    int v11910 = v11909 + 1;
+    int v11911 = v11910 + 1;
+    int v11912 = v11911 + 1;
+    int v11913 = v11912 + 1;
+    int v11914 = v11913 + 1;
+    int v11915 = v11914 + 1;
+    int v11916 = v11915 + 1;
+    int v11917 = v11916 + 1;
+    int v11918 = v11917 + 1;
+    int v11919 = v11918 + 1;
+    int v11920 = v11919 + 1;
+    int v11921 = v11920 + 1;
+    int v11922 = v11921 + 1;
+    int v11923 = v11922 + 1;
+    int v11924 = v11923 + 1;
+    int v11925 = v11924 + 1;
+    int v11926 = v11925 + 1;
+    int v11927 = v11926 + 1;
+    int v11928 = v11927 + 1;
+    int v11929 = v11928 + 1;
+    int v11930 = v11929 + 1;
+    int v11931 = v11930 + 1;
+    int v11932 = v11931 + 1;
+    int v11933 = v11932 + 1;
+    int v11934 = v11933 + 1;
+    int v11935 = v11934 + 1;
+    int v11936 = v11935 + 1;
+    int v11937 = v11936 + 1;
+    int v11938 = v11937 + 1;
+    int v11939 = v11938 + 1;
+    int v11940 = v11939 + 1;
+    int v11941 = v11940 + 1;
+    int v11942 = v11941 + 1;
+    int v11943 = v11942 + 1;
+    int v11944 = v11943 + 1;
+    int v11945 = v11944 + 1;
+    int v11946 = v11945 + 1;
+    int v11947 = v11946 + 1;
+    int v11948 = v11947 + 1;
+    int v11949 = v11948 + 1;
+    int v11950 = v11949 + 1;
+    int v11951 = v11950 + 1;
+    int v11952 = v11951 + 1;
+    int v11953 = v11952 + 1;
+    int v11954 = v11953 + 1;
+    int v11955 = v11954 + 1;
+    int v11956 = v11955 + 1;
+    int v11957 = v11956 + 1;
+    int v11958 = v11957 + 1;
+    int v11959 = v11958 + 1;
+    int v11960 = v11959 + 1;
+    int v11961 = v11960 + 1;
+    int v11962 = v11961 + 1;
+    int v11963 = v11962 + 1;
+    int v11964 = v11963 + 1;
+    int v11965 = v11964 + 1;
+    int v11966 = v11965 + 1;
+    int v11967 = v11966 + 1;
+    int v11968 = v11967 + 1;
+    int v11969 = v11968 + 1;
+    int v11970 = v11969 + 1;
+    int v11971 = v11970 + 1;
+    int v11972 = v11971 + 1;
+    int v11973 = v11972 + 1;
+    int v11974 = v11973 + 1;
+    int v11975 = v11974 + 1;
+    int v11976 = v11975 + 1;
+    int v11977 = v11976 + 1;
+    int v11978 = v11977 + 1;
+    int v11979 = v11978 + 1;
+    int v11980 = v11979 + 1;
+    int v11981 = v11980 + 1;
+    int v11982 = v11981 + 1;
+    int v11983 = v11982 + 1;
+    int v11984 = v11983 + 1;
+    int v11985 = v11984 + 1;
+    int v11986 = v11985 + 1;
+    int v11987 = v11986 + 1;
+    int v11988 = v11987 + 1;
+    int v11989 = v11988 + 1;
+    int v11990 = v11989 + 1;
+    int v11991 = v11990 + 1;
+    int v11992 = v11991 + 1;
+    int v11993 = v11992 + 1;
+    int v11994 = v11993 + 1;
+    int v11995 = v11994 + 1;
+    int v11996 = v11995 + 1;
+    int v11997 = v11996 + 1;
+    int v11998 = v11997 + 1;
+    int v11999 = v11998 + 1;
+    int v12000 = v11999 + 1;
+    int v12001 = v12000 + 1;
+    int v12002 = v12001 + 1;
+    int v12003 = v12002 + 1;
+    int v12004 = v12003 + 1;
+    int v12005 = v12004 + 1;
+    int v12006 = v12005 + 1;
+    int v12007 = v12006 + 1;
+    int v12008 = v12007 + 1;
+    int v12009 = v12008 + 1;
+    int v12010 = v12009 + 1;
+    int v12011 = v12010 + 1;
+    int v12012 = v12011 + 1;
+    int v12013 = v12012 + 1;
+    int v12014 = v12013 + 1;
+    int v12015 = v12014 + 1;
+    int v12016 = v12015 + 1;
+    int v12017 = v12016 + 1;
+    int v12018 = v12017 + 1;
+    int v12019 = v12018 + 1;
+    int v12020 = v12019 + 1;
+    int v12021 = v12020 + 1;
+    int v12022 = v12021 + 1;
+    int v12023 = v12022 + 1;
+    int v12024 = v12023 + 1;
+    int v12025 = v12024 + 1;
+    int v12026 = v12025 + 1;
+    int v12027 = v12026 + 1;
+    int v12028 = v12027 + 1;
+    int v12029 = v12028 + 1;
+    int v12030 = v12029 + 1;
+    int v12031 = v12030 + 1;
+    int v12032 = v12031 + 1;
+    int v12033 = v12032 + 1;
+    int v12034 = v12033 + 1;
+    int v12035 = v12034 + 1;
+    int v12036 = v12035 + 1;
+    int v12037 = v12036 + 1;
+    int v12038 = v12037 + 1;
+    int v12039 = v12038 + 1;
+    int v12040 = v12039 + 1;
+    int v12041 = v12040 + 1;
+    int v12042 = v12041 + 1;
+    int v12043 = v12042 + 1;
+    int v12044 = v12043 + 1;
+    int v12045 = v12044 + 1;
+    int v12046 = v12045 + 1;
+    int v12047 = v12046 + 1;
+    int v12048 = v12047 + 1;
+    int v12049 = v12048 + 1;
+    int v12050 = v12049 + 1;
+    int v12051 = v12050 + 1;
+    int v12052 = v12051 + 1;
+    int v12053 = v12052 + 1;
+    int v12054 = v12053 + 1;
+    int v12055 = v12054 + 1;
+    int v12056 = v12055 + 1;
+    int v12057 = v12056 + 1;
+    int v12058 = v12057 + 1;
+    int v12059 = v12058 + 1;
+    int v12060 = v12059 + 1;
+    int v12061 = v12060 + 1;
+    int v12062 = v12061 + 1;
+    int v12063 = v12062 + 1;
+    int v12064 = v12063 + 1;
+    int v12065 = v12064 + 1;
+    int v12066 = v12065 + 1;
+    int v12067 = v12066 + 1;
+    int v12068 = v12067 + 1;
+    int v12069 = v12068 + 1;
+    int v12070 = v12069 + 1;
+    int v12071 = v12070 + 1;
+    int v12072 = v12071 + 1;
+    int v12073 = v12072 + 1;
+    int v12074 = v12073 + 1;
+    int v12075 = v12074 + 1;
+    int v12076 = v12075 + 1;
+    int v12077 = v12076 + 1;
+    int v12078 = v12077 + 1;
+    int v12079 = v12078 + 1;
+    int v12080 = v12079 + 1;
+    int v12081 = v12080 + 1;
+    int v12082 = v12081 + 1;
+    int v12083 = v12082 + 1;
+    int v12084 = v12083 + 1;
+    int v12085 = v12084 + 1;
+    int v12086 = v12085 + 1;
+    int v12087 = v12086 + 1;
+    int v12088 = v12087 + 1;
+    int v12089 = v12088 + 1;
+    int v12090 = v12089 + 1;
+    int v12091 = v12090 + 1;
+    int v12092 = v12091 + 1;
+    int v12093 = v12092 + 1;
+    int v12094 = v12093 + 1;
+    int v12095 = v12094 + 1;
+    int v12096 = v12095 + 1;
+    int v12097 = v12096 + 1;
+    int v12098 = v12097 + 1;
+    int v12099 = v12098 + 1;
+    int v12100 = v12099 + 1;
+    int v12101 = v12100 + 1;
+    int v12102 = v12101 + 1;
+    int v12103 = v12102 + 1;
+    int v12104 = v12103 + 1;
+    int v12105 = v12104 + 1;
+    int v12106 = v12105 + 1;
+    int v12107 = v12106 + 1;
+    int v12108 = v12107 + 1;
+    int v12109 = v12108 + 1;
+    int v12110 = v12109 + 1;
+    int v12111 = v12110 + 1;
+    int v12112 = v12111 + 1;
+    int v12113 = v12112 + 1;
+    int v12114 = v12113 + 1;
+    int v12115 = v12114 + 1;
+    int v12116 = v12115 + 1;
+    int v12117 = v12116 + 1;
+    int v12118 = v12117 + 1;
+    int v12119 = v12118 + 1;
+    int v12120 = v12119 + 1;
+    int v12121 = v12120 + 1;
+    int v12122 = v12121 + 1;
+    int v12123 = v12122 + 1;
+    int v12124 = v12123 + 1;
+    int v12125 = v12124 + 1;
+    int v12126 = v12125 + 1;
+    int v12127 = v12126 + 1;
+    int v12128 = v12127 + 1;
+    int v12129 = v12128 + 1;
+    int v12130 = v12129 + 1;
+    int v12131 = v12130 + 1;
+    int v12132 = v12131 + 1;
+    int v12133 = v12132 + 1;
+    int v12134 = v12133 + 1;
+    int v12135 = v12134 + 1;
+    int v12136 = v12135 + 1;
+    int v12137 = v12136 + 1;
+    int v12138 = v12137 + 1;
+    int v12139 = v12138 + 1;
+    int v12140 = v12139 + 1;
+    int v12141 = v12140 + 1;
+    int v12142 = v12141 + 1;
+    int v12143 = v12142 + 1;
+    int v12144 = v12143 + 1;
+    int v12145 = v12144 + 1;
+    int v12146 = v12145 + 1;
+    int v12147 = v12146 + 1;
+    int v12148 = v12147 + 1;
+    int v12149 = v12148 + 1;
+    int v12150 = v12149 + 1;
+    int v12151 = v12150 + 1;
+    int v12152 = v12151 + 1;
+    int v12153 = v12152 + 1;
+    int v12154 = v12153 + 1;
+    int v12155 = v12154 + 1;
+    int v12156 = v12155 + 1;
+    int v12157 = v12156 + 1;
+    int v12158 = v12157 + 1;
+    int v12159 = v12158 + 1;
+    int v12160 = v12159 + 1;
+    int v12161 = v12160 + 1;
+    int v12162 = v12161 + 1;
+    int v12163 = v12162 + 1;
+    int v12164 = v12163 + 1;
+    int v12165 = v12164 + 1;
+    int v12166 = v12165 + 1;
+    int v12167 = v12166 + 1;
+    int v12168 = v12167 + 1;
+    int v12169 = v12168 + 1;
+    int v12170 = v12169 + 1;
+    int v12171 = v12170 + 1;
+    int v12172 = v12171 + 1;
+    int v12173 = v12172 + 1;
+    int v12174 = v12173 + 1;
+    int v12175 = v12174 + 1;
+    int v12176 = v12175 + 1;
+    int v12177 = v12176 + 1;
+    int v12178 = v12177 + 1;
+    int v12179 = v12178 + 1;
+    int v12180 = v12179 + 1;
+    int v12181 = v12180 + 1;
+    int v12182 = v12181 + 1;
+    int v12183 = v12182 + 1;
+    int v12184 = v12183 + 1;
+    int v12185 = v12184 + 1;
+    int v12186 = v12185 + 1;
+    int v12187 = v12186 + 1;
+    int v12188 = v12187 + 1;
+    int v12189 = v12188 + 1;
+    int v12190 = v12189 + 1;
+    int v12191 = v12190 + 1;
+    int v12192 = v12191 + 1;
+    int v12193 = v12192 + 1;
+    int v12194 = v12193 + 1;
+    int v12195 = v12194 + 1;
+    int v12196 = v12195 + 1;
+    int v12197 = v12196 + 1;
+    int v12198 = v12197 + 1;
+    int v12199 = v12198 + 1;
+    int v12200 = v12199 + 1;
+    int v12201 = v12200 + 1;
+    int v12202 = v12201 + 1;
+    int v12203 = v12202 + 1;
+    int v12204 = v12203 + 1;
+    int v12205 = v12204 + 1;
+    int v12206 = v12205 + 1;
+    int v12207 = v12206 + 1;
+    int v12208 = v12207 + 1;
+    int v12209 = v12208 + 1;
+    int v12210 = v12209 + 1;
+    int v12211 = v12210 + 1;
+    int v12212 = v12211 + 1;
+    int v12213 = v12212 + 1;
+    int v12214 = v12213 + 1;
+    int v12215 = v12214 + 1;
+    int v12216 = v12215 + 1;
+    int v12217 = v12216 + 1;
+    int v12218 = v12217 + 1;
+    int v12219 = v12218 + 1;
+    int v12220 = v12219 + 1;
+    int v12221 = v12220 + 1;
+    int v12222 = v12221 + 1;
+    int v12223 = v12222 + 1;
+    int v12224 = v12223 + 1;
+    int v12225 = v12224 + 1;
+    int v12226 = v12225 + 1;
+    int v12227 = v12226 + 1;
+    int v12228 = v12227 + 1;
+    int v12229 = v12228 + 1;
+    int v12230 = v12229 + 1;
+    int v12231 = v12230 + 1;
+    int v12232 = v12231 + 1;
+    int v12233 = v12232 + 1;
+    int v12234 = v12233 + 1;
+    int v12235 = v12234 + 1;
+    int v12236 = v12235 + 1;
+    int v12237 = v12236 + 1;
+    int v12238 = v12237 + 1;
+    int v12239 = v12238 + 1;
+    int v12240 = v12239 + 1;
+    int v12241 = v12240 + 1;
+    int v12242 = v12241 + 1;
+    int v12243 = v12242 + 1;
+    int v12244 = v12243 + 1;
+    int v12245 = v12244 + 1;
+    int v12246 = v12245 + 1;
+    int v12247 = v12246 + 1;
+    int v12248 = v12247 + 1;
+    int v12249 = v12248 + 1;
+    int v12250 = v12249 + 1;
+    int v12251 = v12250 + 1;
+    int v12252 = v12251 + 1;
+    int v12253 = v12252 + 1;
+    int v12254 = v12253 + 1;
+    int v12255 = v12254 + 1;
+    int v12256 = v12255 + 1;
+    int v12257 = v12256 + 1;
+    int v12258 = v12257 + 1;
+    int v12259 = v12258 + 1;
+    int v12260 = v12259 + 1;
+    int v12261 = v12260 + 1;
+    int v12262 = v12261 + 1;
+    int v12263 = v12262 + 1;
+    int v12264 = v12263 + 1;
+    int v12265 = v12264 + 1;
+    int v12266 = v12265 + 1;
+    int v12267 = v12266 + 1;
+    int v12268 = v12267 + 1;
+    int v12269 = v12268 + 1;
+    int v12270 = v12269 + 1;
+    int v12271 = v12270 + 1;
+    int v12272 = v12271 + 1;
+    int v12273 = v12272 + 1;
+    int v12274 = v12273 + 1;
+    int v12275 = v12274 + 1;
+    int v12276 = v12275 + 1;
+    int v12277 = v12276 + 1;
+    int v12278 = v12277 + 1;
+    int v12279 = v12278 + 1;
+    int v12280 = v12279 + 1;
+    int v12281 = v12280 + 1;
+    int v12282 = v12281 + 1;
+    int v12283 = v12282 + 1;
+    int v12284 = v12283 + 1;
+    int v12285 = v12284 + 1;
+    int v12286 = v12285 + 1;
+    int v12287 = v12286 + 1;
+    int v12288 = v12287 + 1;
+    int v12289 = v12288 + 1;
+    int v12290 = v12289 + 1;
+    int v12291 = v12290 + 1;
+    int v12292 = v12291 + 1;
+    int v12293 = v12292 + 1;
+    int v12294 = v12293 + 1;
+    int v12295 = v12294 + 1;
+    int v12296 = v12295 + 1;
+    int v12297 = v12296 + 1;
+    int v12298 = v12297 + 1;
+    int v12299 = v12298 + 1;
+    int v12300 = v12299 + 1;
+    int v12301 = v12300 + 1;
+    int v12302 = v12301 + 1;
+    int v12303 = v12302 + 1;
+    int v12304 = v12303 + 1;
+    int v12305 = v12304 + 1;
+    int v12306 = v12305 + 1;
+    int v12307 = v12306 + 1;
+    int v12308 = v12307 + 1;
+    int v12309 = v12308 + 1;
+    int v12310 = v12309 + 1;
+    int v12311 = v12310 + 1;
+    int v12312 = v12311 + 1;
+    int v12313 = v12312 + 1;
+    int v12314 = v12313 + 1;
+    int v12315 = v12314 + 1;
+    int v12316 = v12315 + 1;
+    int v12317 = v12316 + 1;
+    int v12318 = v12317 + 1;
+    int v12319 = v12318 + 1;
+    int v12320 = v12319 + 1;
+    int v12321 = v12320 + 1;
+    int v12322 = v12321 + 1;
+    int v12323 = v12322 + 1;
+    int v12324 = v12323 + 1;
+    int v12325 = v12324 + 1;
+    int v12326 = v12325 + 1;
+    int v12327 = v12326 + 1;
+    int v12328 = v12327 + 1;
+    int v12329 = v12328 + 1;
+    int v12330 = v12329 + 1;
+    int v12331 = v12330 + 1;
+    int v12332 = v12331 + 1;
+    int v12333 = v12332 + 1;
+    int v12334 = v12333 + 1;
+    int v12335 = v12334 + 1;
+    int v12336 = v12335 + 1;
+    int v12337 = v12336 + 1;
+    int v12338 = v12337 + 1;
+    int v12339 = v12338 + 1;
+    int v12340 = v12339 + 1;
+    int v12341 = v12340 + 1;
+    int v12342 = v12341 + 1;
+    int v12343 = v12342 + 1;
+    int v12344 = v12343 + 1;
+    int v12345 = v12344 + 1;
+    int v12346 = v12345 + 1;
+    int v12347 = v12346 + 1;
+    int v12348 = v12347 + 1;
+    int v12349 = v12348 + 1;
+    int v12350 = v12349 + 1;
+    int v12351 = v12350 + 1;
+    int v12352 = v12351 + 1;
+    int v12353 = v12352 + 1;
+    int v12354 = v12353 + 1;
+    int v12355 = v12354 + 1;
+    int v12356 = v12355 + 1;
+    int v12357 = v12356 + 1;
+    int v12358 = v12357 + 1;
+    int v12359 = v12358 + 1;
+    int v12360 = v12359 + 1;
+    int v12361 = v12360 + 1;
+    int v12362 = v12361 + 1;
+    int v12363 = v12362 + 1;
+    int v12364 = v12363 + 1;
+    int v12365 = v12364 + 1;
+    int v12366 = v12365 + 1;
+    int v12367 = v12366 + 1;
+    int v12368 = v12367 + 1;
+    int v12369 = v12368 + 1;
+    int v12370 = v12369 + 1;
+    int v12371 = v12370 + 1;
+    int v12372 = v12371 + 1;
+    int v12373 = v12372 + 1;
+    int v12374 = v12373 + 1;
+    int v12375 = v12374 + 1;
+    int v12376 = v12375 + 1;
+    int v12377 = v12376 + 1;
+    int v12378 = v12377 + 1;
+    int v12379 = v12378 + 1;
+    int v12380 = v12379 + 1;
+    int v12381 = v12380 + 1;
+    int v12382 = v12381 + 1;
+    int v12383 = v12382 + 1;
+    int v12384 = v12383 + 1;
+    int v12385 = v12384 + 1;
+    int v12386 = v12385 + 1;
+    int v12387 = v12386 + 1;
+    int v12388 = v12387 + 1;
+    int v12389 = v12388 + 1;
+    int v12390 = v12389 + 1;
+    int v12391 = v12390 + 1;
+    int v12392 = v12391 + 1;
+    int v12393 = v12392 + 1;
+    int v12394 = v12393 + 1;
+    int v12395 = v12394 + 1;
+    int v12396 = v12395 + 1;
+    int v12397 = v12396 + 1;
+    int v12398 = v12397 + 1;
+    int v12399 = v12398 + 1;
+    int v12400 = v12399 + 1;
+    int v12401 = v12400 + 1;
+    int v12402 = v12401 + 1;
+    int v12403 = v12402 + 1;
+    int v12404 = v12403 + 1;
+    int v12405 = v12404 + 1;
+    int v12406 = v12405 + 1;
+    int v12407 = v12406 + 1;
+    int v12408 = v12407 + 1;
+    int v12409 = v12408 + 1;
+    int v12410 = v12409 + 1;
+    int v12411 = v12410 + 1;
+    int v12412 = v12411 + 1;
+    int v12413 = v12412 + 1;
+    int v12414 = v12413 + 1;
+    int v12415 = v12414 + 1;
+    int v12416 = v12415 + 1;
+    int v12417 = v12416 + 1;
+    int v12418 = v12417 + 1;
+    int v12419 = v12418 + 1;
+    int v12420 = v12419 + 1;
+    int v12421 = v12420 + 1;
+    int v12422 = v12421 + 1;
+    int v12423 = v12422 + 1;
+    int v12424 = v12423 + 1;
+    int v12425 = v12424 + 1;
+    int v12426 = v12425 + 1;
+    int v12427 = v12426 + 1;
+    int v12428 = v12427 + 1;
+    int v12429 = v12428 + 1;
+    int v12430 = v12429 + 1;
+    int v12431 = v12430 + 1;
+    int v12432 = v12431 + 1;
+    int v12433 = v12432 + 1;
+    int v12434 = v12433 + 1;
+    int v12435 = v12434 + 1;
+    int v12436 = v12435 + 1;
+    int v12437 = v12436 + 1;
+    int v12438 = v12437 + 1;
+    int v12439 = v12438 + 1;
+    int v12440 = v12439 + 1;
+    int v12441 = v12440 + 1;
+    int v12442 = v12441 + 1;
+    int v12443 = v12442 + 1;
+    int v12444 = v12443 + 1;
+    int v12445 = v12444 + 1;
+    int v12446 = v12445 + 1;
+    int v12447 = v12446 + 1;
+    int v12448 = v12447 + 1;
+    int v12449 = v12448 + 1;
+    int v12450 = v12449 + 1;
+    int v12451 = v12450 + 1;
+    int v12452 = v12451 + 1;
+    int v12453 = v12452 + 1;
+    int v12454 = v12453 + 1;
+    int v12455 = v12454 + 1;
+    int v12456 = v12455 + 1;
+    int v12457 = v12456 + 1;
+    int v12458 = v12457 + 1;
+    int v12459 = v12458 + 1;
+    int v12460 = v12459 + 1;
+    int v12461 = v12460 + 1;
+    int v12462 = v12461 + 1;
+    int v12463 = v12462 + 1;
+    int v12464 = v12463 + 1;
+    int v12465 = v12464 + 1;
+    int v12466 = v12465 + 1;
+    int v12467 = v12466 + 1;
+    int v12468 = v12467 + 1;
+    int v12469 = v12468 + 1;
+    int v12470 = v12469 + 1;
+    int v12471 = v12470 + 1;
+    int v12472 = v12471 + 1;
+    int v12473 = v12472 + 1;
+    int v12474 = v12473 + 1;
+    int v12475 = v12474 + 1;
+    int v12476 = v12475 + 1;
+    int v12477 = v12476 + 1;
+    int v12478 = v12477 + 1;
+    int v12479 = v12478 + 1;
+    int v12480 = v12479 + 1;
+    int v12481 = v12480 + 1;
+    int v12482 = v12481 + 1;
+    int v12483 = v12482 + 1;
+    int v12484 = v12483 + 1;
+    int v12485 = v12484 + 1;
+    int v12486 = v12485 + 1;
+    int v12487 = v12486 + 1;
+    int v12488 = v12487 + 1;
+    int v12489 = v12488 + 1;
+    int v12490 = v12489 + 1;
+    int v12491 = v12490 + 1;
+    int v12492 = v12491 + 1;
+    int v12493 = v12492 + 1;
+    int v12494 = v12493 + 1;
+    int v12495 = v12494 + 1;
+    int v12496 = v12495 + 1;
+    int v12497 = v12496 + 1;
+    int v12498 = v12497 + 1;
+    int v12499 = v12498 + 1;
+    int v12500 = v12499 + 1;
+    int v12501 = v12500 + 1;
+    int v12502 = v12501 + 1;
+    int v12503 = v12502 + 1;
+    int v12504 = v12503 + 1;
+    int v12505 = v12504 + 1;
+    int v12506 = v12505 + 1;
+    int v12507 = v12506 + 1;
+    int v12508 = v12507 + 1;
+    int v12509 = v12508 + 1;
+    int v12510 = v12509 + 1;
+    int v12511 = v12510 + 1;
+    int v12512 = v12511 + 1;
+    int v12513 = v12512 + 1;
+    int v12514 = v12513 + 1;
+    int v12515 = v12514 + 1;
+    int v12516 = v12515 + 1;
+    int v12517 = v12516 + 1;
+    int v12518 = v12517 + 1;
+    int v12519 = v12518 + 1;
+    int v12520 = v12519 + 1;
+    int v12521 = v12520 + 1;
+    int v12522 = v12521 + 1;
+    int v12523 = v12522 + 1;
+    int v12524 = v12523 + 1;
+    int v12525 = v12524 + 1;
+    int v12526 = v12525 + 1;
+    int v12527 = v12526 + 1;
+    int v12528 = v12527 + 1;
+    int v12529 = v12528 + 1;
+    int v12530 = v12529 + 1;
+    int v12531 = v12530 + 1;
+    int v12532 = v12531 + 1;
+    int v12533 = v12532 + 1;
+    int v12534 = v12533 + 1;
+    int v12535 = v12534 + 1;
+    int v12536 = v12535 + 1;
+    int v12537 = v12536 + 1;
+    int v12538 = v12537 + 1;
+    int v12539 = v12538 + 1;
+    int v12540 = v12539 + 1;
+    int v12541 = v12540 + 1;
+    int v12542 = v12541 + 1;
+    int v12543 = v12542 + 1;
+    int v12544 = v12543 + 1;
+    int v12545 = v12544 + 1;
+    int v12546 = v12545 + 1;
+    int v12547 = v12546 + 1;
+    int v12548 = v12547 + 1;
+    int v12549 = v12548 + 1;
+    int v12550 = v12549 + 1;
+    int v12551 = v12550 + 1;
+    int v12552 = v12551 + 1;
+    int v12553 = v12552 + 1;
+    int v12554 = v12553 + 1;
+    int v12555 = v12554 + 1;
+    int v12556 = v12555 + 1;
+    int v12557 = v12556 + 1;
+    int v12558 = v12557 + 1;
+    int v12559 = v12558 + 1;
+    int v12560 = v12559 + 1;
+    int v12561 = v12560 + 1;
+    int v12562 = v12561 + 1;
+    int v12563 = v12562 + 1;
+    int v12564 = v12563 + 1;
+    int v12565 = v12564 + 1;
+    int v12566 = v12565 + 1;
+    int v12567 = v12566 + 1;
+    int v12568 = v12567 + 1;
+    int v12569 = v12568 + 1;
+    int v12570 = v12569 + 1;
+    int v12571 = v12570 + 1;
+    int v12572 = v12571 + 1;
+    int v12573 = v12572 + 1;
+    int v12574 = v12573 + 1;
+    int v12575 = v12574 + 1;
+    int v12576 = v12575 + 1;
+    int v12577 = v12576 + 1;
+    int v12578 = v12577 + 1;
+    int v12579 = v12578 + 1;
+    int v12580 = v12579 + 1;
+    int v12581 = v12580 + 1;
+    int v12582 = v12581 + 1;
+    int v12583 = v12582 + 1;
+    int v12584 = v12583 + 1;
+    int v12585 = v12584 + 1;
+    int v12586 = v12585 + 1;
+    int v12587 = v12586 + 1;
+    int v12588 = v12587 + 1;
+    int v12589 = v12588 + 1;
+    int v12590 = v12589 + 1;
+    int v12591 = v12590 + 1;
+    int v12592 = v12591 + 1;
+    int v12593 = v12592 + 1;
+    int v12594 = v12593 + 1;
+    int v12595 = v12594 + 1;
+    int v12596 = v12595 + 1;
+    int v12597 = v12596 + 1;
+    int v12598 = v12597 + 1;
+    int v12599 = v12598 + 1;
+    int v12600 = v12599 + 1;
+    int v12601 = v12600 + 1;
+    int v12602 = v12601 + 1;
+    int v12603 = v12602 + 1;
+    int v12604 = v12603 + 1;
+    int v12605 = v12604 + 1;
+    int v12606 = v12605 + 1;
+    int v12607 = v12606 + 1;
+    int v12608 = v12607 + 1;
+    int v12609 = v12608 + 1;
+    int v12610 = v12609 + 1;
+    int v12611 = v12610 + 1;
+    int v12612 = v12611 + 1;
+    int v12613 = v12612 + 1;
+    int v12614 = v12613 + 1;
+    int v12615 = v12614 + 1;
+    int v12616 = v12615 + 1;
+    int v12617 = v12616 + 1;
+    int v12618 = v12617 + 1;
+    int v12619 = v12618 + 1;
+    int v12620 = v12619 + 1;
+    int v12621 = v12620 + 1;
+    int v12622 = v12621 + 1;
+    int v12623 = v12622 + 1;
+    int v12624 = v12623 + 1;
+    int v12625 = v12624 + 1;
+    int v12626 = v12625 + 1;
+    int v12627 = v12626 + 1;
+    int v12628 = v12627 + 1;
+    int v12629 = v12628 + 1;
+    int v12630 = v12629 + 1;
+    int v12631 = v12630 + 1;
+    int v12632 = v12631 + 1;
+    int v12633 = v12632 + 1;
+    int v12634 = v12633 + 1;
+    int v12635 = v12634 + 1;
+    int v12636 = v12635 + 1;
+    int v12637 = v12636 + 1;
+    int v12638 = v12637 + 1;
+    int v12639 = v12638 + 1;
+    int v12640 = v12639 + 1;
+    int v12641 = v12640 + 1;
+    int v12642 = v12641 + 1;
+    int v12643 = v12642 + 1;
+    int v12644 = v12643 + 1;
+    int v12645 = v12644 + 1;
+    int v12646 = v12645 + 1;
+    int v12647 = v12646 + 1;
+    int v12648 = v12647 + 1;
+    int v12649 = v12648 + 1;
+    int v12650 = v12649 + 1;
+    int v12651 = v12650 + 1;
+    int v12652 = v12651 + 1;
+    int v12653 = v12652 + 1;
+    int v12654 = v12653 + 1;
+    int v12655 = v12654 + 1;
+    int v12656 = v12655 + 1;
+    int v12657 = v12656 + 1;
+    int v12658 = v12657 + 1;
+    int v12659 = v12658 + 1;
+    int v12660 = v12659 + 1;
+    int v12661 = v12660 + 1;
+    int v12662 = v12661 + 1;
+    int v12663 = v12662 + 1;
+    int v12664 = v12663 + 1;
+    int v12665 = v12664 + 1;
+    int v12666 = v12665 + 1;
+    int v12667 = v12666 + 1;
+    int v12668 = v12667 + 1;
+    int v12669 = v12668 + 1;
+    int v12670 = v12669 + 1;
+    int v12671 = v12670 + 1;
+    int v12672 = v12671 + 1;
+    int v12673 = v12672 + 1;
+    int v12674 = v12673 + 1;
+    int v12675 = v12674 + 1;
+    int v12676 = v12675 + 1;
+    int v12677 = v12676 + 1;
+    int v12678 = v12677 + 1;
+    int v12679 = v12678 + 1;
+    int v12680 = v12679 + 1;
+    int v12681 = v12680 + 1;
+    int v12682 = v12681 + 1;
+    int v12683 = v12682 + 1;
+    int v12684 = v12683 + 1;
+    int v12685 = v12684 + 1;
+    int v12686 = v12685 + 1;
+    int v12687 = v12686 + 1;
+    int v12688 = v12687 + 1;
+    int v12689 = v12688 + 1;
+    int v12690 = v12689 + 1;
+    int v12691 = v12690 + 1;
+    int v12692 = v12691 + 1;
+    int v12693 = v12692 + 1;
+    int v12694 = v12693 + 1;
+    int v12695 = v12694 + 1;
+    int v12696 = v12695 + 1;
+    int v12697 = v12696 + 1;
+    int v12698 = v12697 + 1;
+    int v12699 = v12698 + 1;
+    int v12700 = v12699 + 1;
+    int v12701 = v12700 + 1;
+    int v12702 = v12701 + 1;
+    int v12703 = v12702 + 1;
+    int v12704 = v12703 + 1;
+    int v12705 = v12704 + 1;
+    int v12706 = v12705 + 1;
+    int v12707 = v12706 + 1;
+    int v12708 = v12707 + 1;
+    int v12709 = v12708 + 1;
+    int v12710 = v12709 + 1;
+    int v12711 = v12710 + 1;
+    int v12712 = v12711 + 1;
+    int v12713 = v12712 + 1;
+    int v12714 = v12713 + 1;
+    int v12715 = v12714 + 1;
+    int v12716 = v12715 + 1;
+    int v12717 = v12716 + 1;
+    int v12718 = v12717 + 1;
+    int v12719 = v12718 + 1;
+    int v12720 = v12719 + 1;
+    int v12721 = v12720 + 1;
+    int v12722 = v12721 + 1;
+    int v12723 = v12722 + 1;
+    int v12724 = v12723 + 1;
+    int v12725 = v12724 + 1;
+    int v12726 = v12725 + 1;
+    int v12727 = v12726 + 1;
+    int v12728 = v12727 + 1;
+    int v12729 = v12728 + 1;
+    int v12730 = v12729 + 1;
+    int v12731 = v12730 + 1;
+    int v12732 = v12731 + 1;
+    int v12733 = v12732 + 1;
+    int v12734 = v12733 + 1;
+    int v12735 = v12734 + 1;
+    int v12736 = v12735 + 1;
+    int v12737 = v12736 + 1;
+    int v12738 = v12737 + 1;
+    int v12739 = v12738 + 1;
+    int v12740 = v12739 + 1;
+    int v12741 = v12740 + 1;
+    int v12742 = v12741 + 1;
+    int v12743 = v12742 + 1;
+    int v12744 = v12743 + 1;
+    int v12745 = v12744 + 1;
+    int v12746 = v12745 + 1;
+    int v12747 = v12746 + 1;
+    int v12748 = v12747 + 1;
+    int v12749 = v12748 + 1;
+    int v12750 = v12749 + 1;
+    int v12751 = v12750 + 1;
+    int v12752 = v12751 + 1;
+    int v12753 = v12752 + 1;
+    int v12754 = v12753 + 1;
+    int v12755 = v12754 + 1;
+    int v12756 = v12755 + 1;
+    int v12757 = v12756 + 1;
+    int v12758 = v12757 + 1;
+    int v12759 = v12758 + 1;
+    int v12760 = v12759 + 1;
+    int v12761 = v12760 + 1;
+    int v12762 = v12761 + 1;
+    int v12763 = v12762 + 1;
+    int v12764 = v12763 + 1;
+    int v12765 = v12764 + 1;
+    int v12766 = v12765 + 1;
+    int v12767 = v12766 + 1;
+    int v12768 = v12767 + 1;
+    int v12769 = v12768 + 1;
+    int v12770 = v12769 + 1;
+    int v12771 = v12770 + 1;
+    int v12772 = v12771 + 1;
+    int v12773 = v12772 + 1;
+    int v12774 = v12773 + 1;
+    int v12775 = v12774 + 1;
+    int v12776 = v12775 + 1;
+    int v12777 = v12776 + 1;
+    int v12778 = v12777 + 1;
+    int v12779 = v12778 + 1;
+    int v12780 = v12779 + 1;
+    int v12781 = v12780 + 1;
+    int v12782 = v12781 + 1;
+    int v12783 = v12782 + 1;
+    int v12784 = v12783 + 1;
+    int v12785 = v12784 + 1;
+    int v12786 = v12785 + 1;
+    int v12787 = v12786 + 1;
+    int v12788 = v12787 + 1;
+    int v12789 = v12788 + 1;
+    int v12790 = v12789 + 1;
+    int v12791 = v12790 + 1;
+    int v12792 = v12791 + 1;
+    int v12793 = v12792 + 1;
+    int v12794 = v12793 + 1;
+    int v12795 = v12794 + 1;
+    int v12796 = v12795 + 1;
+    int v12797 = v12796 + 1;
+    int v12798 = v12797 + 1;
+    int v12799 = v12798 + 1;
+    int v12800 = v12799 + 1;
+    int v12801 = v12800 + 1;
+    int v12802 = v12801 + 1;
+    int v12803 = v12802 + 1;
+    int v12804 = v12803 + 1;
+    int v12805 = v12804 + 1;
+    int v12806 = v12805 + 1;
+    int v12807 = v12806 + 1;
+    int v12808 = v12807 + 1;
+    int v12809 = v12808 + 1;
+    int v12810 = v12809 + 1;
+    int v12811 = v12810 + 1;
+    int v12812 = v12811 + 1;
+    int v12813 = v12812 + 1;
+    int v12814 = v12813 + 1;
+    int v12815 = v12814 + 1;
+    int v12816 = v12815 + 1;
+    int v12817 = v12816 + 1;
+    int v12818 = v12817 + 1;
+    int v12819 = v12818 + 1;
+    int v12820 = v12819 + 1;
+    int v12821 = v12820 + 1;
+    int v12822 = v12821 + 1;
+    int v12823 = v12822 + 1;
+    int v12824 = v12823 + 1;
+    int v12825 = v12824 + 1;
+    int v12826 = v12825 + 1;
+    int v12827 = v12826 + 1;
+    int v12828 = v12827 + 1;
+    int v12829 = v12828 + 1;
+    int v12830 = v12829 + 1;
+    int v12831 = v12830 + 1;
+    int v12832 = v12831 + 1;
+    int v12833 = v12832 + 1;
+    int v12834 = v12833 + 1;
+    int v12835 = v12834 + 1;
+    int v12836 = v12835 + 1;
+    int v12837 = v12836 + 1;
+    int v12838 = v12837 + 1;
+    int v12839 = v12838 + 1;
+    int v12840 = v12839 + 1;
+    int v12841 = v12840 + 1;
+    int v12842 = v12841 + 1;
+    int v12843 = v12842 + 1;
+    int v12844 = v12843 + 1;
+    int v12845 = v12844 + 1;
+    int v12846 = v12845 + 1;
+    int v12847 = v12846 + 1;
+    int v12848 = v12847 + 1;
+    int v12849 = v12848 + 1;
+    int v12850 = v12849 + 1;
+    int v12851 = v12850 + 1;
+    int v12852 = v12851 + 1;
+    int v12853 = v12852 + 1;
+    int v12854 = v12853 + 1;
+    int v12855 = v12854 + 1;
+    int v12856 = v12855 + 1;
+    int v12857 = v12856 + 1;
+    int v12858 = v12857 + 1;
+    int v12859 = v12858 + 1;
+    int v12860 = v12859 + 1;
+    int v12861 = v12860 + 1;
+    int v12862 = v12861 + 1;
+    int v12863 = v12862 + 1;
+    int v12864 = v12863 + 1;
+    int v12865 = v12864 + 1;
+    int v12866 = v12865 + 1;
+    int v12867 = v12866 + 1;
+    int v12868 = v12867 + 1;
+    int v12869 = v12868 + 1;
+    int v12870 = v12869 + 1;
+    int v12871 = v12870 + 1;
+    int v12872 = v12871 + 1;
+    int v12873 = v12872 + 1;
+    int v12874 = v12873 + 1;
+    int v12875 = v12874 + 1;
+    int v12876 = v12875 + 1;
+    int v12877 = v12876 + 1;
+    int v12878 = v12877 + 1;
+    int v12879 = v12878 + 1;
+    int v12880 = v12879 + 1;
+    int v12881 = v12880 + 1;
+    int v12882 = v12881 + 1;
+    int v12883 = v12882 + 1;
+    int v12884 = v12883 + 1;
+    int v12885 = v12884 + 1;
+    int v12886 = v12885 + 1;
+    int v12887 = v12886 + 1;
+    int v12888 = v12887 + 1;
+    int v12889 = v12888 + 1;
+    int v12890 = v12889 + 1;
+    int v12891 = v12890 + 1;
+    int v12892 = v12891 + 1;
+    int v12893 = v12892 + 1;
+    int v12894 = v12893 + 1;
+    int v12895 = v12894 + 1;
+    int v12896 = v12895 + 1;
+    int v12897 = v12896 + 1;
+    int v12898 = v12897 + 1;
+    int v12899 = v12898 + 1;
+    int v12900 = v12899 + 1;
+    int v12901 = v12900 + 1;
+    int v12902 = v12901 + 1;
+    int v12903 = v12902 + 1;
+    int v12904 = v12903 + 1;
+    int v12905 = v12904 + 1;
+    int v12906 = v12905 + 1;
+    int v12907 = v12906 + 1;
+    int v12908 = v12907 + 1;
+    int v12909 = v12908 + 1;
+    int v12910 = v12909 + 1;
+    int v12911 = v12910 + 1;
+    int v12912 = v12911 + 1;
+    int v12913 = v12912 + 1;
+    int v12914 = v12913 + 1;
+    int v12915 = v12914 + 1;
+    int v12916 = v12915 + 1;
+    int v12917 = v12916 + 1;
+    int v12918 = v12917 + 1;
+    int v12919 = v12918 + 1;
+    int v12920 = v12919 + 1;
+    int v12921 = v12920 + 1;
+    int v12922 = v12921 + 1;
+    int v12923 = v12922 + 1;
+    int v12924 = v12923 + 1;
+    int v12925 = v12924 + 1;
+    int v12926 = v12925 + 1;
+    int v12927 = v12926 + 1;
+    int v12928 = v12927 + 1;
+    int v12929 = v12928 + 1;
+    int v12930 = v12929 + 1;
+    int v12931 = v12930 + 1;
+    int v12932 = v12931 + 1;
+    int v12933 = v12932 + 1;
+    int v12934 = v12933 + 1;
+    int v12935 = v12934 + 1;
+    int v12936 = v12935 + 1;
+    int v12937 = v12936 + 1;
+    int v12938 = v12937 + 1;
+    int v12939 = v12938 + 1;
+    int v12940 = v12939 + 1;
+    int v12941 = v12940 + 1;
+    int v12942 = v12941 + 1;
+    int v12943 = v12942 + 1;
+    int v12944 = v12943 + 1;
+    int v12945 = v12944 + 1;
+    int v12946 = v12945 + 1;
+    int v12947 = v12946 + 1;
+    int v12948 = v12947 + 1;
+    int v12949 = v12948 + 1;
+    int v12950 = v12949 + 1;
+    int v12951 = v12950 + 1;
+    int v12952 = v12951 + 1;
+    int v12953 = v12952 + 1;
+    int v12954 = v12953 + 1;
+    int v12955 = v12954 + 1;
+    int v12956 = v12955 + 1;
+    int v12957 = v12956 + 1;
+    int v12958 = v12957 + 1;
+    int v12959 = v12958 + 1;
+    int v12960 = v12959 + 1;
+    int v12961 = v12960 + 1;
+    int v12962 = v12961 + 1;
+    int v12963 = v12962 + 1;
+    int v12964 = v12963 + 1;
+    int v12965 = v12964 + 1;
+    int v12966 = v12965 + 1;
+    int v12967 = v12966 + 1;
+    int v12968 = v12967 + 1;
+    int v12969 = v12968 + 1;
+    int v12970 = v12969 + 1;
+    int v12971 = v12970 + 1;
+    int v12972 = v12971 + 1;
+    int v12973 = v12972 + 1;
+    int v12974 = v12973 + 1;
+    int v12975 = v12974 + 1;
+    int v12976 = v12975 + 1;
+    int v12977 = v12976 + 1;
+    int v12978 = v12977 + 1;
+    int v12979 = v12978 + 1;
+    int v12980 = v12979 + 1;
+    int v12981 = v12980 + 1;
+    int v12982 = v12981 + 1;
+    int v12983 = v12982 + 1;
+    int v12984 = v12983 + 1;
+    int v12985 = v12984 + 1;
+    int v12986 = v12985 + 1;
+    int v12987 = v12986 + 1;
+    int v12988 = v12987 + 1;
+    int v12989 = v12988 + 1;
+    int v12990 = v12989 + 1;
+    int v12991 = v12990 + 1;
+    int v12992 = v12991 + 1;
+    int v12993 = v12992 + 1;
+    int v12994 = v12993 + 1;
+    int v12995 = v12994 + 1;
+    int v12996 = v12995 + 1;
+    int v12997 = v12996 + 1;
+    int v12998 = v12997 + 1;
+    int v12999 = v12998 + 1;
+    int v13000 = v12999 + 1;
+    int v13001 = v13000 + 1;
+    int v13002 = v13001 + 1;
+    int v13003 = v13002 + 1;
+    int v13004 = v13003 + 1;
+    int v13005 = v13004 + 1;
+    int v13006 = v13005 + 1;
+    int v13007 = v13006 + 1;
+    int v13008 = v13007 + 1;
+    int v13009 = v13008 + 1;
+    int v13010 = v13009 + 1;
+    int v13011 = v13010 + 1;
+    int v13012 = v13011 + 1;
+    int v13013 = v13012 + 1;
+    int v13014 = v13013 + 1;
+    int v13015 = v13014 + 1;
+    int v13016 = v13015 + 1;
+    int v13017 = v13016 + 1;
+    int v13018 = v13017 + 1;
+    int v13019 = v13018 + 1;
+    int v13020 = v13019 + 1;
+    int v13021 = v13020 + 1;
+    int v13022 = v13021 + 1;
+    int v13023 = v13022 + 1;
+    int v13024 = v13023 + 1;
+    int v13025 = v13024 + 1;
+    int v13026 = v13025 + 1;
+    int v13027 = v13026 + 1;
+    int v13028 = v13027 + 1;
+    int v13029 = v13028 + 1;
+    int v13030 = v13029 + 1;
+    int v13031 = v13030 + 1;
+    int v13032 = v13031 + 1;
+    int v13033 = v13032 + 1;
+    int v13034 = v13033 + 1;
+    int v13035 = v13034 + 1;
+    int v13036 = v13035 + 1;
+    int v13037 = v13036 + 1;
+    int v13038 = v13037 + 1;
+    int v13039 = v13038 + 1;
+    int v13040 = v13039 + 1;
+    int v13041 = v13040 + 1;
+    int v13042 = v13041 + 1;
+    int v13043 = v13042 + 1;
+    int v13044 = v13043 + 1;
+    int v13045 = v13044 + 1;
+    int v13046 = v13045 + 1;
+    int v13047 = v13046 + 1;
+    int v13048 = v13047 + 1;
+    int v13049 = v13048 + 1;
+    int v13050 = v13049 + 1;
+    int v13051 = v13050 + 1;
+    int v13052 = v13051 + 1;
+    int v13053 = v13052 + 1;
+    int v13054 = v13053 + 1;
+    int v13055 = v13054 + 1;
+    int v13056 = v13055 + 1;
+    int v13057 = v13056 + 1;
+    int v13058 = v13057 + 1;
+    int v13059 = v13058 + 1;
+    int v13060 = v13059 + 1;
+    int v13061 = v13060 + 1;
+    int v13062 = v13061 + 1;
+    int v13063 = v13062 + 1;
+    int v13064 = v13063 + 1;
+    int v13065 = v13064 + 1;
+    int v13066 = v13065 + 1;
+    int v13067 = v13066 + 1;
+    int v13068 = v13067 + 1;
+    int v13069 = v13068 + 1;
+    int v13070 = v13069 + 1;
+    int v13071 = v13070 + 1;
+    int v13072 = v13071 + 1;
+    int v13073 = v13072 + 1;
+    int v13074 = v13073 + 1;
+    int v13075 = v13074 + 1;
+    int v13076 = v13075 + 1;
+    int v13077 = v13076 + 1;
+    int v13078 = v13077 + 1;
+    int v13079 = v13078 + 1;
+    int v13080 = v13079 + 1;
+    int v13081 = v13080 + 1;
+    int v13082 = v13081 + 1;
+    int v13083 = v13082 + 1;
+    int v13084 = v13083 + 1;
+    int v13085 = v13084 + 1;
+    int v13086 = v13085 + 1;
+    int v13087 = v13086 + 1;
+    int v13088 = v13087 + 1;
+    int v13089 = v13088 + 1;
+    int v13090 = v13089 + 1;
+    int v13091 = v13090 + 1;
+    int v13092 = v13091 + 1;
+    int v13093 = v13092 + 1;
+    int v13094 = v13093 + 1;
+    int v13095 = v13094 + 1;
+    int v13096 = v13095 + 1;
+    int v13097 = v13096 + 1;
+    int v13098 = v13097 + 1;
+    int v13099 = v13098 + 1;
+    int v13100 = v13099 + 1;
+    int v13101 = v13100 + 1;
+    int v13102 = v13101 + 1;
+    int v13103 = v13102 + 1;
+    int v13104 = v13103 + 1;
+    int v13105 = v13104 + 1;
+    int v13106 = v13105 + 1;
+    int v13107 = v13106 + 1;
+    int v13108 = v13107 + 1;
+    int v13109 = v13108 + 1;
+    int v13110 = v13109 + 1;
+    int v13111 = v13110 + 1;
+    int v13112 = v13111 + 1;
+    int v13113 = v13112 + 1;
+    int v13114 = v13113 + 1;
+    int v13115 = v13114 + 1;
+    int v13116 = v13115 + 1;
+    int v13117 = v13116 + 1;
+    int v13118 = v13117 + 1;
+    int v13119 = v13118 + 1;
+    int v13120 = v13119 + 1;
+    int v13121 = v13120 + 1;
+    int v13122 = v13121 + 1;
+    int v13123 = v13122 + 1;
+    int v13124 = v13123 + 1;
+    int v13125 = v13124 + 1;
+    int v13126 = v13125 + 1;
+    int v13127 = v13126 + 1;
+    int v13128 = v13127 + 1;
+    int v13129 = v13128 + 1;
+    int v13130 = v13129 + 1;
+    int v13131 = v13130 + 1;
+    int v13132 = v13131 + 1;
+    int v13133 = v13132 + 1;
+    int v13134 = v13133 + 1;
+    int v13135 = v13134 + 1;
+    int v13136 = v13135 + 1;
+    int v13137 = v13136 + 1;
+    int v13138 = v13137 + 1;
+    int v13139 = v13138 + 1;
+    int v13140 = v13139 + 1;
+    int v13141 = v13140 + 1;
+    int v13142 = v13141 + 1;
+    int v13143 = v13142 + 1;
+    int v13144 = v13143 + 1;
+    int v13145 = v13144 + 1;
+    int v13146 = v13145 + 1;
+    int v13147 = v13146 + 1;
+    int v13148 = v13147 + 1;
+    int v13149 = v13148 + 1;
+    int v13150 = v13149 + 1;
+    int v13151 = v13150 + 1;
+    int v13152 = v13151 + 1;
+    int v13153 = v13152 + 1;
+    int v13154 = v13153 + 1;
+    int v13155 = v13154 + 1;
+    int v13156 = v13155 + 1;
+    int v13157 = v13156 + 1;
+    int v13158 = v13157 + 1;
+    int v13159 = v13158 + 1;
+    int v13160 = v13159 + 1;
+    int v13161 = v13160 + 1;
+    int v13162 = v13161 + 1;
+    int v13163 = v13162 + 1;
+    int v13164 = v13163 + 1;
+    int v13165 = v13164 + 1;
+    int v13166 = v13165 + 1;
+    int v13167 = v13166 + 1;
+    int v13168 = v13167 + 1;
+    int v13169 = v13168 + 1;
+    int v13170 = v13169 + 1;
+    int v13171 = v13170 + 1;
+    int v13172 = v13171 + 1;
+    int v13173 = v13172 + 1;
+    int v13174 = v13173 + 1;
+    int v13175 = v13174 + 1;
+    int v13176 = v13175 + 1;
+    int v13177 = v13176 + 1;
+    int v13178 = v13177 + 1;
+    int v13179 = v13178 + 1;
+    int v13180 = v13179 + 1;
+    int v13181 = v13180 + 1;
+    int v13182 = v13181 + 1;
+    int v13183 = v13182 + 1;
+    int v13184 = v13183 + 1;
+    int v13185 = v13184 + 1;
+    int v13186 = v13185 + 1;
+    int v13187 = v13186 + 1;
+    int v13188 = v13187 + 1;
+    int v13189 = v13188 + 1;
+    int v13190 = v13189 + 1;
+    int v13191 = v13190 + 1;
+    int v13192 = v13191 + 1;
+    int v13193 = v13192 + 1;
+    int v13194 = v13193 + 1;
+    int v13195 = v13194 + 1;
+    int v13196 = v13195 + 1;
+    int v13197 = v13196 + 1;
+    int v13198 = v13197 + 1;
+    int v13199 = v13198 + 1;
+    int v13200 = v13199 + 1;
+    int v13201 = v13200 + 1;
+    int v13202 = v13201 + 1;
+    int v13203 = v13202 + 1;
+    int v13204 = v13203 + 1;
+    int v13205 = v13204 + 1;
+    int v13206 = v13205 + 1;
+    int v13207 = v13206 + 1;
+    int v13208 = v13207 + 1;
+    int v13209 = v13208 + 1;
+    int v13210 = v13209 + 1;
+    int v13211 = v13210 + 1;
+    int v13212 = v13211 + 1;
+    int v13213 = v13212 + 1;
+    int v13214 = v13213 + 1;
+    int v13215 = v13214 + 1;
+    int v13216 = v13215 + 1;
+    int v13217 = v13216 + 1;
+    int v13218 = v13217 + 1;
+    int v13219 = v13218 + 1;
+    int v13220 = v13219 + 1;
+    int v13221 = v13220 + 1;
+    int v13222 = v13221 + 1;
+    int v13223 = v13222 + 1;
+    int v13224 = v13223 + 1;
+    int v13225 = v13224 + 1;
+    int v13226 = v13225 + 1;
+    int v13227 = v13226 + 1;
+    int v13228 = v13227 + 1;
+    int v13229 = v13228 + 1;
+    int v13230 = v13229 + 1;
+    int v13231 = v13230 + 1;
+    int v13232 = v13231 + 1;
+    int v13233 = v13232 + 1;
+    int v13234 = v13233 + 1;
+    int v13235 = v13234 + 1;
+    int v13236 = v13235 + 1;
+    int v13237 = v13236 + 1;
+    int v13238 = v13237 + 1;
+    int v13239 = v13238 + 1;
+    int v13240 = v13239 + 1;
+    int v13241 = v13240 + 1;
+    int v13242 = v13241 + 1;
+    int v13243 = v13242 + 1;
+    int v13244 = v13243 + 1;
+    int v13245 = v13244 + 1;
+    int v13246 = v13245 + 1;
+    int v13247 = v13246 + 1;
+    int v13248 = v13247 + 1;
+    int v13249 = v13248 + 1;
+    int v13250 = v13249 + 1;
+    int v13251 = v13250 + 1;
+    int v13252 = v13251 + 1;
+    int v13253 = v13252 + 1;
+    int v13254 = v13253 + 1;
+    int v13255 = v13254 + 1;
+    int v13256 = v13255 + 1;
+    int v13257 = v13256 + 1;
+    int v13258 = v13257 + 1;
+    int v13259 = v13258 + 1;
+    int v13260 = v13259 + 1;
+    int v13261 = v13260 + 1;
+    int v13262 = v13261 + 1;
+    int v13263 = v13262 + 1;
+    int v13264 = v13263 + 1;
+    int v13265 = v13264 + 1;
+    int v13266 = v13265 + 1;
+    int v13267 = v13266 + 1;
+    int v13268 = v13267 + 1;
+    int v13269 = v13268 + 1;
+    int v13270 = v13269 + 1;
+    int v13271 = v13270 + 1;
+    int v13272 = v13271 + 1;
+    int v13273 = v13272 + 1;
+    int v13274 = v13273 + 1;
+    int v13275 = v13274 + 1;
+    int v13276 = v13275 + 1;
+    int v13277 = v13276 + 1;
+    int v13278 = v13277 + 1;
+    int v13279 = v13278 + 1;
+    int v13280 = v13279 + 1;
+    int v13281 = v13280 + 1;
+    int v13282 = v13281 + 1;
+    int v13283 = v13282 + 1;
+    int v13284 = v13283 + 1;
+    int v13285 = v13284 + 1;
+    int v13286 = v13285 + 1;
+    int v13287 = v13286 + 1;
+    int v13288 = v13287 + 1;
+    int v13289 = v13288 + 1;
+    int v13290 = v13289 + 1;
+    int v13291 = v13290 + 1;
+    int v13292 = v13291 + 1;
+    int v13293 = v13292 + 1;
+    int v13294 = v13293 + 1;
+    int v13295 = v13294 + 1;
+    int v13296 = v13295 + 1;
+    int v13297 = v13296 + 1;
+    int v13298 = v13297 + 1;
+    int v13299 = v13298 + 1;
+    int v13300 = v13299 + 1;
+    int v13301 = v13300 + 1;
+    int v13302 = v13301 + 1;
+    int v13303 = v13302 + 1;
+    int v13304 = v13303 + 1;
+    int v13305 = v13304 + 1;
+    int v13306 = v13305 + 1;
+    int v13307 = v13306 + 1;
+    int v13308 = v13307 + 1;
+    int v13309 = v13308 + 1;
+    int v13310 = v13309 + 1;
+    int v13311 = v13310 + 1;
+    int v13312 = v13311 + 1;
+    int v13313 = v13312 + 1;
+    int v13314 = v13313 + 1;
+    int v13315 = v13314 + 1;
+    int v13316 = v13315 + 1;
+    int v13317 = v13316 + 1;
+    int v13318 = v13317 + 1;
+    int v13319 = v13318 + 1;
+    int v13320 = v13319 + 1;
+    int v13321 = v13320 + 1;
+    int v13322 = v13321 + 1;
+    int v13323 = v13322 + 1;
+    int v13324 = v13323 + 1;
+    int v13325 = v13324 + 1;
+    int v13326 = v13325 + 1;
+    int v13327 = v13326 + 1;
+    int v13328 = v13327 + 1;
+    int v13329 = v13328 + 1;
+    int v13330 = v13329 + 1;
+    int v13331 = v13330 + 1;
+    int v13332 = v13331 + 1;
+    int v13333 = v13332 + 1;
+    int v13334 = v13333 + 1;
+    int v13335 = v13334 + 1;
+    int v13336 = v13335 + 1;
+    int v13337 = v13336 + 1;
+    int v13338 = v13337 + 1;
+    int v13339 = v13338 + 1;
+    int v13340 = v13339 + 1;
+    int v13341 = v13340 + 1;
+    int v13342 = v13341 + 1;
+    int v13343 = v13342 + 1;
+    int v13344 = v13343 + 1;
+    int v13345 = v13344 + 1;
+    int v13346 = v13345 + 1;
+    int v13347 = v13346 + 1;
+    int v13348 = v13347 + 1;
+    int v13349 = v13348 + 1;
+    int v13350 = v13349 + 1;
+    int v13351 = v13350 + 1;
+    int v13352 = v13351 + 1;
+    int v13353 = v13352 + 1;
+    int v13354 = v13353 + 1;
+    int v13355 = v13354 + 1;
+    int v13356 = v13355 + 1;
+    int v13357 = v13356 + 1;
+    int v13358 = v13357 + 1;
+    int v13359 = v13358 + 1;
+    int v13360 = v13359 + 1;
+    int v13361 = v13360 + 1;
+    int v13362 = v13361 + 1;
+    int v13363 = v13362 + 1;
+    int v13364 = v13363 + 1;
+    int v13365 = v13364 + 1;
+    int v13366 = v13365 + 1;
+    int v13367 = v13366 + 1;
+    int v13368 = v13367 + 1;
+    int v13369 = v13368 + 1;
+    int v13370 = v13369 + 1;
+    int v13371 = v13370 + 1;
+    int v13372 = v13371 + 1;
+    int v13373 = v13372 + 1;
+    int v13374 = v13373 + 1;
+    int v13375 = v13374 + 1;
+    int v13376 = v13375 + 1;
+    int v13377 = v13376 + 1;
+    int v13378 = v13377 + 1;
+    int v13379 = v13378 + 1;
+    int v13380 = v13379 + 1;
+    int v13381 = v13380 + 1;
+    int v13382 = v13381 + 1;
+    int v13383 = v13382 + 1;
+    int v13384 = v13383 + 1;
+    int v13385 = v13384 + 1;
+    int v13386 = v13385 + 1;
+    int v13387 = v13386 + 1;
+    int v13388 = v13387 + 1;
+    int v13389 = v13388 + 1;
+    int v13390 = v13389 + 1;
+    int v13391 = v13390 + 1;
+    int v13392 = v13391 + 1;
+    int v13393 = v13392 + 1;
+    int v13394 = v13393 + 1;
+    int v13395 = v13394 + 1;
+    int v13396 = v13395 + 1;
+    int v13397 = v13396 + 1;
+    int v13398 = v13397 + 1;
+    int v13399 = v13398 + 1;
+    int v13400 = v13399 + 1;
+    int v13401 = v13400 + 1;
+    int v13402 = v13401 + 1;
+    int v13403 = v13402 + 1;
+    int v13404 = v13403 + 1;
+    int v13405 = v13404 + 1;
+    int v13406 = v13405 + 1;
+    int v13407 = v13406 + 1;
+    int v13408 = v13407 + 1;
+    int v13409 = v13408 + 1;
+    int v13410 = v13409 + 1;
+    int v13411 = v13410 + 1;
+    int v13412 = v13411 + 1;
+    int v13413 = v13412 + 1;
+    int v13414 = v13413 + 1;
+    int v13415 = v13414 + 1;
+    int v13416 = v13415 + 1;
+    int v13417 = v13416 + 1;
+    int v13418 = v13417 + 1;
+    int v13419 = v13418 + 1;
+    int v13420 = v13419 + 1;
+    int v13421 = v13420 + 1;
+    int v13422 = v13421 + 1;
+    int v13423 = v13422 + 1;
+    int v13424 = v13423 + 1;
+    int v13425 = v13424 + 1;
+    int v13426 = v13425 + 1;
+    int v13427 = v13426 + 1;
+    int v13428 = v13427 + 1;
+    int v13429 = v13428 + 1;
+    int v13430 = v13429 + 1;
+    int v13431 = v13430 + 1;
+    int v13432 = v13431 + 1;
+    int v13433 = v13432 + 1;
+    int v13434 = v13433 + 1;
+    int v13435 = v13434 + 1;
+    int v13436 = v13435 + 1;
+    int v13437 = v13436 + 1;
+    int v13438 = v13437 + 1;
+    int v13439 = v13438 + 1;
+    int v13440 = v13439 + 1;
+    int v13441 = v13440 + 1;
+    int v13442 = v13441 + 1;
+    int v13443 = v13442 + 1;
+    int v13444 = v13443 + 1;
+    int v13445 = v13444 + 1;
+    int v13446 = v13445 + 1;
+    int v13447 = v13446 + 1;
+    int v13448 = v13447 + 1;
+    int v13449 = v13448 + 1;
+    int v13450 = v13449 + 1;
+    int v13451 = v13450 + 1;
+    int v13452 = v13451 + 1;
+    int v13453 = v13452 + 1;
+    int v13454 = v13453 + 1;
+    int v13455 = v13454 + 1;
+    int v13456 = v13455 + 1;
+    int v13457 = v13456 + 1;
+    int v13458 = v13457 + 1;
+    int v13459 = v13458 + 1;
+    int v13460 = v13459 + 1;
+    int v13461 = v13460 + 1;
+    int v13462 = v13461 + 1;
+    int v13463 = v13462 + 1;
+    int v13464 = v13463 + 1;
+    int v13465 = v13464 + 1;
+    int v13466 = v13465 + 1;
+    int v13467 = v13466 + 1;
+    int v13468 = v13467 + 1;
+    int v13469 = v13468 + 1;
+    int v13470 = v13469 + 1;
+    int v13471 = v13470 + 1;
+    int v13472 = v13471 + 1;
+    int v13473 = v13472 + 1;
+    int v13474 = v13473 + 1;
+    int v13475 = v13474 + 1;
+    int v13476 = v13475 + 1;
+    int v13477 = v13476 + 1;
+    int v13478 = v13477 + 1;
+    int v13479 = v13478 + 1;
+    int v13480 = v13479 + 1;
+    int v13481 = v13480 + 1;
+    int v13482 = v13481 + 1;
+    int v13483 = v13482 + 1;
+    int v13484 = v13483 + 1;
+    int v13485 = v13484 + 1;
+    int v13486 = v13485 + 1;
+    int v13487 = v13486 + 1;
+    int v13488 = v13487 + 1;
+    int v13489 = v13488 + 1;
+    int v13490 = v13489 + 1;
+    int v13491 = v13490 + 1;
+    int v13492 = v13491 + 1;
+    int v13493 = v13492 + 1;
+    int v13494 = v13493 + 1;
+    int v13495 = v13494 + 1;
+    int v13496 = v13495 + 1;
+    int v13497 = v13496 + 1;
+    int v13498 = v13497 + 1;
+    int v13499 = v13498 + 1;
+    int v13500 = v13499 + 1;
+    int v13501 = v13500 + 1;
+    int v13502 = v13501 + 1;
+    int v13503 = v13502 + 1;
+    int v13504 = v13503 + 1;
+    int v13505 = v13504 + 1;
+    int v13506 = v13505 + 1;
+    int v13507 = v13506 + 1;
+    int v13508 = v13507 + 1;
+    int v13509 = v13508 + 1;
+    int v13510 = v13509 + 1;
+    int v13511 = v13510 + 1;
+    int v13512 = v13511 + 1;
+    int v13513 = v13512 + 1;
+    int v13514 = v13513 + 1;
+    int v13515 = v13514 + 1;
+    int v13516 = v13515 + 1;
+    int v13517 = v13516 + 1;
+    int v13518 = v13517 + 1;
+    int v13519 = v13518 + 1;
+    int v13520 = v13519 + 1;
+    int v13521 = v13520 + 1;
+    int v13522 = v13521 + 1;
+    int v13523 = v13522 + 1;
+    int v13524 = v13523 + 1;
+    int v13525 = v13524 + 1;
+    int v13526 = v13525 + 1;
+    int v13527 = v13526 + 1;
+    int v13528 = v13527 + 1;
+    int v13529 = v13528 + 1;
+    int v13530 = v13529 + 1;
+    int v13531 = v13530 + 1;
+    int v13532 = v13531 + 1;
+    int v13533 = v13532 + 1;
+    int v13534 = v13533 + 1;
+    int v13535 = v13534 + 1;
+    int v13536 = v13535 + 1;
+    int v13537 = v13536 + 1;
+    int v13538 = v13537 + 1;
+    int v13539 = v13538 + 1;
+    int v13540 = v13539 + 1;
+    int v13541 = v13540 + 1;
+    int v13542 = v13541 + 1;
+    int v13543 = v13542 + 1;
+    int v13544 = v13543 + 1;
+    int v13545 = v13544 + 1;
+    int v13546 = v13545 + 1;
+    int v13547 = v13546 + 1;
+    int v13548 = v13547 + 1;
+    int v13549 = v13548 + 1;
+    int v13550 = v13549 + 1;
+    int v13551 = v13550 + 1;
+    int v13552 = v13551 + 1;
+    int v13553 = v13552 + 1;
+    int v13554 = v13553 + 1;
+    int v13555 = v13554 + 1;
+    int v13556 = v13555 + 1;
+    int v13557 = v13556 + 1;
+    int v13558 = v13557 + 1;
+    int v13559 = v13558 + 1;
+    int v13560 = v13559 + 1;
+    int v13561 = v13560 + 1;
+    int v13562 = v13561 + 1;
+    int v13563 = v13562 + 1;
+    int v13564 = v13563 + 1;
+    int v13565 = v13564 + 1;
+    int v13566 = v13565 + 1;
+    int v13567 = v13566 + 1;
+    int v13568 = v13567 + 1;
+    int v13569 = v13568 + 1;
+    int v13570 = v13569 + 1;
+    int v13571 = v13570 + 1;
+    int v13572 = v13571 + 1;
+    int v13573 = v13572 + 1;
+    int v13574 = v13573 + 1;
+    int v13575 = v13574 + 1;
+    int v13576 = v13575 + 1;
+    int v13577 = v13576 + 1;
+    int v13578 = v13577 + 1;
+    int v13579 = v13578 + 1;
+    int v13580 = v13579 + 1;
+    int v13581 = v13580 + 1;
+    int v13582 = v13581 + 1;
+    int v13583 = v13582 + 1;
+    int v13584 = v13583 + 1;
+    int v13585 = v13584 + 1;
+    int v13586 = v13585 + 1;
+    int v13587 = v13586 + 1;
+    int v13588 = v13587 + 1;
+    int v13589 = v13588 + 1;
+    int v13590 = v13589 + 1;
+    int v13591 = v13590 + 1;
+    int v13592 = v13591 + 1;
+    int v13593 = v13592 + 1;
+    int v13594 = v13593 + 1;
+    int v13595 = v13594 + 1;
+    int v13596 = v13595 + 1;
+    int v13597 = v13596 + 1;
+    int v13598 = v13597 + 1;
+    int v13599 = v13598 + 1;
+    int v13600 = v13599 + 1;
+    int v13601 = v13600 + 1;
+    int v13602 = v13601 + 1;
+    int v13603 = v13602 + 1;
+    int v13604 = v13603 + 1;
+    int v13605 = v13604 + 1;
+    int v13606 = v13605 + 1;
+    int v13607 = v13606 + 1;
+    int v13608 = v13607 + 1;
+    int v13609 = v13608 + 1;
+    int v13610 = v13609 + 1;
+    int v13611 = v13610 + 1;
+    int v13612 = v13611 + 1;
+    int v13613 = v13612 + 1;
+    int v13614 = v13613 + 1;
+    int v13615 = v13614 + 1;
+    int v13616 = v13615 + 1;
+    int v13617 = v13616 + 1;
+    int v13618 = v13617 + 1;
+    int v13619 = v13618 + 1;
+    int v13620 = v13619 + 1;
+    int v13621 = v13620 + 1;
+    int v13622 = v13621 + 1;
+    int v13623 = v13622 + 1;
+    int v13624 = v13623 + 1;
+    int v13625 = v13624 + 1;
+    int v13626 = v13625 + 1;
+    int v13627 = v13626 + 1;
+    int v13628 = v13627 + 1;
+    int v13629 = v13628 + 1;
+    int v13630 = v13629 + 1;
+    int v13631 = v13630 + 1;
+    int v13632 = v13631 + 1;
+    int v13633 = v13632 + 1;
+    int v13634 = v13633 + 1;
+    int v13635 = v13634 + 1;
+    int v13636 = v13635 + 1;
+    int v13637 = v13636 + 1;
+    int v13638 = v13637 + 1;
+    int v13639 = v13638 + 1;
+    int v13640 = v13639 + 1;
+    int v13641 = v13640 + 1;
+    int v13642 = v13641 + 1;
+    int v13643 = v13642 + 1;
+    int v13644 = v13643 + 1;
+    int v13645 = v13644 + 1;
+    int v13646 = v13645 + 1;
+    int v13647 = v13646 + 1;
+    int v13648 = v13647 + 1;
+    int v13649 = v13648 + 1;
+    int v13650 = v13649 + 1;
+    int v13651 = v13650 + 1;
+    int v13652 = v13651 + 1;
+    int v13653 = v13652 + 1;
+    int v13654 = v13653 + 1;
+    int v13655 = v13654 + 1;
+    int v13656 = v13655 + 1;
+    int v13657 = v13656 + 1;
+    int v13658 = v13657 + 1;
+    int v13659 = v13658 + 1;
+    int v13660 = v13659 + 1;
+    int v13661 = v13660 + 1;
+    int v13662 = v13661 + 1;
+    int v13663 = v13662 + 1;
+    int v13664 = v13663 + 1;
+    int v13665 = v13664 + 1;
+    int v13666 = v13665 + 1;
+    int v13667 = v13666 + 1;
+    int v13668 = v13667 + 1;
+    int v13669 = v13668 + 1;
+    int v13670 = v13669 + 1;
+    int v13671 = v13670 + 1;
+    int v13672 = v13671 + 1;
+    int v13673 = v13672 + 1;
+    int v13674 = v13673 + 1;
+    int v13675 = v13674 + 1;
+    int v13676 = v13675 + 1;
+    int v13677 = v13676 + 1;
+    int v13678 = v13677 + 1;
+    int v13679 = v13678 + 1;
+    int v13680 = v13679 + 1;
+    int v13681 = v13680 + 1;
+    int v13682 = v13681 + 1;
+    int v13683 = v13682 + 1;
+    int v13684 = v13683 + 1;
+    int v13685 = v13684 + 1;
+    int v13686 = v13685 + 1;
+    int v13687 = v13686 + 1;
+    int v13688 = v13687 + 1;
+    int v13689 = v13688 + 1;
+    int v13690 = v13689 + 1;
+    int v13691 = v13690 + 1;
+    int v13692 = v13691 + 1;
+    int v13693 = v13692 + 1;
+    int v13694 = v13693 + 1;
+    int v13695 = v13694 + 1;
+    int v13696 = v13695 + 1;
+    int v13697 = v13696 + 1;
+    int v13698 = v13697 + 1;
+    int v13699 = v13698 + 1;
+    int v13700 = v13699 + 1;
+    int v13701 = v13700 + 1;
+    int v13702 = v13701 + 1;
+    int v13703 = v13702 + 1;
+    int v13704 = v13703 + 1;
+    int v13705 = v13704 + 1;
+    int v13706 = v13705 + 1;
+    int v13707 = v13706 + 1;
+    int v13708 = v13707 + 1;
+    int v13709 = v13708 + 1;
+    int v13710 = v13709 + 1;
+    int v13711 = v13710 + 1;
+    int v13712 = v13711 + 1;
+    int v13713 = v13712 + 1;
+    int v13714 = v13713 + 1;
+    int v13715 = v13714 + 1;
+    int v13716 = v13715 + 1;
+    int v13717 = v13716 + 1;
+    int v13718 = v13717 + 1;
+    int v13719 = v13718 + 1;
+    int v13720 = v13719 + 1;
+    int v13721 = v13720 + 1;
+    int v13722 = v13721 + 1;
+    int v13723 = v13722 + 1;
+    int v13724 = v13723 + 1;
+    int v13725 = v13724 + 1;
+    int v13726 = v13725 + 1;
+    int v13727 = v13726 + 1;
+    int v13728 = v13727 + 1;
+    int v13729 = v13728 + 1;
+    int v13730 = v13729 + 1;
+    int v13731 = v13730 + 1;
+    int v13732 = v13731 + 1;
+    int v13733 = v13732 + 1;
+    int v13734 = v13733 + 1;
+    int v13735 = v13734 + 1;
+    int v13736 = v13735 + 1;
+    int v13737 = v13736 + 1;
+    int v13738 = v13737 + 1;
+    int v13739 = v13738 + 1;
+    int v13740 = v13739 + 1;
+    int v13741 = v13740 + 1;
+    int v13742 = v13741 + 1;
+    int v13743 = v13742 + 1;
+    int v13744 = v13743 + 1;
+    int v13745 = v13744 + 1;
+    int v13746 = v13745 + 1;
+    int v13747 = v13746 + 1;
+    int v13748 = v13747 + 1;
+    int v13749 = v13748 + 1;
+    int v13750 = v13749 + 1;
+    int v13751 = v13750 + 1;
+    int v13752 = v13751 + 1;
+    int v13753 = v13752 + 1;
+    int v13754 = v13753 + 1;
+    int v13755 = v13754 + 1;
+    int v13756 = v13755 + 1;
+    int v13757 = v13756 + 1;
+    int v13758 = v13757 + 1;
+    int v13759 = v13758 + 1;
+    int v13760 = v13759 + 1;
+    int v13761 = v13760 + 1;
+    int v13762 = v13761 + 1;
+    int v13763 = v13762 + 1;
+    int v13764 = v13763 + 1;
+    int v13765 = v13764 + 1;
+    int v13766 = v13765 + 1;
+    int v13767 = v13766 + 1;
+    int v13768 = v13767 + 1;
+    int v13769 = v13768 + 1;
+    int v13770 = v13769 + 1;
+    int v13771 = v13770 + 1;
+    int v13772 = v13771 + 1;
+    int v13773 = v13772 + 1;
+    int v13774 = v13773 + 1;
+    int v13775 = v13774 + 1;
+    int v13776 = v13775 + 1;
+    int v13777 = v13776 + 1;
+    int v13778 = v13777 + 1;
+    int v13779 = v13778 + 1;
+    int v13780 = v13779 + 1;
+    int v13781 = v13780 + 1;
+    int v13782 = v13781 + 1;
+    int v13783 = v13782 + 1;
+    int v13784 = v13783 + 1;
+    int v13785 = v13784 + 1;
+    int v13786 = v13785 + 1;
+    int v13787 = v13786 + 1;
+    int v13788 = v13787 + 1;
+    int v13789 = v13788 + 1;
+    int v13790 = v13789 + 1;
+    int v13791 = v13790 + 1;
+    int v13792 = v13791 + 1;
+    int v13793 = v13792 + 1;
+    int v13794 = v13793 + 1;
+    int v13795 = v13794 + 1;
+    int v13796 = v13795 + 1;
+    int v13797 = v13796 + 1;
+    int v13798 = v13797 + 1;
+    int v13799 = v13798 + 1;
+    int v13800 = v13799 + 1;
+    int v13801 = v13800 + 1;
+    int v13802 = v13801 + 1;
+    int v13803 = v13802 + 1;
+    int v13804 = v13803 + 1;
+    int v13805 = v13804 + 1;
+    int v13806 = v13805 + 1;
+    int v13807 = v13806 + 1;
+    int v13808 = v13807 + 1;
+    int v13809 = v13808 + 1;
+    int v13810 = v13809 + 1;
+    int v13811 = v13810 + 1;
+    int v13812 = v13811 + 1;
+    int v13813 = v13812 + 1;
+    int v13814 = v13813 + 1;
+    int v13815 = v13814 + 1;
+    int v13816 = v13815 + 1;
+    int v13817 = v13816 + 1;
+    int v13818 = v13817 + 1;
+    int v13819 = v13818 + 1;
+    int v13820 = v13819 + 1;
+    int v13821 = v13820 + 1;
+    int v13822 = v13821 + 1;
+    int v13823 = v13822 + 1;
+    int v13824 = v13823 + 1;
+    int v13825 = v13824 + 1;
+    int v13826 = v13825 + 1;
+    int v13827 = v13826 + 1;
+    int v13828 = v13827 + 1;
+    int v13829 = v13828 + 1;
+    int v13830 = v13829 + 1;
+    int v13831 = v13830 + 1;
+    int v13832 = v13831 + 1;
+    int v13833 = v13832 + 1;
+    int v13834 = v13833 + 1;
+    int v13835 = v13834 + 1;
+    int v13836 = v13835 + 1;
+    int v13837 = v13836 + 1;
+    int v13838 = v13837 + 1;
+    int v13839 = v13838 + 1;
+    int v13840 = v13839 + 1;
+    int v13841 = v13840 + 1;
+    int v13842 = v13841 + 1;
+    int v13843 = v13842 + 1;
+    int v13844 = v13843 + 1;
+    int v13845 = v13844 + 1;
+    int v13846 = v13845 + 1;
+    int v13847 = v13846 + 1;
+    int v13848 = v13847 + 1;
+    int v13849 = v13848 + 1;
+    int v13850 = v13849 + 1;
+    int v13851 = v13850 + 1;
+    int v13852 = v13851 + 1;
+    int v13853 = v13852 + 1;
+    int v13854 = v13853 + 1;
+    int v13855 = v13854 + 1;
+    int v13856 = v13855 + 1;
+    int v13857 = v13856 + 1;
+    int v13858 = v13857 + 1;
+    int v13859 = v13858 + 1;
+    int v13860 = v13859 + 1;
+    int v13861 = v13860 + 1;
+    int v13862 = v13861 + 1;
+    int v13863 = v13862 + 1;
+    int v13864 = v13863 + 1;
+    int v13865 = v13864 + 1;
+    int v13866 = v13865 + 1;
+    int v13867 = v13866 + 1;
+    int v13868 = v13867 + 1;
+    int v13869 = v13868 + 1;
+    int v13870 = v13869 + 1;
+    int v13871 = v13870 + 1;
+    int v13872 = v13871 + 1;
+    int v13873 = v13872 + 1;
+    int v13874 = v13873 + 1;
+    int v13875 = v13874 + 1;
+    int v13876 = v13875 + 1;
+    int v13877 = v13876 + 1;
+    int v13878 = v13877 + 1;
+    int v13879 = v13878 + 1;
+    int v13880 = v13879 + 1;
+    int v13881 = v13880 + 1;
+    int v13882 = v13881 + 1;
+    int v13883 = v13882 + 1;
+    int v13884 = v13883 + 1;
+    int v13885 = v13884 + 1;
+    int v13886 = v13885 + 1;
+    int v13887 = v13886 + 1;
+    int v13888 = v13887 + 1;
+    int v13889 = v13888 + 1;
+    int v13890 = v13889 + 1;
+    int v13891 = v13890 + 1;
+    int v13892 = v13891 + 1;
+    int v13893 = v13892 + 1;
+    int v13894 = v13893 + 1;
+    int v13895 = v13894 + 1;
+    int v13896 = v13895 + 1;
+    int v13897 = v13896 + 1;
+    int v13898 = v13897 + 1;
+    int v13899 = v13898 + 1;
+    int v13900 = v13899 + 1;
+    int v13901 = v13900 + 1;
+    int v13902 = v13901 + 1;
+    int v13903 = v13902 + 1;
+    int v13904 = v13903 + 1;
+    int v13905 = v13904 + 1;
+    int v13906 = v13905 + 1;
+    int v13907 = v13906 + 1;
+    int v13908 = v13907 + 1;
+    int v13909 = v13908 + 1;
+    int v13910 = v13909 + 1;
+    int v13911 = v13910 + 1;
+    int v13912 = v13911 + 1;
+    int v13913 = v13912 + 1;
+    int v13914 = v13913 + 1;
+    int v13915 = v13914 + 1;
+    int v13916 = v13915 + 1;
+    int v13917 = v13916 + 1;
+    int v13918 = v13917 + 1;
+    int v13919 = v13918 + 1;
+    int v13920 = v13919 + 1;
+    int v13921 = v13920 + 1;
+    int v13922 = v13921 + 1;
+    int v13923 = v13922 + 1;
+    int v13924 = v13923 + 1;
+    int v13925 = v13924 + 1;
+    int v13926 = v13925 + 1;
+    int v13927 = v13926 + 1;
+    int v13928 = v13927 + 1;
+    int v13929 = v13928 + 1;
+    int v13930 = v13929 + 1;
+    int v13931 = v13930 + 1;
+    int v13932 = v13931 + 1;
+    int v13933 = v13932 + 1;
+    int v13934 = v13933 + 1;
+    int v13935 = v13934 + 1;
+    int v13936 = v13935 + 1;
+    int v13937 = v13936 + 1;
+    int v13938 = v13937 + 1;
+    int v13939 = v13938 + 1;
+    int v13940 = v13939 + 1;
+    int v13941 = v13940 + 1;
+    int v13942 = v13941 + 1;
+    int v13943 = v13942 + 1;
+    int v13944 = v13943 + 1;
+    int v13945 = v13944 + 1;
+    int v13946 = v13945 + 1;
+    int v13947 = v13946 + 1;
+    int v13948 = v13947 + 1;
+    int v13949 = v13948 + 1;
+    int v13950 = v13949 + 1;
+    int v13951 = v13950 + 1;
+    int v13952 = v13951 + 1;
+    int v13953 = v13952 + 1;
+    int v13954 = v13953 + 1;
+    int v13955 = v13954 + 1;
+    int v13956 = v13955 + 1;
+    int v13957 = v13956 + 1;
+    int v13958 = v13957 + 1;
+    int v13959 = v13958 + 1;
+    int v13960 = v13959 + 1;
+    int v13961 = v13960 + 1;
+    int v13962 = v13961 + 1;
+    int v13963 = v13962 + 1;
+    int v13964 = v13963 + 1;
+    int v13965 = v13964 + 1;
+    int v13966 = v13965 + 1;
+    int v13967 = v13966 + 1;
+    int v13968 = v13967 + 1;
+    int v13969 = v13968 + 1;
+    int v13970 = v13969 + 1;
+    int v13971 = v13970 + 1;
+    int v13972 = v13971 + 1;
+    int v13973 = v13972 + 1;
+    int v13974 = v13973 + 1;
+    int v13975 = v13974 + 1;
+    int v13976 = v13975 + 1;
+    int v13977 = v13976 + 1;
+    int v13978 = v13977 + 1;
+    int v13979 = v13978 + 1;
+    int v13980 = v13979 + 1;
+    int v13981 = v13980 + 1;
+    int v13982 = v13981 + 1;
+    int v13983 = v13982 + 1;
+    int v13984 = v13983 + 1;
+    int v13985 = v13984 + 1;
+    int v13986 = v13985 + 1;
+    int v13987 = v13986 + 1;
+    int v13988 = v13987 + 1;
+    int v13989 = v13988 + 1;
+    int v13990 = v13989 + 1;
+    int v13991 = v13990 + 1;
+    int v13992 = v13991 + 1;
+    int v13993 = v13992 + 1;
+    int v13994 = v13993 + 1;
+    int v13995 = v13994 + 1;
+    int v13996 = v13995 + 1;
+    int v13997 = v13996 + 1;
+    int v13998 = v13997 + 1;
+    int v13999 = v13998 + 1;
+    int v14000 = v13999 + 1;
+    int v14001 = v14000 + 1;
+    int v14002 = v14001 + 1;
+    int v14003 = v14002 + 1;
+    int v14004 = v14003 + 1;
+    int v14005 = v14004 + 1;
+    int v14006 = v14005 + 1;
+    int v14007 = v14006 + 1;
+    int v14008 = v14007 + 1;
+    int v14009 = v14008 + 1;
+    int v14010 = v14009 + 1;
+    int v14011 = v14010 + 1;
+    int v14012 = v14011 + 1;
+    int v14013 = v14012 + 1;
+    int v14014 = v14013 + 1;
+    int v14015 = v14014 + 1;
+    int v14016 = v14015 + 1;
+    int v14017 = v14016 + 1;
+    int v14018 = v14017 + 1;
+    int v14019 = v14018 + 1;
+    int v14020 = v14019 + 1;
+    int v14021 = v14020 + 1;
+    int v14022 = v14021 + 1;
+    int v14023 = v14022 + 1;
+    int v14024 = v14023 + 1;
+    int v14025 = v14024 + 1;
+    int v14026 = v14025 + 1;
+    int v14027 = v14026 + 1;
+    int v14028 = v14027 + 1;
+    int v14029 = v14028 + 1;
+    int v14030 = v14029 + 1;
+    int v14031 = v14030 + 1;
+    int v14032 = v14031 + 1;
+    int v14033 = v14032 + 1;
+    int v14034 = v14033 + 1;
+    int v14035 = v14034 + 1;
+    int v14036 = v14035 + 1;
+    int v14037 = v14036 + 1;
+    int v14038 = v14037 + 1;
+    int v14039 = v14038 + 1;
+    int v14040 = v14039 + 1;
+    int v14041 = v14040 + 1;
+    int v14042 = v14041 + 1;
+    int v14043 = v14042 + 1;
+    int v14044 = v14043 + 1;
+    int v14045 = v14044 + 1;
+    int v14046 = v14045 + 1;
+    int v14047 = v14046 + 1;
+    int v14048 = v14047 + 1;
+    int v14049 = v14048 + 1;
+    int v14050 = v14049 + 1;
+    int v14051 = v14050 + 1;
+    int v14052 = v14051 + 1;
+    int v14053 = v14052 + 1;
+    int v14054 = v14053 + 1;
+    int v14055 = v14054 + 1;
+    int v14056 = v14055 + 1;
+    int v14057 = v14056 + 1;
+    int v14058 = v14057 + 1;
+    int v14059 = v14058 + 1;
+    int v14060 = v14059 + 1;
+    int v14061 = v14060 + 1;
+    int v14062 = v14061 + 1;
+    int v14063 = v14062 + 1;
+    int v14064 = v14063 + 1;
+    int v14065 = v14064 + 1;
+    int v14066 = v14065 + 1;
+    int v14067 = v14066 + 1;
+    int v14068 = v14067 + 1;
+    int v14069 = v14068 + 1;
+    int v14070 = v14069 + 1;
+    int v14071 = v14070 + 1;
+    int v14072 = v14071 + 1;
+    int v14073 = v14072 + 1;
+    int v14074 = v14073 + 1;
+    int v14075 = v14074 + 1;
+    int v14076 = v14075 + 1;
+    int v14077 = v14076 + 1;
+    int v14078 = v14077 + 1;
+    int v14079 = v14078 + 1;
+    int v14080 = v14079 + 1;
+    int v14081 = v14080 + 1;
+    int v14082 = v14081 + 1;
+    int v14083 = v14082 + 1;
+    int v14084 = v14083 + 1;
+    int v14085 = v14084 + 1;
+    int v14086 = v14085 + 1;
+    int v14087 = v14086 + 1;
+    int v14088 = v14087 + 1;
+    int v14089 = v14088 + 1;
+    int v14090 = v14089 + 1;
+    int v14091 = v14090 + 1;
+    int v14092 = v14091 + 1;
+    int v14093 = v14092 + 1;
+    int v14094 = v14093 + 1;
+    int v14095 = v14094 + 1;
+    int v14096 = v14095 + 1;
+    int v14097 = v14096 + 1;
+    int v14098 = v14097 + 1;
+    int v14099 = v14098 + 1;
+    int v14100 = v14099 + 1;
+    int v14101 = v14100 + 1;
+    int v14102 = v14101 + 1;
+    int v14103 = v14102 + 1;
+    int v14104 = v14103 + 1;
+    int v14105 = v14104 + 1;
+    int v14106 = v14105 + 1;
+    int v14107 = v14106 + 1;
+    int v14108 = v14107 + 1;
+    int v14109 = v14108 + 1;
+    int v14110 = v14109 + 1;
+    int v14111 = v14110 + 1;
+    int v14112 = v14111 + 1;
+    int v14113 = v14112 + 1;
+    int v14114 = v14113 + 1;
+    int v14115 = v14114 + 1;
+    int v14116 = v14115 + 1;
+    int v14117 = v14116 + 1;
+    int v14118 = v14117 + 1;
+    int v14119 = v14118 + 1;
+    int v14120 = v14119 + 1;
+    int v14121 = v14120 + 1;
+    int v14122 = v14121 + 1;
+    int v14123 = v14122 + 1;
+    int v14124 = v14123 + 1;
+    int v14125 = v14124 + 1;
+    int v14126 = v14125 + 1;
+    int v14127 = v14126 + 1;
+    int v14128 = v14127 + 1;
+    int v14129 = v14128 + 1;
+    int v14130 = v14129 + 1;
+    int v14131 = v14130 + 1;
+    int v14132 = v14131 + 1;
+    int v14133 = v14132 + 1;
+    int v14134 = v14133 + 1;
+    int v14135 = v14134 + 1;
+    int v14136 = v14135 + 1;
+    int v14137 = v14136 + 1;
+    int v14138 = v14137 + 1;
+    int v14139 = v14138 + 1;
+    int v14140 = v14139 + 1;
+    int v14141 = v14140 + 1;
+    int v14142 = v14141 + 1;
+    int v14143 = v14142 + 1;
+    int v14144 = v14143 + 1;
+    int v14145 = v14144 + 1;
+    int v14146 = v14145 + 1;
+    int v14147 = v14146 + 1;
+    int v14148 = v14147 + 1;
+    int v14149 = v14148 + 1;
+    int v14150 = v14149 + 1;
+    int v14151 = v14150 + 1;
+    int v14152 = v14151 + 1;
+    int v14153 = v14152 + 1;
+    int v14154 = v14153 + 1;
+    int v14155 = v14154 + 1;
+    int v14156 = v14155 + 1;
+    int v14157 = v14156 + 1;
+    int v14158 = v14157 + 1;
+    int v14159 = v14158 + 1;
+    int v14160 = v14159 + 1;
+    int v14161 = v14160 + 1;
+    int v14162 = v14161 + 1;
+    int v14163 = v14162 + 1;
+    int v14164 = v14163 + 1;
+    int v14165 = v14164 + 1;
+    int v14166 = v14165 + 1;
+    int v14167 = v14166 + 1;
+    int v14168 = v14167 + 1;
+    int v14169 = v14168 + 1;
+    int v14170 = v14169 + 1;
+    int v14171 = v14170 + 1;
+    int v14172 = v14171 + 1;
+    int v14173 = v14172 + 1;
+    int v14174 = v14173 + 1;
+    int v14175 = v14174 + 1;
+    int v14176 = v14175 + 1;
+    int v14177 = v14176 + 1;
+    int v14178 = v14177 + 1;
+    int v14179 = v14178 + 1;
+    int v14180 = v14179 + 1;
+    int v14181 = v14180 + 1;
+    int v14182 = v14181 + 1;
+    int v14183 = v14182 + 1;
+    int v14184 = v14183 + 1;
+    int v14185 = v14184 + 1;
+    int v14186 = v14185 + 1;
+    int v14187 = v14186 + 1;
+    int v14188 = v14187 + 1;
+    int v14189 = v14188 + 1;
+    int v14190 = v14189 + 1;
+    int v14191 = v14190 + 1;
+    int v14192 = v14191 + 1;
+    int v14193 = v14192 + 1;
+    int v14194 = v14193 + 1;
+    int v14195 = v14194 + 1;
+    int v14196 = v14195 + 1;
+    int v14197 = v14196 + 1;
+    int v14198 = v14197 + 1;
+    int v14199 = v14198 + 1;
+    int v14200 = v14199 + 1;
+    int v14201 = v14200 + 1;
+    int v14202 = v14201 + 1;
+    int v14203 = v14202 + 1;
+    int v14204 = v14203 + 1;
+    int v14205 = v14204 + 1;
+    int v14206 = v14205 + 1;
+    int v14207 = v14206 + 1;
+    int v14208 = v14207 + 1;
+    int v14209 = v14208 + 1;
+    int v14210 = v14209 + 1;
+    int v14211 = v14210 + 1;
+    int v14212 = v14211 + 1;
+    int v14213 = v14212 + 1;
+    int v14214 = v14213 + 1;
+    int v14215 = v14214 + 1;
+    int v14216 = v14215 + 1;
+    int v14217 = v14216 + 1;
+    int v14218 = v14217 + 1;
+    int v14219 = v14218 + 1;
+    int v14220 = v14219 + 1;
+    int v14221 = v14220 + 1;
+    int v14222 = v14221 + 1;
+    int v14223 = v14222 + 1;
+    int v14224 = v14223 + 1;
+    int v14225 = v14224 + 1;
+    int v14226 = v14225 + 1;
+    int v14227 = v14226 + 1;
+    int v14228 = v14227 + 1;
+    int v14229 = v14228 + 1;
+    int v14230 = v14229 + 1;
+    int v14231 = v14230 + 1;
+    int v14232 = v14231 + 1;
+    int v14233 = v14232 + 1;
+    int v14234 = v14233 + 1;
+    int v14235 = v14234 + 1;
+    int v14236 = v14235 + 1;
+    int v14237 = v14236 + 1;
+    int v14238 = v14237 + 1;
+    int v14239 = v14238 + 1;
+    int v14240 = v14239 + 1;
+    int v14241 = v14240 + 1;
+    int v14242 = v14241 + 1;
+    int v14243 = v14242 + 1;
+    int v14244 = v14243 + 1;
+    int v14245 = v14244 + 1;
+    int v14246 = v14245 + 1;
+    int v14247 = v14246 + 1;
+    int v14248 = v14247 + 1;
+    int v14249 = v14248 + 1;
+    int v14250 = v14249 + 1;
+    int v14251 = v14250 + 1;
+    int v14252 = v14251 + 1;
+    int v14253 = v14252 + 1;
+    int v14254 = v14253 + 1;
+    int v14255 = v14254 + 1;
+    int v14256 = v14255 + 1;
+    int v14257 = v14256 + 1;
+    int v14258 = v14257 + 1;
+    int v14259 = v14258 + 1;
+    int v14260 = v14259 + 1;
+    int v14261 = v14260 + 1;
+    int v14262 = v14261 + 1;
+    int v14263 = v14262 + 1;
+    int v14264 = v14263 + 1;
+    int v14265 = v14264 + 1;
+    int v14266 = v14265 + 1;
+    int v14267 = v14266 + 1;
+    int v14268 = v14267 + 1;
+    int v14269 = v14268 + 1;
+    int v14270 = v14269 + 1;
+    int v14271 = v14270 + 1;
+    int v14272 = v14271 + 1;
+    int v14273 = v14272 + 1;
+    int v14274 = v14273 + 1;
+    int v14275 = v14274 + 1;
+    int v14276 = v14275 + 1;
+    int v14277 = v14276 + 1;
+    int v14278 = v14277 + 1;
+    int v14279 = v14278 + 1;
+    int v14280 = v14279 + 1;
+    int v14281 = v14280 + 1;
+    int v14282 = v14281 + 1;
+    int v14283 = v14282 + 1;
+    int v14284 = v14283 + 1;
+    int v14285 = v14284 + 1;
+    int v14286 = v14285 + 1;
+    int v14287 = v14286 + 1;
+    int v14288 = v14287 + 1;
+    int v14289 = v14288 + 1;
+    int v14290 = v14289 + 1;
+    int v14291 = v14290 + 1;
+    int v14292 = v14291 + 1;
+    int v14293 = v14292 + 1;
+    int v14294 = v14293 + 1;
+    int v14295 = v14294 + 1;
+    int v14296 = v14295 + 1;
+    int v14297 = v14296 + 1;
+    int v14298 = v14297 + 1;
+    int v14299 = v14298 + 1;
+    int v14300 = v14299 + 1;
+    int v14301 = v14300 + 1;
+    int v14302 = v14301 + 1;
+    int v14303 = v14302 + 1;
+    int v14304 = v14303 + 1;
+    int v14305 = v14304 + 1;
+    int v14306 = v14305 + 1;
+    int v14307 = v14306 + 1;
+    int v14308 = v14307 + 1;
+    int v14309 = v14308 + 1;
+    int v14310 = v14309 + 1;
+    int v14311 = v14310 + 1;
+    int v14312 = v14311 + 1;
+    int v14313 = v14312 + 1;
+    int v14314 = v14313 + 1;
+    int v14315 = v14314 + 1;
+    int v14316 = v14315 + 1;
+    int v14317 = v14316 + 1;
+    int v14318 = v14317 + 1;
+    int v14319 = v14318 + 1;
+    int v14320 = v14319 + 1;
+    int v14321 = v14320 + 1;
+    int v14322 = v14321 + 1;
+    int v14323 = v14322 + 1;
+    int v14324 = v14323 + 1;
+    int v14325 = v14324 + 1;
+    int v14326 = v14325 + 1;
+    int v14327 = v14326 + 1;
+    int v14328 = v14327 + 1;
+    int v14329 = v14328 + 1;
+    int v14330 = v14329 + 1;
+    int v14331 = v14330 + 1;
+    int v14332 = v14331 + 1;
+    int v14333 = v14332 + 1;
+    int v14334 = v14333 + 1;
+    int v14335 = v14334 + 1;
+    int v14336 = v14335 + 1;
+    int v14337 = v14336 + 1;
+    int v14338 = v14337 + 1;
+    int v14339 = v14338 + 1;
+    int v14340 = v14339 + 1;
+    int v14341 = v14340 + 1;
+    int v14342 = v14341 + 1;
+    int v14343 = v14342 + 1;
+    int v14344 = v14343 + 1;
+    int v14345 = v14344 + 1;
+    int v14346 = v14345 + 1;
+    int v14347 = v14346 + 1;
+    int v14348 = v14347 + 1;
+    int v14349 = v14348 + 1;
+    int v14350 = v14349 + 1;
+    int v14351 = v14350 + 1;
+    int v14352 = v14351 + 1;
+    int v14353 = v14352 + 1;
+    int v14354 = v14353 + 1;
+    int v14355 = v14354 + 1;
+    int v14356 = v14355 + 1;
+    int v14357 = v14356 + 1;
+    int v14358 = v14357 + 1;
+    int v14359 = v14358 + 1;
+    int v14360 = v14359 + 1;
+    int v14361 = v14360 + 1;
+    int v14362 = v14361 + 1;
+    int v14363 = v14362 + 1;
+    int v14364 = v14363 + 1;
+    int v14365 = v14364 + 1;
+    int v14366 = v14365 + 1;
+    int v14367 = v14366 + 1;
+    int v14368 = v14367 + 1;
+    int v14369 = v14368 + 1;
+    int v14370 = v14369 + 1;
+    int v14371 = v14370 + 1;
+    int v14372 = v14371 + 1;
+    int v14373 = v14372 + 1;
+    int v14374 = v14373 + 1;
+    int v14375 = v14374 + 1;
+    int v14376 = v14375 + 1;
+    int v14377 = v14376 + 1;
+    int v14378 = v14377 + 1;
+    int v14379 = v14378 + 1;
+    int v14380 = v14379 + 1;
+    int v14381 = v14380 + 1;
+    int v14382 = v14381 + 1;
+    int v14383 = v14382 + 1;
+    int v14384 = v14383 + 1;
+    int v14385 = v14384 + 1;
+    int v14386 = v14385 + 1;
+    int v14387 = v14386 + 1;
+    int v14388 = v14387 + 1;
+    int v14389 = v14388 + 1;
+    int v14390 = v14389 + 1;
+    int v14391 = v14390 + 1;
+    int v14392 = v14391 + 1;
+    int v14393 = v14392 + 1;
+    int v14394 = v14393 + 1;
+    int v14395 = v14394 + 1;
+    int v14396 = v14395 + 1;
+    int v14397 = v14396 + 1;
+    int v14398 = v14397 + 1;
+    int v14399 = v14398 + 1;
+    int v14400 = v14399 + 1;
+    int v14401 = v14400 + 1;
+    int v14402 = v14401 + 1;
+    int v14403 = v14402 + 1;
+    int v14404 = v14403 + 1;
+    int v14405 = v14404 + 1;
+    int v14406 = v14405 + 1;
+    int v14407 = v14406 + 1;
+    int v14408 = v14407 + 1;
+    int v14409 = v14408 + 1;
+    int v14410 = v14409 + 1;
+    int v14411 = v14410 + 1;
+    int v14412 = v14411 + 1;
+    int v14413 = v14412 + 1;
+    int v14414 = v14413 + 1;
+    int v14415 = v14414 + 1;
+    int v14416 = v14415 + 1;
+    int v14417 = v14416 + 1;
+    int v14418 = v14417 + 1;
+    int v14419 = v14418 + 1;
+    int v14420 = v14419 + 1;
+    int v14421 = v14420 + 1;
+    int v14422 = v14421 + 1;
+    int v14423 = v14422 + 1;
+    int v14424 = v14423 + 1;
+    int v14425 = v14424 + 1;
+    int v14426 = v14425 + 1;
+    int v14427 = v14426 + 1;
+    int v14428 = v14427 + 1;
+    int v14429 = v14428 + 1;
+    int v14430 = v14429 + 1;
+    int v14431 = v14430 + 1;
+    int v14432 = v14431 + 1;
+    int v14433 = v14432 + 1;
+    int v14434 = v14433 + 1;
+    int v14435 = v14434 + 1;
+    int v14436 = v14435 + 1;
+    int v14437 = v14436 + 1;
+    int v14438 = v14437 + 1;
+    int v14439 = v14438 + 1;
+    int v14440 = v14439 + 1;
+    int v14441 = v14440 + 1;
+    int v14442 = v14441 + 1;
+    int v14443 = v14442 + 1;
+    int v14444 = v14443 + 1;
+    int v14445 = v14444 + 1;
+    int v14446 = v14445 + 1;
+    int v14447 = v14446 + 1;
+    int v14448 = v14447 + 1;
+    int v14449 = v14448 + 1;
+    int v14450 = v14449 + 1;
+    int v14451 = v14450 + 1;
+    int v14452 = v14451 + 1;
+    int v14453 = v14452 + 1;
+    int v14454 = v14453 + 1;
+    int v14455 = v14454 + 1;
+    int v14456 = v14455 + 1;
+    int v14457 = v14456 + 1;
+    int v14458 = v14457 + 1;
+    int v14459 = v14458 + 1;
+    int v14460 = v14459 + 1;
+    int v14461 = v14460 + 1;
+    int v14462 = v14461 + 1;
+    int v14463 = v14462 + 1;
+    int v14464 = v14463 + 1;
+    int v14465 = v14464 + 1;
+    int v14466 = v14465 + 1;
+    int v14467 = v14466 + 1;
+    int v14468 = v14467 + 1;
+    int v14469 = v14468 + 1;
+    int v14470 = v14469 + 1;
+    int v14471 = v14470 + 1;
+    int v14472 = v14471 + 1;
+    int v14473 = v14472 + 1;
+    int v14474 = v14473 + 1;
+    int v14475 = v14474 + 1;
+    int v14476 = v14475 + 1;
+    int v14477 = v14476 + 1;
+    int v14478 = v14477 + 1;
+    int v14479 = v14478 + 1;
+    int v14480 = v14479 + 1;
+    int v14481 = v14480 + 1;
+    int v14482 = v14481 + 1;
+    int v14483 = v14482 + 1;
+    int v14484 = v14483 + 1;
+    int v14485 = v14484 + 1;
+    int v14486 = v14485 + 1;
+    int v14487 = v14486 + 1;
+    int v14488 = v14487 + 1;
+    int v14489 = v14488 + 1;
+    int v14490 = v14489 + 1;
+    int v14491 = v14490 + 1;
+    int v14492 = v14491 + 1;
+    int v14493 = v14492 + 1;
+    int v14494 = v14493 + 1;
+    int v14495 = v14494 + 1;
+    int v14496 = v14495 + 1;
+    int v14497 = v14496 + 1;
+    int v14498 = v14497 + 1;
+    int v14499 = v14498 + 1;
+    int v14500 = v14499 + 1;
+    int v14501 = v14500 + 1;
+    int v14502 = v14501 + 1;
+    int v14503 = v14502 + 1;
+    int v14504 = v14503 + 1;
+    int v14505 = v14504 + 1;
+    int v14506 = v14505 + 1;
+    int v14507 = v14506 + 1;
+    int v14508 = v14507 + 1;
+    int v14509 = v14508 + 1;
+    int v14510 = v14509 + 1;
+    int v14511 = v14510 + 1;
+    int v14512 = v14511 + 1;
+    int v14513 = v14512 + 1;
+    int v14514 = v14513 + 1;
+    int v14515 = v14514 + 1;
+    int v14516 = v14515 + 1;
+    int v14517 = v14516 + 1;
+    int v14518 = v14517 + 1;
+    int v14519 = v14518 + 1;
+    int v14520 = v14519 + 1;
+    int v14521 = v14520 + 1;
+    int v14522 = v14521 + 1;
+    int v14523 = v14522 + 1;
+    int v14524 = v14523 + 1;
+    int v14525 = v14524 + 1;
+    int v14526 = v14525 + 1;
+    int v14527 = v14526 + 1;
+    int v14528 = v14527 + 1;
+    int v14529 = v14528 + 1;
+    int v14530 = v14529 + 1;
+    int v14531 = v14530 + 1;
+    int v14532 = v14531 + 1;
+    int v14533 = v14532 + 1;
+    int v14534 = v14533 + 1;
+    int v14535 = v14534 + 1;
+    int v14536 = v14535 + 1;
+    int v14537 = v14536 + 1;
+    int v14538 = v14537 + 1;
+    int v14539 = v14538 + 1;
+    int v14540 = v14539 + 1;
+    int v14541 = v14540 + 1;
+    int v14542 = v14541 + 1;
+    int v14543 = v14542 + 1;
+    int v14544 = v14543 + 1;
+    int v14545 = v14544 + 1;
+    int v14546 = v14545 + 1;
+    int v14547 = v14546 + 1;
+    int v14548 = v14547 + 1;
+    int v14549 = v14548 + 1;
+    int v14550 = v14549 + 1;
+    int v14551 = v14550 + 1;
+    int v14552 = v14551 + 1;
+    int v14553 = v14552 + 1;
+    int v14554 = v14553 + 1;
+    int v14555 = v14554 + 1;
+    int v14556 = v14555 + 1;
+    int v14557 = v14556 + 1;
+    int v14558 = v14557 + 1;
+    int v14559 = v14558 + 1;
+    int v14560 = v14559 + 1;
+    int v14561 = v14560 + 1;
+    int v14562 = v14561 + 1;
+    int v14563 = v14562 + 1;
+    int v14564 = v14563 + 1;
+    int v14565 = v14564 + 1;
+    int v14566 = v14565 + 1;
+    int v14567 = v14566 + 1;
+    int v14568 = v14567 + 1;
+    int v14569 = v14568 + 1;
+    int v14570 = v14569 + 1;
+    int v14571 = v14570 + 1;
+    int v14572 = v14571 + 1;
+    int v14573 = v14572 + 1;
+    int v14574 = v14573 + 1;
+    int v14575 = v14574 + 1;
+    int v14576 = v14575 + 1;
+    int v14577 = v14576 + 1;
+    int v14578 = v14577 + 1;
+    int v14579 = v14578 + 1;
+    int v14580 = v14579 + 1;
+    int v14581 = v14580 + 1;
+    int v14582 = v14581 + 1;
+    int v14583 = v14582 + 1;
+    int v14584 = v14583 + 1;
+    int v14585 = v14584 + 1;
+    int v14586 = v14585 + 1;
+    int v14587 = v14586 + 1;
+    int v14588 = v14587 + 1;
+    int v14589 = v14588 + 1;
+    int v14590 = v14589 + 1;
+    int v14591 = v14590 + 1;
+    int v14592 = v14591 + 1;
+    int v14593 = v14592 + 1;
+    int v14594 = v14593 + 1;
+    int v14595 = v14594 + 1;
+    int v14596 = v14595 + 1;
+    int v14597 = v14596 + 1;
+    int v14598 = v14597 + 1;
+    int v14599 = v14598 + 1;
+    int v14600 = v14599 + 1;
+    int v14601 = v14600 + 1;
+    int v14602 = v14601 + 1;
+    int v14603 = v14602 + 1;
+    int v14604 = v14603 + 1;
+    int v14605 = v14604 + 1;
+    int v14606 = v14605 + 1;
+    int v14607 = v14606 + 1;
+    int v14608 = v14607 + 1;
+    int v14609 = v14608 + 1;
+    int v14610 = v14609 + 1;
+    int v14611 = v14610 + 1;
+    int v14612 = v14611 + 1;
+    int v14613 = v14612 + 1;
+    int v14614 = v14613 + 1;
+    int v14615 = v14614 + 1;
+    int v14616 = v14615 + 1;
+    int v14617 = v14616 + 1;
+    int v14618 = v14617 + 1;
+    int v14619 = v14618 + 1;
+    int v14620 = v14619 + 1;
+    int v14621 = v14620 + 1;
+    int v14622 = v14621 + 1;
+    int v14623 = v14622 + 1;
+    int v14624 = v14623 + 1;
+    int v14625 = v14624 + 1;
+    int v14626 = v14625 + 1;
+    int v14627 = v14626 + 1;
+    int v14628 = v14627 + 1;
+    int v14629 = v14628 + 1;
+    int v14630 = v14629 + 1;
+    int v14631 = v14630 + 1;
+    int v14632 = v14631 + 1;
+    int v14633 = v14632 + 1;
+    int v14634 = v14633 + 1;
+    int v14635 = v14634 + 1;
+    int v14636 = v14635 + 1;
+    int v14637 = v14636 + 1;
+    int v14638 = v14637 + 1;
+    int v14639 = v14638 + 1;
+    int v14640 = v14639 + 1;
+    int v14641 = v14640 + 1;
+    int v14642 = v14641 + 1;
+    int v14643 = v14642 + 1;
+    int v14644 = v14643 + 1;
+    int v14645 = v14644 + 1;
+    int v14646 = v14645 + 1;
+    int v14647 = v14646 + 1;
+    int v14648 = v14647 + 1;
+    int v14649 = v14648 + 1;
+    int v14650 = v14649 + 1;
+    int v14651 = v14650 + 1;
+    int v14652 = v14651 + 1;
+    int v14653 = v14652 + 1;
+    int v14654 = v14653 + 1;
+    int v14655 = v14654 + 1;
+    int v14656 = v14655 + 1;
+    int v14657 = v14656 + 1;
+    int v14658 = v14657 + 1;
+    int v14659 = v14658 + 1;
+    int v14660 = v14659 + 1;
+    int v14661 = v14660 + 1;
+    int v14662 = v14661 + 1;
+    int v14663 = v14662 + 1;
+    int v14664 = v14663 + 1;
+    int v14665 = v14664 + 1;
+    int v14666 = v14665 + 1;
+    int v14667 = v14666 + 1;
+    int v14668 = v14667 + 1;
+    int v14669 = v14668 + 1;
+    int v14670 = v14669 + 1;
+    int v14671 = v14670 + 1;
+    int v14672 = v14671 + 1;
+    int v14673 = v14672 + 1;
+    int v14674 = v14673 + 1;
+    int v14675 = v14674 + 1;
+    int v14676 = v14675 + 1;
+    int v14677 = v14676 + 1;
+    int v14678 = v14677 + 1;
+    int v14679 = v14678 + 1;
+    int v14680 = v14679 + 1;
+    int v14681 = v14680 + 1;
+    int v14682 = v14681 + 1;
+    int v14683 = v14682 + 1;
+    int v14684 = v14683 + 1;
+    int v14685 = v14684 + 1;
+    int v14686 = v14685 + 1;
+    int v14687 = v14686 + 1;
+    int v14688 = v14687 + 1;
+    int v14689 = v14688 + 1;
+    int v14690 = v14689 + 1;
+    int v14691 = v14690 + 1;
+    int v14692 = v14691 + 1;
+    int v14693 = v14692 + 1;
+    int v14694 = v14693 + 1;
+    int v14695 = v14694 + 1;
+    int v14696 = v14695 + 1;
+    int v14697 = v14696 + 1;
+    int v14698 = v14697 + 1;
+    int v14699 = v14698 + 1;
+    int v14700 = v14699 + 1;
+    int v14701 = v14700 + 1;
+    int v14702 = v14701 + 1;
+    int v14703 = v14702 + 1;
+    int v14704 = v14703 + 1;
+    int v14705 = v14704 + 1;
+    int v14706 = v14705 + 1;
+    int v14707 = v14706 + 1;
+    int v14708 = v14707 + 1;
+    int v14709 = v14708 + 1;
+    int v14710 = v14709 + 1;
+    int v14711 = v14710 + 1;
+    int v14712 = v14711 + 1;
+    int v14713 = v14712 + 1;
+    int v14714 = v14713 + 1;
+    int v14715 = v14714 + 1;
+    int v14716 = v14715 + 1;
+    int v14717 = v14716 + 1;
+    int v14718 = v14717 + 1;
+    int v14719 = v14718 + 1;
+    int v14720 = v14719 + 1;
+    int v14721 = v14720 + 1;
+    int v14722 = v14721 + 1;
+    int v14723 = v14722 + 1;
+    int v14724 = v14723 + 1;
+    int v14725 = v14724 + 1;
+    int v14726 = v14725 + 1;
+    int v14727 = v14726 + 1;
+    int v14728 = v14727 + 1;
+    int v14729 = v14728 + 1;
+    int v14730 = v14729 + 1;
+    int v14731 = v14730 + 1;
+    int v14732 = v14731 + 1;
+    int v14733 = v14732 + 1;
+    int v14734 = v14733 + 1;
+    int v14735 = v14734 + 1;
+    int v14736 = v14735 + 1;
+    int v14737 = v14736 + 1;
+    int v14738 = v14737 + 1;
+    int v14739 = v14738 + 1;
+    int v14740 = v14739 + 1;
+    int v14741 = v14740 + 1;
+    int v14742 = v14741 + 1;
+    int v14743 = v14742 + 1;
+    int v14744 = v14743 + 1;
+    int v14745 = v14744 + 1;
+    int v14746 = v14745 + 1;
+    int v14747 = v14746 + 1;
+    int v14748 = v14747 + 1;
+    int v14749 = v14748 + 1;
+    int v14750 = v14749 + 1;
+    int v14751 = v14750 + 1;
+    int v14752 = v14751 + 1;
+    int v14753 = v14752 + 1;
+    int v14754 = v14753 + 1;
+    int v14755 = v14754 + 1;
+    int v14756 = v14755 + 1;
+    int v14757 = v14756 + 1;
+    int v14758 = v14757 + 1;
+    int v14759 = v14758 + 1;
+    int v14760 = v14759 + 1;
+    int v14761 = v14760 + 1;
+    int v14762 = v14761 + 1;
+    int v14763 = v14762 + 1;
+    int v14764 = v14763 + 1;
+    int v14765 = v14764 + 1;
+    int v14766 = v14765 + 1;
+    int v14767 = v14766 + 1;
+    int v14768 = v14767 + 1;
+    int v14769 = v14768 + 1;
+    int v14770 = v14769 + 1;
+    int v14771 = v14770 + 1;
+    int v14772 = v14771 + 1;
+    int v14773 = v14772 + 1;
+    int v14774 = v14773 + 1;
+    int v14775 = v14774 + 1;
+    int v14776 = v14775 + 1;
+    int v14777 = v14776 + 1;
+    int v14778 = v14777 + 1;
+    int v14779 = v14778 + 1;
+    int v14780 = v14779 + 1;
+    int v14781 = v14780 + 1;
+    int v14782 = v14781 + 1;
+    int v14783 = v14782 + 1;
+    int v14784 = v14783 + 1;
+    int v14785 = v14784 + 1;
+    int v14786 = v14785 + 1;
+    int v14787 = v14786 + 1;
+    int v14788 = v14787 + 1;
+    int v14789 = v14788 + 1;
+    int v14790 = v14789 + 1;
+    int v14791 = v14790 + 1;
+    int v14792 = v14791 + 1;
+    int v14793 = v14792 + 1;
+    int v14794 = v14793 + 1;
+    int v14795 = v14794 + 1;
+    int v14796 = v14795 + 1;
+    int v14797 = v14796 + 1;
+    int v14798 = v14797 + 1;
+    int v14799 = v14798 + 1;
+    int v14800 = v14799 + 1;
+    int v14801 = v14800 + 1;
+    int v14802 = v14801 + 1;
+    int v14803 = v14802 + 1;
+    int v14804 = v14803 + 1;
+    int v14805 = v14804 + 1;
+    int v14806 = v14805 + 1;
+    int v14807 = v14806 + 1;
+    int v14808 = v14807 + 1;
+    int v14809 = v14808 + 1;
+    int v14810 = v14809 + 1;
+    int v14811 = v14810 + 1;
+    int v14812 = v14811 + 1;
+    int v14813 = v14812 + 1;
+    int v14814 = v14813 + 1;
+    int v14815 = v14814 + 1;
+    int v14816 = v14815 + 1;
+    int v14817 = v14816 + 1;
+    int v14818 = v14817 + 1;
+    int v14819 = v14818 + 1;
+    int v14820 = v14819 + 1;
+    int v14821 = v14820 + 1;
+    int v14822 = v14821 + 1;
+    int v14823 = v14822 + 1;
+    int v14824 = v14823 + 1;
+    int v14825 = v14824 + 1;
+    int v14826 = v14825 + 1;
+    int v14827 = v14826 + 1;
+    int v14828 = v14827 + 1;
+    int v14829 = v14828 + 1;
+    int v14830 = v14829 + 1;
+    int v14831 = v14830 + 1;
+    int v14832 = v14831 + 1;
+    int v14833 = v14832 + 1;
+    int v14834 = v14833 + 1;
+    int v14835 = v14834 + 1;
+    int v14836 = v14835 + 1;
+    int v14837 = v14836 + 1;
+    int v14838 = v14837 + 1;
+    int v14839 = v14838 + 1;
+    int v14840 = v14839 + 1;
+    int v14841 = v14840 + 1;
+    int v14842 = v14841 + 1;
+    int v14843 = v14842 + 1;
+    int v14844 = v14843 + 1;
+    int v14845 = v14844 + 1;
+    int v14846 = v14845 + 1;
+    int v14847 = v14846 + 1;
+    int v14848 = v14847 + 1;
+    int v14849 = v14848 + 1;
+    int v14850 = v14849 + 1;
+    int v14851 = v14850 + 1;
+    int v14852 = v14851 + 1;
+    int v14853 = v14852 + 1;
+    int v14854 = v14853 + 1;
+    int v14855 = v14854 + 1;
+    int v14856 = v14855 + 1;
+    int v14857 = v14856 + 1;
+    int v14858 = v14857 + 1;
+    int v14859 = v14858 + 1;
+    int v14860 = v14859 + 1;
+    int v14861 = v14860 + 1;
+    int v14862 = v14861 + 1;
+    int v14863 = v14862 + 1;
+    int v14864 = v14863 + 1;
+    int v14865 = v14864 + 1;
+    int v14866 = v14865 + 1;
+    int v14867 = v14866 + 1;
+    int v14868 = v14867 + 1;
+    int v14869 = v14868 + 1;
+    int v14870 = v14869 + 1;
+    int v14871 = v14870 + 1;
+    int v14872 = v14871 + 1;
+    int v14873 = v14872 + 1;
+    int v14874 = v14873 + 1;
+    int v14875 = v14874 + 1;
+    int v14876 = v14875 + 1;
+    int v14877 = v14876 + 1;
+    int v14878 = v14877 + 1;
+    int v14879 = v14878 + 1;
+    int v14880 = v14879 + 1;
+    int v14881 = v14880 + 1;
+    int v14882 = v14881 + 1;
+    int v14883 = v14882 + 1;
+    int v14884 = v14883 + 1;
+    int v14885 = v14884 + 1;
+    int v14886 = v14885 + 1;
+    int v14887 = v14886 + 1;
+    int v14888 = v14887 + 1;
+    int v14889 = v14888 + 1;
+    int v14890 = v14889 + 1;
+    int v14891 = v14890 + 1;
+    int v14892 = v14891 + 1;
+    int v14893 = v14892 + 1;
+    int v14894 = v14893 + 1;
+    int v14895 = v14894 + 1;
+    int v14896 = v14895 + 1;
+    int v14897 = v14896 + 1;
+    int v14898 = v14897 + 1;
+    int v14899 = v14898 + 1;
+    int v14900 = v14899 + 1;
+    int v14901 = v14900 + 1;
+    int v14902 = v14901 + 1;
+    int v14903 = v14902 + 1;
+    int v14904 = v14903 + 1;
+    int v14905 = v14904 + 1;
+    int v14906 = v14905 + 1;
+    int v14907 = v14906 + 1;
+    int v14908 = v14907 + 1;
+    int v14909 = v14908 + 1;
+    int v14910 = v14909 + 1;
+    int v14911 = v14910 + 1;
+    int v14912 = v14911 + 1;
+    int v14913 = v14912 + 1;
+    int v14914 = v14913 + 1;
+    int v14915 = v14914 + 1;
+    int v14916 = v14915 + 1;
+    int v14917 = v14916 + 1;
+    int v14918 = v14917 + 1;
+    int v14919 = v14918 + 1;
+    int v14920 = v14919 + 1;
+    int v14921 = v14920 + 1;
+    int v14922 = v14921 + 1;
+    int v14923 = v14922 + 1;
+    int v14924 = v14923 + 1;
+    int v14925 = v14924 + 1;
+    int v14926 = v14925 + 1;
+    int v14927 = v14926 + 1;
+    int v14928 = v14927 + 1;
+    int v14929 = v14928 + 1;
+    int v14930 = v14929 + 1;
+    int v14931 = v14930 + 1;
+    int v14932 = v14931 + 1;
+    int v14933 = v14932 + 1;
+    int v14934 = v14933 + 1;
+    int v14935 = v14934 + 1;
+    int v14936 = v14935 + 1;
+    int v14937 = v14936 + 1;
+    int v14938 = v14937 + 1;
+    int v14939 = v14938 + 1;
+    int v14940 = v14939 + 1;
+    int v14941 = v14940 + 1;
+    int v14942 = v14941 + 1;
+    int v14943 = v14942 + 1;
+    int v14944 = v14943 + 1;
+    int v14945 = v14944 + 1;
+    int v14946 = v14945 + 1;
+    int v14947 = v14946 + 1;
+    int v14948 = v14947 + 1;
+    int v14949 = v14948 + 1;
+    int v14950 = v14949 + 1;
+    int v14951 = v14950 + 1;
+    int v14952 = v14951 + 1;
+    int v14953 = v14952 + 1;
+    int v14954 = v14953 + 1;
+    int v14955 = v14954 + 1;
+    int v14956 = v14955 + 1;
+    int v14957 = v14956 + 1;
+    int v14958 = v14957 + 1;
+    int v14959 = v14958 + 1;
+    int v14960 = v14959 + 1;
+    int v14961 = v14960 + 1;
+    int v14962 = v14961 + 1;
+    int v14963 = v14962 + 1;
+    int v14964 = v14963 + 1;
+    int v14965 = v14964 + 1;
+    int v14966 = v14965 + 1;
+    int v14967 = v14966 + 1;
+    int v14968 = v14967 + 1;
+    int v14969 = v14968 + 1;
+    int v14970 = v14969 + 1;
+    int v14971 = v14970 + 1;
+    int v14972 = v14971 + 1;
+    int v14973 = v14972 + 1;
+    int v14974 = v14973 + 1;
+    int v14975 = v14974 + 1;
+    int v14976 = v14975 + 1;
+    int v14977 = v14976 + 1;
+    int v14978 = v14977 + 1;
+    int v14979 = v14978 + 1;
+    int v14980 = v14979 + 1;
+    int v14981 = v14980 + 1;
+    int v14982 = v14981 + 1;
+    int v14983 = v14982 + 1;
+    int v14984 = v14983 + 1;
+    int v14985 = v14984 + 1;
+    int v14986 = v14985 + 1;
+    int v14987 = v14986 + 1;
+    int v14988 = v14987 + 1;
+    int v14989 = v14988 + 1;
+    int v14990 = v14989 + 1;
+    int v14991 = v14990 + 1;
+    int v14992 = v14991 + 1;
+    int v14993 = v14992 + 1;
+    int v14994 = v14993 + 1;
+    int v14995 = v14994 + 1;
+    int v14996 = v14995 + 1;
+    int v14997 = v14996 + 1;
+    int v14998 = v14997 + 1;
+    int v14999 = v14998 + 1;
+    int v15000 = v14999 + 1;
+    int v15001 = v15000 + 1;
+    int v15002 = v15001 + 1;
+    int v15003 = v15002 + 1;
+    int v15004 = v15003 + 1;
+    int v15005 = v15004 + 1;
+    int v15006 = v15005 + 1;
+    int v15007 = v15006 + 1;
+    int v15008 = v15007 + 1;
+    int v15009 = v15008 + 1;
+    int v15010 = v15009 + 1;
+    int v15011 = v15010 + 1;
+    int v15012 = v15011 + 1;
+    int v15013 = v15012 + 1;
+    int v15014 = v15013 + 1;
+    int v15015 = v15014 + 1;
+    int v15016 = v15015 + 1;
+    int v15017 = v15016 + 1;
+    int v15018 = v15017 + 1;
+    int v15019 = v15018 + 1;
+    int v15020 = v15019 + 1;
+    int v15021 = v15020 + 1;
+    int v15022 = v15021 + 1;
+    int v15023 = v15022 + 1;
+    int v15024 = v15023 + 1;
+    int v15025 = v15024 + 1;
+    int v15026 = v15025 + 1;
+    int v15027 = v15026 + 1;
+    int v15028 = v15027 + 1;
+    int v15029 = v15028 + 1;
+    int v15030 = v15029 + 1;
+    int v15031 = v15030 + 1;
+    int v15032 = v15031 + 1;
+    int v15033 = v15032 + 1;
+    int v15034 = v15033 + 1;
+    int v15035 = v15034 + 1;
+    int v15036 = v15035 + 1;
+    int v15037 = v15036 + 1;
+    int v15038 = v15037 + 1;
+    int v15039 = v15038 + 1;
+    int v15040 = v15039 + 1;
+    int v15041 = v15040 + 1;
+    int v15042 = v15041 + 1;
+    int v15043 = v15042 + 1;
+    int v15044 = v15043 + 1;
+    int v15045 = v15044 + 1;
+    int v15046 = v15045 + 1;
+    int v15047 = v15046 + 1;
+    int v15048 = v15047 + 1;
+    int v15049 = v15048 + 1;
+    int v15050 = v15049 + 1;
+    int v15051 = v15050 + 1;
+    int v15052 = v15051 + 1;
+    int v15053 = v15052 + 1;
+    int v15054 = v15053 + 1;
+    int v15055 = v15054 + 1;
+    int v15056 = v15055 + 1;
+    int v15057 = v15056 + 1;
+    int v15058 = v15057 + 1;
+    int v15059 = v15058 + 1;
+    int v15060 = v15059 + 1;
+    int v15061 = v15060 + 1;
+    int v15062 = v15061 + 1;
+    int v15063 = v15062 + 1;
+    int v15064 = v15063 + 1;
+    int v15065 = v15064 + 1;
+    int v15066 = v15065 + 1;
+    int v15067 = v15066 + 1;
+    int v15068 = v15067 + 1;
+    int v15069 = v15068 + 1;
+    int v15070 = v15069 + 1;
+    int v15071 = v15070 + 1;
+    int v15072 = v15071 + 1;
+    int v15073 = v15072 + 1;
+    int v15074 = v15073 + 1;
+    int v15075 = v15074 + 1;
+    int v15076 = v15075 + 1;
+    int v15077 = v15076 + 1;
+    int v15078 = v15077 + 1;
+    int v15079 = v15078 + 1;
+    int v15080 = v15079 + 1;
+    int v15081 = v15080 + 1;
+    int v15082 = v15081 + 1;
+    int v15083 = v15082 + 1;
+    int v15084 = v15083 + 1;
+    int v15085 = v15084 + 1;
+    int v15086 = v15085 + 1;
+    int v15087 = v15086 + 1;
+    int v15088 = v15087 + 1;
+    int v15089 = v15088 + 1;
+    int v15090 = v15089 + 1;
+    int v15091 = v15090 + 1;
+    int v15092 = v15091 + 1;
+    int v15093 = v15092 + 1;
+    int v15094 = v15093 + 1;
+    int v15095 = v15094 + 1;
+    int v15096 = v15095 + 1;
+    int v15097 = v15096 + 1;
+    int v15098 = v15097 + 1;
+    int v15099 = v15098 + 1;
+    int v15100 = v15099 + 1;
+    int v15101 = v15100 + 1;
+    int v15102 = v15101 + 1;
+    int v15103 = v15102 + 1;
+    int v15104 = v15103 + 1;
+    int v15105 = v15104 + 1;
+    int v15106 = v15105 + 1;
+    int v15107 = v15106 + 1;
+    int v15108 = v15107 + 1;
+    int v15109 = v15108 + 1;
+    int v15110 = v15109 + 1;
+    int v15111 = v15110 + 1;
+    int v15112 = v15111 + 1;
+    int v15113 = v15112 + 1;
+    int v15114 = v15113 + 1;
+    int v15115 = v15114 + 1;
+    int v15116 = v15115 + 1;
+    int v15117 = v15116 + 1;
+    int v15118 = v15117 + 1;
+    int v15119 = v15118 + 1;
+    int v15120 = v15119 + 1;
+    int v15121 = v15120 + 1;
+    int v15122 = v15121 + 1;
+    int v15123 = v15122 + 1;
+    int v15124 = v15123 + 1;
+    int v15125 = v15124 + 1;
+    int v15126 = v15125 + 1;
+    int v15127 = v15126 + 1;
+    int v15128 = v15127 + 1;
+    int v15129 = v15128 + 1;
+    int v15130 = v15129 + 1;
+    int v15131 = v15130 + 1;
+    int v15132 = v15131 + 1;
+    int v15133 = v15132 + 1;
+    int v15134 = v15133 + 1;
+    int v15135 = v15134 + 1;
+    int v15136 = v15135 + 1;
+    int v15137 = v15136 + 1;
+    int v15138 = v15137 + 1;
+    int v15139 = v15138 + 1;
+    int v15140 = v15139 + 1;
+    int v15141 = v15140 + 1;
+    int v15142 = v15141 + 1;
+    int v15143 = v15142 + 1;
+    int v15144 = v15143 + 1;
+    int v15145 = v15144 + 1;
+    int v15146 = v15145 + 1;
+    int v15147 = v15146 + 1;
+    int v15148 = v15147 + 1;
+    int v15149 = v15148 + 1;
+    int v15150 = v15149 + 1;
+    int v15151 = v15150 + 1;
+    int v15152 = v15151 + 1;
+    int v15153 = v15152 + 1;
+    int v15154 = v15153 + 1;
+    int v15155 = v15154 + 1;
+    int v15156 = v15155 + 1;
+    int v15157 = v15156 + 1;
+    int v15158 = v15157 + 1;
+    int v15159 = v15158 + 1;
+    int v15160 = v15159 + 1;
+    int v15161 = v15160 + 1;
+    int v15162 = v15161 + 1;
+    int v15163 = v15162 + 1;
+    int v15164 = v15163 + 1;
+    int v15165 = v15164 + 1;
+    int v15166 = v15165 + 1;
+    int v15167 = v15166 + 1;
+    int v15168 = v15167 + 1;
+    int v15169 = v15168 + 1;
+    int v15170 = v15169 + 1;
+    int v15171 = v15170 + 1;
+    int v15172 = v15171 + 1;
+    int v15173 = v15172 + 1;
+    int v15174 = v15173 + 1;
+    int v15175 = v15174 + 1;
+    int v15176 = v15175 + 1;
+    int v15177 = v15176 + 1;
+    int v15178 = v15177 + 1;
+    int v15179 = v15178 + 1;
+    int v15180 = v15179 + 1;
+    int v15181 = v15180 + 1;
+    int v15182 = v15181 + 1;
+    int v15183 = v15182 + 1;
+    int v15184 = v15183 + 1;
+    int v15185 = v15184 + 1;
+    int v15186 = v15185 + 1;
+    int v15187 = v15186 + 1;
+    int v15188 = v15187 + 1;
+    int v15189 = v15188 + 1;
+    int v15190 = v15189 + 1;
+    int v15191 = v15190 + 1;
+    int v15192 = v15191 + 1;
+    int v15193 = v15192 + 1;
+    int v15194 = v15193 + 1;
+    int v15195 = v15194 + 1;
+    int v15196 = v15195 + 1;
+    int v15197 = v15196 + 1;
+    int v15198 = v15197 + 1;
+    int v15199 = v15198 + 1;
+    int v15200 = v15199 + 1;
+    int v15201 = v15200 + 1;
+    int v15202 = v15201 + 1;
+    int v15203 = v15202 + 1;
+    int v15204 = v15203 + 1;
+    int v15205 = v15204 + 1;
+    int v15206 = v15205 + 1;
+    int v15207 = v15206 + 1;
+    int v15208 = v15207 + 1;
+    int v15209 = v15208 + 1;
+    int v15210 = v15209 + 1;
+    int v15211 = v15210 + 1;
+    int v15212 = v15211 + 1;
+    int v15213 = v15212 + 1;
+    int v15214 = v15213 + 1;
+    int v15215 = v15214 + 1;
+    int v15216 = v15215 + 1;
+    int v15217 = v15216 + 1;
+    int v15218 = v15217 + 1;
+    int v15219 = v15218 + 1;
+    int v15220 = v15219 + 1;
+    int v15221 = v15220 + 1;
+    int v15222 = v15221 + 1;
+    int v15223 = v15222 + 1;
+    int v15224 = v15223 + 1;
+    int v15225 = v15224 + 1;
+    int v15226 = v15225 + 1;
+    int v15227 = v15226 + 1;
+    int v15228 = v15227 + 1;
+    int v15229 = v15228 + 1;
+    int v15230 = v15229 + 1;
+    int v15231 = v15230 + 1;
+    int v15232 = v15231 + 1;
+    int v15233 = v15232 + 1;
+    int v15234 = v15233 + 1;
+    int v15235 = v15234 + 1;
+    int v15236 = v15235 + 1;
+    int v15237 = v15236 + 1;
+    int v15238 = v15237 + 1;
+    int v15239 = v15238 + 1;
+    int v15240 = v15239 + 1;
+    int v15241 = v15240 + 1;
+    int v15242 = v15241 + 1;
+    int v15243 = v15242 + 1;
+    int v15244 = v15243 + 1;
+    int v15245 = v15244 + 1;
+    int v15246 = v15245 + 1;
+    int v15247 = v15246 + 1;
+    int v15248 = v15247 + 1;
+    int v15249 = v15248 + 1;
+    int v15250 = v15249 + 1;
+    int v15251 = v15250 + 1;
+    int v15252 = v15251 + 1;
+    int v15253 = v15252 + 1;
+    int v15254 = v15253 + 1;
+    int v15255 = v15254 + 1;
+    int v15256 = v15255 + 1;
+    int v15257 = v15256 + 1;
+    int v15258 = v15257 + 1;
+    int v15259 = v15258 + 1;
+    int v15260 = v15259 + 1;
+    int v15261 = v15260 + 1;
+    int v15262 = v15261 + 1;
+    int v15263 = v15262 + 1;
+    int v15264 = v15263 + 1;
+    int v15265 = v15264 + 1;
+    int v15266 = v15265 + 1;
+    int v15267 = v15266 + 1;
+    int v15268 = v15267 + 1;
+    int v15269 = v15268 + 1;
+    int v15270 = v15269 + 1;
+    int v15271 = v15270 + 1;
+    int v15272 = v15271 + 1;
+    int v15273 = v15272 + 1;
+    int v15274 = v15273 + 1;
+    int v15275 = v15274 + 1;
+    int v15276 = v15275 + 1;
+    int v15277 = v15276 + 1;
+    int v15278 = v15277 + 1;
+    int v15279 = v15278 + 1;
+    int v15280 = v15279 + 1;
+    int v15281 = v15280 + 1;
+    int v15282 = v15281 + 1;
+    int v15283 = v15282 + 1;
+    int v15284 = v15283 + 1;
+    int v15285 = v15284 + 1;
+    int v15286 = v15285 + 1;
+    int v15287 = v15286 + 1;
+    int v15288 = v15287 + 1;
+    int v15289 = v15288 + 1;
+    int v15290 = v15289 + 1;
+    int v15291 = v15290 + 1;
+    int v15292 = v15291 + 1;
+    int v15293 = v15292 + 1;
+    int v15294 = v15293 + 1;
+    int v15295 = v15294 + 1;
+    int v15296 = v15295 + 1;
+    int v15297 = v15296 + 1;
+    int v15298 = v15297 + 1;
+    int v15299 = v15298 + 1;
+    int v15300 = v15299 + 1;
+    int v15301 = v15300 + 1;
+    int v15302 = v15301 + 1;
+    int v15303 = v15302 + 1;
+    int v15304 = v15303 + 1;
+    int v15305 = v15304 + 1;
+    int v15306 = v15305 + 1;
+    int v15307 = v15306 + 1;
+    int v15308 = v15307 + 1;
+    int v15309 = v15308 + 1;
+    int v15310 = v15309 + 1;
+    int v15311 = v15310 + 1;
+    int v15312 = v15311 + 1;
+    int v15313 = v15312 + 1;
+    int v15314 = v15313 + 1;
+    int v15315 = v15314 + 1;
+    int v15316 = v15315 + 1;
+    int v15317 = v15316 + 1;
+    int v15318 = v15317 + 1;
+    int v15319 = v15318 + 1;
+    int v15320 = v15319 + 1;
+    int v15321 = v15320 + 1;
+    int v15322 = v15321 + 1;
+    int v15323 = v15322 + 1;
+    int v15324 = v15323 + 1;
+    int v15325 = v15324 + 1;
+    int v15326 = v15325 + 1;
+    int v15327 = v15326 + 1;
+    int v15328 = v15327 + 1;
+    int v15329 = v15328 + 1;
+    int v15330 = v15329 + 1;
+    int v15331 = v15330 + 1;
+    int v15332 = v15331 + 1;
+    int v15333 = v15332 + 1;
+    int v15334 = v15333 + 1;
+    int v15335 = v15334 + 1;
+    int v15336 = v15335 + 1;
+    int v15337 = v15336 + 1;
+    int v15338 = v15337 + 1;
+    int v15339 = v15338 + 1;
+    int v15340 = v15339 + 1;
+    int v15341 = v15340 + 1;
+    int v15342 = v15341 + 1;
+    int v15343 = v15342 + 1;
+    int v15344 = v15343 + 1;
+    int v15345 = v15344 + 1;
+    int v15346 = v15345 + 1;
+    int v15347 = v15346 + 1;
+    int v15348 = v15347 + 1;
+    int v15349 = v15348 + 1;
+    int v15350 = v15349 + 1;
+    int v15351 = v15350 + 1;
+    int v15352 = v15351 + 1;
+    int v15353 = v15352 + 1;
+    int v15354 = v15353 + 1;
+    int v15355 = v15354 + 1;
+    int v15356 = v15355 + 1;
+    int v15357 = v15356 + 1;
+    int v15358 = v15357 + 1;
+    int v15359 = v15358 + 1;
+    int v15360 = v15359 + 1;
+    int v15361 = v15360 + 1;
+    int v15362 = v15361 + 1;
+    int v15363 = v15362 + 1;
+    int v15364 = v15363 + 1;
+    int v15365 = v15364 + 1;
+    int v15366 = v15365 + 1;
+    int v15367 = v15366 + 1;
+    int v15368 = v15367 + 1;
+    int v15369 = v15368 + 1;
+    int v15370 = v15369 + 1;
+    int v15371 = v15370 + 1;
+    int v15372 = v15371 + 1;
+    int v15373 = v15372 + 1;
+    int v15374 = v15373 + 1;
+    int v15375 = v15374 + 1;
+    int v15376 = v15375 + 1;
+    int v15377 = v15376 + 1;
+    int v15378 = v15377 + 1;
+    int v15379 = v15378 + 1;
+    int v15380 = v15379 + 1;
+    int v15381 = v15380 + 1;
+    int v15382 = v15381 + 1;
+    int v15383 = v15382 + 1;
+    int v15384 = v15383 + 1;
+    int v15385 = v15384 + 1;
+    int v15386 = v15385 + 1;
+    int v15387 = v15386 + 1;
+    int v15388 = v15387 + 1;
+    int v15389 = v15388 + 1;
+    int v15390 = v15389 + 1;
+    int v15391 = v15390 + 1;
+    int v15392 = v15391 + 1;
+    int v15393 = v15392 + 1;
+    int v15394 = v15393 + 1;
+    int v15395 = v15394 + 1;
+    int v15396 = v15395 + 1;
+    int v15397 = v15396 + 1;
+    int v15398 = v15397 + 1;
+    int v15399 = v15398 + 1;
+    int v15400 = v15399 + 1;
+    int v15401 = v15400 + 1;
+    int v15402 = v15401 + 1;
+    int v15403 = v15402 + 1;
+    int v15404 = v15403 + 1;
+    int v15405 = v15404 + 1;
+    int v15406 = v15405 + 1;
+    int v15407 = v15406 + 1;
+    int v15408 = v15407 + 1;
+    int v15409 = v15408 + 1;
+    int v15410 = v15409 + 1;
+    int v15411 = v15410 + 1;
+    int v15412 = v15411 + 1;
+    int v15413 = v15412 + 1;
+    int v15414 = v15413 + 1;
+    int v15415 = v15414 + 1;
+    int v15416 = v15415 + 1;
+    int v15417 = v15416 + 1;
+    int v15418 = v15417 + 1;
+    int v15419 = v15418 + 1;
+    int v15420 = v15419 + 1;
+    int v15421 = v15420 + 1;
+    int v15422 = v15421 + 1;
+    int v15423 = v15422 + 1;
+    int v15424 = v15423 + 1;
+    int v15425 = v15424 + 1;
+    int v15426 = v15425 + 1;
+    int v15427 = v15426 + 1;
+    int v15428 = v15427 + 1;
+    int v15429 = v15428 + 1;
+    int v15430 = v15429 + 1;
+    int v15431 = v15430 + 1;
+    int v15432 = v15431 + 1;
+    int v15433 = v15432 + 1;
+    int v15434 = v15433 + 1;
+    int v15435 = v15434 + 1;
+    int v15436 = v15435 + 1;
+    int v15437 = v15436 + 1;
+    int v15438 = v15437 + 1;
+    int v15439 = v15438 + 1;
+    int v15440 = v15439 + 1;
+    int v15441 = v15440 + 1;
+    int v15442 = v15441 + 1;
+    int v15443 = v15442 + 1;
+    int v15444 = v15443 + 1;
+    int v15445 = v15444 + 1;
+    int v15446 = v15445 + 1;
+    int v15447 = v15446 + 1;
+    int v15448 = v15447 + 1;
+    int v15449 = v15448 + 1;
+    int v15450 = v15449 + 1;
+    int v15451 = v15450 + 1;
+    int v15452 = v15451 + 1;
+    int v15453 = v15452 + 1;
+    int v15454 = v15453 + 1;
+    int v15455 = v15454 + 1;
+    int v15456 = v15455 + 1;
+    int v15457 = v15456 + 1;
+    int v15458 = v15457 + 1;
+    int v15459 = v15458 + 1;
+    int v15460 = v15459 + 1;
+    int v15461 = v15460 + 1;
+    int v15462 = v15461 + 1;
+    int v15463 = v15462 + 1;
+    int v15464 = v15463 + 1;
+    int v15465 = v15464 + 1;
+    int v15466 = v15465 + 1;
+    int v15467 = v15466 + 1;
+    int v15468 = v15467 + 1;
+    int v15469 = v15468 + 1;
+    int v15470 = v15469 + 1;
+    int v15471 = v15470 + 1;
+    int v15472 = v15471 + 1;
+    int v15473 = v15472 + 1;
+    int v15474 = v15473 + 1;
+    int v15475 = v15474 + 1;
+    int v15476 = v15475 + 1;
+    int v15477 = v15476 + 1;
+    int v15478 = v15477 + 1;
+    int v15479 = v15478 + 1;
+    int v15480 = v15479 + 1;
+    int v15481 = v15480 + 1;
+    int v15482 = v15481 + 1;
+    int v15483 = v15482 + 1;
+    int v15484 = v15483 + 1;
+    int v15485 = v15484 + 1;
+    int v15486 = v15485 + 1;
+    int v15487 = v15486 + 1;
+    int v15488 = v15487 + 1;
+    int v15489 = v15488 + 1;
+    int v15490 = v15489 + 1;
+    int v15491 = v15490 + 1;
+    int v15492 = v15491 + 1;
+    int v15493 = v15492 + 1;
+    int v15494 = v15493 + 1;
+    int v15495 = v15494 + 1;
+    int v15496 = v15495 + 1;
+    int v15497 = v15496 + 1;
+    int v15498 = v15497 + 1;
+    int v15499 = v15498 + 1;
+    int v15500 = v15499 + 1;
+    int v15501 = v15500 + 1;
+    int v15502 = v15501 + 1;
+    int v15503 = v15502 + 1;
+    int v15504 = v15503 + 1;
+    int v15505 = v15504 + 1;
+    int v15506 = v15505 + 1;
+    int v15507 = v15506 + 1;
+    int v15508 = v15507 + 1;
+    int v15509 = v15508 + 1;
+    int v15510 = v15509 + 1;
+    int v15511 = v15510 + 1;
+    int v15512 = v15511 + 1;
+    int v15513 = v15512 + 1;
+    int v15514 = v15513 + 1;
+    int v15515 = v15514 + 1;
+    int v15516 = v15515 + 1;
+    int v15517 = v15516 + 1;
+    int v15518 = v15517 + 1;
+    int v15519 = v15518 + 1;
+    int v15520 = v15519 + 1;
+    int v15521 = v15520 + 1;
+    int v15522 = v15521 + 1;
+    int v15523 = v15522 + 1;
+    int v15524 = v15523 + 1;
+    int v15525 = v15524 + 1;
+    int v15526 = v15525 + 1;
+    int v15527 = v15526 + 1;
+    int v15528 = v15527 + 1;
+    int v15529 = v15528 + 1;
+    int v15530 = v15529 + 1;
+    int v15531 = v15530 + 1;
+    int v15532 = v15531 + 1;
+    int v15533 = v15532 + 1;
+    int v15534 = v15533 + 1;
+    int v15535 = v15534 + 1;
+    int v15536 = v15535 + 1;
+    int v15537 = v15536 + 1;
+    int v15538 = v15537 + 1;
+    int v15539 = v15538 + 1;
+    int v15540 = v15539 + 1;
+    int v15541 = v15540 + 1;
+    int v15542 = v15541 + 1;
+    int v15543 = v15542 + 1;
+    int v15544 = v15543 + 1;
+    int v15545 = v15544 + 1;
+    int v15546 = v15545 + 1;
+    int v15547 = v15546 + 1;
+    int v15548 = v15547 + 1;
+    int v15549 = v15548 + 1;
+    int v15550 = v15549 + 1;
+    int v15551 = v15550 + 1;
+    int v15552 = v15551 + 1;
+    int v15553 = v15552 + 1;
+    int v15554 = v15553 + 1;
+    int v15555 = v15554 + 1;
+    int v15556 = v15555 + 1;
+    int v15557 = v15556 + 1;
+    int v15558 = v15557 + 1;
+    int v15559 = v15558 + 1;
+    int v15560 = v15559 + 1;
+    int v15561 = v15560 + 1;
+    int v15562 = v15561 + 1;
+    int v15563 = v15562 + 1;
+    int v15564 = v15563 + 1;
+    int v15565 = v15564 + 1;
+    int v15566 = v15565 + 1;
+    int v15567 = v15566 + 1;
+    int v15568 = v15567 + 1;
+    int v15569 = v15568 + 1;
+    int v15570 = v15569 + 1;
+    int v15571 = v15570 + 1;
+    int v15572 = v15571 + 1;
+    int v15573 = v15572 + 1;
+    int v15574 = v15573 + 1;
+    int v15575 = v15574 + 1;
+    int v15576 = v15575 + 1;
+    int v15577 = v15576 + 1;
+    int v15578 = v15577 + 1;
+    int v15579 = v15578 + 1;
+    int v15580 = v15579 + 1;
+    int v15581 = v15580 + 1;
+    int v15582 = v15581 + 1;
+    int v15583 = v15582 + 1;
+    int v15584 = v15583 + 1;
+    int v15585 = v15584 + 1;
+    int v15586 = v15585 + 1;
+    int v15587 = v15586 + 1;
+    int v15588 = v15587 + 1;
+    int v15589 = v15588 + 1;
+    int v15590 = v15589 + 1;
+    int v15591 = v15590 + 1;
+    int v15592 = v15591 + 1;
+    int v15593 = v15592 + 1;
+    int v15594 = v15593 + 1;
+    int v15595 = v15594 + 1;
+    int v15596 = v15595 + 1;
+    int v15597 = v15596 + 1;
+    int v15598 = v15597 + 1;
+    int v15599 = v15598 + 1;
+    int v15600 = v15599 + 1;
+    int v15601 = v15600 + 1;
+    int v15602 = v15601 + 1;
+    int v15603 = v15602 + 1;
+    int v15604 = v15603 + 1;
+    int v15605 = v15604 + 1;
+    int v15606 = v15605 + 1;
+    int v15607 = v15606 + 1;
+    int v15608 = v15607 + 1;
+    int v15609 = v15608 + 1;
+    int v15610 = v15609 + 1;
+    int v15611 = v15610 + 1;
+    int v15612 = v15611 + 1;
+    int v15613 = v15612 + 1;
+    int v15614 = v15613 + 1;
+    int v15615 = v15614 + 1;
+    int v15616 = v15615 + 1;
+    int v15617 = v15616 + 1;
+    int v15618 = v15617 + 1;
+    int v15619 = v15618 + 1;
+    int v15620 = v15619 + 1;
+    int v15621 = v15620 + 1;
+    int v15622 = v15621 + 1;
+    int v15623 = v15622 + 1;
+    int v15624 = v15623 + 1;
+    int v15625 = v15624 + 1;
+    int v15626 = v15625 + 1;
+    int v15627 = v15626 + 1;
+    int v15628 = v15627 + 1;
+    int v15629 = v15628 + 1;
+    int v15630 = v15629 + 1;
+    int v15631 = v15630 + 1;
+    int v15632 = v15631 + 1;
+    int v15633 = v15632 + 1;
+    int v15634 = v15633 + 1;
+    int v15635 = v15634 + 1;
+    int v15636 = v15635 + 1;
+    int v15637 = v15636 + 1;
+    int v15638 = v15637 + 1;
+    int v15639 = v15638 + 1;
+    int v15640 = v15639 + 1;
+    int v15641 = v15640 + 1;
+    int v15642 = v15641 + 1;
+    int v15643 = v15642 + 1;
+    int v15644 = v15643 + 1;
+    int v15645 = v15644 + 1;
+    int v15646 = v15645 + 1;
+    int v15647 = v15646 + 1;
+    int v15648 = v15647 + 1;
+    int v15649 = v15648 + 1;
+    int v15650 = v15649 + 1;
+    int v15651 = v15650 + 1;
+    int v15652 = v15651 + 1;
+    int v15653 = v15652 + 1;
+    int v15654 = v15653 + 1;
+    int v15655 = v15654 + 1;
+    int v15656 = v15655 + 1;
+    int v15657 = v15656 + 1;
+    int v15658 = v15657 + 1;
+    int v15659 = v15658 + 1;
+    int v15660 = v15659 + 1;
+    int v15661 = v15660 + 1;
+    int v15662 = v15661 + 1;
+    int v15663 = v15662 + 1;
+    int v15664 = v15663 + 1;
+    int v15665 = v15664 + 1;
+    int v15666 = v15665 + 1;
+    int v15667 = v15666 + 1;
+    int v15668 = v15667 + 1;
+    int v15669 = v15668 + 1;
+    int v15670 = v15669 + 1;
+    int v15671 = v15670 + 1;
+    int v15672 = v15671 + 1;
+    int v15673 = v15672 + 1;
+    int v15674 = v15673 + 1;
+    int v15675 = v15674 + 1;
+    int v15676 = v15675 + 1;
+    int v15677 = v15676 + 1;
+    int v15678 = v15677 + 1;
+    int v15679 = v15678 + 1;
+    int v15680 = v15679 + 1;
+    int v15681 = v15680 + 1;
+    int v15682 = v15681 + 1;
+    int v15683 = v15682 + 1;
+    int v15684 = v15683 + 1;
+    int v15685 = v15684 + 1;
+    int v15686 = v15685 + 1;
+    int v15687 = v15686 + 1;
+    int v15688 = v15687 + 1;
+    int v15689 = v15688 + 1;
+    int v15690 = v15689 + 1;
+    int v15691 = v15690 + 1;
+    int v15692 = v15691 + 1;
+    int v15693 = v15692 + 1;
+    int v15694 = v15693 + 1;
+    int v15695 = v15694 + 1;
+    int v15696 = v15695 + 1;
+    int v15697 = v15696 + 1;
+    int v15698 = v15697 + 1;
+    int v15699 = v15698 + 1;
+    int v15700 = v15699 + 1;
+    int v15701 = v15700 + 1;
+    int v15702 = v15701 + 1;
+    int v15703 = v15702 + 1;
+    int v15704 = v15703 + 1;
+    int v15705 = v15704 + 1;
+    int v15706 = v15705 + 1;
+    int v15707 = v15706 + 1;
+    int v15708 = v15707 + 1;
+    int v15709 = v15708 + 1;
+    int v15710 = v15709 + 1;
+    int v15711 = v15710 + 1;
+    int v15712 = v15711 + 1;
+    int v15713 = v15712 + 1;
+    int v15714 = v15713 + 1;
+    int v15715 = v15714 + 1;
+    int v15716 = v15715 + 1;
+    int v15717 = v15716 + 1;
+    int v15718 = v15717 + 1;
+    int v15719 = v15718 + 1;
+    int v15720 = v15719 + 1;
+    int v15721 = v15720 + 1;
+    int v15722 = v15721 + 1;
+    int v15723 = v15722 + 1;
+    int v15724 = v15723 + 1;
+    int v15725 = v15724 + 1;
+    int v15726 = v15725 + 1;
+    int v15727 = v15726 + 1;
+    int v15728 = v15727 + 1;
+    int v15729 = v15728 + 1;
+    int v15730 = v15729 + 1;
+    int v15731 = v15730 + 1;
+    int v15732 = v15731 + 1;
+    int v15733 = v15732 + 1;
+    int v15734 = v15733 + 1;
+    int v15735 = v15734 + 1;
+    int v15736 = v15735 + 1;
+    int v15737 = v15736 + 1;
+    int v15738 = v15737 + 1;
+    int v15739 = v15738 + 1;
+    int v15740 = v15739 + 1;
+    int v15741 = v15740 + 1;
+    int v15742 = v15741 + 1;
+    int v15743 = v15742 + 1;
+    int v15744 = v15743 + 1;
+    int v15745 = v15744 + 1;
+    int v15746 = v15745 + 1;
+    int v15747 = v15746 + 1;
+    int v15748 = v15747 + 1;
+    int v15749 = v15748 + 1;
+    int v15750 = v15749 + 1;
+    int v15751 = v15750 + 1;
+    int v15752 = v15751 + 1;
+    int v15753 = v15752 + 1;
+    int v15754 = v15753 + 1;
+    int v15755 = v15754 + 1;
+    int v15756 = v15755 + 1;
+    int v15757 = v15756 + 1;
+    int v15758 = v15757 + 1;
+    int v15759 = v15758 + 1;
+    int v15760 = v15759 + 1;
+    int v15761 = v15760 + 1;
+    int v15762 = v15761 + 1;
+    int v15763 = v15762 + 1;
+    int v15764 = v15763 + 1;
+    int v15765 = v15764 + 1;
+    int v15766 = v15765 + 1;
+    int v15767 = v15766 + 1;
+    int v15768 = v15767 + 1;
+    int v15769 = v15768 + 1;
+    int v15770 = v15769 + 1;
+    int v15771 = v15770 + 1;
+    int v15772 = v15771 + 1;
+    int v15773 = v15772 + 1;
+    int v15774 = v15773 + 1;
+    int v15775 = v15774 + 1;
+    int v15776 = v15775 + 1;
+    int v15777 = v15776 + 1;
+    int v15778 = v15777 + 1;
+    int v15779 = v15778 + 1;
+    int v15780 = v15779 + 1;
+    int v15781 = v15780 + 1;
+    int v15782 = v15781 + 1;
+    int v15783 = v15782 + 1;
+    int v15784 = v15783 + 1;
+    int v15785 = v15784 + 1;
+    int v15786 = v15785 + 1;
+    int v15787 = v15786 + 1;
+    int v15788 = v15787 + 1;
+    int v15789 = v15788 + 1;
+    int v15790 = v15789 + 1;
+    int v15791 = v15790 + 1;
+    int v15792 = v15791 + 1;
+    int v15793 = v15792 + 1;
+    int v15794 = v15793 + 1;
+    int v15795 = v15794 + 1;
+    int v15796 = v15795 + 1;
+    int v15797 = v15796 + 1;
+    int v15798 = v15797 + 1;
+    int v15799 = v15798 + 1;
+    int v15800 = v15799 + 1;
+    int v15801 = v15800 + 1;
+    int v15802 = v15801 + 1;
+    int v15803 = v15802 + 1;
+    int v15804 = v15803 + 1;
+    int v15805 = v15804 + 1;
+    int v15806 = v15805 + 1;
+    int v15807 = v15806 + 1;
+    int v15808 = v15807 + 1;
+    int v15809 = v15808 + 1;
+    int v15810 = v15809 + 1;
+    int v15811 = v15810 + 1;
+    int v15812 = v15811 + 1;
+    int v15813 = v15812 + 1;
+    int v15814 = v15813 + 1;
+    int v15815 = v15814 + 1;
+    int v15816 = v15815 + 1;
+    int v15817 = v15816 + 1;
+    int v15818 = v15817 + 1;
+    int v15819 = v15818 + 1;
+    int v15820 = v15819 + 1;
+    int v15821 = v15820 + 1;
+    int v15822 = v15821 + 1;
+    int v15823 = v15822 + 1;
+    int v15824 = v15823 + 1;
+    int v15825 = v15824 + 1;
+    int v15826 = v15825 + 1;
+    int v15827 = v15826 + 1;
+    int v15828 = v15827 + 1;
+    int v15829 = v15828 + 1;
+    int v15830 = v15829 + 1;
+    int v15831 = v15830 + 1;
+    int v15832 = v15831 + 1;
+    int v15833 = v15832 + 1;
+    int v15834 = v15833 + 1;
+    int v15835 = v15834 + 1;
+    int v15836 = v15835 + 1;
+    int v15837 = v15836 + 1;
+    int v15838 = v15837 + 1;
+    int v15839 = v15838 + 1;
+    int v15840 = v15839 + 1;
+    int v15841 = v15840 + 1;
+    int v15842 = v15841 + 1;
+    int v15843 = v15842 + 1;
+    int v15844 = v15843 + 1;
+    int v15845 = v15844 + 1;
+    int v15846 = v15845 + 1;
+    int v15847 = v15846 + 1;
+    int v15848 = v15847 + 1;
+    int v15849 = v15848 + 1;
+    int v15850 = v15849 + 1;
+    int v15851 = v15850 + 1;
+    int v15852 = v15851 + 1;
+    int v15853 = v15852 + 1;
+    int v15854 = v15853 + 1;
+    int v15855 = v15854 + 1;
+    int v15856 = v15855 + 1;
+    int v15857 = v15856 + 1;
+    int v15858 = v15857 + 1;
+    int v15859 = v15858 + 1;
+    int v15860 = v15859 + 1;
+    int v15861 = v15860 + 1;
+    int v15862 = v15861 + 1;
+    int v15863 = v15862 + 1;
+    int v15864 = v15863 + 1;
+    int v15865 = v15864 + 1;
+    int v15866 = v15865 + 1;
+    int v15867 = v15866 + 1;
+    int v15868 = v15867 + 1;
+    int v15869 = v15868 + 1;
+    int v15870 = v15869 + 1;
+    int v15871 = v15870 + 1;
+    int v15872 = v15871 + 1;
+    int v15873 = v15872 + 1;
+    int v15874 = v15873 + 1;
+    int v15875 = v15874 + 1;
+    int v15876 = v15875 + 1;
+    int v15877 = v15876 + 1;
+    int v15878 = v15877 + 1;
+    int v15879 = v15878 + 1;
+    int v15880 = v15879 + 1;
+    int v15881 = v15880 + 1;
+    int v15882 = v15881 + 1;
+    int v15883 = v15882 + 1;
+    int v15884 = v15883 + 1;
+    int v15885 = v15884 + 1;
+    int v15886 = v15885 + 1;
+    int v15887 = v15886 + 1;
+    int v15888 = v15887 + 1;
+    int v15889 = v15888 + 1;
+    int v15890 = v15889 + 1;
+    int v15891 = v15890 + 1;
+    int v15892 = v15891 + 1;
+    int v15893 = v15892 + 1;
+    int v15894 = v15893 + 1;
+    int v15895 = v15894 + 1;
+    int v15896 = v15895 + 1;
+    int v15897 = v15896 + 1;
+    int v15898 = v15897 + 1;
+    int v15899 = v15898 + 1;
+    int v15900 = v15899 + 1;
+    int v15901 = v15900 + 1;
+    int v15902 = v15901 + 1;
+    int v15903 = v15902 + 1;
+    int v15904 = v15903 + 1;
+    int v15905 = v15904 + 1;
+    int v15906 = v15905 + 1;
+    int v15907 = v15906 + 1;
+    int v15908 = v15907 + 1;
+    int v15909 = v15908 + 1;
+    int v15910 = v15909 + 1;
+    int v15911 = v15910 + 1;
+    int v15912 = v15911 + 1;
+    int v15913 = v15912 + 1;
+    int v15914 = v15913 + 1;
+    int v15915 = v15914 + 1;
+    int v15916 = v15915 + 1;
+    int v15917 = v15916 + 1;
+    int v15918 = v15917 + 1;
+    int v15919 = v15918 + 1;
+    int v15920 = v15919 + 1;
+    int v15921 = v15920 + 1;
+    int v15922 = v15921 + 1;
+    int v15923 = v15922 + 1;
+    int v15924 = v15923 + 1;
+    int v15925 = v15924 + 1;
+    int v15926 = v15925 + 1;
+    int v15927 = v15926 + 1;
+    int v15928 = v15927 + 1;
+    int v15929 = v15928 + 1;
+    int v15930 = v15929 + 1;
+    int v15931 = v15930 + 1;
+    int v15932 = v15931 + 1;
+    int v15933 = v15932 + 1;
+    int v15934 = v15933 + 1;
+    int v15935 = v15934 + 1;
+    int v15936 = v15935 + 1;
+    int v15937 = v15936 + 1;
+    int v15938 = v15937 + 1;
+    int v15939 = v15938 + 1;
+    int v15940 = v15939 + 1;
+    int v15941 = v15940 + 1;
+    int v15942 = v15941 + 1;
+    int v15943 = v15942 + 1;
+    int v15944 = v15943 + 1;
+    int v15945 = v15944 + 1;
+    int v15946 = v15945 + 1;
+    int v15947 = v15946 + 1;
+    int v15948 = v15947 + 1;
+    int v15949 = v15948 + 1;
+    int v15950 = v15949 + 1;
+    int v15951 = v15950 + 1;
+    int v15952 = v15951 + 1;
+    int v15953 = v15952 + 1;
+    int v15954 = v15953 + 1;
+    int v15955 = v15954 + 1;
+    int v15956 = v15955 + 1;
+    int v15957 = v15956 + 1;
+    int v15958 = v15957 + 1;
+    int v15959 = v15958 + 1;
+    int v15960 = v15959 + 1;
+    int v15961 = v15960 + 1;
+    int v15962 = v15961 + 1;
+    int v15963 = v15962 + 1;
+    int v15964 = v15963 + 1;
+    int v15965 = v15964 + 1;
+    int v15966 = v15965 + 1;
+    int v15967 = v15966 + 1;
+    int v15968 = v15967 + 1;
+    int v15969 = v15968 + 1;
+    int v15970 = v15969 + 1;
+    int v15971 = v15970 + 1;
+    int v15972 = v15971 + 1;
+    int v15973 = v15972 + 1;
+    int v15974 = v15973 + 1;
+    int v15975 = v15974 + 1;
+    int v15976 = v15975 + 1;
+    int v15977 = v15976 + 1;
+    int v15978 = v15977 + 1;
+    int v15979 = v15978 + 1;
+    int v15980 = v15979 + 1;
+    int v15981 = v15980 + 1;
+    int v15982 = v15981 + 1;
+    int v15983 = v15982 + 1;
+    int v15984 = v15983 + 1;
+    int v15985 = v15984 + 1;
+    int v15986 = v15985 + 1;
+    int v15987 = v15986 + 1;
+    int v15988 = v15987 + 1;
+    int v15989 = v15988 + 1;
+    int v15990 = v15989 + 1;
+    int v15991 = v15990 + 1;
+    int v15992 = v15991 + 1;
+    int v15993 = v15992 + 1;
+    int v15994 = v15993 + 1;
+    int v15995 = v15994 + 1;
+    int v15996 = v15995 + 1;
+    int v15997 = v15996 + 1;
+    int v15998 = v15997 + 1;
+    int v15999 = v15998 + 1;
+    int v16000 = v15999 + 1;
+    int v16001 = v16000 + 1;
+    int v16002 = v16001 + 1;
+    int v16003 = v16002 + 1;
+    int v16004 = v16003 + 1;
+    int v16005 = v16004 + 1;
+    int v16006 = v16005 + 1;
+    int v16007 = v16006 + 1;
+    int v16008 = v16007 + 1;
+    int v16009 = v16008 + 1;
+    int v16010 = v16009 + 1;
+    int v16011 = v16010 + 1;
+    int v16012 = v16011 + 1;
+    int v16013 = v16012 + 1;
+    int v16014 = v16013 + 1;
+    int v16015 = v16014 + 1;
+    int v16016 = v16015 + 1;
+    int v16017 = v16016 + 1;
+    int v16018 = v16017 + 1;
+    int v16019 = v16018 + 1;
+    int v16020 = v16019 + 1;
+    int v16021 = v16020 + 1;
+    int v16022 = v16021 + 1;
+    int v16023 = v16022 + 1;
+    int v16024 = v16023 + 1;
+    int v16025 = v16024 + 1;
+    int v16026 = v16025 + 1;
+    int v16027 = v16026 + 1;
+    int v16028 = v16027 + 1;
+    int v16029 = v16028 + 1;
+    int v16030 = v16029 + 1;
+    int v16031 = v16030 + 1;
+    int v16032 = v16031 + 1;
+    int v16033 = v16032 + 1;
+    int v16034 = v16033 + 1;
+    int v16035 = v16034 + 1;
+    int v16036 = v16035 + 1;
+    int v16037 = v16036 + 1;
+    int v16038 = v16037 + 1;
+    int v16039 = v16038 + 1;
+    int v16040 = v16039 + 1;
+    int v16041 = v16040 + 1;
+    int v16042 = v16041 + 1;
+    int v16043 = v16042 + 1;
+    int v16044 = v16043 + 1;
+    int v16045 = v16044 + 1;
+    int v16046 = v16045 + 1;
+    int v16047 = v16046 + 1;
+    int v16048 = v16047 + 1;
+    int v16049 = v16048 + 1;
+    int v16050 = v16049 + 1;
+    int v16051 = v16050 + 1;
+    int v16052 = v16051 + 1;
+    int v16053 = v16052 + 1;
+    int v16054 = v16053 + 1;
+    int v16055 = v16054 + 1;
+    int v16056 = v16055 + 1;
+    int v16057 = v16056 + 1;
+    int v16058 = v16057 + 1;
+    int v16059 = v16058 + 1;
+    int v16060 = v16059 + 1;
+    int v16061 = v16060 + 1;
+    int v16062 = v16061 + 1;
+    int v16063 = v16062 + 1;
+    int v16064 = v16063 + 1;
+    int v16065 = v16064 + 1;
+    int v16066 = v16065 + 1;
+    int v16067 = v16066 + 1;
+    int v16068 = v16067 + 1;
+    int v16069 = v16068 + 1;
+    int v16070 = v16069 + 1;
+    int v16071 = v16070 + 1;
+    int v16072 = v16071 + 1;
+    int v16073 = v16072 + 1;
+    int v16074 = v16073 + 1;
+    int v16075 = v16074 + 1;
+    int v16076 = v16075 + 1;
+    int v16077 = v16076 + 1;
+    int v16078 = v16077 + 1;
+    int v16079 = v16078 + 1;
+    int v16080 = v16079 + 1;
+    int v16081 = v16080 + 1;
+    int v16082 = v16081 + 1;
+    int v16083 = v16082 + 1;
+    int v16084 = v16083 + 1;
+    int v16085 = v16084 + 1;
+    int v16086 = v16085 + 1;
+    int v16087 = v16086 + 1;
+    int v16088 = v16087 + 1;
+    int v16089 = v16088 + 1;
+    int v16090 = v16089 + 1;
+    int v16091 = v16090 + 1;
+    int v16092 = v16091 + 1;
+    int v16093 = v16092 + 1;
+    int v16094 = v16093 + 1;
+    int v16095 = v16094 + 1;
+    int v16096 = v16095 + 1;
+    int v16097 = v16096 + 1;
+    int v16098 = v16097 + 1;
+    int v16099 = v16098 + 1;
+    int v16100 = v16099 + 1;
+    int v16101 = v16100 + 1;
+    int v16102 = v16101 + 1;
+    int v16103 = v16102 + 1;
+    int v16104 = v16103 + 1;
+    int v16105 = v16104 + 1;
+    int v16106 = v16105 + 1;
+    int v16107 = v16106 + 1;
+    int v16108 = v16107 + 1;
+    int v16109 = v16108 + 1;
+    int v16110 = v16109 + 1;
+    int v16111 = v16110 + 1;
+    int v16112 = v16111 + 1;
+    int v16113 = v16112 + 1;
+    int v16114 = v16113 + 1;
+    int v16115 = v16114 + 1;
+    int v16116 = v16115 + 1;
+    int v16117 = v16116 + 1;
+    int v16118 = v16117 + 1;
+    int v16119 = v16118 + 1;
+    int v16120 = v16119 + 1;
+    int v16121 = v16120 + 1;
+    int v16122 = v16121 + 1;
+    int v16123 = v16122 + 1;
+    int v16124 = v16123 + 1;
+    int v16125 = v16124 + 1;
+    int v16126 = v16125 + 1;
+    int v16127 = v16126 + 1;
+    int v16128 = v16127 + 1;
+    int v16129 = v16128 + 1;
+    int v16130 = v16129 + 1;
+    int v16131 = v16130 + 1;
+    int v16132 = v16131 + 1;
+    int v16133 = v16132 + 1;
+    int v16134 = v16133 + 1;
+    int v16135 = v16134 + 1;
+    int v16136 = v16135 + 1;
+    int v16137 = v16136 + 1;
+    int v16138 = v16137 + 1;
+    int v16139 = v16138 + 1;
+    int v16140 = v16139 + 1;
+    int v16141 = v16140 + 1;
+    int v16142 = v16141 + 1;
+    int v16143 = v16142 + 1;
+    int v16144 = v16143 + 1;
+    int v16145 = v16144 + 1;
+    int v16146 = v16145 + 1;
+    int v16147 = v16146 + 1;
+    int v16148 = v16147 + 1;
+    int v16149 = v16148 + 1;
+    int v16150 = v16149 + 1;
+    int v16151 = v16150 + 1;
+    int v16152 = v16151 + 1;
+    int v16153 = v16152 + 1;
+    int v16154 = v16153 + 1;
+    int v16155 = v16154 + 1;
+    int v16156 = v16155 + 1;
+    int v16157 = v16156 + 1;
+    int v16158 = v16157 + 1;
+    int v16159 = v16158 + 1;
+    int v16160 = v16159 + 1;
+    int v16161 = v16160 + 1;
+    int v16162 = v16161 + 1;
+    int v16163 = v16162 + 1;
+    int v16164 = v16163 + 1;
+    int v16165 = v16164 + 1;
+    int v16166 = v16165 + 1;
+    int v16167 = v16166 + 1;
+    int v16168 = v16167 + 1;
+    int v16169 = v16168 + 1;
+    int v16170 = v16169 + 1;
+    int v16171 = v16170 + 1;
+    int v16172 = v16171 + 1;
+    int v16173 = v16172 + 1;
+    int v16174 = v16173 + 1;
+    int v16175 = v16174 + 1;
+    int v16176 = v16175 + 1;
+    int v16177 = v16176 + 1;
+    int v16178 = v16177 + 1;
+    int v16179 = v16178 + 1;
+    int v16180 = v16179 + 1;
+    int v16181 = v16180 + 1;
+    int v16182 = v16181 + 1;
+    int v16183 = v16182 + 1;
+    int v16184 = v16183 + 1;
+    int v16185 = v16184 + 1;
+    int v16186 = v16185 + 1;
+    int v16187 = v16186 + 1;
+    int v16188 = v16187 + 1;
+    int v16189 = v16188 + 1;
+    int v16190 = v16189 + 1;
+    int v16191 = v16190 + 1;
+    int v16192 = v16191 + 1;
+    int v16193 = v16192 + 1;
+    int v16194 = v16193 + 1;
+    int v16195 = v16194 + 1;
+    int v16196 = v16195 + 1;
+    int v16197 = v16196 + 1;
+    int v16198 = v16197 + 1;
+    int v16199 = v16198 + 1;
+    int v16200 = v16199 + 1;
+    int v16201 = v16200 + 1;
+    int v16202 = v16201 + 1;
+    int v16203 = v16202 + 1;
+    int v16204 = v16203 + 1;
+    int v16205 = v16204 + 1;
+    int v16206 = v16205 + 1;
+    int v16207 = v16206 + 1;
+    int v16208 = v16207 + 1;
+    int v16209 = v16208 + 1;
+    int v16210 = v16209 + 1;
+    int v16211 = v16210 + 1;
+    int v16212 = v16211 + 1;
+    int v16213 = v16212 + 1;
+    int v16214 = v16213 + 1;
+    int v16215 = v16214 + 1;
+    int v16216 = v16215 + 1;
+    int v16217 = v16216 + 1;
+    int v16218 = v16217 + 1;
+    int v16219 = v16218 + 1;
+    int v16220 = v16219 + 1;
+    int v16221 = v16220 + 1;
+    int v16222 = v16221 + 1;
+    int v16223 = v16222 + 1;
+    int v16224 = v16223 + 1;
+    int v16225 = v16224 + 1;
+    int v16226 = v16225 + 1;
+    int v16227 = v16226 + 1;
+    int v16228 = v16227 + 1;
+    int v16229 = v16228 + 1;
+    int v16230 = v16229 + 1;
+    int v16231 = v16230 + 1;
+    int v16232 = v16231 + 1;
+    int v16233 = v16232 + 1;
+    int v16234 = v16233 + 1;
+    int v16235 = v16234 + 1;
+    int v16236 = v16235 + 1;
+    int v16237 = v16236 + 1;
+    int v16238 = v16237 + 1;
+    int v16239 = v16238 + 1;
+    int v16240 = v16239 + 1;
+    int v16241 = v16240 + 1;
+    int v16242 = v16241 + 1;
+    int v16243 = v16242 + 1;
+    int v16244 = v16243 + 1;
+    int v16245 = v16244 + 1;
+    int v16246 = v16245 + 1;
+    int v16247 = v16246 + 1;
+    int v16248 = v16247 + 1;
+    int v16249 = v16248 + 1;
+    int v16250 = v16249 + 1;
+    int v16251 = v16250 + 1;
+    int v16252 = v16251 + 1;
+    int v16253 = v16252 + 1;
+    int v16254 = v16253 + 1;
+    int v16255 = v16254 + 1;
+    int v16256 = v16255 + 1;
+    int v16257 = v16256 + 1;
+    int v16258 = v16257 + 1;
+    int v16259 = v16258 + 1;
+    int v16260 = v16259 + 1;
+    int v16261 = v16260 + 1;
+    int v16262 = v16261 + 1;
+    int v16263 = v16262 + 1;
+    int v16264 = v16263 + 1;
+    int v16265 = v16264 + 1;
+    int v16266 = v16265 + 1;
+    int v16267 = v16266 + 1;
+    int v16268 = v16267 + 1;
+    int v16269 = v16268 + 1;
+    int v16270 = v16269 + 1;
+    int v16271 = v16270 + 1;
+    int v16272 = v16271 + 1;
+    int v16273 = v16272 + 1;
+    int v16274 = v16273 + 1;
+    int v16275 = v16274 + 1;
+    int v16276 = v16275 + 1;
+    int v16277 = v16276 + 1;
+    int v16278 = v16277 + 1;
+    int v16279 = v16278 + 1;
+    int v16280 = v16279 + 1;
+    int v16281 = v16280 + 1;
+    int v16282 = v16281 + 1;
+    int v16283 = v16282 + 1;
+    int v16284 = v16283 + 1;
+    int v16285 = v16284 + 1;
+    int v16286 = v16285 + 1;
+    int v16287 = v16286 + 1;
+    int v16288 = v16287 + 1;
+    int v16289 = v16288 + 1;
+    int v16290 = v16289 + 1;
+    int v16291 = v16290 + 1;
+    int v16292 = v16291 + 1;
+    int v16293 = v16292 + 1;
+    int v16294 = v16293 + 1;
+    int v16295 = v16294 + 1;
+    int v16296 = v16295 + 1;
+    int v16297 = v16296 + 1;
+    int v16298 = v16297 + 1;
+    int v16299 = v16298 + 1;
+    int v16300 = v16299 + 1;
+    int v16301 = v16300 + 1;
+    int v16302 = v16301 + 1;
+    int v16303 = v16302 + 1;
+    int v16304 = v16303 + 1;
+    int v16305 = v16304 + 1;
+    int v16306 = v16305 + 1;
+    int v16307 = v16306 + 1;
+    int v16308 = v16307 + 1;
+    int v16309 = v16308 + 1;
+    int v16310 = v16309 + 1;
+    int v16311 = v16310 + 1;
+    int v16312 = v16311 + 1;
+    int v16313 = v16312 + 1;
+    int v16314 = v16313 + 1;
+    int v16315 = v16314 + 1;
+    int v16316 = v16315 + 1;
+    int v16317 = v16316 + 1;
+    int v16318 = v16317 + 1;
+    int v16319 = v16318 + 1;
+    int v16320 = v16319 + 1;
+    int v16321 = v16320 + 1;
+    int v16322 = v16321 + 1;
+    int v16323 = v16322 + 1;
+    int v16324 = v16323 + 1;
+    int v16325 = v16324 + 1;
+    int v16326 = v16325 + 1;
+    int v16327 = v16326 + 1;
+    int v16328 = v16327 + 1;
+    int v16329 = v16328 + 1;
+    int v16330 = v16329 + 1;
+    int v16331 = v16330 + 1;
+    int v16332 = v16331 + 1;
+    int v16333 = v16332 + 1;
+    int v16334 = v16333 + 1;
+    int v16335 = v16334 + 1;
+    int v16336 = v16335 + 1;
+    int v16337 = v16336 + 1;
+    int v16338 = v16337 + 1;
+    int v16339 = v16338 + 1;
+    int v16340 = v16339 + 1;
+    int v16341 = v16340 + 1;
+    int v16342 = v16341 + 1;
+    int v16343 = v16342 + 1;
+    int v16344 = v16343 + 1;
+    int v16345 = v16344 + 1;
+    int v16346 = v16345 + 1;
+    int v16347 = v16346 + 1;
+    int v16348 = v16347 + 1;
+    int v16349 = v16348 + 1;
+    int v16350 = v16349 + 1;
+    int v16351 = v16350 + 1;
+    int v16352 = v16351 + 1;
+    int v16353 = v16352 + 1;
+    int v16354 = v16353 + 1;
+    int v16355 = v16354 + 1;
+    int v16356 = v16355 + 1;
+    int v16357 = v16356 + 1;
+    int v16358 = v16357 + 1;
+    int v16359 = v16358 + 1;
+    int v16360 = v16359 + 1;
+    int v16361 = v16360 + 1;
+    int v16362 = v16361 + 1;
+    int v16363 = v16362 + 1;
+    int v16364 = v16363 + 1;
+    int v16365 = v16364 + 1;
+    int v16366 = v16365 + 1;
+    int v16367 = v16366 + 1;
+    int v16368 = v16367 + 1;
+    int v16369 = v16368 + 1;
+    int v16370 = v16369 + 1;
+    int v16371 = v16370 + 1;
+    int v16372 = v16371 + 1;
+    int v16373 = v16372 + 1;
+    int v16374 = v16373 + 1;
+    int v16375 = v16374 + 1;
+    int v16376 = v16375 + 1;
+    int v16377 = v16376 + 1;
+    int v16378 = v16377 + 1;
+    int v16379 = v16378 + 1;
+    int v16380 = v16379 + 1;
+    int v16381 = v16380 + 1;
+    int v16382 = v16381 + 1;
+    int v16383 = v16382 + 1;
+    int v16384 = v16383 + 1;
+    int v16385 = v16384 + 1;
+    int v16386 = v16385 + 1;
+    int v16387 = v16386 + 1;
+    int v16388 = v16387 + 1;
+    int v16389 = v16388 + 1;
+    int v16390 = v16389 + 1;
+    int v16391 = v16390 + 1;
+    int v16392 = v16391 + 1;
+    int v16393 = v16392 + 1;
+    int v16394 = v16393 + 1;
+    int v16395 = v16394 + 1;
+    int v16396 = v16395 + 1;
+    int v16397 = v16396 + 1;
+    int v16398 = v16397 + 1;
+    int v16399 = v16398 + 1;
+    int v16400 = v16399 + 1;
+    int v16401 = v16400 + 1;
+    int v16402 = v16401 + 1;
+    int v16403 = v16402 + 1;
+    int v16404 = v16403 + 1;
+    int v16405 = v16404 + 1;
+    int v16406 = v16405 + 1;
+    int v16407 = v16406 + 1;
+    int v16408 = v16407 + 1;
+    int v16409 = v16408 + 1;
+    int v16410 = v16409 + 1;
+    int v16411 = v16410 + 1;
+    int v16412 = v16411 + 1;
+    int v16413 = v16412 + 1;
+    int v16414 = v16413 + 1;
+    int v16415 = v16414 + 1;
+    int v16416 = v16415 + 1;
+    int v16417 = v16416 + 1;
+    int v16418 = v16417 + 1;
+    int v16419 = v16418 + 1;
+    int v16420 = v16419 + 1;
+    int v16421 = v16420 + 1;
+    int v16422 = v16421 + 1;
+    int v16423 = v16422 + 1;
+    int v16424 = v16423 + 1;
+    int v16425 = v16424 + 1;
+    int v16426 = v16425 + 1;
+    int v16427 = v16426 + 1;
+    int v16428 = v16427 + 1;
+    int v16429 = v16428 + 1;
+    int v16430 = v16429 + 1;
+    int v16431 = v16430 + 1;
+    int v16432 = v16431 + 1;
+    int v16433 = v16432 + 1;
+    int v16434 = v16433 + 1;
+    int v16435 = v16434 + 1;
+    int v16436 = v16435 + 1;
+    int v16437 = v16436 + 1;
+    int v16438 = v16437 + 1;
+    int v16439 = v16438 + 1;
+    int v16440 = v16439 + 1;
+    int v16441 = v16440 + 1;
+    int v16442 = v16441 + 1;
+    int v16443 = v16442 + 1;
+    int v16444 = v16443 + 1;
+    int v16445 = v16444 + 1;
+    int v16446 = v16445 + 1;
+    int v16447 = v16446 + 1;
+    int v16448 = v16447 + 1;
+    int v16449 = v16448 + 1;
+    int v16450 = v16449 + 1;
+    int v16451 = v16450 + 1;
+    int v16452 = v16451 + 1;
+    int v16453 = v16452 + 1;
+    int v16454 = v16453 + 1;
+    int v16455 = v16454 + 1;
+    int v16456 = v16455 + 1;
+    int v16457 = v16456 + 1;
+    int v16458 = v16457 + 1;
+    int v16459 = v16458 + 1;
+    int v16460 = v16459 + 1;
+    int v16461 = v16460 + 1;
+    int v16462 = v16461 + 1;
+    int v16463 = v16462 + 1;
+    int v16464 = v16463 + 1;
+    int v16465 = v16464 + 1;
+    int v16466 = v16465 + 1;
+    int v16467 = v16466 + 1;
+    int v16468 = v16467 + 1;
+    int v16469 = v16468 + 1;
+    int v16470 = v16469 + 1;
+    int v16471 = v16470 + 1;
+    int v16472 = v16471 + 1;
+    int v16473 = v16472 + 1;
+    int v16474 = v16473 + 1;
+    int v16475 = v16474 + 1;
+    int v16476 = v16475 + 1;
+    int v16477 = v16476 + 1;
+    int v16478 = v16477 + 1;
+    int v16479 = v16478 + 1;
+    int v16480 = v16479 + 1;
+    int v16481 = v16480 + 1;
+    int v16482 = v16481 + 1;
+    int v16483 = v16482 + 1;
+    int v16484 = v16483 + 1;
+    int v16485 = v16484 + 1;
+    int v16486 = v16485 + 1;
+    int v16487 = v16486 + 1;
+    int v16488 = v16487 + 1;
+    int v16489 = v16488 + 1;
+    int v16490 = v16489 + 1;
+    int v16491 = v16490 + 1;
+    int v16492 = v16491 + 1;
+    int v16493 = v16492 + 1;
+    int v16494 = v16493 + 1;
+    int v16495 = v16494 + 1;
+    int v16496 = v16495 + 1;
+    int v16497 = v16496 + 1;
+    int v16498 = v16497 + 1;
+    int v16499 = v16498 + 1;
+    int v16500 = v16499 + 1;
+    int v16501 = v16500 + 1;
+    int v16502 = v16501 + 1;
+    int v16503 = v16502 + 1;
+    int v16504 = v16503 + 1;
+    int v16505 = v16504 + 1;
+    int v16506 = v16505 + 1;
+    int v16507 = v16506 + 1;
+    int v16508 = v16507 + 1;
+    int v16509 = v16508 + 1;
+    int v16510 = v16509 + 1;
+    int v16511 = v16510 + 1;
+    int v16512 = v16511 + 1;
+    int v16513 = v16512 + 1;
+    int v16514 = v16513 + 1;
+    int v16515 = v16514 + 1;
+    int v16516 = v16515 + 1;
+    int v16517 = v16516 + 1;
+    int v16518 = v16517 + 1;
+    int v16519 = v16518 + 1;
+    int v16520 = v16519 + 1;
+    int v16521 = v16520 + 1;
+    int v16522 = v16521 + 1;
+    int v16523 = v16522 + 1;
+    int v16524 = v16523 + 1;
+    int v16525 = v16524 + 1;
+    int v16526 = v16525 + 1;
+    int v16527 = v16526 + 1;
+    int v16528 = v16527 + 1;
+    int v16529 = v16528 + 1;
+    int v16530 = v16529 + 1;
+    int v16531 = v16530 + 1;
+    int v16532 = v16531 + 1;
+    int v16533 = v16532 + 1;
+    int v16534 = v16533 + 1;
+    int v16535 = v16534 + 1;
+    int v16536 = v16535 + 1;
+    int v16537 = v16536 + 1;
+    int v16538 = v16537 + 1;
+    int v16539 = v16538 + 1;
+    int v16540 = v16539 + 1;
+    int v16541 = v16540 + 1;
+    int v16542 = v16541 + 1;
+    int v16543 = v16542 + 1;
+    int v16544 = v16543 + 1;
+    int v16545 = v16544 + 1;
+    int v16546 = v16545 + 1;
+    int v16547 = v16546 + 1;
+    int v16548 = v16547 + 1;
+    int v16549 = v16548 + 1;
+    int v16550 = v16549 + 1;
+    int v16551 = v16550 + 1;
+    int v16552 = v16551 + 1;
+    int v16553 = v16552 + 1;
+    int v16554 = v16553 + 1;
+    int v16555 = v16554 + 1;
+    int v16556 = v16555 + 1;
+    int v16557 = v16556 + 1;
+    int v16558 = v16557 + 1;
+    int v16559 = v16558 + 1;
+    int v16560 = v16559 + 1;
+    int v16561 = v16560 + 1;
+    int v16562 = v16561 + 1;
+    int v16563 = v16562 + 1;
+    int v16564 = v16563 + 1;
+    int v16565 = v16564 + 1;
+    int v16566 = v16565 + 1;
+    int v16567 = v16566 + 1;
+    int v16568 = v16567 + 1;
+    int v16569 = v16568 + 1;
+    int v16570 = v16569 + 1;
+    int v16571 = v16570 + 1;
+    int v16572 = v16571 + 1;
+    int v16573 = v16572 + 1;
+    int v16574 = v16573 + 1;
+    int v16575 = v16574 + 1;
+    int v16576 = v16575 + 1;
+    int v16577 = v16576 + 1;
+    int v16578 = v16577 + 1;
+    int v16579 = v16578 + 1;
+    int v16580 = v16579 + 1;
+    int v16581 = v16580 + 1;
+    int v16582 = v16581 + 1;
+    int v16583 = v16582 + 1;
+    int v16584 = v16583 + 1;
+    int v16585 = v16584 + 1;
+    int v16586 = v16585 + 1;
+    int v16587 = v16586 + 1;
+    int v16588 = v16587 + 1;
+    int v16589 = v16588 + 1;
+    int v16590 = v16589 + 1;
+    int v16591 = v16590 + 1;
+    int v16592 = v16591 + 1;
+    int v16593 = v16592 + 1;
+    int v16594 = v16593 + 1;
+    int v16595 = v16594 + 1;
+    int v16596 = v16595 + 1;
+    int v16597 = v16596 + 1;
+    int v16598 = v16597 + 1;
+    int v16599 = v16598 + 1;
+    int v16600 = v16599 + 1;
+    int v16601 = v16600 + 1;
+    int v16602 = v16601 + 1;
+    int v16603 = v16602 + 1;
+    int v16604 = v16603 + 1;
+    int v16605 = v16604 + 1;
+    int v16606 = v16605 + 1;
+    int v16607 = v16606 + 1;
+    int v16608 = v16607 + 1;
+    int v16609 = v16608 + 1;
+    int v16610 = v16609 + 1;
+    int v16611 = v16610 + 1;
+    int v16612 = v16611 + 1;
+    int v16613 = v16612 + 1;
+    int v16614 = v16613 + 1;
+    int v16615 = v16614 + 1;
+    int v16616 = v16615 + 1;
+    int v16617 = v16616 + 1;
+    int v16618 = v16617 + 1;
+    int v16619 = v16618 + 1;
+    int v16620 = v16619 + 1;
+    int v16621 = v16620 + 1;
+    int v16622 = v16621 + 1;
+    int v16623 = v16622 + 1;
+    int v16624 = v16623 + 1;
+    int v16625 = v16624 + 1;
+    int v16626 = v16625 + 1;
+    int v16627 = v16626 + 1;
+    int v16628 = v16627 + 1;
+    int v16629 = v16628 + 1;
+    int v16630 = v16629 + 1;
+    int v16631 = v16630 + 1;
+    int v16632 = v16631 + 1;
+    int v16633 = v16632 + 1;
+    int v16634 = v16633 + 1;
+    int v16635 = v16634 + 1;
+    int v16636 = v16635 + 1;
+    int v16637 = v16636 + 1;
+    int v16638 = v16637 + 1;
+    int v16639 = v16638 + 1;
+    int v16640 = v16639 + 1;
+    int v16641 = v16640 + 1;
+    int v16642 = v16641 + 1;
+    int v16643 = v16642 + 1;
+    int v16644 = v16643 + 1;
+    int v16645 = v16644 + 1;
+    int v16646 = v16645 + 1;
+    int v16647 = v16646 + 1;
+    int v16648 = v16647 + 1;
+    int v16649 = v16648 + 1;
+    int v16650 = v16649 + 1;
+    int v16651 = v16650 + 1;
+    int v16652 = v16651 + 1;
+    int v16653 = v16652 + 1;
+    int v16654 = v16653 + 1;
+    int v16655 = v16654 + 1;
+    int v16656 = v16655 + 1;
+    int v16657 = v16656 + 1;
+    int v16658 = v16657 + 1;
+    int v16659 = v16658 + 1;
+    int v16660 = v16659 + 1;
+    int v16661 = v16660 + 1;
+    int v16662 = v16661 + 1;
+    int v16663 = v16662 + 1;
+    int v16664 = v16663 + 1;
+    int v16665 = v16664 + 1;
+    int v16666 = v16665 + 1;
+    return v16666 % 256;
+}
@@ -0,0 +1,5 @@
+int main() {
+    int a = 3;
+    int b = ((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((a + 1) - 2) * 3 % 7) % 4) / 5) & 1) | 2) ^ 3) + 4) - 5) * 1 % 7) % 2) / 3) & 4) | 5) ^ 1) + 2) - 3) * 4 % 7) % 5) / 1) & 2) | 3) ^ 4) + 5) - 1) * 2 % 7) % 3) / 4) & 5) | 1) ^ 2) + 3) - 4) * 5 % 7) % 1) / 2) & 3) | 4) ^ 5) + 1) - 2) * 3 % 7) % 4) / 5) & 1) | 2) ^ 3) + 4) - 5) * 1 % 7) % 2) / 3) & 4) | 5) ^ 1) + 2) - 3) * 4 % 7) % 5) / 1) & 2) | 3) ^ 4) + 5) - 1) * 2 % 7) % 3) / 4) & 5) | 1) ^ 2) + 3) - 4) * 5 % 7) % 1) / 2) & 3) | 4) ^ 5) + 1) - 2) * 3 % 7) % 4) / 5) & 1) | 2) ^ 3) + 4) - 5) * 1 % 7) % 2) / 3) & 4) | 5) ^ 1) + 2) - 3) * 4 % 7) % 5) / 1) & 2) | 3) ^ 4) + 5) - 1) * 2 % 7) % 3) / 4) & 5) | 1) ^ 2) + 3) - 4) * 5 % 7) % 1) / 2) & 3) | 4) ^ 5);
+    return b;
+}
@@ -0,0 +1,17 @@
+int main() {
+    int s = 0;
+    int i = 0;
+    while (i < 10 && s < 20) {
+        if (i > 2 && i != 5 || i == 0) {
+            s = s + i;
+        } else {
+            s = s + 1;
+        }
+        i = i + 1;
+    }
+    if (i == 10) {
+        int t = s > 4 && i > 4;
+        s = s + t;
+    }
+    return s;
+}
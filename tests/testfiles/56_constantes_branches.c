@@ -0,0 +1,24 @@
+int main() {
+    int n = 4;
+    int d = 0;
+    int r = 1;
+    if (n * 2 > 7) {
+        r = r + 10;
+    } else {
+        r = r / d;
+    }
+    int i = 0;
+    int k = 3;
+    while (i < n) {
+        if (k == 3) {
+            r = r + i;
+        } else {
+            k = 0;
+        }
+        i = i + 1;
+    }
+    if (!(k - 3) && r != 0) {
+        r = r * k;
+    }
+    return r;
+}
@@ -0,0 +1,31 @@
+int f(int a) {
+    int x;
+    int t;
+    x = a + 1;
+    t = a * 3;
+    if (a > 2) {
+        x = x + 2;
+    }
+    return x;
+    x = 5;
+    putchar(65);
+}
+
+int g(int a) {
+    int q = a / 2;
+    if (a) {
+    } else {
+    }
+    while (0) {
+        putchar(66);
+    }
+    return a + 1;
+    return q;
+}
+
+int main() {
+    int y;
+    y = f(4);
+    y = y + g(y);
+    return y;
+}
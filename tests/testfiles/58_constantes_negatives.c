@@ -0,0 +1,20 @@
+int f(int a) {
+    int r = a + -5;
+    r = r - -7;
+    r = r + -4096;
+    r = r - -4096;
+    if (r > -3) {
+        r = r * -2;
+    }
+    if (-10 < r) {
+        r = r + 100;
+    }
+    if (r <= -5000) {
+        r = 0;
+    }
+    return r + (a == -4);
+}
+
+int main() {
+    return f(3) + f(-4);
+}
@@ -0,0 +1,20 @@
+int g(int a) {
+    int r = a + 4095;
+    r = r + 4096;
+    r = r - 65536;
+    r = r + 70000;
+    r = r + -70000;
+    r = r - -70000;
+    r = r + 1000000;
+    if (r > 1000000) {
+        r = r - 1000000;
+    }
+    return r / 1000;
+}
+
+int main() {
+    int x = 1000000;
+    int y = 305419896;
+    y = y - 305419896;
+    return g(x) + y - 1000 + 8;
+}
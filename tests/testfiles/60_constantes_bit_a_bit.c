@@ -0,0 +1,14 @@
+int h(int a) {
+    int r = a & 255;
+    r = r | 65280;
+    r = r ^ 1431655765;
+    r = r & 1000;
+    r = 240 & r;
+    r = r | -256;
+    r = r ^ -1;
+    return r;
+}
+
+int main() {
+    return h(4660) + h(0);
+}